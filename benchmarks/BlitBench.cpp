@@ -0,0 +1,904 @@
+/**
+ * @file BlitBench.cpp
+ * @brief VxBlitEngine benchmarks.
+ */
+
+#include "VxMathBench.h"
+
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "VxMath.h"
+#include "VxBlitEngine.h"
+
+namespace {
+
+VxImageDescEx MakeDesc(VX_PIXELFORMAT format, int width, int height, XBYTE *image) {
+    VxImageDescEx desc;
+    VxPixelFormat2ImageDesc(format, desc);
+    desc.Width = width;
+    desc.Height = height;
+    desc.BytesPerLine = width * (desc.BitsPerPixel / 8);
+    desc.Image = image;
+    return desc;
+}
+
+void FillPattern(std::vector<XBYTE> &buffer, int seed) {
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        buffer[i] = static_cast<XBYTE>((i * 131 + seed * 7) & 0xFF);
+    }
+}
+
+// Per-thread source/destination pair so threads only share the blitter.
+struct BlitSurfaces {
+    std::vector<XBYTE> src;
+    std::vector<XBYTE> dst;
+    VxImageDescEx srcDesc;
+    VxImageDescEx dstDesc;
+
+    BlitSurfaces(int width, int height, int seed)
+        : src(width * height * 4), dst(width * height * 2) {
+        FillPattern(src, seed);
+        srcDesc = MakeDesc(_32_ARGB8888, width, height, src.data());
+        dstDesc = MakeDesc(_16_RGB565, width, height, dst.data());
+    }
+};
+
+} // namespace
+
+// N threads issuing VxDoBlit concurrently against the shared TheBlitter.
+// Total work grows with N, so ideal scaling keeps the per-call time flat.
+VX_BENCHMARK(BlitContention) {
+    const int size = ctx.Quick() ? 64 : 256;
+    const int callsPerThread = ctx.Quick() ? 64 : 512;
+
+    // Always sweep a few threads so contention shows up even on small machines.
+    int maxThreads = static_cast<int>(std::thread::hardware_concurrency());
+    if (maxThreads < 4) {
+        maxThreads = 4;
+    }
+
+    double singleThreadSeconds = 0.0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        std::vector<BlitSurfaces *> surfaces;
+        for (int t = 0; t < threads; ++t) {
+            surfaces.push_back(new BlitSurfaces(size, size, t));
+        }
+
+        const double seconds = VxBench::TimeBest(ctx, [&]() {
+            std::vector<std::thread> workers;
+            for (int t = 0; t < threads; ++t) {
+                BlitSurfaces *s = surfaces[t];
+                workers.emplace_back([s, callsPerThread]() {
+                    for (int i = 0; i < callsPerThread; ++i) {
+                        VxDoBlit(s->srcDesc, s->dstDesc);
+                    }
+                });
+            }
+            for (std::thread &worker : workers) {
+                worker.join();
+            }
+        });
+
+        if (threads == 1) {
+            singleThreadSeconds = seconds;
+        }
+        const double pixels = static_cast<double>(size) * size * callsPerThread * threads;
+        const double scaling = (seconds > 0.0) ? (singleThreadSeconds * threads) / seconds : 0.0;
+
+        char variant[64];
+        std::snprintf(variant, sizeof(variant), "ARGB->565 %dx%d threads=%d scale=%.2fx", size, size, threads,
+                      scaling);
+        ctx.Report(variant, seconds, pixels, pixels * 6.0);
+
+        for (BlitSurfaces *s : surfaces) {
+            delete s;
+        }
+    }
+}
+
+// One large blit split into row bands across a growing number of threads.
+VX_BENCHMARK(BlitParallelBands) {
+    const int size = ctx.Quick() ? 512 : 4096;
+    const int minRowsPerBand = 64;
+
+    int savedThreads = 1;
+    int savedMinRows = 64;
+    VxGetBlitParallelism(savedThreads, savedMinRows);
+
+    int maxThreads = static_cast<int>(std::thread::hardware_concurrency());
+    if (maxThreads < 4) {
+        maxThreads = 4;
+    }
+
+    BlitSurfaces surfaces(size, size, 0);
+    double singleThreadSeconds = 0.0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        VxSetBlitParallelism(threads, minRowsPerBand);
+        const double seconds = VxBench::TimeBest(ctx, [&]() {
+            VxDoBlit(surfaces.srcDesc, surfaces.dstDesc);
+        });
+
+        if (threads == 1) {
+            singleThreadSeconds = seconds;
+        }
+        const double pixels = static_cast<double>(size) * size;
+        const double speedup = (seconds > 0.0) ? singleThreadSeconds / seconds : 0.0;
+
+        char variant[64];
+        std::snprintf(variant, sizeof(variant), "ARGB->565 %dx%d threads=%d speedup=%.2fx", size, size, threads,
+                      speedup);
+        ctx.Report(variant, seconds, pixels, pixels * 6.0);
+    }
+
+    VxSetBlitParallelism(savedThreads, savedMinRows);
+}
+
+// Many small sprite conversions: one VxDoBlit per image vs. one VxDoBlitBatch.
+VX_BENCHMARK(BlitBatch) {
+    const int count = ctx.Quick() ? 1000 : 10000;
+    const int size = 16;
+
+    std::vector<BlitSurfaces *> sprites;
+    std::vector<VxImageDescEx> srcDescs;
+    std::vector<VxImageDescEx> dstDescs;
+    for (int i = 0; i < count; ++i) {
+        BlitSurfaces *s = new BlitSurfaces(size, size, i);
+        sprites.push_back(s);
+        srcDescs.push_back(s->srcDesc);
+        dstDescs.push_back(s->dstDesc);
+    }
+
+    const double pixels = static_cast<double>(size) * size * count;
+    char variant[64];
+
+    const double individual = VxBench::TimeBest(ctx, [&]() {
+        for (int i = 0; i < count; ++i) {
+            VxDoBlit(srcDescs[i], dstDescs[i]);
+        }
+    });
+    std::snprintf(variant, sizeof(variant), "%d x %dx%d VxDoBlit", count, size, size);
+    ctx.Report(variant, individual, count, pixels * 6.0);
+
+    const double batched = VxBench::TimeBest(ctx, [&]() {
+        VxDoBlitBatch(srcDescs.data(), dstDescs.data(), count, FALSE);
+    });
+    std::snprintf(variant, sizeof(variant), "%d x %dx%d batch", count, size, size);
+    ctx.Report(variant, batched, count, pixels * 6.0);
+
+    const double parallel = VxBench::TimeBest(ctx, [&]() {
+        VxDoBlitBatch(srcDescs.data(), dstDescs.data(), count, TRUE);
+    });
+    std::snprintf(variant, sizeof(variant), "%d x %dx%d batch parallel", count, size, size);
+    ctx.Report(variant, parallel, count, pixels * 6.0);
+
+    for (BlitSurfaces *s : sprites) {
+        delete s;
+    }
+}
+
+// The same format pair blitted over and over: per-call setup vs. a cached plan.
+VX_BENCHMARK(BlitPlan) {
+    const int calls = ctx.Quick() ? 2000 : 20000;
+    const int sizes[] = {8, 32, 128};
+
+    for (int size : sizes) {
+        BlitSurfaces surfaces(size, size, size);
+        VxBlitPlan *plan = VxCreateBlitPlan(surfaces.srcDesc, surfaces.dstDesc);
+        const double pixels = static_cast<double>(size) * size * calls;
+        char variant[64];
+
+        const double direct = VxBench::TimeBest(ctx, [&]() {
+            for (int i = 0; i < calls; ++i) {
+                VxDoBlit(surfaces.srcDesc, surfaces.dstDesc);
+            }
+        });
+        std::snprintf(variant, sizeof(variant), "ARGB->565 %dx%d VxDoBlit", size, size);
+        ctx.Report(variant, direct, calls, pixels * 6.0);
+
+        const double planned = VxBench::TimeBest(ctx, [&]() {
+            for (int i = 0; i < calls; ++i) {
+                VxExecuteBlitPlan(plan, surfaces.src.data(), surfaces.dst.data());
+            }
+        });
+        std::snprintf(variant, sizeof(variant), "ARGB->565 %dx%d plan", size, size);
+        ctx.Report(variant, planned, calls, pixels * 6.0);
+
+        VxDeleteBlitPlan(plan);
+    }
+}
+
+// DXT1/DXT3/DXT5 decoding to ARGB 8888 on each SIMD tier.
+VX_BENCHMARK(DXTDecode) {
+    const int size = ctx.Quick() ? 256 : 1024;
+    const VX_PIXELFORMAT formats[] = {_DXT1, _DXT3, _DXT5};
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_NEON,
+                         VX_SIMD_MODE_WASM_SIMD128};
+    const int savedMode = VxGetSIMDOverride();
+
+    std::vector<XBYTE> dst(size * size * 4);
+    VxImageDescEx dstDesc = MakeDesc(_32_ARGB8888, size, size, dst.data());
+
+    for (VX_PIXELFORMAT format : formats) {
+        VxImageDescEx srcDesc;
+        VxPixelFormat2ImageDesc(format, srcDesc);
+        srcDesc.Width = size;
+        srcDesc.Height = size;
+        srcDesc.TotalImageSize = (size / 4) * (size / 4) * (format == _DXT1 ? 8 : 16);
+        std::vector<XBYTE> src(srcDesc.TotalImageSize);
+        FillPattern(src, format);
+        srcDesc.Image = src.data();
+
+        for (int mode : modes) {
+            if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) {
+                continue;
+            }
+            const double seconds = VxBench::TimeBest(ctx, [&]() { VxDoBlit(srcDesc, dstDesc); });
+
+            char variant[64];
+            std::snprintf(variant, sizeof(variant), "%s %dx%d %s", VxPixelFormat2String(format), size, size,
+                          VxGetSIMDBackendName(mode));
+            const double pixels = static_cast<double>(size) * size;
+            ctx.Report(variant, seconds, pixels, srcDesc.TotalImageSize + pixels * 4.0);
+        }
+    }
+
+    VxSetSIMDOverride(savedMode);
+}
+
+// ARGB 8888 -> DXT1/DXT3/DXT5 encoding per quality and SIMD tier. The variant
+// name carries the round-trip PSNR over RGB.
+VX_BENCHMARK(DXTEncode) {
+    const int size = ctx.Quick() ? 128 : 512;
+    const VX_PIXELFORMAT formats[] = {_DXT1, _DXT3, _DXT5};
+    const int qualities[] = {VX_DXTQUALITY_FAST, VX_DXTQUALITY_HIGH};
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_NEON,
+                         VX_SIMD_MODE_WASM_SIMD128};
+    const int savedMode = VxGetSIMDOverride();
+    const int savedQuality = VxGetDXTCompressionQuality();
+
+    // Smooth gradients with mild noise; opaque so DXT1 stays in four-color mode.
+    std::vector<XDWORD> pixels(size * size);
+    XDWORD seed = 1;
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            seed = seed * 1664525u + 1013904223u;
+            const int noise = static_cast<int>(seed >> 30);
+            const XDWORD r = (x * 255 / size + noise) & 0xFF;
+            const XDWORD g = (y * 255 / size + noise) & 0xFF;
+            const XDWORD b = ((x + y) * 255 / (2 * size)) & 0xFF;
+            pixels[y * size + x] = 0xFF000000 | (r << 16) | (g << 8) | b;
+        }
+    }
+    VxImageDescEx srcDesc = MakeDesc(_32_ARGB8888, size, size, reinterpret_cast<XBYTE *>(pixels.data()));
+
+    std::vector<XDWORD> decoded(size * size);
+    VxImageDescEx decodedDesc = MakeDesc(_32_ARGB8888, size, size, reinterpret_cast<XBYTE *>(decoded.data()));
+
+    for (VX_PIXELFORMAT format : formats) {
+        VxImageDescEx dstDesc;
+        VxPixelFormat2ImageDesc(format, dstDesc);
+        dstDesc.Width = size;
+        dstDesc.Height = size;
+        dstDesc.TotalImageSize = (size / 4) * (size / 4) * (format == _DXT1 ? 8 : 16);
+        std::vector<XBYTE> blocks(dstDesc.TotalImageSize);
+        dstDesc.Image = blocks.data();
+
+        for (int quality : qualities) {
+            VxSetDXTCompressionQuality(quality);
+            for (int mode : modes) {
+                if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) {
+                    continue;
+                }
+                const double seconds = VxBench::TimeBest(ctx, [&]() { VxDoBlit(srcDesc, dstDesc); });
+
+                VxDoBlit(dstDesc, decodedDesc);
+                double squaredError = 0.0;
+                for (int i = 0; i < size * size; ++i) {
+                    for (int shift = 0; shift < 24; shift += 8) {
+                        const int d = static_cast<int>((pixels[i] >> shift) & 0xFF) -
+                                      static_cast<int>((decoded[i] >> shift) & 0xFF);
+                        squaredError += d * d;
+                    }
+                }
+                const double mse = squaredError / (3.0 * size * size);
+                const double psnr = (mse > 0.0) ? 10.0 * std::log10(255.0 * 255.0 / mse) : 99.0;
+
+                char variant[96];
+                std::snprintf(variant, sizeof(variant), "%s %dx%d %s %s psnr=%.2fdB", VxPixelFormat2String(format),
+                              size, size, quality == VX_DXTQUALITY_HIGH ? "high" : "fast",
+                              VxGetSIMDBackendName(mode), psnr);
+                const double count = static_cast<double>(size) * size;
+                ctx.Report(variant, seconds, count, count * 4.0 + dstDesc.TotalImageSize);
+            }
+        }
+    }
+
+    VxSetDXTCompressionQuality(savedQuality);
+    VxSetSIMDOverride(savedMode);
+}
+
+// VxResizeImage32 per filter and SIMD tier: a 4x shrink and a 2x enlargement.
+// The shrink variant name carries the PSNR against an ideally band-limited
+// zone plate, so speed can be weighed against aliasing and blur.
+VX_BENCHMARK(ResizeFilters) {
+    const int size = ctx.Quick() ? 256 : 1024;
+    const VX_RESIZEFILTER filters[] = {VX_RESIZEFILTER_BILINEAR, VX_RESIZEFILTER_BOX, VX_RESIZEFILTER_TRIANGLE,
+                                       VX_RESIZEFILTER_MITCHELL, VX_RESIZEFILTER_LANCZOS3};
+    const char *filterNames[] = {"bilinear", "box", "triangle", "mitchell", "lanczos3"};
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_NEON,
+                         VX_SIMD_MODE_WASM_SIMD128};
+    const int savedMode = VxGetSIMDOverride();
+
+    // Zone plate cos(pi r^2 / 8n): the local frequency r / 8n cycles per pixel
+    // crosses the shrunk image's Nyquist limit (1/8) at r = n.
+    const int small = size / 4;
+    const double scale = 3.14159265 / (size * 8.0);
+    std::vector<XDWORD> pixels(size * size);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            const XDWORD v = static_cast<XDWORD>(127.5 + 127.5 * std::cos(scale * (x * x + y * y)));
+            pixels[y * size + x] = 0xFF000000 | (v << 16) | (v << 8) | (255 - v);
+        }
+    }
+    VxImageDescEx srcDesc = MakeDesc(_32_ARGB8888, size, size, reinterpret_cast<XBYTE *>(pixels.data()));
+
+    // Ideal shrink: the pattern where it is representable, flat gray beyond.
+    std::vector<double> reference(small * small);
+    for (int y = 0; y < small; ++y) {
+        for (int x = 0; x < small; ++x) {
+            const double sx = x * 4.0 + 1.5;
+            const double sy = y * 4.0 + 1.5;
+            const double r2 = sx * sx + sy * sy;
+            reference[y * small + x] =
+                r2 < static_cast<double>(size) * size ? 127.5 + 127.5 * std::cos(scale * r2) : 127.5;
+        }
+    }
+
+    std::vector<XDWORD> shrunk(small * small);
+    VxImageDescEx shrunkDesc = MakeDesc(_32_ARGB8888, small, small, reinterpret_cast<XBYTE *>(shrunk.data()));
+    const int large = size * 2;
+    std::vector<XDWORD> enlarged(large * large);
+    VxImageDescEx enlargedDesc = MakeDesc(_32_ARGB8888, large, large, reinterpret_cast<XBYTE *>(enlarged.data()));
+
+    for (int f = 0; f < 5; ++f) {
+        const VX_RESIZEFILTER filter = filters[f];
+        VxResizeImage32(srcDesc, shrunkDesc, filter);
+        double squaredError = 0.0;
+        for (int i = 0; i < small * small; ++i) {
+            const double d = reference[i] - static_cast<double>((shrunk[i] >> 8) & 0xFF);
+            squaredError += d * d;
+        }
+        const double psnr = 10.0 * std::log10(255.0 * 255.0 * small * small / (squaredError + 1e-9));
+
+        for (int mode : modes) {
+            if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) {
+                continue;
+            }
+            char variant[96];
+            const double shrinkSeconds =
+                VxBench::TimeBest(ctx, [&]() { VxResizeImage32(srcDesc, shrunkDesc, filter); });
+            std::snprintf(variant, sizeof(variant), "%s %d->%d %s (%.1f dB)", filterNames[f], size, small,
+                          VxGetSIMDBackendName(mode), psnr);
+            ctx.Report(variant, shrinkSeconds, static_cast<double>(small) * small,
+                       (static_cast<double>(size) * size + small * small) * 4.0);
+
+            const double enlargeSeconds =
+                VxBench::TimeBest(ctx, [&]() { VxResizeImage32(srcDesc, enlargedDesc, filter); });
+            std::snprintf(variant, sizeof(variant), "%s %d->%d %s", filterNames[f], size, large,
+                          VxGetSIMDBackendName(mode));
+            ctx.Report(variant, enlargeSeconds, static_cast<double>(large) * large,
+                       (static_cast<double>(size) * size + large * large) * 4.0);
+        }
+    }
+
+    VxSetSIMDOverride(savedMode);
+}
+
+// 16-bit resize: the fused strip path against the whole-image route through
+// ARGB 8888 temporaries it replaced. The byte count is the memory traffic of
+// each route (the fallback writes and re-reads both temporaries).
+VX_BENCHMARK(Resize16) {
+    const int size = ctx.Quick() ? 512 : 2048;
+    const VX_PIXELFORMAT formats[] = {_16_RGB565, _16_ARGB4444};
+    const int shapes[][2] = {{size * 5 / 8, size * 3 / 8}, {size * 3 / 2, size * 3 / 2}};
+
+    std::vector<XBYTE> src(size * size * 2);
+    FillPattern(src, 5);
+    std::vector<XBYTE> srcArgb(size * size * 4);
+    VxImageDescEx srcArgbDesc = MakeDesc(_32_ARGB8888, size, size, srcArgb.data());
+
+    for (VX_PIXELFORMAT format : formats) {
+        VxImageDescEx srcDesc = MakeDesc(format, size, size, src.data());
+        for (const int *shape : shapes) {
+            const int dstW = shape[0];
+            const int dstH = shape[1];
+            std::vector<XBYTE> dst(dstW * dstH * 2);
+            VxImageDescEx dstDesc = MakeDesc(format, dstW, dstH, dst.data());
+            std::vector<XBYTE> dstArgb(dstW * dstH * 4);
+            VxImageDescEx dstArgbDesc = MakeDesc(_32_ARGB8888, dstW, dstH, dstArgb.data());
+
+            const double srcPixels = static_cast<double>(size) * size;
+            const double dstPixels = static_cast<double>(dstW) * dstH;
+            char variant[96];
+
+            const double fused = VxBench::TimeBest(ctx, [&]() { VxResizeImage32(srcDesc, dstDesc); });
+            std::snprintf(variant, sizeof(variant), "%s %d->%dx%d fused", VxPixelFormat2String(format), size, dstW,
+                          dstH);
+            ctx.Report(variant, fused, dstPixels, srcPixels * 2.0 + dstPixels * 2.0);
+
+            const double viaArgb = VxBench::TimeBest(ctx, [&]() {
+                VxDoBlit(srcDesc, srcArgbDesc);
+                VxResizeImage32(srcArgbDesc, dstArgbDesc);
+                VxDoBlit(dstArgbDesc, dstDesc);
+            });
+            std::snprintf(variant, sizeof(variant), "%s %d->%dx%d via ARGB", VxPixelFormat2String(format), size,
+                          dstW, dstH);
+            ctx.Report(variant, viaArgb, dstPixels, srcPixels * (2.0 + 8.0) + dstPixels * (8.0 + 2.0));
+        }
+    }
+}
+
+// Full mip chain in one pass against the level-by-level VxGenerateMipMap loop
+// (which re-reads each level from memory to build the next one).
+VX_BENCHMARK(MipChain) {
+    const int size = ctx.Quick() ? 512 : 2048;
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_NEON,
+                         VX_SIMD_MODE_WASM_SIMD128};
+    const XDWORD flagSets[] = {VX_MIPCHAIN_DEFAULT, VX_MIPCHAIN_SRGB | VX_MIPCHAIN_ALPHA_WEIGHTED};
+    const char *flagNames[] = {"default", "srgb+alpha"};
+    const int savedMode = VxGetSIMDOverride();
+
+    std::vector<XBYTE> src(size * size * 4);
+    FillPattern(src, 9);
+    VxImageDescEx srcDesc = MakeDesc(_32_ARGB8888, size, size, src.data());
+    const int chainSize = VxGetMipChainSize(size, size);
+    std::vector<XBYTE> chain(chainSize);
+    const double texels = chainSize / 4.0;
+    const double bytes = static_cast<double>(size) * size * 4.0 + chainSize;
+    char variant[96];
+
+    for (int mode : modes) {
+        if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) {
+            continue;
+        }
+        for (int f = 0; f < 2; ++f) {
+            const double seconds =
+                VxBench::TimeBest(ctx, [&]() { VxGenerateMipChain(srcDesc, chain.data(), flagSets[f]); });
+            std::snprintf(variant, sizeof(variant), "chain %d %s %s", size, flagNames[f], VxGetSIMDBackendName(mode));
+            ctx.Report(variant, seconds, texels, bytes);
+        }
+
+        const double iterative = VxBench::TimeBest(ctx, [&]() {
+            VxImageDescEx level = srcDesc;
+            XBYTE *out = chain.data();
+            while (level.Width > 1 && level.Height > 1) {
+                VxGenerateMipMap(level, out);
+                level = MakeDesc(_32_ARGB8888, level.Width / 2, level.Height / 2, out);
+                out += level.Width * level.Height * 4;
+            }
+        });
+        std::snprintf(variant, sizeof(variant), "VxGenerateMipMap loop %d %s", size, VxGetSIMDBackendName(mode));
+        ctx.Report(variant, iterative, texels, bytes + chainSize);
+    }
+    VxSetSIMDOverride(savedMode);
+}
+
+// Palette quantization of a photo-like 32-bit image (smooth gradients plus
+// noise). The variant names carry the PSNR of the paletted result so quality
+// regressions show up next to the timings.
+VX_BENCHMARK(Quantize) {
+    const int size = ctx.Quick() ? 512 : 2048;
+    std::vector<XDWORD> pixels(size * size);
+    XDWORD state = 12345;
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            state = state * 1664525u + 1013904223u;
+            const int noise = static_cast<int>(state >> 28) - 8;
+            const int r = XMin(255, XMax(0, x * 255 / size + noise));
+            const int g = XMin(255, XMax(0, y * 255 / size + noise));
+            const int b = XMin(255, XMax(0, 128 + static_cast<int>(100 * std::sin((x + y) * 0.01)) + noise));
+            pixels[y * size + x] = 0xFF000000 | (r << 16) | (g << 8) | b;
+        }
+    }
+    VxImageDescEx srcDesc = MakeDesc(_32_ARGB8888, size, size, reinterpret_cast<XBYTE *>(pixels.data()));
+
+    std::vector<XBYTE> indices(size * size);
+    std::vector<XDWORD> palette(256);
+    VxImageDescEx dstDesc = srcDesc;
+    dstDesc.BitsPerPixel = 8;
+    dstDesc.BytesPerLine = size;
+    dstDesc.RedMask = dstDesc.GreenMask = dstDesc.BlueMask = dstDesc.AlphaMask = 0;
+    dstDesc.ColorMapEntries = 256;
+    dstDesc.BytesPerColorEntry = 4;
+    dstDesc.ColorMap = reinterpret_cast<XBYTE *>(palette.data());
+    dstDesc.Image = indices.data();
+
+    const char *names[] = {"neuquant", "median-cut"};
+    for (int method = 0; method < 2; ++method) {
+        const auto run = [&]() {
+            if (method == 0) {
+                TheBlitter.QuantizeImage(srcDesc, dstDesc);
+            } else {
+                TheBlitter.QuantizeImageMedianCut(srcDesc, dstDesc);
+            }
+        };
+        const double seconds = VxBench::TimeBest(ctx, run);
+
+        double squaredError = 0.0;
+        for (int i = 0; i < size * size; ++i) {
+            const XDWORD a = pixels[i];
+            const XDWORD b = palette[indices[i]];
+            for (int shift = 0; shift < 24; shift += 8) {
+                const double d = static_cast<double>((a >> shift) & 0xFF) - static_cast<double>((b >> shift) & 0xFF);
+                squaredError += d * d;
+            }
+        }
+        const double psnr = 10.0 * std::log10(255.0 * 255.0 * 3.0 * size * size / (squaredError + 1e-9));
+
+        char variant[96];
+        std::snprintf(variant, sizeof(variant), "%s %d (%.2f dB)", names[method], size, psnr);
+        ctx.Report(variant, seconds, static_cast<double>(size) * size, static_cast<double>(size) * size * 5.0);
+    }
+}
+
+// Dithered blits: ordered ARGB 8888 -> RGB 565 against the plain blit on each
+// SIMD tier, and error-diffused palettes against nearest-color mapping.
+VX_BENCHMARK(Dither) {
+    const int size = ctx.Quick() ? 256 : 1024;
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_NEON,
+                         VX_SIMD_MODE_WASM_SIMD128};
+    const int savedMode = VxGetSIMDOverride();
+
+    std::vector<XBYTE> src(size * size * 4);
+    FillPattern(src, 11);
+    std::vector<XBYTE> dst(size * size * 2);
+    VxImageDescEx srcDesc = MakeDesc(_32_ARGB8888, size, size, src.data());
+    VxImageDescEx dstDesc = MakeDesc(_16_RGB565, size, size, dst.data());
+    const double pixels = static_cast<double>(size) * size;
+
+    for (int mode : modes) {
+        if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) {
+            continue;
+        }
+        for (int dither = VX_DITHER_NONE; dither <= VX_DITHER_ORDERED; ++dither) {
+            const double seconds = VxBench::TimeBest(
+                ctx, [&]() { VxDoBlit(srcDesc, dstDesc, static_cast<VX_DITHERMODE>(dither)); });
+
+            char variant[64];
+            std::snprintf(variant, sizeof(variant), "565 %s %dx%d %s", dither ? "ordered" : "plain", size, size,
+                          VxGetSIMDBackendName(mode));
+            ctx.Report(variant, seconds, pixels, pixels * 6.0);
+        }
+    }
+    VxSetSIMDOverride(savedMode);
+
+    std::vector<XBYTE> indices(size * size);
+    std::vector<XDWORD> palette(256);
+    VxImageDescEx paletted = MakeDesc(_32_ARGB8888, size, size, indices.data());
+    paletted.BitsPerPixel = 8;
+    paletted.BytesPerLine = size;
+    paletted.RedMask = paletted.GreenMask = paletted.BlueMask = paletted.AlphaMask = 0;
+    paletted.ColorMapEntries = 256;
+    paletted.BytesPerColorEntry = 4;
+    paletted.ColorMap = reinterpret_cast<XBYTE *>(palette.data());
+
+    for (int dither = VX_DITHER_NONE; dither <= VX_DITHER_ERRORDIFFUSION; dither += VX_DITHER_ERRORDIFFUSION) {
+        const double seconds = VxBench::TimeBest(
+            ctx, [&]() { TheBlitter.QuantizeImageMedianCut(srcDesc, paletted, dither); });
+
+        char variant[64];
+        std::snprintf(variant, sizeof(variant), "median-cut %s %dx%d", dither ? "diffused" : "nearest", size, size);
+        ctx.Report(variant, seconds, pixels, pixels * 5.0);
+    }
+}
+
+// Compositing a full-screen layer onto a framebuffer-sized destination with
+// each VX_BLENDOP on each SIMD tier.
+VX_BENCHMARK(Blend) {
+    const int size = ctx.Quick() ? 256 : 1024;
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_NEON,
+                         VX_SIMD_MODE_WASM_SIMD128};
+    const char *const opNames[] = {"multiply", "srcover", "srcover-pm", "add", "screen", "lerp"};
+    const int savedMode = VxGetSIMDOverride();
+
+    std::vector<XBYTE> src(size * size * 4);
+    std::vector<XBYTE> dst(size * size * 4);
+    FillPattern(src, 5);
+    FillPattern(dst, 6);
+    VxImageDescEx srcDesc = MakeDesc(_32_ARGB8888, size, size, src.data());
+    VxImageDescEx dstDesc = MakeDesc(_32_ARGB8888, size, size, dst.data());
+    const double pixels = static_cast<double>(size) * size;
+
+    for (int mode : modes) {
+        if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) {
+            continue;
+        }
+        for (int op = VX_BLEND_MULTIPLY; op <= VX_BLEND_LERP; ++op) {
+            const double seconds = VxBench::TimeBest(
+                ctx, [&]() { VxBlendImage(srcDesc, dstDesc, static_cast<VX_BLENDOP>(op), 0, 0, 128); });
+
+            char variant[64];
+            std::snprintf(variant, sizeof(variant), "%s %dx%d %s", opNames[op], size, size,
+                          VxGetSIMDBackendName(mode));
+            ctx.Report(variant, seconds, pixels, pixels * 12.0);
+        }
+    }
+    VxSetSIMDOverride(savedMode);
+}
+
+// Byte-aligned layouts without a specific kernel (bump maps, BGR) on each tier.
+VX_BENCHMARK(ShuffleLayouts) {
+    const int size = ctx.Quick() ? 256 : 1024;
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSSE3, VX_SIMD_MODE_NEON, VX_SIMD_MODE_WASM_SIMD128};
+    const struct {
+        VX_PIXELFORMAT src;
+        VX_PIXELFORMAT dst;
+        const char *name;
+    } pairs[] = {
+        {_16_V8U8, _32_X8L8V8U8, "v8u8->x8l8v8u8"},
+        {_32_X8L8V8U8, _16_V8U8, "x8l8v8u8->v8u8"},
+        {_24_RGB888, _24_BGR888, "rgb24->bgr24"},
+        {_32_ARGB8888, _32_BGR888, "argb->bgr32"},
+    };
+    const int savedMode = VxGetSIMDOverride();
+
+    std::vector<XBYTE> src(size * size * 4);
+    std::vector<XBYTE> dst(size * size * 4);
+    FillPattern(src, 8);
+    const double pixels = static_cast<double>(size) * size;
+
+    for (int mode : modes) {
+        if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) {
+            continue;
+        }
+        for (const auto &pair : pairs) {
+            VxImageDescEx srcDesc = MakeDesc(pair.src, size, size, src.data());
+            VxImageDescEx dstDesc = MakeDesc(pair.dst, size, size, dst.data());
+            const double seconds = VxBench::TimeBest(ctx, [&]() { VxDoBlit(srcDesc, dstDesc); });
+
+            char variant[64];
+            std::snprintf(variant, sizeof(variant), "%s %dx%d %s", pair.name, size, size,
+                          VxGetSIMDBackendName(mode));
+            ctx.Report(variant, seconds, pixels,
+                       pixels * (srcDesc.BitsPerPixel + dstDesc.BitsPerPixel) / 8.0);
+        }
+    }
+    VxSetSIMDOverride(savedMode);
+}
+
+// 8-bit indexed images to every destination depth, and remapped into a
+// second palette, on each tier.
+VX_BENCHMARK(Paletted) {
+    const int size = ctx.Quick() ? 256 : 1024;
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_SSSE3, VX_SIMD_MODE_AVX2,
+                         VX_SIMD_MODE_AVX512, VX_SIMD_MODE_NEON, VX_SIMD_MODE_WASM_SIMD128};
+    const struct {
+        VX_PIXELFORMAT format;
+        const char *name;
+    } targets[] = {
+        {_16_RGB565, "pal8->565"},
+        {_16_ARGB1555, "pal8->1555"},
+        {_24_RGB888, "pal8->rgb24"},
+        {_32_ARGB8888, "pal8->argb"},
+        {UNKNOWN_PF, "pal8->pal8 remap"},
+    };
+    const int savedMode = VxGetSIMDOverride();
+
+    std::vector<XBYTE> src(size * size);
+    std::vector<XBYTE> dst(size * size * 4);
+    std::vector<XBYTE> palette(256 * 4);
+    std::vector<XBYTE> dstPalette(256 * 4);
+    FillPattern(src, 9);
+    FillPattern(palette, 10);
+    FillPattern(dstPalette, 11);
+
+    VxImageDescEx srcDesc = MakeDesc(_8_RGB332, size, size, src.data());
+    srcDesc.RedMask = srcDesc.GreenMask = srcDesc.BlueMask = srcDesc.AlphaMask = 0;
+    srcDesc.ColorMapEntries = 256;
+    srcDesc.BytesPerColorEntry = 4;
+    srcDesc.ColorMap = palette.data();
+    const double pixels = static_cast<double>(size) * size;
+
+    for (int mode : modes) {
+        if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) {
+            continue;
+        }
+        for (const auto &target : targets) {
+            VxImageDescEx dstDesc = srcDesc;
+            dstDesc.Image = dst.data();
+            dstDesc.ColorMap = dstPalette.data();
+            if (target.format != UNKNOWN_PF) {
+                dstDesc = MakeDesc(target.format, size, size, dst.data());
+            }
+            const double seconds = VxBench::TimeBest(ctx, [&]() { VxDoBlit(srcDesc, dstDesc); });
+
+            char variant[64];
+            std::snprintf(variant, sizeof(variant), "%s %dx%d %s", target.name, size, size,
+                          VxGetSIMDBackendName(mode));
+            ctx.Report(variant, seconds, pixels, pixels * (1 + dstDesc.BitsPerPixel / 8));
+        }
+    }
+    VxSetSIMDOverride(savedMode);
+}
+
+// Standard format pairs, alpha passes and fills on each tier.
+VX_BENCHMARK(PixelConversions) {
+    const int size = ctx.Quick() ? 256 : 1024;
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_SSSE3, VX_SIMD_MODE_AVX2,
+                         VX_SIMD_MODE_AVX512, VX_SIMD_MODE_NEON, VX_SIMD_MODE_WASM_SIMD128};
+    const struct {
+        VX_PIXELFORMAT src;
+        VX_PIXELFORMAT dst;
+        const char *name;
+    } pairs[] = {
+        {_32_ARGB8888, _32_RGB888, "argb->rgb32"},
+        {_32_RGB888, _32_ARGB8888, "rgb32->argb"},
+        {_32_ARGB8888, _24_RGB888, "argb->rgb24"},
+        {_24_RGB888, _32_ARGB8888, "rgb24->argb"},
+        {_32_ARGB8888, _32_ABGR8888, "argb->abgr"},
+        {_32_ARGB8888, _32_RGBA8888, "argb->rgba"},
+        {_32_ARGB8888, _16_RGB565, "argb->565"},
+        {_16_RGB565, _32_ARGB8888, "565->argb"},
+        {_32_ARGB8888, _16_ARGB4444, "argb->4444"},
+        {_16_ARGB4444, _32_ARGB8888, "4444->argb"},
+    };
+    const int savedMode = VxGetSIMDOverride();
+
+    std::vector<XBYTE> src(size * size * 4);
+    std::vector<XBYTE> dst(size * size * 4);
+    FillPattern(src, 12);
+    const double pixels = static_cast<double>(size) * size;
+
+    for (int mode : modes) {
+        if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) {
+            continue;
+        }
+        char variant[64];
+        for (const auto &pair : pairs) {
+            VxImageDescEx srcDesc = MakeDesc(pair.src, size, size, src.data());
+            VxImageDescEx dstDesc = MakeDesc(pair.dst, size, size, dst.data());
+            const double seconds = VxBench::TimeBest(ctx, [&]() { VxDoBlit(srcDesc, dstDesc); });
+            std::snprintf(variant, sizeof(variant), "%s %dx%d %s", pair.name, size, size,
+                          VxGetSIMDBackendName(mode));
+            ctx.Report(variant, seconds, pixels,
+                       pixels * (srcDesc.BitsPerPixel + dstDesc.BitsPerPixel) / 8.0);
+        }
+
+        VxImageDescEx image = MakeDesc(_32_ARGB8888, size, size, dst.data());
+        const struct {
+            const char *name;
+            void (*run)(const VxImageDescEx &);
+        } passes[] = {
+            {"premultiply", [](const VxImageDescEx &desc) { TheBlitter.PremultiplyAlpha(desc); }},
+            {"unpremultiply", [](const VxImageDescEx &desc) { TheBlitter.UnpremultiplyAlpha(desc); }},
+            {"premul roundtrip",
+             [](const VxImageDescEx &desc) {
+                 TheBlitter.PremultiplyAlpha(desc);
+                 TheBlitter.UnpremultiplyAlpha(desc);
+             }},
+            {"fill32", [](const VxImageDescEx &desc) { TheBlitter.FillImage(desc, 0x80402010); }},
+        };
+        for (const auto &pass : passes) {
+            memcpy(dst.data(), src.data(), dst.size());
+            const double seconds = VxBench::TimeBest(ctx, [&]() { pass.run(image); });
+            std::snprintf(variant, sizeof(variant), "%s %dx%d %s", pass.name, size, size,
+                          VxGetSIMDBackendName(mode));
+            ctx.Report(variant, seconds, pixels, pixels * 8.0);
+        }
+    }
+    VxSetSIMDOverride(savedMode);
+}
+
+// YUV decode to ARGB (same size and half size) and ARGB encode, per tier.
+VX_BENCHMARK(YUV) {
+    const int size = ctx.Quick() ? 256 : 1024;
+    const int half = size / 2;
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_AVX512,
+                         VX_SIMD_MODE_NEON, VX_SIMD_MODE_WASM_SIMD128};
+    const char *const formatNames[] = {"i420", "nv12", "yuy2"};
+    const int savedMode = VxGetSIMDOverride();
+
+    std::vector<XBYTE> planes(size * size * 2);
+    std::vector<XBYTE> argb(size * size * 4);
+    FillPattern(planes, 13);
+    FillPattern(argb, 14);
+    VxImageDescEx argbDesc = MakeDesc(_32_ARGB8888, size, size, argb.data());
+    std::vector<XBYTE> scaled(half * half * 4);
+    VxImageDescEx scaledDesc = MakeDesc(_32_ARGB8888, half, half, scaled.data());
+    const double pixels = static_cast<double>(size) * size;
+
+    VxYUVImageDesc yuv;
+    yuv.Width = size;
+    yuv.Height = size;
+
+    for (int mode : modes) {
+        if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) {
+            continue;
+        }
+        char variant[64];
+        for (int format = VX_YUV_I420; format <= VX_YUV_YUY2; ++format) {
+            yuv.Format = format;
+            if (format == VX_YUV_YUY2) {
+                yuv.Planes[0] = planes.data();
+                yuv.Pitches[0] = size * 2;
+            } else {
+                yuv.Planes[0] = planes.data();
+                yuv.Pitches[0] = size;
+                yuv.Planes[1] = planes.data() + size * size;
+                yuv.Pitches[1] = format == VX_YUV_I420 ? half : size;
+                yuv.Planes[2] = planes.data() + size * size + half * half;
+                yuv.Pitches[2] = half;
+            }
+            const double yuvBytes = format == VX_YUV_YUY2 ? pixels * 2.0 : pixels * 1.5;
+
+            double seconds = VxBench::TimeBest(ctx, [&]() { VxConvertFromYUV(yuv, argbDesc); });
+            std::snprintf(variant, sizeof(variant), "%s->argb %dx%d %s", formatNames[format], size, size,
+                          VxGetSIMDBackendName(mode));
+            ctx.Report(variant, seconds, pixels, yuvBytes + pixels * 4.0);
+
+            seconds = VxBench::TimeBest(ctx, [&]() { VxConvertFromYUV(yuv, scaledDesc); });
+            std::snprintf(variant, sizeof(variant), "%s->argb half %dx%d %s", formatNames[format], size, size,
+                          VxGetSIMDBackendName(mode));
+            ctx.Report(variant, seconds, pixels, yuvBytes + pixels);
+
+            if (format == VX_YUV_YUY2) continue;
+            seconds = VxBench::TimeBest(ctx, [&]() { VxConvertToYUV(argbDesc, yuv); });
+            std::snprintf(variant, sizeof(variant), "argb->%s %dx%d %s", formatNames[format], size, size,
+                          VxGetSIMDBackendName(mode));
+            ctx.Report(variant, seconds, pixels, pixels * 4.0 + yuvBytes);
+        }
+    }
+    VxSetSIMDOverride(savedMode);
+}
+
+// Normal and bump maps per operator and tier, then the default normal map
+// split across threads.
+VX_BENCHMARK(GradientMaps) {
+    const int size = ctx.Quick() ? 256 : 1024;
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_AVX512,
+                         VX_SIMD_MODE_NEON, VX_SIMD_MODE_WASM_SIMD128};
+    const char *const filterNames[] = {"default", "central", "sobel", "scharr"};
+    const int savedMode = VxGetSIMDOverride();
+    int savedThreads = 1;
+    int savedMinRows = 64;
+    VxGetBlitParallelism(savedThreads, savedMinRows);
+    VxSetBlitParallelism(1, savedMinRows);
+
+    std::vector<XBYTE> src(size * size * 4);
+    std::vector<XBYTE> dst(size * size * 4);
+    FillPattern(src, 15);
+    VxImageDescEx srcDesc = MakeDesc(_32_ARGB8888, size, size, src.data());
+    VxImageDescEx dstDesc = MakeDesc(_32_ARGB8888, size, size, dst.data());
+    const double pixels = static_cast<double>(size) * size;
+
+    char variant[64];
+    for (int mode : modes) {
+        if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) {
+            continue;
+        }
+        for (int filter = VX_GRADIENTFILTER_DEFAULT; filter <= VX_GRADIENTFILTER_SCHARR; ++filter) {
+            const VX_GRADIENTFILTER f = static_cast<VX_GRADIENTFILTER>(filter);
+            double seconds = VxBench::TimeBest(ctx, [&]() { VxConvertToNormalMap(srcDesc, dstDesc, 0xFFFFFFFF, f); });
+            std::snprintf(variant, sizeof(variant), "normal %s %dx%d %s", filterNames[filter], size, size,
+                          VxGetSIMDBackendName(mode));
+            ctx.Report(variant, seconds, pixels, pixels * 8.0);
+
+            seconds = VxBench::TimeBest(ctx, [&]() { VxConvertToBumpMap(srcDesc, dstDesc, f); });
+            std::snprintf(variant, sizeof(variant), "bump %s %dx%d %s", filterNames[filter], size, size,
+                          VxGetSIMDBackendName(mode));
+            ctx.Report(variant, seconds, pixels, pixels * 8.0);
+        }
+    }
+    VxSetSIMDOverride(savedMode);
+
+    for (int threads = 2; threads <= 8; threads *= 2) {
+        VxSetBlitParallelism(threads, 64);
+        const double seconds = VxBench::TimeBest(ctx, [&]() { VxConvertToNormalMap(srcDesc, dstDesc, 0xFFFFFFFF); });
+        std::snprintf(variant, sizeof(variant), "normal default %dx%d threads=%d", size, size, threads);
+        ctx.Report(variant, seconds, pixels, pixels * 8.0);
+    }
+    VxSetBlitParallelism(savedThreads, savedMinRows);
+}
@@ -0,0 +1,165 @@
+/**
+ * @file ContainerBench.cpp
+ * @brief XArray, XHashTable and XString benchmarks.
+ *
+ * The containers have no SIMD paths, so these run once on the current tier.
+ */
+
+#include "VxMathBench.h"
+
+#include <cstdio>
+
+#include "XArray.h"
+#include "XHashTable.h"
+#include "XString.h"
+
+namespace {
+
+// Keeps the optimizer from discarding results.
+volatile int g_Sink = 0;
+
+void ReportCount(VxBench::Context &ctx, const char *name, int count, double seconds, double bytes = 0.0) {
+    char variant[64];
+    std::snprintf(variant, sizeof(variant), "%s x%d", name, count);
+    ctx.Report(variant, seconds, count, bytes);
+}
+
+} // namespace
+
+// Growth, front insertion, linear search and sort of an int array.
+VX_BENCHMARK(XArrayOps) {
+    const int count = ctx.Quick() ? 16384 : 262144;
+    const int insertCount = ctx.Quick() ? 1024 : 4096;
+    const int findCount = 256;
+
+    double seconds = VxBench::TimeBest(ctx, [&]() {
+        XArray<int> array;
+        for (int i = 0; i < count; ++i) {
+            array.PushBack(i);
+        }
+        g_Sink += array.Size();
+    });
+    ReportCount(ctx, "push back", count, seconds, count * 4.0);
+
+    seconds = VxBench::TimeBest(ctx, [&]() {
+        XArray<int> array;
+        for (int i = 0; i < insertCount; ++i) {
+            array.Insert(0, i);
+        }
+        g_Sink += array.Size();
+    });
+    ReportCount(ctx, "insert front", insertCount, seconds);
+
+    XArray<int> values;
+    values.Reserve(count);
+    for (int i = 0; i < count; ++i) {
+        values.PushBack((i * 7919) % count);
+    }
+
+    seconds = VxBench::TimeBest(ctx, [&]() {
+        int found = 0;
+        for (int i = 0; i < findCount; ++i) {
+            found += values.Find((i * 104729) % count) != values.End();
+        }
+        g_Sink += found;
+    });
+    ReportCount(ctx, "find", findCount, seconds, findCount * count * 2.0);
+
+    seconds = VxBench::TimeBest(ctx, [&]() {
+        XArray<int> sorted(values);
+        sorted.Sort();
+        g_Sink += sorted[0];
+    });
+    ReportCount(ctx, "sort", count, seconds, count * 4.0);
+}
+
+// Insertion with rehashing, hits, misses and removal in an int-keyed table.
+VX_BENCHMARK(XHashTableOps) {
+    const int count = ctx.Quick() ? 16384 : 262144;
+    typedef XHashTable<int, int> IntTable;
+
+    double seconds = VxBench::TimeBest(ctx, [&]() {
+        IntTable table;
+        for (int i = 0; i < count; ++i) {
+            table.Insert(i * 31, i, TRUE);
+        }
+        g_Sink += table.Size();
+    });
+    ReportCount(ctx, "insert", count, seconds);
+
+    seconds = VxBench::TimeBest(ctx, [&]() {
+        IntTable table;
+        table.Reserve(count);
+        for (int i = 0; i < count; ++i) {
+            table.Insert(i * 31, i, TRUE);
+        }
+        g_Sink += table.Size();
+    });
+    ReportCount(ctx, "insert reserved", count, seconds);
+
+    IntTable table;
+    for (int i = 0; i < count; ++i) {
+        table.Insert(i * 31, i, TRUE);
+    }
+
+    seconds = VxBench::TimeBest(ctx, [&]() {
+        int found = 0;
+        for (int i = 0; i < count; ++i) {
+            found += table.FindPtr(i * 31) != NULL;
+        }
+        g_Sink += found;
+    });
+    ReportCount(ctx, "find hit", count, seconds);
+
+    seconds = VxBench::TimeBest(ctx, [&]() {
+        int found = 0;
+        for (int i = 0; i < count; ++i) {
+            found += table.FindPtr(i * 31 + 1) != NULL;
+        }
+        g_Sink += found;
+    });
+    ReportCount(ctx, "find miss", count, seconds);
+
+    seconds = VxBench::TimeBest(ctx, [&]() {
+        IntTable copy(table);
+        for (int i = 0; i < count; ++i) {
+            copy.Remove(i * 31);
+        }
+        g_Sink += copy.Size();
+    });
+    ReportCount(ctx, "copy + remove", count, seconds);
+}
+
+// Building short formatted strings and searching a long one. XString lengths
+// are 16-bit, so the haystack stays below 64 KB.
+VX_BENCHMARK(XStringOps) {
+    const int count = ctx.Quick() ? 16384 : 131072;
+
+    double seconds = VxBench::TimeBest(ctx, [&]() {
+        int length = 0;
+        for (int i = 0; i < count; ++i) {
+            XString text("item");
+            text << i << ' ' << 0.5f * i;
+            length += text.Length();
+        }
+        g_Sink += length;
+    });
+    ReportCount(ctx, "format", count, seconds);
+
+    const int words = 4096;
+    XString haystack;
+    for (int i = 0; i < words; ++i) {
+        haystack << "item" << i << ' ';
+    }
+    const int findCount = 256;
+    seconds = VxBench::TimeBest(ctx, [&]() {
+        int found = 0;
+        for (int i = 0; i < findCount; ++i) {
+            XString needle("item");
+            needle << (words - 1 - i * 13) << ' ';
+            found += haystack.Find(needle) != XString::NOTFOUND;
+        }
+        g_Sink += found;
+    });
+    ReportCount(ctx, "find", findCount, seconds, findCount * static_cast<double>(haystack.Length()));
+}
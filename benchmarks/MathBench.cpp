@@ -0,0 +1,286 @@
+/**
+ * @file MathBench.cpp
+ * @brief Interpolation, strided copy, transform, distance and intersection benchmarks.
+ */
+
+#include "VxMathBench.h"
+
+#include <cstdio>
+#include <vector>
+
+#include "VxMath.h"
+#include "VxDistance.h"
+#include "VxIntersect.h"
+#include "VxFrustum.h"
+#include "VxOBB.h"
+#include "VxRay.h"
+#include "VxSphere.h"
+
+namespace {
+
+// Every requested tier; the ones this CPU cannot run are skipped.
+const int kSIMDModes[] = {VX_SIMD_MODE_NONE,   VX_SIMD_MODE_SSE2, VX_SIMD_MODE_SSSE3,
+                          VX_SIMD_MODE_SSE4_1, VX_SIMD_MODE_AVX,  VX_SIMD_MODE_AVX2,
+                          VX_SIMD_MODE_AVX512, VX_SIMD_MODE_NEON, VX_SIMD_MODE_WASM_SIMD128};
+
+// Calls body(mode) once per available tier with that tier forced globally.
+template <typename Body>
+void ForEachSIMDMode(Body body) {
+    const int savedMode = VxGetSIMDOverride();
+    for (int mode : kSIMDModes) {
+        if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) {
+            continue;
+        }
+        body(mode);
+    }
+    VxSetSIMDOverride(savedMode);
+}
+
+void ReportTier(VxBench::Context &ctx, const char *name, int count, int mode, double seconds, double items,
+                double bytes = 0.0) {
+    char variant[64];
+    std::snprintf(variant, sizeof(variant), "%s x%d %s", name, count, VxGetSIMDBackendName(mode));
+    ctx.Report(variant, seconds, items, bytes);
+}
+
+// Deterministic points in [-1, 1]^3.
+std::vector<VxVector> MakePoints(int count, int seed) {
+    std::vector<VxVector> points(count);
+    unsigned int state = 0x9E3779B9u * (seed + 1);
+    for (int i = 0; i < count; ++i) {
+        float c[3];
+        for (int k = 0; k < 3; ++k) {
+            state = state * 1664525u + 1013904223u;
+            c[k] = static_cast<float>(state >> 8) / 8388608.0f - 1.0f;
+        }
+        points[i] = VxVector(c[0], c[1], c[2]);
+    }
+    return points;
+}
+
+std::vector<VxBbox> MakeBoxes(const std::vector<VxVector> &centers, float halfSize) {
+    std::vector<VxBbox> boxes(centers.size());
+    const VxVector extent(halfSize, halfSize, halfSize);
+    for (size_t i = 0; i < centers.size(); ++i) {
+        boxes[i] = VxBbox(centers[i] - extent, centers[i] + extent);
+    }
+    return boxes;
+}
+
+// Keeps the optimizer from discarding results.
+volatile int g_Sink = 0;
+
+} // namespace
+
+// Keyframe blending: many short arrays (per-bone channels) and one long array
+// (morph targets) on each tier.
+VX_BENCHMARK(Interpolation) {
+    const int count = ctx.Quick() ? 4096 : 65536;
+    std::vector<float> a(count), b(count), res(count);
+    for (int i = 0; i < count; ++i) {
+        a[i] = static_cast<float>(i % 97);
+        b[i] = static_cast<float>(i % 89);
+    }
+    std::vector<VxVector> va = MakePoints(count, 1);
+    std::vector<VxVector> vb = MakePoints(count, 2);
+    std::vector<VxVector> vres(count);
+
+    ForEachSIMDMode([&](int mode) {
+        double seconds = VxBench::TimeBest(ctx, [&]() {
+            InterpolateFloatArray(res.data(), a.data(), b.data(), 0.25f, count);
+        });
+        ReportTier(ctx, "float", count, mode, seconds, count, count * 12.0);
+
+        seconds = VxBench::TimeBest(ctx, [&]() {
+            for (int offset = 0; offset + 16 <= count; offset += 16) {
+                InterpolateFloatArray(&res[offset], &a[offset], &b[offset], 0.25f, 16);
+            }
+        });
+        ReportTier(ctx, "float spans of 16", count, mode, seconds, count, count * 12.0);
+
+        seconds = VxBench::TimeBest(ctx, [&]() {
+            InterpolateVectorArray(vres.data(), va.data(), vb.data(), 0.5f, count, sizeof(VxVector), sizeof(VxVector));
+        });
+        ReportTier(ctx, "vector", count, mode, seconds, count, count * 36.0);
+    });
+}
+
+// Vertex-buffer style copies between interleaved layouts on each tier.
+VX_BENCHMARK(StridedCopy) {
+    const int count = ctx.Quick() ? 4096 : 65536;
+    std::vector<VxVector> src = MakePoints(count, 3);
+    std::vector<XBYTE> dst(count * 32);
+    std::vector<int> indices(count);
+    for (int i = 0; i < count; ++i) {
+        indices[i] = (i * 7919) % count;
+    }
+
+    ForEachSIMDMode([&](int mode) {
+        double seconds = VxBench::TimeBest(ctx, [&]() {
+            VxFillStructure(count, dst.data(), 32, sizeof(VxVector), src.data());
+        });
+        ReportTier(ctx, "fill 12->32", count, mode, seconds, count, count * 12.0);
+
+        seconds = VxBench::TimeBest(ctx, [&]() {
+            VxCopyStructure(count, dst.data(), 32, sizeof(VxVector), src.data(), sizeof(VxVector));
+        });
+        ReportTier(ctx, "copy 12->32", count, mode, seconds, count, count * 24.0);
+
+        seconds = VxBench::TimeBest(ctx, [&]() {
+            VxCopyStructure(count, dst.data(), 16, sizeof(VxVector), src.data(), sizeof(VxVector));
+        });
+        ReportTier(ctx, "copy 12->16", count, mode, seconds, count, count * 24.0);
+
+        seconds = VxBench::TimeBest(ctx, [&]() {
+            VxStridedData dstData(dst.data(), 16);
+            VxStridedData srcData(src.data(), sizeof(VxVector));
+            VxIndexedCopy(dstData, srcData, sizeof(VxVector), indices.data(), count);
+        });
+        ReportTier(ctx, "indexed 12->16", count, mode, seconds, count, count * 28.0);
+    });
+}
+
+// Point transforms, screen-space box projection and best-fit boxes on each tier.
+VX_BENCHMARK(Transform) {
+    const int count = ctx.Quick() ? 4096 : 65536;
+    const int boxCount = count / 16;
+    std::vector<VxVector> points = MakePoints(count, 4);
+    std::vector<VxVector> out(count);
+    std::vector<VxBbox> boxes = MakeBoxes(MakePoints(boxCount, 5), 0.25f);
+
+    VxMatrix world;
+    Vx3DMatrixFromRotation(world, VxVector(0.0f, 1.0f, 0.0f), 0.7f);
+    world[3][2] = 4.0f;
+    VxMatrix projection;
+    Vx3DMatrixIdentity(projection);
+    projection[2][3] = 1.0f;
+    projection[3][3] = 0.0f;
+    VxMatrix worldProjection;
+    Vx3DMultiplyMatrix4(worldProjection, projection, world);
+
+    ForEachSIMDMode([&](int mode) {
+        double seconds = VxBench::TimeBest(ctx, [&]() {
+            Vx3DMultiplyMatrixVectorMany(out.data(), world, points.data(), count, sizeof(VxVector));
+        });
+        ReportTier(ctx, "points", count, mode, seconds, count, count * 24.0);
+
+        seconds = VxBench::TimeBest(ctx, [&]() {
+            VxRect screen(0.0f, 0.0f, 1920.0f, 1080.0f);
+            int visible = 0;
+            for (const VxBbox &box : boxes) {
+                VxRect extents;
+                VXCLIP_FLAGS orFlags, andFlags;
+                visible += VxTransformBox2D(worldProjection, box, &screen, &extents, orFlags, andFlags);
+            }
+            g_Sink += visible;
+        });
+        ReportTier(ctx, "box2d", boxCount, mode, seconds, boxCount);
+
+        seconds = VxBench::TimeBest(ctx, [&]() {
+            float zMin, zMax;
+            for (const VxBbox &box : boxes) {
+                VxProjectBoxZExtents(worldProjection, box, zMin, zMax);
+            }
+        });
+        ReportTier(ctx, "box z extents", boxCount, mode, seconds, boxCount);
+
+        seconds = VxBench::TimeBest(ctx, [&]() {
+            VxMatrix fit;
+            VxComputeBestFitBBox(reinterpret_cast<const XBYTE *>(points.data()), sizeof(VxVector), count, fit, 0.0f);
+        });
+        ReportTier(ctx, "best-fit bbox", count, mode, seconds, count, count * 12.0);
+    });
+}
+
+// Closest-point queries between segments and points on each tier.
+VX_BENCHMARK(Distance) {
+    const int count = ctx.Quick() ? 4096 : 65536;
+    std::vector<VxVector> starts = MakePoints(count, 6);
+    std::vector<VxVector> ends = MakePoints(count, 7);
+    std::vector<VxRay> segments(count);
+    for (int i = 0; i < count; ++i) {
+        segments[i] = VxRay(starts[i], ends[i]);
+    }
+
+    ForEachSIMDMode([&](int mode) {
+        double seconds = VxBench::TimeBest(ctx, [&]() {
+            float sum = 0.0f;
+            for (int i = 0; i + 1 < count; ++i) {
+                sum += VxDistance::SegmentSegmentSquareDistance(segments[i], segments[i + 1]);
+            }
+            g_Sink += static_cast<int>(sum);
+        });
+        ReportTier(ctx, "segment-segment", count, mode, seconds, count);
+
+        seconds = VxBench::TimeBest(ctx, [&]() {
+            float sum = 0.0f;
+            for (int i = 0; i < count; ++i) {
+                sum += VxDistance::PointSegmentSquareDistance(ends[(i + 1) % count], segments[i]);
+            }
+            g_Sink += static_cast<int>(sum);
+        });
+        ReportTier(ctx, "point-segment", count, mode, seconds, count);
+    });
+}
+
+// Broad- and narrow-phase tests against a cloud of boxes, spheres and faces
+// on each tier.
+VX_BENCHMARK(Intersection) {
+    const int count = ctx.Quick() ? 4096 : 32768;
+    std::vector<VxVector> centers = MakePoints(count, 8);
+    std::vector<VxVector> others = MakePoints(count, 9);
+    std::vector<VxBbox> boxes = MakeBoxes(centers, 0.1f);
+    std::vector<VxBbox> otherBoxes = MakeBoxes(others, 0.1f);
+
+    VxMatrix rotation;
+    Vx3DMatrixFromRotation(rotation, VxVector(1.0f, 1.0f, 0.0f), 0.6f);
+    std::vector<VxOBB> obbs(count);
+    for (int i = 0; i < count; ++i) {
+        obbs[i] = VxOBB(boxes[i], rotation);
+    }
+    std::vector<VxRay> rays(count);
+    for (int i = 0; i < count; ++i) {
+        rays[i] = VxRay(others[i] * 3.0f, centers[i]);
+    }
+    const VxFrustum frustum(VxVector(0.0f, 0.0f, -3.0f), VxVector(1.0f, 0.0f, 0.0f), VxVector(0.0f, 1.0f, 0.0f),
+                            VxVector(0.0f, 0.0f, 1.0f), 0.1f, 100.0f, 0.8f, 1.0f);
+    VxMatrix identity;
+    Vx3DMatrixIdentity(identity);
+    const VxPlane plane(VxVector(0.3f, 0.9f, 0.1f), 0.05f);
+
+    // Runs test(i) over every element and reports the time per tier.
+    auto run = [&](int mode, const char *name, auto test) {
+        const double seconds = VxBench::TimeBest(ctx, [&]() {
+            int hits = 0;
+            for (int i = 0; i < count; ++i) {
+                hits += test(i) ? 1 : 0;
+            }
+            g_Sink += hits;
+        });
+        ReportTier(ctx, name, count, mode, seconds, count);
+    };
+
+    ForEachSIMDMode([&](int mode) {
+        run(mode, "ray-box", [&](int i) { return VxIntersect::RayBox(rays[i], otherBoxes[i]); });
+        run(mode, "segment-box", [&](int i) { return VxIntersect::SegmentBox(rays[i], otherBoxes[i]); });
+        run(mode, "aabb-aabb", [&](int i) { return VxIntersect::AABBAABB(boxes[i], otherBoxes[i]); });
+        run(mode, "aabb-obb", [&](int i) { return VxIntersect::AABBOBB(otherBoxes[i], obbs[i]); });
+        run(mode, "obb-obb", [&](int i) { return VxIntersect::OBBOBB(obbs[i], obbs[(i + 1) % count]); });
+        run(mode, "box-plane", [&](int i) { return VxIntersect::BoxPlane(boxes[i], plane); });
+        run(mode, "frustum-box", [&](int i) { return VxIntersect::FrustumBox(frustum, boxes[i], identity); });
+        run(mode, "sphere-sphere", [&](int i) {
+            return VxIntersect::SphereSphere(VxSphere(centers[i], 0.1f), others[i], VxSphere(others[i], 0.1f),
+                                             centers[i], NULL, NULL);
+        });
+        run(mode, "ray-sphere", [&](int i) {
+            return VxIntersect::RaySphere(rays[i], VxSphere(others[i], 0.2f), NULL, NULL) != 0;
+        });
+        run(mode, "face-face", [&](int i) {
+            const int j = (i + 1) % count;
+            const int k = (i + 2) % count;
+            const VxVector n0 = Normalize(CrossProduct(centers[j] - centers[i], centers[k] - centers[i]));
+            const VxVector n1 = Normalize(CrossProduct(others[j] - others[i], others[k] - others[i]));
+            return VxIntersect::FaceFace(centers[i], centers[j], centers[k], n0, others[i], others[j], others[k], n1);
+        });
+    });
+}
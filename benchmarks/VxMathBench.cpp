@@ -0,0 +1,149 @@
+/**
+ * @file VxMathBench.cpp
+ * @brief Driver for the VxMathBench executable.
+ *
+ * Usage: VxMathBench [--filter=<substring>] [--repetitions=<n>] [--quick] [--list] [--json=<file>]
+ *
+ * --json writes every result to @c file ("-" for stdout) so runs can be
+ * compared by (benchmark, variant) key.
+ */
+
+#include "VxMathBench.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "VxMath.h"
+
+namespace VxBench {
+
+namespace {
+
+struct Entry {
+    const char *name;
+    BenchmarkFunc func;
+};
+
+std::vector<Entry> &Registry() {
+    static std::vector<Entry> entries;
+    return entries;
+}
+
+} // namespace
+
+Registrar::Registrar(const char *name, BenchmarkFunc func) {
+    Entry entry = {name, func};
+    Registry().push_back(entry);
+}
+
+} // namespace VxBench
+
+static void PrintResult(std::FILE *file, const VxBench::Result &result) {
+    const double itemsPerSec = (result.seconds > 0.0) ? result.items / result.seconds : 0.0;
+    const double mbPerSec = (result.seconds > 0.0) ? result.bytes / result.seconds / (1024.0 * 1024.0) : 0.0;
+    std::fprintf(file, "%-32s %-36s %12.3f ms %14.2f M/s", result.benchmark.c_str(), result.variant.c_str(),
+                 result.seconds * 1000.0, itemsPerSec / 1e6);
+    if (result.bytes > 0.0) {
+        std::fprintf(file, " %10.1f MB/s", mbPerSec);
+    }
+    std::fprintf(file, "\n");
+}
+
+static void WriteJSONString(std::FILE *file, const std::string &text) {
+    std::fputc('"', file);
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            std::fputc('\\', file);
+        }
+        std::fputc(c, file);
+    }
+    std::fputc('"', file);
+}
+
+static bool WriteJSON(const char *path, const std::vector<VxBench::Result> &results, int repetitions, bool quick) {
+    std::FILE *file = std::strcmp(path, "-") == 0 ? stdout : std::fopen(path, "w");
+    if (!file) {
+        std::fprintf(stderr, "Cannot write %s\n", path);
+        return false;
+    }
+
+    std::fprintf(file, "{\n  \"context\": {\"simd_backend\": ");
+    WriteJSONString(file, VxGetSIMDBackendName(VxGetSIMDEffectiveBackend()));
+    std::fprintf(file, ", \"repetitions\": %d, \"quick\": %s},\n  \"results\": [", repetitions,
+                 quick ? "true" : "false");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const VxBench::Result &result = results[i];
+        const double itemsPerSec = (result.seconds > 0.0) ? result.items / result.seconds : 0.0;
+        const double bytesPerSec = (result.seconds > 0.0) ? result.bytes / result.seconds : 0.0;
+        std::fprintf(file, "%s\n    {\"benchmark\": ", i ? "," : "");
+        WriteJSONString(file, result.benchmark);
+        std::fprintf(file, ", \"variant\": ");
+        WriteJSONString(file, result.variant);
+        std::fprintf(file, ", \"seconds\": %.9g, \"items\": %.9g, \"bytes\": %.9g, "
+                           "\"items_per_second\": %.9g, \"bytes_per_second\": %.9g}",
+                     result.seconds, result.items, result.bytes, itemsPerSec, bytesPerSec);
+    }
+    std::fprintf(file, "\n  ]\n}\n");
+
+    if (file != stdout) {
+        std::fclose(file);
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    const char *filter = nullptr;
+    int repetitions = 5;
+    bool quick = false;
+    bool listOnly = false;
+    const char *jsonPath = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if (std::strncmp(arg, "--filter=", 9) == 0) {
+            filter = arg + 9;
+        } else if (std::strncmp(arg, "--repetitions=", 14) == 0) {
+            repetitions = std::atoi(arg + 14);
+            if (repetitions < 1) {
+                repetitions = 1;
+            }
+        } else if (std::strcmp(arg, "--quick") == 0) {
+            quick = true;
+        } else if (std::strcmp(arg, "--list") == 0) {
+            listOnly = true;
+        } else if (std::strncmp(arg, "--json=", 7) == 0) {
+            jsonPath = arg + 7;
+        } else {
+            std::fprintf(stderr, "Usage: %s [--filter=<substring>] [--repetitions=<n>] [--quick] [--list] [--json=<file>]\n",
+                         argv[0]);
+            return 2;
+        }
+    }
+
+    // With JSON on stdout the table goes to stderr so the output stays parseable.
+    std::FILE *table = (jsonPath && std::strcmp(jsonPath, "-") == 0) ? stderr : stdout;
+    std::vector<VxBench::Result> allResults;
+
+    for (const VxBench::Entry &entry : VxBench::Registry()) {
+        if (filter && !std::strstr(entry.name, filter)) {
+            continue;
+        }
+        if (listOnly) {
+            std::printf("%s\n", entry.name);
+            continue;
+        }
+
+        VxBench::Context ctx(entry.name, repetitions, quick);
+        entry.func(ctx);
+        for (const VxBench::Result &result : ctx.Results()) {
+            PrintResult(table, result);
+            allResults.push_back(result);
+        }
+    }
+
+    if (jsonPath && !listOnly && !WriteJSON(jsonPath, allResults, repetitions, quick)) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+#ifndef VXMATHBENCH_H
+#define VXMATHBENCH_H
+
+/**
+ * @file VxMathBench.h
+ * @brief Minimal benchmark harness shared by the VxMathBench scenarios.
+ *
+ * Each scenario registers itself with VX_BENCHMARK(name) and reports one or
+ * more measurements through VxBench::Context::Report(). The driver in
+ * VxMathBench.cpp runs the selected scenarios and prints the results.
+ */
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace VxBench {
+
+/**
+ * @brief One reported measurement.
+ */
+struct Result {
+    std::string benchmark; ///< Scenario name
+    std::string variant;   ///< Configuration inside the scenario (size, thread count...)
+    double seconds;        ///< Best wall-clock time of one repetition
+    double items;          ///< Work items processed per repetition (pixels, calls...)
+    double bytes;          ///< Bytes touched per repetition (0 if not meaningful)
+};
+
+/**
+ * @brief Per-scenario state handed to benchmark functions.
+ */
+class Context {
+public:
+    Context(const std::string &benchmark, int repetitions, bool quick)
+        : m_Benchmark(benchmark), m_Repetitions(repetitions), m_Quick(quick) {}
+
+    /// Number of timed repetitions; benchmarks report the best one.
+    int Repetitions() const { return m_Repetitions; }
+
+    /// True when the run should use reduced problem sizes (smoke runs).
+    bool Quick() const { return m_Quick; }
+
+    void Report(const std::string &variant, double seconds, double items, double bytes = 0.0) {
+        Result result;
+        result.benchmark = m_Benchmark;
+        result.variant = variant;
+        result.seconds = seconds;
+        result.items = items;
+        result.bytes = bytes;
+        m_Results.push_back(result);
+    }
+
+    const std::vector<Result> &Results() const { return m_Results; }
+
+private:
+    std::string m_Benchmark;
+    int m_Repetitions;
+    bool m_Quick;
+    std::vector<Result> m_Results;
+};
+
+typedef void (*BenchmarkFunc)(Context &ctx);
+
+/**
+ * @brief Registers a benchmark function at static-initialization time.
+ */
+struct Registrar {
+    Registrar(const char *name, BenchmarkFunc func);
+};
+
+/**
+ * @brief Returns the current time in seconds from a monotonic clock.
+ */
+inline double NowSeconds() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Runs @p body Repetitions() times and returns the fastest wall time.
+ */
+template <typename Body>
+double TimeBest(const Context &ctx, Body body) {
+    double best = 0.0;
+    for (int rep = 0; rep < ctx.Repetitions(); ++rep) {
+        const double start = NowSeconds();
+        body();
+        const double elapsed = NowSeconds() - start;
+        if (rep == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+} // namespace VxBench
+
+#define VX_BENCHMARK_CONCAT_INNER(a, b) a##b
+#define VX_BENCHMARK_CONCAT(a, b) VX_BENCHMARK_CONCAT_INNER(a, b)
+
+/// Declares and registers a benchmark function named @p name.
+#define VX_BENCHMARK(name)                                                                        \
+    static void name(VxBench::Context &ctx);                                                      \
+    static VxBench::Registrar VX_BENCHMARK_CONCAT(s_Registrar_, name)(#name, name);               \
+    static void name(VxBench::Context &ctx)
+
+#endif // VXMATHBENCH_H
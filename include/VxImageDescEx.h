@@ -106,4 +106,33 @@ typedef struct VxImageDescEx {
     }
 } VxImageDescEx;
 
+/**
+ * @struct VxYUVImageDesc
+ * @brief Describes an 8-bit YUV image stored in one to three planes.
+ *
+ * @remarks
+ * Planes and Pitches are used according to Format:
+ * - VX_YUV_I420: [0] Y, [1] U, [2] V.
+ * - VX_YUV_NV12: [0] Y, [1] interleaved U/V pairs.
+ * - VX_YUV_YUY2: [0] packed Y0 U Y1 V groups.
+ * Chroma planes hold (Width + 1) / 2 samples per row.
+ */
+typedef struct VxYUVImageDesc {
+    int Format; ///< A VX_YUVFORMAT value.
+    int Matrix; ///< A VX_YUVMATRIX value.
+
+    int Width;  ///< Width of the image in pixels.
+    int Height; ///< Height of the image in pixels.
+
+    XBYTE *Planes[3]; ///< Pointers to the plane data; unused planes are NULL.
+    int Pitches[3];   ///< Bytes per row of each plane.
+
+    /**
+     * @brief Default constructor. Initializes the structure to zero (I420, BT.601).
+     */
+    VxYUVImageDesc() {
+        memset(this, 0, sizeof(VxYUVImageDesc));
+    }
+} VxYUVImageDesc;
+
 #endif // VXIMAGEDESCEX_H
@@ -38,6 +38,8 @@
 #include "VxColor.h"
 #include "VxMemoryPool.h"
 #include "VxTimeProfiler.h"
+#include "VxScopeProfiler.h"
+#include "VxPerfCounters.h"
 #include "VxImageDescEx.h"
 #include "VxSIMDMode.h"
 #include "VxAtomic.h"
@@ -139,7 +141,8 @@ VX_EXPORT XBOOL VxIndexedCopy(const VxStridedData &Dst, const VxStridedData &Src
  * @return TRUE on success, FALSE if mode is invalid.
  *
  * The effective backend is resolved with staircase fallback:
- * AVX2 -> AVX -> SSE4_1 -> SSSE3 -> SSE2 -> NONE.
+ * AVX512 -> AVX2 -> AVX -> SSE4_1 -> SSSE3 -> SSE2 -> NONE on x86, and
+ * NEON -> NONE or WASM_SIMD128 -> NONE on AArch64 and WebAssembly builds.
  */
 VX_EXPORT XBOOL VxSetSIMDOverride(int mode);
 
@@ -158,10 +161,71 @@ VX_EXPORT int VxGetSIMDEffectiveBackend();
 /**
  * @brief Gets the string representation of a SIMD mode.
  * @param mode One of VX_SIMD_MODE_* constants.
- * @return "auto", "none", "sse2", "ssse3", "sse4_1", "avx", "avx2", or "unknown".
+ * @return "auto", "none", "sse2", "ssse3", "sse4_1", "avx", "avx2", "avx512",
+ *         "neon", "wasm_simd128", or "unknown".
  */
 VX_EXPORT const char *VxGetSIMDBackendName(int mode);
 
+/**
+ * @brief One entry of the per-function SIMD dispatch registry.
+ *
+ * Entries are named "<module>.<function>", e.g. "math.interpolateFloatArray"
+ * or "blit.resample". A blit entry covers a family of row kernels that are
+ * rebound together.
+ */
+struct VxSIMDDispatchEntryInfo {
+    const char *Name;            ///< Entry name, valid for the lifetime of the library.
+    int BoundMode;               ///< VX_SIMD_MODE_* of the implementation currently bound.
+    int OverrideMode;            ///< Per-entry override, VX_SIMD_MODE_AUTO when it follows the global mode.
+    unsigned int CandidateModes; ///< Bit (1 << mode) per distinct implementation available on this CPU.
+};
+
+/**
+ * @brief Gets the number of entries in the SIMD dispatch registry.
+ */
+VX_EXPORT int VxGetSIMDDispatchEntryCount();
+
+/**
+ * @brief Describes one dispatch registry entry.
+ * @param index Entry index, from 0 to VxGetSIMDDispatchEntryCount() - 1.
+ * @param info Receives the entry description.
+ * @return TRUE on success, FALSE if index is out of range.
+ */
+VX_EXPORT XBOOL VxGetSIMDDispatchEntry(int index, VxSIMDDispatchEntryInfo &info);
+
+/**
+ * @brief Binds one dispatch entry to a given SIMD mode.
+ * @param name Entry name as reported by VxGetSIMDDispatchEntry().
+ * @param mode A VX_SIMD_MODE_* value, or VX_SIMD_MODE_AUTO to follow the global mode again.
+ * @return TRUE on success, FALSE for an unknown entry or a mode this CPU does not support.
+ *
+ * The entry binds the best implementation at or below @a mode. An override
+ * never goes above the global effective backend, so VxSetSIMDOverride(VX_SIMD_MODE_NONE)
+ * still makes every entry scalar.
+ */
+VX_EXPORT XBOOL VxSetSIMDDispatchEntryOverride(const char *name, int mode);
+
+/**
+ * @brief Makes every dispatch entry follow the global SIMD mode again.
+ */
+VX_EXPORT void VxResetSIMDDispatchEntryOverrides();
+
+/**
+ * @brief Times the SIMD candidates of the registry entries and binds the fastest.
+ * @param cacheFile Optional path of a calibration cache, or NULL.
+ * @return TRUE on success, FALSE if the cache could not be written.
+ *
+ * Each entry with a representative workload and more than one candidate at or
+ * below the global effective backend is timed once per candidate; another
+ * candidate replaces the default only when it is clearly faster. This takes a
+ * few hundred milliseconds and replaces any entry overrides.
+ *
+ * When @a cacheFile holds the results of an earlier calibration on the same
+ * CPU and global backend, they are applied without timing anything. Otherwise
+ * the new results are written to it.
+ */
+VX_EXPORT XBOOL VxCalibrateSIMDDispatch(const char *cacheFile);
+
 /**
  * @brief Performs a bit-block transfer (blit) from a source image to a destination image.
  * @param src_desc The description of the source image.
@@ -176,6 +240,150 @@ VX_EXPORT void VxDoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_
  */
 VX_EXPORT void VxDoBlitUpsideDown(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
 
+/**
+ * @brief Blits an image like VxDoBlit(), dithering where precision is reduced.
+ * @param src_desc The description of the source image.
+ * @param dst_desc The description of the destination image.
+ * @param dither A VX_DITHERMODE value.
+ *
+ * VX_DITHER_ORDERED applies to same-size 24/32-bit -> 16-bit blits and
+ * VX_DITHER_ERRORDIFFUSION to same-size 24/32-bit -> paletted blits; other
+ * pairs (and VX_DITHER_NONE) behave exactly like VxDoBlit(). Both modes follow
+ * VxSetBlitParallelism: ordered dithering splits rows into bands, error
+ * diffusion pipelines rows so each trails the one above by a few pixels.
+ */
+VX_EXPORT void VxDoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VX_DITHERMODE dither);
+
+/**
+ * @brief Blits a rectangle of an image into a rectangle of another image.
+ * @param src_desc The description of the source image.
+ * @param dst_desc The description of the destination image.
+ * @param srcRect Source rectangle (right/bottom exclusive), or NULL for the whole image.
+ * @param dstRect Destination rectangle, or NULL for the whole image.
+ * @return FALSE if the images or rectangles are invalid.
+ *
+ * Rectangles of the same size are copied and clipped against both images.
+ * Rectangles of different sizes are resized like VxDoBlit() and must lie
+ * inside their images. Rectangles on DXT images must cover the whole image.
+ */
+VX_EXPORT XBOOL VxDoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, const CKRECT *srcRect,
+                         const CKRECT *dstRect);
+
+/**
+ * @brief Blits a rectangle like VxDoBlit(), flipping it vertically.
+ * @param src_desc The description of the source image.
+ * @param dst_desc The description of the destination image.
+ * @param srcRect Source rectangle, or NULL for the whole image.
+ * @param dstRect Destination rectangle of the same size, or NULL for the whole image.
+ * @return FALSE if the images or rectangles are invalid.
+ */
+VX_EXPORT XBOOL VxDoBlitUpsideDown(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc,
+                                   const CKRECT *srcRect, const CKRECT *dstRect);
+
+/**
+ * @brief Blits an image band by band through row callbacks, with bounded memory.
+ * @param src_desc The description of the source image. When Image is NULL, rows are
+ *        pulled from @p read; otherwise they are read from Image (which may be a
+ *        VxMemoryMappedFile view).
+ * @param dst_desc The description of the destination image. When @p write is NULL,
+ *        rows are written to Image; otherwise they are pushed to @p write.
+ * @param read Source row reader, or NULL.
+ * @param write Destination row writer, or NULL.
+ * @param userData Passed to both callbacks.
+ * @param bandRows Destination rows per band, or 0 to keep both bands near 1 MB.
+ * @return FALSE if the pair cannot be streamed or a callback returned FALSE.
+ *
+ * The output matches VxDoBlit, resizing included. Source rows are requested in
+ * increasing order and never twice. Palette quantization and DXT formats are
+ * not supported.
+ */
+VX_EXPORT XBOOL VxStreamBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VxBlitReadFunc read,
+                             VxBlitWriteFunc write, void *userData, int bandRows = 0);
+
+/**
+ * @brief Performs many independent blits in one call.
+ * @param src_descs Array of @p count source image descriptions.
+ * @param dst_descs Array of @p count destination image descriptions.
+ * @param count Number of blits.
+ * @param parallel TRUE to spread the blits over worker threads (uses the VxSetBlitParallelism
+ *        thread count when enabled, otherwise all hardware threads).
+ *
+ * Blits are grouped by source/destination format so the conversion kernel and its setup are
+ * resolved once per group instead of once per image. Each blit produces the same result as
+ * VxDoBlit; blits that resize or quantize fall back to VxDoBlit. Destinations must not overlap.
+ */
+VX_EXPORT void VxDoBlitBatch(const VxImageDescEx *src_descs, const VxImageDescEx *dst_descs, int count,
+                             XBOOL parallel = FALSE);
+
+/// Opaque precompiled blit created by VxCreateBlitPlan.
+struct VxBlitPlan;
+
+/**
+ * @brief Precompiles the blit between two image layouts for repeated use.
+ * @param src_desc The description of the source image. Image is ignored.
+ * @param dst_desc The description of the destination image. Image is ignored.
+ * @param upsideDown TRUE to flip vertically like VxDoBlitUpsideDown.
+ * @return The plan, or NULL if VxDoBlit would reject this pair. Release it with VxDeleteBlitPlan.
+ *
+ * The plan captures the conversion kernel, the channel shifts and masks, the strides and
+ * whether the blit resizes or quantizes. Color maps are referenced, not copied, and must
+ * outlive the plan. Plans stay valid across SIMD mode changes: the kernel is looked up again
+ * when the active dispatch tables differ from the ones the plan was created with.
+ */
+VX_EXPORT VxBlitPlan *VxCreateBlitPlan(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc,
+                                       XBOOL upsideDown = FALSE);
+
+/**
+ * @brief Runs a precompiled blit on new image buffers.
+ * @param plan Plan returned by VxCreateBlitPlan.
+ * @param srcImage Source pixels with the layout given at plan creation.
+ * @param dstImage Destination pixels with the layout given at plan creation.
+ *
+ * Produces the same result as VxDoBlit (or VxDoBlitUpsideDown) on the original descriptors
+ * with Image replaced. A plan may be executed from several threads at once.
+ */
+VX_EXPORT void VxExecuteBlitPlan(const VxBlitPlan *plan, const XBYTE *srcImage, XBYTE *dstImage);
+
+/**
+ * @brief Releases a plan created by VxCreateBlitPlan.
+ * @param plan The plan to release. NULL is ignored.
+ */
+VX_EXPORT void VxDeleteBlitPlan(VxBlitPlan *plan);
+
+/**
+ * @brief Enables row-band parallelism for VxDoBlit and VxDoBlitUpsideDown.
+ * @param threadCount Maximum number of threads per blit, including the caller. 0 or 1 disables (default).
+ * @param minRowsPerBand Minimum number of rows per band (default 64). Blits with fewer than
+ *        2 * minRowsPerBand rows stay on the calling thread.
+ *
+ * Bands run the same line kernels as the single-threaded path, so results are identical.
+ * Resizing blits are not split.
+ */
+VX_EXPORT void VxSetBlitParallelism(int threadCount, int minRowsPerBand);
+
+/**
+ * @brief Gets the current row-band parallelism settings.
+ * @param threadCount Receives the maximum number of threads per blit.
+ * @param minRowsPerBand Receives the minimum number of rows per band.
+ */
+VX_EXPORT void VxGetBlitParallelism(int &threadCount, int &minRowsPerBand);
+
+/**
+ * @brief Sets the quality used when VxDoBlit writes DXT1-DXT5 destinations.
+ * @param quality A VX_DXTQUALITY value (default VX_DXTQUALITY_FAST). Other values are clamped.
+ *
+ * VX_DXTQUALITY_HIGH also runs a cluster fit for every block and keeps it when the
+ * error is lower. It is 100-250x slower than the default range fit (see VX_DXTQUALITY)
+ * and meant for offline use.
+ */
+VX_EXPORT void VxSetDXTCompressionQuality(int quality);
+
+/**
+ * @brief Gets the DXT compression quality.
+ * @return The current VX_DXTQUALITY value.
+ */
+VX_EXPORT int VxGetDXTCompressionQuality();
+
 /**
  * @brief Sets the alpha channel of an image to a constant value.
  * @param dst_desc The description of the destination image.
@@ -190,6 +398,58 @@ VX_EXPORT void VxDoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE AlphaValue);
  */
 VX_EXPORT void VxDoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE *AlphaValues);
 
+/**
+ * @brief Sets the alpha channel of a rectangle of an image to a constant value.
+ * @param dst_desc The description of the destination image.
+ * @param AlphaValue The 8-bit alpha value to set.
+ * @param rect The rectangle to modify (clipped to the image), or NULL for the whole image.
+ * @return FALSE if the image or rectangle is invalid.
+ */
+VX_EXPORT XBOOL VxDoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE AlphaValue, const CKRECT *rect);
+
+/**
+ * @brief Sets the alpha channel of a rectangle of an image from an array of alpha values.
+ * @param dst_desc The description of the destination image.
+ * @param AlphaValues One 8-bit value per pixel of @p rect, row by row (before clipping).
+ * @param rect The rectangle to modify (clipped to the image), or NULL for the whole image.
+ * @return FALSE if the image or rectangle is invalid.
+ */
+VX_EXPORT XBOOL VxDoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE *AlphaValues, const CKRECT *rect);
+
+/**
+ * @brief Fills a rectangle of an image with a solid color.
+ * @param dst_desc The description of the destination image.
+ * @param Color The color in the destination pixel layout (the low bytes for 8/16/24-bit images).
+ * @param rect The rectangle to fill (clipped to the image), or NULL for the whole image.
+ * @return FALSE if the image or rectangle is invalid.
+ */
+VX_EXPORT XBOOL VxFillImage(const VxImageDescEx &dst_desc, XDWORD Color, const CKRECT *rect = NULL);
+
+/**
+ * @brief Composites a 32-bit image onto a region of another 32-bit image.
+ * @param src_desc The description of the source image.
+ * @param dst_desc The description of the destination image (modified in-place).
+ * @param op A VX_BLENDOP value.
+ * @param dstX Destination column of the source's left edge (may be negative).
+ * @param dstY Destination row of the source's top edge (may be negative).
+ * @param factor Source weight 0-255 for VX_BLEND_LERP; ignored otherwise.
+ * @return FALSE if the images or parameters are invalid.
+ *
+ * The source is clipped to the destination. Both images must share their
+ * channel masks, and the SrcOver operations need alpha in the top byte.
+ */
+VX_EXPORT XBOOL VxBlendImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VX_BLENDOP op,
+                             int dstX = 0, int dstY = 0, int factor = 255);
+
+/**
+ * @brief Composites a rectangle of a 32-bit image like VxBlendImage().
+ * @param srcRect The source rectangle (clipped to the source), or NULL for the whole image.
+ * @param dstX Destination column of the rectangle's left edge (may be negative).
+ * @param dstY Destination row of the rectangle's top edge (may be negative).
+ */
+VX_EXPORT XBOOL VxBlendImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VX_BLENDOP op,
+                             const CKRECT *srcRect, int dstX, int dstY, int factor = 255);
+
 /**
  * @brief Gets the number of bits for each color component from an image description.
  * @param desc The image description.
@@ -217,6 +477,33 @@ VX_EXPORT void VxGetBitShifts(const VxImageDescEx &desc, XDWORD &Rshift, XDWORD
  */
 VX_EXPORT void VxGenerateMipMap(const VxImageDescEx &src_desc, XBYTE *DestBuffer);
 
+/**
+ * @brief Returns the number of bytes VxGenerateMipChain writes for a 32-bit image.
+ * @param Width Width of the base level.
+ * @param Height Height of the base level.
+ * @return Total size of every level below the base, down to 1x1.
+ */
+VX_EXPORT int VxGetMipChainSize(int Width, int Height);
+
+/**
+ * @brief Generates every mipmap level of a 32-bit image down to 1x1 in one pass.
+ * @param src_desc The description of the 32-bit base level.
+ * @param DestBuffer Receives levels 1..N-1 back to back, each with a pitch of
+ *        its width * 4 (see VxGetMipChainSize()).
+ * @param Flags Combination of VX_MIPCHAIN_FLAGS.
+ * @return Number of levels written, or 0 if the source is not a valid 32-bit image.
+ *
+ * Each level is max(1, previous / 2) in both dimensions. Odd sizes use a
+ * three-tap polyphase box so every source texel contributes to the next level.
+ * By default each level is averaged from the 8-bit level above (a rounded 2x2
+ * box for even sizes), at the cost of a VxGenerateMipMap loop or less. With
+ * VX_MIPCHAIN_SRGB or VX_MIPCHAIN_ALPHA_WEIGHTED, rows flow down through all
+ * levels while still in cache and intermediate levels are carried at 15-bit
+ * precision, which keeps repeated conversions from drifting. Large images are
+ * split into row bands when blit parallelism is enabled (see VxSetBlitParallelism).
+ */
+VX_EXPORT int VxGenerateMipChain(const VxImageDescEx &src_desc, XBYTE *DestBuffer, XDWORD Flags = VX_MIPCHAIN_DEFAULT);
+
 /**
  * @brief Resizes a 32-bit image.
  * @param src_desc The description of the source image.
@@ -224,6 +511,41 @@ VX_EXPORT void VxGenerateMipMap(const VxImageDescEx &src_desc, XBYTE *DestBuffer
  */
 VX_EXPORT void VxResizeImage32(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
 
+/**
+ * @brief Resizes an image with a selectable filter.
+ * @param src_desc The description of the source image.
+ * @param dst_desc The description of the destination image with the target dimensions.
+ * @param filter A VX_RESIZEFILTER value. VX_RESIZEFILTER_BILINEAR matches VxResizeImage32(src_desc, dst_desc);
+ *        box, triangle, Mitchell and Lanczos3 widen with the scale factor and do not alias when shrinking.
+ */
+VX_EXPORT void VxResizeImage32(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VX_RESIZEFILTER filter);
+
+/**
+ * @brief Converts a YUV image (I420, NV12 or YUY2) to an RGB image, resizing if needed.
+ * @param src_desc The description of the YUV source.
+ * @param dst_desc The description of the destination image. Any format VxDoBlit can write from 32-bit ARGB.
+ * @param filter A VX_RESIZEFILTER value, used when the sizes differ.
+ * @return FALSE if a descriptor is invalid.
+ *
+ * Chroma is replicated over the pixels it covers, and alpha is opaque. When the
+ * sizes differ, rows are decoded as the resize reads them, so the result matches
+ * converting to 32-bit ARGB and calling VxResizeImage32 without the full-frame
+ * intermediate.
+ */
+VX_EXPORT XBOOL VxConvertFromYUV(const VxYUVImageDesc &src_desc, const VxImageDescEx &dst_desc,
+                                 VX_RESIZEFILTER filter = VX_RESIZEFILTER_BILINEAR);
+
+/**
+ * @brief Converts an RGB image to an I420 or NV12 image of the same size.
+ * @param src_desc The description of the source image. Any uncompressed format VxDoBlit can read.
+ * @param dst_desc The description of the YUV destination.
+ * @return FALSE if a descriptor is invalid, the sizes differ or the destination is YUY2.
+ *
+ * Each chroma sample is computed from the average of the 2x2 pixels it covers;
+ * alpha is ignored.
+ */
+VX_EXPORT XBOOL VxConvertToYUV(const VxImageDescEx &src_desc, const VxYUVImageDesc &dst_desc);
+
 /**
  * @brief Converts an image to a normal map.
  * @param image The image to convert, its data will be modified in place.
@@ -232,6 +554,33 @@ VX_EXPORT void VxResizeImage32(const VxImageDescEx &src_desc, const VxImageDescE
  */
 VX_EXPORT XBOOL VxConvertToNormalMap(const VxImageDescEx &image, XDWORD ColorMask);
 
+/**
+ * @brief Converts an image to a normal map in place with the given gradient operator.
+ * @param image The 32-bit image to convert.
+ * @param ColorMask The channel holding the heights, or 0xFFFFFFFF to use R + G + B.
+ * @param filter A VX_GRADIENTFILTER value.
+ * @return TRUE on success, FALSE otherwise.
+ *
+ * VX_GRADIENTFILTER_DEFAULT matches the two-argument overload. The other
+ * operators clamp at the image edges and are scaled to the same slope as a
+ * one-pixel difference. Large images are split into row bands when blit
+ * parallelism is enabled (see VxSetBlitParallelism).
+ */
+VX_EXPORT XBOOL VxConvertToNormalMap(const VxImageDescEx &image, XDWORD ColorMask, VX_GRADIENTFILTER filter);
+
+/**
+ * @brief Writes the normal map of an image to another image of the same size.
+ * @param src_desc The 32-bit height image.
+ * @param dst_desc The 32-bit destination; it may be @p src_desc itself.
+ * @param ColorMask The channel holding the heights, or 0xFFFFFFFF to use R + G + B.
+ * @param filter A VX_GRADIENTFILTER value.
+ * @return FALSE if either image is not 32-bit or the sizes differ.
+ *
+ * Same result as copying the source and converting it in place, without the copy.
+ */
+VX_EXPORT XBOOL VxConvertToNormalMap(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, XDWORD ColorMask,
+                                     VX_GRADIENTFILTER filter = VX_GRADIENTFILTER_DEFAULT);
+
 /**
  * @brief Converts an image to a bump map.
  * @param image The image to convert, its data will be modified in place.
@@ -239,6 +588,28 @@ VX_EXPORT XBOOL VxConvertToNormalMap(const VxImageDescEx &image, XDWORD ColorMas
  */
 VX_EXPORT XBOOL VxConvertToBumpMap(const VxImageDescEx &image);
 
+/**
+ * @brief Converts an image to a bump map in place with the given gradient operator.
+ * @param image The 32-bit image to convert, at least two pixels wide.
+ * @param filter A VX_GRADIENTFILTER value.
+ * @return TRUE on success, FALSE otherwise.
+ *
+ * VX_GRADIENTFILTER_DEFAULT matches the one-argument overload. The other
+ * operators wrap around all four edges, so tiling textures stay seamless, and
+ * are scaled to the same range as the central difference.
+ */
+VX_EXPORT XBOOL VxConvertToBumpMap(const VxImageDescEx &image, VX_GRADIENTFILTER filter);
+
+/**
+ * @brief Writes the bump map of an image to another image of the same size.
+ * @param src_desc The 32-bit height image, at least two pixels wide.
+ * @param dst_desc The 32-bit destination; it may be @p src_desc itself.
+ * @param filter A VX_GRADIENTFILTER value.
+ * @return FALSE if either image is not 32-bit or the sizes differ.
+ */
+VX_EXPORT XBOOL VxConvertToBumpMap(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc,
+                                   VX_GRADIENTFILTER filter = VX_GRADIENTFILTER_DEFAULT);
+
 /**
  * @brief Gets the number of set bits in a mask.
  * @param dwMask The mask to count bits in.
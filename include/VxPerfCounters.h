@@ -0,0 +1,85 @@
+#ifndef VXPERFCOUNTERS_H
+#define VXPERFCOUNTERS_H
+
+#include "VxMathDefines.h"
+#include "XArray.h"
+
+/**
+ * @brief Library-wide event counters.
+ * @see VxGetPerfCounters
+ */
+typedef enum VX_PERFCOUNTER {
+    VX_PERFCOUNTER_RAY_QUERIES        = 0, ///< Ray, segment and line tests; face tests count through their plane test
+    VX_PERFCOUNTER_VOLUME_QUERIES     = 1, ///< Box, face, frustum, plane and sphere overlap tests
+    VX_PERFCOUNTER_DISTANCE_QUERIES   = 2, ///< VxDistance queries
+    VX_PERFCOUNTER_HASHTABLE_REHASHES = 3, ///< XHashTable, XNHashTable and XSHashTable rehashes
+    VX_PERFCOUNTER_ALLOC_CALLS        = 4, ///< mynew, mynewarray and VxNewAligned calls
+    VX_PERFCOUNTER_ALLOC_BYTES        = 5, ///< Bytes requested by those calls
+    VX_PERFCOUNTER_FREE_CALLS         = 6, ///< mydelete, mydeletearray and VxDeleteAligned calls
+    VX_PERFCOUNTER_COUNT              = 7
+} VX_PERFCOUNTER;
+
+/**
+ * @brief Blit totals of one source/destination pixel format pair.
+ */
+struct VxPerfBlitCounters {
+    VX_PIXELFORMAT SrcFormat;
+    VX_PIXELFORMAT DstFormat;
+    unsigned long long Calls;       ///< Blits, resizes included.
+    unsigned long long Pixels;      ///< Destination pixels written.
+    unsigned long long Bytes;       ///< Source bytes read plus destination bytes written.
+    unsigned long long Nanoseconds; ///< Wall time spent in these blits.
+};
+
+/**
+ * @brief Totals of every thread since the last VxResetPerfCounters().
+ */
+struct VxPerfCounterSnapshot {
+    unsigned long long Counters[VX_PERFCOUNTER_COUNT]; ///< Indexed by VX_PERFCOUNTER.
+    XArray<VxPerfBlitCounters> Blits;                  ///< Format pairs that were blitted at least once.
+};
+
+/**
+ * @brief Turns the performance counters on or off.
+ *
+ * Counters are off by default; while off, the instrumented entry points only
+ * test a flag. Each thread updates its own shard, so counting never contends.
+ */
+VX_EXPORT void VxEnablePerfCounters(XBOOL enable);
+
+/**
+ * @brief Returns TRUE while the performance counters are on.
+ */
+VX_EXPORT XBOOL VxArePerfCountersEnabled();
+
+/**
+ * @brief Adds to a counter of the calling thread if counters are on.
+ */
+VX_EXPORT void VxAddPerfCounter(VX_PERFCOUNTER counter, unsigned long long value);
+
+/**
+ * @brief Sums every thread's counters.
+ * @param snapshot Receives the totals since the last reset.
+ */
+VX_EXPORT void VxGetPerfCounters(VxPerfCounterSnapshot &snapshot);
+
+/**
+ * @brief Restarts every counter from zero.
+ */
+VX_EXPORT void VxResetPerfCounters();
+
+/**
+ * @brief Returns a short name for a counter, e.g. "ray_queries", or NULL.
+ */
+VX_EXPORT const char *VxGetPerfCounterName(VX_PERFCOUNTER counter);
+
+/**
+ * @brief Writes a snapshot as a text table or as JSON.
+ * @param snapshot Counters to write.
+ * @param path Output file path.
+ * @param json TRUE for JSON, FALSE for text.
+ * @return FALSE if the file could not be written.
+ */
+VX_EXPORT XBOOL VxWritePerfCounters(const VxPerfCounterSnapshot &snapshot, const char *path, XBOOL json);
+
+#endif // VXPERFCOUNTERS_H
@@ -50,10 +50,23 @@
 #define VX_SIMD_ARM 1
 #elif defined(_M_ARM) || defined(__arm__)
 #define VX_SIMD_ARM 1
+#elif defined(__wasm__)
+#define VX_SIMD_WASM 1
 #endif
 
-/* x86/x64 SIMD feature detection */
-#if defined(VX_SIMD_X86) && !defined(VX_SIMD_FORCE_DISABLED)
+/*
+ * 128-bit targets without SSE. AArch64 always has Advanced SIMD; WebAssembly
+ * has SIMD128 only when built with -msimd128.
+ */
+#if defined(VX_SIMD_ARM64) && (defined(__ARM_NEON) || defined(_M_ARM64))
+#define VX_SIMD_NEON 1
+#elif defined(VX_SIMD_WASM) && defined(__wasm_simd128__)
+#define VX_SIMD_WASM_SIMD128 1
+#endif
+
+/* SIMDe configuration, shared by the x86 and the portable paths */
+#if (defined(VX_SIMD_X86) || defined(VX_SIMD_NEON) || defined(VX_SIMD_WASM_SIMD128)) \
+      && !defined(VX_SIMD_FORCE_DISABLED)
 
 /*
  * Use SIMDe for portable SIMD intrinsics.
@@ -87,6 +100,11 @@
 #endif
 #endif
 
+#endif // SIMDe configuration
+
+/* x86/x64 SIMD feature detection */
+#if defined(VX_SIMD_X86) && !defined(VX_SIMD_FORCE_DISABLED)
+
 /* SSE (x64 implies SSE2 baseline; for 32-bit MSVC use _M_IX86_FP) */
 #if defined(VX_SIMD_X64) \
       || (defined(_MSC_VER) && defined(_M_IX86_FP) && _M_IX86_FP >= 1) \
@@ -167,6 +185,26 @@
 
 #endif // VX_SIMD_X86 && !VX_SIMD_FORCE_DISABLED
 
+/*
+ * NEON / SIMD128: the SSE code paths build unchanged through SIMDe, which
+ * lowers each x86 intrinsic to its NEON or SIMD128 counterpart (for example
+ * _mm_shuffle_epi8 to TBL or i8x16.swizzle). Only the levels SIMDe maps
+ * closely are advertised: SSE4.2 string ops and FMA (which would change
+ * rounding against the SSE2 build) stay off.
+ */
+#if (defined(VX_SIMD_NEON) || defined(VX_SIMD_WASM_SIMD128)) && !defined(VX_SIMD_FORCE_DISABLED)
+#define VX_SIMD_SSE 1
+#define VX_SIMD_SSE2 1
+#define VX_SIMD_SSE3 1
+#define VX_SIMD_SSSE3 1
+#define VX_SIMD_SSE4_1 1
+#include <simde/x86/sse.h>
+#include <simde/x86/sse2.h>
+#include <simde/x86/sse3.h>
+#include <simde/x86/ssse3.h>
+#include <simde/x86/sse4.1.h>
+#endif // (VX_SIMD_NEON || VX_SIMD_WASM_SIMD128) && !VX_SIMD_FORCE_DISABLED
+
 // ============================================================================
 // FMA Macros (like DirectXMath XM_FMADD_PS)
 // ============================================================================
@@ -287,6 +325,11 @@ struct VxSIMDFeatures {
     bool AVX2 = false;
     bool FMA = false;
     bool AVX512F = false;
+    bool AVX512BW = false;
+    bool AVX512VL = false;
+    bool AVX512VBMI = false;
+    bool NEON = false;
+    bool WASM_SIMD128 = false;
     bool XSAVE = false;
     bool OSXSAVE = false;
 };
@@ -369,6 +412,10 @@ VX_SIMD_INLINE VxSIMDFeatures VxDetectSIMDFeatures() {
         // EBX register (info[1])
         const bool avx2Cpu = (info[1] & (1 << 5)) != 0;
         const bool avx512fCpu = (info[1] & (1 << 16)) != 0;
+        const bool avx512bwCpu = (info[1] & (1 << 30)) != 0;
+        const bool avx512vlCpu = (info[1] & (1u << 31)) != 0;
+        // ECX register (info[2])
+        const bool avx512vbmiCpu = (info[2] & (1 << 1)) != 0;
 
         features.AVX2 = avx2Cpu && features.AVX;
 
@@ -378,9 +425,20 @@ VX_SIMD_INLINE VxSIMDFeatures VxDetectSIMDFeatures() {
             avx512StateEnabled = (xcr0 & 0xE6) == 0xE6; // XMM,YMM,opmask,ZMM_hi256,Hi16_ZMM
         }
         features.AVX512F = avx512fCpu && avx512StateEnabled;
+        features.AVX512BW = avx512bwCpu && features.AVX512F;
+        features.AVX512VL = avx512vlCpu && features.AVX512F;
+        features.AVX512VBMI = avx512vbmiCpu && features.AVX512F;
     }
 #endif
 
+    // Both are part of the compile target rather than optional CPU features.
+#if defined(VX_SIMD_NEON)
+    features.NEON = true;
+#endif
+#if defined(VX_SIMD_WASM_SIMD128)
+    features.WASM_SIMD128 = true;
+#endif
+
     return features;
 }
 
@@ -10,5 +10,8 @@
 #define VX_SIMD_MODE_SSE4_1 4
 #define VX_SIMD_MODE_AVX    5
 #define VX_SIMD_MODE_AVX2   6
+#define VX_SIMD_MODE_AVX512 7 // AVX512F + AVX512BW + AVX512VL + AVX512VBMI
+#define VX_SIMD_MODE_NEON   8 // AArch64 Advanced SIMD, through SIMDe
+#define VX_SIMD_MODE_WASM_SIMD128 9 // WebAssembly SIMD128, through SIMDe
 
 #endif // VXSIMDMODE_H
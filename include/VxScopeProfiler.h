@@ -0,0 +1,115 @@
+#ifndef VXSCOPEPROFILER_H
+#define VXSCOPEPROFILER_H
+
+#include "VxMathDefines.h"
+
+/**
+ * @brief One node of the aggregated profiler call tree.
+ *
+ * Nodes are returned in depth-first order, so a node's children follow it
+ * directly. Identical call paths from different threads are merged.
+ */
+struct VxProfileNode {
+    const char *Name; ///< Scope name as passed to VxProfileScope.
+    int Parent;       ///< Index of the parent node, -1 for a root.
+    int Depth;        ///< 0 for a root.
+    int Calls;        ///< Number of completed scopes on this path.
+    double TotalMs;   ///< Time spent inside the scope, children included.
+    double SelfMs;    ///< TotalMs minus the time spent in child scopes.
+    double MinMs;     ///< Shortest single call.
+    double MaxMs;     ///< Longest single call.
+};
+
+/**
+ * @brief Starts recording scopes on every thread.
+ *
+ * Events go to a ring buffer owned by the recording thread, so threads never
+ * contend. When a buffer is full its oldest events are overwritten.
+ */
+VX_EXPORT void VxProfilerStart();
+
+/**
+ * @brief Stops recording. Scopes that are already open still record their end.
+ */
+VX_EXPORT void VxProfilerStop();
+
+/**
+ * @brief Returns TRUE while the profiler is recording.
+ */
+VX_EXPORT XBOOL VxProfilerIsCapturing();
+
+/**
+ * @brief Discards every recorded event.
+ */
+VX_EXPORT void VxProfilerReset();
+
+/**
+ * @brief Records the start of a scope on the calling thread.
+ * @param name A string that outlives the profiler, usually a literal.
+ * @return TRUE if the event was recorded; only then must VxProfilerEndScope() follow.
+ */
+VX_EXPORT XBOOL VxProfilerBeginScope(const char *name);
+
+/**
+ * @brief Records the end of the innermost scope of the calling thread.
+ */
+VX_EXPORT void VxProfilerEndScope();
+
+/**
+ * @brief Aggregates the recorded events into a call tree.
+ * @param nodes Receives up to @a maxNodes nodes in depth-first order; may be NULL.
+ * @param maxNodes Capacity of @a nodes.
+ * @return The total number of nodes in the tree.
+ *
+ * Call this after VxProfilerStop(); scopes still open are not counted.
+ */
+VX_EXPORT int VxProfilerGetCallTree(VxProfileNode *nodes, int maxNodes);
+
+/**
+ * @brief Writes the recorded scopes as a Chrome trace (chrome://tracing, Perfetto).
+ * @param path Output file path.
+ * @return FALSE if the file could not be written.
+ */
+VX_EXPORT XBOOL VxProfilerWriteChromeTrace(const char *path);
+
+/**
+ * @brief Times the enclosing C++ scope while the profiler is recording.
+ *
+ * Prefer the VX_PROFILE_SCOPE macro, which compiles to nothing unless
+ * VX_ENABLE_PROFILER is defined.
+ *
+ * @example
+ * @code
+ * void Update() {
+ *     VX_PROFILE_SCOPE("Update");
+ *     ...
+ * }
+ * @endcode
+ */
+class VxProfileScope {
+public:
+    explicit VxProfileScope(const char *name) : m_Active(VxProfilerBeginScope(name)) {}
+
+    ~VxProfileScope() {
+        if (m_Active) {
+            VxProfilerEndScope();
+        }
+    }
+
+private:
+    VxProfileScope(const VxProfileScope &);
+    VxProfileScope &operator=(const VxProfileScope &);
+
+    XBOOL m_Active;
+};
+
+#define VX_PROFILE_CONCAT_INNER(a, b) a##b
+#define VX_PROFILE_CONCAT(a, b) VX_PROFILE_CONCAT_INNER(a, b)
+
+#if defined(VX_ENABLE_PROFILER)
+#define VX_PROFILE_SCOPE(name) VxProfileScope VX_PROFILE_CONCAT(vxProfileScope_, __LINE__)(name)
+#else
+#define VX_PROFILE_SCOPE(name) ((void) 0)
+#endif
+
+#endif // VXSCOPEPROFILER_H
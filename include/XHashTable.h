@@ -4,6 +4,7 @@
 #include "XClassArray.h"
 #include "XArray.h"
 #include "XHashFun.h"
+#include "VxPerfCounters.h"
 
 #if VX_HAS_CXX11
 #include <initializer_list>
@@ -1171,6 +1172,7 @@ private:
      * @param iSize The new number of buckets for the table.
      */
     void Rehash(int iSize) {
+        VxAddPerfCounter(VX_PERFCOUNTER_HASHTABLE_REHASHES, 1);
         if (iSize < 4)
             iSize = 4;
 
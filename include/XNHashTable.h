@@ -3,6 +3,7 @@
 
 #include "XArray.h"
 #include "XHashFun.h"
+#include "VxPerfCounters.h"
 
 #if VX_HAS_CXX11
 #include <initializer_list>
@@ -1016,6 +1017,7 @@ private:
      */
     void
     Rehash(int size) {
+        VxAddPerfCounter(VX_PERFCOUNTER_HASHTABLE_REHASHES, 1);
         int oldsize = m_Table.Size();
         m_Threshold = (int) (size * m_LoadFactor);
 
@@ -9,6 +9,7 @@
 #include "XArray.h"
 #include "XClassArray.h"
 #include "XHashFun.h"
+#include "VxPerfCounters.h"
 
 #if VX_HAS_CXX11
 #include <algorithm>
@@ -1063,6 +1064,7 @@ private:
      */
     void
     Rehash(int size) {
+        VxAddPerfCounter(VX_PERFCOUNTER_HASHTABLE_REHASHES, 1);
         int oldsize = m_Table.Size();
         m_Threshold = (int) (size * m_LoadFactor);
 
@@ -73,6 +73,17 @@ struct VxBlitInfo {
     int colorMapEntries;
     int bytesPerColorEntry;
 
+    // Destination color map (paletted -> paletted remapping)
+    const XBYTE *dstColorMap;
+    int dstColorMapEntries;
+    int dstBytesPerColorEntry;
+
+    // Byte shuffle for layouts whose channels all sit on whole bytes. Entry i
+    // names the source byte that feeds destination byte i of a group of
+    // 16 / max(srcBytesPerPixel, dstBytesPerPixel) pixels; entries with the top
+    // bit set write zero (PSHUFB convention).
+    XBYTE byteShuffle[16];
+
     // Per-operation stamp used by scanline kernels for ephemeral caching.
     XDWORD operationStamp;
 };
@@ -97,6 +108,104 @@ struct VxResizeInfo {
 /// Function pointer type for line blitting operations
 typedef void (*VxBlitLineFunc)(const VxBlitInfo *info);
 
+/// Function pointer type for DXT decoding: expands @p blockCount consecutive
+/// 4x4 blocks into four rows of 32-bit ARGB pixels starting at @p dst.
+typedef void (*VxBlockDecodeFunc)(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch);
+
+/// Function pointer type for DXT encoding: compresses @p blockCount consecutive
+/// 4x4 blocks read from four rows of 32-bit ARGB pixels starting at @p src.
+typedef void (*VxBlockEncodeFunc)(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+
+/// Function pointer type for the horizontal resampling pass: filters one 32-bit
+/// row into @p dstWidth pixels of four 16-bit channels. Output x reads @p taps
+/// source pixels starting at first[x], weighted by weights[x * taps + t].
+typedef void (*VxResampleHorzFunc)(const XDWORD *src, short *dst, int dstWidth, const int *first,
+                                   const short *weights, int taps);
+
+/// Function pointer type for the vertical resampling pass: combines @p taps
+/// horizontally filtered rows into one row of @p width 32-bit pixels.
+typedef void (*VxResampleVertFunc)(const short *const *rows, const short *weights, int taps, XDWORD *dst,
+                                   int width);
+
+/// Function pointer type for the mip chain horizontal pass: halves one row of
+/// four 15-bit channels per pixel. Three-tap kernels read weights[x * 3 + t].
+typedef void (*VxMipHorzFunc)(const short *src, short *dst, int dstWidth, const short *weights);
+
+/// Function pointer type for the mip chain vertical pass: combines two or three
+/// rows of @p count 15-bit channels, three-tap kernels weighted by @p weights.
+typedef void (*VxMipVertFunc)(const short *const *rows, const short *weights, short *dst, int count);
+
+/// Function pointer type for the mip chain 2x2 box: halves two rows of 32-bit
+/// pixels with 8-bit channels into @p dstWidth pixels, rounding to nearest.
+typedef void (*VxMipBoxFunc)(const XBYTE *row0, const XBYTE *row1, XBYTE *dst, int dstWidth);
+
+/// Function pointer type for ordered dithering: saturating add of a periodic
+/// byte pattern (see DITHER_PATTERN_PERIOD) to @p bytes source bytes.
+typedef void (*VxDitherAddFunc)(const XBYTE *src, XBYTE *dst, int bytes, const XBYTE *pattern);
+
+/// Function pointer type for YUV decoding: converts @p width pixels starting on
+/// an even column to opaque 32-bit ARGB. @p y is the luma row (the packed row
+/// for YUY2), @p u and @p v the matching chroma rows (@p u holds the UV pairs
+/// for NV12). @p matrix is a VX_YUVMATRIX value.
+typedef void (*VxYUVDecodeFunc)(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width,
+                                int matrix);
+
+/// Function pointer type for YUV encoding: converts two rows of @p width 32-bit
+/// ARGB pixels to two luma rows and one row of chroma averaged over 2x2 pixels
+/// (@p u receives the UV pairs for NV12, @p v is then unused).
+typedef void (*VxYUVEncodeFunc)(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1,
+                                XBYTE *u, XBYTE *v, int matrix);
+
+/// Function pointer type for height extraction: converts @p width 32-bit pixels
+/// to integer heights, either R + G + B or (pixel & @p mask) >> @p shift.
+typedef void (*VxHeightRowFunc)(const XDWORD *src, int *dst, int width, XDWORD mask, int shift);
+
+/// Function pointer type for normal map rows: @p rows holds the height rows
+/// above, at and below the output row; heights times @p scale lie in [0, 1].
+/// @p filter is a VX_GRADIENTFILTER value. Columns clamp at both ends.
+typedef void (*VxNormalRowFunc)(const int *const *rows, XDWORD *dst, int width, float scale, int filter);
+
+/// Function pointer type for bump map rows: @p rows holds the luminance rows
+/// above, at and below the output row. @p filter is a VX_GRADIENTFILTER value.
+/// Columns wrap around.
+typedef void (*VxBumpRowFunc)(const int *const *rows, XDWORD *dst, int width, int filter);
+
+/**
+ * @brief Precompiled blit for one source/destination descriptor pair.
+ *
+ * Filled by VxBlitEngine::InitBlitPlan() and run by VxBlitEngine::ExecuteBlitPlan()
+ * against new image pointers. A plan is never modified after initialization, so
+ * it may be executed from several threads at once.
+ */
+struct VxBlitPlan {
+    /// How the plan reaches the destination.
+    enum Kind {
+        KIND_COPY,     ///< Same-size line conversion
+        KIND_RESIZE,   ///< 32-bit source resized while converting
+        KIND_QUANTIZE, ///< Truecolor source quantized to a paletted destination
+        KIND_DECOMPRESS, ///< DXT source decoded to an uncompressed destination
+        KIND_COMPRESS    ///< Uncompressed source encoded to a DXT destination
+    };
+
+    int kind;
+    XBOOL upsideDown;
+
+    // Descriptors captured at creation, with Image set to NULL.
+    VxImageDescEx srcDesc;
+    VxImageDescEx dstDesc;
+    VX_PIXELFORMAT srcFormat;
+    VX_PIXELFORMAT dstFormat;
+
+    // Line kernel resolved from boundTables. When another dispatch snapshot is
+    // active (SIMD mode change or table rebuild) the kernel is resolved again
+    // from the cached formats at execution time.
+    const void *boundTables;
+    VxBlitLineFunc blitFunc;
+
+    // VxBlitInfo with everything but line pointers and stamp filled in.
+    VxBlitInfo info;
+};
+
 /**
  * @class VxBlitEngine
  * @brief High-performance image blitting and format conversion engine.
@@ -106,11 +215,18 @@ typedef void (*VxBlitLineFunc)(const VxBlitInfo *info);
  * - Image resizing with bilinear filtering
  * - Alpha channel manipulation
  * - Upside-down blitting for coordinate system conversions
+ * - DXT1-DXT5 decompression to any uncompressed format
+ * - DXT1-DXT5 compression from any uncompressed format
  *
  * The engine uses a dispatch table to select the optimal routine for each
  * source/destination format combination, with special optimizations for
  * common formats like 32-bit ARGB.
  *
+ * All image operations are reentrant: per-call state lives on the caller's
+ * stack (or in thread-local scratch), and dispatch tables are immutable
+ * snapshots swapped atomically by ApplySIMDMode()/RebuildTables(). The engine
+ * lock is only taken while a snapshot is being built.
+ *
  * @remarks
  * This class is designed to match the original Virtools VxBlitEngine behavior.
  * A global instance (TheBlitter) is created and used by the VxDoBlit functions.
@@ -134,6 +250,18 @@ public:
      */
     void DoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
 
+    /**
+     * @brief Performs a blit like DoBlit(), dithering where precision is reduced.
+     * @param src_desc Source image descriptor.
+     * @param dst_desc Destination image descriptor.
+     * @param dither A VX_DITHERMODE value.
+     *
+     * VX_DITHER_ORDERED covers same-size 24/32-bit -> 16-bit blits and
+     * VX_DITHER_ERRORDIFFUSION same-size 24/32-bit -> paletted blits (see
+     * QuantizeImage()). Every other combination is a plain DoBlit().
+     */
+    void DoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int dither);
+
     /**
      * @brief Performs a blit operation, flipping the image vertically.
      * @param src_desc Source image descriptor.
@@ -141,6 +269,91 @@ public:
      */
     void DoBlitUpsideDown(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
 
+    /**
+     * @brief Blits a rectangle of the source into a rectangle of the destination.
+     * @param src_desc Source image descriptor.
+     * @param dst_desc Destination image descriptor.
+     * @param srcRect Source rectangle (right/bottom exclusive), or NULL for the whole image.
+     * @param dstRect Destination rectangle, or NULL for the whole image.
+     * @return FALSE if the images or rectangles are invalid, TRUE otherwise
+     *         (including when nothing is left after clipping).
+     *
+     * Rectangles of the same size are copied like DoBlit() and clipped against
+     * both images. Rectangles of different sizes resize like DoBlit() and must
+     * lie inside their images. Rectangles on DXT images must cover the whole
+     * image. Clipping happens once per call; the row kernels are the ones used
+     * for whole images.
+     */
+    XBOOL DoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, const CKRECT *srcRect,
+                 const CKRECT *dstRect);
+
+    /**
+     * @brief Blits a rectangle like DoBlit(), flipping it vertically.
+     * @param src_desc Source image descriptor.
+     * @param dst_desc Destination image descriptor.
+     * @param srcRect Source rectangle, or NULL for the whole image.
+     * @param dstRect Destination rectangle of the same size, or NULL for the whole image.
+     * @return FALSE if the images or rectangles are invalid, TRUE otherwise.
+     *
+     * The top source row lands on the bottom destination row. Clipping one side
+     * drops the matching rows of the other side.
+     */
+    XBOOL DoBlitUpsideDown(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, const CKRECT *srcRect,
+                           const CKRECT *dstRect);
+
+    /**
+     * @brief Performs many independent blits in one call.
+     * @param src_descs Array of @p count source image descriptors.
+     * @param dst_descs Array of @p count destination image descriptors.
+     * @param count Number of blits.
+     * @param parallel TRUE to spread the blits over worker threads.
+     *
+     * Blits are grouped by format pair; the line kernel and VxBlitInfo template
+     * are resolved once per group. Each blit behaves exactly like DoBlit().
+     */
+    void DoBlitBatch(const VxImageDescEx *src_descs, const VxImageDescEx *dst_descs, int count, XBOOL parallel);
+
+    /**
+     * @brief Blits an image band by band, pulling and pushing rows through callbacks.
+     * @param src_desc Source image descriptor. Rows come from Image when it is not
+     *        NULL (for instance a VxMemoryMappedFile view), otherwise from @p read.
+     * @param dst_desc Destination image descriptor. Rows go to @p write when it is
+     *        not NULL, otherwise straight into Image.
+     * @param read Source row reader, or NULL.
+     * @param write Destination row writer, or NULL.
+     * @param userData Passed to both callbacks.
+     * @param bandRows Destination rows per band, or 0 for about 1 MB of bands.
+     * @return FALSE if the pair cannot be streamed or a callback aborted.
+     *
+     * Produces the same pixels as DoBlit(). Source rows are read once each, in
+     * increasing order; when resizing, only the rows DoBlit() samples are read.
+     * Working memory is one source band and one destination band, whatever
+     * the image height. Same-size bands are split across threads like DoBlit().
+     * Quantizing to a palette and DXT images need the whole image and are
+     * rejected, as are resizing sources 32768 pixels wide or wider.
+     */
+    XBOOL StreamBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VxBlitReadFunc read,
+                     VxBlitWriteFunc write, void *userData, int bandRows);
+
+    /**
+     * @brief Precompiles a blit between two image layouts.
+     * @param plan Plan to fill.
+     * @param src_desc Source image descriptor (Image is ignored).
+     * @param dst_desc Destination image descriptor (Image is ignored).
+     * @param upsideDown TRUE to flip vertically like DoBlitUpsideDown().
+     * @return TRUE if the pair can be blitted, FALSE if DoBlit() would reject it.
+     */
+    XBOOL InitBlitPlan(VxBlitPlan &plan, const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc,
+                       XBOOL upsideDown) const;
+
+    /**
+     * @brief Runs a plan created by InitBlitPlan() on new image buffers.
+     * @param plan Initialized plan.
+     * @param srcImage Source pixels laid out as the plan's source descriptor.
+     * @param dstImage Destination pixels laid out as the plan's destination descriptor.
+     */
+    void ExecuteBlitPlan(const VxBlitPlan &plan, const XBYTE *srcImage, XBYTE *dstImage);
+
     /**
      * @brief Sets the alpha channel of an image to a constant value.
      * @param dst_desc Destination image descriptor.
@@ -155,6 +368,24 @@ public:
      */
     void DoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE *AlphaValues);
 
+    /**
+     * @brief Sets the alpha channel of a rectangle to a constant value.
+     * @param dst_desc Destination image descriptor.
+     * @param AlphaValue The alpha value to set (0-255).
+     * @param rect Rectangle to modify (clipped to the image), or NULL for the whole image.
+     * @return FALSE if the image or rectangle is invalid.
+     */
+    XBOOL DoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE AlphaValue, const CKRECT *rect);
+
+    /**
+     * @brief Sets the alpha channel of a rectangle from an array of alpha values.
+     * @param dst_desc Destination image descriptor.
+     * @param AlphaValues One value per pixel of @p rect, row by row (before clipping).
+     * @param rect Rectangle to modify (clipped to the image), or NULL for the whole image.
+     * @return FALSE if the image or rectangle is invalid.
+     */
+    XBOOL DoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE *AlphaValues, const CKRECT *rect);
+
     /**
      * @brief Resizes an image using the best built-in path for the format pair.
      * @param src_desc Source image descriptor.
@@ -162,11 +393,96 @@ public:
      *
      * Current policy:
      * - 32bpp -> 32bpp and 24bpp -> 24bpp use bilinear filtering.
-     * - Same-format low-bpp paths (8/16bpp) use nearest-neighbor for speed.
-     * - Mixed-format resize falls back to 32bpp conversion + bilinear + conversion.
+     * - 8bpp -> 8bpp uses nearest-neighbor.
+     * - Other pairs with a 16/24/32bpp source use fused bilinear strips: source
+     *   rows are unpacked to ARGB, filtered and packed to the destination format
+     *   a strip at a time, without whole-image temporaries.
+     * - Paletted destinations fall back to 32bpp conversion + bilinear + quantization.
      */
     void ResizeImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
 
+    /**
+     * @brief Resizes an image with a selectable reconstruction filter.
+     * @param src_desc Source image descriptor.
+     * @param dst_desc Destination image descriptor.
+     * @param filter A VX_RESIZEFILTER value.
+     *
+     * VX_RESIZEFILTER_BILINEAR is the same as ResizeImage(). The other filters
+     * run a separable polyphase resampler on 32-bit ARGB; other formats are
+     * unpacked and packed a row at a time around it.
+     */
+    void ResizeImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int filter);
+
+    /**
+     * @brief Converts a YUV image to any format reachable from 32-bit ARGB.
+     * @param src_desc YUV source descriptor.
+     * @param dst_desc Destination image descriptor.
+     * @param filter A VX_RESIZEFILTER value, used when the sizes differ.
+     * @return FALSE if either descriptor is invalid.
+     *
+     * Rows are decoded to ARGB one at a time and packed to the destination.
+     * When the sizes differ the decoder feeds the resize row converters
+     * directly (see ResizeRowCodec), so decoding, scaling and packing are a
+     * single pass. Paletted and DXT destinations go through a 32-bit image.
+     */
+    XBOOL ConvertFromYUV(const VxYUVImageDesc &src_desc, const VxImageDescEx &dst_desc, int filter);
+
+    /**
+     * @brief Converts an image to an I420 or NV12 image of the same size.
+     * @param src_desc Source image descriptor (uncompressed, not paletted).
+     * @param dst_desc YUV destination descriptor.
+     * @return FALSE if the descriptors are invalid or the sizes differ.
+     */
+    XBOOL ConvertToYUV(const VxImageDescEx &src_desc, const VxYUVImageDesc &dst_desc);
+
+    /**
+     * @brief Writes the normal map of a 32-bit height image.
+     * @param src_desc Height image (32-bit).
+     * @param dst_desc Destination of the same size (32-bit); may alias @p src_desc.
+     * @param colorMask Height channel, or 0xFFFFFFFF for R + G + B.
+     * @param filter A VX_GRADIENTFILTER value.
+     * @return FALSE if the descriptors are invalid or the sizes differ.
+     *
+     * Rows are converted to heights in a three-row ring, so no copy of the
+     * image is made. Bands capture their halo rows before any band writes,
+     * which keeps the in-place case exact when bands run in parallel.
+     */
+    XBOOL ConvertToNormalMap(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, XDWORD colorMask,
+                             int filter);
+
+    /**
+     * @brief Writes the bump map of a 32-bit image (see ConvertToNormalMap()).
+     * @param src_desc Source image (32-bit, at least two pixels wide).
+     * @param dst_desc Destination of the same size (32-bit); may alias @p src_desc.
+     * @param filter A VX_GRADIENTFILTER value.
+     * @return FALSE if the descriptors are invalid or the sizes differ.
+     */
+    XBOOL ConvertToBumpMap(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int filter);
+
+    /**
+     * @brief Generates every mip level of a 32-bit image below the base, down to 1x1.
+     * @param src_desc Base level (32-bit).
+     * @param dst Receives levels 1..N-1 back to back, each with a pitch of width * 4.
+     * @param flags Combination of VX_MIPCHAIN_FLAGS.
+     * @return Number of levels written (0 for a 1x1 or invalid source).
+     *
+     * Without flags each level is built from the 8-bit level above: even sizes
+     * with a rounded 2x2 box (row-parallel when parallelism is enabled), other
+     * sizes with a one-level cascade. With VX_MIPCHAIN_SRGB or
+     * VX_MIPCHAIN_ALPHA_WEIGHTED, base rows are converted to 15-bit channels
+     * (linear light, alpha-premultiplied) and cascade through all levels: each
+     * level halves incoming rows horizontally into a three-row ring and emits a
+     * row as soon as its vertical window is complete. With parallelism enabled,
+     * the top levels whose heights stay even are built in independent row bands
+     * and the rest of the chain is finished from the last banded level.
+     */
+    int GenerateMipChain(const VxImageDescEx &src_desc, XBYTE *dst, XDWORD flags);
+
+    /**
+     * @brief Size in bytes of every 32-bit mip level below a @p width x @p height base.
+     */
+    static int GetMipChainSize(int width, int height);
+
     /**
      * @brief Quantizes a 24/32-bit image to 8-bit paletted format using NeuQuant.
      * @param src_desc Source image descriptor (24 or 32-bit).
@@ -178,6 +494,13 @@ public:
      */
     XBOOL QuantizeImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
 
+    /**
+     * @brief Quantizes like QuantizeImage(), optionally with error diffusion.
+     * @param dither VX_DITHER_ERRORDIFFUSION to map pixels with Floyd-Steinberg
+     *        error diffusion; any other value maps each pixel to its nearest entry.
+     */
+    XBOOL QuantizeImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int dither);
+
     /**
      * @brief Quantizes a 24/32-bit image using the median-cut algorithm.
      * @param src_desc Source image descriptor (24 or 32-bit).
@@ -186,6 +509,11 @@ public:
      */
     XBOOL QuantizeImageMedianCut(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
 
+    /**
+     * @brief Median-cut quantization, optionally with error diffusion (see QuantizeImage()).
+     */
+    XBOOL QuantizeImageMedianCut(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int dither);
+
     /**
      * @brief Converts a VxImageDescEx to a VX_PIXELFORMAT enum.
      * @param desc The image descriptor to analyze.
@@ -214,6 +542,15 @@ public:
      */
     void FillImage(const VxImageDescEx &dst_desc, XDWORD color);
 
+    /**
+     * @brief Fills a rectangle of an image with a solid color.
+     * @param dst_desc Destination image descriptor.
+     * @param color The color to fill with (see FillImage()).
+     * @param rect Rectangle to fill (clipped to the image), or NULL for the whole image.
+     * @return FALSE if the image or rectangle is invalid.
+     */
+    XBOOL FillImage(const VxImageDescEx &dst_desc, XDWORD color, const CKRECT *rect);
+
     /**
      * @brief Converts an image to premultiplied alpha format in-place.
      * @param desc Image descriptor (must be 32-bit ARGB).
@@ -272,6 +609,59 @@ public:
      */
     void MultiplyBlend(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
 
+    /**
+     * @brief Composites a 32-bit source image onto a region of a 32-bit destination.
+     * @param src_desc Source image descriptor.
+     * @param dst_desc Destination image descriptor (modified in-place).
+     * @param op Compositing operation (VX_BLENDOP).
+     * @param dstX Destination column of the source's left edge (may be negative).
+     * @param dstY Destination row of the source's top edge (may be negative).
+     * @param factor Source weight 0-255 for VX_BLEND_LERP; ignored otherwise.
+     * @return FALSE for invalid images or parameters, TRUE otherwise (including
+     *         when the source lies entirely outside the destination).
+     *
+     * The source rectangle is clipped to the destination. Both images must have
+     * the same channel masks; the SrcOver operations also need the alpha in the
+     * top byte. Rows are split across threads like DoBlit() row bands.
+     */
+    XBOOL BlendImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int op, int dstX = 0,
+                     int dstY = 0, int factor = 255);
+
+    /**
+     * @brief Composites a rectangle of the source like BlendImage().
+     * @param srcRect Source rectangle (clipped to the source), or NULL for the whole image.
+     * @param dstX Destination column of the rectangle's left edge (may be negative).
+     * @param dstY Destination row of the rectangle's top edge (may be negative).
+     */
+    XBOOL BlendImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int op, const CKRECT *srcRect,
+                     int dstX, int dstY, int factor = 255);
+
+    /**
+     * @brief Configures row-band parallelism for DoBlit() and DoBlitUpsideDown().
+     * @param threadCount Maximum threads per blit, including the caller (0 or 1 disables).
+     * @param minRowsPerBand Minimum rows per band; smaller blits stay single-threaded.
+     */
+    void SetParallelism(int threadCount, int minRowsPerBand);
+
+    /**
+     * @brief Gets the current row-band parallelism settings.
+     * @param threadCount Receives the maximum threads per blit.
+     * @param minRowsPerBand Receives the minimum rows per band.
+     */
+    void GetParallelism(int &threadCount, int &minRowsPerBand) const;
+
+    /**
+     * @brief Selects the endpoint search used when blitting to DXT formats.
+     * @param quality VX_DXTQUALITY_FAST (range fit) or VX_DXTQUALITY_HIGH (cluster fit).
+     */
+    void SetDXTQuality(int quality);
+
+    /**
+     * @brief Gets the DXT compression quality.
+     * @return VX_DXTQUALITY_FAST or VX_DXTQUALITY_HIGH.
+     */
+    int GetDXTQuality() const;
+
     /**
      * @brief Rebuilds dispatch tables using the currently injected effective SIMD mode.
      */
@@ -284,125 +674,374 @@ public:
     void ApplySIMDMode(int effectiveMode);
 
 private:
+    // Function dispatch tables
+    // Layout: [srcBpp][dstBpp] for generic, [srcFormat][dstFormat] for specific
+    static const int TABLE_SIZE = 16;        // 16 entries per dimension
+    static const int FORMAT_TABLE_SIZE = 19; // Up to format 18 (before DXT)
+    static const int ALPHA_TABLE_SIZE = 4;   // 8, 16, 24, 32 bits
+    static const int TIER_SLOT_COUNT = VX_SIMD_MODE_AVX512 + 1; // Indexed by blit kernel tier
+    static const int BLEND_OP_COUNT = VX_BLEND_LERP + 1;        // Indexed by VX_BLENDOP
+
+    /**
+     * @brief Read-only dispatch snapshot for one blit kernel tier.
+     *
+     * Snapshots are built under m_Lock and published with release semantics.
+     * Once published they are never written again, so blit calls read them
+     * without taking the lock.
+     */
+    struct DispatchTables {
+        // Effective SIMD kernel tier this snapshot was built for.
+        int kernelMode;
+
+        // Generic blitting functions indexed by [srcBytesPerPixel-1][dstBytesPerPixel-1]
+        VxBlitLineFunc genericBlit[4][4];
+
+        // Specific blitting functions for known format pairs
+        // Indexed by [srcFormat][dstFormat]
+        VxBlitLineFunc specificBlit[FORMAT_TABLE_SIZE][FORMAT_TABLE_SIZE];
+
+        // Set alpha functions indexed by bytes per pixel
+        VxBlitLineFunc setAlpha[ALPHA_TABLE_SIZE];
+
+        // Copy alpha functions indexed by bytes per pixel
+        VxBlitLineFunc copyAlpha[ALPHA_TABLE_SIZE];
+
+        // Paletted image conversion functions
+        VxBlitLineFunc palettedBlit[4][4]; // [paletteType][dstBytesPerPixel-1]
+
+        // Byte-shuffle fallbacks for byte-aligned layouts, indexed like genericBlit
+        VxBlitLineFunc shuffleBlit[4][4];
+
+        // Runtime-selected hot-path kernels.
+        void (*fillLine32)(XDWORD *dst, int width, XDWORD color);
+        void (*fillLine16)(XWORD *dst, int width, XWORD color);
+        VxBlitLineFunc premultiplyAlpha32;
+        VxBlitLineFunc unpremultiplyAlpha32;
+        VxBlitLineFunc swapRedBlue32;
+        VxBlitLineFunc clearAlpha32;
+        VxBlitLineFunc setFullAlpha32;
+        VxBlitLineFunc invertColors32;
+        VxBlitLineFunc grayscale32;
+        VxBlitLineFunc multiplyBlend32;
+
+        // DXT block-row decoders: [0] DXT1, [1] DXT2/DXT3, [2] DXT4/DXT5.
+        VxBlockDecodeFunc decodeDXT[3];
+
+        // DXT block-row encoders: [DXT1, DXT3, DXT5][VX_DXTQUALITY].
+        VxBlockEncodeFunc encodeDXT[3][2];
+
+        // Separable resampling passes.
+        VxResampleHorzFunc resampleHorz32;
+        VxResampleVertFunc resampleVert32;
+
+        // Mip chain passes: [0] pair average (even sizes), [1] three taps (odd sizes),
+        // and the 8-bit 2x2 box of the default mode.
+        VxMipHorzFunc mipHorz[2];
+        VxMipVertFunc mipVert[2];
+        VxMipBoxFunc mipBox;
+
+        // Ordered dithering pre-pass.
+        VxDitherAddFunc ditherAdd;
+
+        // Compositing line kernels indexed by VX_BLENDOP.
+        VxBlitLineFunc blend32[BLEND_OP_COUNT];
+
+        // YUV row converters: decoders indexed by VX_YUVFORMAT, encoders by
+        // [VX_YUV_I420, VX_YUV_NV12].
+        VxYUVDecodeFunc decodeYUV[3];
+        VxYUVEncodeFunc encodeYUV[2];
+
+        // Normal and bump map rows: heights [0] R + G + B, [1] masked channel.
+        VxHeightRowFunc heightRow[2];
+        VxNormalRowFunc normalMapRow;
+        VxBumpRowFunc bumpMapRow;
+    };
+
+    /**
+     * @brief Returns the currently published dispatch snapshot (lock-free).
+     */
+    const DispatchTables &AcquireTables() const;
+
     /**
      * @brief Gets the appropriate blitting function for the given formats.
+     * @param tables Dispatch snapshot to look up.
      * @param src_desc Source image descriptor.
      * @param dst_desc Destination image descriptor.
+     * @param byteShuffle Receives the byte shuffle control when a shuffle kernel
+     *        is chosen, and all 0x80 (write zero) otherwise; pass it on to SetupBlitInfo().
      * @return Pointer to the blitting function, or NULL if no suitable function.
      */
-    VxBlitLineFunc GetBlitFunction(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
+    static VxBlitLineFunc GetBlitFunction(const DispatchTables &tables, const VxImageDescEx &src_desc,
+                                          const VxImageDescEx &dst_desc, XBYTE byteShuffle[16]);
+
+    /**
+     * @brief GetBlitFunction() with the pixel format lookup already done.
+     * @param tables Dispatch snapshot to look up.
+     * @param srcFmt Pixel format of @p src_desc.
+     * @param dstFmt Pixel format of @p dst_desc.
+     * @param src_desc Source image descriptor.
+     * @param dst_desc Destination image descriptor.
+     * @param byteShuffle As for GetBlitFunction().
+     * @return Pointer to the blitting function, or NULL if no suitable function.
+     */
+    static VxBlitLineFunc ResolveBlitFunction(const DispatchTables &tables, VX_PIXELFORMAT srcFmt,
+                                              VX_PIXELFORMAT dstFmt, const VxImageDescEx &src_desc,
+                                              const VxImageDescEx &dst_desc, XBYTE byteShuffle[16]);
 
     /**
      * @brief Gets the appropriate set-alpha function for the given format.
+     * @param tables Dispatch snapshot to look up.
      * @param dst_desc Destination image descriptor.
      * @return Pointer to the set-alpha function, or NULL if not applicable.
      */
-    VxBlitLineFunc GetSetAlphaFunction(const VxImageDescEx &dst_desc);
+    static VxBlitLineFunc GetSetAlphaFunction(const DispatchTables &tables, const VxImageDescEx &dst_desc);
 
     /**
      * @brief Gets the appropriate copy-alpha function for the given format.
+     * @param tables Dispatch snapshot to look up.
      * @param dst_desc Destination image descriptor.
      * @return Pointer to the copy-alpha function, or NULL if not applicable.
      */
-    VxBlitLineFunc GetCopyAlphaFunction(const VxImageDescEx &dst_desc);
+    static VxBlitLineFunc GetCopyAlphaFunction(const DispatchTables &tables, const VxImageDescEx &dst_desc);
+
+    /**
+     * @brief Decodes a DXT1-5 image into an uncompressed destination of the same size.
+     * @param tables Dispatch snapshot selecting the decoder and line converter.
+     * @param src_desc Source descriptor; Flags holds the DXT format and
+     *        TotalImageSize the block-row pitch times the block rows (0 for
+     *        tightly packed rows).
+     * @param dst_desc Destination descriptor (any non-paletted, non-DXT format).
+     * @param upsideDown TRUE to flip vertically.
+     *
+     * Block rows are decoded to ARGB 8888 and converted with the regular line
+     * kernels; ARGB 8888 destinations with a width multiple of 4 are decoded in
+     * place. Block rows are split across threads like DoBlit() row bands.
+     */
+    void DecompressBlocks(const DispatchTables &tables, const VxImageDescEx &src_desc,
+                          const VxImageDescEx &dst_desc, XBOOL upsideDown);
+
+    /**
+     * @brief Encodes an uncompressed image into a DXT1-5 destination of the same size.
+     * @param tables Dispatch snapshot selecting the encoder and line converter.
+     * @param src_desc Source descriptor (any non-DXT format).
+     * @param dst_desc Destination descriptor; Flags holds the DXT format and
+     *        TotalImageSize the block-row pitch times the block rows (0 for
+     *        tightly packed rows).
+     * @param upsideDown TRUE to flip vertically.
+     *
+     * Each group of four source rows is converted to ARGB 8888 and padded to
+     * whole blocks by repeating the last column and row. Sources without an
+     * alpha mask are staged opaque. DXT2 and DXT4 use the DXT3 and DXT5
+     * encoders on colour premultiplied by alpha. ARGB 8888 sources with a width
+     * multiple of 4 are encoded in place, except into DXT2 and DXT4.
+     */
+    void CompressBlocks(const DispatchTables &tables, const VxImageDescEx &src_desc,
+                        const VxImageDescEx &dst_desc, XBOOL upsideDown);
+
+    /**
+     * @brief Same-size 24/32-bit -> 16-bit blit with 4x4 Bayer ordered dithering.
+     * @return FALSE (and writes nothing) when the pair has no channel to dither.
+     *
+     * Each source row gets a saturating add of its Bayer row, scaled per channel
+     * to the destination step, and then goes through the regular line kernel.
+     */
+    XBOOL BlitOrderedDither(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
+
+    /**
+     * @brief Writes alpha values into every row of @p dst_desc.
+     * @param AlphaValues First value of the first row.
+     * @param alphaPitch Distance in values between rows of @p AlphaValues.
+     */
+    void CopyAlphaRows(const VxImageDescEx &dst_desc, const XBYTE *AlphaValues, int alphaPitch);
 
     /**
      * @brief Sets up the VxBlitInfo structure for a blit operation.
      * @param info The structure to fill.
      * @param src_desc Source image descriptor.
      * @param dst_desc Destination image descriptor.
+     * @param byteShuffle Shuffle control from the GetBlitFunction() call that chose the kernel.
      */
-    void SetupBlitInfo(VxBlitInfo &info, const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
+    static void SetupBlitInfo(VxBlitInfo &info, const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc,
+                              const XBYTE byteShuffle[16]);
+
+    /**
+     * @brief Row converters around the ARGB 8888 resize cores.
+     *
+     * @c unpack expands source pixels to ARGB 8888 and @c pack narrows ARGB 8888
+     * pixels to the destination format. Either is null when that side already
+     * is ARGB 8888. The infos are templates; callers set the line pointers,
+     * width and copy size per call.
+     *
+     * A YUV source sets @c yuv and @c decodeYUV instead of @c unpack; the
+     * source descriptor passed to the resize is then an ARGB 8888 stand-in
+     * with no image.
+     */
+    struct ResizeRowCodec {
+        VxBlitLineFunc unpack;
+        VxBlitLineFunc pack;
+        VxBlitInfo unpackInfo;
+        VxBlitInfo packInfo;
+        const VxYUVImageDesc *yuv;
+        VxYUVDecodeFunc decodeYUV;
+    };
+
+    /**
+     * @brief Returns @p count ARGB 8888 pixels of source row @p y from column @p x.
+     * @param codec Row converters from InitResizeRowCodec().
+     * @param unpackInfo Working copy of codec.unpackInfo.
+     * @param src_desc Source image descriptor.
+     * @param y Source row.
+     * @param x First source column.
+     * @param count Number of pixels.
+     * @param scratch Receives converted pixels; holds at least @p count + 1.
+     * @return The pixels: in the source itself when it already is ARGB 8888,
+     *         otherwise in @p scratch.
+     */
+    static const XDWORD *UnpackResizeRow(const ResizeRowCodec &codec, VxBlitInfo &unpackInfo,
+                                         const VxImageDescEx &src_desc, int y, int x, int count, XDWORD *scratch);
+
+    /**
+     * @brief Resolves the row converters for a resize between two formats.
+     * @return FALSE if either side has no line conversion to or from ARGB 8888
+     *         (DXT, paletted destinations).
+     */
+    XBOOL InitResizeRowCodec(const DispatchTables &tables, const VxImageDescEx &src_desc,
+                             const VxImageDescEx &dst_desc, ResizeRowCodec &codec);
 
     /**
      * @brief High-performance bilinear resize for 32-bit images.
      * Uses SSE2 when available for optimal performance.
+     * @param tables Dispatch snapshot selecting the kernel tier.
      * @param src_desc Source image descriptor.
      * @param dst_desc Destination image descriptor.
      */
-    void ResizeBilinear32(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
+    static void ResizeBilinear32(const DispatchTables &tables, const VxImageDescEx &src_desc,
+                                 const VxImageDescEx &dst_desc);
+
+    /**
+     * @brief Bilinear resize between formats through ARGB 8888 row converters.
+     * @param tables Dispatch snapshot selecting the kernel tier.
+     * @param codec Row converters from InitResizeRowCodec().
+     * @param src_desc Source image descriptor.
+     * @param dst_desc Destination image descriptor.
+     *
+     * The destination is processed in vertical strips. For each strip only the
+     * source columns it reads are unpacked, two rows at a time, so the ARGB
+     * intermediates stay in cache. Per pixel the result matches converting the
+     * whole image to ARGB, calling ResizeBilinear32() and converting back.
+     */
+    static void ResizeBilinearConverted(const DispatchTables &tables, const ResizeRowCodec &codec,
+                                        const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
+
+    /**
+     * @brief Separable polyphase resize for 32-bit images.
+     * @param tables Dispatch snapshot selecting the kernel tier.
+     * @param codec Row converters for non-ARGB images, or null when both images are
+     *        32-bit with the same layout.
+     * @param src_desc Source image descriptor.
+     * @param dst_desc Destination image descriptor.
+     * @param filter VX_RESIZEFILTER other than VX_RESIZEFILTER_BILINEAR.
+     *
+     * Weight tables are built once per axis; source rows are filtered
+     * horizontally on demand into a ring of intermediate rows.
+     */
+    static void ResampleSeparable32(const DispatchTables &tables, const ResizeRowCodec *codec,
+                                    const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int filter);
 
     /**
      * @brief Bilinear resize for 24-bit images.
      * @param src_desc Source image descriptor.
      * @param dst_desc Destination image descriptor.
      */
-    void ResizeBilinear24(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
+    static void ResizeBilinear24(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
 
     /**
      * @brief Nearest-neighbor resize fallback for non-standard formats.
      * @param src_desc Source image descriptor.
      * @param dst_desc Destination image descriptor.
      */
-    void ResizeNearestNeighbor(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
+    static void ResizeNearestNeighbor(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc);
 
     /**
      * @brief Internal blit with resize using fixed-point scanline functions.
      * Called by DoBlit when source is 32-bit and dimensions differ.
+     * @param info Per-call blit info prepared by the caller.
      * @param src_desc Source image descriptor.
      * @param dst_desc Destination image descriptor.
      * @param blitFunc The blit function to use for format conversion.
      */
-    void DoBlitWithResize(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VxBlitLineFunc blitFunc);
+    static void DoBlitWithResize(VxBlitInfo &info, const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc,
+                                 VxBlitLineFunc blitFunc);
+
+    /**
+     * @brief Runs @p blitFunc over every row, in parallel bands when enabled.
+     * @param info Per-call blit info (copied per band).
+     * @param srcFirst First source row to read.
+     * @param srcStep Byte step between source rows (negative for bottom-up).
+     * @param dstFirst First destination row to write.
+     * @param dstStep Byte step between destination rows.
+     * @param rows Number of rows.
+     * @param blitFunc Line function to apply.
+     */
+    void BlitRows(const VxBlitInfo &info, const XBYTE *srcFirst, int srcStep, XBYTE *dstFirst, int dstStep,
+                  int rows, VxBlitLineFunc blitFunc) const;
+
+    struct BlitBatchJob;
+
+    /**
+     * @brief Processes sorted batch entries [begin, end) (VxParallelRangeFunc).
+     */
+    static void RunBlitBatchRange(void *userData, int begin, int end);
 
     // Dispatch table setup helpers
-    void ResetDispatchTables();
-    void ResetHotPathKernels();
-    void BuildGenericTables();
-    void BuildX86Table();
+    static void ResetDispatchTables(DispatchTables &tables);
+    static void ResetHotPathKernels(DispatchTables &tables);
+    static void BuildGenericTables(DispatchTables &tables);
+    static void BuildX86Table(DispatchTables &tables);
+    static void ApplySSE2Overrides(DispatchTables &tables);
+    static void ApplySSSE3Overrides(DispatchTables &tables);
+    static void ApplyAVX2Overrides(DispatchTables &tables);
+    static void ApplyAVX512Overrides(DispatchTables &tables);
     XDWORD NextOperationStamp();
-    void ApplySSE2Overrides();
-    void ApplySSSE3Overrides();
-    void ApplyAVX2Overrides();
-    void RebuildTablesUnlocked();
+    DispatchTables *TierTablesUnlocked(int slot, XBOOL forceRebuild);
+    DispatchTables *ComposeTablesUnlocked(DispatchTables *tables);
+    void PublishTablesUnlocked(XBOOL forceRebuild);
 
-    // Function dispatch tables
-    // Layout: [srcBpp][dstBpp] for generic, [srcFormat][dstFormat] for specific
-    static const int TABLE_SIZE = 16;        // 16 entries per dimension
-    static const int FORMAT_TABLE_SIZE = 19; // Up to format 18 (before DXT)
-    static const int ALPHA_TABLE_SIZE = 4;   // 8, 16, 24, 32 bits
+    // DispatchTables byte ranges of the "blit.*" SIMD dispatch registry
+    // entries, in registry order: {offset, size}.
+    static const size_t s_DispatchEntryRanges[][2];
 
-    // Generic blitting functions indexed by [srcBytesPerPixel-1][dstBytesPerPixel-1]
-    VxBlitLineFunc m_GenericBlitTable[4][4];
+    // Cached snapshots, one per blit kernel tier. Owned by the engine.
+    DispatchTables *m_TierTables[TIER_SLOT_COUNT];
 
-    // Specific blitting functions for known format pairs
-    // Indexed by [srcFormat][dstFormat]
-    VxBlitLineFunc m_SpecificBlitTable[FORMAT_TABLE_SIZE][FORMAT_TABLE_SIZE];
+    // Snapshots replaced by RebuildTables(). Kept alive until destruction
+    // because concurrent blits may still be reading them.
+    XArray<DispatchTables *> m_RetiredTables;
 
-    // Set alpha functions indexed by bytes per pixel
-    VxBlitLineFunc m_SetAlphaTable[ALPHA_TABLE_SIZE];
+    // Snapshots mixing tiers for per-entry dispatch overrides, reused while
+    // their content matches. Kept alive until destruction like m_RetiredTables.
+    XArray<DispatchTables *> m_ComposedTables;
 
-    // Copy alpha functions indexed by bytes per pixel
-    VxBlitLineFunc m_CopyAlphaTable[ALPHA_TABLE_SIZE];
+    // Currently published snapshot (const DispatchTables *).
+    void *volatile m_ActiveTables;
 
-    // Paletted image conversion functions
-    VxBlitLineFunc m_PalettedBlitTable[4][4]; // [paletteType][dstBytesPerPixel-1]
+    // Effective SIMD kernel tier requested through ApplySIMDMode (guarded by m_Lock).
+    int m_EffectiveBlitKernelMode;
 
-    // Current blit info (used during blit operations)
-    VxBlitInfo m_BlitInfo;
+    // Effective SIMD mode before collapsing to a kernel tier (guarded by m_Lock).
+    int m_EffectiveSIMDMode;
 
-    // Temporary buffer for resizing operations
-    XArray<XDWORD> m_ResizeBuffer;
+    // Monotonic stamp for per-operation kernel caches (atomically incremented).
+    volatile int m_OperationStamp;
 
-    // Effective SIMD kernel tier used by blit tables.
-    int m_EffectiveBlitKernelMode;
+    // Row-band parallelism settings (read without locking).
+    volatile int m_BlitThreadCount;
+    volatile int m_MinRowsPerBand;
+
+    // VX_DXTQUALITY used by CompressBlocks() (read without locking).
+    volatile int m_DXTQuality;
 
-    // Monotonic stamp for per-operation kernel caches.
-    XDWORD m_OperationStamp;
-
-    // Runtime-selected hot-path kernels.
-    void (*m_FillLine32)(XDWORD *dst, int width, XDWORD color);
-    void (*m_FillLine16)(XWORD *dst, int width, XWORD color);
-    VxBlitLineFunc m_PremultiplyAlpha32;
-    VxBlitLineFunc m_UnpremultiplyAlpha32;
-    VxBlitLineFunc m_SwapRedBlue32;
-    VxBlitLineFunc m_ClearAlpha32;
-    VxBlitLineFunc m_SetFullAlpha32;
-    VxBlitLineFunc m_InvertColors32;
-    VxBlitLineFunc m_Grayscale32;
-    VxBlitLineFunc m_MultiplyBlend32;
-
-    // Engine-local synchronization for dispatch tables and mutable work buffers.
+    // Serializes snapshot construction; never taken on the blit path.
     mutable VxMutex m_Lock;
 };
 
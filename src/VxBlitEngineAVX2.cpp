@@ -160,35 +160,113 @@ void CopyLine_Paletted8_32ARGB_AVX2(const VxBlitInfo *info) {
     const XBYTE *src = info->srcLine;
     XDWORD *dst = (XDWORD *)info->dstLine;
     const int width = info->width;
-    const XBYTE *colorMap = info->colorMap;
-    const int bpc = info->bytesPerColorEntry;
 
-    if (!colorMap) {
+    if (!info->colorMap) {
         return;
     }
-
-    XDWORD palette32[256];
-    for (int i = 0; i < 256; ++i) {
-        const XBYTE *entry = colorMap + i * bpc;
-        const XDWORD b = entry[0];
-        const XDWORD g = entry[1];
-        const XDWORD r = entry[2];
-        const XDWORD a = (bpc >= 4) ? entry[3] : 0xFFu;
-        palette32[i] = (a << 24) | (r << 16) | (g << 8) | b;
-    }
+    const XDWORD *palette = GetPaletteARGB(info);
 
     int x = 0;
     for (; x + 8 <= width; x += 8) {
         const __m128i idxBytes = _mm_loadl_epi64((const __m128i *)(src + x));
         const __m256i idx32 = _mm256_cvtepu8_epi32(idxBytes);
-        const __m256i colors = _mm256_i32gather_epi32((const int *)palette32, idx32, 4);
+        const __m256i colors = _mm256_i32gather_epi32((const int *)palette, idx32, 4);
         _mm256_storeu_si256((__m256i *)(dst + x), colors);
     }
     for (; x < width; ++x) {
-        dst[x] = palette32[src[x]];
+        dst[x] = palette[src[x]];
+    }
+}
+
+void CopyLine_Paletted8_24RGB_AVX2(const VxBlitInfo *info) {
+    const XBYTE *src = info->srcLine;
+    XBYTE *dst = info->dstLine;
+    const int width = info->width;
+
+    if (!info->colorMap) {
+        return;
+    }
+    const XDWORD *palette = GetPaletteARGB(info);
+
+    // Drop the alpha byte inside each lane, then close the gap between lanes.
+    const __m256i packRGB = _mm256_setr_epi8(
+        0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+        0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1
+    );
+    const __m256i joinLanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        const __m256i idx32 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(src + x)));
+        __m256i colors = _mm256_i32gather_epi32((const int *)palette, idx32, 4);
+        colors = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(colors, packRGB), joinLanes);
+        _mm_storeu_si128((__m128i *)(dst + x * 3), _mm256_castsi256_si128(colors));
+        _mm_storel_epi64((__m128i *)(dst + x * 3 + 16), _mm256_extracti128_si256(colors, 1));
+    }
+    for (; x < width; ++x) {
+        const XDWORD color = palette[src[x]];
+        dst[x * 3 + 0] = (XBYTE)color;
+        dst[x * 3 + 1] = (XBYTE)(color >> 8);
+        dst[x * 3 + 2] = (XBYTE)(color >> 16);
     }
 }
 
+void CopyLine_Paletted8_16_AVX2(const VxBlitInfo *info) {
+    const XBYTE *src = info->srcLine;
+    XWORD *dst = (XWORD *)info->dstLine;
+    const int width = info->width;
+
+    if (!info->colorMap) {
+        return;
+    }
+    const XDWORD *palette = GetPalette16(info);
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m128i idxBytes = _mm_loadu_si128((const __m128i *)(src + x));
+        const __m256i lo = _mm256_i32gather_epi32((const int *)palette, _mm256_cvtepu8_epi32(idxBytes), 4);
+        const __m256i hi =
+            _mm256_i32gather_epi32((const int *)palette, _mm256_cvtepu8_epi32(_mm_srli_si128(idxBytes, 8)), 4);
+        // packus works per 128-bit lane; restore pixel order across lanes.
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256((__m256i *)(dst + x), packed);
+    }
+    for (; x < width; ++x) {
+        dst[x] = (XWORD)palette[src[x]];
+    }
+}
+
+void CopyLine_Paletted8_8_AVX2(const VxBlitInfo *info) {
+    const XBYTE *remap = info->colorMap ? GetPaletteRemap(info) : nullptr;
+    if (!remap) {
+        memcpy(info->dstLine, info->srcLine, info->width);
+        return;
+    }
+
+    const XBYTE *src = info->srcLine;
+    XBYTE *dst = info->dstLine;
+    const int width = info->width;
+
+    // 256-entry byte lookup as 16 shuffles of 16 entries: entries of row h
+    // are selected while the high nibble, counted down, is zero. Adding 0x70
+    // with saturation sets bit 7 (shuffle -> 0) for every other row.
+    const __m256i rowStep = _mm256_set1_epi8(0x10);
+    const __m256i selectBias = _mm256_set1_epi8(0x70);
+
+    int x = 0;
+    for (; x + 32 <= width; x += 32) {
+        __m256i idx = _mm256_loadu_si256((const __m256i *)(src + x));
+        __m256i out = _mm256_setzero_si256();
+        for (int h = 0; h < 16; ++h) {
+            const __m256i row = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(remap + h * 16)));
+            out = _mm256_or_si256(out, _mm256_shuffle_epi8(row, _mm256_adds_epu8(idx, selectBias)));
+            idx = _mm256_sub_epi8(idx, rowStep);
+        }
+        _mm256_storeu_si256((__m256i *)(dst + x), out);
+    }
+    CopyLine_Paletted8_8_Scalar(info, x, remap);
+}
+
 // -- Channel swap conversions ---------------------------------------------
 
 void CopyLine_32ARGB_32ABGR_AVX2(const VxBlitInfo *info) {
@@ -675,9 +753,42 @@ void PremultiplyAlpha_32ARGB_AVX2(const VxBlitInfo *info) {
     PremultiplyAlpha_32ARGB_Scalar(info, x);
 }
 
+// Each channel becomes min((c * reciprocal[a]) >> 16, 255) through the
+// 16-bit factor rows of g_UnpremultiplyTable, as in the SSE2 kernel.
+static inline __m256i UnpremultiplyFactors_AVX2(const XWORD *f0, const XWORD *f1) {
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_load_si128((const __m128i *)f0)),
+                                   _mm_load_si128((const __m128i *)f1), 1);
+}
+
 void UnpremultiplyAlpha_32ARGB_AVX2(const VxBlitInfo *info) {
-    // AVX2 integer division is impractical; delegate entirely to scalar.
-    UnpremultiplyAlpha_32ARGB_Scalar(info, 0);
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+    const XWORD (*factors)[8] = g_UnpremultiplyTable.factors16;
+    const __m256i max = _mm256_set1_epi16(255);
+    const __m256i zero = _mm256_setzero_si256();
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        __m256i pixels = _mm256_loadu_si256((const __m256i *)(src + x));
+        // Rows for pixels {0, 4}, {1, 5}, {2, 6}, {3, 7} line up with the unpacked lanes.
+        __m256i f0 = UnpremultiplyFactors_AVX2(factors[src[x] >> 24], factors[src[x + 4] >> 24]);
+        __m256i f1 = UnpremultiplyFactors_AVX2(factors[src[x + 1] >> 24], factors[src[x + 5] >> 24]);
+        __m256i f2 = UnpremultiplyFactors_AVX2(factors[src[x + 2] >> 24], factors[src[x + 6] >> 24]);
+        __m256i f3 = UnpremultiplyFactors_AVX2(factors[src[x + 3] >> 24], factors[src[x + 7] >> 24]);
+
+        __m256i lo16 = _mm256_unpacklo_epi8(pixels, zero);
+        __m256i hi16 = _mm256_unpackhi_epi8(pixels, zero);
+        __m256i qLo = _mm256_add_epi16(_mm256_mullo_epi16(lo16, _mm256_unpacklo_epi64(f0, f1)),
+                                       _mm256_mulhi_epu16(lo16, _mm256_unpackhi_epi64(f0, f1)));
+        __m256i qHi = _mm256_add_epi16(_mm256_mullo_epi16(hi16, _mm256_unpacklo_epi64(f2, f3)),
+                                       _mm256_mulhi_epu16(hi16, _mm256_unpackhi_epi64(f2, f3)));
+
+        qLo = _mm256_min_epu16(qLo, max);
+        qHi = _mm256_min_epu16(qHi, max);
+        _mm256_storeu_si256((__m256i *)(dst + x), _mm256_packus_epi16(qLo, qHi));
+    }
+    UnpremultiplyAlpha_32ARGB_Scalar(info, x);
 }
 
 void ClearAlpha_32_AVX2(const VxBlitInfo *info) {
@@ -832,4 +943,777 @@ void MultiplyBlend_32_AVX2(const VxBlitInfo *info) {
     MultiplyBlend_32_Scalar(src, dst, x, width);
 }
 
+// -- DXT block decoding ---------------------------------------------------
+
+// Two rows (8 pixels) per 256-bit vector: the 4-entry palette is duplicated in
+// both halves and indexed with a lane permute.
+static inline __m256i BroadcastDXTColorPalette_AVX2(const XBYTE *block, bool allowPunchThrough) {
+    return _mm256_broadcastsi128_si256(DXTBuildColorPalette_SSE2(block, allowPunchThrough));
+}
+
+static inline XDWORD ReadDXTColorIndices_AVX2(const XBYTE *block) {
+    return block[4] | (block[5] << 8) | (block[6] << 16) | ((XDWORD)block[7] << 24);
+}
+
+// Colors for rows 2*half and 2*half+1.
+static inline __m256i SelectDXTColors_AVX2(__m256i palette, XDWORD indices, int half) {
+    const __m256i shifts = _mm256_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14);
+    const __m256i idx = _mm256_srlv_epi32(_mm256_set1_epi32((int)(indices >> (half * 16))), shifts);
+    return _mm256_permutevar8x32_epi32(palette, _mm256_and_si256(idx, _mm256_set1_epi32(3)));
+}
+
+static inline void StoreDXTRowPair_AVX2(XBYTE *dst, int dstPitch, int half, __m256i pixels) {
+    _mm_storeu_si128((__m128i *)(dst + (half * 2) * dstPitch), _mm256_castsi256_si128(pixels));
+    _mm_storeu_si128((__m128i *)(dst + (half * 2 + 1) * dstPitch), _mm256_extracti128_si256(pixels, 1));
+}
+
+void DecodeBlocks_DXT1_AVX2(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch) {
+    for (int b = 0; b < blockCount; ++b, blocks += 8, dst += 16) {
+        const __m256i palette = BroadcastDXTColorPalette_AVX2(blocks, true);
+        const XDWORD indices = ReadDXTColorIndices_AVX2(blocks);
+        StoreDXTRowPair_AVX2(dst, dstPitch, 0, SelectDXTColors_AVX2(palette, indices, 0));
+        StoreDXTRowPair_AVX2(dst, dstPitch, 1, SelectDXTColors_AVX2(palette, indices, 1));
+    }
+}
+
+void DecodeBlocks_DXT3_AVX2(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch) {
+    const __m256i shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+    const __m256i nibbleMask = _mm256_set1_epi32(0xF);
+    const __m256i rgbMask = _mm256_set1_epi32(0x00FFFFFF);
+    for (int b = 0; b < blockCount; ++b, blocks += 16, dst += 16) {
+        const __m256i palette = BroadcastDXTColorPalette_AVX2(blocks + 8, false);
+        const XDWORD indices = ReadDXTColorIndices_AVX2(blocks + 8);
+        for (int half = 0; half < 2; ++half) {
+            const XBYTE *a = blocks + half * 4;
+            const XDWORD alphaBits = a[0] | (a[1] << 8) | (a[2] << 16) | ((XDWORD)a[3] << 24);
+            const __m256i nibbles =
+                _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32((int)alphaBits), shifts), nibbleMask);
+            // a * 17 in the top byte: (a << 28) | (a << 24).
+            const __m256i alpha = _mm256_or_si256(_mm256_slli_epi32(nibbles, 28), _mm256_slli_epi32(nibbles, 24));
+            const __m256i colors = _mm256_and_si256(SelectDXTColors_AVX2(palette, indices, half), rgbMask);
+            StoreDXTRowPair_AVX2(dst, dstPitch, half, _mm256_or_si256(colors, alpha));
+        }
+    }
+}
+
+void DecodeBlocks_DXT5_AVX2(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch) {
+    const __m256i shifts = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+    const __m256i indexMask = _mm256_set1_epi32(7);
+    const __m256i rgbMask = _mm256_set1_epi32(0x00FFFFFF);
+    for (int b = 0; b < blockCount; ++b, blocks += 16, dst += 16) {
+        XDWORD alphaEntries[8];
+        DXTBuildAlphaPalette(blocks, alphaEntries);
+        const __m256i alphaPalette = _mm256_loadu_si256((const __m256i *)alphaEntries);
+        const uint64_t alphaIndices = DXTReadAlphaIndices(blocks);
+
+        const __m256i palette = BroadcastDXTColorPalette_AVX2(blocks + 8, false);
+        const XDWORD indices = ReadDXTColorIndices_AVX2(blocks + 8);
+        for (int half = 0; half < 2; ++half) {
+            const XDWORD alphaBits = (XDWORD)(alphaIndices >> (half * 24)) & 0xFFFFFF;
+            const __m256i idx =
+                _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32((int)alphaBits), shifts), indexMask);
+            const __m256i alpha = _mm256_permutevar8x32_epi32(alphaPalette, idx);
+            const __m256i colors = _mm256_and_si256(SelectDXTColors_AVX2(palette, indices, half), rgbMask);
+            StoreDXTRowPair_AVX2(dst, dstPitch, half, _mm256_or_si256(colors, alpha));
+        }
+    }
+}
+
+// -- Separable resampling -------------------------------------------------
+
+void ResampleHorz_32_AVX2(const XDWORD *src, short *dst, int dstWidth, const int *first, const short *weights,
+                          int taps) {
+    // Four taps per step: bytes of p0/p1 and p2/p3 are interleaved per channel,
+    // widened to one lane each and multiplied by the matching weight pairs.
+    const __m128i interleave = _mm_setr_epi8(0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15);
+    const __m256i pairIndex = _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(128);
+
+    for (int x = 0; x < dstWidth; ++x, weights += taps, dst += 4) {
+        const XDWORD *p = src + first[x];
+        __m256i acc4 = _mm256_setzero_si256();
+        int t = 0;
+        for (; t + 4 <= taps; t += 4) {
+            const __m128i pixels = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(p + t)), interleave);
+            const __m256i w = _mm256_permutevar8x32_epi32(
+                _mm256_castsi128_si256(_mm_loadl_epi64((const __m128i *)(weights + t))), pairIndex);
+            acc4 = _mm256_add_epi32(acc4, _mm256_madd_epi16(_mm256_cvtepu8_epi16(pixels), w));
+        }
+        __m128i acc = _mm_add_epi32(_mm256_castsi256_si128(acc4), _mm256_extracti128_si256(acc4, 1));
+        for (; t < taps; ++t) {
+            const __m128i pixel = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128((int)p[t]), zero), zero);
+            acc = _mm_add_epi32(acc, _mm_madd_epi16(pixel, _mm_set1_epi32((int)(XWORD)weights[t])));
+        }
+        acc = _mm_srai_epi32(_mm_add_epi32(acc, round), 8);
+        _mm_storel_epi64((__m128i *)dst, _mm_packs_epi32(acc, acc));
+    }
+}
+
+void ResampleVert_32_AVX2(const short *const *rows, const short *weights, int taps, XDWORD *dst, int width) {
+    const int end = width * 4;
+    const __m256i round = _mm256_set1_epi32(1 << 19);
+    const __m256i zero = _mm256_setzero_si256();
+    XBYTE *out = (XBYTE *)dst;
+
+    int c = 0;
+    for (; c + 16 <= end; c += 16) {
+        __m256i lo = round;
+        __m256i hi = round;
+        int t = 0;
+        for (; t + 2 <= taps; t += 2) {
+            const __m256i a = _mm256_loadu_si256((const __m256i *)(rows[t] + c));
+            const __m256i b = _mm256_loadu_si256((const __m256i *)(rows[t + 1] + c));
+            const __m256i w = _mm256_set1_epi32((int)(XWORD)weights[t] | ((int)(XWORD)weights[t + 1] << 16));
+            lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), w));
+            hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), w));
+        }
+        if (t < taps) {
+            const __m256i a = _mm256_loadu_si256((const __m256i *)(rows[t] + c));
+            const __m256i w = _mm256_set1_epi32((int)(XWORD)weights[t]);
+            lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, zero), w));
+            hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, zero), w));
+        }
+        // Lane-wise unpack/pack restores channel order within each 128-bit lane.
+        const __m256i packed = _mm256_packs_epi32(_mm256_srai_epi32(lo, 20), _mm256_srai_epi32(hi, 20));
+        const __m256i bytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(packed, packed), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128((__m128i *)(out + c), _mm256_castsi256_si128(bytes));
+    }
+
+    ResampleVert_32_Scalar(rows, weights, taps, out, c, end);
+}
+
+// -- Mip chain filtering --------------------------------------------------
+
+void MipHorzPair_AVX2(const short *src, short *dst, int dstWidth, const short *weights) {
+    (void)weights;
+    int x = 0;
+    for (; x + 4 <= dstWidth; x += 4) {
+        // Per lane: pixels (0, 1) (2, 3) of a and (4, 5) (6, 7) of b. The averages come
+        // out as outputs 0 2 | 1 3 and are put back in order by the qword permute.
+        const __m256i a = _mm256_loadu_si256((const __m256i *)(src + x * 8));
+        const __m256i b = _mm256_loadu_si256((const __m256i *)(src + x * 8 + 16));
+        const __m256i avg = _mm256_avg_epu16(_mm256_unpacklo_epi64(a, b), _mm256_unpackhi_epi64(a, b));
+        _mm256_storeu_si256((__m256i *)(dst + x * 4), _mm256_permute4x64_epi64(avg, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+    MipHorzPair_Scalar(src, dst, x, dstWidth);
+}
+
+void MipVertPair_AVX2(const short *const *rows, const short *weights, short *dst, int count) {
+    (void)weights;
+    int c = 0;
+    for (; c + 16 <= count; c += 16) {
+        const __m256i a = _mm256_loadu_si256((const __m256i *)(rows[0] + c));
+        const __m256i b = _mm256_loadu_si256((const __m256i *)(rows[1] + c));
+        _mm256_storeu_si256((__m256i *)(dst + c), _mm256_avg_epu16(a, b));
+    }
+    MipVertPair_Scalar(rows, dst, c, count);
+}
+
+void MipVertThree_AVX2(const short *const *rows, const short *weights, short *dst, int count) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i round = _mm256_set1_epi32(16384);
+    const __m256i w01 = _mm256_set1_epi32((int)(XWORD)weights[0] | ((int)(XWORD)weights[1] << 16));
+    const __m256i w2 = _mm256_set1_epi32((int)(XWORD)weights[2]);
+    int c = 0;
+    for (; c + 16 <= count; c += 16) {
+        const __m256i r0 = _mm256_loadu_si256((const __m256i *)(rows[0] + c));
+        const __m256i r1 = _mm256_loadu_si256((const __m256i *)(rows[1] + c));
+        const __m256i r2 = _mm256_loadu_si256((const __m256i *)(rows[2] + c));
+        __m256i lo = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(r0, r1), w01),
+                                      _mm256_madd_epi16(_mm256_unpacklo_epi16(r2, zero), w2));
+        __m256i hi = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(r0, r1), w01),
+                                      _mm256_madd_epi16(_mm256_unpackhi_epi16(r2, zero), w2));
+        lo = _mm256_srai_epi32(_mm256_add_epi32(lo, round), 15);
+        hi = _mm256_srai_epi32(_mm256_add_epi32(hi, round), 15);
+        // In-lane pack keeps channel order: lane 0 holds 0..7, lane 1 holds 8..15.
+        _mm256_storeu_si256((__m256i *)(dst + c), _mm256_packs_epi32(lo, hi));
+    }
+    MipVertThree_Scalar(rows, weights, dst, c, count);
+}
+
+// Vertical pair sums of eight pixels -> per lane the 2x2 sums of two outputs
+// (0, 1 | 2, 3), rounded and scaled back to bytes.
+static inline __m256i MipBoxAverages_AVX2(const XBYTE *row0, const XBYTE *row1) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i a = _mm256_loadu_si256((const __m256i *)row0);
+    const __m256i b = _mm256_loadu_si256((const __m256i *)row1);
+    const __m256i lo = _mm256_add_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+    const __m256i hi = _mm256_add_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+    const __m256i sums = _mm256_add_epi16(_mm256_unpacklo_epi64(lo, hi), _mm256_unpackhi_epi64(lo, hi));
+    return _mm256_srli_epi16(_mm256_add_epi16(sums, _mm256_set1_epi16(2)), 2);
+}
+
+void MipBoxPair_AVX2(const XBYTE *row0, const XBYTE *row1, XBYTE *dst, int dstWidth) {
+    int x = 0;
+    for (; x + 8 <= dstWidth; x += 8) {
+        // Packing outputs 0 1 | 2 3 with 4 5 | 6 7 gives qwords 0 2 1 3.
+        const __m256i first = MipBoxAverages_AVX2(row0 + x * 8, row1 + x * 8);
+        const __m256i second = MipBoxAverages_AVX2(row0 + x * 8 + 32, row1 + x * 8 + 32);
+        const __m256i packed = _mm256_packus_epi16(first, second);
+        _mm256_storeu_si256((__m256i *)(dst + x * 4), _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+    MipBoxPair_Scalar(row0, row1, dst, x, dstWidth);
+}
+
+// -- Ordered dithering ----------------------------------------------------
+
+void DitherAdd_AVX2(const XBYTE *src, XBYTE *dst, int bytes, const XBYTE *pattern) {
+    // Two pattern periods per iteration: the stored copy makes all 96 bytes loadable.
+    const __m256i p0 = _mm256_loadu_si256((const __m256i *)pattern);
+    const __m256i p1 = _mm256_loadu_si256((const __m256i *)(pattern + 32));
+    const __m256i p2 = _mm256_loadu_si256((const __m256i *)(pattern + 64));
+    int i = 0;
+    for (; i + 2 * DITHER_PATTERN_PERIOD <= bytes; i += 2 * DITHER_PATTERN_PERIOD) {
+        const __m256i a = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i b = _mm256_loadu_si256((const __m256i *)(src + i + 32));
+        const __m256i c = _mm256_loadu_si256((const __m256i *)(src + i + 64));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_adds_epu8(a, p0));
+        _mm256_storeu_si256((__m256i *)(dst + i + 32), _mm256_adds_epu8(b, p1));
+        _mm256_storeu_si256((__m256i *)(dst + i + 64), _mm256_adds_epu8(c, p2));
+    }
+    DitherAdd_Scalar(src, dst, i, bytes, pattern);
+}
+
+// -- Compositing ------------------------------------------------------------
+
+static inline __m256i BlendDiv255_AVX2(__m256i x) {
+    x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+}
+
+static inline __m256i BlendBroadcastAlpha_AVX2(__m256i px16) {
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(px16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+// Straight SrcOver on four pixels widened to 16-bit lanes, as in the SSE2
+// kernel: each 128-bit half holds two pixels, so the factor rows pair up as
+// {0, 2} and {1, 3} in the order the pixels appear in the halves.
+static inline __m256i BlendSrcOver4_AVX2(__m256i s16, __m256i d16) {
+    const XWORD (*factors)[8] = g_SrcOverTable.factors16;
+    const __m256i alphaLane = _mm256_set1_epi64x((long long)0xFFFF000000000000ULL);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i sa = BlendBroadcastAlpha_AVX2(s16);
+    const __m256i wd = BlendDiv255_AVX2(
+        _mm256_mullo_epi16(BlendBroadcastAlpha_AVX2(d16), _mm256_xor_si256(sa, _mm256_set1_epi16(0xFF))));
+    const __m256i oa = _mm256_add_epi16(sa, wd);
+    const __m256i m = _mm256_add_epi16(
+        _mm256_add_epi16(_mm256_mullo_epi16(s16, sa), _mm256_mullo_epi16(d16, wd)), _mm256_srli_epi16(oa, 1));
+
+    const __m128i oaLo = _mm256_castsi256_si128(oa);
+    const __m128i oaHi = _mm256_extracti128_si256(oa, 1);
+    const __m256i f0 = UnpremultiplyFactors_AVX2(factors[_mm_extract_epi16(oaLo, 0)], factors[_mm_extract_epi16(oaHi, 0)]);
+    const __m256i f1 = UnpremultiplyFactors_AVX2(factors[_mm_extract_epi16(oaLo, 4)], factors[_mm_extract_epi16(oaHi, 4)]);
+    __m256i q = _mm256_add_epi16(_mm256_mullo_epi16(m, _mm256_unpacklo_epi64(f0, f1)),
+                                 _mm256_mulhi_epu16(m, _mm256_unpackhi_epi64(f0, f1)));
+    const __m256i over = _mm256_subs_epu16(_mm256_mullo_epi16(q, oa), m);
+    q = _mm256_sub_epi16(q, _mm256_andnot_si256(_mm256_cmpeq_epi16(over, zero), _mm256_set1_epi16(1)));
+    return _mm256_or_si256(_mm256_andnot_si256(alphaLane, q), _mm256_and_si256(alphaLane, oa));
+}
+
+void BlendSrcOver_32_AVX2(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i alphaMask = _mm256_set1_epi32((int)0xFF000000);
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *)(src + x));
+        const __m256i sa = _mm256_and_si256(s, alphaMask);
+        const __m256i transparent = _mm256_cmpeq_epi32(sa, zero);
+        if (_mm256_movemask_epi8(transparent) == -1) continue;
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(sa, alphaMask)) == -1) {
+            _mm256_storeu_si256((__m256i *)(dst + x), s);
+            continue;
+        }
+        const __m256i d = _mm256_loadu_si256((const __m256i *)(dst + x));
+        const __m256i res =
+            _mm256_packus_epi16(BlendSrcOver4_AVX2(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero)),
+                                BlendSrcOver4_AVX2(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero)));
+        _mm256_storeu_si256((__m256i *)(dst + x), _mm256_blendv_epi8(res, d, transparent));
+    }
+    BlendSrcOver_32_Scalar(src, dst, x, width);
+}
+
+void BlendSrcOverPremultiplied_32_AVX2(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i alphaMask = _mm256_set1_epi32((int)0xFF000000);
+    const __m256i lane255 = _mm256_set1_epi16(0xFF);
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *)(src + x));
+        const __m256i sa = _mm256_and_si256(s, alphaMask);
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(sa, alphaMask)) == -1) {
+            _mm256_storeu_si256((__m256i *)(dst + x), s);
+            continue;
+        }
+        const __m256i d = _mm256_loadu_si256((const __m256i *)(dst + x));
+        const __m256i invLo = _mm256_xor_si256(BlendBroadcastAlpha_AVX2(_mm256_unpacklo_epi8(s, zero)), lane255);
+        const __m256i invHi = _mm256_xor_si256(BlendBroadcastAlpha_AVX2(_mm256_unpackhi_epi8(s, zero)), lane255);
+        const __m256i dLo = BlendDiv255_AVX2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), invLo));
+        const __m256i dHi = BlendDiv255_AVX2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), invHi));
+        _mm256_storeu_si256((__m256i *)(dst + x), _mm256_adds_epu8(s, _mm256_packus_epi16(dLo, dHi)));
+    }
+    BlendSrcOverPremultiplied_32_Scalar(src, dst, x, width);
+}
+
+void BlendAdd_32_AVX2(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *)(src + x));
+        const __m256i d = _mm256_loadu_si256((const __m256i *)(dst + x));
+        _mm256_storeu_si256((__m256i *)(dst + x), _mm256_adds_epu8(s, d));
+    }
+    BlendAdd_32_Scalar(src, dst, x, width);
+}
+
+void BlendScreen_32_AVX2(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi32(-1);
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        const __m256i s = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(src + x)), ones);
+        const __m256i d = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(dst + x)), ones);
+        const __m256i lo =
+            BlendDiv255_AVX2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero)));
+        const __m256i hi =
+            BlendDiv255_AVX2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero)));
+        _mm256_storeu_si256((__m256i *)(dst + x), _mm256_xor_si256(_mm256_packus_epi16(lo, hi), ones));
+    }
+    BlendScreen_32_Scalar(src, dst, x, width);
+}
+
+void BlendLerp_32_AVX2(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+    const XDWORD factor = info->alphaValue;
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ws = _mm256_set1_epi16((short)factor);
+    const __m256i wd = _mm256_set1_epi16((short)(255 - factor));
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *)(src + x));
+        const __m256i d = _mm256_loadu_si256((const __m256i *)(dst + x));
+        const __m256i lo = BlendDiv255_AVX2(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), ws),
+                                                             _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), wd)));
+        const __m256i hi = BlendDiv255_AVX2(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), ws),
+                                                             _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), wd)));
+        _mm256_storeu_si256((__m256i *)(dst + x), _mm256_packus_epi16(lo, hi));
+    }
+    BlendLerp_32_Scalar(src, dst, x, width, factor);
+}
+
+// -- YUV conversion -------------------------------------------------------
+
+// Same PMADDWD pairing as the SSE2 kernels. Work stays inside 128-bit lanes;
+// widening with VPMOVZXBW keeps pixels 0-7 in the low lane and 8-15 in the
+// high one, and one lane permute restores pixel order on store.
+
+struct YUVDecodeConstants_AVX2 {
+    __m256i luma; // (yScale, 4096) pairs
+    __m256i toR;  // (0, vToR)
+    __m256i toG;  // (uToG, vToG)
+    __m256i toB;  // (uToB, 0)
+    __m256i lumaBias;
+    __m256i chromaBias;
+    __m256i one;
+    __m256i opaque;
+
+    explicit YUVDecodeConstants_AVX2(int matrix) {
+        const VxYUVCoefficients &k = g_YUVCoefficients[matrix];
+        luma = _mm256_set1_epi32((4096 << 16) | (XWORD)k.yScale);
+        toR = _mm256_set1_epi32(k.vToR << 16);
+        toG = _mm256_set1_epi32((k.vToG << 16) | (XWORD)k.uToG);
+        toB = _mm256_set1_epi32((XWORD)k.uToB);
+        lumaBias = _mm256_set1_epi16(16);
+        chromaBias = _mm256_set1_epi16(128);
+        one = _mm256_set1_epi16(1);
+        opaque = _mm256_set1_epi16(0xFF);
+    }
+};
+
+static inline __m256i YUVChannel_AVX2(__m256i luma, __m256i uv, __m256i weights) {
+    return _mm256_srai_epi32(_mm256_add_epi32(luma, _mm256_madd_epi16(uv, weights)), 13);
+}
+
+// Sixteen pixels from Y, U and V widened to 16 bits, one chroma value per pixel.
+static inline void DecodeYUV16_AVX2(XDWORD *dst, __m256i y, __m256i u, __m256i v, const YUVDecodeConstants_AVX2 &k) {
+    y = _mm256_sub_epi16(y, k.lumaBias);
+    u = _mm256_sub_epi16(u, k.chromaBias);
+    v = _mm256_sub_epi16(v, k.chromaBias);
+
+    const __m256i lumaLo = _mm256_madd_epi16(_mm256_unpacklo_epi16(y, k.one), k.luma);
+    const __m256i lumaHi = _mm256_madd_epi16(_mm256_unpackhi_epi16(y, k.one), k.luma);
+    const __m256i uvLo = _mm256_unpacklo_epi16(u, v);
+    const __m256i uvHi = _mm256_unpackhi_epi16(u, v);
+    const __m256i r =
+        _mm256_packs_epi32(YUVChannel_AVX2(lumaLo, uvLo, k.toR), YUVChannel_AVX2(lumaHi, uvHi, k.toR));
+    const __m256i g =
+        _mm256_packs_epi32(YUVChannel_AVX2(lumaLo, uvLo, k.toG), YUVChannel_AVX2(lumaHi, uvHi, k.toG));
+    const __m256i b =
+        _mm256_packs_epi32(YUVChannel_AVX2(lumaLo, uvLo, k.toB), YUVChannel_AVX2(lumaHi, uvHi, k.toB));
+
+    const __m256i br = _mm256_packus_epi16(b, r);
+    const __m256i ga = _mm256_packus_epi16(g, k.opaque);
+    const __m256i bg = _mm256_unpacklo_epi8(br, ga);
+    const __m256i ra = _mm256_unpackhi_epi8(br, ga);
+    const __m256i lo = _mm256_unpacklo_epi16(bg, ra); // pixels 0-3, 8-11
+    const __m256i hi = _mm256_unpackhi_epi16(bg, ra); // pixels 4-7, 12-15
+    _mm256_storeu_si256((__m256i *)dst, _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_storeu_si256((__m256i *)(dst + 8), _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+// [U0 V0 U1 V1 ...] words -> U and V for the same pixels, per lane.
+static inline void SplitChromaPairs_AVX2(__m256i pairs, __m256i &u, __m256i &v) {
+    u = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(pairs, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 2, 0, 0));
+    v = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(pairs, _MM_SHUFFLE(3, 3, 1, 1)), _MM_SHUFFLE(3, 3, 1, 1));
+}
+
+void DecodeYUVRow_I420_AVX2(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width, int matrix) {
+    const YUVDecodeConstants_AVX2 k(matrix);
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        const __m128i cb = _mm_loadl_epi64((const __m128i *)(u + x / 2));
+        const __m128i cr = _mm_loadl_epi64((const __m128i *)(v + x / 2));
+        DecodeYUV16_AVX2(dst + x, _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(y + x))),
+                         _mm256_cvtepu8_epi16(_mm_unpacklo_epi8(cb, cb)),
+                         _mm256_cvtepu8_epi16(_mm_unpacklo_epi8(cr, cr)), k);
+    }
+
+    DecodeYUVRow_I420_Scalar(y, u, v, dst, x, width, matrix);
+}
+
+void DecodeYUVRow_NV12_AVX2(const XBYTE *y, const XBYTE *u, const XBYTE *, XDWORD *dst, int width, int matrix) {
+    const YUVDecodeConstants_AVX2 k(matrix);
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        __m256i cb, cr;
+        SplitChromaPairs_AVX2(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(u + x))), cb, cr);
+        DecodeYUV16_AVX2(dst + x, _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(y + x))), cb, cr, k);
+    }
+
+    DecodeYUVRow_NV12_Scalar(y, u, dst, x, width, matrix);
+}
+
+void DecodeYUVRow_YUY2_AVX2(const XBYTE *y, const XBYTE *, const XBYTE *, XDWORD *dst, int width, int matrix) {
+    const YUVDecodeConstants_AVX2 k(matrix);
+    const __m256i lumaMask = _mm256_set1_epi16(0xFF);
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        const __m256i groups = _mm256_loadu_si256((const __m256i *)(y + x * 2));
+        __m256i cb, cr;
+        SplitChromaPairs_AVX2(_mm256_srli_epi16(groups, 8), cb, cr);
+        DecodeYUV16_AVX2(dst + x, _mm256_and_si256(groups, lumaMask), cb, cr, k);
+    }
+
+    DecodeYUVRow_YUY2_Scalar(y, dst, x, width, matrix);
+}
+
+struct YUVEncodeConstants_AVX2 {
+    __m256i toY; // (B, G, R, 0) weights per pixel
+    __m256i toU;
+    __m256i toV;
+    __m256i lumaBias;
+    __m256i chromaBias;
+    __m256i two;
+    __m256i groupOrder;
+
+    explicit YUVEncodeConstants_AVX2(int matrix) {
+        const VxYUVCoefficients &k = g_YUVCoefficients[matrix];
+        toY = _mm256_setr_epi16(k.toY[2], k.toY[1], k.toY[0], 0, k.toY[2], k.toY[1], k.toY[0], 0, k.toY[2], k.toY[1],
+                                k.toY[0], 0, k.toY[2], k.toY[1], k.toY[0], 0);
+        toU = _mm256_setr_epi16(k.toU[2], k.toU[1], k.toU[0], 0, k.toU[2], k.toU[1], k.toU[0], 0, k.toU[2], k.toU[1],
+                                k.toU[0], 0, k.toU[2], k.toU[1], k.toU[0], 0);
+        toV = _mm256_setr_epi16(k.toV[2], k.toV[1], k.toV[0], 0, k.toV[2], k.toV[1], k.toV[0], 0, k.toV[2], k.toV[1],
+                                k.toV[0], 0, k.toV[2], k.toV[1], k.toV[0], 0);
+        lumaBias = _mm256_set1_epi32(128 + (16 << 8));
+        chromaBias = _mm256_set1_epi32(128 + (128 << 8));
+        two = _mm256_set1_epi16(2);
+        groupOrder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    }
+};
+
+// Per lane: [a0 b0 a1 b1], [a2 b2 a3 b3] -> [a0 + b0, a1 + b1, a2 + b2, a3 + b3]
+static inline __m256i SumPairs_AVX2(__m256i m0, __m256i m1) {
+    const __m256 f0 = _mm256_castsi256_ps(m0);
+    const __m256 f1 = _mm256_castsi256_ps(m1);
+    return _mm256_add_epi32(_mm256_castps_si256(_mm256_shuffle_ps(f0, f1, _MM_SHUFFLE(2, 0, 2, 0))),
+                            _mm256_castps_si256(_mm256_shuffle_ps(f0, f1, _MM_SHUFFLE(3, 1, 3, 1))));
+}
+
+static inline __m256i WeightedSum_AVX2(__m256i lo, __m256i hi, __m256i weights, __m256i bias) {
+    return _mm256_srli_epi32(
+        _mm256_add_epi32(SumPairs_AVX2(_mm256_madd_epi16(lo, weights), _mm256_madd_epi16(hi, weights)), bias), 8);
+}
+
+// Luma of eight pixels, in pixel order.
+static inline __m256i EncodeLuma8_AVX2(__m256i pixels, const YUVEncodeConstants_AVX2 &k) {
+    const __m256i zero = _mm256_setzero_si256();
+    return WeightedSum_AVX2(_mm256_unpacklo_epi8(pixels, zero), _mm256_unpackhi_epi8(pixels, zero), k.toY,
+                            k.lumaBias);
+}
+
+// 2x2 channel averages of eight pixels from each row: samples 0-1 in the low
+// lane and 2-3 in the high lane, 16-bit BGRA.
+static inline __m256i AverageQuads_AVX2(__m256i row0, __m256i row1, const YUVEncodeConstants_AVX2 &k) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lo = _mm256_add_epi16(_mm256_unpacklo_epi8(row0, zero), _mm256_unpacklo_epi8(row1, zero));
+    const __m256i hi = _mm256_add_epi16(_mm256_unpackhi_epi8(row0, zero), _mm256_unpackhi_epi8(row1, zero));
+    const __m256i sum = _mm256_add_epi16(_mm256_unpacklo_epi64(lo, hi), _mm256_unpackhi_epi64(lo, hi));
+    return _mm256_srli_epi16(_mm256_add_epi16(sum, k.two), 2);
+}
+
+// Chroma of the 2x2 blocks of sixteen pixels from each row, in sample order.
+static inline __m256i EncodeChroma8_AVX2(__m256i avg0, __m256i avg1, __m256i weights, const YUVEncodeConstants_AVX2 &k) {
+    // Per lane the sums come out as [0 1 4 5] and [2 3 6 7].
+    return _mm256_permute4x64_epi64(WeightedSum_AVX2(avg0, avg1, weights, k.chromaBias), _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+// Encodes thirty-two pixels of two rows: luma to y0/y1, sixteen U and V values
+// to cb/cr as 16-bit words, samples 0-3 and 8-11 in the low lane.
+static inline void EncodeYUV32_AVX2(const XDWORD *src0, const XDWORD *src1, XBYTE *y0, XBYTE *y1, __m256i &cb,
+                                    __m256i &cr, const YUVEncodeConstants_AVX2 &k) {
+    __m256i avg[4];
+    __m256i luma0[4];
+    __m256i luma1[4];
+    for (int i = 0; i < 4; ++i) {
+        const __m256i p0 = _mm256_loadu_si256((const __m256i *)(src0 + i * 8));
+        const __m256i p1 = _mm256_loadu_si256((const __m256i *)(src1 + i * 8));
+        luma0[i] = EncodeLuma8_AVX2(p0, k);
+        luma1[i] = EncodeLuma8_AVX2(p1, k);
+        avg[i] = AverageQuads_AVX2(p0, p1, k);
+    }
+    // In-lane packs leave 4-pixel groups in the order 0 2 4 6 1 3 5 7.
+    _mm256_storeu_si256((__m256i *)y0,
+                        _mm256_permutevar8x32_epi32(_mm256_packus_epi16(_mm256_packs_epi32(luma0[0], luma0[1]),
+                                                                        _mm256_packs_epi32(luma0[2], luma0[3])),
+                                                    k.groupOrder));
+    _mm256_storeu_si256((__m256i *)y1,
+                        _mm256_permutevar8x32_epi32(_mm256_packus_epi16(_mm256_packs_epi32(luma1[0], luma1[1]),
+                                                                        _mm256_packs_epi32(luma1[2], luma1[3])),
+                                                    k.groupOrder));
+
+    cb = _mm256_packs_epi32(EncodeChroma8_AVX2(avg[0], avg[1], k.toU, k),
+                            EncodeChroma8_AVX2(avg[2], avg[3], k.toU, k));
+    cr = _mm256_packs_epi32(EncodeChroma8_AVX2(avg[0], avg[1], k.toV, k),
+                            EncodeChroma8_AVX2(avg[2], avg[3], k.toV, k));
+}
+
+void EncodeYUVRows_I420_AVX2(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1, XBYTE *u,
+                             XBYTE *v, int matrix) {
+    const YUVEncodeConstants_AVX2 k(matrix);
+    int x = 0;
+
+    for (; x + 32 <= width; x += 32) {
+        __m256i cb, cr;
+        EncodeYUV32_AVX2(src0 + x, src1 + x, y0 + x, y1 + x, cb, cr, k);
+        // Bytes per lane: U 0-3 8-11 V 0-3 8-11 | U 4-7 12-15 V 4-7 12-15.
+        const __m256i chroma = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(cb, cr), k.groupOrder);
+        _mm_storeu_si128((__m128i *)(u + x / 2), _mm256_castsi256_si128(chroma));
+        _mm_storeu_si128((__m128i *)(v + x / 2), _mm256_extracti128_si256(chroma, 1));
+    }
+
+    EncodeYUVRows_Scalar(src0, src1, x, width, y0, y1, u, v, 1, matrix);
+}
+
+void EncodeYUVRows_NV12_AVX2(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1, XBYTE *u,
+                             XBYTE *, int matrix) {
+    const YUVEncodeConstants_AVX2 k(matrix);
+    int x = 0;
+
+    for (; x + 32 <= width; x += 32) {
+        __m256i cb, cr;
+        EncodeYUV32_AVX2(src0 + x, src1 + x, y0 + x, y1 + x, cb, cr, k);
+        // Pairs per lane: 0-3 8-11 | 4-7 12-15.
+        const __m256i pairs = _mm256_packus_epi16(_mm256_unpacklo_epi16(cb, cr), _mm256_unpackhi_epi16(cb, cr));
+        _mm256_storeu_si256((__m256i *)(u + x), _mm256_permute4x64_epi64(pairs, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+
+    EncodeYUVRows_Scalar(src0, src1, x, width, y0, y1, u, u + 1, 2, matrix);
+}
+
+
+// -- Normal and bump maps -------------------------------------------------
+//
+// Eight columns per iteration, same integer sums and true square root and
+// division as the SSE2 kernels, so the output matches the scalar kernels.
+
+void HeightRowLuminance_AVX2(const XDWORD *src, int *dst, int width, XDWORD, int) {
+    const __m256i byteMask = _mm256_set1_epi32(0xFF);
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        const __m256i p = _mm256_loadu_si256((const __m256i *)(src + x));
+        const __m256i b = _mm256_and_si256(p, byteMask);
+        const __m256i g = _mm256_and_si256(_mm256_srli_epi32(p, 8), byteMask);
+        const __m256i r = _mm256_and_si256(_mm256_srli_epi32(p, 16), byteMask);
+        _mm256_storeu_si256((__m256i *)(dst + x), _mm256_add_epi32(_mm256_add_epi32(b, g), r));
+    }
+
+    HeightRowLuminance_Scalar(src, dst, x, width);
+}
+
+void HeightRowMasked_AVX2(const XDWORD *src, int *dst, int width, XDWORD mask, int shift) {
+    const __m256i channel = _mm256_set1_epi32((int)mask);
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        const __m256i p = _mm256_loadu_si256((const __m256i *)(src + x));
+        _mm256_storeu_si256((__m256i *)(dst + x), _mm256_srl_epi32(_mm256_and_si256(p, channel), count));
+    }
+
+    HeightRowMasked_Scalar(src, dst, x, width, mask, shift);
+}
+
+static inline __m256i LoadHeights_AVX2(const int *row, int x) {
+    return _mm256_loadu_si256((const __m256i *)(row + x));
+}
+
+// (1, 2, 1) or (3, 10, 3) smoothing of three differences.
+template <int Filter>
+static inline __m256i Smooth3_AVX2(__m256i outer0, __m256i center, __m256i outer1) {
+    const __m256i outer = _mm256_add_epi32(outer0, outer1);
+    if (Filter == VX_GRADIENTFILTER_SOBEL) {
+        return _mm256_add_epi32(outer, _mm256_slli_epi32(center, 1));
+    }
+    return _mm256_add_epi32(_mm256_add_epi32(outer, _mm256_slli_epi32(outer, 1)),
+                            _mm256_add_epi32(_mm256_slli_epi32(center, 3), _mm256_slli_epi32(center, 1)));
+}
+
+// Gradient sums of columns x..x+7; x - 1 and x + 8 must be inside the row.
+template <int Filter>
+static inline void GradientSums_AVX2(const int *a, const int *c, const int *b, int x, __m256i &gx, __m256i &gy) {
+    if (Filter == VX_GRADIENTFILTER_CENTRAL) {
+        gx = _mm256_sub_epi32(LoadHeights_AVX2(c, x + 1), LoadHeights_AVX2(c, x - 1));
+        gy = _mm256_sub_epi32(LoadHeights_AVX2(b, x), LoadHeights_AVX2(a, x));
+        return;
+    }
+    const __m256i al = LoadHeights_AVX2(a, x - 1), am = LoadHeights_AVX2(a, x), ar = LoadHeights_AVX2(a, x + 1);
+    const __m256i cl = LoadHeights_AVX2(c, x - 1), cr = LoadHeights_AVX2(c, x + 1);
+    const __m256i bl = LoadHeights_AVX2(b, x - 1), bm = LoadHeights_AVX2(b, x), br = LoadHeights_AVX2(b, x + 1);
+    gx = Smooth3_AVX2<Filter>(_mm256_sub_epi32(ar, al), _mm256_sub_epi32(cr, cl), _mm256_sub_epi32(br, bl));
+    gy = Smooth3_AVX2<Filter>(_mm256_sub_epi32(bl, al), _mm256_sub_epi32(bm, am), _mm256_sub_epi32(br, ar));
+}
+
+static inline __m256i NormalChannel_AVX2(__m256 n, __m256 scale127, __m256 offset128) {
+    return _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(n, scale127), offset128));
+}
+
+static inline void PackNormals_AVX2(XDWORD *dst, __m256 dx, __m256 dy, __m256 height) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 scale127 = _mm256_set1_ps(127.0f);
+    const __m256 offset128 = _mm256_set1_ps(128.0f);
+
+    const __m256 lenSq = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), one);
+    const __m256 invLen = _mm256_div_ps(one, _mm256_sqrt_ps(lenSq));
+    const __m256i nx = NormalChannel_AVX2(_mm256_mul_ps(dx, invLen), scale127, offset128);
+    const __m256i ny = NormalChannel_AVX2(_mm256_mul_ps(dy, invLen), scale127, offset128);
+    const __m256i nz = NormalChannel_AVX2(invLen, scale127, offset128);
+    const __m256i alpha = _mm256_cvttps_epi32(_mm256_mul_ps(height, _mm256_set1_ps(-255.0f)));
+
+    __m256i packed = _mm256_sub_epi32(nx, _mm256_slli_epi32(alpha, 8));
+    packed = _mm256_add_epi32(_mm256_slli_epi32(packed, 8), ny);
+    packed = _mm256_add_epi32(_mm256_slli_epi32(packed, 8), nz);
+    _mm256_storeu_si256((__m256i *)dst, packed);
+}
+
+template <int Filter>
+static void NormalMapRowT_AVX2(const int *const *rows, XDWORD *dst, int width, float scale) {
+    const int *a = rows[0];
+    const int *c = rows[1];
+    const int *b = rows[2];
+    const __m256 heightScale = _mm256_set1_ps(scale);
+    const __m256 gradientScale = _mm256_set1_ps(scale * GradientNormalScale(Filter));
+    int x = 1;
+
+    NormalMapRow_Scalar(rows, dst, 0, XMin(1, width), width, scale, Filter);
+    for (; x + 9 <= width; x += 8) {
+        const __m256 h0 = _mm256_mul_ps(_mm256_cvtepi32_ps(LoadHeights_AVX2(c, x)), heightScale);
+        __m256 dx, dy;
+        if (Filter == VX_GRADIENTFILTER_DEFAULT) {
+            dx = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(LoadHeights_AVX2(c, x + 1)), heightScale), h0);
+            dy = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(LoadHeights_AVX2(b, x)), heightScale), h0);
+        } else {
+            __m256i gx, gy;
+            GradientSums_AVX2<Filter>(a, c, b, x, gx, gy);
+            dx = _mm256_mul_ps(_mm256_cvtepi32_ps(gx), gradientScale);
+            dy = _mm256_mul_ps(_mm256_cvtepi32_ps(gy), gradientScale);
+        }
+        PackNormals_AVX2(dst + x, dx, dy, h0);
+    }
+    NormalMapRow_Scalar(rows, dst, x, width, width, scale, Filter);
+}
+
+void NormalMapRow_AVX2(const int *const *rows, XDWORD *dst, int width, float scale, int filter) {
+    switch (filter) {
+        case VX_GRADIENTFILTER_CENTRAL: NormalMapRowT_AVX2<VX_GRADIENTFILTER_CENTRAL>(rows, dst, width, scale); break;
+        case VX_GRADIENTFILTER_SOBEL: NormalMapRowT_AVX2<VX_GRADIENTFILTER_SOBEL>(rows, dst, width, scale); break;
+        case VX_GRADIENTFILTER_SCHARR: NormalMapRowT_AVX2<VX_GRADIENTFILTER_SCHARR>(rows, dst, width, scale); break;
+        default: NormalMapRowT_AVX2<VX_GRADIENTFILTER_DEFAULT>(rows, dst, width, scale); break;
+    }
+}
+
+template <int Filter>
+static void BumpMapRowT_AVX2(const int *const *rows, XDWORD *dst, int width) {
+    const int *a = rows[0];
+    const int *c = rows[1];
+    const int *b = rows[2];
+    const __m128i shift = _mm_cvtsi32_si128(GradientBumpShift(Filter));
+    const __m256i bias = _mm256_set1_epi32((1 << GradientBumpShift(Filter)) >> 1);
+    const __m256i byteMask = _mm256_set1_epi32(0xFF);
+    const __m256i dark = _mm256_set1_epi32(1);
+    const __m256i flagDark = _mm256_set1_epi32(127);
+    const __m256i flagToggle = _mm256_set1_epi32(127 ^ 63);
+    int x = 1;
+
+    // Column 0 wraps (and carries the original first-column terms).
+    BumpMapRow_Scalar(rows, dst, 0, 1, width, Filter);
+    for (; x + 9 <= width; x += 8) {
+        __m256i gx, gy;
+        GradientSums_AVX2<Filter == VX_GRADIENTFILTER_DEFAULT ? VX_GRADIENTFILTER_CENTRAL : Filter>(a, c, b, x, gx,
+                                                                                                     gy);
+        const __m256i du = _mm256_and_si256(_mm256_sra_epi32(_mm256_sub_epi32(bias, gy), shift), byteMask);
+        const __m256i dv = _mm256_and_si256(_mm256_sra_epi32(_mm256_sub_epi32(bias, gx), shift), byteMask);
+        const __m256i bright = _mm256_cmpgt_epi32(LoadHeights_AVX2(c, x), dark);
+        const __m256i flag = _mm256_xor_si256(flagDark, _mm256_and_si256(bright, flagToggle));
+        const __m256i packed =
+            _mm256_or_si256(flag, _mm256_or_si256(_mm256_slli_epi32(du, 8), _mm256_slli_epi32(dv, 16)));
+        _mm256_storeu_si256((__m256i *)(dst + x), packed);
+    }
+    BumpMapRow_Scalar(rows, dst, x, width, width, Filter);
+}
+
+void BumpMapRow_AVX2(const int *const *rows, XDWORD *dst, int width, int filter) {
+    switch (filter) {
+        case VX_GRADIENTFILTER_CENTRAL: BumpMapRowT_AVX2<VX_GRADIENTFILTER_CENTRAL>(rows, dst, width); break;
+        case VX_GRADIENTFILTER_SOBEL: BumpMapRowT_AVX2<VX_GRADIENTFILTER_SOBEL>(rows, dst, width); break;
+        case VX_GRADIENTFILTER_SCHARR: BumpMapRowT_AVX2<VX_GRADIENTFILTER_SCHARR>(rows, dst, width); break;
+        default: BumpMapRowT_AVX2<VX_GRADIENTFILTER_DEFAULT>(rows, dst, width); break;
+    }
+}
+
 #endif // VX_SIMD_AVX2
@@ -0,0 +1,617 @@
+// =========================================================================
+// VxBlitEngineAVX512.cpp -- AVX-512 SIMD blit kernels (runtime-dispatched)
+//
+// Part of VxBlitEngine. Compiled only when VX_SIMD_AVX512 is defined.
+// Built with /arch:AVX512 (MSVC) or -mavx512f;-mavx512bw;-mavx512vl;
+// -mavx512vbmi (GCC/Clang); installed only when the CPU reports all four.
+// Row tails use masked loads and stores instead of _Scalar() helpers, so
+// nothing outside the row is read or written.
+// =========================================================================
+
+#include "VxBlitInternal.h"
+
+#if defined(VX_SIMD_AVX512)
+
+#include <cstdint>
+#include <immintrin.h>
+
+static inline __mmask16 TailMask16_AVX512(int count) {
+    return (__mmask16)((1u << count) - 1u);
+}
+
+static inline __mmask32 TailMask32_AVX512(int count) {
+    return (__mmask32)((1ull << count) - 1ull);
+}
+
+static inline __mmask64 TailMask64_AVX512(int count) {
+    return (count >= 64) ? ~(__mmask64)0 : (((__mmask64)1 << count) - 1);
+}
+
+static inline __m512i Or3_AVX512(__m512i a, __m512i b, __m512i c) {
+    return _mm512_ternarylogic_epi32(a, b, c, 0xFE);
+}
+
+// 256-entry byte table lookup: bits 0-6 of each index select a byte from one
+// 128-byte half with VPERMI2B, bit 7 picks the half.
+static inline __m512i Lookup256_AVX512(__m512i idx, const __m512i table[4]) {
+    const __m512i lo = _mm512_permutex2var_epi8(table[0], idx, table[1]);
+    const __m512i hi = _mm512_permutex2var_epi8(table[2], idx, table[3]);
+    return _mm512_mask_blend_epi8(_mm512_movepi8_mask(idx), lo, hi);
+}
+
+static inline void LoadTable256_AVX512(const XBYTE *bytes, __m512i table[4]) {
+    for (int i = 0; i < 4; ++i) {
+        table[i] = _mm512_loadu_si512((const void *)(bytes + i * 64));
+    }
+}
+
+// Byte i of 16 packed 24-bit pixels comes from byte (i / 3) * 4 + i % 3 of
+// 16 32-bit pixels, and the other way round for unpacking.
+static const XBYTE kPack32To24_AVX512[64] = {
+    0,  1,  2,  4,  5,  6,  8,  9,  10, 12, 13, 14, 16, 17, 18, 20,
+    21, 22, 24, 25, 26, 28, 29, 30, 32, 33, 34, 36, 37, 38, 40, 41,
+    42, 44, 45, 46, 48, 49, 50, 52, 53, 54, 56, 57, 58, 60, 61, 62,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+static const XBYTE kUnpack24To32_AVX512[64] = {
+    0,  1,  2,  0, 3,  4,  5,  0, 6,  7,  8,  0, 9,  10, 11, 0,
+    12, 13, 14, 0, 15, 16, 17, 0, 18, 19, 20, 0, 21, 22, 23, 0,
+    24, 25, 26, 0, 27, 28, 29, 0, 30, 31, 32, 0, 33, 34, 35, 0,
+    36, 37, 38, 0, 39, 40, 41, 0, 42, 43, 44, 0, 45, 46, 47, 0,
+};
+static const __mmask64 kBytes48_AVX512 = 0x0000FFFFFFFFFFFFull;
+static const __mmask64 kColorBytes_AVX512 = 0x7777777777777777ull;
+
+// -- 32<->32 format conversions --------------------------------------------
+
+void CopyLine_32ARGB_32RGB_AVX512(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    const __m512i mask = _mm512_set1_epi32(0x00FFFFFF);
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m512i pixels = _mm512_loadu_si512((const void *)(src + x));
+        _mm512_storeu_si512((void *)(dst + x), _mm512_and_si512(pixels, mask));
+    }
+    if (x < width) {
+        const __mmask16 tail = TailMask16_AVX512(width - x);
+        const __m512i pixels = _mm512_maskz_loadu_epi32(tail, src + x);
+        _mm512_mask_storeu_epi32(dst + x, tail, _mm512_and_si512(pixels, mask));
+    }
+}
+
+void CopyLine_24RGB_32ARGB_AVX512(const VxBlitInfo *info) {
+    const XBYTE *src = info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    const __m512i unpack = _mm512_loadu_si512((const void *)kUnpack24To32_AVX512);
+    const __m512i alpha = _mm512_set1_epi32(0xFF000000);
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m512i bytes = _mm512_maskz_loadu_epi8(kBytes48_AVX512, src + x * 3);
+        _mm512_storeu_si512((void *)(dst + x),
+                            _mm512_mask_permutexvar_epi8(alpha, kColorBytes_AVX512, unpack, bytes));
+    }
+    if (x < width) {
+        const int count = width - x;
+        const __m512i bytes = _mm512_maskz_loadu_epi8(TailMask64_AVX512(count * 3), src + x * 3);
+        _mm512_mask_storeu_epi32(dst + x, TailMask16_AVX512(count),
+                                 _mm512_mask_permutexvar_epi8(alpha, kColorBytes_AVX512, unpack, bytes));
+    }
+}
+
+// -- Channel swap conversions ---------------------------------------------
+
+// Applies the same in-lane byte shuffle to every pixel of the row.
+static inline void ShuffleLine32_AVX512(const VxBlitInfo *info, const __m512i order) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m512i pixels = _mm512_loadu_si512((const void *)(src + x));
+        _mm512_storeu_si512((void *)(dst + x), _mm512_shuffle_epi8(pixels, order));
+    }
+    if (x < width) {
+        const __mmask16 tail = TailMask16_AVX512(width - x);
+        const __m512i pixels = _mm512_maskz_loadu_epi32(tail, src + x);
+        _mm512_mask_storeu_epi32(dst + x, tail, _mm512_shuffle_epi8(pixels, order));
+    }
+}
+
+void CopyLine_32ARGB_32ABGR_AVX512(const VxBlitInfo *info) {
+    ShuffleLine32_AVX512(info, _mm512_broadcast_i32x4(
+                                   _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15)));
+}
+
+void CopyLine_32ABGR_32ARGB_AVX512(const VxBlitInfo *info) {
+    CopyLine_32ARGB_32ABGR_AVX512(info);
+}
+
+void CopyLine_32ARGB_32RGBA_AVX512(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m512i pixels = _mm512_loadu_si512((const void *)(src + x));
+        _mm512_storeu_si512((void *)(dst + x), _mm512_rol_epi32(pixels, 8));
+    }
+    if (x < width) {
+        const __mmask16 tail = TailMask16_AVX512(width - x);
+        const __m512i pixels = _mm512_maskz_loadu_epi32(tail, src + x);
+        _mm512_mask_storeu_epi32(dst + x, tail, _mm512_rol_epi32(pixels, 8));
+    }
+}
+
+void CopyLine_32RGBA_32ARGB_AVX512(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m512i pixels = _mm512_loadu_si512((const void *)(src + x));
+        _mm512_storeu_si512((void *)(dst + x), _mm512_ror_epi32(pixels, 8));
+    }
+    if (x < width) {
+        const __mmask16 tail = TailMask16_AVX512(width - x);
+        const __m512i pixels = _mm512_maskz_loadu_epi32(tail, src + x);
+        _mm512_mask_storeu_epi32(dst + x, tail, _mm512_ror_epi32(pixels, 8));
+    }
+}
+
+void CopyLine_32ARGB_32BGRA_AVX512(const VxBlitInfo *info) {
+    ShuffleLine32_AVX512(info, _mm512_broadcast_i32x4(
+                                   _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)));
+}
+
+void CopyLine_32BGRA_32ARGB_AVX512(const VxBlitInfo *info) {
+    CopyLine_32ARGB_32BGRA_AVX512(info);
+}
+
+// -- Paletted conversion --------------------------------------------------
+
+// Converted palettes split into byte planes of 256 entries, so that each
+// plane is looked up with Lookup256_AVX512. Rebuilt under the same key as the
+// palette they come from.
+struct PalettePlanes_AVX512 {
+    const XBYTE *colorMap;
+    int bytesPerEntry;
+    int entries;
+    XDWORD operationStamp;
+    XDWORD dstMasks[4];
+    XBYTE planes[4][256];
+};
+
+static const PalettePlanes_AVX512 &SplitPalette_AVX512(PalettePlanes_AVX512 &cache, const VxBlitInfo *info,
+                                                        const XDWORD *colors, int planeCount) {
+    const XDWORD dstMasks[4] = {info->dstRedMask, info->dstGreenMask, info->dstBlueMask, info->dstAlphaMask};
+    if (info->operationStamp != 0 &&
+        cache.operationStamp == info->operationStamp &&
+        cache.colorMap == info->colorMap &&
+        cache.bytesPerEntry == info->bytesPerColorEntry &&
+        cache.entries == info->colorMapEntries &&
+        memcmp(cache.dstMasks, dstMasks, sizeof(dstMasks)) == 0) {
+        return cache;
+    }
+
+    for (int i = 0; i < 256; i += 16) {
+        const __m512i entries = _mm512_loadu_si512((const void *)(colors + i));
+        for (int k = 0; k < planeCount; ++k) {
+            _mm_storeu_si128((__m128i *)(cache.planes[k] + i),
+                             _mm512_cvtepi32_epi8(_mm512_srli_epi32(entries, 8 * k)));
+        }
+    }
+    cache.colorMap = info->colorMap;
+    cache.bytesPerEntry = info->bytesPerColorEntry;
+    cache.entries = info->colorMapEntries;
+    cache.operationStamp = info->operationStamp;
+    memcpy(cache.dstMasks, dstMasks, sizeof(dstMasks));
+    return cache;
+}
+
+// Looks up 64 indices in the four ARGB planes. The indices are first
+// transposed as 4x4 groups of four so that the in-lane unpacks leave
+// pixels 16k..16k+15 in colors[k].
+static inline void LookupARGB64_AVX512(__m512i idx, const __m512i planes[4][4], __m512i colors[4]) {
+    idx = _mm512_permutexvar_epi32(_mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15), idx);
+    const __m512i b = Lookup256_AVX512(idx, planes[0]);
+    const __m512i g = Lookup256_AVX512(idx, planes[1]);
+    const __m512i r = Lookup256_AVX512(idx, planes[2]);
+    const __m512i a = Lookup256_AVX512(idx, planes[3]);
+    const __m512i bgLo = _mm512_unpacklo_epi8(b, g);
+    const __m512i bgHi = _mm512_unpackhi_epi8(b, g);
+    const __m512i raLo = _mm512_unpacklo_epi8(r, a);
+    const __m512i raHi = _mm512_unpackhi_epi8(r, a);
+    colors[0] = _mm512_unpacklo_epi16(bgLo, raLo);
+    colors[1] = _mm512_unpackhi_epi16(bgLo, raLo);
+    colors[2] = _mm512_unpacklo_epi16(bgHi, raHi);
+    colors[3] = _mm512_unpackhi_epi16(bgHi, raHi);
+}
+
+static inline void LoadARGBPlanes_AVX512(const VxBlitInfo *info, __m512i planes[4][4]) {
+    thread_local PalettePlanes_AVX512 cache = {};
+    const PalettePlanes_AVX512 &split = SplitPalette_AVX512(cache, info, GetPaletteARGB(info), 4);
+    for (int k = 0; k < 4; ++k) {
+        LoadTable256_AVX512(split.planes[k], planes[k]);
+    }
+}
+
+void CopyLine_Paletted8_32ARGB_AVX512(const VxBlitInfo *info) {
+    const XBYTE *src = info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    if (!info->colorMap) {
+        return;
+    }
+    __m512i planes[4][4];
+    LoadARGBPlanes_AVX512(info, planes);
+
+    __m512i colors[4];
+    int x = 0;
+    for (; x + 64 <= width; x += 64) {
+        LookupARGB64_AVX512(_mm512_loadu_si512((const void *)(src + x)), planes, colors);
+        for (int k = 0; k < 4; ++k) {
+            _mm512_storeu_si512((void *)(dst + x + k * 16), colors[k]);
+        }
+    }
+    if (x < width) {
+        const int count = width - x;
+        LookupARGB64_AVX512(_mm512_maskz_loadu_epi8(TailMask64_AVX512(count), src + x), planes, colors);
+        for (int k = 0; k * 16 < count; ++k) {
+            _mm512_mask_storeu_epi32(dst + x + k * 16, TailMask16_AVX512(XMin(16, count - k * 16)), colors[k]);
+        }
+    }
+}
+
+void CopyLine_Paletted8_24RGB_AVX512(const VxBlitInfo *info) {
+    const XBYTE *src = info->srcLine;
+    XBYTE *dst = info->dstLine;
+    const int width = info->width;
+
+    if (!info->colorMap) {
+        return;
+    }
+    __m512i planes[4][4];
+    LoadARGBPlanes_AVX512(info, planes);
+    const __m512i pack = _mm512_loadu_si512((const void *)kPack32To24_AVX512);
+
+    __m512i colors[4];
+    int x = 0;
+    for (; x + 64 <= width; x += 64) {
+        LookupARGB64_AVX512(_mm512_loadu_si512((const void *)(src + x)), planes, colors);
+        for (int k = 0; k < 4; ++k) {
+            _mm512_mask_storeu_epi8(dst + (x + k * 16) * 3, kBytes48_AVX512,
+                                    _mm512_permutexvar_epi8(pack, colors[k]));
+        }
+    }
+    if (x < width) {
+        const int count = width - x;
+        LookupARGB64_AVX512(_mm512_maskz_loadu_epi8(TailMask64_AVX512(count), src + x), planes, colors);
+        for (int k = 0; k * 16 < count; ++k) {
+            _mm512_mask_storeu_epi8(dst + (x + k * 16) * 3, TailMask64_AVX512(XMin(16, count - k * 16) * 3),
+                                    _mm512_permutexvar_epi8(pack, colors[k]));
+        }
+    }
+}
+
+// Low and high bytes of 64 16-bit colors; the indices are interleaved as
+// groups of eight so that the in-lane unpacks keep pixels in order.
+static inline void Lookup16x64_AVX512(__m512i idx, const __m512i planes[2][4], __m512i colors[2]) {
+    idx = _mm512_permutexvar_epi64(_mm512_setr_epi64(0, 4, 1, 5, 2, 6, 3, 7), idx);
+    const __m512i lo = Lookup256_AVX512(idx, planes[0]);
+    const __m512i hi = Lookup256_AVX512(idx, planes[1]);
+    colors[0] = _mm512_unpacklo_epi8(lo, hi);
+    colors[1] = _mm512_unpackhi_epi8(lo, hi);
+}
+
+void CopyLine_Paletted8_16_AVX512(const VxBlitInfo *info) {
+    const XBYTE *src = info->srcLine;
+    XWORD *dst = (XWORD *)info->dstLine;
+    const int width = info->width;
+
+    if (!info->colorMap) {
+        return;
+    }
+    thread_local PalettePlanes_AVX512 cache = {};
+    const PalettePlanes_AVX512 &split = SplitPalette_AVX512(cache, info, GetPalette16(info), 2);
+    __m512i planes[2][4];
+    LoadTable256_AVX512(split.planes[0], planes[0]);
+    LoadTable256_AVX512(split.planes[1], planes[1]);
+
+    __m512i colors[2];
+    int x = 0;
+    for (; x + 64 <= width; x += 64) {
+        Lookup16x64_AVX512(_mm512_loadu_si512((const void *)(src + x)), planes, colors);
+        _mm512_storeu_si512((void *)(dst + x), colors[0]);
+        _mm512_storeu_si512((void *)(dst + x + 32), colors[1]);
+    }
+    if (x < width) {
+        const int count = width - x;
+        Lookup16x64_AVX512(_mm512_maskz_loadu_epi8(TailMask64_AVX512(count), src + x), planes, colors);
+        _mm512_mask_storeu_epi16(dst + x, TailMask32_AVX512(XMin(32, count)), colors[0]);
+        if (count > 32) {
+            _mm512_mask_storeu_epi16(dst + x + 32, TailMask32_AVX512(count - 32), colors[1]);
+        }
+    }
+}
+
+void CopyLine_Paletted8_8_AVX512(const VxBlitInfo *info) {
+    const XBYTE *remap = info->colorMap ? GetPaletteRemap(info) : nullptr;
+    if (!remap) {
+        memcpy(info->dstLine, info->srcLine, info->width);
+        return;
+    }
+
+    const XBYTE *src = info->srcLine;
+    XBYTE *dst = info->dstLine;
+    const int width = info->width;
+
+    __m512i table[4];
+    LoadTable256_AVX512(remap, table);
+
+    int x = 0;
+    for (; x + 64 <= width; x += 64) {
+        const __m512i idx = _mm512_loadu_si512((const void *)(src + x));
+        _mm512_storeu_si512((void *)(dst + x), Lookup256_AVX512(idx, table));
+    }
+    if (x < width) {
+        const __mmask64 tail = TailMask64_AVX512(width - x);
+        const __m512i idx = _mm512_maskz_loadu_epi8(tail, src + x);
+        _mm512_mask_storeu_epi8(dst + x, tail, Lookup256_AVX512(idx, table));
+    }
+}
+
+// -- 32<->16 format conversions --------------------------------------------
+
+// Packs 16 32-bit pixels with @p convert and narrows them to 16 bits.
+template <typename Convert>
+static inline void PackLine16_AVX512(const VxBlitInfo *info, Convert convert) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XWORD *dst = (XWORD *)info->dstLine;
+    const int width = info->width;
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m512i pixels = _mm512_loadu_si512((const void *)(src + x));
+        _mm256_storeu_si256((__m256i *)(dst + x), _mm512_cvtepi32_epi16(convert(pixels)));
+    }
+    if (x < width) {
+        const __mmask16 tail = TailMask16_AVX512(width - x);
+        const __m512i pixels = _mm512_maskz_loadu_epi32(tail, src + x);
+        _mm512_mask_cvtepi32_storeu_epi16(dst + x, tail, convert(pixels));
+    }
+}
+
+// Widens 16 16-bit pixels to 32 bits and expands them with @p convert.
+template <typename Convert>
+static inline void UnpackLine16_AVX512(const VxBlitInfo *info, Convert convert) {
+    const XWORD *src = (const XWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m512i pixels = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)(src + x)));
+        _mm512_storeu_si512((void *)(dst + x), convert(pixels));
+    }
+    if (x < width) {
+        const __mmask16 tail = TailMask16_AVX512(width - x);
+        const __m512i pixels = _mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(tail, src + x));
+        _mm512_mask_storeu_epi32(dst + x, tail, convert(pixels));
+    }
+}
+
+static inline __m512i AndShiftRight_AVX512(__m512i p, int shift, int mask) {
+    return _mm512_and_si512(_mm512_srl_epi32(p, _mm_cvtsi32_si128(shift)), _mm512_set1_epi32(mask));
+}
+
+static inline __m512i AndShiftLeft_AVX512(__m512i p, int mask, int shift) {
+    return _mm512_sll_epi32(_mm512_and_si512(p, _mm512_set1_epi32(mask)), _mm_cvtsi32_si128(shift));
+}
+
+void CopyLine_32ARGB_565RGB_AVX512(const VxBlitInfo *info) {
+    PackLine16_AVX512(info, [](__m512i p) {
+        return Or3_AVX512(AndShiftRight_AVX512(p, 8, 0xF800), AndShiftRight_AVX512(p, 5, 0x07E0),
+                          AndShiftRight_AVX512(p, 3, 0x001F));
+    });
+}
+
+void CopyLine_32ARGB_555RGB_AVX512(const VxBlitInfo *info) {
+    PackLine16_AVX512(info, [](__m512i p) {
+        return Or3_AVX512(AndShiftRight_AVX512(p, 9, 0x7C00), AndShiftRight_AVX512(p, 6, 0x03E0),
+                          AndShiftRight_AVX512(p, 3, 0x001F));
+    });
+}
+
+void CopyLine_32ARGB_1555ARGB_AVX512(const VxBlitInfo *info) {
+    PackLine16_AVX512(info, [](__m512i p) {
+        return _mm512_or_si512(AndShiftRight_AVX512(p, 16, 0x8000),
+                               Or3_AVX512(AndShiftRight_AVX512(p, 9, 0x7C00), AndShiftRight_AVX512(p, 6, 0x03E0),
+                                          AndShiftRight_AVX512(p, 3, 0x001F)));
+    });
+}
+
+void CopyLine_32ARGB_4444ARGB_AVX512(const VxBlitInfo *info) {
+    PackLine16_AVX512(info, [](__m512i p) {
+        return _mm512_or_si512(AndShiftRight_AVX512(p, 16, 0xF000),
+                               Or3_AVX512(AndShiftRight_AVX512(p, 12, 0x0F00), AndShiftRight_AVX512(p, 8, 0x00F0),
+                                          AndShiftRight_AVX512(p, 4, 0x000F)));
+    });
+}
+
+void CopyLine_565RGB_32ARGB_AVX512(const VxBlitInfo *info) {
+    UnpackLine16_AVX512(info, [](__m512i p) {
+        const __m512i r = _mm512_or_si512(AndShiftLeft_AVX512(p, 0xF800, 8), AndShiftLeft_AVX512(p, 0xE000, 3));
+        const __m512i g = _mm512_or_si512(AndShiftLeft_AVX512(p, 0x07E0, 5),
+                                          _mm512_srli_epi32(_mm512_and_si512(p, _mm512_set1_epi32(0x0600)), 1));
+        const __m512i b = _mm512_or_si512(AndShiftLeft_AVX512(p, 0x001F, 3),
+                                          _mm512_srli_epi32(_mm512_and_si512(p, _mm512_set1_epi32(0x001C)), 2));
+        return _mm512_or_si512(_mm512_set1_epi32(0xFF000000), Or3_AVX512(r, g, b));
+    });
+}
+
+// RGB of 555 and 1555 pixels.
+static inline __m512i Expand555_AVX512(__m512i p) {
+    const __m512i r = _mm512_or_si512(AndShiftLeft_AVX512(p, 0x7C00, 9), AndShiftLeft_AVX512(p, 0x7000, 4));
+    const __m512i g = _mm512_or_si512(AndShiftLeft_AVX512(p, 0x03E0, 6), AndShiftLeft_AVX512(p, 0x0380, 1));
+    const __m512i b = _mm512_or_si512(AndShiftLeft_AVX512(p, 0x001F, 3),
+                                      _mm512_srli_epi32(_mm512_and_si512(p, _mm512_set1_epi32(0x001C)), 2));
+    return Or3_AVX512(r, g, b);
+}
+
+void CopyLine_555RGB_32ARGB_AVX512(const VxBlitInfo *info) {
+    UnpackLine16_AVX512(info, [](__m512i p) {
+        return _mm512_or_si512(_mm512_set1_epi32(0xFF000000), Expand555_AVX512(p));
+    });
+}
+
+void CopyLine_1555ARGB_32ARGB_AVX512(const VxBlitInfo *info) {
+    UnpackLine16_AVX512(info, [](__m512i p) {
+        // Bit 15 moved to bit 31 and smeared over the alpha byte.
+        const __m512i a = _mm512_and_si512(_mm512_srai_epi32(_mm512_slli_epi32(p, 16), 7),
+                                           _mm512_set1_epi32(0xFF000000));
+        return _mm512_or_si512(a, Expand555_AVX512(p));
+    });
+}
+
+void CopyLine_4444ARGB_32ARGB_AVX512(const VxBlitInfo *info) {
+    UnpackLine16_AVX512(info, [](__m512i p) {
+        // Move each nibble to the top of its byte, then replicate it downwards.
+        const __m512i high = Or3_AVX512(AndShiftLeft_AVX512(p, 0xF000, 16), AndShiftLeft_AVX512(p, 0x0F00, 12),
+                                        _mm512_or_si512(AndShiftLeft_AVX512(p, 0x00F0, 8),
+                                                        AndShiftLeft_AVX512(p, 0x000F, 4)));
+        return _mm512_or_si512(high, _mm512_srli_epi32(high, 4));
+    });
+}
+
+// -- Fill operations ------------------------------------------------------
+
+void FillLine_32_AVX512(XDWORD *dst, int width, XDWORD color) {
+    const __m512i fillColor = _mm512_set1_epi32((int)color);
+    int x = 0;
+
+    for (; x + 64 <= width; x += 64) {
+        _mm512_storeu_si512((void *)(dst + x), fillColor);
+        _mm512_storeu_si512((void *)(dst + x + 16), fillColor);
+        _mm512_storeu_si512((void *)(dst + x + 32), fillColor);
+        _mm512_storeu_si512((void *)(dst + x + 48), fillColor);
+    }
+    for (; x + 16 <= width; x += 16) {
+        _mm512_storeu_si512((void *)(dst + x), fillColor);
+    }
+    if (x < width) {
+        _mm512_mask_storeu_epi32(dst + x, TailMask16_AVX512(width - x), fillColor);
+    }
+}
+
+void FillLine_16_AVX512(XWORD *dst, int width, XWORD color) {
+    const __m512i fillColor = _mm512_set1_epi16((short)color);
+    int x = 0;
+
+    for (; x + 128 <= width; x += 128) {
+        _mm512_storeu_si512((void *)(dst + x), fillColor);
+        _mm512_storeu_si512((void *)(dst + x + 32), fillColor);
+        _mm512_storeu_si512((void *)(dst + x + 64), fillColor);
+        _mm512_storeu_si512((void *)(dst + x + 96), fillColor);
+    }
+    for (; x + 32 <= width; x += 32) {
+        _mm512_storeu_si512((void *)(dst + x), fillColor);
+    }
+    if (x < width) {
+        _mm512_mask_storeu_epi16(dst + x, TailMask32_AVX512(width - x), fillColor);
+    }
+}
+
+// -- Alpha operations -----------------------------------------------------
+
+static inline __m512i Premultiply16_AVX512(__m512i pixels) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i one = _mm512_set1_epi16(1);
+    const __m512i alphaReplicate = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15));
+    const __m512i alphaBytes = _mm512_shuffle_epi8(pixels, alphaReplicate);
+
+    // x / 255 == (x + 1 + ((x + 1) >> 8)) >> 8 for every product of two bytes.
+    __m512i lo = _mm512_add_epi16(_mm512_mullo_epi16(_mm512_unpacklo_epi8(pixels, zero),
+                                                     _mm512_unpacklo_epi8(alphaBytes, zero)), one);
+    __m512i hi = _mm512_add_epi16(_mm512_mullo_epi16(_mm512_unpackhi_epi8(pixels, zero),
+                                                     _mm512_unpackhi_epi8(alphaBytes, zero)), one);
+    lo = _mm512_srli_epi16(_mm512_add_epi16(lo, _mm512_srli_epi16(lo, 8)), 8);
+    hi = _mm512_srli_epi16(_mm512_add_epi16(hi, _mm512_srli_epi16(hi, 8)), 8);
+
+    // Keep the original alpha byte.
+    return _mm512_mask_blend_epi8(0x8888888888888888ull, _mm512_packus_epi16(lo, hi), pixels);
+}
+
+void PremultiplyAlpha_32ARGB_AVX512(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m512i pixels = _mm512_loadu_si512((const void *)(src + x));
+        _mm512_storeu_si512((void *)(dst + x), Premultiply16_AVX512(pixels));
+    }
+    if (x < width) {
+        const __mmask16 tail = TailMask16_AVX512(width - x);
+        const __m512i pixels = _mm512_maskz_loadu_epi32(tail, src + x);
+        _mm512_mask_storeu_epi32(dst + x, tail, Premultiply16_AVX512(pixels));
+    }
+}
+
+// min((c * reciprocal[a]) >> 16, 255) per channel, matching the scalar
+// c * 255 / a. The gathered reciprocals are split into 16-bit halves so that
+// c * hi + mulhi(c, lo) stays in 16-bit lanes; alpha is carried over as is.
+static inline __m512i Unpremultiply16_AVX512(__m512i pixels) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i max = _mm512_set1_epi16(255);
+    const __m512i hiLoPixels = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(2, 3, 2, 3, 2, 3, -1, -1, 6, 7, 6, 7, 6, 7, -1, -1));
+    const __m512i loLoPixels = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(0, 1, 0, 1, 0, 1, -1, -1, 4, 5, 4, 5, 4, 5, -1, -1));
+    const __m512i hiHiPixels = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(10, 11, 10, 11, 10, 11, -1, -1, 14, 15, 14, 15, 14, 15, -1, -1));
+    const __m512i loHiPixels = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(8, 9, 8, 9, 8, 9, -1, -1, 12, 13, 12, 13, 12, 13, -1, -1));
+    const __m512i rcp = _mm512_i32gather_epi32(_mm512_srli_epi32(pixels, 24),
+                                               (const void *)g_UnpremultiplyTable.reciprocal, 4);
+
+    const __m512i lo16 = _mm512_unpacklo_epi8(pixels, zero);
+    const __m512i hi16 = _mm512_unpackhi_epi8(pixels, zero);
+    __m512i lo = _mm512_add_epi16(_mm512_mullo_epi16(lo16, _mm512_shuffle_epi8(rcp, hiLoPixels)),
+                                  _mm512_mulhi_epu16(lo16, _mm512_shuffle_epi8(rcp, loLoPixels)));
+    __m512i hi = _mm512_add_epi16(_mm512_mullo_epi16(hi16, _mm512_shuffle_epi8(rcp, hiHiPixels)),
+                                  _mm512_mulhi_epu16(hi16, _mm512_shuffle_epi8(rcp, loHiPixels)));
+    lo = _mm512_min_epu16(lo, max);
+    hi = _mm512_min_epu16(hi, max);
+
+    return _mm512_mask_blend_epi8(0x8888888888888888ull, _mm512_packus_epi16(lo, hi), pixels);
+}
+
+void UnpremultiplyAlpha_32ARGB_AVX512(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m512i pixels = _mm512_loadu_si512((const void *)(src + x));
+        _mm512_storeu_si512((void *)(dst + x), Unpremultiply16_AVX512(pixels));
+    }
+    if (x < width) {
+        const __mmask16 tail = TailMask16_AVX512(width - x);
+        const __m512i pixels = _mm512_maskz_loadu_epi32(tail, src + x);
+        _mm512_mask_storeu_epi32(dst + x, tail, Unpremultiply16_AVX512(pixels));
+    }
+}
+
+#endif // VX_SIMD_AVX512
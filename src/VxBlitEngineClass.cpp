@@ -8,19 +8,26 @@
  *   - VxBlitEngineSSE2.cpp  (SSE2)
  *   - VxBlitEngineSSSE3.cpp (SSSE3 -- runtime-dispatched)
  *   - VxBlitEngineAVX2.cpp  (AVX2 -- runtime-dispatched)
+ *   - VxBlitEngineAVX512.cpp (AVX-512 -- runtime-dispatched)
  *
  * This file owns the global `TheBlitter` instance.
  */
 
 #include "VxBlitInternal.h"
+#include "VxSIMDDispatchInternal.h"
+
+#include <cmath>
+#include <thread>
 
 #include "VxMath.h"
 #include "VxSIMD.h"
+#include "VxAtomic.h"
+#include "VxWorkerPool.h"
 #include "NeuQuant.h"
 
 int GetQuantizationSamplingFactor();
 
-#if defined(VX_SIMD_SSE2)
+#if defined(VX_SIMD_SSE2) && defined(VX_SIMD_X86)
 #include <emmintrin.h>
 #endif
 
@@ -30,13 +37,157 @@ int GetQuantizationSamplingFactor();
 
 VxBlitEngine TheBlitter;
 
+static inline bool IsDXTFormat(VX_PIXELFORMAT format) {
+    return format >= _DXT1 && format <= _DXT5;
+}
+
+// Bytes between consecutive block rows of a DXT image. BytesPerLine shares
+// its storage with TotalImageSize, so a surface whose block rows are padded
+// is described by its total size (pitch * block rows); 0 means tightly
+// packed. Returns 0 when a block row does not fit the given pitch.
+static int DXTBlockRowPitch(const VxImageDescEx &desc, VX_PIXELFORMAT format) {
+    const int packed = ((desc.Width + 3) / 4) * (format == _DXT1 ? 8 : 16);
+    if (desc.TotalImageSize == 0) return packed;
+    const int pitch = desc.TotalImageSize / ((desc.Height + 3) / 4);
+    return pitch >= packed ? pitch : 0;
+}
+
+// Copies @p rect into @p out, or the whole image when @p rect is NULL.
+// Returns false for empty or inverted rectangles.
+static bool ResolveRect(const VxImageDescEx &desc, const CKRECT *rect, CKRECT &out) {
+    if (rect) {
+        out = *rect;
+    } else {
+        out.left = 0;
+        out.top = 0;
+        out.right = desc.Width;
+        out.bottom = desc.Height;
+    }
+    return out.left < out.right && out.top < out.bottom;
+}
+
+static bool RectInsideImage(const VxImageDescEx &desc, const CKRECT &rect) {
+    return rect.left >= 0 && rect.top >= 0 && rect.right <= desc.Width && rect.bottom <= desc.Height;
+}
+
+// Intersects @p rect with the image. Returns false when nothing is left.
+static bool ClipToImage(const VxImageDescEx &desc, CKRECT &rect) {
+    rect.left = XMax(rect.left, 0);
+    rect.top = XMax(rect.top, 0);
+    rect.right = XMin(rect.right, desc.Width);
+    rect.bottom = XMin(rect.bottom, desc.Height);
+    return rect.left < rect.right && rect.top < rect.bottom;
+}
+
+// Clips a copy of @p s (source) to the same-size @p d (destination) against
+// both images, shrinking both rectangles alike. With @p upsideDown, source row
+// y lands on d.top + s.bottom - 1 - y, so cutting rows from the top of one
+// side cuts them from the bottom of the other. Returns false when nothing is left.
+static bool ClipCopyRects(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, CKRECT &s, CKRECT &d,
+                          bool upsideDown) {
+    const int dx = d.left - s.left;
+    const int x0 = XMax(XMax(s.left, 0), -dx);
+    const int x1 = XMin(XMin(s.right, src_desc.Width), dst_desc.Width - dx);
+
+    int y0, y1;
+    if (upsideDown) {
+        const int flip = d.top + s.bottom; // dst row + src row + 1
+        y0 = XMax(XMax(s.top, 0), flip - dst_desc.Height);
+        y1 = XMin(XMin(s.bottom, src_desc.Height), flip);
+        if (x0 >= x1 || y0 >= y1) return false;
+        d.top = flip - y1;
+        d.bottom = flip - y0;
+    } else {
+        const int dy = d.top - s.top;
+        y0 = XMax(XMax(s.top, 0), -dy);
+        y1 = XMin(XMin(s.bottom, src_desc.Height), dst_desc.Height - dy);
+        if (x0 >= x1 || y0 >= y1) return false;
+        d.top = y0 + dy;
+        d.bottom = y1 + dy;
+    }
+    d.left = x0 + dx;
+    d.right = x1 + dx;
+    s.left = x0;
+    s.top = y0;
+    s.right = x1;
+    s.bottom = y1;
+    return true;
+}
+
+// Descriptor for the pixels of @p desc inside @p rect, which lies inside the
+// image. Fails when the left edge does not start on a byte, or when a DXT
+// image is not covered whole.
+static bool MakeRectView(const VxImageDescEx &desc, const CKRECT &rect, VxImageDescEx &view) {
+    view = desc;
+    if (IsDXTFormat(VxBlitEngine::GetPixelFormat(desc))) {
+        return rect.left == 0 && rect.top == 0 && rect.right == desc.Width && rect.bottom == desc.Height;
+    }
+    const int bitOffset = rect.left * desc.BitsPerPixel;
+    if (bitOffset % 8 != 0) return false;
+
+    view.Width = rect.right - rect.left;
+    view.Height = rect.bottom - rect.top;
+    view.Image = desc.Image + static_cast<ptrdiff_t>(rect.top) * desc.BytesPerLine + bitOffset / 8;
+    return true;
+}
+
+// Byte index of an 8-bit channel mask inside a pixel of @p bytes bytes, -1 for
+// an absent channel, or -2 when the channel does not fill exactly one byte.
+static int ChannelByte(XDWORD mask, int bytes) {
+    if (mask == 0) return -1;
+    for (int i = 0; i < bytes; ++i) {
+        if (mask == (0xFFu << (i * 8))) return i;
+    }
+    return -2;
+}
+
+// Derives the byteShuffle control for a src -> dst conversion when every
+// destination channel is a whole byte whose source is a whole byte or absent.
+// Produces the same output as CopyLineGeneric: absent channels (alpha
+// included) and bytes outside every mask become zero.
+static bool BuildByteShuffle(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, XBYTE shuffle[16]) {
+    if (src_desc.ColorMapEntries > 0 || dst_desc.ColorMapEntries > 0) return false;
+    const int srcBpp = src_desc.BitsPerPixel / 8;
+    const int dstBpp = dst_desc.BitsPerPixel / 8;
+    if (srcBpp < 1 || srcBpp > 4 || dstBpp < 1 || dstBpp > 4) return false;
+    if (src_desc.BitsPerPixel % 8 != 0 || dst_desc.BitsPerPixel % 8 != 0) return false;
+
+    const XDWORD srcMasks[4] = {src_desc.RedMask, src_desc.GreenMask, src_desc.BlueMask, src_desc.AlphaMask};
+    const XDWORD dstMasks[4] = {dst_desc.RedMask, dst_desc.GreenMask, dst_desc.BlueMask, dst_desc.AlphaMask};
+    XBYTE pixel[4] = {0x80, 0x80, 0x80, 0x80};
+    XBYTE assigned = 0;
+    for (int c = 0; c < 4; ++c) {
+        const int d = ChannelByte(dstMasks[c], dstBpp);
+        if (d == -1) continue;
+        const int s = ChannelByte(srcMasks[c], srcBpp);
+        if (d == -2 || s == -2) return false;
+        // Overlapping destination channels are OR-ed together by the generic path.
+        if (assigned & (1 << d)) return false;
+        assigned |= static_cast<XBYTE>(1 << d);
+        if (s >= 0) pixel[d] = static_cast<XBYTE>(s);
+    }
+
+    const int group = 16 / XMax(srcBpp, dstBpp);
+    memset(shuffle, 0x80, 16);
+    for (int p = 0; p < group; ++p) {
+        for (int j = 0; j < dstBpp; ++j) {
+            if (!(pixel[j] & 0x80)) shuffle[p * dstBpp + j] = static_cast<XBYTE>(p * srcBpp + pixel[j]);
+        }
+    }
+    return true;
+}
+
 static int CollapseSIMDModeToBlitKernelTier(int mode) {
     switch (mode) {
+        case VX_SIMD_MODE_AVX512:
+            return VX_SIMD_MODE_AVX512;
         case VX_SIMD_MODE_AVX2:
             return VX_SIMD_MODE_AVX2;
         case VX_SIMD_MODE_AVX:
         case VX_SIMD_MODE_SSE4_1:
         case VX_SIMD_MODE_SSSE3:
+        case VX_SIMD_MODE_NEON:
+        case VX_SIMD_MODE_WASM_SIMD128:
             return VX_SIMD_MODE_SSSE3;
         case VX_SIMD_MODE_SSE2:
             return VX_SIMD_MODE_SSE2;
@@ -46,6 +197,61 @@ static int CollapseSIMDModeToBlitKernelTier(int mode) {
     }
 }
 
+// Checks the format, matrix, planes and pitches of a YUV image.
+static bool IsValidYUVImage(const VxYUVImageDesc &desc) {
+    if (desc.Width <= 0 || desc.Height <= 0) return false;
+    if (desc.Matrix < VX_YUVMATRIX_BT601 || desc.Matrix > VX_YUVMATRIX_BT709) return false;
+    if (!desc.Planes[0]) return false;
+
+    const int chromaWidth = (desc.Width + 1) / 2;
+    switch (desc.Format) {
+        case VX_YUV_I420:
+            return desc.Planes[1] && desc.Planes[2] && desc.Pitches[0] >= desc.Width &&
+                   desc.Pitches[1] >= chromaWidth && desc.Pitches[2] >= chromaWidth;
+        case VX_YUV_NV12:
+            return desc.Planes[1] && desc.Pitches[0] >= desc.Width && desc.Pitches[1] >= chromaWidth * 2;
+        case VX_YUV_YUY2:
+            return desc.Pitches[0] >= chromaWidth * 4;
+        default:
+            return false;
+    }
+}
+
+// Plane pointers of image row @p y from the even column @p x, laid out as the
+// YUV row decoders take them (unused planes are null).
+static void GetYUVRowPlanes(const VxYUVImageDesc &desc, int y, int x, const XBYTE *planes[3]) {
+    const int chromaY = y >> 1;
+    planes[0] = desc.Planes[0] + y * desc.Pitches[0];
+    planes[1] = nullptr;
+    planes[2] = nullptr;
+    switch (desc.Format) {
+        case VX_YUV_I420:
+            planes[0] += x;
+            planes[1] = desc.Planes[1] + chromaY * desc.Pitches[1] + x / 2;
+            planes[2] = desc.Planes[2] + chromaY * desc.Pitches[2] + x / 2;
+            break;
+        case VX_YUV_NV12:
+            planes[0] += x;
+            planes[1] = desc.Planes[1] + chromaY * desc.Pitches[1] + x;
+            break;
+        default:
+            planes[0] += x * 2;
+            break;
+    }
+}
+
+// Per-thread scratch memory reused across blit calls on the same thread.
+struct VxBlitThreadScratch {
+    XArray<XDWORD> resizeBuffer;
+    XArray<XDWORD> decodeBuffer; // One decoded (or to-be-encoded) DXT block row
+    XArray<XBYTE> ditherRow;     // One source row with the dither pattern added
+};
+
+static VxBlitThreadScratch &GetThreadBlitScratch() {
+    static thread_local VxBlitThreadScratch scratch;
+    return scratch;
+}
+
 //==============================================================================
 //  VxBlitEngine -- Construction / Destruction
 //==============================================================================
@@ -53,202 +259,336 @@ static int CollapseSIMDModeToBlitKernelTier(int mode) {
 VxBlitEngine::VxBlitEngine() {
     static_assert(FORMAT_TABLE_SIZE >= NUM_BLITTABLE_FORMATS,
                   "FORMAT_TABLE_SIZE must cover all blittable pixel format indices");
-    memset(&m_BlitInfo, 0, sizeof(m_BlitInfo));
-    m_EffectiveBlitKernelMode = CollapseSIMDModeToBlitKernelTier(VxGetSIMDEffectiveBackend());
+    memset(m_TierTables, 0, sizeof(m_TierTables));
+    m_ActiveTables = nullptr;
+    m_EffectiveSIMDMode = VxGetSIMDEffectiveBackend();
+    m_EffectiveBlitKernelMode = CollapseSIMDModeToBlitKernelTier(m_EffectiveSIMDMode);
     m_OperationStamp = 1;
-    RebuildTablesUnlocked();
+    m_BlitThreadCount = 1;
+    m_MinRowsPerBand = 64;
+    m_DXTQuality = VX_DXTQUALITY_FAST;
+    PublishTablesUnlocked(FALSE);
 }
 
 VxBlitEngine::~VxBlitEngine() {
-    // Nothing to free -- XArray handles its own memory.
+    for (int i = 0; i < TIER_SLOT_COUNT; ++i) {
+        delete m_TierTables[i];
+    }
+    for (DispatchTables **it = m_RetiredTables.Begin(); it != m_RetiredTables.End(); ++it) {
+        delete *it;
+    }
+    for (DispatchTables **it = m_ComposedTables.Begin(); it != m_ComposedTables.End(); ++it) {
+        delete *it;
+    }
 }
 
 //==============================================================================
 //  Dispatch-Table Setup
 //==============================================================================
 
-void VxBlitEngine::BuildGenericTables() {
+void VxBlitEngine::BuildGenericTables(DispatchTables &tables) {
     // Generic blitting functions indexed by [srcBpp-1][dstBpp-1]
-    m_GenericBlitTable[0][0] = CopyLineGeneric_8_8;
-    m_GenericBlitTable[0][1] = CopyLineGeneric_8_16;
-    m_GenericBlitTable[0][2] = CopyLineGeneric_8_24;
-    m_GenericBlitTable[0][3] = CopyLineGeneric_8_32;
-
-    m_GenericBlitTable[1][0] = CopyLineGeneric_16_8;
-    m_GenericBlitTable[1][1] = CopyLineGeneric_16_16;
-    m_GenericBlitTable[1][2] = CopyLineGeneric_16_24;
-    m_GenericBlitTable[1][3] = CopyLineGeneric_16_32;
-
-    m_GenericBlitTable[2][0] = CopyLineGeneric_24_8;
-    m_GenericBlitTable[2][1] = CopyLineGeneric_24_16;
-    m_GenericBlitTable[2][2] = CopyLineGeneric_24_24;
-    m_GenericBlitTable[2][3] = CopyLineGeneric_24_32;
-
-    m_GenericBlitTable[3][0] = CopyLineGeneric_32_8;
-    m_GenericBlitTable[3][1] = CopyLineGeneric_32_16;
-    m_GenericBlitTable[3][2] = CopyLineGeneric_32_24;
-    m_GenericBlitTable[3][3] = CopyLineGeneric_32_32;
+    tables.genericBlit[0][0] = CopyLineGeneric_8_8;
+    tables.genericBlit[0][1] = CopyLineGeneric_8_16;
+    tables.genericBlit[0][2] = CopyLineGeneric_8_24;
+    tables.genericBlit[0][3] = CopyLineGeneric_8_32;
+
+    tables.genericBlit[1][0] = CopyLineGeneric_16_8;
+    tables.genericBlit[1][1] = CopyLineGeneric_16_16;
+    tables.genericBlit[1][2] = CopyLineGeneric_16_24;
+    tables.genericBlit[1][3] = CopyLineGeneric_16_32;
+
+    tables.genericBlit[2][0] = CopyLineGeneric_24_8;
+    tables.genericBlit[2][1] = CopyLineGeneric_24_16;
+    tables.genericBlit[2][2] = CopyLineGeneric_24_24;
+    tables.genericBlit[2][3] = CopyLineGeneric_24_32;
+
+    tables.genericBlit[3][0] = CopyLineGeneric_32_8;
+    tables.genericBlit[3][1] = CopyLineGeneric_32_16;
+    tables.genericBlit[3][2] = CopyLineGeneric_32_24;
+    tables.genericBlit[3][3] = CopyLineGeneric_32_32;
+
+    // Byte-shuffle blitting functions, same indexing
+    tables.shuffleBlit[0][0] = CopyLineShuffle_8_8;
+    tables.shuffleBlit[0][1] = CopyLineShuffle_8_16;
+    tables.shuffleBlit[0][2] = CopyLineShuffle_8_24;
+    tables.shuffleBlit[0][3] = CopyLineShuffle_8_32;
+
+    tables.shuffleBlit[1][0] = CopyLineShuffle_16_8;
+    tables.shuffleBlit[1][1] = CopyLineShuffle_16_16;
+    tables.shuffleBlit[1][2] = CopyLineShuffle_16_24;
+    tables.shuffleBlit[1][3] = CopyLineShuffle_16_32;
+
+    tables.shuffleBlit[2][0] = CopyLineShuffle_24_8;
+    tables.shuffleBlit[2][1] = CopyLineShuffle_24_16;
+    tables.shuffleBlit[2][2] = CopyLineShuffle_24_24;
+    tables.shuffleBlit[2][3] = CopyLineShuffle_24_32;
+
+    tables.shuffleBlit[3][0] = CopyLineShuffle_32_8;
+    tables.shuffleBlit[3][1] = CopyLineShuffle_32_16;
+    tables.shuffleBlit[3][2] = CopyLineShuffle_32_24;
+    tables.shuffleBlit[3][3] = CopyLineShuffle_32_32;
 
     // Alpha functions
-    m_SetAlphaTable[0] = SetAlpha_8;
-    m_SetAlphaTable[1] = SetAlpha_16;
-    m_SetAlphaTable[2] = nullptr; // 24-bit rarely has alpha
-    m_SetAlphaTable[3] = SetAlpha_32;
-
-    m_CopyAlphaTable[0] = CopyAlpha_8;
-    m_CopyAlphaTable[1] = CopyAlpha_16;
-    m_CopyAlphaTable[2] = nullptr;
-    m_CopyAlphaTable[3] = CopyAlpha_32;
+    tables.setAlpha[0] = SetAlpha_8;
+    tables.setAlpha[1] = SetAlpha_16;
+    tables.setAlpha[2] = nullptr; // 24-bit rarely has alpha
+    tables.setAlpha[3] = SetAlpha_32;
+
+    tables.copyAlpha[0] = CopyAlpha_8;
+    tables.copyAlpha[1] = CopyAlpha_16;
+    tables.copyAlpha[2] = nullptr;
+    tables.copyAlpha[3] = CopyAlpha_32;
 }
 
-void VxBlitEngine::BuildX86Table() {
+void VxBlitEngine::BuildX86Table(DispatchTables &tables) {
     // Specific format conversion functions for common cases
 
     // 32-bit ARGB (format 1) to other formats
-    m_SpecificBlitTable[1][2] = CopyLine_32ARGB_32RGB;    // ARGB -> RGB (32)
-    m_SpecificBlitTable[1][3] = CopyLine_32ARGB_24RGB;    // ARGB -> RGB (24)
-    m_SpecificBlitTable[1][4] = CopyLine_32ARGB_565RGB;   // ARGB -> 565
-    m_SpecificBlitTable[1][5] = CopyLine_32ARGB_555RGB;   // ARGB -> 555
-    m_SpecificBlitTable[1][6] = CopyLine_32ARGB_1555ARGB; // ARGB -> 1555
-    m_SpecificBlitTable[1][7] = CopyLine_32ARGB_4444ARGB; // ARGB -> 4444
-    m_SpecificBlitTable[1][10] = CopyLine_32ARGB_32ABGR;  // ARGB -> ABGR
-    m_SpecificBlitTable[1][11] = CopyLine_32ARGB_32RGBA;  // ARGB -> RGBA
-    m_SpecificBlitTable[1][12] = CopyLine_32ARGB_32BGRA;  // ARGB -> BGRA
+    tables.specificBlit[1][2] = CopyLine_32ARGB_32RGB;    // ARGB -> RGB (32)
+    tables.specificBlit[1][3] = CopyLine_32ARGB_24RGB;    // ARGB -> RGB (24)
+    tables.specificBlit[1][4] = CopyLine_32ARGB_565RGB;   // ARGB -> 565
+    tables.specificBlit[1][5] = CopyLine_32ARGB_555RGB;   // ARGB -> 555
+    tables.specificBlit[1][6] = CopyLine_32ARGB_1555ARGB; // ARGB -> 1555
+    tables.specificBlit[1][7] = CopyLine_32ARGB_4444ARGB; // ARGB -> 4444
+    tables.specificBlit[1][10] = CopyLine_32ARGB_32ABGR;  // ARGB -> ABGR
+    tables.specificBlit[1][11] = CopyLine_32ARGB_32RGBA;  // ARGB -> RGBA
+    tables.specificBlit[1][12] = CopyLine_32ARGB_32BGRA;  // ARGB -> BGRA
 
     // 32-bit RGB (format 2) to ARGB
-    m_SpecificBlitTable[2][1] = CopyLine_32RGB_32ARGB;
+    tables.specificBlit[2][1] = CopyLine_32RGB_32ARGB;
 
     // 24-bit RGB (format 3) to 32-bit
-    m_SpecificBlitTable[3][1] = CopyLine_24RGB_32ARGB;
+    tables.specificBlit[3][1] = CopyLine_24RGB_32ARGB;
 
     // 16-bit to 32-bit
-    m_SpecificBlitTable[4][1] = CopyLine_565RGB_32ARGB;
-    m_SpecificBlitTable[5][1] = CopyLine_555RGB_32ARGB;
-    m_SpecificBlitTable[6][1] = CopyLine_1555ARGB_32ARGB;
-    m_SpecificBlitTable[7][1] = CopyLine_4444ARGB_32ARGB;
+    tables.specificBlit[4][1] = CopyLine_565RGB_32ARGB;
+    tables.specificBlit[5][1] = CopyLine_555RGB_32ARGB;
+    tables.specificBlit[6][1] = CopyLine_1555ARGB_32ARGB;
+    tables.specificBlit[7][1] = CopyLine_4444ARGB_32ARGB;
 
     // 32-bit ABGR (format 10) to other formats
-    m_SpecificBlitTable[10][1] = CopyLine_32ABGR_32ARGB;  // ABGR -> ARGB
+    tables.specificBlit[10][1] = CopyLine_32ABGR_32ARGB;  // ABGR -> ARGB
 
     // 32-bit RGBA (format 11) to other formats
-    m_SpecificBlitTable[11][1] = CopyLine_32RGBA_32ARGB;  // RGBA -> ARGB
+    tables.specificBlit[11][1] = CopyLine_32RGBA_32ARGB;  // RGBA -> ARGB
 
     // 32-bit BGRA (format 12) to other formats
-    m_SpecificBlitTable[12][1] = CopyLine_32BGRA_32ARGB;  // BGRA -> ARGB
+    tables.specificBlit[12][1] = CopyLine_32BGRA_32ARGB;  // BGRA -> ARGB
 
     // Paletted image functions
-    m_PalettedBlitTable[0][0] = CopyLine_Paletted8_8;      // 8-bit pal -> 8-bit
-    m_PalettedBlitTable[0][1] = CopyLine_Paletted8_565RGB; // 8-bit pal -> 16-bit 565
-    m_PalettedBlitTable[0][2] = CopyLine_Paletted8_24RGB;  // 8-bit pal -> 24-bit
-    m_PalettedBlitTable[0][3] = CopyLine_Paletted8_32ARGB; // 8-bit pal -> 32-bit
+    tables.palettedBlit[0][0] = CopyLine_Paletted8_8;      // 8-bit pal -> 8-bit
+    tables.palettedBlit[0][1] = CopyLine_Paletted8_16;     // 8-bit pal -> 16-bit (by masks)
+    tables.palettedBlit[0][2] = CopyLine_Paletted8_24RGB;  // 8-bit pal -> 24-bit
+    tables.palettedBlit[0][3] = CopyLine_Paletted8_32ARGB; // 8-bit pal -> 32-bit
 }
 
-void VxBlitEngine::ResetDispatchTables() {
-    memset(m_GenericBlitTable, 0, sizeof(m_GenericBlitTable));
-    memset(m_SpecificBlitTable, 0, sizeof(m_SpecificBlitTable));
-    memset(m_SetAlphaTable, 0, sizeof(m_SetAlphaTable));
-    memset(m_CopyAlphaTable, 0, sizeof(m_CopyAlphaTable));
-    memset(m_PalettedBlitTable, 0, sizeof(m_PalettedBlitTable));
+void VxBlitEngine::ResetDispatchTables(DispatchTables &tables) {
+    memset(tables.genericBlit, 0, sizeof(tables.genericBlit));
+    memset(tables.specificBlit, 0, sizeof(tables.specificBlit));
+    memset(tables.setAlpha, 0, sizeof(tables.setAlpha));
+    memset(tables.copyAlpha, 0, sizeof(tables.copyAlpha));
+    memset(tables.palettedBlit, 0, sizeof(tables.palettedBlit));
+    memset(tables.shuffleBlit, 0, sizeof(tables.shuffleBlit));
 }
 
-void VxBlitEngine::ResetHotPathKernels() {
-    m_FillLine32 = nullptr;
-    m_FillLine16 = nullptr;
-    m_PremultiplyAlpha32 = PremultiplyAlpha_32ARGB;
-    m_UnpremultiplyAlpha32 = UnpremultiplyAlpha_32ARGB;
-    m_SwapRedBlue32 = CopyLine_32ARGB_32ABGR;
-    m_ClearAlpha32 = nullptr;
-    m_SetFullAlpha32 = nullptr;
-    m_InvertColors32 = nullptr;
-    m_Grayscale32 = nullptr;
-    m_MultiplyBlend32 = nullptr;
+void VxBlitEngine::ResetHotPathKernels(DispatchTables &tables) {
+    tables.fillLine32 = nullptr;
+    tables.fillLine16 = nullptr;
+    tables.premultiplyAlpha32 = PremultiplyAlpha_32ARGB;
+    tables.unpremultiplyAlpha32 = UnpremultiplyAlpha_32ARGB;
+    tables.swapRedBlue32 = CopyLine_32ARGB_32ABGR;
+    tables.clearAlpha32 = nullptr;
+    tables.setFullAlpha32 = nullptr;
+    tables.invertColors32 = nullptr;
+    tables.grayscale32 = nullptr;
+    tables.multiplyBlend32 = nullptr;
+    tables.decodeDXT[0] = DecodeBlocks_DXT1;
+    tables.decodeDXT[1] = DecodeBlocks_DXT3;
+    tables.decodeDXT[2] = DecodeBlocks_DXT5;
+    tables.encodeDXT[0][VX_DXTQUALITY_FAST] = EncodeBlocks_DXT1_Fast;
+    tables.encodeDXT[0][VX_DXTQUALITY_HIGH] = EncodeBlocks_DXT1_High;
+    tables.encodeDXT[1][VX_DXTQUALITY_FAST] = EncodeBlocks_DXT3_Fast;
+    tables.encodeDXT[1][VX_DXTQUALITY_HIGH] = EncodeBlocks_DXT3_High;
+    tables.encodeDXT[2][VX_DXTQUALITY_FAST] = EncodeBlocks_DXT5_Fast;
+    tables.encodeDXT[2][VX_DXTQUALITY_HIGH] = EncodeBlocks_DXT5_High;
+    tables.resampleHorz32 = ResampleHorz_32;
+    tables.resampleVert32 = ResampleVert_32;
+    tables.mipHorz[0] = MipHorzPair;
+    tables.mipHorz[1] = MipHorzThree;
+    tables.mipVert[0] = MipVertPair;
+    tables.mipVert[1] = MipVertThree;
+    tables.mipBox = MipBoxPair;
+    tables.ditherAdd = DitherAdd;
+    tables.blend32[VX_BLEND_MULTIPLY] = MultiplyBlend_32;
+    tables.blend32[VX_BLEND_SRCOVER] = BlendSrcOver_32;
+    tables.blend32[VX_BLEND_SRCOVER_PREMULTIPLIED] = BlendSrcOverPremultiplied_32;
+    tables.blend32[VX_BLEND_ADD] = BlendAdd_32;
+    tables.blend32[VX_BLEND_SCREEN] = BlendScreen_32;
+    tables.blend32[VX_BLEND_LERP] = BlendLerp_32;
+    tables.decodeYUV[VX_YUV_I420] = DecodeYUVRow_I420;
+    tables.decodeYUV[VX_YUV_NV12] = DecodeYUVRow_NV12;
+    tables.decodeYUV[VX_YUV_YUY2] = DecodeYUVRow_YUY2;
+    tables.encodeYUV[VX_YUV_I420] = EncodeYUVRows_I420;
+    tables.encodeYUV[VX_YUV_NV12] = EncodeYUVRows_NV12;
+    tables.heightRow[0] = HeightRowLuminance;
+    tables.heightRow[1] = HeightRowMasked;
+    tables.normalMapRow = NormalMapRow;
+    tables.bumpMapRow = BumpMapRow;
 }
 
 XDWORD VxBlitEngine::NextOperationStamp() {
-    ++m_OperationStamp;
-    if (m_OperationStamp == 0) {
-        m_OperationStamp = 1;
-    }
-    return m_OperationStamp;
+    // Stamps only need to be unique across concurrent operations; 0 is reserved
+    // by the kernels as "no cached state".
+    XDWORD stamp;
+    do {
+        stamp = static_cast<XDWORD>(VxAtomicIncrementInt(&m_OperationStamp));
+    } while (stamp == 0);
+    return stamp;
 }
 
 //==============================================================================
 //  SIMD Override Registration
 //==============================================================================
 
-void VxBlitEngine::ApplySSE2Overrides() {
+void VxBlitEngine::ApplySSE2Overrides(DispatchTables &tables) {
 #if defined(VX_SIMD_SSE2)
-    if (m_EffectiveBlitKernelMode == VX_SIMD_MODE_NONE) {
+    if (tables.kernelMode == VX_SIMD_MODE_NONE) {
         return;
     }
 
     // SSE2-optimized functions override scalar versions for better performance
 
     // 32-bit ARGB <-> RGB conversions
-    m_SpecificBlitTable[1][2] = CopyLine_32ARGB_32RGB_SSE;    // ARGB -> RGB (32)
-    m_SpecificBlitTable[2][1] = CopyLine_32RGB_32ARGB_SSE;    // RGB -> ARGB (32)
+    tables.specificBlit[1][2] = CopyLine_32ARGB_32RGB_SSE;    // ARGB -> RGB (32)
+    tables.specificBlit[2][1] = CopyLine_32RGB_32ARGB_SSE;    // RGB -> ARGB (32)
 
     // 32-bit to 16-bit conversions
-    m_SpecificBlitTable[1][4] = CopyLine_32ARGB_565RGB_SSE;   // ARGB -> 565
-    m_SpecificBlitTable[1][5] = CopyLine_32ARGB_555RGB_SSE;   // ARGB -> 555
-    m_SpecificBlitTable[1][6] = CopyLine_32ARGB_1555ARGB_SSE; // ARGB -> 1555
-    m_SpecificBlitTable[1][7] = CopyLine_32ARGB_4444ARGB_SSE; // ARGB -> 4444
+    tables.specificBlit[1][4] = CopyLine_32ARGB_565RGB_SSE;   // ARGB -> 565
+    tables.specificBlit[1][5] = CopyLine_32ARGB_555RGB_SSE;   // ARGB -> 555
+    tables.specificBlit[1][6] = CopyLine_32ARGB_1555ARGB_SSE; // ARGB -> 1555
+    tables.specificBlit[1][7] = CopyLine_32ARGB_4444ARGB_SSE; // ARGB -> 4444
 
     // 16-bit to 32-bit conversions
-    m_SpecificBlitTable[4][1] = CopyLine_565RGB_32ARGB_SSE;   // 565 -> ARGB
-    m_SpecificBlitTable[5][1] = CopyLine_555RGB_32ARGB_SSE;   // 555 -> ARGB
-    m_SpecificBlitTable[6][1] = CopyLine_1555ARGB_32ARGB_SSE; // 1555 -> ARGB
-    m_SpecificBlitTable[7][1] = CopyLine_4444ARGB_32ARGB_SSE; // 4444 -> ARGB
+    tables.specificBlit[4][1] = CopyLine_565RGB_32ARGB_SSE;   // 565 -> ARGB
+    tables.specificBlit[5][1] = CopyLine_555RGB_32ARGB_SSE;   // 555 -> ARGB
+    tables.specificBlit[6][1] = CopyLine_1555ARGB_32ARGB_SSE; // 1555 -> ARGB
+    tables.specificBlit[7][1] = CopyLine_4444ARGB_32ARGB_SSE; // 4444 -> ARGB
 
     // Alpha functions
-    m_SetAlphaTable[3] = SetAlpha_32_SSE;
-    m_CopyAlphaTable[3] = CopyAlpha_32_SSE;
+    tables.setAlpha[3] = SetAlpha_32_SSE;
+    tables.copyAlpha[3] = CopyAlpha_32_SSE;
 
     // Paletted with SSE optimization
-    m_PalettedBlitTable[0][3] = CopyLine_Paletted8_32ARGB_SSE; // 8-bit pal -> 32-bit (SSE)
+    tables.palettedBlit[0][3] = CopyLine_Paletted8_32ARGB_SSE; // 8-bit pal -> 32-bit (SSE)
 
-    m_FillLine32 = FillLine_32_SSE;
-    m_FillLine16 = FillLine_16_SSE;
+    tables.fillLine32 = FillLine_32_SSE;
+    tables.fillLine16 = FillLine_16_SSE;
     // Keep scalar here: legacy SSE path is not bit-exact for all inputs.
-    m_PremultiplyAlpha32 = PremultiplyAlpha_32ARGB;
-    m_UnpremultiplyAlpha32 = UnpremultiplyAlpha_32ARGB_SSE;
-    m_ClearAlpha32 = ClearAlpha_32_SSE;
-    m_SetFullAlpha32 = SetFullAlpha_32_SSE;
-    m_InvertColors32 = InvertColors_32_SSE;
-    m_Grayscale32 = Grayscale_32_SSE;
-    m_MultiplyBlend32 = MultiplyBlend_32_SSE;
+    tables.premultiplyAlpha32 = PremultiplyAlpha_32ARGB;
+    tables.unpremultiplyAlpha32 = UnpremultiplyAlpha_32ARGB_SSE;
+    tables.clearAlpha32 = ClearAlpha_32_SSE;
+    tables.setFullAlpha32 = SetFullAlpha_32_SSE;
+    tables.invertColors32 = InvertColors_32_SSE;
+    tables.grayscale32 = Grayscale_32_SSE;
+    tables.multiplyBlend32 = MultiplyBlend_32_SSE;
+
+    tables.decodeDXT[0] = DecodeBlocks_DXT1_SSE;
+    tables.decodeDXT[1] = DecodeBlocks_DXT3_SSE;
+    tables.decodeDXT[2] = DecodeBlocks_DXT5_SSE;
+
+    tables.encodeDXT[0][VX_DXTQUALITY_FAST] = EncodeBlocks_DXT1_Fast_SSE;
+    tables.encodeDXT[0][VX_DXTQUALITY_HIGH] = EncodeBlocks_DXT1_High_SSE;
+    tables.encodeDXT[1][VX_DXTQUALITY_FAST] = EncodeBlocks_DXT3_Fast_SSE;
+    tables.encodeDXT[1][VX_DXTQUALITY_HIGH] = EncodeBlocks_DXT3_High_SSE;
+    tables.encodeDXT[2][VX_DXTQUALITY_FAST] = EncodeBlocks_DXT5_Fast_SSE;
+    tables.encodeDXT[2][VX_DXTQUALITY_HIGH] = EncodeBlocks_DXT5_High_SSE;
+
+    tables.resampleHorz32 = ResampleHorz_32_SSE;
+    tables.resampleVert32 = ResampleVert_32_SSE;
+
+    tables.mipHorz[0] = MipHorzPair_SSE;
+    tables.mipHorz[1] = MipHorzThree_SSE;
+    tables.mipVert[0] = MipVertPair_SSE;
+    tables.mipVert[1] = MipVertThree_SSE;
+    tables.mipBox = MipBoxPair_SSE;
+
+    tables.ditherAdd = DitherAdd_SSE;
+
+    tables.blend32[VX_BLEND_MULTIPLY] = MultiplyBlend_32_SSE;
+    tables.blend32[VX_BLEND_SRCOVER] = BlendSrcOver_32_SSE;
+    tables.blend32[VX_BLEND_SRCOVER_PREMULTIPLIED] = BlendSrcOverPremultiplied_32_SSE;
+    tables.blend32[VX_BLEND_ADD] = BlendAdd_32_SSE;
+    tables.blend32[VX_BLEND_SCREEN] = BlendScreen_32_SSE;
+    tables.blend32[VX_BLEND_LERP] = BlendLerp_32_SSE;
+
+    tables.decodeYUV[VX_YUV_I420] = DecodeYUVRow_I420_SSE;
+    tables.decodeYUV[VX_YUV_NV12] = DecodeYUVRow_NV12_SSE;
+    tables.decodeYUV[VX_YUV_YUY2] = DecodeYUVRow_YUY2_SSE;
+    tables.encodeYUV[VX_YUV_I420] = EncodeYUVRows_I420_SSE;
+    tables.encodeYUV[VX_YUV_NV12] = EncodeYUVRows_NV12_SSE;
+
+    tables.heightRow[0] = HeightRowLuminance_SSE;
+    tables.heightRow[1] = HeightRowMasked_SSE;
+    tables.normalMapRow = NormalMapRow_SSE;
+    tables.bumpMapRow = BumpMapRow_SSE;
 #endif
 }
 
-void VxBlitEngine::ApplySSSE3Overrides() {
+void VxBlitEngine::ApplySSSE3Overrides(DispatchTables &tables) {
 #if defined(VX_SIMD_SSE2)
-    if (m_EffectiveBlitKernelMode != VX_SIMD_MODE_SSSE3 &&
-        m_EffectiveBlitKernelMode != VX_SIMD_MODE_AVX2) {
+    if (tables.kernelMode != VX_SIMD_MODE_SSSE3 &&
+        tables.kernelMode != VX_SIMD_MODE_AVX2 &&
+        tables.kernelMode != VX_SIMD_MODE_AVX512) {
         return;
     }
-    if (!VxGetSIMDFeatures().SSSE3) {
+    // SIMDe lowers the byte shuffles to TBL on NEON and swizzle on SIMD128.
+    const VxSIMDFeatures &features = VxGetSIMDFeatures();
+    if (!features.SSSE3 && !features.NEON && !features.WASM_SIMD128) {
         return;
     }
 
     // 32-bit to 24-bit and vice versa
-    m_SpecificBlitTable[1][3] = CopyLine_32ARGB_24RGB_SSE;    // ARGB -> RGB (24)
-    m_SpecificBlitTable[3][1] = CopyLine_24RGB_32ARGB_SSE;    // RGB (24) -> ARGB
+    tables.specificBlit[1][3] = CopyLine_32ARGB_24RGB_SSE;    // ARGB -> RGB (24)
+    tables.specificBlit[3][1] = CopyLine_24RGB_32ARGB_SSE;    // RGB (24) -> ARGB
 
     // 32-bit channel swap conversions
-    m_SpecificBlitTable[1][10] = CopyLine_32ARGB_32ABGR_SSE;  // ARGB -> ABGR
-    m_SpecificBlitTable[1][11] = CopyLine_32ARGB_32RGBA_SSE;  // ARGB -> RGBA
-    m_SpecificBlitTable[1][12] = CopyLine_32ARGB_32BGRA_SSE;  // ARGB -> BGRA
-    m_SpecificBlitTable[10][1] = CopyLine_32ABGR_32ARGB_SSE;  // ABGR -> ARGB
-    m_SpecificBlitTable[11][1] = CopyLine_32RGBA_32ARGB_SSE;  // RGBA -> ARGB
-    m_SpecificBlitTable[12][1] = CopyLine_32BGRA_32ARGB_SSE;  // BGRA -> ARGB
-
-    m_SwapRedBlue32 = CopyLine_32ARGB_32ABGR_SSE;
+    tables.specificBlit[1][10] = CopyLine_32ARGB_32ABGR_SSE;  // ARGB -> ABGR
+    tables.specificBlit[1][11] = CopyLine_32ARGB_32RGBA_SSE;  // ARGB -> RGBA
+    tables.specificBlit[1][12] = CopyLine_32ARGB_32BGRA_SSE;  // ARGB -> BGRA
+    tables.specificBlit[10][1] = CopyLine_32ABGR_32ARGB_SSE;  // ABGR -> ARGB
+    tables.specificBlit[11][1] = CopyLine_32RGBA_32ARGB_SSE;  // RGBA -> ARGB
+    tables.specificBlit[12][1] = CopyLine_32BGRA_32ARGB_SSE;  // BGRA -> ARGB
+
+    // Byte-aligned layouts without a specific kernel
+    tables.shuffleBlit[0][0] = CopyLineShuffle_8_8_SSE;
+    tables.shuffleBlit[0][1] = CopyLineShuffle_8_16_SSE;
+    tables.shuffleBlit[0][2] = CopyLineShuffle_8_24_SSE;
+    tables.shuffleBlit[0][3] = CopyLineShuffle_8_32_SSE;
+    tables.shuffleBlit[1][0] = CopyLineShuffle_16_8_SSE;
+    tables.shuffleBlit[1][1] = CopyLineShuffle_16_16_SSE;
+    tables.shuffleBlit[1][2] = CopyLineShuffle_16_24_SSE;
+    tables.shuffleBlit[1][3] = CopyLineShuffle_16_32_SSE;
+    tables.shuffleBlit[2][0] = CopyLineShuffle_24_8_SSE;
+    tables.shuffleBlit[2][1] = CopyLineShuffle_24_16_SSE;
+    tables.shuffleBlit[2][2] = CopyLineShuffle_24_24_SSE;
+    tables.shuffleBlit[2][3] = CopyLineShuffle_24_32_SSE;
+    tables.shuffleBlit[3][0] = CopyLineShuffle_32_8_SSE;
+    tables.shuffleBlit[3][1] = CopyLineShuffle_32_16_SSE;
+    tables.shuffleBlit[3][2] = CopyLineShuffle_32_24_SSE;
+    tables.shuffleBlit[3][3] = CopyLineShuffle_32_32_SSE;
+
+    // 8-bit paletted -> 8-bit paletted remap
+    tables.palettedBlit[0][0] = CopyLine_Paletted8_8_SSE;
+
+    tables.swapRedBlue32 = CopyLine_32ARGB_32ABGR_SSE;
 #endif
 }
 
-void VxBlitEngine::ApplyAVX2Overrides() {
+void VxBlitEngine::ApplyAVX2Overrides(DispatchTables &tables) {
 #if defined(VX_SIMD_AVX2)
-    if (m_EffectiveBlitKernelMode != VX_SIMD_MODE_AVX2) {
+    if (tables.kernelMode != VX_SIMD_MODE_AVX2 &&
+        tables.kernelMode != VX_SIMD_MODE_AVX512) {
         return;
     }
 
@@ -258,59 +598,302 @@ void VxBlitEngine::ApplyAVX2Overrides() {
     // Leave these from earlier tiers:
     // - 32RGB -> 32ARGB: SSE2 outperforms current AVX2 on our benchmark matrix.
     // - 32ARGB <-> 24RGB: SSSE3 outperforms current AVX2 on our benchmark matrix.
-    m_SpecificBlitTable[1][2] = CopyLine_32ARGB_32RGB_AVX2;
-    m_SpecificBlitTable[1][10] = CopyLine_32ARGB_32ABGR_AVX2;
-    m_SpecificBlitTable[10][1] = CopyLine_32ABGR_32ARGB_AVX2;
-    m_SpecificBlitTable[1][11] = CopyLine_32ARGB_32RGBA_AVX2;
-    m_SpecificBlitTable[11][1] = CopyLine_32RGBA_32ARGB_AVX2;
-    m_SpecificBlitTable[1][12] = CopyLine_32ARGB_32BGRA_AVX2;
-    m_SpecificBlitTable[12][1] = CopyLine_32BGRA_32ARGB_AVX2;
-    m_SpecificBlitTable[1][4] = CopyLine_32ARGB_565RGB_AVX2;
-    m_SpecificBlitTable[1][5] = CopyLine_32ARGB_555RGB_AVX2;
-    m_SpecificBlitTable[1][6] = CopyLine_32ARGB_1555ARGB_AVX2;
-    m_SpecificBlitTable[1][7] = CopyLine_32ARGB_4444ARGB_AVX2;
-    m_SpecificBlitTable[4][1] = CopyLine_565RGB_32ARGB_AVX2;
-    m_SpecificBlitTable[5][1] = CopyLine_555RGB_32ARGB_AVX2;
-    m_SpecificBlitTable[6][1] = CopyLine_1555ARGB_32ARGB_AVX2;
-    m_SpecificBlitTable[7][1] = CopyLine_4444ARGB_32ARGB_AVX2;
-    m_SetAlphaTable[3] = SetAlpha_32_AVX2;
-    m_CopyAlphaTable[3] = CopyAlpha_32_AVX2;
-    m_PalettedBlitTable[0][3] = CopyLine_Paletted8_32ARGB_AVX2;
-
-    m_FillLine32 = FillLine_32_AVX2;
-    m_FillLine16 = FillLine_16_AVX2;
-    m_PremultiplyAlpha32 = PremultiplyAlpha_32ARGB_AVX2;
-    m_UnpremultiplyAlpha32 = UnpremultiplyAlpha_32ARGB_AVX2;
-    m_SwapRedBlue32 = CopyLine_32ARGB_32ABGR_AVX2;
-    m_ClearAlpha32 = ClearAlpha_32_AVX2;
-    m_SetFullAlpha32 = SetFullAlpha_32_AVX2;
-    m_InvertColors32 = InvertColors_32_AVX2;
-    m_Grayscale32 = Grayscale_32_AVX2;
-    m_MultiplyBlend32 = MultiplyBlend_32_AVX2;
+    tables.specificBlit[1][2] = CopyLine_32ARGB_32RGB_AVX2;
+    tables.specificBlit[1][10] = CopyLine_32ARGB_32ABGR_AVX2;
+    tables.specificBlit[10][1] = CopyLine_32ABGR_32ARGB_AVX2;
+    tables.specificBlit[1][11] = CopyLine_32ARGB_32RGBA_AVX2;
+    tables.specificBlit[11][1] = CopyLine_32RGBA_32ARGB_AVX2;
+    tables.specificBlit[1][12] = CopyLine_32ARGB_32BGRA_AVX2;
+    tables.specificBlit[12][1] = CopyLine_32BGRA_32ARGB_AVX2;
+    tables.specificBlit[1][4] = CopyLine_32ARGB_565RGB_AVX2;
+    tables.specificBlit[1][5] = CopyLine_32ARGB_555RGB_AVX2;
+    tables.specificBlit[1][6] = CopyLine_32ARGB_1555ARGB_AVX2;
+    tables.specificBlit[1][7] = CopyLine_32ARGB_4444ARGB_AVX2;
+    tables.specificBlit[4][1] = CopyLine_565RGB_32ARGB_AVX2;
+    tables.specificBlit[5][1] = CopyLine_555RGB_32ARGB_AVX2;
+    tables.specificBlit[6][1] = CopyLine_1555ARGB_32ARGB_AVX2;
+    tables.specificBlit[7][1] = CopyLine_4444ARGB_32ARGB_AVX2;
+    tables.setAlpha[3] = SetAlpha_32_AVX2;
+    tables.copyAlpha[3] = CopyAlpha_32_AVX2;
+    tables.palettedBlit[0][0] = CopyLine_Paletted8_8_AVX2;
+    tables.palettedBlit[0][1] = CopyLine_Paletted8_16_AVX2;
+    tables.palettedBlit[0][2] = CopyLine_Paletted8_24RGB_AVX2;
+    tables.palettedBlit[0][3] = CopyLine_Paletted8_32ARGB_AVX2;
+
+    tables.fillLine32 = FillLine_32_AVX2;
+    tables.fillLine16 = FillLine_16_AVX2;
+    tables.premultiplyAlpha32 = PremultiplyAlpha_32ARGB_AVX2;
+    tables.unpremultiplyAlpha32 = UnpremultiplyAlpha_32ARGB_AVX2;
+    tables.swapRedBlue32 = CopyLine_32ARGB_32ABGR_AVX2;
+    tables.clearAlpha32 = ClearAlpha_32_AVX2;
+    tables.setFullAlpha32 = SetFullAlpha_32_AVX2;
+    tables.invertColors32 = InvertColors_32_AVX2;
+    tables.grayscale32 = Grayscale_32_AVX2;
+    tables.multiplyBlend32 = MultiplyBlend_32_AVX2;
+
+    tables.decodeDXT[0] = DecodeBlocks_DXT1_AVX2;
+    tables.decodeDXT[1] = DecodeBlocks_DXT3_AVX2;
+    tables.decodeDXT[2] = DecodeBlocks_DXT5_AVX2;
+
+    tables.resampleHorz32 = ResampleHorz_32_AVX2;
+    tables.resampleVert32 = ResampleVert_32_AVX2;
+
+    tables.mipHorz[0] = MipHorzPair_AVX2;
+    tables.mipVert[0] = MipVertPair_AVX2;
+    tables.mipVert[1] = MipVertThree_AVX2;
+    tables.mipBox = MipBoxPair_AVX2;
+
+    tables.ditherAdd = DitherAdd_AVX2;
+
+    tables.blend32[VX_BLEND_MULTIPLY] = MultiplyBlend_32_AVX2;
+    tables.blend32[VX_BLEND_SRCOVER] = BlendSrcOver_32_AVX2;
+    tables.blend32[VX_BLEND_SRCOVER_PREMULTIPLIED] = BlendSrcOverPremultiplied_32_AVX2;
+    tables.blend32[VX_BLEND_ADD] = BlendAdd_32_AVX2;
+    tables.blend32[VX_BLEND_SCREEN] = BlendScreen_32_AVX2;
+    tables.blend32[VX_BLEND_LERP] = BlendLerp_32_AVX2;
+
+    tables.decodeYUV[VX_YUV_I420] = DecodeYUVRow_I420_AVX2;
+    tables.decodeYUV[VX_YUV_NV12] = DecodeYUVRow_NV12_AVX2;
+    tables.decodeYUV[VX_YUV_YUY2] = DecodeYUVRow_YUY2_AVX2;
+    tables.encodeYUV[VX_YUV_I420] = EncodeYUVRows_I420_AVX2;
+    tables.encodeYUV[VX_YUV_NV12] = EncodeYUVRows_NV12_AVX2;
+
+    tables.heightRow[0] = HeightRowLuminance_AVX2;
+    tables.heightRow[1] = HeightRowMasked_AVX2;
+    tables.normalMapRow = NormalMapRow_AVX2;
+    tables.bumpMapRow = BumpMapRow_AVX2;
+#endif
+}
+
+void VxBlitEngine::ApplyAVX512Overrides(DispatchTables &tables) {
+#if defined(VX_SIMD_AVX512)
+    if (tables.kernelMode != VX_SIMD_MODE_AVX512) {
+        return;
+    }
+
+    // Same policy as the AVX2 tier: install a kernel only where it beats the
+    // tier below it, and keep every tier bit-exact with the scalar kernels.
+    //
+    // Leave these from earlier tiers:
+    // - 32RGB -> 32ARGB and 32ARGB -> 24RGB: SSE2/SSSE3 match or beat AVX-512.
+    // - Byte-aligned layout shuffles: SSSE3 PSHUFB outperforms a VPERMB row.
+    tables.specificBlit[1][2] = CopyLine_32ARGB_32RGB_AVX512;
+    tables.specificBlit[3][1] = CopyLine_24RGB_32ARGB_AVX512;
+    tables.specificBlit[1][10] = CopyLine_32ARGB_32ABGR_AVX512;
+    tables.specificBlit[10][1] = CopyLine_32ABGR_32ARGB_AVX512;
+    tables.specificBlit[1][11] = CopyLine_32ARGB_32RGBA_AVX512;
+    tables.specificBlit[11][1] = CopyLine_32RGBA_32ARGB_AVX512;
+    tables.specificBlit[1][12] = CopyLine_32ARGB_32BGRA_AVX512;
+    tables.specificBlit[12][1] = CopyLine_32BGRA_32ARGB_AVX512;
+    tables.specificBlit[1][4] = CopyLine_32ARGB_565RGB_AVX512;
+    tables.specificBlit[1][5] = CopyLine_32ARGB_555RGB_AVX512;
+    tables.specificBlit[1][6] = CopyLine_32ARGB_1555ARGB_AVX512;
+    tables.specificBlit[1][7] = CopyLine_32ARGB_4444ARGB_AVX512;
+    tables.specificBlit[4][1] = CopyLine_565RGB_32ARGB_AVX512;
+    tables.specificBlit[5][1] = CopyLine_555RGB_32ARGB_AVX512;
+    tables.specificBlit[6][1] = CopyLine_1555ARGB_32ARGB_AVX512;
+    tables.specificBlit[7][1] = CopyLine_4444ARGB_32ARGB_AVX512;
+
+    tables.palettedBlit[0][0] = CopyLine_Paletted8_8_AVX512;
+    tables.palettedBlit[0][1] = CopyLine_Paletted8_16_AVX512;
+    tables.palettedBlit[0][2] = CopyLine_Paletted8_24RGB_AVX512;
+    tables.palettedBlit[0][3] = CopyLine_Paletted8_32ARGB_AVX512;
+
+    tables.fillLine32 = FillLine_32_AVX512;
+    tables.fillLine16 = FillLine_16_AVX512;
+    tables.premultiplyAlpha32 = PremultiplyAlpha_32ARGB_AVX512;
+    tables.unpremultiplyAlpha32 = UnpremultiplyAlpha_32ARGB_AVX512;
+    tables.swapRedBlue32 = CopyLine_32ARGB_32ABGR_AVX512;
 #endif
 }
 
-void VxBlitEngine::RebuildTablesUnlocked() {
-    ResetDispatchTables();
+VxBlitEngine::DispatchTables *VxBlitEngine::TierTablesUnlocked(int slot, XBOOL forceRebuild) {
+    DispatchTables *tables = m_TierTables[slot];
+
+    if (!tables || forceRebuild) {
+        DispatchTables *fresh = new DispatchTables();
+        fresh->kernelMode = slot;
+        ResetDispatchTables(*fresh);
+
+        BuildGenericTables(*fresh);
+        BuildX86Table(*fresh);
+        ResetHotPathKernels(*fresh);
+
+        ApplySSE2Overrides(*fresh);
+        ApplySSSE3Overrides(*fresh);
+        ApplyAVX2Overrides(*fresh);
+        ApplyAVX512Overrides(*fresh);
+
+        if (tables && memcmp(tables, fresh, sizeof(DispatchTables)) == 0) {
+            // Nothing changed; keep the published snapshot.
+            delete fresh;
+        } else {
+            // Readers may still hold the previous snapshot for this tier.
+            if (tables) {
+                m_RetiredTables.PushBack(tables);
+            }
+            m_TierTables[slot] = fresh;
+            tables = fresh;
+        }
+    }
+    return tables;
+}
 
-    BuildGenericTables();
-    BuildX86Table();
-    ResetHotPathKernels();
+void VxBlitEngine::PublishTablesUnlocked(XBOOL forceRebuild) {
+    DispatchTables *tables = TierTablesUnlocked(m_EffectiveBlitKernelMode, forceRebuild);
+    VxAtomicStorePtr(&m_ActiveTables, ComposeTablesUnlocked(tables));
+}
 
-    ApplySSE2Overrides();
-    ApplySSSE3Overrides();
-    ApplyAVX2Overrides();
+const VxBlitEngine::DispatchTables &VxBlitEngine::AcquireTables() const {
+    return *static_cast<const DispatchTables *>(VxAtomicLoadPtr(const_cast<void *volatile *>(&m_ActiveTables)));
 }
 
 void VxBlitEngine::RebuildTables() {
     VxMutexLock lock(m_Lock);
-    RebuildTablesUnlocked();
+    PublishTablesUnlocked(TRUE);
 }
 
 void VxBlitEngine::ApplySIMDMode(int effectiveMode) {
     VxMutexLock lock(m_Lock);
+    m_EffectiveSIMDMode = effectiveMode;
     m_EffectiveBlitKernelMode = CollapseSIMDModeToBlitKernelTier(effectiveMode);
-    RebuildTablesUnlocked();
+    PublishTablesUnlocked(FALSE);
+}
+
+//==============================================================================
+//  Per-Entry Dispatch
+//==============================================================================
+
+namespace {
+
+// "blit.*" registry entries. Each covers a family of kernels that share a
+// table, so one entry rebinds all of them.
+const char *const kBlitDispatchEntries[] = {
+    "convert",
+    "alpha",
+    "paletted",
+    "shuffle",
+    "fill",
+    "premultiply",
+    "unpremultiply",
+    "swapRedBlue",
+    "pixelOps",
+    "dxtDecode",
+    "dxtEncode",
+    "resample",
+    "mipmap",
+    "dither",
+    "blend",
+    "yuvDecode",
+    "yuvEncode",
+    "normalMap"
+};
+
+const int BLIT_DISPATCH_ENTRY_COUNT = sizeof(kBlitDispatchEntries) / sizeof(kBlitDispatchEntries[0]);
+
+const VxSIMDDispatchModule kBlitDispatchModule = {"blit", kBlitDispatchEntries, BLIT_DISPATCH_ENTRY_COUNT};
+
+// Kernel tiers, lowest first.
+const int kBlitKernelTiers[] = {
+    VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_SSSE3, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_AVX512
+};
+
+} // namespace
+
+// Byte range from the first to the end of the last of a run of fields.
+#define VX_BLIT_DISPATCH_RANGE(first, last)                                                                        \
+    {offsetof(DispatchTables, first),                                                                             \
+     offsetof(DispatchTables, last) + sizeof(DispatchTables::last) - offsetof(DispatchTables, first)}
+
+const size_t VxBlitEngine::s_DispatchEntryRanges[][2] = {
+    VX_BLIT_DISPATCH_RANGE(genericBlit, specificBlit),
+    VX_BLIT_DISPATCH_RANGE(setAlpha, copyAlpha),
+    VX_BLIT_DISPATCH_RANGE(palettedBlit, palettedBlit),
+    VX_BLIT_DISPATCH_RANGE(shuffleBlit, shuffleBlit),
+    VX_BLIT_DISPATCH_RANGE(fillLine32, fillLine16),
+    VX_BLIT_DISPATCH_RANGE(premultiplyAlpha32, premultiplyAlpha32),
+    VX_BLIT_DISPATCH_RANGE(unpremultiplyAlpha32, unpremultiplyAlpha32),
+    VX_BLIT_DISPATCH_RANGE(swapRedBlue32, swapRedBlue32),
+    VX_BLIT_DISPATCH_RANGE(clearAlpha32, multiplyBlend32),
+    VX_BLIT_DISPATCH_RANGE(decodeDXT, decodeDXT),
+    VX_BLIT_DISPATCH_RANGE(encodeDXT, encodeDXT),
+    VX_BLIT_DISPATCH_RANGE(resampleHorz32, resampleVert32),
+    VX_BLIT_DISPATCH_RANGE(mipHorz, mipBox),
+    VX_BLIT_DISPATCH_RANGE(ditherAdd, ditherAdd),
+    VX_BLIT_DISPATCH_RANGE(blend32, blend32),
+    VX_BLIT_DISPATCH_RANGE(decodeYUV, decodeYUV),
+    VX_BLIT_DISPATCH_RANGE(encodeYUV, encodeYUV),
+    VX_BLIT_DISPATCH_RANGE(heightRow, bumpMapRow),
+};
+
+#undef VX_BLIT_DISPATCH_RANGE
+
+VxBlitEngine::DispatchTables *VxBlitEngine::ComposeTablesUnlocked(DispatchTables *tables) {
+    static_assert(sizeof(s_DispatchEntryRanges) / sizeof(s_DispatchEntryRanges[0]) == BLIT_DISPATCH_ENTRY_COUNT,
+                  "every blit dispatch entry needs a table range");
+
+    int modes[BLIT_DISPATCH_ENTRY_COUNT];
+    VxSIMDDispatchResolve(kBlitDispatchModule, m_EffectiveSIMDMode, modes);
+
+    // Entries overridden to another tier take that tier's kernels.
+    DispatchTables composed = *tables;
+    bool mixed = false;
+    for (int i = 0; i < BLIT_DISPATCH_ENTRY_COUNT; ++i) {
+        const int tier = CollapseSIMDModeToBlitKernelTier(modes[i]);
+        if (tier != tables->kernelMode) {
+            const XBYTE *from = reinterpret_cast<const XBYTE *>(TierTablesUnlocked(tier, FALSE));
+            const size_t offset = s_DispatchEntryRanges[i][0];
+            memcpy(reinterpret_cast<XBYTE *>(&composed) + offset, from + offset, s_DispatchEntryRanges[i][1]);
+            mixed = true;
+        }
+    }
+
+    DispatchTables *result = tables;
+    if (mixed) {
+        result = nullptr;
+        for (int i = 0; i < m_ComposedTables.Size() && !result; ++i) {
+            if (memcmp(m_ComposedTables[i], &composed, sizeof(DispatchTables)) == 0) {
+                result = m_ComposedTables[i];
+            }
+        }
+        if (!result) {
+            result = new DispatchTables(composed);
+            m_ComposedTables.PushBack(result);
+        }
+    }
+
+    // Report each entry under the lowest tier that has the same kernels, and
+    // list the tiers up to the best one on this CPU that change them.
+    const int topTier = CollapseSIMDModeToBlitKernelTier(VxGetSIMDAutoBackendInternal());
+    int bound[BLIT_DISPATCH_ENTRY_COUNT];
+    unsigned int candidates[BLIT_DISPATCH_ENTRY_COUNT];
+    for (int i = 0; i < BLIT_DISPATCH_ENTRY_COUNT; ++i) {
+        const size_t offset = s_DispatchEntryRanges[i][0];
+        const size_t size = s_DispatchEntryRanges[i][1];
+        const XBYTE *current = reinterpret_cast<const XBYTE *>(result) + offset;
+        const XBYTE *previous = nullptr;
+        bound[i] = -1;
+        candidates[i] = 0;
+        for (size_t t = 0; t < sizeof(kBlitKernelTiers) / sizeof(kBlitKernelTiers[0]); ++t) {
+            const int tier = kBlitKernelTiers[t];
+            if (tier > topTier) {
+                break;
+            }
+            const XBYTE *kernels = reinterpret_cast<const XBYTE *>(TierTablesUnlocked(tier, FALSE)) + offset;
+            if (!previous || memcmp(kernels, previous, size) != 0) {
+                candidates[i] |= 1u << tier;
+                previous = kernels;
+            }
+            if (bound[i] < 0 && memcmp(kernels, current, size) == 0) {
+                bound[i] = tier;
+            }
+        }
+        if (bound[i] < 0) {
+            bound[i] = result->kernelMode;
+        }
+    }
+    VxSIMDDispatchPublish(kBlitDispatchModule, bound, candidates);
+    return result;
 }
 
 //==============================================================================
@@ -402,7 +985,7 @@ VX_PIXELFORMAT VxString2PixelFormat(const char *Name) {
 }
 
 void VxBlitEngine::SetupBlitInfo(VxBlitInfo &info, const VxImageDescEx &src_desc,
-                                  const VxImageDescEx &dst_desc) {
+                                  const VxImageDescEx &dst_desc, const XBYTE byteShuffle[16]) {
     info.srcBytesPerPixel = src_desc.BitsPerPixel / 8;
     info.dstBytesPerPixel = dst_desc.BitsPerPixel / 8;
     info.width = src_desc.Width;
@@ -445,16 +1028,27 @@ void VxBlitEngine::SetupBlitInfo(VxBlitInfo &info, const VxImageDescEx &src_desc
     info.colorMap = src_desc.ColorMap;
     info.colorMapEntries = src_desc.ColorMapEntries;
     info.bytesPerColorEntry = src_desc.BytesPerColorEntry;
+    info.dstColorMap = dst_desc.ColorMap;
+    info.dstColorMapEntries = dst_desc.ColorMapEntries;
+    info.dstBytesPerColorEntry = dst_desc.BytesPerColorEntry;
+
+    memcpy(info.byteShuffle, byteShuffle, sizeof(info.byteShuffle));
 }
 
 //==============================================================================
 //  Dispatch Lookup
 //==============================================================================
 
-VxBlitLineFunc VxBlitEngine::GetBlitFunction(const VxImageDescEx &src_desc,
-                                              const VxImageDescEx &dst_desc) {
-    VX_PIXELFORMAT srcFmt = GetPixelFormat(src_desc);
-    VX_PIXELFORMAT dstFmt = GetPixelFormat(dst_desc);
+VxBlitLineFunc VxBlitEngine::GetBlitFunction(const DispatchTables &tables, const VxImageDescEx &src_desc,
+                                              const VxImageDescEx &dst_desc, XBYTE byteShuffle[16]) {
+    return ResolveBlitFunction(tables, GetPixelFormat(src_desc), GetPixelFormat(dst_desc), src_desc, dst_desc,
+                               byteShuffle);
+}
+
+VxBlitLineFunc VxBlitEngine::ResolveBlitFunction(const DispatchTables &tables, VX_PIXELFORMAT srcFmt,
+                                                  VX_PIXELFORMAT dstFmt, const VxImageDescEx &src_desc,
+                                                  const VxImageDescEx &dst_desc, XBYTE byteShuffle[16]) {
+    memset(byteShuffle, 0x80, 16);
 
     // Check for paletted source image
     if (src_desc.ColorMapEntries > 0 && src_desc.ColorMap != nullptr) {
@@ -465,7 +1059,7 @@ VxBlitLineFunc VxBlitEngine::GetBlitFunction(const VxImageDescEx &src_desc,
         if (srcBpp == 1 && dstBpp >= 1 && dstBpp <= 4) {
             // Index copy does not require palette entry expansion.
             if (dstBpp == 1) {
-                VxBlitLineFunc func = m_PalettedBlitTable[0][0];
+                VxBlitLineFunc func = tables.palettedBlit[0][0];
                 if (func) return func;
             }
 
@@ -474,11 +1068,7 @@ VxBlitLineFunc VxBlitEngine::GetBlitFunction(const VxImageDescEx &src_desc,
                 return nullptr;
             }
 
-            // For 16-bit destinations with alpha (1555, 4444), use alpha-aware function
-            if (dstBpp == 2 && dst_desc.AlphaMask != 0) {
-                return CopyLine_Paletted8_16Alpha;
-            }
-            VxBlitLineFunc func = m_PalettedBlitTable[0][dstBpp - 1];
+            VxBlitLineFunc func = tables.palettedBlit[0][dstBpp - 1];
             if (func) return func;
         }
     }
@@ -491,11 +1081,11 @@ VxBlitLineFunc VxBlitEngine::GetBlitFunction(const VxImageDescEx &src_desc,
     // Check for specific optimized function
     if (srcFmt > UNKNOWN_PF && srcFmt < FORMAT_TABLE_SIZE &&
         dstFmt > UNKNOWN_PF && dstFmt < FORMAT_TABLE_SIZE) {
-        VxBlitLineFunc func = m_SpecificBlitTable[srcFmt][dstFmt];
+        VxBlitLineFunc func = tables.specificBlit[srcFmt][dstFmt];
         if (func) return func;
     }
 
-    // DXT formats not supported for direct blitting
+    // DXT formats have no line kernels (sources are handled by DecompressBlocks)
     if ((srcFmt >= _DXT1 && srcFmt <= _DXT5) ||
         (dstFmt >= _DXT1 && dstFmt <= _DXT5)) {
         return nullptr;
@@ -506,28 +1096,32 @@ VxBlitLineFunc VxBlitEngine::GetBlitFunction(const VxImageDescEx &src_desc,
     int dstBpp = dst_desc.BitsPerPixel / 8;
 
     if (srcBpp >= 1 && srcBpp <= 4 && dstBpp >= 1 && dstBpp <= 4) {
-        return m_GenericBlitTable[srcBpp - 1][dstBpp - 1];
+        // Whole-byte channels only move bytes around: the shuffle is derived
+        // once here instead of masking and shifting every pixel.
+        VxBlitLineFunc func = tables.shuffleBlit[srcBpp - 1][dstBpp - 1];
+        if (func && BuildByteShuffle(src_desc, dst_desc, byteShuffle)) return func;
+        return tables.genericBlit[srcBpp - 1][dstBpp - 1];
     }
 
     return nullptr;
 }
 
-VxBlitLineFunc VxBlitEngine::GetSetAlphaFunction(const VxImageDescEx &dst_desc) {
+VxBlitLineFunc VxBlitEngine::GetSetAlphaFunction(const DispatchTables &tables, const VxImageDescEx &dst_desc) {
     if (!dst_desc.AlphaMask) return nullptr;
 
     int bpp = dst_desc.BitsPerPixel / 8;
     if (bpp >= 1 && bpp <= 4) {
-        return m_SetAlphaTable[bpp - 1];
+        return tables.setAlpha[bpp - 1];
     }
     return nullptr;
 }
 
-VxBlitLineFunc VxBlitEngine::GetCopyAlphaFunction(const VxImageDescEx &dst_desc) {
+VxBlitLineFunc VxBlitEngine::GetCopyAlphaFunction(const DispatchTables &tables, const VxImageDescEx &dst_desc) {
     if (!dst_desc.AlphaMask) return nullptr;
 
     int bpp = dst_desc.BitsPerPixel / 8;
     if (bpp >= 1 && bpp <= 4) {
-        return m_CopyAlphaTable[bpp - 1];
+        return tables.copyAlpha[bpp - 1];
     }
     return nullptr;
 }
@@ -537,8 +1131,7 @@ VxBlitLineFunc VxBlitEngine::GetCopyAlphaFunction(const VxImageDescEx &dst_desc)
 //==============================================================================
 
 void VxBlitEngine::DoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
-    VxMutexLock lock(m_Lock);
-
+    VX_PROFILE_SCOPE("VxBlitEngine::DoBlit");
     // Original binary precondition: only allow if 32-bit OR same dimensions.
     // Non-32-bit images with different dimensions are rejected.
     if (src_desc.BitsPerPixel != 32) {
@@ -552,6 +1145,16 @@ void VxBlitEngine::DoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &ds
     if (src_desc.Width <= 0 || src_desc.Height <= 0) return;
     if (dst_desc.Width <= 0 || dst_desc.Height <= 0) return;
 
+    // Block-compressed sources are decoded block row by block row.
+    if (IsDXTFormat(GetPixelFormat(src_desc))) {
+        DecompressBlocks(AcquireTables(), src_desc, dst_desc, FALSE);
+        return;
+    }
+    if (IsDXTFormat(GetPixelFormat(dst_desc))) {
+        CompressBlocks(AcquireTables(), src_desc, dst_desc, FALSE);
+        return;
+    }
+
     // Truecolor -> paletted conversion goes through quantization and is complete.
     // Do not continue with a second blit pass (it would overwrite palette indices).
     if (dst_desc.ColorMapEntries > 0 && src_desc.ColorMapEntries == 0) {
@@ -560,47 +1163,46 @@ void VxBlitEngine::DoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &ds
     }
 
     // Get blit function
-    VxBlitLineFunc blitFunc = GetBlitFunction(src_desc, dst_desc);
+    XBYTE byteShuffle[16];
+    VxBlitLineFunc blitFunc = GetBlitFunction(AcquireTables(), src_desc, dst_desc, byteShuffle);
     if (!blitFunc) return;
 
-    // Setup blit info
-    SetupBlitInfo(m_BlitInfo, src_desc, dst_desc);
-    m_BlitInfo.srcBytesPerLine = src_desc.BytesPerLine;
-    m_BlitInfo.dstBytesPerLine = dst_desc.BytesPerLine;
-    m_BlitInfo.operationStamp = NextOperationStamp();
+    // Setup blit info (per call, so concurrent blits never share it)
+    VxBlitInfo info;
+    SetupBlitInfo(info, src_desc, dst_desc, byteShuffle);
+    info.srcBytesPerLine = src_desc.BytesPerLine;
+    info.dstBytesPerLine = dst_desc.BytesPerLine;
+    info.operationStamp = NextOperationStamp();
 
     // Check if resize is needed (only for 32-bit)
     if (dst_desc.Width != src_desc.Width || dst_desc.Height != src_desc.Height) {
         // At this point src must be 32-bit (per precondition above)
-        DoBlitWithResize(src_desc, dst_desc, blitFunc);
+        DoBlitWithResize(info, src_desc, dst_desc, blitFunc);
         return;
     }
 
     // Same-size blit: process each scanline
     if (src_desc.Height <= 0) return;
 
-    const XBYTE *srcRow = src_desc.Image;
-    XBYTE *dstRow = dst_desc.Image;
-
-    for (int y = 0; y < src_desc.Height; ++y) {
-        m_BlitInfo.srcLine = srcRow;
-        m_BlitInfo.dstLine = dstRow;
-
-        blitFunc(&m_BlitInfo);
-
-        srcRow += src_desc.BytesPerLine;
-        dstRow += dst_desc.BytesPerLine;
-    }
+    BlitRows(info, src_desc.Image, src_desc.BytesPerLine, dst_desc.Image, dst_desc.BytesPerLine,
+             src_desc.Height, blitFunc);
 }
 
 void VxBlitEngine::DoBlitUpsideDown(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
-    VxMutexLock lock(m_Lock);
-
     if (src_desc.Width != dst_desc.Width) return;
     if (src_desc.Height != dst_desc.Height) return;
     if (!src_desc.Image || !dst_desc.Image) return;
     if (src_desc.Width <= 0 || src_desc.Height <= 0) return;
 
+    if (IsDXTFormat(GetPixelFormat(src_desc))) {
+        DecompressBlocks(AcquireTables(), src_desc, dst_desc, TRUE);
+        return;
+    }
+    if (IsDXTFormat(GetPixelFormat(dst_desc))) {
+        CompressBlocks(AcquireTables(), src_desc, dst_desc, TRUE);
+        return;
+    }
+
     // Truecolor -> paletted upside-down path:
     // quantize into a temporary paletted buffer, then run regular upside-down copy.
     if (dst_desc.ColorMapEntries > 0 && src_desc.ColorMapEntries == 0) {
@@ -622,400 +1224,1500 @@ void VxBlitEngine::DoBlitUpsideDown(const VxImageDescEx &src_desc, const VxImage
         return;
     }
 
-    VxBlitLineFunc blitFunc = GetBlitFunction(src_desc, dst_desc);
+    XBYTE byteShuffle[16];
+    VxBlitLineFunc blitFunc = GetBlitFunction(AcquireTables(), src_desc, dst_desc, byteShuffle);
     if (!blitFunc) return;
 
-    SetupBlitInfo(m_BlitInfo, src_desc, dst_desc);
-    m_BlitInfo.srcBytesPerLine = src_desc.BytesPerLine;
-    m_BlitInfo.dstBytesPerLine = dst_desc.BytesPerLine;
-    m_BlitInfo.operationStamp = NextOperationStamp();
+    VxBlitInfo info;
+    SetupBlitInfo(info, src_desc, dst_desc, byteShuffle);
+    info.srcBytesPerLine = src_desc.BytesPerLine;
+    info.dstBytesPerLine = dst_desc.BytesPerLine;
+    info.operationStamp = NextOperationStamp();
+
+    // Source starts at last row and goes backwards, destination goes forward
+    // (matching original binary)
+    const XBYTE *srcLast = src_desc.Image + (src_desc.Height - 1) * src_desc.BytesPerLine;
+    BlitRows(info, srcLast, -static_cast<int>(src_desc.BytesPerLine), dst_desc.Image, dst_desc.BytesPerLine,
+             src_desc.Height, blitFunc);
+}
 
-    // Source starts at last row, destination at first row (matching original binary)
-    const XBYTE *srcRow = src_desc.Image + (src_desc.Height - 1) * src_desc.BytesPerLine;
-    XBYTE *dstRow = dst_desc.Image;
+//==============================================================================
+//  Sub-rectangle Blits
+//==============================================================================
 
-    for (int y = 0; y < src_desc.Height; ++y) {
-        m_BlitInfo.srcLine = srcRow;
-        m_BlitInfo.dstLine = dstRow;
+XBOOL VxBlitEngine::DoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, const CKRECT *srcRect,
+                           const CKRECT *dstRect) {
+    VX_PROFILE_SCOPE("VxBlitEngine::DoBlit(rect)");
+    if (!src_desc.Image || !dst_desc.Image) return FALSE;
 
-        blitFunc(&m_BlitInfo);
+    CKRECT s, d;
+    if (!ResolveRect(src_desc, srcRect, s) || !ResolveRect(dst_desc, dstRect, d)) return FALSE;
 
-        srcRow -= src_desc.BytesPerLine;  // Source goes backwards
-        dstRow += dst_desc.BytesPerLine;  // Destination goes forward
+    if (s.right - s.left == d.right - d.left && s.bottom - s.top == d.bottom - d.top) {
+        if (!ClipCopyRects(src_desc, dst_desc, s, d, false)) return TRUE;
+    } else {
+        // Scaled rectangles are not clipped: that would change the scale factor.
+        if (!RectInsideImage(src_desc, s) || !RectInsideImage(dst_desc, d)) return FALSE;
+        if (src_desc.BitsPerPixel != 32) return FALSE;
     }
+
+    VxImageDescEx srcView, dstView;
+    if (!MakeRectView(src_desc, s, srcView) || !MakeRectView(dst_desc, d, dstView)) return FALSE;
+    DoBlit(srcView, dstView);
+    return TRUE;
+}
+
+XBOOL VxBlitEngine::DoBlitUpsideDown(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc,
+                                     const CKRECT *srcRect, const CKRECT *dstRect) {
+    if (!src_desc.Image || !dst_desc.Image) return FALSE;
+
+    CKRECT s, d;
+    if (!ResolveRect(src_desc, srcRect, s) || !ResolveRect(dst_desc, dstRect, d)) return FALSE;
+    if (s.right - s.left != d.right - d.left || s.bottom - s.top != d.bottom - d.top) return FALSE;
+    if (!ClipCopyRects(src_desc, dst_desc, s, d, true)) return TRUE;
+
+    VxImageDescEx srcView, dstView;
+    if (!MakeRectView(src_desc, s, srcView) || !MakeRectView(dst_desc, d, dstView)) return FALSE;
+    DoBlitUpsideDown(srcView, dstView);
+    return TRUE;
 }
 
 //==============================================================================
-//  Alpha Operations
+//  Streaming Blits
 //==============================================================================
 
-void VxBlitEngine::DoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE AlphaValue) {
-    VxMutexLock lock(m_Lock);
-
-    if (!dst_desc.AlphaMask) return;
-    if (!dst_desc.Image) return;
-    if (dst_desc.Width < 0) return;
+namespace {
 
-    VxBlitLineFunc alphaFunc = GetSetAlphaFunction(dst_desc);
-    if (!alphaFunc) return;
+// Default size of one source band plus one destination band.
+const int STREAM_BAND_BYTES = 1 << 20;
 
-    // Setup blit info for alpha operation
-    m_BlitInfo.dstBytesPerPixel = dst_desc.BitsPerPixel / 8;
-    m_BlitInfo.dstAlphaMask = dst_desc.AlphaMask;
-    m_BlitInfo.alphaMaskInv = ~dst_desc.AlphaMask;
-    m_BlitInfo.width = dst_desc.Width;
-    m_BlitInfo.dstBytesPerLine = dst_desc.BytesPerLine;
-    m_BlitInfo.operationStamp = NextOperationStamp();
+// Source row DoBlitWithResize() samples for destination row @p y. 64-bit so
+// images taller than 32767 rows do not overflow the 16.16 step.
+inline int StreamSourceRow(int y, long long step, int srcHeight) {
+    return static_cast<int>(XMin((static_cast<long long>(y) * step) >> 16, static_cast<long long>(srcHeight - 1)));
+}
 
-    // Scale 8-bit alpha to target bit depth
-    XDWORD alphaMask = dst_desc.AlphaMask;
-    int alphaShift = static_cast<int>(GetBitShiftLocal(alphaMask));
+} // namespace
 
-    // Count bits in the alpha mask
-    XDWORD tempMask = alphaMask >> alphaShift;
-    int alphaBits = 0;
-    while (tempMask & 1) {
-        ++alphaBits;
-        tempMask >>= 1;
+XBOOL VxBlitEngine::StreamBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VxBlitReadFunc read,
+                               VxBlitWriteFunc write, void *userData, int bandRows) {
+    if (!src_desc.Image && !read) return FALSE;
+    if (!dst_desc.Image && !write) return FALSE;
+    if (src_desc.Width <= 0 || src_desc.Height <= 0) return FALSE;
+    if (dst_desc.Width <= 0 || dst_desc.Height <= 0) return FALSE;
+    if (src_desc.BytesPerLine <= 0 || dst_desc.BytesPerLine <= 0 || bandRows < 0) return FALSE;
+
+    const VX_PIXELFORMAT srcFmt = GetPixelFormat(src_desc);
+    const VX_PIXELFORMAT dstFmt = GetPixelFormat(dst_desc);
+    if (IsDXTFormat(srcFmt) || IsDXTFormat(dstFmt)) return FALSE;
+    if (dst_desc.ColorMapEntries > 0 && src_desc.ColorMapEntries == 0) return FALSE;
+
+    // Same preconditions as DoBlitWithResize(); its 16.16 column step limits the width.
+    const XBOOL resize = src_desc.Width != dst_desc.Width || src_desc.Height != dst_desc.Height;
+    if (resize && (src_desc.BitsPerPixel != 32 || src_desc.Width >= 0x8000 || dst_desc.Width >= 0x8000)) {
+        return FALSE;
     }
 
-    // Scale the 8-bit alpha value to the target bit depth
-    XDWORD scaledAlpha;
-    if (alphaBits >= 8) {
-        // Direct placement for 8+ bit alpha
-        scaledAlpha = (XDWORD)AlphaValue << alphaShift;
-    } else {
-        // Scale down from 8-bit to target bits by taking top bits
-        int shiftAmount = 8 - alphaBits;
-        scaledAlpha = ((XDWORD)AlphaValue >> shiftAmount) << alphaShift;
+    const DispatchTables &tables = AcquireTables();
+    XBYTE byteShuffle[16];
+    VxBlitLineFunc blitFunc = ResolveBlitFunction(tables, srcFmt, dstFmt, src_desc, dst_desc, byteShuffle);
+    if (!blitFunc) return FALSE;
+
+    VxBlitInfo info;
+    SetupBlitInfo(info, src_desc, dst_desc, byteShuffle);
+    info.srcBytesPerLine = src_desc.BytesPerLine;
+    info.dstBytesPerLine = dst_desc.BytesPerLine;
+    info.operationStamp = NextOperationStamp();
+
+    const int srcPitch = static_cast<int>(src_desc.BytesPerLine);
+    const int dstPitch = static_cast<int>(dst_desc.BytesPerLine);
+    if (bandRows == 0) {
+        bandRows = XMax(1, STREAM_BAND_BYTES / (srcPitch + dstPitch));
+    }
+    bandRows = XMin(bandRows, dst_desc.Height);
+
+    XArray<XBYTE> srcBand;
+    XArray<XBYTE> dstBand;
+    if (!src_desc.Image) srcBand.Resize(bandRows * srcPitch);
+    if (write) dstBand.Resize(bandRows * dstPitch);
+
+    // Resizing converts one horizontally resampled source row at a time.
+    VxResizeInfo resizeInfo = {};
+    void (*resizeLine)(const VxResizeInfo *) = NULL;
+    XArray<XDWORD> resizedRow;
+    long long rowStep = 0x10000;
+    if (resize) {
+        info.width = dst_desc.Width;
+        info.copyBytes = dst_desc.Width * 4;
+        resizedRow.Resize(dst_desc.Width);
+        resizeInfo.w1 = src_desc.Width;
+        resizeInfo.w2 = dst_desc.Width;
+        resizeInfo.wr1 = (src_desc.Width << 16) / dst_desc.Width;
+        resizeInfo.dstRow = resizedRow.Begin();
+        if (src_desc.Width == dst_desc.Width) {
+            resizeLine = ResizeHLine_EqualY_EqualX_32Bpp;
+        } else if (src_desc.Width < dst_desc.Width) {
+            resizeLine = ResizeHLine_EqualY_GrowX_32Bpp;
+        } else {
+            resizeLine = ResizeHLine_EqualY_ShrinkX_32Bpp;
+        }
+        rowStep = (static_cast<long long>(src_desc.Height) << 16) / dst_desc.Height;
     }
-    m_BlitInfo.alphaValue = scaledAlpha & alphaMask;
 
-    XBYTE *row = dst_desc.Image;
-    for (int y = 0; y < dst_desc.Height; ++y) {
-        m_BlitInfo.dstLine = row;
-        alphaFunc(&m_BlitInfo);
-        row += dst_desc.BytesPerLine;
+    // Last source row of the previous band and its slot. Enlarging samples a
+    // row for several destination rows, which may straddle a band boundary.
+    XArray<int> rowSlots;
+    rowSlots.Resize(bandRows);
+    int carriedRow = -1;
+    int carriedSlot = 0;
+
+    for (int y0 = 0; y0 < dst_desc.Height; y0 += bandRows) {
+        const int rows = XMin(bandRows, dst_desc.Height - y0);
+        XBYTE *dstFirst = write ? dstBand.Begin() : dst_desc.Image + static_cast<ptrdiff_t>(y0) * dstPitch;
+
+        if (!resize) {
+            const XBYTE *srcFirst = srcBand.Begin();
+            if (src_desc.Image) {
+                srcFirst = src_desc.Image + static_cast<ptrdiff_t>(y0) * srcPitch;
+            } else if (!read(userData, y0, rows, srcBand.Begin(), srcPitch)) {
+                return FALSE;
+            }
+            BlitRows(info, srcFirst, srcPitch, dstFirst, dstPitch, rows, blitFunc);
+        } else {
+            // Load the distinct source rows of this band into consecutive slots,
+            // one read per run of consecutive rows.
+            if (!src_desc.Image) {
+                int slots = 0;
+                int runFirst = 0;
+                int runCount = 0;
+                int lastRow = -1;
+                for (int r = 0; r < rows; ++r) {
+                    const int srcY = StreamSourceRow(y0 + r, rowStep, src_desc.Height);
+                    if (srcY != lastRow) {
+                        if (slots == 0 && srcY == carriedRow) {
+                            memmove(srcBand.Begin(), srcBand.Begin() + carriedSlot * srcPitch, srcPitch);
+                        } else if (runCount > 0 && srcY == runFirst + runCount) {
+                            ++runCount;
+                        } else {
+                            XBYTE *runRows = srcBand.Begin() + static_cast<ptrdiff_t>(slots - runCount) * srcPitch;
+                            if (runCount > 0 && !read(userData, runFirst, runCount, runRows, srcPitch)) return FALSE;
+                            runFirst = srcY;
+                            runCount = 1;
+                        }
+                        lastRow = srcY;
+                        ++slots;
+                    }
+                    rowSlots[r] = slots - 1;
+                }
+                XBYTE *runRows = srcBand.Begin() + static_cast<ptrdiff_t>(slots - runCount) * srcPitch;
+                if (runCount > 0 && !read(userData, runFirst, runCount, runRows, srcPitch)) return FALSE;
+                carriedRow = lastRow;
+                carriedSlot = slots - 1;
+            }
+
+            info.srcLine = reinterpret_cast<const XBYTE *>(resizedRow.Begin());
+            for (int r = 0; r < rows; ++r) {
+                const XBYTE *srcRow;
+                if (src_desc.Image) {
+                    const int srcY = StreamSourceRow(y0 + r, rowStep, src_desc.Height);
+                    srcRow = src_desc.Image + static_cast<ptrdiff_t>(srcY) * srcPitch;
+                } else {
+                    srcRow = srcBand.Begin() + static_cast<ptrdiff_t>(rowSlots[r]) * srcPitch;
+                }
+                resizeInfo.srcRow = reinterpret_cast<const XDWORD *>(srcRow);
+                resizeLine(&resizeInfo);
+                info.dstLine = dstFirst + static_cast<ptrdiff_t>(r) * dstPitch;
+                blitFunc(&info);
+            }
+        }
+
+        if (write && !write(userData, y0, rows, dstBand.Begin(), dstPitch)) return FALSE;
     }
+    return TRUE;
 }
 
-void VxBlitEngine::DoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE *AlphaValues) {
-    VxMutexLock lock(m_Lock);
+//==============================================================================
+//  Dithered Blits
+//==============================================================================
 
-    if (!dst_desc.AlphaMask || !dst_desc.Image || !AlphaValues) return;
-    if (dst_desc.Width < 0) return;
+namespace {
 
-    VxBlitLineFunc alphaFunc = GetCopyAlphaFunction(dst_desc);
-    if (!alphaFunc) return;
+// 4x4 Bayer threshold matrix (0..15).
+const int DITHER_BAYER4[4][4] = {
+    {0, 8, 2, 10},
+    {12, 4, 14, 6},
+    {3, 11, 1, 9},
+    {15, 7, 13, 5},
+};
 
-    m_BlitInfo.dstBytesPerPixel = dst_desc.BitsPerPixel / 8;
-    m_BlitInfo.dstAlphaMask = dst_desc.AlphaMask;
-    m_BlitInfo.alphaMaskInv = ~dst_desc.AlphaMask;
-    m_BlitInfo.width = dst_desc.Width;
-    m_BlitInfo.dstBytesPerLine = dst_desc.BytesPerLine;
-    m_BlitInfo.alphaShiftDst = static_cast<int>(GetBitShiftLocal(dst_desc.AlphaMask));
-    m_BlitInfo.operationStamp = NextOperationStamp();
+// Destination bits of the channel stored in source byte @p byteIndex, or 8
+// when that byte keeps its precision (or is not a channel of both images).
+int DitherChannelBits(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int byteIndex) {
+    const XDWORD byteMask = 0xFFu << (byteIndex * 8);
+    if (src_desc.RedMask == byteMask) return static_cast<int>(GetBitCountLocal(dst_desc.RedMask));
+    if (src_desc.GreenMask == byteMask) return static_cast<int>(GetBitCountLocal(dst_desc.GreenMask));
+    if (src_desc.BlueMask == byteMask) return static_cast<int>(GetBitCountLocal(dst_desc.BlueMask));
+    if (src_desc.AlphaMask == byteMask) return static_cast<int>(GetBitCountLocal(dst_desc.AlphaMask));
+    return 8;
+}
 
-    XBYTE *row = dst_desc.Image;
-    const XBYTE *alphaRow = AlphaValues;
+struct DitheredRowBandJob {
+    const VxBlitInfo *info;
+    const XBYTE *srcFirst;
+    XBYTE *dstFirst;
+    int srcPitch;
+    int dstPitch;
+    int rowBytes;
+    VxBlitLineFunc blitFunc;
+    VxDitherAddFunc ditherAdd;
+    const XBYTE *patterns; // Four Bayer rows of 2 * DITHER_PATTERN_PERIOD bytes
+};
 
-    for (int y = 0; y < dst_desc.Height; ++y) {
-        m_BlitInfo.srcLine = alphaRow;
-        m_BlitInfo.dstLine = row;
+void RunDitheredRowBand(void *userData, int begin, int end) {
+    const DitheredRowBandJob &job = *static_cast<const DitheredRowBandJob *>(userData);
+    VxBlitInfo info = *job.info;
 
-        alphaFunc(&m_BlitInfo);
+    XArray<XBYTE> &row = GetThreadBlitScratch().ditherRow;
+    if (row.Size() < job.rowBytes) {
+        row.Resize(job.rowBytes);
+    }
 
-        row += dst_desc.BytesPerLine;
-        alphaRow += dst_desc.Width;
+    for (int y = begin; y < end; ++y) {
+        job.ditherAdd(job.srcFirst + static_cast<ptrdiff_t>(y) * job.srcPitch, row.Begin(), job.rowBytes,
+                      job.patterns + (y & 3) * 2 * DITHER_PATTERN_PERIOD);
+        info.srcLine = row.Begin();
+        info.dstLine = job.dstFirst + static_cast<ptrdiff_t>(y) * job.dstPitch;
+        job.blitFunc(&info);
     }
 }
 
-//==============================================================================
-//  Image Fill / Transform Operations
-//==============================================================================
-
-void VxBlitEngine::FillImage(const VxImageDescEx &dst_desc, XDWORD color) {
-    VxMutexLock lock(m_Lock);
-
-    if (!dst_desc.Image) return;
-    if (dst_desc.Width <= 0 || dst_desc.Height <= 0) return;
-
-    const int bpp = dst_desc.BitsPerPixel / 8;
-    XBYTE *row = dst_desc.Image;
+} // namespace
 
-    if (bpp == 4) {
-        // 32-bit fill with runtime-selected SIMD kernel when available.
-        for (int y = 0; y < dst_desc.Height; ++y) {
-            XDWORD *dst = (XDWORD *)row;
-            if (m_FillLine32) {
-                m_FillLine32(dst, dst_desc.Width, color);
-            } else {
-                for (int x = 0; x < dst_desc.Width; ++x) {
-                    dst[x] = color;
-                }
-            }
-            row += dst_desc.BytesPerLine;
-        }
-    } else if (bpp == 3) {
-        // 24-bit fill
-        XBYTE b = (XBYTE)(color & 0xFF);
-        XBYTE g = (XBYTE)((color >> 8) & 0xFF);
-        XBYTE r = (XBYTE)((color >> 16) & 0xFF);
-        for (int y = 0; y < dst_desc.Height; ++y) {
-            XBYTE *dst = row;
-            for (int x = 0; x < dst_desc.Width; ++x) {
-                dst[0] = b;
-                dst[1] = g;
-                dst[2] = r;
-                dst += 3;
-            }
-            row += dst_desc.BytesPerLine;
-        }
-    } else if (bpp == 2) {
-        // 16-bit fill with runtime-selected SIMD kernel when available.
-        XWORD color16 = (XWORD)(color & 0xFFFF);
-        for (int y = 0; y < dst_desc.Height; ++y) {
-            XWORD *dst = (XWORD *)row;
-            if (m_FillLine16) {
-                m_FillLine16(dst, dst_desc.Width, color16);
-            } else {
-                for (int x = 0; x < dst_desc.Width; ++x) {
-                    dst[x] = color16;
-                }
+void VxBlitEngine::DoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int dither) {
+    VX_PROFILE_SCOPE("VxBlitEngine::DoBlit(dither)");
+    const XBOOL sameSize = src_desc.Width == dst_desc.Width && src_desc.Height == dst_desc.Height;
+    if (sameSize && src_desc.ColorMapEntries == 0) {
+        if (dither == VX_DITHER_ERRORDIFFUSION && dst_desc.ColorMapEntries > 0) {
+            if (src_desc.Image && dst_desc.Image) {
+                QuantizeImage(src_desc, dst_desc, VX_DITHER_ERRORDIFFUSION);
             }
-            row += dst_desc.BytesPerLine;
+            return;
         }
-    } else if (bpp == 1) {
-        // 8-bit fill
-        XBYTE color8 = (XBYTE)(color & 0xFF);
-        for (int y = 0; y < dst_desc.Height; ++y) {
-            memset(row, color8, dst_desc.Width);
-            row += dst_desc.BytesPerLine;
+        if (dither == VX_DITHER_ORDERED && BlitOrderedDither(src_desc, dst_desc)) {
+            return;
         }
     }
+    DoBlit(src_desc, dst_desc);
 }
 
-void VxBlitEngine::PremultiplyAlpha(const VxImageDescEx &desc) {
-    VxMutexLock lock(m_Lock);
+XBOOL VxBlitEngine::BlitOrderedDither(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
+    const int srcBpp = src_desc.BitsPerPixel / 8;
+    if (srcBpp != 3 && srcBpp != 4) return FALSE;
+    if (dst_desc.BitsPerPixel != 16 || dst_desc.ColorMapEntries > 0) return FALSE;
+    if (!src_desc.Image || !dst_desc.Image) return FALSE;
+    if (src_desc.Width <= 0 || src_desc.Height <= 0) return FALSE;
+    if (IsDXTFormat(GetPixelFormat(src_desc)) || IsDXTFormat(GetPixelFormat(dst_desc))) return FALSE;
+
+    // Threshold (b + 1/2) / 16 of the destination step, so truncation rounds
+    // to the nearer level on average and exact levels stay put.
+    XBYTE patterns[4][2 * DITHER_PATTERN_PERIOD];
+    XBOOL dithered = FALSE;
+    for (int i = 0; i < DITHER_PATTERN_PERIOD; ++i) {
+        const int bits = DitherChannelBits(src_desc, dst_desc, i % srcBpp);
+        const int step = (bits > 0 && bits < 8) ? 1 << (8 - bits) : 0;
+        for (int phase = 0; phase < 4; ++phase) {
+            const int threshold = DITHER_BAYER4[phase][(i / srcBpp) & 3];
+            const XBYTE bias = static_cast<XBYTE>((2 * threshold + 1) * step / 32);
+            patterns[phase][i] = bias;
+            patterns[phase][i + DITHER_PATTERN_PERIOD] = bias;
+            dithered |= bias != 0;
+        }
+    }
+    if (!dithered) return FALSE;
+
+    const DispatchTables &tables = AcquireTables();
+    XBYTE byteShuffle[16];
+    VxBlitLineFunc blitFunc = GetBlitFunction(tables, src_desc, dst_desc, byteShuffle);
+    if (!blitFunc) return FALSE;
+
+    VxBlitInfo info;
+    SetupBlitInfo(info, src_desc, dst_desc, byteShuffle);
+    info.srcBytesPerLine = src_desc.BytesPerLine;
+    info.dstBytesPerLine = dst_desc.BytesPerLine;
+    info.operationStamp = NextOperationStamp();
+
+    DitheredRowBandJob job;
+    job.info = &info;
+    job.srcFirst = src_desc.Image;
+    job.dstFirst = dst_desc.Image;
+    job.srcPitch = src_desc.BytesPerLine;
+    job.dstPitch = dst_desc.BytesPerLine;
+    job.rowBytes = src_desc.Width * srcBpp;
+    job.blitFunc = blitFunc;
+    job.ditherAdd = tables.ditherAdd;
+    job.patterns = &patterns[0][0];
+
+    const int threads = VxAtomicLoadInt(&m_BlitThreadCount);
+    if (threads <= 1) {
+        RunDitheredRowBand(&job, 0, src_desc.Height);
+    } else {
+        VxParallelFor(src_desc.Height, VxAtomicLoadInt(&m_MinRowsPerBand), threads, RunDitheredRowBand, &job);
+    }
+    return TRUE;
+}
 
-    if (!desc.Image) return;
-    if (desc.BitsPerPixel != 32 || desc.AlphaMask == 0) return;
-    if (desc.Width <= 0 || desc.Height <= 0) return;
+//==============================================================================
+//  DXT Decompression
+//==============================================================================
 
-    VxBlitInfo info = {};
-    info.width = desc.Width;
+namespace {
+
+struct BlockDecodeJob {
+    VxBlockDecodeFunc decodeFunc;
+    const XBYTE *srcBlocks;
+    int srcBlockRowPitch;
+    int blocksX;
+    int height;
+    XBYTE *dstImage;
+    int dstPitch;
+    XBOOL upsideDown;
+    XBOOL decodeInPlace;    // ARGB 8888 destination, whole blocks per row
+    VxBlitLineFunc lineFunc; // ARGB 8888 -> destination
+    const VxBlitInfo *info;
+};
 
-    VxBlitLineFunc premulFunc = m_PremultiplyAlpha32 ? m_PremultiplyAlpha32 : PremultiplyAlpha_32ARGB;
+void RunBlockDecodeRows(void *userData, int begin, int end) {
+    const BlockDecodeJob &job = *static_cast<const BlockDecodeJob *>(userData);
+    VxBlitInfo info = *job.info;
+    const int decodedPitch = job.blocksX * 16;
+
+    for (int by = begin; by < end; ++by) {
+        const XBYTE *blockRow = job.srcBlocks + static_cast<ptrdiff_t>(by) * job.srcBlockRowPitch;
+        const int y0 = by * 4;
+        int rows = job.height - y0;
+        if (rows > 4) rows = 4;
+
+        if (job.decodeInPlace && rows == 4) {
+            job.decodeFunc(blockRow, job.blocksX, job.dstImage + static_cast<ptrdiff_t>(y0) * job.dstPitch,
+                           job.dstPitch);
+            continue;
+        }
 
-    XBYTE *row = desc.Image;
-    for (int y = 0; y < desc.Height; ++y) {
-        info.srcLine = row;
-        info.dstLine = row;  // In-place
-        premulFunc(&info);
-        row += desc.BytesPerLine;
+        XArray<XDWORD> &decoded = GetThreadBlitScratch().decodeBuffer;
+        if (decoded.Size() < job.blocksX * 16) {
+            decoded.Resize(job.blocksX * 16);
+        }
+        const XBYTE *decodedRows = reinterpret_cast<const XBYTE *>(decoded.Begin());
+        job.decodeFunc(blockRow, job.blocksX, reinterpret_cast<XBYTE *>(decoded.Begin()), decodedPitch);
+
+        for (int r = 0; r < rows; ++r) {
+            const int y = y0 + r;
+            const int dstY = job.upsideDown ? job.height - 1 - y : y;
+            info.srcLine = decodedRows + r * decodedPitch;
+            info.dstLine = job.dstImage + static_cast<ptrdiff_t>(dstY) * job.dstPitch;
+            job.lineFunc(&info);
+        }
     }
 }
 
-void VxBlitEngine::UnpremultiplyAlpha(const VxImageDescEx &desc) {
-    VxMutexLock lock(m_Lock);
+} // namespace
 
-    if (!desc.Image) return;
-    if (desc.BitsPerPixel != 32 || desc.AlphaMask == 0) return;
-    if (desc.Width <= 0 || desc.Height <= 0) return;
+void VxBlitEngine::DecompressBlocks(const DispatchTables &tables, const VxImageDescEx &src_desc,
+                                    const VxImageDescEx &dst_desc, XBOOL upsideDown) {
+    const VX_PIXELFORMAT srcFmt = GetPixelFormat(src_desc);
+    const VX_PIXELFORMAT dstFmt = GetPixelFormat(dst_desc);
+    if (!IsDXTFormat(srcFmt) || IsDXTFormat(dstFmt)) return;
+    if (dst_desc.ColorMapEntries > 0) return;
+    if (src_desc.Width != dst_desc.Width || src_desc.Height != dst_desc.Height) return;
+    if (!src_desc.Image || !dst_desc.Image) return;
+    if (src_desc.Width <= 0 || src_desc.Height <= 0) return;
 
-    VxBlitInfo info = {};
-    info.width = desc.Width;
+    BlockDecodeJob job;
+    switch (srcFmt) {
+        case _DXT1:
+            job.decodeFunc = tables.decodeDXT[0];
+            break;
+        case _DXT2:
+        case _DXT3:
+            job.decodeFunc = tables.decodeDXT[1];
+            break;
+        default:
+            job.decodeFunc = tables.decodeDXT[2];
+            break;
+    }
 
-    VxBlitLineFunc unpremulFunc = m_UnpremultiplyAlpha32 ? m_UnpremultiplyAlpha32 : UnpremultiplyAlpha_32ARGB;
+    // Decoded rows are converted like an ARGB 8888 source of the same width.
+    VxImageDescEx decodedDesc;
+    ConvertPixelFormat(_32_ARGB8888, decodedDesc);
+    decodedDesc.Width = src_desc.Width;
+    decodedDesc.Height = src_desc.Height;
+
+    job.blocksX = (src_desc.Width + 3) / 4;
+    decodedDesc.BytesPerLine = job.blocksX * 16;
+    XBYTE byteShuffle[16];
+    job.lineFunc = GetBlitFunction(tables, decodedDesc, dst_desc, byteShuffle);
+    if (!job.decodeFunc || !job.lineFunc) return;
+
+    VxBlitInfo info;
+    SetupBlitInfo(info, decodedDesc, dst_desc, byteShuffle);
+    info.srcBytesPerLine = decodedDesc.BytesPerLine;
+    info.dstBytesPerLine = dst_desc.BytesPerLine;
+    info.operationStamp = NextOperationStamp();
+
+    job.srcBlocks = src_desc.Image;
+    job.srcBlockRowPitch = DXTBlockRowPitch(src_desc, srcFmt);
+    if (job.srcBlockRowPitch == 0) return;
+    job.height = src_desc.Height;
+    job.dstImage = dst_desc.Image;
+    job.dstPitch = dst_desc.BytesPerLine;
+    job.upsideDown = upsideDown;
+    job.decodeInPlace = (!upsideDown && dstFmt == _32_ARGB8888 && (src_desc.Width & 3) == 0);
+    job.info = &info;
+
+    const int blockRows = (src_desc.Height + 3) / 4;
+    const int threads = VxAtomicLoadInt(&m_BlitThreadCount);
+    if (threads <= 1) {
+        RunBlockDecodeRows(&job, 0, blockRows);
+        return;
+    }
 
-    XBYTE *row = desc.Image;
-    for (int y = 0; y < desc.Height; ++y) {
-        info.srcLine = row;
-        info.dstLine = row;  // In-place
-        unpremulFunc(&info);
-        row += desc.BytesPerLine;
+    int minBlockRows = VxAtomicLoadInt(&m_MinRowsPerBand) / 4;
+    if (minBlockRows < 1) {
+        minBlockRows = 1;
     }
+    VxParallelFor(blockRows, minBlockRows, threads, RunBlockDecodeRows, &job);
 }
 
-void VxBlitEngine::SwapRedBlue(const VxImageDescEx &desc) {
-    VxMutexLock lock(m_Lock);
+//==============================================================================
+//  DXT Compression
+//==============================================================================
 
-    if (!desc.Image) return;
-    if (desc.BitsPerPixel != 32) return;
-    if (desc.Width <= 0 || desc.Height <= 0) return;
+namespace {
+
+struct BlockEncodeJob {
+    VxBlockEncodeFunc encodeFunc;
+    const XBYTE *srcImage;
+    int srcPitch;
+    int width;
+    int height;
+    int blocksX;
+    XBYTE *dstBlocks;
+    int dstBlockRowPitch;
+    XBOOL upsideDown;
+    XBOOL encodeInPlace;        // ARGB 8888 source, whole blocks per row
+    XBOOL opaque;               // source without alpha: staged alpha forced to 0xFF
+    VxBlitLineFunc lineFunc;    // source -> ARGB 8888
+    VxBlitLineFunc premultiply; // DXT2/DXT4 only: staged rows -> premultiplied
+    const VxBlitInfo *info;
+};
 
-    VxBlitInfo info = {};
-    info.width = desc.Width;
+void RunBlockEncodeRows(void *userData, int begin, int end) {
+    const BlockEncodeJob &job = *static_cast<const BlockEncodeJob *>(userData);
+    VxBlitInfo info = *job.info;
+    const int stagedPitch = job.blocksX * 16;
+
+    for (int by = begin; by < end; ++by) {
+        XBYTE *blockRow = job.dstBlocks + static_cast<ptrdiff_t>(by) * job.dstBlockRowPitch;
+        const int y0 = by * 4;
+        int rows = job.height - y0;
+        if (rows > 4) rows = 4;
+
+        if (job.encodeInPlace && rows == 4) {
+            job.encodeFunc(job.srcImage + static_cast<ptrdiff_t>(y0) * job.srcPitch, job.srcPitch, job.blocksX,
+                           blockRow);
+            continue;
+        }
+
+        XArray<XDWORD> &staged = GetThreadBlitScratch().decodeBuffer;
+        if (staged.Size() < job.blocksX * 16) {
+            staged.Resize(job.blocksX * 16);
+        }
+        XBYTE *stagedRows = reinterpret_cast<XBYTE *>(staged.Begin());
+
+        // Partial blocks repeat the last column and row, which keeps the
+        // endpoints inside the colors actually present in the image.
+        for (int r = 0; r < 4; ++r) {
+            XDWORD *row = reinterpret_cast<XDWORD *>(stagedRows + r * stagedPitch);
+            if (r >= rows) {
+                memcpy(row, stagedRows + (rows - 1) * stagedPitch, stagedPitch);
+                continue;
+            }
+            const int y = y0 + r;
+            const int srcY = job.upsideDown ? job.height - 1 - y : y;
+            info.srcLine = job.srcImage + static_cast<ptrdiff_t>(srcY) * job.srcPitch;
+            info.dstLine = reinterpret_cast<XBYTE *>(row);
+            job.lineFunc(&info);
+            if (job.opaque) {
+                for (int x = 0; x < job.width; ++x) {
+                    row[x] |= 0xFF000000;
+                }
+            }
+            if (job.premultiply) {
+                VxBlitInfo premultiplyInfo = {};
+                premultiplyInfo.width = job.width;
+                premultiplyInfo.srcLine = reinterpret_cast<XBYTE *>(row);
+                premultiplyInfo.dstLine = reinterpret_cast<XBYTE *>(row);
+                job.premultiply(&premultiplyInfo);
+            }
+            for (int x = job.width; x < job.blocksX * 4; ++x) {
+                row[x] = row[job.width - 1];
+            }
+        }
+        job.encodeFunc(stagedRows, stagedPitch, job.blocksX, blockRow);
+    }
+}
 
-    VxBlitLineFunc swapFunc = m_SwapRedBlue32 ? m_SwapRedBlue32 : CopyLine_32ARGB_32ABGR;
+} // namespace
 
-    XBYTE *row = desc.Image;
-    for (int y = 0; y < desc.Height; ++y) {
-        info.srcLine = row;
-        info.dstLine = row;  // In-place
-        swapFunc(&info);
-        row += desc.BytesPerLine;
+void VxBlitEngine::CompressBlocks(const DispatchTables &tables, const VxImageDescEx &src_desc,
+                                  const VxImageDescEx &dst_desc, XBOOL upsideDown) {
+    const VX_PIXELFORMAT srcFmt = GetPixelFormat(src_desc);
+    const VX_PIXELFORMAT dstFmt = GetPixelFormat(dst_desc);
+    if (IsDXTFormat(srcFmt) || !IsDXTFormat(dstFmt)) return;
+    if (src_desc.Width != dst_desc.Width || src_desc.Height != dst_desc.Height) return;
+    if (!src_desc.Image || !dst_desc.Image) return;
+    if (src_desc.Width <= 0 || src_desc.Height <= 0) return;
+
+    BlockEncodeJob job;
+    job.blocksX = (src_desc.Width + 3) / 4;
+    job.dstBlockRowPitch = DXTBlockRowPitch(dst_desc, dstFmt);
+    if (job.dstBlockRowPitch == 0) return;
+    const int blockRows = (src_desc.Height + 3) / 4;
+
+    const int quality = VxAtomicLoadInt(&m_DXTQuality);
+    switch (dstFmt) {
+        case _DXT1:
+            job.encodeFunc = tables.encodeDXT[0][quality];
+            break;
+        case _DXT2:
+        case _DXT3:
+            job.encodeFunc = tables.encodeDXT[1][quality];
+            break;
+        default:
+            job.encodeFunc = tables.encodeDXT[2][quality];
+            break;
+    }
+
+    // Source rows are staged like an ARGB 8888 destination of the same width.
+    VxImageDescEx stagedDesc;
+    ConvertPixelFormat(_32_ARGB8888, stagedDesc);
+    stagedDesc.Width = src_desc.Width;
+    stagedDesc.Height = src_desc.Height;
+    stagedDesc.BytesPerLine = job.blocksX * 16;
+    XBYTE byteShuffle[16];
+    job.lineFunc = GetBlitFunction(tables, src_desc, stagedDesc, byteShuffle);
+    if (!job.encodeFunc || !job.lineFunc) return;
+
+    VxBlitInfo info;
+    SetupBlitInfo(info, src_desc, stagedDesc, byteShuffle);
+    info.srcBytesPerLine = src_desc.BytesPerLine;
+    info.dstBytesPerLine = stagedDesc.BytesPerLine;
+    info.operationStamp = NextOperationStamp();
+
+    job.srcImage = src_desc.Image;
+    job.srcPitch = src_desc.BytesPerLine;
+    job.width = src_desc.Width;
+    job.height = src_desc.Height;
+    job.dstBlocks = dst_desc.Image;
+    job.upsideDown = upsideDown;
+    job.opaque = (src_desc.AlphaMask == 0);
+    job.premultiply = nullptr;
+    if (dstFmt == _DXT2 || dstFmt == _DXT4) {
+        job.premultiply = tables.premultiplyAlpha32 ? tables.premultiplyAlpha32 : PremultiplyAlpha_32ARGB;
+    }
+    job.encodeInPlace = (!upsideDown && srcFmt == _32_ARGB8888 && (src_desc.Width & 3) == 0 && !job.premultiply);
+    job.info = &info;
+
+    const int threads = VxAtomicLoadInt(&m_BlitThreadCount);
+    if (threads <= 1) {
+        RunBlockEncodeRows(&job, 0, blockRows);
+        return;
     }
+
+    int minBlockRows = VxAtomicLoadInt(&m_MinRowsPerBand) / 4;
+    if (minBlockRows < 1) {
+        minBlockRows = 1;
+    }
+    VxParallelFor(blockRows, minBlockRows, threads, RunBlockEncodeRows, &job);
 }
 
-void VxBlitEngine::ClearAlpha(const VxImageDescEx &desc) {
-    VxMutexLock lock(m_Lock);
+//==============================================================================
+//  Row-Band Parallelism
+//==============================================================================
 
-    if (!desc.Image) return;
-    if (desc.BitsPerPixel != 32) return;
-    if (desc.Width <= 0 || desc.Height <= 0) return;
+namespace {
 
-    VxBlitInfo info = {};
-    info.width = desc.Width;
+struct RowBandJob {
+    const VxBlitInfo *info;
+    const XBYTE *srcFirst;
+    XBYTE *dstFirst;
+    int srcStep;
+    int dstStep;
+    VxBlitLineFunc blitFunc;
+};
 
-    XBYTE *row = desc.Image;
-    for (int y = 0; y < desc.Height; ++y) {
-        info.dstLine = row;
-        if (m_ClearAlpha32) {
-            m_ClearAlpha32(&info);
-        } else {
-            XDWORD *dst = (XDWORD *)row;
-            for (int x = 0; x < desc.Width; ++x) {
-                dst[x] &= 0x00FFFFFF;
-            }
-        }
-        row += desc.BytesPerLine;
+void RunRowBand(void *userData, int begin, int end) {
+    const RowBandJob &job = *static_cast<const RowBandJob *>(userData);
+
+    // Each band gets its own copy so line pointers are never shared.
+    VxBlitInfo info = *job.info;
+    const XBYTE *srcRow = job.srcFirst + static_cast<ptrdiff_t>(begin) * job.srcStep;
+    XBYTE *dstRow = job.dstFirst + static_cast<ptrdiff_t>(begin) * job.dstStep;
+
+    for (int y = begin; y < end; ++y) {
+        info.srcLine = srcRow;
+        info.dstLine = dstRow;
+
+        job.blitFunc(&info);
+
+        srcRow += job.srcStep;
+        dstRow += job.dstStep;
     }
 }
 
-void VxBlitEngine::SetFullAlpha(const VxImageDescEx &desc) {
-    VxMutexLock lock(m_Lock);
+} // namespace
+
+void VxBlitEngine::BlitRows(const VxBlitInfo &info, const XBYTE *srcFirst, int srcStep, XBYTE *dstFirst,
+                            int dstStep, int rows, VxBlitLineFunc blitFunc) const {
+    RowBandJob job;
+    job.info = &info;
+    job.srcFirst = srcFirst;
+    job.dstFirst = dstFirst;
+    job.srcStep = srcStep;
+    job.dstStep = dstStep;
+    job.blitFunc = blitFunc;
+
+    const int threads = VxAtomicLoadInt(const_cast<volatile int *>(&m_BlitThreadCount));
+    if (threads <= 1) {
+        RunRowBand(&job, 0, rows);
+        return;
+    }
 
-    if (!desc.Image) return;
-    if (desc.BitsPerPixel != 32) return;
-    if (desc.Width <= 0 || desc.Height <= 0) return;
+    // Bands inherit the operation stamp; per-thread kernel caches stay valid
+    // because every band reads the same palette.
+    const int minRows = VxAtomicLoadInt(const_cast<volatile int *>(&m_MinRowsPerBand));
+    VxParallelFor(rows, minRows, threads, RunRowBand, &job);
+}
 
-    VxBlitInfo info = {};
-    info.width = desc.Width;
+//==============================================================================
+//  Blit Plans
+//==============================================================================
 
-    XBYTE *row = desc.Image;
-    for (int y = 0; y < desc.Height; ++y) {
-        info.dstLine = row;
-        if (m_SetFullAlpha32) {
-            m_SetFullAlpha32(&info);
-        } else {
-            XDWORD *dst = (XDWORD *)row;
-            for (int x = 0; x < desc.Width; ++x) {
-                dst[x] |= 0xFF000000;
-            }
-        }
-        row += desc.BytesPerLine;
+XBOOL VxBlitEngine::InitBlitPlan(VxBlitPlan &plan, const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc,
+                                 XBOOL upsideDown) const {
+    plan = VxBlitPlan();
+
+    // Same preconditions as DoBlit() / DoBlitUpsideDown().
+    if (src_desc.Width <= 0 || src_desc.Height <= 0) return FALSE;
+    if (dst_desc.Width <= 0 || dst_desc.Height <= 0) return FALSE;
+    const XBOOL resize = (src_desc.Width != dst_desc.Width || src_desc.Height != dst_desc.Height);
+    if (resize && (upsideDown || src_desc.BitsPerPixel != 32)) return FALSE;
+
+    plan.upsideDown = upsideDown;
+    plan.srcDesc = src_desc;
+    plan.srcDesc.Image = nullptr;
+    plan.dstDesc = dst_desc;
+    plan.dstDesc.Image = nullptr;
+
+    plan.srcFormat = GetPixelFormat(src_desc);
+    plan.dstFormat = GetPixelFormat(dst_desc);
+    if (IsDXTFormat(plan.srcFormat)) {
+        // Decoders are picked per call from the active snapshot.
+        plan.kind = VxBlitPlan::KIND_DECOMPRESS;
+        return !IsDXTFormat(plan.dstFormat) && dst_desc.ColorMapEntries == 0;
     }
+    if (IsDXTFormat(plan.dstFormat)) {
+        // Encoders depend on the active snapshot and quality setting.
+        plan.kind = VxBlitPlan::KIND_COMPRESS;
+        return !resize;
+    }
+
+    if (dst_desc.ColorMapEntries > 0 && src_desc.ColorMapEntries == 0) {
+        // Quantization derives the palette from the pixels; nothing to precompute.
+        plan.kind = VxBlitPlan::KIND_QUANTIZE;
+        return TRUE;
+    }
+
+    const DispatchTables &tables = AcquireTables();
+    XBYTE byteShuffle[16];
+    plan.blitFunc = ResolveBlitFunction(tables, plan.srcFormat, plan.dstFormat, src_desc, dst_desc, byteShuffle);
+    if (!plan.blitFunc) return FALSE;
+    plan.boundTables = &tables;
+
+    plan.kind = resize ? VxBlitPlan::KIND_RESIZE : VxBlitPlan::KIND_COPY;
+    SetupBlitInfo(plan.info, src_desc, dst_desc, byteShuffle);
+    plan.info.srcBytesPerLine = src_desc.BytesPerLine;
+    plan.info.dstBytesPerLine = dst_desc.BytesPerLine;
+    return TRUE;
 }
 
-void VxBlitEngine::InvertColors(const VxImageDescEx &desc) {
-    VxMutexLock lock(m_Lock);
+void VxBlitEngine::ExecuteBlitPlan(const VxBlitPlan &plan, const XBYTE *srcImage, XBYTE *dstImage) {
+    if (!srcImage || !dstImage) return;
 
-    if (!desc.Image) return;
-    if (desc.BitsPerPixel != 32) return;
-    if (desc.Width <= 0 || desc.Height <= 0) return;
+    if (plan.kind == VxBlitPlan::KIND_DECOMPRESS) {
+        VxImageDescEx src_desc = plan.srcDesc;
+        src_desc.Image = const_cast<XBYTE *>(srcImage);
+        VxImageDescEx dst_desc = plan.dstDesc;
+        dst_desc.Image = dstImage;
+        DecompressBlocks(AcquireTables(), src_desc, dst_desc, plan.upsideDown);
+        return;
+    }
 
-    VxBlitInfo info = {};
-    info.width = desc.Width;
+    if (plan.kind == VxBlitPlan::KIND_COMPRESS) {
+        VxImageDescEx src_desc = plan.srcDesc;
+        src_desc.Image = const_cast<XBYTE *>(srcImage);
+        VxImageDescEx dst_desc = plan.dstDesc;
+        dst_desc.Image = dstImage;
+        CompressBlocks(AcquireTables(), src_desc, dst_desc, plan.upsideDown);
+        return;
+    }
 
-    XBYTE *row = desc.Image;
-    for (int y = 0; y < desc.Height; ++y) {
-        info.dstLine = row;
-        if (m_InvertColors32) {
-            m_InvertColors32(&info);
+    if (plan.kind == VxBlitPlan::KIND_QUANTIZE) {
+        VxImageDescEx src_desc = plan.srcDesc;
+        src_desc.Image = const_cast<XBYTE *>(srcImage);
+        VxImageDescEx dst_desc = plan.dstDesc;
+        dst_desc.Image = dstImage;
+        if (plan.upsideDown) {
+            DoBlitUpsideDown(src_desc, dst_desc);
         } else {
-            XDWORD *dst = (XDWORD *)row;
-            for (int x = 0; x < desc.Width; ++x) {
-                dst[x] ^= 0x00FFFFFF;
-            }
+            QuantizeImage(src_desc, dst_desc);
         }
-        row += desc.BytesPerLine;
+        return;
+    }
+
+    // Snapshots are immutable and kept alive with the engine, so pointer
+    // equality means the cached kernel is still the one DoBlit() would pick.
+    const DispatchTables &tables = AcquireTables();
+    VxBlitLineFunc blitFunc = plan.blitFunc;
+    VxBlitInfo info = plan.info;
+    if (&tables != plan.boundTables) {
+        // The new tables may switch between shuffle and generic kernels.
+        blitFunc = ResolveBlitFunction(tables, plan.srcFormat, plan.dstFormat, plan.srcDesc, plan.dstDesc,
+                                       info.byteShuffle);
+        if (!blitFunc) return;
+    }
+    info.operationStamp = NextOperationStamp();
+
+    if (plan.kind == VxBlitPlan::KIND_RESIZE) {
+        VxImageDescEx src_desc = plan.srcDesc;
+        src_desc.Image = const_cast<XBYTE *>(srcImage);
+        VxImageDescEx dst_desc = plan.dstDesc;
+        dst_desc.Image = dstImage;
+        DoBlitWithResize(info, src_desc, dst_desc, blitFunc);
+        return;
+    }
+
+    const int srcPitch = static_cast<int>(plan.srcDesc.BytesPerLine);
+    if (plan.upsideDown) {
+        const XBYTE *srcLast = srcImage + (plan.srcDesc.Height - 1) * srcPitch;
+        BlitRows(info, srcLast, -srcPitch, dstImage, plan.dstDesc.BytesPerLine, plan.srcDesc.Height, blitFunc);
+    } else {
+        BlitRows(info, srcImage, srcPitch, dstImage, plan.dstDesc.BytesPerLine, plan.srcDesc.Height, blitFunc);
     }
 }
 
-void VxBlitEngine::ConvertToGrayscale(const VxImageDescEx &desc) {
-    VxMutexLock lock(m_Lock);
+//==============================================================================
+//  Batched Blits
+//==============================================================================
 
-    if (!desc.Image) return;
-    if (desc.BitsPerPixel != 32) return;
-    if (desc.Width <= 0 || desc.Height <= 0) return;
+namespace {
 
-    VxBlitInfo info = {};
-    info.width = desc.Width;
+// Everything GetBlitFunction() and SetupBlitInfo() derive from a descriptor
+// pair, other than per-image sizes, strides and pixel pointers.
+struct BlitBatchKey {
+    XDWORD words[14];
+};
 
-    XBYTE *row = desc.Image;
-    for (int y = 0; y < desc.Height; ++y) {
-        info.srcLine = row;
-        info.dstLine = row;
-        if (m_Grayscale32) {
-            m_Grayscale32(&info);
+void BuildBlitBatchKey(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, BlitBatchKey &key) {
+    key.words[0] = src_desc.BitsPerPixel;
+    key.words[1] = src_desc.RedMask;
+    key.words[2] = src_desc.GreenMask;
+    key.words[3] = src_desc.BlueMask;
+    key.words[4] = src_desc.AlphaMask;
+    key.words[5] = (src_desc.ColorMapEntries > 0 && src_desc.ColorMap != nullptr) ? 1 : 0;
+    key.words[6] = static_cast<XDWORD>(src_desc.BytesPerColorEntry);
+    key.words[7] = static_cast<XDWORD>(src_desc.Flags);
+    key.words[8] = dst_desc.BitsPerPixel;
+    key.words[9] = dst_desc.RedMask;
+    key.words[10] = dst_desc.GreenMask;
+    key.words[11] = dst_desc.BlueMask;
+    key.words[12] = dst_desc.AlphaMask;
+    key.words[13] = static_cast<XDWORD>(dst_desc.Flags);
+}
+
+inline bool SameBlitBatchKey(const BlitBatchKey &a, const BlitBatchKey &b) {
+    return memcmp(a.words, b.words, sizeof(a.words)) == 0;
+}
+
+// qsort() has no context pointer; the fallback sort runs on (key, index) pairs.
+struct BlitBatchSortEntry {
+    BlitBatchKey key;
+    int index;
+};
+
+int CompareBlitBatchSortEntries(const void *a, const void *b) {
+    const BlitBatchSortEntry *ea = static_cast<const BlitBatchSortEntry *>(a);
+    const BlitBatchSortEntry *eb = static_cast<const BlitBatchSortEntry *>(b);
+    const int cmp = memcmp(ea->key.words, eb->key.words, sizeof(ea->key.words));
+    if (cmp != 0) {
+        return cmp;
+    }
+    // Keep submission order inside a group.
+    return ea->index - eb->index;
+}
+
+// Fills @p order with batch indices grouped by format pair, preserving
+// submission order inside each group.
+void GroupBlitBatch(const XArray<BlitBatchKey> &keys, XArray<int> &order) {
+    const int count = keys.Size();
+    order.Resize(count);
+
+    // Batches usually hold a handful of format pairs: bucket them in O(n).
+    const int MAX_BUCKETS = 64;
+    int bucketFirst[MAX_BUCKETS];
+    int bucketStart[MAX_BUCKETS];
+    int buckets = 0;
+    int lastBucket = -1;
+
+    XArray<XBYTE> bucketIds;
+    bucketIds.Resize(count);
+    for (int i = 0; i < count; ++i) {
+        int bucket = -1;
+        if (lastBucket >= 0 && SameBlitBatchKey(keys[bucketFirst[lastBucket]], keys[i])) {
+            bucket = lastBucket;
         } else {
-            XDWORD *dst = (XDWORD *)row;
-            for (int x = 0; x < desc.Width; ++x) {
-                XDWORD p = dst[x];
-                XDWORD a = p & 0xFF000000;
-                XDWORD r = (p >> 16) & 0xFF;
-                XDWORD g = (p >> 8) & 0xFF;
-                XDWORD b = p & 0xFF;
-                XDWORD y_val = (77 * r + 150 * g + 29 * b) >> 8;
-                dst[x] = a | (y_val << 16) | (y_val << 8) | y_val;
+            for (int b = 0; b < buckets; ++b) {
+                if (SameBlitBatchKey(keys[bucketFirst[b]], keys[i])) {
+                    bucket = b;
+                    break;
+                }
             }
         }
-        row += desc.BytesPerLine;
+
+        if (bucket < 0) {
+            if (buckets == MAX_BUCKETS) {
+                // Too many distinct pairs: fall back to a full sort.
+                XArray<BlitBatchSortEntry> sorted;
+                sorted.Resize(count);
+                for (int j = 0; j < count; ++j) {
+                    sorted[j].key = keys[j];
+                    sorted[j].index = j;
+                }
+                qsort(sorted.Begin(), count, sizeof(BlitBatchSortEntry), CompareBlitBatchSortEntries);
+                for (int j = 0; j < count; ++j) {
+                    order[j] = sorted[j].index;
+                }
+                return;
+            }
+            bucket = buckets++;
+            bucketFirst[bucket] = i;
+            bucketStart[bucket] = 0;
+        }
+
+        ++bucketStart[bucket];
+        bucketIds[i] = static_cast<XBYTE>(bucket);
+        lastBucket = bucket;
+    }
+
+    // Turn per-bucket counts into start offsets, then scatter.
+    int offset = 0;
+    for (int b = 0; b < buckets; ++b) {
+        const int size = bucketStart[b];
+        bucketStart[b] = offset;
+        offset += size;
+    }
+    for (int i = 0; i < count; ++i) {
+        order[bucketStart[bucketIds[i]]++] = i;
     }
 }
 
-void VxBlitEngine::MultiplyBlend(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
-    VxMutexLock lock(m_Lock);
+} // namespace
 
-    if (!src_desc.Image || !dst_desc.Image) return;
-    if (src_desc.BitsPerPixel != 32 || dst_desc.BitsPerPixel != 32) return;
-    if (src_desc.Width != dst_desc.Width || src_desc.Height != dst_desc.Height) return;
-    if (src_desc.Width <= 0 || src_desc.Height <= 0) return;
+struct VxBlitEngine::BlitBatchJob {
+    VxBlitEngine *engine;
+    const DispatchTables *tables;
+    const VxImageDescEx *srcDescs;
+    const VxImageDescEx *dstDescs;
+    const BlitBatchKey *keys;
+    const int *order;
+};
 
-    VxBlitInfo info = {};
-    info.width = src_desc.Width;
+void VxBlitEngine::RunBlitBatchRange(void *userData, int begin, int end) {
+    const BlitBatchJob &job = *static_cast<const BlitBatchJob *>(userData);
 
-    const XBYTE *srcRow = src_desc.Image;
-    XBYTE *dstRow = dst_desc.Image;
-    for (int y = 0; y < src_desc.Height; ++y) {
-        info.srcLine = srcRow;
-        info.dstLine = dstRow;
-        if (m_MultiplyBlend32) {
-            m_MultiplyBlend32(&info);
-        } else {
-            // Bug E fix: corrected indentation of else block.
-            const XDWORD *src = (const XDWORD *)srcRow;
-            XDWORD *dst = (XDWORD *)dstRow;
-            for (int x = 0; x < src_desc.Width; ++x) {
-                XDWORD s = src[x];
-                XDWORD d = dst[x];
-                XDWORD r = (((s >> 16) & 0xFF) * ((d >> 16) & 0xFF) + 127) / 255;
-                XDWORD g = (((s >> 8) & 0xFF) * ((d >> 8) & 0xFF) + 127) / 255;
-                XDWORD b = ((s & 0xFF) * (d & 0xFF) + 127) / 255;
-                XDWORD a = (((s >> 24) & 0xFF) * ((d >> 24) & 0xFF) + 127) / 255;
-                dst[x] = (a << 24) | (r << 16) | (g << 8) | b;
+    const BlitBatchKey *groupKey = nullptr;
+    VxBlitLineFunc blitFunc = nullptr;
+    const XBYTE *stampedColorMap = nullptr;
+    const XBYTE *stampedDstColorMap = nullptr;
+    VxBlitInfo info = {};
+    XBYTE byteShuffle[16];
+
+    for (int i = begin; i < end; ++i) {
+        const int index = job.order[i];
+        const VxImageDescEx &src_desc = job.srcDescs[index];
+        const VxImageDescEx &dst_desc = job.dstDescs[index];
+
+        // Resizes, quantizing and DXT blits do not share a line template.
+        if (src_desc.Width != dst_desc.Width || src_desc.Height != dst_desc.Height ||
+            (dst_desc.ColorMapEntries > 0 && src_desc.ColorMapEntries == 0) ||
+            IsDXTFormat(GetPixelFormat(src_desc)) || IsDXTFormat(GetPixelFormat(dst_desc))) {
+            job.engine->DoBlit(src_desc, dst_desc);
+            continue;
+        }
+        if (!src_desc.Image || !dst_desc.Image) continue;
+        if (src_desc.Width <= 0 || src_desc.Height <= 0) continue;
+
+        // Resolve the kernel and VxBlitInfo template once per format group.
+        if (!groupKey || !SameBlitBatchKey(*groupKey, job.keys[index])) {
+            groupKey = &job.keys[index];
+            blitFunc = GetBlitFunction(*job.tables, src_desc, dst_desc, byteShuffle);
+            if (blitFunc) {
+                SetupBlitInfo(info, src_desc, dst_desc, byteShuffle);
+                info.operationStamp = job.engine->NextOperationStamp();
+                stampedColorMap = src_desc.ColorMap;
+                stampedDstColorMap = dst_desc.ColorMap;
             }
         }
-        srcRow += src_desc.BytesPerLine;
-        dstRow += dst_desc.BytesPerLine;
+        if (!blitFunc) continue;
+
+        info.width = src_desc.Width;
+        info.copyBytes = src_desc.Width * info.srcBytesPerPixel;
+        info.srcBytesPerLine = src_desc.BytesPerLine;
+        info.dstBytesPerLine = dst_desc.BytesPerLine;
+        info.colorMap = src_desc.ColorMap;
+        info.colorMapEntries = src_desc.ColorMapEntries;
+        info.dstColorMap = dst_desc.ColorMap;
+        info.dstColorMapEntries = dst_desc.ColorMapEntries;
+        info.dstBytesPerColorEntry = dst_desc.BytesPerColorEntry;
+
+        // Palette caches in the kernels are keyed by stamp; a new palette
+        // needs a new stamp.
+        if (src_desc.ColorMap != stampedColorMap || dst_desc.ColorMap != stampedDstColorMap) {
+            info.operationStamp = job.engine->NextOperationStamp();
+            stampedColorMap = src_desc.ColorMap;
+            stampedDstColorMap = dst_desc.ColorMap;
+        }
+
+        RowBandJob rows;
+        rows.info = &info;
+        rows.srcFirst = src_desc.Image;
+        rows.dstFirst = dst_desc.Image;
+        rows.srcStep = src_desc.BytesPerLine;
+        rows.dstStep = dst_desc.BytesPerLine;
+        rows.blitFunc = blitFunc;
+        RunRowBand(&rows, 0, src_desc.Height);
     }
 }
 
-//==============================================================================
-//  Resize Operations
-//==============================================================================
+void VxBlitEngine::DoBlitBatch(const VxImageDescEx *src_descs, const VxImageDescEx *dst_descs, int count,
+                               XBOOL parallel) {
+    if (!src_descs || !dst_descs || count <= 0) return;
 
-void VxBlitEngine::DoBlitWithResize(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc,
-                                     VxBlitLineFunc blitFunc) {
-    // Store destination width for line blit
-    m_BlitInfo.width = dst_desc.Width;
-    m_BlitInfo.copyBytes = dst_desc.Width * 4;
+    XArray<BlitBatchKey> keys;
+    keys.Resize(count);
+    for (int i = 0; i < count; ++i) {
+        BuildBlitBatchKey(src_descs[i], dst_descs[i], keys[i]);
+    }
+    XArray<int> order;
+    GroupBlitBatch(keys, order);
+
+    BlitBatchJob job;
+    job.engine = this;
+    job.tables = &AcquireTables();
+    job.srcDescs = src_descs;
+    job.dstDescs = dst_descs;
+    job.keys = keys.Begin();
+    job.order = order.Begin();
+
+    if (!parallel) {
+        RunBlitBatchRange(&job, 0, count);
+        return;
+    }
 
-    // Ensure resize buffer is large enough
-    int bufferSize = src_desc.Width + dst_desc.Width + 1;
-    if (m_ResizeBuffer.Size() < bufferSize) {
-        m_ResizeBuffer.Reserve(bufferSize);
+    int threads = VxAtomicLoadInt(&m_BlitThreadCount);
+    if (threads <= 1) {
+        threads = VxGetHardwareConcurrency();
+    }
+    // Contiguous chunks keep each thread inside as few format groups as possible.
+    VxParallelFor(count, 16, threads, RunBlitBatchRange, &job);
+}
+
+void VxBlitEngine::SetParallelism(int threadCount, int minRowsPerBand) {
+    if (threadCount < 1) {
+        threadCount = 1;
+    }
+    if (minRowsPerBand < 1) {
+        minRowsPerBand = 1;
+    }
+    VxAtomicStoreInt(&m_MinRowsPerBand, minRowsPerBand);
+    VxAtomicStoreInt(&m_BlitThreadCount, threadCount);
+}
+
+void VxBlitEngine::GetParallelism(int &threadCount, int &minRowsPerBand) const {
+    threadCount = VxAtomicLoadInt(const_cast<volatile int *>(&m_BlitThreadCount));
+    minRowsPerBand = VxAtomicLoadInt(const_cast<volatile int *>(&m_MinRowsPerBand));
+}
+
+void VxBlitEngine::SetDXTQuality(int quality) {
+    if (quality < VX_DXTQUALITY_FAST) {
+        quality = VX_DXTQUALITY_FAST;
+    } else if (quality > VX_DXTQUALITY_HIGH) {
+        quality = VX_DXTQUALITY_HIGH;
+    }
+    VxAtomicStoreInt(&m_DXTQuality, quality);
+}
+
+int VxBlitEngine::GetDXTQuality() const {
+    return VxAtomicLoadInt(const_cast<volatile int *>(&m_DXTQuality));
+}
+
+//==============================================================================
+//  Alpha Operations
+//==============================================================================
+
+void VxBlitEngine::DoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE AlphaValue) {
+    if (!dst_desc.AlphaMask) return;
+    if (!dst_desc.Image) return;
+    if (dst_desc.Width < 0) return;
+
+    VxBlitLineFunc alphaFunc = GetSetAlphaFunction(AcquireTables(), dst_desc);
+    if (!alphaFunc) return;
+
+    // Setup blit info for alpha operation
+    VxBlitInfo info = {};
+    info.dstBytesPerPixel = dst_desc.BitsPerPixel / 8;
+    info.dstAlphaMask = dst_desc.AlphaMask;
+    info.alphaMaskInv = ~dst_desc.AlphaMask;
+    info.width = dst_desc.Width;
+    info.dstBytesPerLine = dst_desc.BytesPerLine;
+    info.operationStamp = NextOperationStamp();
+
+    // Scale 8-bit alpha to target bit depth
+    XDWORD alphaMask = dst_desc.AlphaMask;
+    int alphaShift = static_cast<int>(GetBitShiftLocal(alphaMask));
+
+    // Count bits in the alpha mask
+    XDWORD tempMask = alphaMask >> alphaShift;
+    int alphaBits = 0;
+    while (tempMask & 1) {
+        ++alphaBits;
+        tempMask >>= 1;
+    }
+
+    // Scale the 8-bit alpha value to the target bit depth
+    XDWORD scaledAlpha;
+    if (alphaBits >= 8) {
+        // Direct placement for 8+ bit alpha
+        scaledAlpha = (XDWORD)AlphaValue << alphaShift;
+    } else {
+        // Scale down from 8-bit to target bits by taking top bits
+        int shiftAmount = 8 - alphaBits;
+        scaledAlpha = ((XDWORD)AlphaValue >> shiftAmount) << alphaShift;
+    }
+    info.alphaValue = scaledAlpha & alphaMask;
+
+    XBYTE *row = dst_desc.Image;
+    for (int y = 0; y < dst_desc.Height; ++y) {
+        info.dstLine = row;
+        alphaFunc(&info);
+        row += dst_desc.BytesPerLine;
+    }
+}
+
+void VxBlitEngine::DoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE *AlphaValues) {
+    if (!dst_desc.AlphaMask || !dst_desc.Image || !AlphaValues) return;
+    if (dst_desc.Width < 0) return;
+
+    CopyAlphaRows(dst_desc, AlphaValues, dst_desc.Width);
+}
+
+void VxBlitEngine::CopyAlphaRows(const VxImageDescEx &dst_desc, const XBYTE *AlphaValues, int alphaPitch) {
+    VxBlitLineFunc alphaFunc = GetCopyAlphaFunction(AcquireTables(), dst_desc);
+    if (!alphaFunc) return;
+
+    VxBlitInfo info = {};
+    info.dstBytesPerPixel = dst_desc.BitsPerPixel / 8;
+    info.dstAlphaMask = dst_desc.AlphaMask;
+    info.alphaMaskInv = ~dst_desc.AlphaMask;
+    info.width = dst_desc.Width;
+    info.dstBytesPerLine = dst_desc.BytesPerLine;
+    info.alphaShiftDst = static_cast<int>(GetBitShiftLocal(dst_desc.AlphaMask));
+    info.operationStamp = NextOperationStamp();
+
+    XBYTE *row = dst_desc.Image;
+    const XBYTE *alphaRow = AlphaValues;
+
+    for (int y = 0; y < dst_desc.Height; ++y) {
+        info.srcLine = alphaRow;
+        info.dstLine = row;
+
+        alphaFunc(&info);
+
+        row += dst_desc.BytesPerLine;
+        alphaRow += alphaPitch;
+    }
+}
+
+XBOOL VxBlitEngine::DoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE AlphaValue, const CKRECT *rect) {
+    if (!dst_desc.AlphaMask || !dst_desc.Image) return FALSE;
+
+    CKRECT r;
+    if (!ResolveRect(dst_desc, rect, r)) return FALSE;
+    CKRECT clipped = r;
+    if (!ClipToImage(dst_desc, clipped)) return TRUE;
+
+    VxImageDescEx view;
+    if (!MakeRectView(dst_desc, clipped, view)) return FALSE;
+    DoAlphaBlit(view, AlphaValue);
+    return TRUE;
+}
+
+XBOOL VxBlitEngine::DoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE *AlphaValues, const CKRECT *rect) {
+    if (!dst_desc.AlphaMask || !dst_desc.Image || !AlphaValues) return FALSE;
+
+    CKRECT r;
+    if (!ResolveRect(dst_desc, rect, r)) return FALSE;
+    CKRECT clipped = r;
+    if (!ClipToImage(dst_desc, clipped)) return TRUE;
+
+    VxImageDescEx view;
+    if (!MakeRectView(dst_desc, clipped, view)) return FALSE;
+    const int alphaPitch = r.right - r.left;
+    const XBYTE *alphaFirst = AlphaValues + static_cast<ptrdiff_t>(clipped.top - r.top) * alphaPitch +
+                              (clipped.left - r.left);
+    CopyAlphaRows(view, alphaFirst, alphaPitch);
+    return TRUE;
+}
+
+//==============================================================================
+//  Image Fill / Transform Operations
+//==============================================================================
+
+void VxBlitEngine::FillImage(const VxImageDescEx &dst_desc, XDWORD color) {
+    if (!dst_desc.Image) return;
+    if (dst_desc.Width <= 0 || dst_desc.Height <= 0) return;
+
+    const DispatchTables &tables = AcquireTables();
+    const int bpp = dst_desc.BitsPerPixel / 8;
+    XBYTE *row = dst_desc.Image;
+
+    if (bpp == 4) {
+        // 32-bit fill with runtime-selected SIMD kernel when available.
+        for (int y = 0; y < dst_desc.Height; ++y) {
+            XDWORD *dst = (XDWORD *)row;
+            if (tables.fillLine32) {
+                tables.fillLine32(dst, dst_desc.Width, color);
+            } else {
+                for (int x = 0; x < dst_desc.Width; ++x) {
+                    dst[x] = color;
+                }
+            }
+            row += dst_desc.BytesPerLine;
+        }
+    } else if (bpp == 3) {
+        // 24-bit fill
+        XBYTE b = (XBYTE)(color & 0xFF);
+        XBYTE g = (XBYTE)((color >> 8) & 0xFF);
+        XBYTE r = (XBYTE)((color >> 16) & 0xFF);
+        for (int y = 0; y < dst_desc.Height; ++y) {
+            XBYTE *dst = row;
+            for (int x = 0; x < dst_desc.Width; ++x) {
+                dst[0] = b;
+                dst[1] = g;
+                dst[2] = r;
+                dst += 3;
+            }
+            row += dst_desc.BytesPerLine;
+        }
+    } else if (bpp == 2) {
+        // 16-bit fill with runtime-selected SIMD kernel when available.
+        XWORD color16 = (XWORD)(color & 0xFFFF);
+        for (int y = 0; y < dst_desc.Height; ++y) {
+            XWORD *dst = (XWORD *)row;
+            if (tables.fillLine16) {
+                tables.fillLine16(dst, dst_desc.Width, color16);
+            } else {
+                for (int x = 0; x < dst_desc.Width; ++x) {
+                    dst[x] = color16;
+                }
+            }
+            row += dst_desc.BytesPerLine;
+        }
+    } else if (bpp == 1) {
+        // 8-bit fill
+        XBYTE color8 = (XBYTE)(color & 0xFF);
+        for (int y = 0; y < dst_desc.Height; ++y) {
+            memset(row, color8, dst_desc.Width);
+            row += dst_desc.BytesPerLine;
+        }
+    }
+}
+
+XBOOL VxBlitEngine::FillImage(const VxImageDescEx &dst_desc, XDWORD color, const CKRECT *rect) {
+    if (!dst_desc.Image) return FALSE;
+
+    CKRECT r;
+    if (!ResolveRect(dst_desc, rect, r)) return FALSE;
+    if (!ClipToImage(dst_desc, r)) return TRUE;
+
+    VxImageDescEx view;
+    if (!MakeRectView(dst_desc, r, view)) return FALSE;
+    FillImage(view, color);
+    return TRUE;
+}
+
+void VxBlitEngine::PremultiplyAlpha(const VxImageDescEx &desc) {
+    if (!desc.Image) return;
+    if (desc.BitsPerPixel != 32 || desc.AlphaMask == 0) return;
+    if (desc.Width <= 0 || desc.Height <= 0) return;
+
+    const DispatchTables &tables = AcquireTables();
+    VxBlitInfo info = {};
+    info.width = desc.Width;
+
+    VxBlitLineFunc premulFunc = tables.premultiplyAlpha32 ? tables.premultiplyAlpha32 : PremultiplyAlpha_32ARGB;
+
+    XBYTE *row = desc.Image;
+    for (int y = 0; y < desc.Height; ++y) {
+        info.srcLine = row;
+        info.dstLine = row;  // In-place
+        premulFunc(&info);
+        row += desc.BytesPerLine;
+    }
+}
+
+void VxBlitEngine::UnpremultiplyAlpha(const VxImageDescEx &desc) {
+    if (!desc.Image) return;
+    if (desc.BitsPerPixel != 32 || desc.AlphaMask == 0) return;
+    if (desc.Width <= 0 || desc.Height <= 0) return;
+
+    const DispatchTables &tables = AcquireTables();
+    VxBlitInfo info = {};
+    info.width = desc.Width;
+
+    VxBlitLineFunc unpremulFunc = tables.unpremultiplyAlpha32 ? tables.unpremultiplyAlpha32 : UnpremultiplyAlpha_32ARGB;
+
+    XBYTE *row = desc.Image;
+    for (int y = 0; y < desc.Height; ++y) {
+        info.srcLine = row;
+        info.dstLine = row;  // In-place
+        unpremulFunc(&info);
+        row += desc.BytesPerLine;
+    }
+}
+
+void VxBlitEngine::SwapRedBlue(const VxImageDescEx &desc) {
+    if (!desc.Image) return;
+    if (desc.BitsPerPixel != 32) return;
+    if (desc.Width <= 0 || desc.Height <= 0) return;
+
+    const DispatchTables &tables = AcquireTables();
+    VxBlitInfo info = {};
+    info.width = desc.Width;
+
+    VxBlitLineFunc swapFunc = tables.swapRedBlue32 ? tables.swapRedBlue32 : CopyLine_32ARGB_32ABGR;
+
+    XBYTE *row = desc.Image;
+    for (int y = 0; y < desc.Height; ++y) {
+        info.srcLine = row;
+        info.dstLine = row;  // In-place
+        swapFunc(&info);
+        row += desc.BytesPerLine;
+    }
+}
+
+void VxBlitEngine::ClearAlpha(const VxImageDescEx &desc) {
+    if (!desc.Image) return;
+    if (desc.BitsPerPixel != 32) return;
+    if (desc.Width <= 0 || desc.Height <= 0) return;
+
+    const DispatchTables &tables = AcquireTables();
+    VxBlitInfo info = {};
+    info.width = desc.Width;
+
+    XBYTE *row = desc.Image;
+    for (int y = 0; y < desc.Height; ++y) {
+        info.dstLine = row;
+        if (tables.clearAlpha32) {
+            tables.clearAlpha32(&info);
+        } else {
+            XDWORD *dst = (XDWORD *)row;
+            for (int x = 0; x < desc.Width; ++x) {
+                dst[x] &= 0x00FFFFFF;
+            }
+        }
+        row += desc.BytesPerLine;
+    }
+}
+
+void VxBlitEngine::SetFullAlpha(const VxImageDescEx &desc) {
+    if (!desc.Image) return;
+    if (desc.BitsPerPixel != 32) return;
+    if (desc.Width <= 0 || desc.Height <= 0) return;
+
+    const DispatchTables &tables = AcquireTables();
+    VxBlitInfo info = {};
+    info.width = desc.Width;
+
+    XBYTE *row = desc.Image;
+    for (int y = 0; y < desc.Height; ++y) {
+        info.dstLine = row;
+        if (tables.setFullAlpha32) {
+            tables.setFullAlpha32(&info);
+        } else {
+            XDWORD *dst = (XDWORD *)row;
+            for (int x = 0; x < desc.Width; ++x) {
+                dst[x] |= 0xFF000000;
+            }
+        }
+        row += desc.BytesPerLine;
+    }
+}
+
+void VxBlitEngine::InvertColors(const VxImageDescEx &desc) {
+    if (!desc.Image) return;
+    if (desc.BitsPerPixel != 32) return;
+    if (desc.Width <= 0 || desc.Height <= 0) return;
+
+    const DispatchTables &tables = AcquireTables();
+    VxBlitInfo info = {};
+    info.width = desc.Width;
+
+    XBYTE *row = desc.Image;
+    for (int y = 0; y < desc.Height; ++y) {
+        info.dstLine = row;
+        if (tables.invertColors32) {
+            tables.invertColors32(&info);
+        } else {
+            XDWORD *dst = (XDWORD *)row;
+            for (int x = 0; x < desc.Width; ++x) {
+                dst[x] ^= 0x00FFFFFF;
+            }
+        }
+        row += desc.BytesPerLine;
+    }
+}
+
+void VxBlitEngine::ConvertToGrayscale(const VxImageDescEx &desc) {
+    if (!desc.Image) return;
+    if (desc.BitsPerPixel != 32) return;
+    if (desc.Width <= 0 || desc.Height <= 0) return;
+
+    const DispatchTables &tables = AcquireTables();
+    VxBlitInfo info = {};
+    info.width = desc.Width;
+
+    XBYTE *row = desc.Image;
+    for (int y = 0; y < desc.Height; ++y) {
+        info.srcLine = row;
+        info.dstLine = row;
+        if (tables.grayscale32) {
+            tables.grayscale32(&info);
+        } else {
+            XDWORD *dst = (XDWORD *)row;
+            for (int x = 0; x < desc.Width; ++x) {
+                XDWORD p = dst[x];
+                XDWORD a = p & 0xFF000000;
+                XDWORD r = (p >> 16) & 0xFF;
+                XDWORD g = (p >> 8) & 0xFF;
+                XDWORD b = p & 0xFF;
+                XDWORD y_val = (77 * r + 150 * g + 29 * b) >> 8;
+                dst[x] = a | (y_val << 16) | (y_val << 8) | y_val;
+            }
+        }
+        row += desc.BytesPerLine;
+    }
+}
+
+void VxBlitEngine::MultiplyBlend(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
+    if (!src_desc.Image || !dst_desc.Image) return;
+    if (src_desc.BitsPerPixel != 32 || dst_desc.BitsPerPixel != 32) return;
+    if (src_desc.Width != dst_desc.Width || src_desc.Height != dst_desc.Height) return;
+    if (src_desc.Width <= 0 || src_desc.Height <= 0) return;
+
+    const DispatchTables &tables = AcquireTables();
+    VxBlitInfo info = {};
+    info.width = src_desc.Width;
+
+    const XBYTE *srcRow = src_desc.Image;
+    XBYTE *dstRow = dst_desc.Image;
+    for (int y = 0; y < src_desc.Height; ++y) {
+        info.srcLine = srcRow;
+        info.dstLine = dstRow;
+        if (tables.multiplyBlend32) {
+            tables.multiplyBlend32(&info);
+        } else {
+            // Bug E fix: corrected indentation of else block.
+            const XDWORD *src = (const XDWORD *)srcRow;
+            XDWORD *dst = (XDWORD *)dstRow;
+            for (int x = 0; x < src_desc.Width; ++x) {
+                XDWORD s = src[x];
+                XDWORD d = dst[x];
+                XDWORD r = (((s >> 16) & 0xFF) * ((d >> 16) & 0xFF) + 127) / 255;
+                XDWORD g = (((s >> 8) & 0xFF) * ((d >> 8) & 0xFF) + 127) / 255;
+                XDWORD b = ((s & 0xFF) * (d & 0xFF) + 127) / 255;
+                XDWORD a = (((s >> 24) & 0xFF) * ((d >> 24) & 0xFF) + 127) / 255;
+                dst[x] = (a << 24) | (r << 16) | (g << 8) | b;
+            }
+        }
+        srcRow += src_desc.BytesPerLine;
+        dstRow += dst_desc.BytesPerLine;
+    }
+}
+
+XBOOL VxBlitEngine::BlendImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int op, int dstX,
+                               int dstY, int factor) {
+    return BlendImage(src_desc, dst_desc, op, static_cast<const CKRECT *>(NULL), dstX, dstY, factor);
+}
+
+XBOOL VxBlitEngine::BlendImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int op,
+                               const CKRECT *srcRect, int dstX, int dstY, int factor) {
+    if (!src_desc.Image || !dst_desc.Image) return FALSE;
+    if (src_desc.BitsPerPixel != 32 || dst_desc.BitsPerPixel != 32) return FALSE;
+    if (op < 0 || op >= BLEND_OP_COUNT || factor < 0 || factor > 255) return FALSE;
+    if (src_desc.RedMask != dst_desc.RedMask || src_desc.GreenMask != dst_desc.GreenMask ||
+        src_desc.BlueMask != dst_desc.BlueMask || src_desc.AlphaMask != dst_desc.AlphaMask) {
+        return FALSE;
+    }
+    if ((op == VX_BLEND_SRCOVER || op == VX_BLEND_SRCOVER_PREMULTIPLIED) && src_desc.AlphaMask != 0xFF000000) {
+        return FALSE;
+    }
+
+    // Clip the source rectangle placed at (dstX, dstY) to both images.
+    CKRECT s;
+    if (!ResolveRect(src_desc, srcRect, s)) return FALSE;
+    CKRECT d = {dstX, dstY, dstX + (s.right - s.left), dstY + (s.bottom - s.top)};
+    if (!ClipCopyRects(src_desc, dst_desc, s, d, false)) return TRUE;
+
+    const DispatchTables &tables = AcquireTables();
+    VxBlitInfo info = {};
+    info.width = s.right - s.left;
+    info.alphaValue = static_cast<XDWORD>(factor);
+
+    const XBYTE *srcFirst = src_desc.Image + static_cast<ptrdiff_t>(s.top) * src_desc.BytesPerLine +
+                            static_cast<ptrdiff_t>(s.left) * 4;
+    XBYTE *dstFirst = dst_desc.Image + static_cast<ptrdiff_t>(d.top) * dst_desc.BytesPerLine +
+                      static_cast<ptrdiff_t>(d.left) * 4;
+    BlitRows(info, srcFirst, src_desc.BytesPerLine, dstFirst, dst_desc.BytesPerLine, s.bottom - s.top,
+             tables.blend32[op]);
+    return TRUE;
+}
+
+//==============================================================================
+//  Resize Operations
+//==============================================================================
+
+void VxBlitEngine::DoBlitWithResize(VxBlitInfo &info, const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc,
+                                     VxBlitLineFunc blitFunc) {
+    // Store destination width for line blit
+    info.width = dst_desc.Width;
+    info.copyBytes = dst_desc.Width * 4;
+
+    // Ensure the calling thread's resize buffer is large enough
+    XArray<XDWORD> &resizeBuffer = GetThreadBlitScratch().resizeBuffer;
+    int bufferSize = src_desc.Width + dst_desc.Width + 1;
+    if (resizeBuffer.Size() < bufferSize) {
+        resizeBuffer.Resize(bufferSize);
     }
 
     // Setup resize info (fixed-point 16.16)
@@ -1028,519 +2730,2003 @@ void VxBlitEngine::DoBlitWithResize(const VxImageDescEx &src_desc, const VxImage
     resizeInfo.hr1 = (src_desc.Height << 16) / dst_desc.Height;
     resizeInfo.srcPitch = src_desc.BytesPerLine >> 2;  // Source pitch in DWORDs
 
-    // Intermediate buffer: resized horizontal line stored here before format conversion
-    resizeInfo.dstRow = m_ResizeBuffer.Begin() + src_desc.Width;  // Output buffer for resize
+    // Intermediate buffer: resized horizontal line stored here before format conversion
+    resizeInfo.dstRow = resizeBuffer.Begin() + src_desc.Width;  // Output buffer for resize
+
+    // Setup pointers for the blit function
+    info.srcLine = (const XBYTE *)resizeInfo.dstRow;
+    XBYTE *dstRow = dst_desc.Image;
+
+    const XDWORD *srcImage = (const XDWORD *)src_desc.Image;
+    int srcHeight = src_desc.Height;
+    int dstHeight = dst_desc.Height;
+
+    // Select resize function based on X dimension relationship
+    typedef void (*ResizeLineFunc)(const VxResizeInfo *);
+    ResizeLineFunc growYFunc, shrinkYFunc, equalYFunc;
+
+    if (src_desc.Width == dst_desc.Width) {
+        growYFunc = ResizeHLine_GrowY_EqualX_32Bpp;
+        shrinkYFunc = ResizeHLine_ShrinkY_EqualX_32Bpp;
+        equalYFunc = ResizeHLine_EqualY_EqualX_32Bpp;
+    } else if (src_desc.Width < dst_desc.Width) {
+        growYFunc = ResizeHLine_GrowY_GrowX_32Bpp;
+        shrinkYFunc = ResizeHLine_ShrinkY_GrowX_32Bpp;
+        equalYFunc = ResizeHLine_EqualY_GrowX_32Bpp;
+    } else {
+        growYFunc = ResizeHLine_GrowY_ShrinkX_32Bpp;
+        shrinkYFunc = ResizeHLine_ShrinkY_ShrinkX_32Bpp;
+        equalYFunc = ResizeHLine_EqualY_ShrinkX_32Bpp;
+    }
+
+    if (srcHeight < dstHeight) {
+        // Growing Y: interpolate vertically
+        int yAccum = 0;
+        int yMax = (srcHeight << 16) - 0x10000;
+        int outY = 0;
+
+        // Phase 1: while we haven't reached the last source row
+        while (yAccum < yMax && yAccum >= 0 && outY < dstHeight) {
+            int srcY = yAccum >> 16;
+            resizeInfo.srcRow = srcImage + srcY * resizeInfo.srcPitch;
+            growYFunc(&resizeInfo);
+
+            // Blit the resized line to destination
+            info.dstLine = dstRow;
+            blitFunc(&info);
+
+            dstRow += dst_desc.BytesPerLine;
+            yAccum += resizeInfo.hr1;
+            ++outY;
+        }
+
+        // Phase 2: fill remaining rows with last source row (equal Y copy)
+        if (outY < dstHeight) {
+            resizeInfo.srcRow = srcImage + (srcHeight - 1) * resizeInfo.srcPitch;
+            while (outY < dstHeight) {
+                equalYFunc(&resizeInfo);
+
+                info.dstLine = dstRow;
+                blitFunc(&info);
+
+                dstRow += dst_desc.BytesPerLine;
+                yAccum += resizeInfo.hr1;
+                ++outY;
+            }
+        }
+    } else if (srcHeight > dstHeight) {
+        // Shrinking Y: skip source rows
+        int yAccum = 0;
+        for (int y = 0; y < dstHeight; ++y) {
+            int srcY = yAccum >> 16;
+            resizeInfo.srcRow = srcImage + srcY * resizeInfo.srcPitch;
+            shrinkYFunc(&resizeInfo);
+
+            info.dstLine = dstRow;
+            blitFunc(&info);
+
+            dstRow += dst_desc.BytesPerLine;
+            yAccum += resizeInfo.hr1;
+        }
+    } else {
+        // Equal Y: 1:1 vertical mapping
+        resizeInfo.srcRow = srcImage;
+        for (int y = 0; y < srcHeight; ++y) {
+            equalYFunc(&resizeInfo);
+
+            info.dstLine = dstRow;
+            blitFunc(&info);
+
+            dstRow += dst_desc.BytesPerLine;
+            resizeInfo.srcRow += resizeInfo.srcPitch;
+        }
+    }
+}
+
+void VxBlitEngine::ResizeImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
+    VX_PROFILE_SCOPE("VxBlitEngine::ResizeImage");
+    if (!src_desc.Image || !dst_desc.Image) return;
+    if (src_desc.Width <= 0 || src_desc.Height <= 0) return;
+    if (dst_desc.Width <= 0 || dst_desc.Height <= 0) return;
+
+    // Hybrid resize policy:
+    // - direct bilinear for 24/32 same-format
+    // - every other pair with line converters is unpacked to ARGB rows,
+    //   filtered and packed strip by strip (ResizeBilinearConverted)
+    // - paletted destinations and DXT go through whole-image ARGB temporaries
+    // - nearest-neighbor only for same-format 8-bit
+    int srcChannels = src_desc.BitsPerPixel / 8;
+    int dstChannels = dst_desc.BitsPerPixel / 8;
+    const XBOOL compressed = IsDXTFormat(GetPixelFormat(src_desc)) || IsDXTFormat(GetPixelFormat(dst_desc));
+
+    // Handle 32-bit images directly with optimized bilinear interpolation
+    if (srcChannels == 4 && dstChannels == 4) {
+        ResizeBilinear32(AcquireTables(), src_desc, dst_desc);
+        return;
+    }
+
+    // Handle 24-bit images directly
+    if (srcChannels == 3 && dstChannels == 3) {
+        ResizeBilinear24(src_desc, dst_desc);
+        return;
+    }
+
+    // Same 8-bit formats use direct nearest-neighbor.
+    if (srcChannels == 1 && dstChannels == 1 && !compressed) {
+        ResizeNearestNeighbor(src_desc, dst_desc);
+        return;
+    }
+
+    // 16-bit and mixed formats: unpack, filter and pack strip by strip.
+    if (srcChannels >= 2) {
+        const DispatchTables &tables = AcquireTables();
+        ResizeRowCodec codec;
+        if (InitResizeRowCodec(tables, src_desc, dst_desc, codec)) {
+            ResizeBilinearConverted(tables, codec, src_desc, dst_desc);
+            return;
+        }
+    }
+
+    // Remaining pairs (paletted destinations, DXT): convert to 32-bit, resize, then convert back
+    if (srcChannels >= 2 || compressed) {
+        // Allocate temporary 32-bit buffers
+        XArray<XBYTE> srcTemp, dstTemp;
+        srcTemp.Reserve(src_desc.Width * src_desc.Height * 4);
+        dstTemp.Reserve(dst_desc.Width * dst_desc.Height * 4);
+
+        // Convert source to 32-bit ARGB
+        VxImageDescEx src32;
+        src32.Width = src_desc.Width;
+        src32.Height = src_desc.Height;
+        src32.BitsPerPixel = 32;
+        src32.BytesPerLine = src_desc.Width * 4;
+        src32.RedMask = 0x00FF0000;
+        src32.GreenMask = 0x0000FF00;
+        src32.BlueMask = 0x000000FF;
+        src32.AlphaMask = 0xFF000000;
+        src32.Image = srcTemp.Begin();
+
+        // Blit to 32-bit format
+        DoBlit(src_desc, src32);
+
+        // Create destination 32-bit descriptor
+        VxImageDescEx dst32;
+        dst32.Width = dst_desc.Width;
+        dst32.Height = dst_desc.Height;
+        dst32.BitsPerPixel = 32;
+        dst32.BytesPerLine = dst_desc.Width * 4;
+        dst32.RedMask = 0x00FF0000;
+        dst32.GreenMask = 0x0000FF00;
+        dst32.BlueMask = 0x000000FF;
+        dst32.AlphaMask = 0xFF000000;
+        dst32.Image = dstTemp.Begin();
+
+        // Resize in 32-bit
+        ResizeBilinear32(AcquireTables(), src32, dst32);
+
+        // Convert back to destination format
+        DoBlit(dst32, dst_desc);
+        return;
+    }
+
+    // Fallback: simple nearest-neighbor for 8-bit and non-standard formats
+    ResizeNearestNeighbor(src_desc, dst_desc);
+}
+
+void VxBlitEngine::ResizeImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int filter) {
+    if (filter <= VX_RESIZEFILTER_BILINEAR || filter > VX_RESIZEFILTER_LANCZOS3) {
+        ResizeImage(src_desc, dst_desc);
+        return;
+    }
+    VX_PROFILE_SCOPE("VxBlitEngine::ResizeImage(filter)");
+    if (!src_desc.Image || !dst_desc.Image) return;
+    if (src_desc.Width <= 0 || src_desc.Height <= 0) return;
+    if (dst_desc.Width <= 0 || dst_desc.Height <= 0) return;
+
+    const DispatchTables &tables = AcquireTables();
+    if (src_desc.BitsPerPixel == 32 && dst_desc.BitsPerPixel == 32) {
+        ResampleSeparable32(tables, nullptr, src_desc, dst_desc, filter);
+        return;
+    }
+
+    // Other formats are unpacked and packed around the ARGB 8888 passes.
+    ResizeRowCodec codec;
+    if (InitResizeRowCodec(tables, src_desc, dst_desc, codec)) {
+        ResampleSeparable32(tables, &codec, src_desc, dst_desc, filter);
+        return;
+    }
+
+    // Pairs without line converters (DXT, paletted destinations) go through
+    // whole-image ARGB 8888 temporaries.
+    VxImageDescEx src32;
+    ConvertPixelFormat(_32_ARGB8888, src32);
+    src32.Width = src_desc.Width;
+    src32.Height = src_desc.Height;
+    src32.BytesPerLine = src_desc.Width * 4;
+    VxImageDescEx dst32 = src32;
+    dst32.Width = dst_desc.Width;
+    dst32.Height = dst_desc.Height;
+    dst32.BytesPerLine = dst_desc.Width * 4;
+
+    XArray<XDWORD> srcTemp(src_desc.Width * src_desc.Height);
+    XArray<XDWORD> dstTemp(dst_desc.Width * dst_desc.Height);
+    srcTemp.Resize(src_desc.Width * src_desc.Height);
+    dstTemp.Resize(dst_desc.Width * dst_desc.Height);
+    src32.Image = reinterpret_cast<XBYTE *>(srcTemp.Begin());
+    dst32.Image = reinterpret_cast<XBYTE *>(dstTemp.Begin());
+
+    DoBlit(src_desc, src32);
+    ResampleSeparable32(tables, nullptr, src32, dst32, filter);
+    DoBlit(dst32, dst_desc);
+}
+
+//==============================================================================
+//  YUV Conversion
+//==============================================================================
+
+XBOOL VxBlitEngine::ConvertFromYUV(const VxYUVImageDesc &src_desc, const VxImageDescEx &dst_desc, int filter) {
+    if (!IsValidYUVImage(src_desc) || !dst_desc.Image) return FALSE;
+    if (dst_desc.Width <= 0 || dst_desc.Height <= 0) return FALSE;
+
+    const DispatchTables &tables = AcquireTables();
+
+    // ARGB 8888 stand-in for the source: its rows are decoded from the planes.
+    VxImageDescEx argb;
+    ConvertPixelFormat(_32_ARGB8888, argb);
+    argb.Width = src_desc.Width;
+    argb.Height = src_desc.Height;
+    argb.BytesPerLine = src_desc.Width * 4;
+
+    ResizeRowCodec codec;
+    if (!InitResizeRowCodec(tables, argb, dst_desc, codec)) {
+        // Destinations without a line packer (DXT, paletted) are converted
+        // from a destination-sized ARGB 8888 temporary.
+        VxImageDescEx dst32 = argb;
+        dst32.Width = dst_desc.Width;
+        dst32.Height = dst_desc.Height;
+        dst32.BytesPerLine = dst_desc.Width * 4;
+        XArray<XDWORD> dstTemp(dst_desc.Width * dst_desc.Height);
+        dstTemp.Resize(dst_desc.Width * dst_desc.Height);
+        dst32.Image = reinterpret_cast<XBYTE *>(dstTemp.Begin());
+        if (!ConvertFromYUV(src_desc, dst32, filter)) return FALSE;
+        DoBlit(dst32, dst_desc);
+        return TRUE;
+    }
+    codec.yuv = &src_desc;
+    codec.decodeYUV = tables.decodeYUV[src_desc.Format];
+
+    if (dst_desc.Width != src_desc.Width || dst_desc.Height != src_desc.Height) {
+        if (filter <= VX_RESIZEFILTER_BILINEAR || filter > VX_RESIZEFILTER_LANCZOS3) {
+            ResizeBilinearConverted(tables, codec, argb, dst_desc);
+        } else {
+            ResampleSeparable32(tables, &codec, argb, dst_desc, filter);
+        }
+        return TRUE;
+    }
+
+    const int width = src_desc.Width;
+    XArray<XDWORD> &scratch = GetThreadBlitScratch().resizeBuffer;
+    if (scratch.Size() < width + 1) {
+        scratch.Resize(width + 1);
+    }
+
+    VxBlitInfo unpackInfo = codec.unpackInfo;
+    VxBlitInfo packInfo = codec.packInfo;
+    packInfo.width = width;
+    packInfo.copyBytes = width * 4;
+
+    for (int y = 0; y < src_desc.Height; ++y) {
+        XBYTE *dstPixels = dst_desc.Image + y * dst_desc.BytesPerLine;
+        if (!codec.pack) {
+            // ARGB 8888 destinations are decoded in place.
+            UnpackResizeRow(codec, unpackInfo, argb, y, 0, width, reinterpret_cast<XDWORD *>(dstPixels));
+            continue;
+        }
+        packInfo.srcLine = reinterpret_cast<const XBYTE *>(
+            UnpackResizeRow(codec, unpackInfo, argb, y, 0, width, scratch.Begin()));
+        packInfo.dstLine = dstPixels;
+        codec.pack(&packInfo);
+    }
+    return TRUE;
+}
+
+XBOOL VxBlitEngine::ConvertToYUV(const VxImageDescEx &src_desc, const VxYUVImageDesc &dst_desc) {
+    if (!IsValidYUVImage(dst_desc) || dst_desc.Format == VX_YUV_YUY2) return FALSE;
+    if (!src_desc.Image) return FALSE;
+    if (src_desc.Width != dst_desc.Width || src_desc.Height != dst_desc.Height) return FALSE;
+
+    const DispatchTables &tables = AcquireTables();
+
+    VxImageDescEx argb;
+    ConvertPixelFormat(_32_ARGB8888, argb);
+    argb.Width = src_desc.Width;
+    argb.Height = src_desc.Height;
+    argb.BytesPerLine = src_desc.Width * 4;
+
+    // Only the unpack half is used; ARGB 8888 sources are read in place.
+    ResizeRowCodec codec;
+    if (!InitResizeRowCodec(tables, src_desc, argb, codec)) return FALSE;
+
+    const int width = src_desc.Width;
+    const int height = src_desc.Height;
+    XArray<XDWORD> &scratch = GetThreadBlitScratch().resizeBuffer;
+    if (scratch.Size() < (width + 1) * 2) {
+        scratch.Resize((width + 1) * 2);
+    }
+    XDWORD *rows[2] = {scratch.Begin(), scratch.Begin() + width + 1};
+
+    VxBlitInfo unpackInfo = codec.unpackInfo;
+    const VxYUVEncodeFunc encode = tables.encodeYUV[dst_desc.Format];
+    const bool planar = dst_desc.Format == VX_YUV_I420;
+
+    // Rows are encoded in pairs sharing one chroma row; an odd last row is
+    // paired with itself.
+    for (int y = 0; y < height; y += 2) {
+        const int y1 = XMin(y + 1, height - 1);
+        const XDWORD *src0 = UnpackResizeRow(codec, unpackInfo, src_desc, y, 0, width, rows[0]);
+        const XDWORD *src1 = y1 != y ? UnpackResizeRow(codec, unpackInfo, src_desc, y1, 0, width, rows[1]) : src0;
+
+        XBYTE *luma0 = dst_desc.Planes[0] + y * dst_desc.Pitches[0];
+        XBYTE *luma1 = dst_desc.Planes[0] + y1 * dst_desc.Pitches[0];
+        XBYTE *u = dst_desc.Planes[1] + (y >> 1) * dst_desc.Pitches[1];
+        XBYTE *v = planar ? dst_desc.Planes[2] + (y >> 1) * dst_desc.Pitches[2] : nullptr;
+        encode(src0, src1, width, luma0, luma1, u, v, dst_desc.Matrix);
+    }
+    return TRUE;
+}
+
+//==============================================================================
+//  Normal and Bump Maps
+//==============================================================================
+
+namespace {
+
+struct GradientMapJob {
+    const VxImageDescEx *src;
+    const VxImageDescEx *dst;
+    VxHeightRowFunc height;
+    XDWORD mask;
+    int shift;
+    VxNormalRowFunc normal; // Null for bump maps
+    VxBumpRowFunc bump;
+    float scale;
+    int filter;
+    int rows;      // Output rows [0, rows)
+    int topRow;    // Source row read above row 0
+    int bottomRow; // Source row read below the last image row
+    int bandRows;
+    int *halos;    // Per band: heights of the rows above its first and below its last row
+};
+
+void ReadHeightRow(const GradientMapJob &job, int y, int *heights) {
+    const XBYTE *src = job.src->Image + static_cast<ptrdiff_t>(y) * job.src->BytesPerLine;
+    job.height(reinterpret_cast<const XDWORD *>(src), heights, job.src->Width, job.mask, job.shift);
+}
+
+int GradientRowAbove(const GradientMapJob &job, int y) {
+    return y > 0 ? y - 1 : job.topRow;
+}
+
+int GradientRowBelow(const GradientMapJob &job, int y) {
+    return y + 1 < job.src->Height ? y + 1 : job.bottomRow;
+}
+
+void CaptureGradientHalos(const GradientMapJob &job, int bands) {
+    const int width = job.src->Width;
+    for (int band = 0; band < bands; ++band) {
+        const int first = band * job.bandRows;
+        const int last = XMin(first + job.bandRows, job.rows);
+        int *halo = job.halos + static_cast<ptrdiff_t>(band) * 2 * width;
+        ReadHeightRow(job, GradientRowAbove(job, first), halo);
+        ReadHeightRow(job, GradientRowBelow(job, last - 1), halo + width);
+    }
+}
+
+void RunGradientMapBands(void *userData, int begin, int end) {
+    const GradientMapJob &job = *static_cast<const GradientMapJob *>(userData);
+    const int width = job.src->Width;
+
+    // Three-row window, slot y % 3. Each source row is read before the output
+    // row above it is written, so the destination may alias the source.
+    XArray<int> ring(width * 3);
+    ring.Resize(width * 3);
+
+    for (int band = begin; band < end; ++band) {
+        const int first = band * job.bandRows;
+        const int last = XMin(first + job.bandRows, job.rows);
+        const int *haloAbove = job.halos + static_cast<ptrdiff_t>(band) * 2 * width;
+        const int *haloBelow = haloAbove + width;
+
+        ReadHeightRow(job, first, &ring[(first % 3) * width]);
+        for (int y = first; y < last; ++y) {
+            const int *rows[3];
+            rows[0] = y > first ? &ring[((y - 1) % 3) * width] : haloAbove;
+            rows[1] = &ring[(y % 3) * width];
+            rows[2] = haloBelow;
+            if (y + 1 < last) {
+                int *below = &ring[((y + 1) % 3) * width];
+                ReadHeightRow(job, y + 1, below);
+                rows[2] = below;
+            }
+
+            XBYTE *dstRow = job.dst->Image + static_cast<ptrdiff_t>(y) * job.dst->BytesPerLine;
+            XDWORD *dst = reinterpret_cast<XDWORD *>(dstRow);
+            if (job.normal) {
+                job.normal(rows, dst, width, job.scale, job.filter);
+            } else {
+                job.bump(rows, dst, width, job.filter);
+            }
+        }
+    }
+}
+
+void RunGradientMap(GradientMapJob &job, int threads, int minRows) {
+    const int width = job.src->Width;
+    if (job.rows <= 0) return;
+
+    minRows = XMax(1, minRows);
+    int bands = 1;
+    if (threads > 1 && job.rows >= 2 * minRows) {
+        bands = XMin(threads, job.rows / minRows);
+    }
+    job.bandRows = (job.rows + bands - 1) / bands;
+    bands = (job.rows + job.bandRows - 1) / job.bandRows;
+
+    // Halo rows are captured up front: in place, a neighboring band may
+    // already have overwritten them by the time they are needed.
+    XArray<int> halos(bands * 2 * width);
+    halos.Resize(bands * 2 * width);
+    job.halos = halos.Begin();
+    CaptureGradientHalos(job, bands);
+
+    VxParallelFor(bands, 1, bands, RunGradientMapBands, &job);
+}
+
+} // namespace
+
+static bool IsGradientMapPair(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int filter) {
+    if (!src_desc.Image || !dst_desc.Image) return false;
+    if (src_desc.BitsPerPixel != 32 || dst_desc.BitsPerPixel != 32) return false;
+    if (src_desc.Width <= 0 || src_desc.Height <= 0 || src_desc.BytesPerLine <= 0) return false;
+    if (dst_desc.Width != src_desc.Width || dst_desc.Height != src_desc.Height) return false;
+    return filter >= VX_GRADIENTFILTER_DEFAULT && filter <= VX_GRADIENTFILTER_SCHARR;
+}
+
+XBOOL VxBlitEngine::ConvertToNormalMap(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc,
+                                       XDWORD colorMask, int filter) {
+    if (!IsGradientMapPair(src_desc, dst_desc, filter)) return FALSE;
+
+    const DispatchTables &tables = AcquireTables();
+    const int width = src_desc.Width;
+    const int height = src_desc.Height;
+
+    GradientMapJob job;
+    job.src = &src_desc;
+    job.dst = &dst_desc;
+    if (colorMask == 0xFFFFFFFF) {
+        job.height = tables.heightRow[0];
+        job.mask = 0;
+        job.shift = 0;
+        job.scale = 0.0013071896f; // 1 / 765 as the original rounded it
+    } else {
+        job.height = tables.heightRow[1];
+        job.mask = colorMask;
+        job.shift = static_cast<int>(GetBitShiftLocal(colorMask));
+        job.scale = 1.0f / 255.0f;
+    }
+    job.normal = tables.normalMapRow;
+    job.bump = nullptr;
+    job.filter = filter;
+    job.topRow = 0;
+    job.bottomRow = height - 1;
+    job.bandRows = 0;
+    job.halos = nullptr;
+
+    // The original stencil has no row below the last one: it stops one row
+    // early and repeats the row above (a single row is left unchanged).
+    const bool repeatLastRow = filter == VX_GRADIENTFILTER_DEFAULT;
+    job.rows = repeatLastRow ? height - 1 : height;
+    RunGradientMap(job, VxAtomicLoadInt(&m_BlitThreadCount), VxAtomicLoadInt(&m_MinRowsPerBand));
+
+    if (repeatLastRow) {
+        XBYTE *lastRow = dst_desc.Image + static_cast<ptrdiff_t>(height - 1) * dst_desc.BytesPerLine;
+        const XBYTE *copyFrom = height > 1 ? lastRow - dst_desc.BytesPerLine : src_desc.Image;
+        if (copyFrom != lastRow) {
+            memmove(lastRow, copyFrom, width * 4);
+        }
+    }
+    return TRUE;
+}
+
+XBOOL VxBlitEngine::ConvertToBumpMap(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int filter) {
+    if (!IsGradientMapPair(src_desc, dst_desc, filter) || src_desc.Width < 2) return FALSE;
+
+    const DispatchTables &tables = AcquireTables();
+    const int height = src_desc.Height;
+
+    GradientMapJob job;
+    job.src = &src_desc;
+    job.dst = &dst_desc;
+    job.height = tables.heightRow[0];
+    job.mask = 0;
+    job.shift = 0;
+    job.normal = nullptr;
+    job.bump = tables.bumpMapRow;
+    job.scale = 0.0f;
+    job.filter = filter;
+    job.rows = height;
+    // The original stencil wraps at the top and repeats the last row at the
+    // bottom; the other operators wrap both ways.
+    job.topRow = height - 1;
+    job.bottomRow = filter == VX_GRADIENTFILTER_DEFAULT ? height - 1 : 0;
+    job.bandRows = 0;
+    job.halos = nullptr;
+    RunGradientMap(job, VxAtomicLoadInt(&m_BlitThreadCount), VxAtomicLoadInt(&m_MinRowsPerBand));
+    return TRUE;
+}
+
+//==============================================================================
+//  Separable Resampling
+//==============================================================================
+
+namespace {
+
+const int RESAMPLE_WEIGHT_BITS = 14;
+
+double ResampleSinc(double x) {
+    if (x == 0.0) return 1.0;
+    x *= 3.14159265358979323846;
+    return std::sin(x) / x;
+}
+
+// Filter support radius in source pixels at a scale of 1.
+double ResampleFilterRadius(int filter) {
+    switch (filter) {
+        case VX_RESIZEFILTER_BOX:
+            return 0.5;
+        case VX_RESIZEFILTER_TRIANGLE:
+            return 1.0;
+        case VX_RESIZEFILTER_MITCHELL:
+            return 2.0;
+        default:
+            return 3.0;
+    }
+}
+
+double ResampleFilterWeight(int filter, double x) {
+    const double ax = x < 0.0 ? -x : x;
+    switch (filter) {
+        case VX_RESIZEFILTER_BOX:
+            return (x >= -0.5 && x < 0.5) ? 1.0 : 0.0;
+        case VX_RESIZEFILTER_TRIANGLE:
+            return ax < 1.0 ? 1.0 - ax : 0.0;
+        case VX_RESIZEFILTER_MITCHELL: {
+            const double B = 1.0 / 3.0;
+            const double C = 1.0 / 3.0;
+            if (ax < 1.0) {
+                return ((12 - 9 * B - 6 * C) * ax * ax * ax + (-18 + 12 * B + 6 * C) * ax * ax + (6 - 2 * B)) / 6.0;
+            }
+            if (ax < 2.0) {
+                return ((-B - 6 * C) * ax * ax * ax + (6 * B + 30 * C) * ax * ax + (-12 * B - 48 * C) * ax +
+                        (8 * B + 24 * C)) / 6.0;
+            }
+            return 0.0;
+        }
+        default:
+            return ax < 3.0 ? ResampleSinc(x) * ResampleSinc(x / 3.0) : 0.0;
+    }
+}
+
+// Per-output tap window along one axis. Every output reads @c taps source
+// samples starting at first[i]; edge samples are clamped by folding the
+// out-of-range weights onto the border pixel.
+struct ResampleAxis {
+    int taps;
+    XArray<int> first;
+    XArray<short> weights;
+};
+
+void BuildResampleAxis(int srcSize, int dstSize, int filter, ResampleAxis &axis) {
+    const double scale = static_cast<double>(srcSize) / dstSize;
+    const double filterScale = scale > 1.0 ? scale : 1.0;
+    const double support = ResampleFilterRadius(filter) * filterScale;
+
+    // Exact weights per output over the clamped source range [lo, hi].
+    int maxSpan = 1;
+    XArray<double> exact;
+    XArray<int> spanLo(dstSize);
+    XArray<int> spanHi(dstSize);
+    spanLo.Resize(dstSize);
+    spanHi.Resize(dstSize);
+    const int window = static_cast<int>(std::ceil(support * 2.0)) + 2;
+    exact.Resize(dstSize * window);
+
+    for (int i = 0; i < dstSize; ++i) {
+        const double center = (i + 0.5) * scale;
+        const int start = static_cast<int>(std::floor(center - support));
+        double *w = &exact[i * window];
+        for (int k = 0; k < window; ++k) w[k] = 0.0;
+
+        int lo = srcSize;
+        int hi = -1;
+        double sum = 0.0;
+        for (int k = 0; k < window; ++k) {
+            const int j = start + k;
+            const double weight = ResampleFilterWeight(filter, (j + 0.5 - center) / filterScale);
+            if (weight == 0.0) continue;
+            const int clamped = j < 0 ? 0 : (j >= srcSize ? srcSize - 1 : j);
+            if (clamped < lo) lo = clamped;
+            if (clamped > hi) hi = clamped;
+            w[clamped - start] += weight;
+            sum += weight;
+        }
+        if (hi < lo || sum == 0.0) {
+            // Degenerate window: take the nearest source pixel.
+            int nearest = static_cast<int>(center);
+            if (nearest >= srcSize) nearest = srcSize - 1;
+            for (int k = 0; k < window; ++k) w[k] = 0.0;
+            lo = hi = nearest;
+            w[nearest - start] = 1.0;
+            sum = 1.0;
+        }
+        for (int k = 0; k < window; ++k) w[k] /= sum;
+        spanLo[i] = lo;
+        spanHi[i] = hi;
+        if (hi - lo + 1 > maxSpan) maxSpan = hi - lo + 1;
+    }
+
+    axis.taps = maxSpan;
+    axis.first.Resize(dstSize);
+    axis.weights.Resize(dstSize * maxSpan);
+    for (int i = 0; i < dstSize; ++i) {
+        const double center = (i + 0.5) * scale;
+        const int start = static_cast<int>(std::floor(center - support));
+        const double *w = &exact[i * window];
+
+        int first = spanLo[i];
+        if (first + maxSpan > srcSize) first = srcSize - maxSpan;
+        axis.first[i] = first;
+
+        // Round to fixed point and give the rounding error to the largest tap
+        // so every row of weights sums to exactly 1.0.
+        short *q = &axis.weights[i * maxSpan];
+        int total = 0;
+        int largest = 0;
+        for (int t = 0; t < maxSpan; ++t) {
+            const int k = first + t - start;
+            const double weight = (k >= 0 && k < window) ? w[k] : 0.0;
+            q[t] = static_cast<short>(std::floor(weight * (1 << RESAMPLE_WEIGHT_BITS) + 0.5));
+            total += q[t];
+            if (q[t] > q[largest]) largest = t;
+        }
+        q[largest] = static_cast<short>(q[largest] + (1 << RESAMPLE_WEIGHT_BITS) - total);
+    }
+}
+
+} // namespace
+
+void VxBlitEngine::ResampleSeparable32(const DispatchTables &tables, const ResizeRowCodec *codec,
+                                       const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int filter) {
+    const int srcW = src_desc.Width;
+    const int srcH = src_desc.Height;
+    const int dstW = dst_desc.Width;
+    const int dstH = dst_desc.Height;
+
+    ResampleAxis horz;
+    ResampleAxis vert;
+    BuildResampleAxis(srcW, dstW, filter, horz);
+    BuildResampleAxis(srcH, dstH, filter, vert);
+
+    // Ring of horizontally filtered rows: source row r lives in slot r % taps.
+    // Windows only move forward, so a slot is never needed by two rows at once.
+    const int taps = vert.taps;
+    const int rowStride = (dstW * 4 + 15) & ~15;
+    XArray<short> ring(taps * rowStride);
+    ring.Resize(taps * rowStride);
+    XArray<int> slotRow(taps);
+    slotRow.Resize(taps);
+    for (int t = 0; t < taps; ++t) slotRow[t] = -1;
+
+    XArray<const short *> rows(taps);
+    rows.Resize(taps);
+
+    // One ARGB source row and one ARGB output row for the row converters.
+    const VxBlitLineFunc pack = codec ? codec->pack : nullptr;
+    XArray<XDWORD> &scratch = GetThreadBlitScratch().resizeBuffer;
+    if (scratch.Size() < srcW + 1 + dstW) {
+        scratch.Resize(srcW + 1 + dstW);
+    }
+    XDWORD *srcArgb = scratch.Begin();
+    XDWORD *dstArgb = scratch.Begin() + srcW + 1;
+
+    VxBlitInfo unpackInfo;
+    VxBlitInfo packInfo;
+    if (codec) {
+        unpackInfo = codec->unpackInfo;
+    }
+    if (pack) {
+        packInfo = codec->packInfo;
+        packInfo.width = dstW;
+        packInfo.copyBytes = dstW * 4;
+        packInfo.srcLine = reinterpret_cast<const XBYTE *>(dstArgb);
+    }
+
+    for (int y = 0; y < dstH; ++y) {
+        const int first = vert.first[y];
+        for (int t = 0; t < taps; ++t) {
+            const int srcY = first + t;
+            const int slot = srcY % taps;
+            short *row = &ring[slot * rowStride];
+            if (slotRow[slot] != srcY) {
+                const XDWORD *srcRow =
+                    codec ? UnpackResizeRow(*codec, unpackInfo, src_desc, srcY, 0, srcW, srcArgb)
+                          : reinterpret_cast<const XDWORD *>(src_desc.Image + srcY * src_desc.BytesPerLine);
+                tables.resampleHorz32(srcRow, row, dstW, horz.first.Begin(), horz.weights.Begin(), horz.taps);
+                slotRow[slot] = srcY;
+            }
+            rows[t] = row;
+        }
+
+        XBYTE *dstPixels = dst_desc.Image + y * dst_desc.BytesPerLine;
+        if (!pack) {
+            tables.resampleVert32(rows.Begin(), &vert.weights[y * taps], taps, reinterpret_cast<XDWORD *>(dstPixels),
+                                  dstW);
+            continue;
+        }
+        tables.resampleVert32(rows.Begin(), &vert.weights[y * taps], taps, dstArgb, dstW);
+        packInfo.dstLine = dstPixels;
+        pack(&packInfo);
+    }
+}
+
+//==============================================================================
+//  Bilinear Resize Implementation
+//==============================================================================
+
+namespace {
+
+// Per-column taps shared by every row of a bilinear resize. The source x
+// advances in 16.16 fixed point from 0, one scale step per output pixel.
+struct BilinearColumns {
+    XArray<int> x0;
+    XArray<int> x1;
+    XArray<int> frac; // 16-bit fraction towards x1 (scalar kernel)
+    XArray<int> w0;   // 8-bit weight of x0 (SSE2 kernel)
+};
+
+void BuildBilinearColumns(int srcW, int dstW, BilinearColumns &cols) {
+    const int scaleX = (srcW << 16) / dstW;
+    cols.x0.Resize(dstW);
+    cols.x1.Resize(dstW);
+    cols.frac.Resize(dstW);
+    cols.w0.Resize(dstW);
+    int srcXFixed = 0;
+    for (int x = 0; x < dstW; ++x) {
+        const int srcX0 = srcXFixed >> 16;
+        const int fracX = srcXFixed & 0xFFFF;
+        cols.x0[x] = srcX0;
+        cols.x1[x] = XMin(srcX0 + 1, srcW - 1);
+        cols.frac[x] = fracX;
+        cols.w0[x] = (0x10000 - fracX + 128) >> 8;
+        srcXFixed += scaleX;
+    }
+}
+
+// Filters output pixels [begin, end) of one row from two 32-bit source rows.
+// The rows hold source columns starting at @p base; dst receives pixel begin first.
+void BilinearRow32(int kernelMode, const XDWORD *row0, const XDWORD *row1, int base, int fracY,
+                   const BilinearColumns &cols, int begin, int end, XDWORD *dst) {
+    const int invFracY = 0x10000 - fracY;
+
+#if defined(VX_SIMD_SSE2)
+    if (kernelMode != VX_SIMD_MODE_NONE) {
+        const int wY0 = (invFracY + 128) >> 8;
+        const int wY1 = 256 - wY0;
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i vwY0 = _mm_set1_epi16((short)wY0);
+        const __m128i vwY1 = _mm_set1_epi16((short)wY1);
+
+        // Two output pixels per iteration, one in each 64-bit half. The lanes
+        // are independent, so this matches filtering one pixel at a time.
+        int x = begin;
+        for (; x + 1 < end; x += 2) {
+            const int a0 = cols.x0[x] - base;
+            const int a1 = cols.x1[x] - base;
+            const int b0 = cols.x0[x + 1] - base;
+            const int b1 = cols.x1[x + 1] - base;
+            const short wA = (short)cols.w0[x];
+            const short wB = (short)cols.w0[x + 1];
+
+            const __m128i px00 = _mm_unpacklo_epi8(
+                _mm_unpacklo_epi32(_mm_cvtsi32_si128(row0[a0]), _mm_cvtsi32_si128(row0[b0])), zero);
+            const __m128i px10 = _mm_unpacklo_epi8(
+                _mm_unpacklo_epi32(_mm_cvtsi32_si128(row0[a1]), _mm_cvtsi32_si128(row0[b1])), zero);
+            const __m128i px01 = _mm_unpacklo_epi8(
+                _mm_unpacklo_epi32(_mm_cvtsi32_si128(row1[a0]), _mm_cvtsi32_si128(row1[b0])), zero);
+            const __m128i px11 = _mm_unpacklo_epi8(
+                _mm_unpacklo_epi32(_mm_cvtsi32_si128(row1[a1]), _mm_cvtsi32_si128(row1[b1])), zero);
+
+            const __m128i vwX0 = _mm_set_epi16(wB, wB, wB, wB, wA, wA, wA, wA);
+            const __m128i vwX1 = _mm_sub_epi16(_mm_set1_epi16(256), vwX0);
+
+            __m128i top = _mm_mullo_epi16(px00, vwX0);
+            top = _mm_add_epi16(top, _mm_mullo_epi16(px10, vwX1));
+            top = _mm_srli_epi16(top, 8);
+
+            __m128i bottom = _mm_mullo_epi16(px01, vwX0);
+            bottom = _mm_add_epi16(bottom, _mm_mullo_epi16(px11, vwX1));
+            bottom = _mm_srli_epi16(bottom, 8);
+
+            __m128i result = _mm_mullo_epi16(top, vwY0);
+            result = _mm_add_epi16(result, _mm_mullo_epi16(bottom, vwY1));
+            result = _mm_srli_epi16(result, 8);
+            result = _mm_packus_epi16(result, zero);
+
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + (x - begin)), result);
+        }
+
+        for (; x < end; ++x) {
+            const int srcX0 = cols.x0[x] - base;
+            const int srcX1 = cols.x1[x] - base;
+            const int wX0 = cols.w0[x];
+            const int wX1 = 256 - wX0;
+
+            // Unpack the 4 corner pixels to 16-bit and multiply
+            const __m128i px00 = _mm_unpacklo_epi8(_mm_cvtsi32_si128(row0[srcX0]), zero);
+            const __m128i px10 = _mm_unpacklo_epi8(_mm_cvtsi32_si128(row0[srcX1]), zero);
+            const __m128i px01 = _mm_unpacklo_epi8(_mm_cvtsi32_si128(row1[srcX0]), zero);
+            const __m128i px11 = _mm_unpacklo_epi8(_mm_cvtsi32_si128(row1[srcX1]), zero);
+
+            const __m128i vwX0 = _mm_set1_epi16((short)wX0);
+            const __m128i vwX1 = _mm_set1_epi16((short)wX1);
+
+            __m128i top = _mm_mullo_epi16(px00, vwX0);
+            top = _mm_add_epi16(top, _mm_mullo_epi16(px10, vwX1));
+            top = _mm_srli_epi16(top, 8);
+
+            __m128i bottom = _mm_mullo_epi16(px01, vwX0);
+            bottom = _mm_add_epi16(bottom, _mm_mullo_epi16(px11, vwX1));
+            bottom = _mm_srli_epi16(bottom, 8);
+
+            __m128i result = _mm_mullo_epi16(top, vwY0);
+            result = _mm_add_epi16(result, _mm_mullo_epi16(bottom, vwY1));
+            result = _mm_srli_epi16(result, 8);
+            result = _mm_packus_epi16(result, zero);
+
+            dst[x - begin] = _mm_cvtsi128_si32(result);
+        }
+        return;
+    }
+#else
+    (void)kernelMode;
+#endif
+
+    for (int x = begin; x < end; ++x) {
+        const int srcX0 = cols.x0[x] - base;
+        const int srcX1 = cols.x1[x] - base;
+        const XDWORD fracX = cols.frac[x];
+        const XDWORD invFracX = 0x10000 - fracX;
+
+        XDWORD p00 = row0[srcX0];
+        XDWORD p10 = row0[srcX1];
+        XDWORD p01 = row1[srcX0];
+        XDWORD p11 = row1[srcX1];
+
+        // Bilinear interpolation for each channel
+        XDWORD a = ((((p00 >> 24) & 0xFF) * invFracX + ((p10 >> 24) & 0xFF) * fracX) >> 16) * invFracY +
+                   ((((p01 >> 24) & 0xFF) * invFracX + ((p11 >> 24) & 0xFF) * fracX) >> 16) * fracY;
+        XDWORD r = ((((p00 >> 16) & 0xFF) * invFracX + ((p10 >> 16) & 0xFF) * fracX) >> 16) * invFracY +
+                   ((((p01 >> 16) & 0xFF) * invFracX + ((p11 >> 16) & 0xFF) * fracX) >> 16) * fracY;
+        XDWORD g = ((((p00 >> 8) & 0xFF) * invFracX + ((p10 >> 8) & 0xFF) * fracX) >> 16) * invFracY +
+                   ((((p01 >> 8) & 0xFF) * invFracX + ((p11 >> 8) & 0xFF) * fracX) >> 16) * fracY;
+        XDWORD b = (((p00 & 0xFF) * invFracX + (p10 & 0xFF) * fracX) >> 16) * invFracY +
+                   (((p01 & 0xFF) * invFracX + (p11 & 0xFF) * fracX) >> 16) * fracY;
+
+        dst[x - begin] = ((a >> 16) << 24) | ((r >> 16) << 16) | ((g >> 16) << 8) | (b >> 16);
+    }
+}
+
+// Source rows and vertical fraction for output row @p y.
+inline void BilinearRowsFor(int y, int scaleY, int srcH, int &srcY0, int &srcY1, int &fracY) {
+    const int srcYFixed = y * scaleY;
+    srcY0 = srcYFixed >> 16;
+    srcY1 = XMin(srcY0 + 1, srcH - 1);
+    fracY = srcYFixed & 0xFFFF;
+}
+
+// Source columns per strip when resizing through row converters; two unpacked
+// rows plus one output row stay well inside L1.
+const int RESIZE_STRIP_SOURCE_PIXELS = 512;
+
+} // namespace
+
+void VxBlitEngine::ResizeBilinear32(const DispatchTables &tables, const VxImageDescEx &src_desc,
+                                    const VxImageDescEx &dst_desc) {
+    const int srcH = src_desc.Height;
+    const int dstW = dst_desc.Width;
+    const int dstH = dst_desc.Height;
+    const int scaleY = (srcH << 16) / dstH;
+
+    BilinearColumns cols;
+    BuildBilinearColumns(src_desc.Width, dstW, cols);
+
+    for (int y = 0; y < dstH; ++y) {
+        int srcY0, srcY1, fracY;
+        BilinearRowsFor(y, scaleY, srcH, srcY0, srcY1, fracY);
+
+        const XDWORD *srcRow0 = (const XDWORD *)(src_desc.Image + srcY0 * src_desc.BytesPerLine);
+        const XDWORD *srcRow1 = (const XDWORD *)(src_desc.Image + srcY1 * src_desc.BytesPerLine);
+        XDWORD *dstRow = (XDWORD *)(dst_desc.Image + y * dst_desc.BytesPerLine);
+        BilinearRow32(tables.kernelMode, srcRow0, srcRow1, 0, fracY, cols, 0, dstW, dstRow);
+    }
+}
+
+XBOOL VxBlitEngine::InitResizeRowCodec(const DispatchTables &tables, const VxImageDescEx &src_desc,
+                                       const VxImageDescEx &dst_desc, ResizeRowCodec &codec) {
+    VxImageDescEx argb;
+    ConvertPixelFormat(_32_ARGB8888, argb);
+    XBYTE byteShuffle[16];
+
+    codec.unpack = nullptr;
+    codec.pack = nullptr;
+    codec.yuv = nullptr;
+    codec.decodeYUV = nullptr;
+
+    if (GetPixelFormat(src_desc) != _32_ARGB8888 || src_desc.ColorMapEntries > 0) {
+        argb.Width = src_desc.Width;
+        argb.Height = 1;
+        argb.BytesPerLine = src_desc.Width * 4;
+        codec.unpack = GetBlitFunction(tables, src_desc, argb, byteShuffle);
+        if (!codec.unpack) return FALSE;
+        SetupBlitInfo(codec.unpackInfo, src_desc, argb, byteShuffle);
+        codec.unpackInfo.srcBytesPerLine = src_desc.BytesPerLine;
+        codec.unpackInfo.dstBytesPerLine = argb.BytesPerLine;
+        codec.unpackInfo.operationStamp = NextOperationStamp();
+    }
+
+    if (dst_desc.ColorMapEntries > 0) return FALSE;
+    if (GetPixelFormat(dst_desc) != _32_ARGB8888) {
+        argb.Width = dst_desc.Width;
+        argb.Height = 1;
+        argb.BytesPerLine = dst_desc.Width * 4;
+        codec.pack = GetBlitFunction(tables, argb, dst_desc, byteShuffle);
+        if (!codec.pack) return FALSE;
+        SetupBlitInfo(codec.packInfo, argb, dst_desc, byteShuffle);
+        codec.packInfo.srcBytesPerLine = argb.BytesPerLine;
+        codec.packInfo.dstBytesPerLine = dst_desc.BytesPerLine;
+        codec.packInfo.operationStamp = NextOperationStamp();
+    }
+    return TRUE;
+}
+
+const XDWORD *VxBlitEngine::UnpackResizeRow(const ResizeRowCodec &codec, VxBlitInfo &unpackInfo,
+                                            const VxImageDescEx &src_desc, int y, int x, int count,
+                                            XDWORD *scratch) {
+    if (codec.yuv) {
+        // Chroma is shared by column pairs, so decoding starts on an even column.
+        const int phase = x & 1;
+        const XBYTE *planes[3];
+        GetYUVRowPlanes(*codec.yuv, y, x - phase, planes);
+        codec.decodeYUV(planes[0], planes[1], planes[2], scratch, count + phase, codec.yuv->Matrix);
+        return scratch + phase;
+    }
+
+    const XBYTE *srcPixels = src_desc.Image + y * src_desc.BytesPerLine + x * (src_desc.BitsPerPixel / 8);
+    if (!codec.unpack) {
+        return reinterpret_cast<const XDWORD *>(srcPixels);
+    }
+    unpackInfo.srcLine = srcPixels;
+    unpackInfo.dstLine = reinterpret_cast<XBYTE *>(scratch);
+    unpackInfo.width = count;
+    unpackInfo.copyBytes = count * (src_desc.BitsPerPixel / 8);
+    codec.unpack(&unpackInfo);
+    return scratch;
+}
+
+void VxBlitEngine::ResizeBilinearConverted(const DispatchTables &tables, const ResizeRowCodec &codec,
+                                           const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
+    const int srcW = src_desc.Width;
+    const int srcH = src_desc.Height;
+    const int dstW = dst_desc.Width;
+    const int dstH = dst_desc.Height;
+    const int scaleY = (srcH << 16) / dstH;
+    const int dstBpp = dst_desc.BitsPerPixel / 8;
+
+    BilinearColumns cols;
+    BuildBilinearColumns(srcW, dstW, cols);
+
+    // Strip width in destination pixels, sized so a strip reads about
+    // RESIZE_STRIP_SOURCE_PIXELS source columns.
+    int stripW = static_cast<int>(static_cast<long long>(RESIZE_STRIP_SOURCE_PIXELS) * dstW / srcW);
+    stripW = XMax(16, XMin(stripW, dstW));
+
+    int maxSpan = 0;
+    for (int begin = 0; begin < dstW; begin += stripW) {
+        const int end = XMin(begin + stripW, dstW);
+        maxSpan = XMax(maxSpan, cols.x1[end - 1] - cols.x0[begin] + 1);
+    }
+
+    // Two unpacked source rows (slot = source row parity) and one output row.
+    XArray<XDWORD> &scratch = GetThreadBlitScratch().resizeBuffer;
+    const int slotSize = maxSpan + 1;
+    const int scratchSize = slotSize * 2 + stripW;
+    if (scratch.Size() < scratchSize) {
+        scratch.Resize(scratchSize);
+    }
+    XDWORD *slots[2] = {scratch.Begin(), scratch.Begin() + slotSize};
+    XDWORD *outRow = scratch.Begin() + slotSize * 2;
+
+    VxBlitInfo unpackInfo = codec.unpackInfo;
+    VxBlitInfo packInfo = codec.packInfo;
+
+    for (int begin = 0; begin < dstW; begin += stripW) {
+        const int end = XMin(begin + stripW, dstW);
+        const int base = cols.x0[begin];
+        const int span = cols.x1[end - 1] - base + 1;
+        int slotRow[2] = {-1, -1};
+        const XDWORD *slotPixels[2] = {nullptr, nullptr};
+
+        packInfo.width = end - begin;
+        packInfo.copyBytes = (end - begin) * 4;
+
+        for (int y = 0; y < dstH; ++y) {
+            int srcY[2], fracY;
+            BilinearRowsFor(y, scaleY, srcH, srcY[0], srcY[1], fracY);
+
+            const XDWORD *rows[2];
+            for (int i = 0; i < 2; ++i) {
+                const int slot = srcY[i] & 1;
+                if (slotRow[slot] != srcY[i]) {
+                    slotPixels[slot] = UnpackResizeRow(codec, unpackInfo, src_desc, srcY[i], base, span, slots[slot]);
+                    slotRow[slot] = srcY[i];
+                }
+                rows[i] = slotPixels[slot];
+            }
+
+            XBYTE *dstPixels = dst_desc.Image + y * dst_desc.BytesPerLine + begin * dstBpp;
+            if (!codec.pack) {
+                BilinearRow32(tables.kernelMode, rows[0], rows[1], base, fracY, cols, begin, end,
+                              reinterpret_cast<XDWORD *>(dstPixels));
+                continue;
+            }
+            BilinearRow32(tables.kernelMode, rows[0], rows[1], base, fracY, cols, begin, end, outRow);
+            packInfo.srcLine = reinterpret_cast<const XBYTE *>(outRow);
+            packInfo.dstLine = dstPixels;
+            codec.pack(&packInfo);
+        }
+    }
+}
+
+void VxBlitEngine::ResizeBilinear24(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
+    const int srcW = src_desc.Width;
+    const int srcH = src_desc.Height;
+    const int dstW = dst_desc.Width;
+    const int dstH = dst_desc.Height;
+
+    const int scaleX = (srcW << 16) / dstW;
+    const int scaleY = (srcH << 16) / dstH;
+
+    for (int y = 0; y < dstH; ++y) {
+        const int srcYFixed = y * scaleY;
+        const int srcY0 = srcYFixed >> 16;
+        const int srcY1 = XMin(srcY0 + 1, srcH - 1);
+        const int fracY = srcYFixed & 0xFFFF;
+        const int invFracY = 0x10000 - fracY;
+
+        const XBYTE *srcRow0 = src_desc.Image + srcY0 * src_desc.BytesPerLine;
+        const XBYTE *srcRow1 = src_desc.Image + srcY1 * src_desc.BytesPerLine;
+        XBYTE *dstRow = dst_desc.Image + y * dst_desc.BytesPerLine;
+
+        int srcXFixed = 0;
+        for (int x = 0; x < dstW; ++x) {
+            const int srcX0 = srcXFixed >> 16;
+            const int srcX1 = XMin(srcX0 + 1, srcW - 1);
+            const int fracX = srcXFixed & 0xFFFF;
+            const int invFracX = 0x10000 - fracX;
+
+            const XBYTE *p00 = srcRow0 + srcX0 * 3;
+            const XBYTE *p10 = srcRow0 + srcX1 * 3;
+            const XBYTE *p01 = srcRow1 + srcX0 * 3;
+            const XBYTE *p11 = srcRow1 + srcX1 * 3;
+
+            // Bilinear interpolation for each channel (BGR order)
+            for (int c = 0; c < 3; ++c) {
+                XDWORD v = (((p00[c] * invFracX + p10[c] * fracX) >> 16) * invFracY +
+                            ((p01[c] * invFracX + p11[c] * fracX) >> 16) * fracY) >> 16;
+                dstRow[x * 3 + c] = (XBYTE)v;
+            }
+
+            srcXFixed += scaleX;
+        }
+    }
+}
+
+void VxBlitEngine::ResizeNearestNeighbor(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
+    const int srcW = src_desc.Width;
+    const int srcH = src_desc.Height;
+    const int dstW = dst_desc.Width;
+    const int dstH = dst_desc.Height;
+    const int srcBpp = src_desc.BitsPerPixel / 8;
+    const int dstBpp = dst_desc.BitsPerPixel / 8;
+
+    const int scaleX = (srcW << 16) / dstW;
+    const int scaleY = (srcH << 16) / dstH;
+    const int copyBpp = XMin(srcBpp, dstBpp);
+
+    XArray<int> srcXMap(dstW);
+    srcXMap.Resize(dstW);
+    int srcXFixed = 0;
+    for (int x = 0; x < dstW; ++x) {
+        int srcX = srcXFixed >> 16;
+        if (srcX >= srcW) srcX = srcW - 1;
+        srcXMap[x] = srcX;
+        srcXFixed += scaleX;
+    }
+
+    int srcYFixed = 0;
+    for (int y = 0; y < dstH; ++y) {
+        int srcY = srcYFixed >> 16;
+        if (srcY >= srcH) srcY = srcH - 1;
+        const XBYTE *srcRow = src_desc.Image + srcY * src_desc.BytesPerLine;
+        XBYTE *dstRow = dst_desc.Image + y * dst_desc.BytesPerLine;
 
-    // Setup pointers for the blit function
-    m_BlitInfo.srcLine = (const XBYTE *)resizeInfo.dstRow;
-    XBYTE *dstRow = dst_desc.Image;
+        if (srcBpp == dstBpp) {
+            if (srcBpp == 1) {
+                for (int x = 0; x < dstW; ++x) {
+                    dstRow[x] = srcRow[srcXMap[x]];
+                }
+            } else if (srcBpp == 2) {
+                for (int x = 0; x < dstW; ++x) {
+                    const XBYTE *srcPx = srcRow + (srcXMap[x] * 2);
+                    XBYTE *dstPx = dstRow + (x * 2);
+                    dstPx[0] = srcPx[0];
+                    dstPx[1] = srcPx[1];
+                }
+            } else if (srcBpp == 3) {
+                for (int x = 0; x < dstW; ++x) {
+                    const XBYTE *srcPx = srcRow + (srcXMap[x] * 3);
+                    XBYTE *dstPx = dstRow + (x * 3);
+                    dstPx[0] = srcPx[0];
+                    dstPx[1] = srcPx[1];
+                    dstPx[2] = srcPx[2];
+                }
+            } else if (srcBpp == 4) {
+                for (int x = 0; x < dstW; ++x) {
+                    const XBYTE *srcPx = srcRow + (srcXMap[x] * 4);
+                    XBYTE *dstPx = dstRow + (x * 4);
+                    dstPx[0] = srcPx[0];
+                    dstPx[1] = srcPx[1];
+                    dstPx[2] = srcPx[2];
+                    dstPx[3] = srcPx[3];
+                }
+            } else {
+                for (int x = 0; x < dstW; ++x) {
+                    const XBYTE *srcPx = srcRow + srcXMap[x] * srcBpp;
+                    XBYTE *dstPx = dstRow + x * dstBpp;
+                    memcpy(dstPx, srcPx, static_cast<size_t>(srcBpp));
+                }
+            }
+        } else {
+            for (int x = 0; x < dstW; ++x) {
+                const XBYTE *srcPx = srcRow + srcXMap[x] * srcBpp;
+                XBYTE *dstPx = dstRow + x * dstBpp;
 
-    const XDWORD *srcImage = (const XDWORD *)src_desc.Image;
-    int srcHeight = src_desc.Height;
-    int dstHeight = dst_desc.Height;
+                for (int b = 0; b < copyBpp; ++b) {
+                    dstPx[b] = srcPx[b];
+                }
+                for (int b = copyBpp; b < dstBpp; ++b) {
+                    dstPx[b] = 0xFF;
+                }
+            }
+        }
+        srcYFixed += scaleY;
+    }
+}
 
-    // Select resize function based on X dimension relationship
-    typedef void (*ResizeLineFunc)(const VxResizeInfo *);
-    ResizeLineFunc growYFunc, shrinkYFunc, equalYFunc;
+//==============================================================================
+//  Mip Chain Generation
+//==============================================================================
 
-    if (src_desc.Width == dst_desc.Width) {
-        growYFunc = ResizeHLine_GrowY_EqualX_32Bpp;
-        shrinkYFunc = ResizeHLine_ShrinkY_EqualX_32Bpp;
-        equalYFunc = ResizeHLine_EqualY_EqualX_32Bpp;
-    } else if (src_desc.Width < dst_desc.Width) {
-        growYFunc = ResizeHLine_GrowY_GrowX_32Bpp;
-        shrinkYFunc = ResizeHLine_ShrinkY_GrowX_32Bpp;
-        equalYFunc = ResizeHLine_EqualY_GrowX_32Bpp;
-    } else {
-        growYFunc = ResizeHLine_GrowY_ShrinkX_32Bpp;
-        shrinkYFunc = ResizeHLine_ShrinkY_ShrinkX_32Bpp;
-        equalYFunc = ResizeHLine_EqualY_ShrinkX_32Bpp;
-    }
+namespace {
 
-    if (srcHeight < dstHeight) {
-        // Growing Y: interpolate vertically
-        int yAccum = 0;
-        int yMax = (srcHeight << 16) - 0x10000;
-        int outY = 0;
+const int MIP_MAX_LEVELS = 32;
+const int MIP_ONE = 32767;          // 15-bit channel value of 1.0
+const int MIP_WEIGHT_ONE = 1 << 15; // Three-tap weights sum
 
-        // Phase 1: while we haven't reached the last source row
-        while (yAccum < yMax && yAccum >= 0 && outY < dstHeight) {
-            int srcY = yAccum >> 16;
-            resizeInfo.srcRow = srcImage + srcY * resizeInfo.srcPitch;
-            growYFunc(&resizeInfo);
+// 8-bit -> 15-bit widening replicates the top bits ((v << 7) | (v >> 1)), so
+// 255 maps to exactly 32767. Narrowing rounds w * 255 / 32768, which inverts
+// the widening exactly and stays within 0.51 of w * 255 / 32767 elsewhere.
+inline int MipWidenByte(int v) { return (v << 7) | (v >> 1); }
+inline int MipNarrowToByte(int w) { return (w * 255 + (1 << 14)) >> 15; }
 
-            // Blit the resized line to destination
-            m_BlitInfo.dstLine = dstRow;
-            blitFunc(&m_BlitInfo);
+// sRGB <-> linear-light conversions, built on first use.
+struct MipChannelTables {
+    short fromSRGB[256];
+    XBYTE toSRGB[MIP_ONE + 1];
 
-            dstRow += dst_desc.BytesPerLine;
-            yAccum += resizeInfo.hr1;
-            ++outY;
+    MipChannelTables() {
+        for (int v = 0; v < 256; ++v) {
+            const double c = v / 255.0;
+            const double l = c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4);
+            fromSRGB[v] = (short)(l * MIP_ONE + 0.5);
+        }
+        for (int w = 0; w <= MIP_ONE; ++w) {
+            const double l = (double)w / MIP_ONE;
+            const double c = l <= 0.0031308 ? l * 12.92 : 1.055 * std::pow(l, 1.0 / 2.4) - 0.055;
+            toSRGB[w] = (XBYTE)(c * 255.0 + 0.5);
         }
+    }
+};
 
-        // Phase 2: fill remaining rows with last source row (equal Y copy)
-        if (outY < dstHeight) {
-            resizeInfo.srcRow = srcImage + (srcHeight - 1) * resizeInfo.srcPitch;
-            while (outY < dstHeight) {
-                equalYFunc(&resizeInfo);
+const MipChannelTables &GetMipChannelTables() {
+    static const MipChannelTables luts;
+    return luts;
+}
 
-                m_BlitInfo.dstLine = dstRow;
-                blitFunc(&m_BlitInfo);
+struct MipChainFormat {
+    int alpha;           // Byte index of the alpha (or unused) channel
+    XBOOL srgb;          // Color channels are sRGB encoded
+    XBOOL alphaWeighted; // Color channels are carried premultiplied by alpha
+    const MipChannelTables *luts;
+};
 
-                dstRow += dst_desc.BytesPerLine;
-                yAccum += resizeInfo.hr1;
-                ++outY;
+// Rounded v * a / 32767 for v, a in 0..32767, division-free.
+inline XDWORD MipPremultiply(XDWORD v, XDWORD a) {
+    const XDWORD x = v * a + MIP_ONE / 2;
+    return (x + (x >> 15) + 1) >> 15;
+}
+
+// Base level row -> 15-bit channels.
+void EncodeMipRow(const XBYTE *src, short *dst, int width, const MipChainFormat &fmt) {
+    const int count = width * 4;
+    if (fmt.srgb) {
+        const short *fromSRGB = fmt.luts->fromSRGB;
+        for (int i = 0; i < count; ++i) dst[i] = fromSRGB[src[i]];
+        for (int i = fmt.alpha; i < count; i += 4) dst[i] = (short)MipWidenByte(src[i]);
+    } else {
+        for (int i = 0; i < count; ++i) dst[i] = (short)MipWidenByte(src[i]);
+    }
+    if (fmt.alphaWeighted) {
+        const int alpha = fmt.alpha;
+        for (int x = 0; x < width; ++x, dst += 4) {
+            const XDWORD a = static_cast<XDWORD>(dst[alpha]);
+            for (int c = 0; c < 4; ++c) {
+                if (c != alpha) dst[c] = (short)MipPremultiply(static_cast<XDWORD>(dst[c]), a);
             }
         }
-    } else if (srcHeight > dstHeight) {
-        // Shrinking Y: skip source rows
-        int yAccum = 0;
-        for (int y = 0; y < dstHeight; ++y) {
-            int srcY = yAccum >> 16;
-            resizeInfo.srcRow = srcImage + srcY * resizeInfo.srcPitch;
-            shrinkYFunc(&resizeInfo);
-
-            m_BlitInfo.dstLine = dstRow;
-            blitFunc(&m_BlitInfo);
+    }
+}
 
-            dstRow += dst_desc.BytesPerLine;
-            yAccum += resizeInfo.hr1;
+// 15-bit channels -> 32-bit output row.
+void DecodeMipRow(const short *src, XBYTE *dst, int width, const MipChainFormat &fmt) {
+    if (!fmt.srgb && !fmt.alphaWeighted) {
+        for (int i = 0; i < width * 4; ++i) dst[i] = (XBYTE)MipNarrowToByte(src[i]);
+        return;
+    }
+    for (int x = 0; x < width; ++x, src += 4, dst += 4) {
+        const int a = src[fmt.alpha];
+        // 32767 / a in 16.16 fixed point: one division per texel.
+        const long long unpremultiply = a > 0 ? (static_cast<long long>(MIP_ONE) << 16) / a : 0;
+        for (int c = 0; c < 4; ++c) {
+            int v = src[c];
+            if (fmt.alphaWeighted) v = XMin(MIP_ONE, static_cast<int>((v * unpremultiply + (1 << 15)) >> 16));
+            dst[c] = fmt.srgb ? fmt.luts->toSRGB[v] : (XBYTE)MipNarrowToByte(v);
         }
-    } else {
-        // Equal Y: 1:1 vertical mapping
-        resizeInfo.srcRow = srcImage;
-        for (int y = 0; y < srcHeight; ++y) {
-            equalYFunc(&resizeInfo);
+        dst[fmt.alpha] = (XBYTE)MipNarrowToByte(a);
+    }
+}
 
-            m_BlitInfo.dstLine = dstRow;
-            blitFunc(&m_BlitInfo);
+// Taps per output along an axis halved from @p srcSize: a single sample at
+// size 1, pair averages for even sizes, and a three-tap box for odd sizes.
+int MipTapCount(int srcSize) {
+    if (srcSize == 1) return 1;
+    return (srcSize & 1) ? 3 : 2;
+}
 
-            dstRow += dst_desc.BytesPerLine;
-            resizeInfo.srcRow += resizeInfo.srcPitch;
-        }
+// Odd sizes 2n + 1 -> n: output i covers source [i * s, (i + 1) * s) with
+// s = (2n + 1) / n, i.e. texels 2i, 2i + 1, 2i + 2 weighted (n - i, n, i + 1).
+void BuildMipWeights(int srcSize, int dstSize, XArray<short> &weights) {
+    if (MipTapCount(srcSize) != 3) return;
+    const int span = 2 * dstSize + 1;
+    weights.Resize(dstSize * 3);
+    for (int i = 0; i < dstSize; ++i) {
+        const int w0 = ((dstSize - i) * MIP_WEIGHT_ONE + span / 2) / span;
+        const int w2 = ((i + 1) * MIP_WEIGHT_ONE + span / 2) / span;
+        weights[i * 3 + 0] = (short)w0;
+        weights[i * 3 + 1] = (short)(MIP_WEIGHT_ONE - w0 - w2);
+        weights[i * 3 + 2] = (short)w2;
     }
 }
 
-void VxBlitEngine::ResizeImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
-    VxMutexLock lock(m_Lock);
+struct MipChainLevel {
+    int width;
+    int height;
+    XBYTE *out;
+    int horzTaps; // From the level above
+    int vertTaps;
+    XArray<short> horzWeights;
+    XArray<short> vertWeights;
+};
 
-    if (!src_desc.Image || !dst_desc.Image) return;
-    if (src_desc.Width <= 0 || src_desc.Height <= 0) return;
-    if (dst_desc.Width <= 0 || dst_desc.Height <= 0) return;
+struct MipChainSetup {
+    MipChainFormat format;
+    VxMipHorzFunc horz[2];
+    VxMipVertFunc vert[2];
+    VxMipBoxFunc box;
+    int levelCount;
+    MipChainLevel levels[MIP_MAX_LEVELS]; // [0] is the base
+};
 
-    // Hybrid resize policy:
-    // - direct bilinear for 24/32 same-format
-    // - nearest-neighbor for same-format low-bpp (8/16) for performance
-    // - 32-bit conversion path for mixed-format resize
-    int srcChannels = src_desc.BitsPerPixel / 8;
-    int dstChannels = dst_desc.BitsPerPixel / 8;
+// Levels [first, last] of a chain fed one row of level first - 1 at a time.
+// Each level halves incoming rows horizontally into a three-row ring (slot =
+// source row % 3) and emits its next row once the vertical window is complete.
+// Rows of @p last also go to @p sink when given (one full level of work rows).
+class MipCascade {
+public:
+    MipCascade(const MipChainSetup &setup, int first, int last, int inputRowBase, short *sink)
+        : m_Setup(setup), m_First(first), m_Last(last), m_Sink(sink) {
+        for (int k = first; k <= last; ++k) {
+            const int rowShorts = setup.levels[k].width * 4;
+            State &state = m_States[k];
+            state.ring.Resize(rowShorts * 3);
+            state.work.Resize(rowShorts);
+            state.rowsIn = 0;
+            state.inputBase = inputRowBase;
+            state.outputBase = setup.levels[k].vertTaps == 1 ? inputRowBase : inputRowBase / 2;
+            inputRowBase = state.outputBase;
+        }
+    }
 
-    // Handle 32-bit images directly with optimized bilinear interpolation
-    if (srcChannels == 4 && dstChannels == 4) {
-        ResizeBilinear32(src_desc, dst_desc);
-        return;
+    void Push(const short *row) { PushRow(m_First, row); }
+
+private:
+    struct State {
+        XArray<short> ring;
+        XArray<short> work;
+        int rowsIn;
+        int inputBase;  // Row of the level above held by the first input
+        int outputBase; // Row of this level matching that input
+    };
+
+    void PushRow(int k, const short *row) {
+        const MipChainLevel &level = m_Setup.levels[k];
+        State &state = m_States[k];
+        const int rowShorts = level.width * 4;
+
+        const int inputRow = state.inputBase + state.rowsIn++;
+        short *slot = &state.ring[(inputRow % 3) * rowShorts];
+        if (level.horzTaps == 1) {
+            memcpy(slot, row, rowShorts * sizeof(short));
+        } else if (level.horzTaps == 2) {
+            m_Setup.horz[0](row, slot, level.width, nullptr);
+        } else {
+            m_Setup.horz[1](row, slot, level.width, level.horzWeights.Begin());
+        }
+
+        // The only row this input can complete: inputs are 2y..2y+1 (pairs) or
+        // 2y..2y+2 (three taps), so the window ends on this input or not at all.
+        int y;
+        if (level.vertTaps == 1) {
+            y = inputRow;
+        } else if (level.vertTaps == 2) {
+            if (!(inputRow & 1)) return;
+            y = inputRow >> 1;
+        } else {
+            if ((inputRow & 1) || inputRow == 0) return;
+            y = (inputRow >> 1) - 1;
+        }
+        if (y >= level.height) return;
+
+        const short *result = slot;
+        if (level.vertTaps > 1) {
+            const short *rows[3];
+            for (int t = 0; t < level.vertTaps; ++t) {
+                rows[t] = &state.ring[((2 * y + t) % 3) * rowShorts];
+            }
+            if (level.vertTaps == 2) {
+                m_Setup.vert[0](rows, nullptr, state.work.Begin(), rowShorts);
+            } else {
+                m_Setup.vert[1](rows, &level.vertWeights[y * 3], state.work.Begin(), rowShorts);
+            }
+            result = state.work.Begin();
+        }
+
+        DecodeMipRow(result, level.out + static_cast<ptrdiff_t>(y) * level.width * 4, level.width, m_Setup.format);
+        if (k < m_Last) {
+            PushRow(k + 1, result);
+        } else if (m_Sink) {
+            memcpy(m_Sink + static_cast<ptrdiff_t>(y) * rowShorts, result, rowShorts * sizeof(short));
+        }
     }
 
-    // Handle 24-bit images directly
-    if (srcChannels == 3 && dstChannels == 3) {
-        ResizeBilinear24(src_desc, dst_desc);
-        return;
+    const MipChainSetup &m_Setup;
+    int m_First;
+    int m_Last;
+    short *m_Sink;
+    State m_States[MIP_MAX_LEVELS];
+};
+
+struct MipBandJob {
+    const MipChainSetup *setup;
+    const VxImageDescEx *src;
+    int depth;   // Levels built per band; band units are 1 << depth base rows
+    short *sink; // Work rows of level depth
+};
+
+void RunMipBands(void *userData, int begin, int end) {
+    const MipBandJob &job = *static_cast<const MipBandJob *>(userData);
+    const int width = job.src->Width;
+    const int firstRow = begin << job.depth;
+    const int lastRow = end << job.depth;
+
+    XArray<short> encoded(width * 4);
+    encoded.Resize(width * 4);
+    MipCascade cascade(*job.setup, 1, job.depth, firstRow, job.sink);
+    for (int y = firstRow; y < lastRow; ++y) {
+        EncodeMipRow(job.src->Image + static_cast<ptrdiff_t>(y) * job.src->BytesPerLine, encoded.Begin(), width,
+                     job.setup->format);
+        cascade.Push(encoded.Begin());
     }
+}
 
-    // Fast path: same low-bpp formats (8/16) use direct nearest-neighbor.
-    // This avoids expensive 32-bit conversion round-trips for 16-bit surfaces.
-    if (srcChannels == dstChannels && srcChannels > 0 && srcChannels != 3 && srcChannels != 4) {
-        ResizeNearestNeighbor(src_desc, dst_desc);
-        return;
+// Rows of one level halved from the 8-bit level above with the 2x2 box.
+struct MipBoxJob {
+    VxMipBoxFunc box;
+    const XBYTE *src;
+    int srcPitch;
+    XBYTE *dst;
+    int width;
+};
+
+void RunMipBoxRows(void *userData, int begin, int end) {
+    const MipBoxJob &job = *static_cast<const MipBoxJob *>(userData);
+    for (int y = begin; y < end; ++y) {
+        const XBYTE *row0 = job.src + static_cast<ptrdiff_t>(2 * y) * job.srcPitch;
+        job.box(row0, row0 + job.srcPitch, job.dst + static_cast<ptrdiff_t>(y) * job.width * 4, job.width);
     }
+}
 
-    // For mixed bit depths, convert to 32-bit, resize, then convert back
-    if (srcChannels >= 2) {
-        // Allocate temporary 32-bit buffers
-        XArray<XBYTE> srcTemp, dstTemp;
-        srcTemp.Reserve(src_desc.Width * src_desc.Height * 4);
-        dstTemp.Reserve(dst_desc.Width * dst_desc.Height * 4);
+} // namespace
 
-        // Convert source to 32-bit ARGB
-        VxImageDescEx src32;
-        src32.Width = src_desc.Width;
-        src32.Height = src_desc.Height;
-        src32.BitsPerPixel = 32;
-        src32.BytesPerLine = src_desc.Width * 4;
-        src32.RedMask = 0x00FF0000;
-        src32.GreenMask = 0x0000FF00;
-        src32.BlueMask = 0x000000FF;
-        src32.AlphaMask = 0xFF000000;
-        src32.Image = srcTemp.Begin();
+int VxBlitEngine::GetMipChainSize(int width, int height) {
+    if (width <= 0 || height <= 0) return 0;
+    int size = 0;
+    while (width > 1 || height > 1) {
+        width = XMax(1, width >> 1);
+        height = XMax(1, height >> 1);
+        size += width * height * 4;
+    }
+    return size;
+}
 
-        // Blit to 32-bit format
-        DoBlit(src_desc, src32);
+int VxBlitEngine::GenerateMipChain(const VxImageDescEx &src_desc, XBYTE *dst, XDWORD flags) {
+    if (!src_desc.Image || !dst) return 0;
+    if (src_desc.BitsPerPixel != 32) return 0;
+    if (src_desc.Width <= 0 || src_desc.Height <= 0) return 0;
+
+    const DispatchTables &tables = AcquireTables();
+    MipChainSetup setup;
+    const XDWORD alphaMask =
+        src_desc.AlphaMask ? src_desc.AlphaMask : ~(src_desc.RedMask | src_desc.GreenMask | src_desc.BlueMask);
+    setup.format.alpha = alphaMask ? static_cast<int>(GetBitShiftLocal(alphaMask)) / 8 : 3;
+    setup.format.srgb = (flags & VX_MIPCHAIN_SRGB) ? TRUE : FALSE;
+    setup.format.alphaWeighted = ((flags & VX_MIPCHAIN_ALPHA_WEIGHTED) && src_desc.AlphaMask) ? TRUE : FALSE;
+    setup.format.luts = &GetMipChannelTables();
+    setup.horz[0] = tables.mipHorz[0];
+    setup.horz[1] = tables.mipHorz[1];
+    setup.vert[0] = tables.mipVert[0];
+    setup.vert[1] = tables.mipVert[1];
+    setup.box = tables.mipBox;
+
+    setup.levels[0].width = src_desc.Width;
+    setup.levels[0].height = src_desc.Height;
+    setup.levels[0].out = nullptr;
+    setup.levelCount = 1;
+    XBYTE *out = dst;
+    while (setup.levelCount < MIP_MAX_LEVELS) {
+        const MipChainLevel &above = setup.levels[setup.levelCount - 1];
+        if (above.width == 1 && above.height == 1) break;
+        MipChainLevel &level = setup.levels[setup.levelCount++];
+        level.width = XMax(1, above.width >> 1);
+        level.height = XMax(1, above.height >> 1);
+        level.out = out;
+        level.horzTaps = MipTapCount(above.width);
+        level.vertTaps = MipTapCount(above.height);
+        BuildMipWeights(above.width, level.width, level.horzWeights);
+        BuildMipWeights(above.height, level.height, level.vertWeights);
+        out += level.width * level.height * 4;
+    }
+    const int last = setup.levelCount - 1;
+    if (last == 0) return 0;
+
+    const int threads = VxAtomicLoadInt(&m_BlitThreadCount);
+    const int minRows = VxAtomicLoadInt(&m_MinRowsPerBand);
+
+    // Default mode: no per-texel transform to carry, so each level is built
+    // from the 8-bit level above. Even sizes take the 2x2 box; the others
+    // run a one-level cascade over the widened rows of the level above.
+    if (!setup.format.srgb && !setup.format.alphaWeighted) {
+        for (int k = 1; k <= last; ++k) {
+            const MipChainLevel &above = setup.levels[k - 1];
+            const MipChainLevel &level = setup.levels[k];
+            const XBYTE *src = k == 1 ? src_desc.Image : above.out;
+            const int srcPitch = k == 1 ? src_desc.BytesPerLine : above.width * 4;
+            if (level.horzTaps == 2 && level.vertTaps == 2) {
+                MipBoxJob job;
+                job.box = setup.box;
+                job.src = src;
+                job.srcPitch = srcPitch;
+                job.dst = level.out;
+                job.width = level.width;
+                if (threads > 1 && level.height >= 2 * minRows) {
+                    VxParallelFor(level.height, minRows, threads, RunMipBoxRows, &job);
+                } else {
+                    RunMipBoxRows(&job, 0, level.height);
+                }
+                continue;
+            }
+            XArray<short> encoded(above.width * 4);
+            encoded.Resize(above.width * 4);
+            MipCascade cascade(setup, k, k, 0, nullptr);
+            for (int y = 0; y < above.height; ++y) {
+                EncodeMipRow(src + static_cast<ptrdiff_t>(y) * srcPitch, encoded.Begin(), above.width, setup.format);
+                cascade.Push(encoded.Begin());
+            }
+        }
+        return last;
+    }
 
-        // Create destination 32-bit descriptor
-        VxImageDescEx dst32;
-        dst32.Width = dst_desc.Width;
-        dst32.Height = dst_desc.Height;
-        dst32.BitsPerPixel = 32;
-        dst32.BytesPerLine = dst_desc.Width * 4;
-        dst32.RedMask = 0x00FF0000;
-        dst32.GreenMask = 0x0000FF00;
-        dst32.BlueMask = 0x000000FF;
-        dst32.AlphaMask = 0xFF000000;
-        dst32.Image = dstTemp.Begin();
+    // Band depth: levels whose input heights stay even never read across a band
+    // boundary. Keep at least two bands per thread.
+    int depth = 0;
+    if (threads > 1 && src_desc.Height >= 2 * minRows) {
+        while (depth < last && !(setup.levels[depth].height & 1) &&
+               (src_desc.Height >> (depth + 1)) >= threads * 2) {
+            ++depth;
+        }
+    }
 
-        // Resize in 32-bit
-        ResizeBilinear32(src32, dst32);
+    if (depth == 0) {
+        XArray<short> encoded(src_desc.Width * 4);
+        encoded.Resize(src_desc.Width * 4);
+        MipCascade cascade(setup, 1, last, 0, nullptr);
+        for (int y = 0; y < src_desc.Height; ++y) {
+            EncodeMipRow(src_desc.Image + static_cast<ptrdiff_t>(y) * src_desc.BytesPerLine, encoded.Begin(),
+                         src_desc.Width, setup.format);
+            cascade.Push(encoded.Begin());
+        }
+        return last;
+    }
 
-        // Convert back to destination format
-        DoBlit(dst32, dst_desc);
-        return;
+    const MipChainLevel &banded = setup.levels[depth];
+    XArray<short> sink;
+    if (depth < last) {
+        sink.Resize(banded.width * banded.height * 4);
     }
 
-    // Fallback: simple nearest-neighbor for 8-bit and non-standard formats
-    ResizeNearestNeighbor(src_desc, dst_desc);
+    MipBandJob job;
+    job.setup = &setup;
+    job.src = &src_desc;
+    job.depth = depth;
+    job.sink = depth < last ? sink.Begin() : nullptr;
+    VxParallelFor(src_desc.Height >> depth, XMax(1, minRows >> depth), threads, RunMipBands, &job);
+
+    if (depth < last) {
+        MipCascade cascade(setup, depth + 1, last, 0, nullptr);
+        for (int y = 0; y < banded.height; ++y) {
+            cascade.Push(&sink[y * banded.width * 4]);
+        }
+    }
+    return last;
 }
 
 //==============================================================================
-//  Bilinear Resize Implementation
+//  Quantization
 //==============================================================================
 
-void VxBlitEngine::ResizeBilinear32(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
-    const int srcW = src_desc.Width;
-    const int srcH = src_desc.Height;
-    const int dstW = dst_desc.Width;
-    const int dstH = dst_desc.Height;
+//------------------------------------------------------------------------------
+// Color cube histogram and palette mapping -- shared by both quantizers
+//------------------------------------------------------------------------------
 
-    // Fixed-point scale factors (16.16 format)
-    const int scaleX = (srcW << 16) / dstW;
-    const int scaleY = (srcH << 16) / dstH;
+namespace {
 
-#if defined(VX_SIMD_SSE2)
-    if (m_EffectiveBlitKernelMode != VX_SIMD_MODE_NONE) {
-        XArray<int> srcX0Lut(dstW);
-        XArray<int> srcX1Lut(dstW);
-        XArray<int> wX0Lut(dstW);
-        XArray<int> wX1Lut(dstW);
-        srcX0Lut.Resize(dstW);
-        srcX1Lut.Resize(dstW);
-        wX0Lut.Resize(dstW);
-        wX1Lut.Resize(dstW);
-        int srcXFixed = 0;
-        for (int x = 0; x < dstW; ++x) {
-            const int srcX0 = srcXFixed >> 16;
-            const int srcX1 = XMin(srcX0 + 1, srcW - 1);
-            const int fracX = srcXFixed & 0xFFFF;
-            const int invFracX = 0x10000 - fracX;
-            const int wX0 = (invFracX + 128) >> 8;
-            srcX0Lut[x] = srcX0;
-            srcX1Lut[x] = srcX1;
-            wX0Lut[x] = wX0;
-            wX1Lut[x] = 256 - wX0;
-            srcXFixed += scaleX;
+// 6-6-6 color cube: 2^18 cells of 4x4x4 colors.
+const int QUANT_CELL_BITS = 6;
+const int QUANT_CELL_SHIFT = 8 - QUANT_CELL_BITS;
+const int QUANT_CELL_SIDE = 1 << QUANT_CELL_BITS;
+const int QUANT_CELL_COUNT = 1 << (3 * QUANT_CELL_BITS);
+const int QUANT_MIN_CELLS_PER_TASK = 4096;
+
+inline int QuantCellIndex(int r, int g, int b) {
+    return ((r >> QUANT_CELL_SHIFT) << (2 * QUANT_CELL_BITS)) | ((g >> QUANT_CELL_SHIFT) << QUANT_CELL_BITS) |
+           (b >> QUANT_CELL_SHIFT);
+}
+
+// Population of one cell and the sums of the color bits below the cell size,
+// which keeps cell means exact without 64-bit sums.
+struct QuantCell {
+    XDWORD count;
+    XDWORD rLow;
+    XDWORD gLow;
+    XDWORD bLow;
+};
+
+struct QuantHistogram {
+    XArray<QuantCell> cells;
+    XArray<int> occupied; // Indices of cells with count > 0
+
+    // Sources are 24/32-bit BGR(A).
+    void Build(const VxImageDescEx &src) {
+        const int srcBpp = src.BitsPerPixel / 8;
+        const XDWORD lowMask = (1u << QUANT_CELL_SHIFT) - 1;
+        cells.Resize(QUANT_CELL_COUNT);
+        memset(cells.Begin(), 0, QUANT_CELL_COUNT * sizeof(QuantCell));
+
+        const XBYTE *srcRow = src.Image;
+        for (int y = 0; y < src.Height; ++y, srcRow += src.BytesPerLine) {
+            const XBYTE *pixel = srcRow;
+            for (int x = 0; x < src.Width; ++x, pixel += srcBpp) {
+                QuantCell &cell = cells[QuantCellIndex(pixel[2], pixel[1], pixel[0])];
+                ++cell.count;
+                cell.rLow += pixel[2] & lowMask;
+                cell.gLow += pixel[1] & lowMask;
+                cell.bLow += pixel[0] & lowMask;
+            }
+        }
+
+        occupied.Resize(0);
+        for (int i = 0; i < QUANT_CELL_COUNT; ++i) {
+            if (cells[i].count) occupied.PushBack(i);
         }
+    }
 
-        // SSE2 optimized bilinear resize
-        for (int y = 0; y < dstH; ++y) {
-            // Calculate source Y coordinate and fraction
-            const int srcYFixed = y * scaleY;
-            const int srcY0 = srcYFixed >> 16;
-            const int srcY1 = XMin(srcY0 + 1, srcH - 1);
-            const int fracY = srcYFixed & 0xFFFF;
-            const int invFracY = 0x10000 - fracY;
-
-            const XDWORD *srcRow0 = (const XDWORD *)(src_desc.Image + srcY0 * src_desc.BytesPerLine);
-            const XDWORD *srcRow1 = (const XDWORD *)(src_desc.Image + srcY1 * src_desc.BytesPerLine);
-            XDWORD *dstRow = (XDWORD *)(dst_desc.Image + y * dst_desc.BytesPerLine);
-
-            // SSE constants for this row
-            const int wY0 = (invFracY + 128) >> 8;
-            const int wY1 = 256 - wY0;
-            const __m128i zero = _mm_setzero_si128();
+    void CellMean(int index, int &r, int &g, int &b) const {
+        const QuantCell &cell = cells[index];
+        const XDWORD half = cell.count / 2;
+        r = (((index >> (2 * QUANT_CELL_BITS)) & (QUANT_CELL_SIDE - 1)) << QUANT_CELL_SHIFT) +
+            static_cast<int>((cell.rLow + half) / cell.count);
+        g = (((index >> QUANT_CELL_BITS) & (QUANT_CELL_SIDE - 1)) << QUANT_CELL_SHIFT) +
+            static_cast<int>((cell.gLow + half) / cell.count);
+        b = ((index & (QUANT_CELL_SIDE - 1)) << QUANT_CELL_SHIFT) + static_cast<int>((cell.bLow + half) / cell.count);
+    }
+};
 
-            for (int x = 0; x < dstW; ++x) {
-                const int srcX0 = srcX0Lut[x];
-                const int srcX1 = srcX1Lut[x];
-                const int wX0 = wX0Lut[x];
-                const int wX1 = wX1Lut[x];
-
-                // Load 4 corner pixels
-                XDWORD p00 = srcRow0[srcX0];
-                XDWORD p10 = srcRow0[srcX1];
-                XDWORD p01 = srcRow1[srcX0];
-                XDWORD p11 = srcRow1[srcX1];
-
-                // Unpack to 16-bit and multiply
-                __m128i px00 = _mm_cvtsi32_si128(p00);
-                __m128i px10 = _mm_cvtsi32_si128(p10);
-                __m128i px01 = _mm_cvtsi32_si128(p01);
-                __m128i px11 = _mm_cvtsi32_si128(p11);
-
-                px00 = _mm_unpacklo_epi8(px00, zero);
-                px10 = _mm_unpacklo_epi8(px10, zero);
-                px01 = _mm_unpacklo_epi8(px01, zero);
-                px11 = _mm_unpacklo_epi8(px11, zero);
-
-                const __m128i vwX0 = _mm_set1_epi16((short)wX0);
-                const __m128i vwX1 = _mm_set1_epi16((short)wX1);
-                const __m128i vwY0 = _mm_set1_epi16((short)wY0);
-                const __m128i vwY1 = _mm_set1_epi16((short)wY1);
-
-                __m128i row0 = _mm_mullo_epi16(px00, vwX0);
-                row0 = _mm_add_epi16(row0, _mm_mullo_epi16(px10, vwX1));
-                row0 = _mm_srli_epi16(row0, 8);
-
-                __m128i row1 = _mm_mullo_epi16(px01, vwX0);
-                row1 = _mm_add_epi16(row1, _mm_mullo_epi16(px11, vwX1));
-                row1 = _mm_srli_epi16(row1, 8);
-
-                __m128i result = _mm_mullo_epi16(row0, vwY0);
-                result = _mm_add_epi16(result, _mm_mullo_epi16(row1, vwY1));
-                result = _mm_srli_epi16(result, 8);
-                result = _mm_packus_epi16(result, zero);
-
-                dstRow[x] = _mm_cvtsi128_si32(result);
-            }
+inline int ColorDistSq(int r1, int g1, int b1, int r2, int g2, int b2) {
+    int dr = r1 - r2;
+    int dg = g1 - g2;
+    int db = b1 - b2;
+    // Weighted by human perception: green > red > blue
+    return dr * dr * 2 + dg * dg * 4 + db * db;
+}
+
+// Nearest palette entry under ColorDistSq. Entries are sorted by green and
+// searched outwards from the query's green until the green distance alone
+// exceeds the best match.
+class QuantPaletteSearch {
+public:
+    QuantPaletteSearch(const XBYTE *palette, int bytesPerEntry, int count) : m_Count(count) {
+        for (int i = 0; i < count; ++i) {
+            const XBYTE *entry = palette + i * bytesPerEntry;
+            Entry e = {entry[2], entry[1], entry[0], i};
+            int j = i;
+            for (; j > 0 && m_Entries[j - 1].g > e.g; --j) m_Entries[j] = m_Entries[j - 1];
+            m_Entries[j] = e;
         }
-        return;
     }
-#endif
 
-    // Scalar bilinear resize (fallback)
-    for (int y = 0; y < dstH; ++y) {
-        const int srcYFixed = y * scaleY;
-        const int srcY0 = srcYFixed >> 16;
-        const int srcY1 = XMin(srcY0 + 1, srcH - 1);
-        const int fracY = srcYFixed & 0xFFFF;
-        const int invFracY = 0x10000 - fracY;
+    int Nearest(int r, int g, int b) const {
+        int lo = 0;
+        int hi = m_Count;
+        while (lo < hi) {
+            const int mid = (lo + hi) / 2;
+            if (m_Entries[mid].g < g) lo = mid + 1;
+            else hi = mid;
+        }
 
-        const XDWORD *srcRow0 = (const XDWORD *)(src_desc.Image + srcY0 * src_desc.BytesPerLine);
-        const XDWORD *srcRow1 = (const XDWORD *)(src_desc.Image + srcY1 * src_desc.BytesPerLine);
-        XDWORD *dstRow = (XDWORD *)(dst_desc.Image + y * dst_desc.BytesPerLine);
+        int bestIndex = 0;
+        int bestDist = 0x7FFFFFFF;
+        for (int up = lo, down = lo - 1; up < m_Count || down >= 0;) {
+            if (up < m_Count) {
+                const Entry &e = m_Entries[up++];
+                if ((e.g - g) * (e.g - g) * 4 > bestDist) {
+                    up = m_Count;
+                } else {
+                    Consider(e, r, g, b, bestIndex, bestDist);
+                }
+            }
+            if (down >= 0) {
+                const Entry &e = m_Entries[down--];
+                if ((e.g - g) * (e.g - g) * 4 > bestDist) {
+                    down = -1;
+                } else {
+                    Consider(e, r, g, b, bestIndex, bestDist);
+                }
+            }
+        }
+        return bestIndex;
+    }
 
-        int srcXFixed = 0;
-        for (int x = 0; x < dstW; ++x) {
-            const int srcX0 = srcXFixed >> 16;
-            const int srcX1 = XMin(srcX0 + 1, srcW - 1);
-            const int fracX = srcXFixed & 0xFFFF;
-            const int invFracX = 0x10000 - fracX;
+private:
+    struct Entry {
+        int r, g, b;
+        int index;
+    };
 
-            XDWORD p00 = srcRow0[srcX0];
-            XDWORD p10 = srcRow0[srcX1];
-            XDWORD p01 = srcRow1[srcX0];
-            XDWORD p11 = srcRow1[srcX1];
-
-            // Bilinear interpolation for each channel
-            XDWORD a = ((((p00 >> 24) & 0xFF) * invFracX + ((p10 >> 24) & 0xFF) * fracX) >> 16) * invFracY +
-                       ((((p01 >> 24) & 0xFF) * invFracX + ((p11 >> 24) & 0xFF) * fracX) >> 16) * fracY;
-            XDWORD r = ((((p00 >> 16) & 0xFF) * invFracX + ((p10 >> 16) & 0xFF) * fracX) >> 16) * invFracY +
-                       ((((p01 >> 16) & 0xFF) * invFracX + ((p11 >> 16) & 0xFF) * fracX) >> 16) * fracY;
-            XDWORD g = ((((p00 >> 8) & 0xFF) * invFracX + ((p10 >> 8) & 0xFF) * fracX) >> 16) * invFracY +
-                       ((((p01 >> 8) & 0xFF) * invFracX + ((p11 >> 8) & 0xFF) * fracX) >> 16) * fracY;
-            XDWORD b = (((p00 & 0xFF) * invFracX + (p10 & 0xFF) * fracX) >> 16) * invFracY +
-                       (((p01 & 0xFF) * invFracX + (p11 & 0xFF) * fracX) >> 16) * fracY;
-
-            dstRow[x] = ((a >> 16) << 24) | ((r >> 16) << 16) | ((g >> 16) << 8) | (b >> 16);
-            srcXFixed += scaleX;
+    // Ties go to the lowest palette index, like a linear scan.
+    static void Consider(const Entry &e, int r, int g, int b, int &bestIndex, int &bestDist) {
+        const int dist = ColorDistSq(r, g, b, e.r, e.g, e.b);
+        if (dist < bestDist || (dist == bestDist && e.index < bestIndex)) {
+            bestDist = dist;
+            bestIndex = e.index;
         }
     }
-}
 
-void VxBlitEngine::ResizeBilinear24(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
-    const int srcW = src_desc.Width;
-    const int srcH = src_desc.Height;
-    const int dstW = dst_desc.Width;
-    const int dstH = dst_desc.Height;
+    Entry m_Entries[256];
+    int m_Count;
+};
 
-    const int scaleX = (srcW << 16) / dstW;
-    const int scaleY = (srcH << 16) / dstH;
+typedef int (*QuantNearestFunc)(const void *context, int r, int g, int b);
 
-    for (int y = 0; y < dstH; ++y) {
-        const int srcYFixed = y * scaleY;
-        const int srcY0 = srcYFixed >> 16;
-        const int srcY1 = XMin(srcY0 + 1, srcH - 1);
-        const int fracY = srcYFixed & 0xFFFF;
-        const int invFracY = 0x10000 - fracY;
+int NearestInPalette(const void *context, int r, int g, int b) {
+    return static_cast<const QuantPaletteSearch *>(context)->Nearest(r, g, b);
+}
 
-        const XBYTE *srcRow0 = src_desc.Image + srcY0 * src_desc.BytesPerLine;
-        const XBYTE *srcRow1 = src_desc.Image + srcY1 * src_desc.BytesPerLine;
-        XBYTE *dstRow = dst_desc.Image + y * dst_desc.BytesPerLine;
+int NearestInNeuQuant(const void *context, int r, int g, int b) {
+    return static_cast<const NeuQuant *>(context)->inxsearch(r, g, b);
+}
 
-        int srcXFixed = 0;
-        for (int x = 0; x < dstW; ++x) {
-            const int srcX0 = srcXFixed >> 16;
-            const int srcX1 = XMin(srcX0 + 1, srcW - 1);
-            const int fracX = srcXFixed & 0xFFFF;
-            const int invFracX = 0x10000 - fracX;
+struct QuantCellMappingJob {
+    const QuantHistogram *histogram;
+    QuantNearestFunc nearest;
+    const void *context;
+    XBYTE *cellIndex;
+};
 
-            const XBYTE *p00 = srcRow0 + srcX0 * 3;
-            const XBYTE *p10 = srcRow0 + srcX1 * 3;
-            const XBYTE *p01 = srcRow1 + srcX0 * 3;
-            const XBYTE *p11 = srcRow1 + srcX1 * 3;
+void RunQuantCellMapping(void *userData, int begin, int end) {
+    const QuantCellMappingJob &job = *static_cast<const QuantCellMappingJob *>(userData);
+    for (int i = begin; i < end; ++i) {
+        const int cell = job.histogram->occupied[i];
+        int r, g, b;
+        job.histogram->CellMean(cell, r, g, b);
+        job.cellIndex[cell] = static_cast<XBYTE>(job.nearest(job.context, r, g, b));
+    }
+}
 
-            // Bilinear interpolation for each channel (BGR order)
-            for (int c = 0; c < 3; ++c) {
-                XDWORD v = (((p00[c] * invFracX + p10[c] * fracX) >> 16) * invFracY +
-                            ((p01[c] * invFracX + p11[c] * fracX) >> 16) * fracY) >> 16;
-                dstRow[x * 3 + c] = (XBYTE)v;
-            }
+struct QuantRemapJob {
+    const VxImageDescEx *src;
+    const VxImageDescEx *dst;
+    const XBYTE *cellIndex;
+};
 
-            srcXFixed += scaleX;
+void RunQuantRemapRows(void *userData, int begin, int end) {
+    const QuantRemapJob &job = *static_cast<const QuantRemapJob *>(userData);
+    const int srcBpp = job.src->BitsPerPixel / 8;
+    for (int y = begin; y < end; ++y) {
+        const XBYTE *src = job.src->Image + static_cast<ptrdiff_t>(y) * job.src->BytesPerLine;
+        XBYTE *dst = job.dst->Image + static_cast<ptrdiff_t>(y) * job.dst->BytesPerLine;
+        for (int x = 0; x < job.src->Width; ++x, src += srcBpp) {
+            dst[x] = job.cellIndex[QuantCellIndex(src[2], src[1], src[0])];
         }
     }
 }
 
-void VxBlitEngine::ResizeNearestNeighbor(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
-    const int srcW = src_desc.Width;
-    const int srcH = src_desc.Height;
-    const int dstW = dst_desc.Width;
-    const int dstH = dst_desc.Height;
-    const int srcBpp = src_desc.BitsPerPixel / 8;
-    const int dstBpp = dst_desc.BitsPerPixel / 8;
+// Maps every pixel to a palette index through an inverse-palette table: the
+// nearest entry is searched once per occupied cube cell (at the cell's mean
+// color) and pixels are then remapped by table lookup. Both passes are spread
+// over up to @p threads tasks.
+void MapQuantizedPixels(const QuantHistogram &histogram, QuantNearestFunc nearest, const void *context,
+                        const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int threads, int minRows) {
+    XArray<XBYTE> cellIndex;
+    cellIndex.Resize(QUANT_CELL_COUNT);
+
+    QuantCellMappingJob mapping;
+    mapping.histogram = &histogram;
+    mapping.nearest = nearest;
+    mapping.context = context;
+    mapping.cellIndex = cellIndex.Begin();
+    VxParallelFor(histogram.occupied.Size(), QUANT_MIN_CELLS_PER_TASK, threads, RunQuantCellMapping, &mapping);
+
+    QuantRemapJob remap;
+    remap.src = &src_desc;
+    remap.dst = &dst_desc;
+    remap.cellIndex = cellIndex.Begin();
+    VxParallelFor(src_desc.Height, minRows, threads, RunQuantRemapRows, &remap);
+}
 
-    const int scaleX = (srcW << 16) / dstW;
-    const int scaleY = (srcH << 16) / dstH;
-    const int copyBpp = XMin(srcBpp, dstBpp);
+//------------------------------------------------------------------------------
+// Floyd-Steinberg error diffusion -- rows pipelined across tasks (file-local)
+//------------------------------------------------------------------------------
 
-    XArray<int> srcXMap(dstW);
-    srcXMap.Resize(dstW);
-    int srcXFixed = 0;
-    for (int x = 0; x < dstW; ++x) {
-        int srcX = srcXFixed >> 16;
-        if (srcX >= srcW) srcX = srcW - 1;
-        srcXMap[x] = srcX;
-        srcXFixed += scaleX;
-    }
+const int QUANT_DIFFUSION_CHUNK = 32; // Columns between progress updates
+
+struct QuantDiffusionJob {
+    const VxImageDescEx *src;
+    const VxImageDescEx *dst;
+    QuantNearestFunc nearest;
+    const void *context;
+    const XBYTE *palette;
+    int paletteBytes;
+    int ringRows;           // Error rows in flight
+    int *errors;            // ringRows rows of (width + 2) * 3 errors, in sixteenths
+    volatile int *progress; // Columns finished per image row
+    volatile int nextRow;
+};
 
-    int srcYFixed = 0;
-    for (int y = 0; y < dstH; ++y) {
-        int srcY = srcYFixed >> 16;
-        if (srcY >= srcH) srcY = srcH - 1;
-        const XBYTE *srcRow = src_desc.Image + srcY * src_desc.BytesPerLine;
-        XBYTE *dstRow = dst_desc.Image + y * dst_desc.BytesPerLine;
+void WaitForQuantRow(volatile int *progress, int columns) {
+    while (VxAtomicLoadInt(progress) < columns) {
+        std::this_thread::yield();
+    }
+}
 
-        if (srcBpp == dstBpp) {
-            if (srcBpp == 1) {
-                for (int x = 0; x < dstW; ++x) {
-                    dstRow[x] = srcRow[srcXMap[x]];
-                }
-            } else if (srcBpp == 2) {
-                for (int x = 0; x < dstW; ++x) {
-                    const XBYTE *srcPx = srcRow + (srcXMap[x] * 2);
-                    XBYTE *dstPx = dstRow + (x * 2);
-                    dstPx[0] = srcPx[0];
-                    dstPx[1] = srcPx[1];
-                }
-            } else if (srcBpp == 3) {
-                for (int x = 0; x < dstW; ++x) {
-                    const XBYTE *srcPx = srcRow + (srcXMap[x] * 3);
-                    XBYTE *dstPx = dstRow + (x * 3);
-                    dstPx[0] = srcPx[0];
-                    dstPx[1] = srcPx[1];
-                    dstPx[2] = srcPx[2];
-                }
-            } else if (srcBpp == 4) {
-                for (int x = 0; x < dstW; ++x) {
-                    const XBYTE *srcPx = srcRow + (srcXMap[x] * 4);
-                    XBYTE *dstPx = dstRow + (x * 4);
-                    dstPx[0] = srcPx[0];
-                    dstPx[1] = srcPx[1];
-                    dstPx[2] = srcPx[2];
-                    dstPx[3] = srcPx[3];
-                }
-            } else {
-                for (int x = 0; x < dstW; ++x) {
-                    const XBYTE *srcPx = srcRow + srcXMap[x] * srcBpp;
-                    XBYTE *dstPx = dstRow + x * dstBpp;
-                    memcpy(dstPx, srcPx, static_cast<size_t>(srcBpp));
-                }
+// Tasks claim rows in order. A row starts a chunk once the row above has
+// finished one column past it, so every task only waits on rows claimed
+// before its own and the result does not depend on the task count.
+void RunQuantDiffusionRows(void *userData, int, int) {
+    QuantDiffusionJob &job = *static_cast<QuantDiffusionJob *>(userData);
+    const int width = job.src->Width;
+    const int srcBpp = job.src->BitsPerPixel / 8;
+    const int errorStride = (width + 2) * 3;
+
+    for (;;) {
+        const int y = VxAtomicIncrementInt(&job.nextRow) - 1;
+        if (y >= job.src->Height) return;
+
+        // The error row filled for y + 1 was last read by row y + 1 - ringRows.
+        if (y + 1 >= job.ringRows) {
+            WaitForQuantRow(&job.progress[y + 1 - job.ringRows], width);
+        }
+        const int *incoming = job.errors + (y % job.ringRows) * errorStride + 3;
+        int *outgoing = job.errors + ((y + 1) % job.ringRows) * errorStride + 3;
+        memset(outgoing - 3, 0, errorStride * sizeof(int));
+
+        const XBYTE *src = job.src->Image + static_cast<ptrdiff_t>(y) * job.src->BytesPerLine;
+        XBYTE *dst = job.dst->Image + static_cast<ptrdiff_t>(y) * job.dst->BytesPerLine;
+        int carry[3] = {0, 0, 0};
+        for (int x0 = 0; x0 < width; x0 += QUANT_DIFFUSION_CHUNK) {
+            const int x1 = XMin(width, x0 + QUANT_DIFFUSION_CHUNK);
+            if (y > 0) {
+                WaitForQuantRow(&job.progress[y - 1], XMin(width, x1 + 1));
             }
-        } else {
-            for (int x = 0; x < dstW; ++x) {
-                const XBYTE *srcPx = srcRow + srcXMap[x] * srcBpp;
-                XBYTE *dstPx = dstRow + x * dstBpp;
-
-                for (int b = 0; b < copyBpp; ++b) {
-                    dstPx[b] = srcPx[b];
+            for (int x = x0; x < x1; ++x) {
+                const XBYTE *pixel = src + x * srcBpp;
+                const int source[3] = {pixel[2], pixel[1], pixel[0]};
+                int color[3];
+                for (int c = 0; c < 3; ++c) {
+                    color[c] = XMin(255, XMax(0, source[c] + ((incoming[x * 3 + c] + carry[c] + 8) >> 4)));
                 }
-                for (int b = copyBpp; b < dstBpp; ++b) {
-                    dstPx[b] = 0xFF;
+
+                const int index = job.nearest(job.context, color[0], color[1], color[2]);
+                dst[x] = static_cast<XBYTE>(index);
+
+                // 7/16 right, 3/16 below left, 5/16 below, 1/16 below right.
+                const XBYTE *entry = job.palette + index * job.paletteBytes;
+                const int chosen[3] = {entry[2], entry[1], entry[0]};
+                for (int c = 0; c < 3; ++c) {
+                    const int error = color[c] - chosen[c];
+                    carry[c] = error * 7;
+                    outgoing[(x - 1) * 3 + c] += error * 3;
+                    outgoing[x * 3 + c] += error * 5;
+                    outgoing[(x + 1) * 3 + c] += error;
                 }
             }
+            VxAtomicStoreInt(&job.progress[y], x1);
         }
-        srcYFixed += scaleY;
     }
 }
 
-//==============================================================================
-//  Quantization
-//==============================================================================
+// Maps every pixel with Floyd-Steinberg error diffusion, scanning left to
+// right. Rows run on up to @p threads tasks, each trailing the row above.
+void DiffuseQuantizedPixels(QuantNearestFunc nearest, const void *context, const XBYTE *palette, int paletteBytes,
+                            const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int threads) {
+    const int tasks = XMax(1, XMin(threads, src_desc.Height));
+    XArray<int> errors;
+    errors.Resize((tasks + 2) * (src_desc.Width + 2) * 3);
+    memset(errors.Begin(), 0, errors.Size() * sizeof(int));
+    XArray<int> progress;
+    progress.Resize(src_desc.Height);
+    memset(progress.Begin(), 0, progress.Size() * sizeof(int));
+
+    QuantDiffusionJob job;
+    job.src = &src_desc;
+    job.dst = &dst_desc;
+    job.nearest = nearest;
+    job.context = context;
+    job.palette = palette;
+    job.paletteBytes = paletteBytes;
+    job.ringRows = tasks + 2;
+    job.errors = errors.Begin();
+    job.progress = progress.Begin();
+    job.nextRow = 0;
+    VxParallelFor(tasks, 1, tasks, RunQuantDiffusionRows, &job);
+}
 
 //------------------------------------------------------------------------------
-// Median-Cut Algorithm -- helper types (file-local)
+// Median-Cut Algorithm -- boxes of histogram cells (file-local)
 //------------------------------------------------------------------------------
 
 struct ColorBox {
-    int rMin, rMax;
-    int gMin, gMax;
-    int bMin, bMax;
-    int count;
-    int pixelStartIdx;
-    int pixelCount;
-};
-
-struct ColorPixel {
-    XBYTE r, g, b;
-    int count;
+    int lo[3]; // Inclusive cell bounds along r, g, b
+    int hi[3];
+    XDWORD count;
 };
 
-static int ComparePixelByR(const void *a, const void *b) {
-    const ColorPixel *pa = reinterpret_cast<const ColorPixel *>(a);
-    const ColorPixel *pb = reinterpret_cast<const ColorPixel *>(b);
-    return static_cast<int>(pa->r) - static_cast<int>(pb->r);
+template <typename Visit>
+void ForEachCellInBox(const ColorBox &box, Visit visit) {
+    for (int r = box.lo[0]; r <= box.hi[0]; ++r) {
+        for (int g = box.lo[1]; g <= box.hi[1]; ++g) {
+            const int row = (r << (2 * QUANT_CELL_BITS)) | (g << QUANT_CELL_BITS);
+            for (int b = box.lo[2]; b <= box.hi[2]; ++b) {
+                visit(row | b, r, g, b);
+            }
+        }
+    }
 }
 
-static int ComparePixelByG(const void *a, const void *b) {
-    const ColorPixel *pa = reinterpret_cast<const ColorPixel *>(a);
-    const ColorPixel *pb = reinterpret_cast<const ColorPixel *>(b);
-    return static_cast<int>(pa->g) - static_cast<int>(pb->g);
+// Shrinks the box to its occupied cells and recounts it.
+void ShrinkColorBox(const QuantHistogram &histogram, ColorBox &box) {
+    int lo[3] = {QUANT_CELL_SIDE, QUANT_CELL_SIDE, QUANT_CELL_SIDE};
+    int hi[3] = {-1, -1, -1};
+    XDWORD count = 0;
+    ForEachCellInBox(box, [&](int index, int r, int g, int b) {
+        const XDWORD n = histogram.cells[index].count;
+        if (!n) return;
+        count += n;
+        const int c[3] = {r, g, b};
+        for (int axis = 0; axis < 3; ++axis) {
+            lo[axis] = XMin(lo[axis], c[axis]);
+            hi[axis] = XMax(hi[axis], c[axis]);
+        }
+    });
+    for (int axis = 0; axis < 3; ++axis) {
+        box.lo[axis] = lo[axis];
+        box.hi[axis] = hi[axis];
+    }
+    box.count = count;
 }
 
-static int ComparePixelByB(const void *a, const void *b) {
-    const ColorPixel *pa = reinterpret_cast<const ColorPixel *>(a);
-    const ColorPixel *pb = reinterpret_cast<const ColorPixel *>(b);
-    return static_cast<int>(pa->b) - static_cast<int>(pb->b);
+int LongestColorBoxAxis(const ColorBox &box) {
+    const int rRange = box.hi[0] - box.lo[0];
+    const int gRange = box.hi[1] - box.lo[1];
+    const int bRange = box.hi[2] - box.lo[2];
+    if (rRange >= gRange && rRange >= bRange) return 0;
+    return gRange >= bRange ? 1 : 2;
 }
 
-static void RecalcColorBoxBounds(XArray<ColorPixel> &pixels, ColorBox &box) {
-    box.rMin = box.gMin = box.bMin = 255;
-    box.rMax = box.gMax = box.bMax = 0;
-    box.count = 0;
-    for (int i = 0; i < box.pixelCount; ++i) {
-        ColorPixel &cp = pixels[box.pixelStartIdx + i];
-        box.rMin = XMin(box.rMin, static_cast<int>(cp.r));
-        box.rMax = XMax(box.rMax, static_cast<int>(cp.r));
-        box.gMin = XMin(box.gMin, static_cast<int>(cp.g));
-        box.gMax = XMax(box.gMax, static_cast<int>(cp.g));
-        box.bMin = XMin(box.bMin, static_cast<int>(cp.b));
-        box.bMax = XMax(box.bMax, static_cast<int>(cp.b));
-        box.count += cp.count;
+// Splits a (shrunk) box at the population median of its longest axis. Both
+// halves keep at least one occupied slice since the bounds are occupied.
+void SplitColorBox(const QuantHistogram &histogram, ColorBox &box, ColorBox &other) {
+    const int axis = LongestColorBoxAxis(box);
+    XDWORD slices[QUANT_CELL_SIDE] = {};
+    ForEachCellInBox(box, [&](int index, int r, int g, int b) {
+        const int c[3] = {r, g, b};
+        slices[c[axis]] += histogram.cells[index].count;
+    });
+
+    int split = box.lo[axis];
+    XDWORD below = slices[split];
+    while (split + 1 < box.hi[axis] && below * 2 < box.count) {
+        below += slices[++split];
     }
-}
 
-static inline int ColorDistSq(int r1, int g1, int b1, int r2, int g2, int b2) {
-    int dr = r1 - r2;
-    int dg = g1 - g2;
-    int db = b1 - b2;
-    // Weighted by human perception: green > red > blue
-    return dr * dr * 2 + dg * dg * 4 + db * db;
+    other = box;
+    box.hi[axis] = split;
+    other.lo[axis] = split + 1;
+    ShrinkColorBox(histogram, box);
+    ShrinkColorBox(histogram, other);
 }
 
+} // namespace
+
 //------------------------------------------------------------------------------
 // NeuQuant-based Quantization (Default)
 //------------------------------------------------------------------------------
 
 XBOOL VxBlitEngine::QuantizeImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
-    VxMutexLock lock(m_Lock);
+    return QuantizeImage(src_desc, dst_desc, VX_DITHER_NONE);
+}
 
+XBOOL VxBlitEngine::QuantizeImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, int dither) {
+    VX_PROFILE_SCOPE("VxBlitEngine::QuantizeImage");
     // Quantization requires 256 color palette
     if (dst_desc.ColorMapEntries != 256) return FALSE;
     if (!dst_desc.ColorMap) return FALSE;
@@ -1606,29 +4792,14 @@ XBOOL VxBlitEngine::QuantizeImage(const VxImageDescEx &src_desc, const VxImageDe
     }
 
     // Step 4: Map pixels to palette indices
-    srcRow = src_desc.Image;
-    XBYTE *dstRow = dst_desc.Image;
-
-    for (int y = 0; y < src_desc.Height; ++y) {
-        const XBYTE *src = srcRow;
-        XBYTE *dst = dstRow;
-
-        for (int x = 0; x < src_desc.Width; ++x) {
-            // Source is BGR(A)
-            int b = src[0];
-            int g = src[1];
-            int r = src[2];
-
-            // Find best matching palette index
-            int idx = nq.inxsearch(r, g, b);
-            *dst = (XBYTE)idx;
-
-            src += srcBpp;
-            dst++;
-        }
-
-        srcRow += src_desc.BytesPerLine;
-        dstRow += dst_desc.BytesPerLine;
+    const int threads = VxAtomicLoadInt(&m_BlitThreadCount);
+    if (dither == VX_DITHER_ERRORDIFFUSION) {
+        DiffuseQuantizedPixels(NearestInNeuQuant, &nq, palette, paletteBytesPer, src_desc, dst_desc, threads);
+    } else {
+        QuantHistogram histogram;
+        histogram.Build(src_desc);
+        MapQuantizedPixels(histogram, NearestInNeuQuant, &nq, src_desc, dst_desc, threads,
+                           VxAtomicLoadInt(&m_MinRowsPerBand));
     }
 
     return TRUE;
@@ -1639,8 +4810,12 @@ XBOOL VxBlitEngine::QuantizeImage(const VxImageDescEx &src_desc, const VxImageDe
 //------------------------------------------------------------------------------
 
 XBOOL VxBlitEngine::QuantizeImageMedianCut(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
-    VxMutexLock lock(m_Lock);
+    return QuantizeImageMedianCut(src_desc, dst_desc, VX_DITHER_NONE);
+}
 
+XBOOL VxBlitEngine::QuantizeImageMedianCut(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc,
+                                           int dither) {
+    VX_PROFILE_SCOPE("VxBlitEngine::QuantizeImageMedianCut");
     // Quantization requires 256 color palette
     if (dst_desc.ColorMapEntries != 256) return FALSE;
     if (!dst_desc.ColorMap) return FALSE;
@@ -1653,192 +4828,55 @@ XBOOL VxBlitEngine::QuantizeImageMedianCut(const VxImageDescEx &src_desc, const
     if (src_desc.Width <= 0 || src_desc.Height <= 0) return FALSE;
     if (dst_desc.Width != src_desc.Width || dst_desc.Height != src_desc.Height) return FALSE;
 
-    const int totalPixels = src_desc.Width * src_desc.Height;
     const int maxColors = 256;
 
-    // Step 1: Build color histogram
-    struct ColorEntry {
-        XDWORD color;
-        int count;
-        int next;
-    };
-
-    const int hashSize = 65536;
-    XArray<int> hashTable;
-    hashTable.Resize(hashSize);
-    for (int i = 0; i < hashSize; ++i) {
-        hashTable[i] = -1;
-    }
-
-    XArray<ColorEntry> colorEntries;
-    colorEntries.Resize(totalPixels / 4 + 256);
-    int numUniqueColors = 0;
-
-    // Scan all pixels and build histogram
-    const XBYTE *srcRow = src_desc.Image;
-    for (int y = 0; y < src_desc.Height; ++y) {
-        const XBYTE *src = srcRow;
-        for (int x = 0; x < src_desc.Width; ++x) {
-            XBYTE b = src[0];
-            XBYTE g = src[1];
-            XBYTE r = src[2];
-
-            // Create color key (5-6-5 quantized for hash)
-            XDWORD colorKey = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
-            XDWORD fullColor = (r << 16) | (g << 8) | b;
-
-            // Search hash chain
-            int idx = hashTable[colorKey];
-            bool found = false;
-            while (idx >= 0) {
-                if (colorEntries[idx].color == fullColor) {
-                    colorEntries[idx].count++;
-                    found = true;
-                    break;
-                }
-                idx = colorEntries[idx].next;
-            }
-
-            if (!found) {
-                // Add new color
-                ColorEntry entry;
-                entry.color = fullColor;
-                entry.count = 1;
-                entry.next = hashTable[colorKey];
-
-                int newIdx = numUniqueColors++;
-                if (newIdx >= (int)colorEntries.Size()) {
-                    colorEntries.Resize(colorEntries.Size() + 1024);
-                }
-                colorEntries[newIdx] = entry;
-                hashTable[colorKey] = newIdx;
-            }
-
-            src += srcBpp;
-        }
-        srcRow += src_desc.BytesPerLine;
-    }
-
-    // Step 2: Build pixel array for median-cut
-    XArray<ColorPixel> pixels;
-    pixels.Resize(numUniqueColors);
-
-    for (int i = 0; i < numUniqueColors; ++i) {
-        ColorPixel cp;
-        cp.r = (colorEntries[i].color >> 16) & 0xFF;
-        cp.g = (colorEntries[i].color >> 8) & 0xFF;
-        cp.b = colorEntries[i].color & 0xFF;
-        cp.count = colorEntries[i].count;
-        pixels[i] = cp;
-    }
-
-    // Step 3: Median-cut algorithm
-    XArray<ColorBox> boxes;
-    boxes.Resize(maxColors);
-
-    // Initialize first box containing all colors
-    ColorBox initialBox;
-    initialBox.rMin = initialBox.gMin = initialBox.bMin = 255;
-    initialBox.rMax = initialBox.gMax = initialBox.bMax = 0;
-    initialBox.count = 0;
-    initialBox.pixelStartIdx = 0;
-    initialBox.pixelCount = numUniqueColors;
-
-    for (int i = 0; i < numUniqueColors; ++i) {
-        initialBox.rMin = XMin(initialBox.rMin, (int)pixels[i].r);
-        initialBox.rMax = XMax(initialBox.rMax, (int)pixels[i].r);
-        initialBox.gMin = XMin(initialBox.gMin, (int)pixels[i].g);
-        initialBox.gMax = XMax(initialBox.gMax, (int)pixels[i].g);
-        initialBox.bMin = XMin(initialBox.bMin, (int)pixels[i].b);
-        initialBox.bMax = XMax(initialBox.bMax, (int)pixels[i].b);
-        initialBox.count += pixels[i].count;
-    }
+    // Step 1: Build color cube histogram
+    QuantHistogram histogram;
+    histogram.Build(src_desc);
 
-    boxes[0] = initialBox;
+    // Step 2: Median-cut the cube, always splitting the box with the largest range
+    ColorBox boxes[maxColors];
+    boxes[0].lo[0] = boxes[0].lo[1] = boxes[0].lo[2] = 0;
+    boxes[0].hi[0] = boxes[0].hi[1] = boxes[0].hi[2] = QUANT_CELL_SIDE - 1;
+    ShrinkColorBox(histogram, boxes[0]);
     int numBoxes = 1;
 
-    // Split boxes until we have maxColors
     while (numBoxes < maxColors) {
-        // Find box with largest range to split
         int splitIdx = -1;
         int maxRange = 0;
-
         for (int i = 0; i < numBoxes; ++i) {
-            int rRange = boxes[i].rMax - boxes[i].rMin;
-            int gRange = boxes[i].gMax - boxes[i].gMin;
-            int bRange = boxes[i].bMax - boxes[i].bMin;
-            int largestRange = XMax(rRange, XMax(gRange, bRange));
-
-            if (boxes[i].pixelCount <= 1) continue;
-            if (largestRange == 0) continue;
-
-            if (largestRange > maxRange) {
-                maxRange = largestRange;
+            const int axis = LongestColorBoxAxis(boxes[i]);
+            const int range = boxes[i].hi[axis] - boxes[i].lo[axis];
+            if (range > maxRange) {
+                maxRange = range;
                 splitIdx = i;
             }
         }
 
         if (splitIdx < 0) break;
-
-        ColorBox &box = boxes[splitIdx];
-
-        // Find longest axis
-        int rRange = box.rMax - box.rMin;
-        int gRange = box.gMax - box.gMin;
-        int bRange = box.bMax - box.bMin;
-
-        // Sort pixels by longest axis
-        ColorPixel *boxPixels = pixels.Begin() + box.pixelStartIdx;
-        if (rRange >= gRange && rRange >= bRange) {
-            qsort(boxPixels, static_cast<size_t>(box.pixelCount), sizeof(ColorPixel), ComparePixelByR);
-        } else if (gRange >= bRange) {
-            qsort(boxPixels, static_cast<size_t>(box.pixelCount), sizeof(ColorPixel), ComparePixelByG);
-        } else {
-            qsort(boxPixels, static_cast<size_t>(box.pixelCount), sizeof(ColorPixel), ComparePixelByB);
-        }
-
-        // Split at median
-        int splitPoint = box.pixelCount / 2;
-        if (splitPoint == 0) splitPoint = 1;
-
-        // Create new box for second half
-        ColorBox newBox;
-        newBox.pixelStartIdx = box.pixelStartIdx + splitPoint;
-        newBox.pixelCount = box.pixelCount - splitPoint;
-
-        // Update original box
-        box.pixelCount = splitPoint;
-
-        // Recalculate bounds for both boxes
-        RecalcColorBoxBounds(pixels, box);
-        RecalcColorBoxBounds(pixels, newBox);
-
-        boxes[numBoxes++] = newBox;
+        SplitColorBox(histogram, boxes[splitIdx], boxes[numBoxes++]);
     }
 
-    // Step 4: Calculate palette colors (weighted average of each box)
+    // Step 3: Calculate palette colors (weighted average of each box)
     XBYTE *palette = dst_desc.ColorMap;
     int paletteBytesPer = dst_desc.BytesPerColorEntry;
     if (paletteBytesPer < 3) paletteBytesPer = 3;
 
     for (int i = 0; i < numBoxes; ++i) {
-        ColorBox &box = boxes[i];
         long long rSum = 0, gSum = 0, bSum = 0;
-        int totalWeight = 0;
-
-        for (int j = 0; j < box.pixelCount; ++j) {
-            ColorPixel &cp = pixels[box.pixelStartIdx + j];
-            rSum += cp.r * cp.count;
-            gSum += cp.g * cp.count;
-            bSum += cp.b * cp.count;
-            totalWeight += cp.count;
-        }
-
+        ForEachCellInBox(boxes[i], [&](int index, int r, int g, int b) {
+            const QuantCell &cell = histogram.cells[index];
+            rSum += static_cast<long long>(r << QUANT_CELL_SHIFT) * cell.count + cell.rLow;
+            gSum += static_cast<long long>(g << QUANT_CELL_SHIFT) * cell.count + cell.gLow;
+            bSum += static_cast<long long>(b << QUANT_CELL_SHIFT) * cell.count + cell.bLow;
+        });
+
+        const long long totalWeight = boxes[i].count;
         XBYTE *entry = palette + i * paletteBytesPer;
         if (totalWeight > 0) {
-            entry[0] = (XBYTE)(bSum / totalWeight);
-            entry[1] = (XBYTE)(gSum / totalWeight);
-            entry[2] = (XBYTE)(rSum / totalWeight);
+            entry[0] = (XBYTE)((bSum + totalWeight / 2) / totalWeight);
+            entry[1] = (XBYTE)((gSum + totalWeight / 2) / totalWeight);
+            entry[2] = (XBYTE)((rSum + totalWeight / 2) / totalWeight);
         } else {
             entry[0] = entry[1] = entry[2] = 0;
         }
@@ -1856,41 +4894,14 @@ XBOOL VxBlitEngine::QuantizeImageMedianCut(const VxImageDescEx &src_desc, const
         }
     }
 
-    // Step 5: Map pixels to palette
-    srcRow = src_desc.Image;
-    XBYTE *dstRow = dst_desc.Image;
-
-    for (int y = 0; y < src_desc.Height; ++y) {
-        const XBYTE *src = srcRow;
-        XBYTE *dst = dstRow;
-
-        for (int x = 0; x < src_desc.Width; ++x) {
-            XBYTE b = src[0];
-            XBYTE g = src[1];
-            XBYTE r = src[2];
-
-            // Find closest palette entry
-            int bestIdx = 0;
-            int bestDist = 0x7FFFFFFF;
-
-            for (int i = 0; i < numBoxes; ++i) {
-                XBYTE *entry = palette + i * paletteBytesPer;
-                int dist = ColorDistSq(r, g, b, entry[2], entry[1], entry[0]);
-                if (dist < bestDist) {
-                    bestDist = dist;
-                    bestIdx = i;
-                    if (dist == 0) break;
-                }
-            }
-
-            *dst = (XBYTE)bestIdx;
-
-            src += srcBpp;
-            dst++;
-        }
-
-        srcRow += src_desc.BytesPerLine;
-        dstRow += dst_desc.BytesPerLine;
+    // Step 4: Map pixels to palette
+    const QuantPaletteSearch search(palette, paletteBytesPer, numBoxes);
+    const int threads = VxAtomicLoadInt(&m_BlitThreadCount);
+    if (dither == VX_DITHER_ERRORDIFFUSION) {
+        DiffuseQuantizedPixels(NearestInPalette, &search, palette, paletteBytesPer, src_desc, dst_desc, threads);
+    } else {
+        MapQuantizedPixels(histogram, NearestInPalette, &search, src_desc, dst_desc, threads,
+                           VxAtomicLoadInt(&m_MinRowsPerBand));
     }
 
     return TRUE;
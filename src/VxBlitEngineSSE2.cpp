@@ -14,7 +14,9 @@
 #if defined(VX_SIMD_SSE2)
 
 #include <cstdint>
-#include <emmintrin.h>  // SSE2
+#if defined(VX_SIMD_X86)
+#include <emmintrin.h>  // SSE2; NEON and SIMD128 builds get SIMDe through VxSIMD.h
+#endif
 
 #include "VxMath.h"
 
@@ -453,32 +455,19 @@ void CopyLine_Paletted8_32ARGB_SSE(const VxBlitInfo *info) {
     const XBYTE *src = info->srcLine;
     XDWORD *dst = (XDWORD *)info->dstLine;
     const int width = info->width;
-    const XBYTE *colorMap = info->colorMap;
-    const int bpc = info->bytesPerColorEntry;
 
-    if (!colorMap) return;
-
-    // Pre-build palette as 32-bit ARGB
-    XDWORD palette32[256];
-    for (int i = 0; i < 256; ++i) {
-        const XBYTE *entry = colorMap + i * bpc;
-        XDWORD b = entry[0];
-        XDWORD g = entry[1];
-        XDWORD r = entry[2];
-        XDWORD a = (bpc >= 4) ? entry[3] : 0xFF;
-        palette32[i] = (a << 24) | (r << 16) | (g << 8) | b;
-    }
+    if (!info->colorMap) return;
+    const XDWORD *palette = GetPaletteARGB(info);
 
     int x = 0;
     for (; x + 4 <= width; x += 4) {
-        dst[x + 0] = palette32[src[x + 0]];
-        dst[x + 1] = palette32[src[x + 1]];
-        dst[x + 2] = palette32[src[x + 2]];
-        dst[x + 3] = palette32[src[x + 3]];
+        const __m128i colors = _mm_setr_epi32((int)palette[src[x + 0]], (int)palette[src[x + 1]],
+                                              (int)palette[src[x + 2]], (int)palette[src[x + 3]]);
+        _mm_storeu_si128((__m128i *)(dst + x), colors);
     }
 
     for (; x < width; ++x) {
-        dst[x] = palette32[src[x]];
+        dst[x] = palette[src[x]];
     }
 }
 
@@ -534,9 +523,35 @@ void PremultiplyAlpha_32ARGB_SSE(const VxBlitInfo *info) {
     PremultiplyAlpha_32ARGB_Scalar(info, x);
 }
 
-// Unpremultiply requires per-pixel division -- simply delegate to scalar.
+// Unpremultiply two pixels widened to 16-bit lanes. f0/f1 are their factor rows
+// from g_UnpremultiplyTable: c * hi + mulhi(c, lo) is (c * reciprocal) >> 16.
+static inline __m128i Unpremultiply2_SSE(__m128i c, const XWORD *f0, const XWORD *f1) {
+    const __m128i r0 = _mm_load_si128((const __m128i *)f0);
+    const __m128i r1 = _mm_load_si128((const __m128i *)f1);
+    __m128i q = _mm_add_epi16(_mm_mullo_epi16(c, _mm_unpacklo_epi64(r0, r1)),
+                              _mm_mulhi_epu16(c, _mm_unpackhi_epi64(r0, r1)));
+    // min(q, 255) without SSE4.1
+    return _mm_sub_epi16(q, _mm_subs_epu16(q, _mm_set1_epi16(255)));
+}
+
 void UnpremultiplyAlpha_32ARGB_SSE(const VxBlitInfo *info) {
-    UnpremultiplyAlpha_32ARGB_Scalar(info, 0);
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+    const XWORD (*factors)[8] = g_UnpremultiplyTable.factors16;
+    const __m128i zero = _mm_setzero_si128();
+    int x = 0;
+
+    for (; x + 4 <= width; x += 4) {
+        __m128i pixels = _mm_loadu_si128((const __m128i *)(src + x));
+        __m128i lo = Unpremultiply2_SSE(_mm_unpacklo_epi8(pixels, zero),
+                                        factors[src[x] >> 24], factors[src[x + 1] >> 24]);
+        __m128i hi = Unpremultiply2_SSE(_mm_unpackhi_epi8(pixels, zero),
+                                        factors[src[x + 2] >> 24], factors[src[x + 3] >> 24]);
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(lo, hi));
+    }
+
+    UnpremultiplyAlpha_32ARGB_Scalar(info, x);
 }
 
 //==============================================================================
@@ -716,4 +731,976 @@ void MultiplyBlend_32_SSE(const VxBlitInfo *info) {
     MultiplyBlend_32_Scalar(src, dst, x, width);
 }
 
+//==============================================================================
+//  #9  DXT Block Decoding
+//==============================================================================
+
+// Selects palette[index] for four pixels whose 2-bit indices sit in the low
+// byte of @p rowIndices. Lane i tests bits 2i and 2i+1 with a per-lane mask.
+static inline __m128i SelectDXTColors_SSE(XDWORD rowIndices, const __m128i palette[4]) {
+    const __m128i bit0 = _mm_setr_epi32(1, 4, 16, 64);
+    const __m128i bit1 = _mm_setr_epi32(2, 8, 32, 128);
+    const __m128i indices = _mm_set1_epi32((int)rowIndices);
+    const __m128i has0 = _mm_cmpeq_epi32(_mm_and_si128(indices, bit0), bit0);
+    const __m128i has1 = _mm_cmpeq_epi32(_mm_and_si128(indices, bit1), bit1);
+    const __m128i lo = _mm_or_si128(_mm_andnot_si128(has0, palette[0]), _mm_and_si128(has0, palette[1]));
+    const __m128i hi = _mm_or_si128(_mm_andnot_si128(has0, palette[2]), _mm_and_si128(has0, palette[3]));
+    return _mm_or_si128(_mm_andnot_si128(has1, lo), _mm_and_si128(has1, hi));
+}
+
+static inline void LoadDXTColorPalette_SSE(const XBYTE *block, bool allowPunchThrough, __m128i palette[4]) {
+    const __m128i colors = DXTBuildColorPalette_SSE2(block, allowPunchThrough);
+    palette[0] = _mm_shuffle_epi32(colors, _MM_SHUFFLE(0, 0, 0, 0));
+    palette[1] = _mm_shuffle_epi32(colors, _MM_SHUFFLE(1, 1, 1, 1));
+    palette[2] = _mm_shuffle_epi32(colors, _MM_SHUFFLE(2, 2, 2, 2));
+    palette[3] = _mm_shuffle_epi32(colors, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+static inline XDWORD ReadDXTColorIndices(const XBYTE *block) {
+    return block[4] | (block[5] << 8) | (block[6] << 16) | ((XDWORD)block[7] << 24);
+}
+
+// Writes a block whose 16 alpha bytes (row-major) are in @p alpha over the
+// colors selected from @p palette.
+static inline void StoreDXTBlockWithAlpha_SSE(XBYTE *dst, int dstPitch, const __m128i palette[4], XDWORD indices,
+                                               __m128i alpha) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgbMask = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i alpha16Lo = _mm_unpacklo_epi8(zero, alpha);
+    const __m128i alpha16Hi = _mm_unpackhi_epi8(zero, alpha);
+    const __m128i rowAlpha[4] = {
+        _mm_unpacklo_epi16(zero, alpha16Lo),
+        _mm_unpackhi_epi16(zero, alpha16Lo),
+        _mm_unpacklo_epi16(zero, alpha16Hi),
+        _mm_unpackhi_epi16(zero, alpha16Hi),
+    };
+    for (int y = 0; y < 4; ++y) {
+        const __m128i colors = _mm_and_si128(SelectDXTColors_SSE(indices >> (y * 8), palette), rgbMask);
+        _mm_storeu_si128((__m128i *)(dst + y * dstPitch), _mm_or_si128(colors, rowAlpha[y]));
+    }
+}
+
+void DecodeBlocks_DXT1_SSE(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch) {
+    for (int b = 0; b < blockCount; ++b, blocks += 8, dst += 16) {
+        // Opaque blocks have no per-pixel alpha to merge: a table lookup beats
+        // the compare/blend selection here.
+        XDWORD colors[4];
+        _mm_storeu_si128((__m128i *)colors, DXTBuildColorPalette_SSE2(blocks, true));
+        XDWORD indices = ReadDXTColorIndices(blocks);
+        for (int y = 0; y < 4; ++y) {
+            XDWORD *row = (XDWORD *)(dst + y * dstPitch);
+            for (int x = 0; x < 4; ++x, indices >>= 2) {
+                row[x] = colors[indices & 3];
+            }
+        }
+    }
+}
+
+void DecodeBlocks_DXT3_SSE(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch) {
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    for (int b = 0; b < blockCount; ++b, blocks += 16, dst += 16) {
+        __m128i palette[4];
+        LoadDXTColorPalette_SSE(blocks + 8, false, palette);
+
+        // Split the 4-bit alphas into bytes (low nibble first) and scale by 17.
+        const __m128i packed = _mm_loadl_epi64((const __m128i *)blocks);
+        const __m128i lo = _mm_and_si128(packed, nibbleMask);
+        const __m128i hi = _mm_and_si128(_mm_srli_epi16(packed, 4), nibbleMask);
+        const __m128i nibbles = _mm_unpacklo_epi8(lo, hi);
+        const __m128i alpha = _mm_or_si128(nibbles, _mm_slli_epi16(nibbles, 4));
+
+        StoreDXTBlockWithAlpha_SSE(dst, dstPitch, palette, ReadDXTColorIndices(blocks + 8), alpha);
+    }
+}
+
+void DecodeBlocks_DXT5_SSE(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch) {
+    const __m128i rgbMask = _mm_set1_epi32(0x00FFFFFF);
+    for (int b = 0; b < blockCount; ++b, blocks += 16, dst += 16) {
+        // SSE2 has no variable shuffle for the 3-bit alpha indices: build both
+        // palettes in registers, then look the pixels up in scalar.
+        XDWORD colors[4];
+        _mm_storeu_si128((__m128i *)colors, _mm_and_si128(DXTBuildColorPalette_SSE2(blocks + 8, false), rgbMask));
+        XDWORD alphaPalette[8];
+        DXTBuildAlphaPalette(blocks, alphaPalette);
+
+        uint64_t alphaIndices = DXTReadAlphaIndices(blocks);
+        XDWORD indices = ReadDXTColorIndices(blocks + 8);
+        for (int y = 0; y < 4; ++y) {
+            XDWORD *row = (XDWORD *)(dst + y * dstPitch);
+            for (int x = 0; x < 4; ++x, indices >>= 2, alphaIndices >>= 3) {
+                row[x] = colors[indices & 3] | alphaPalette[alphaIndices & 7];
+            }
+        }
+    }
+}
+
+//==============================================================================
+//  #10 DXT Block Encoding
+//==============================================================================
+
+static void ComputeDXTBounds_SSE(const XDWORD pixels[16], XDWORD &minColor, XDWORD &maxColor) {
+    const __m128i r0 = _mm_loadu_si128((const __m128i *)pixels);
+    const __m128i r1 = _mm_loadu_si128((const __m128i *)(pixels + 4));
+    const __m128i r2 = _mm_loadu_si128((const __m128i *)(pixels + 8));
+    const __m128i r3 = _mm_loadu_si128((const __m128i *)(pixels + 12));
+    __m128i mn = _mm_min_epu8(_mm_min_epu8(r0, r1), _mm_min_epu8(r2, r3));
+    __m128i mx = _mm_max_epu8(_mm_max_epu8(r0, r1), _mm_max_epu8(r2, r3));
+    mn = _mm_min_epu8(mn, _mm_shuffle_epi32(mn, _MM_SHUFFLE(1, 0, 3, 2)));
+    mx = _mm_max_epu8(mx, _mm_shuffle_epi32(mx, _MM_SHUFFLE(1, 0, 3, 2)));
+    mn = _mm_min_epu8(mn, _mm_shuffle_epi32(mn, _MM_SHUFFLE(2, 3, 0, 1)));
+    mx = _mm_max_epu8(mx, _mm_shuffle_epi32(mx, _MM_SHUFFLE(2, 3, 0, 1)));
+    minColor = (XDWORD)_mm_cvtsi128_si32(mn);
+    maxColor = (XDWORD)_mm_cvtsi128_si32(mx);
+}
+
+// Squared RGB distance of four pixels to one palette color (16-bit channels,
+// alpha lane zeroed in @p color and masked out of the pixels).
+static inline __m128i DXTColorDistance_SSE(__m128i pixelsLo, __m128i pixelsHi, __m128i color, __m128i rgbMask) {
+    const __m128i dLo = _mm_and_si128(_mm_sub_epi16(pixelsLo, color), rgbMask);
+    const __m128i dHi = _mm_and_si128(_mm_sub_epi16(pixelsHi, color), rgbMask);
+    // madd leaves [b^2 + g^2, r^2] per pixel; add the pairs.
+    const __m128 sqLo = _mm_castsi128_ps(_mm_madd_epi16(dLo, dLo));
+    const __m128 sqHi = _mm_castsi128_ps(_mm_madd_epi16(dHi, dHi));
+    const __m128i even = _mm_castps_si128(_mm_shuffle_ps(sqLo, sqHi, _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m128i odd = _mm_castps_si128(_mm_shuffle_ps(sqLo, sqHi, _MM_SHUFFLE(3, 1, 3, 1)));
+    return _mm_add_epi32(even, odd);
+}
+
+static inline XDWORD HorizontalSum_SSE(__m128i v) {
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return (XDWORD)_mm_cvtsi128_si32(v);
+}
+
+// Spreads the low 16 bits of @p x to the even bit positions.
+static inline XDWORD SpreadBits16(XDWORD x) {
+    x = (x | (x << 8)) & 0x00FF00FF;
+    x = (x | (x << 4)) & 0x0F0F0F0F;
+    x = (x | (x << 2)) & 0x33333333;
+    x = (x | (x << 1)) & 0x55555555;
+    return x;
+}
+
+static XDWORD SelectDXTColorIndices_SSE(const XDWORD pixels[16], const XDWORD palette[4], int entryCount,
+                                        XDWORD &indices) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgbMask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+    __m128i colors[4];
+    for (int k = 0; k < entryCount; ++k) {
+        colors[k] = _mm_unpacklo_epi8(_mm_set1_epi32((int)palette[k]), zero);
+    }
+
+    __m128i error = zero;
+    __m128i groupIndices[4];
+    for (int g = 0; g < 4; ++g) {
+        const __m128i p = _mm_loadu_si128((const __m128i *)(pixels + g * 4));
+        const __m128i pLo = _mm_unpacklo_epi8(p, zero);
+        const __m128i pHi = _mm_unpackhi_epi8(p, zero);
+
+        __m128i best = DXTColorDistance_SSE(pLo, pHi, colors[0], rgbMask);
+        __m128i bestIndex = zero;
+        for (int k = 1; k < entryCount; ++k) {
+            const __m128i d = DXTColorDistance_SSE(pLo, pHi, colors[k], rgbMask);
+            const __m128i closer = _mm_cmplt_epi32(d, best);
+            best = _mm_or_si128(_mm_andnot_si128(closer, best), _mm_and_si128(closer, d));
+            bestIndex = _mm_or_si128(_mm_andnot_si128(closer, bestIndex), _mm_and_si128(closer, _mm_set1_epi32(k)));
+        }
+        error = _mm_add_epi32(error, best);
+        groupIndices[g] = bestIndex;
+    }
+
+    // One index per byte, then gather bit 0 and bit 1 of every byte.
+    const __m128i bytes = _mm_packs_epi16(_mm_packs_epi32(groupIndices[0], groupIndices[1]),
+                                          _mm_packs_epi32(groupIndices[2], groupIndices[3]));
+    const XDWORD bit0 = (XDWORD)_mm_movemask_epi8(_mm_slli_epi16(bytes, 7));
+    const XDWORD bit1 = (XDWORD)_mm_movemask_epi8(_mm_slli_epi16(bytes, 6));
+    indices = SpreadBits16(bit0) | (SpreadBits16(bit1) << 1);
+    return HorizontalSum_SSE(error);
+}
+
+static XDWORD SelectDXTAlphaIndices_SSE(const XDWORD pixels[16], const XDWORD palette[8], uint64_t &indices) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i a0 = _mm_srli_epi32(_mm_loadu_si128((const __m128i *)pixels), 24);
+    const __m128i a1 = _mm_srli_epi32(_mm_loadu_si128((const __m128i *)(pixels + 4)), 24);
+    const __m128i a2 = _mm_srli_epi32(_mm_loadu_si128((const __m128i *)(pixels + 8)), 24);
+    const __m128i a3 = _mm_srli_epi32(_mm_loadu_si128((const __m128i *)(pixels + 12)), 24);
+    const __m128i alpha = _mm_packus_epi16(_mm_packs_epi32(a0, a1), _mm_packs_epi32(a2, a3));
+
+    const __m128i level0 = _mm_set1_epi8((char)(palette[0] >> 24));
+    __m128i best = _mm_or_si128(_mm_subs_epu8(alpha, level0), _mm_subs_epu8(level0, alpha));
+    __m128i bestIndex = zero;
+    for (int k = 1; k < 8; ++k) {
+        const __m128i level = _mm_set1_epi8((char)(palette[k] >> 24));
+        const __m128i d = _mm_or_si128(_mm_subs_epu8(alpha, level), _mm_subs_epu8(level, alpha));
+        // Unsigned d < best is max(d, best) != d; ties keep the lower index.
+        const __m128i notCloser = _mm_cmpeq_epi8(_mm_max_epu8(d, best), d);
+        best = _mm_min_epu8(best, d);
+        bestIndex = _mm_or_si128(_mm_and_si128(notCloser, bestIndex),
+                                 _mm_andnot_si128(notCloser, _mm_set1_epi8((char)k)));
+    }
+
+    const __m128i bestLo = _mm_unpacklo_epi8(best, zero);
+    const __m128i bestHi = _mm_unpackhi_epi8(best, zero);
+    const __m128i squares = _mm_add_epi32(_mm_madd_epi16(bestLo, bestLo), _mm_madd_epi16(bestHi, bestHi));
+
+    const XDWORD bit0 = (XDWORD)_mm_movemask_epi8(_mm_slli_epi16(bestIndex, 7));
+    const XDWORD bit1 = (XDWORD)_mm_movemask_epi8(_mm_slli_epi16(bestIndex, 6));
+    const XDWORD bit2 = (XDWORD)_mm_movemask_epi8(_mm_slli_epi16(bestIndex, 5));
+    indices = 0;
+    for (int i = 0; i < 16; ++i) {
+        const uint64_t index = ((bit0 >> i) & 1) | (((bit1 >> i) & 1) << 1) | (((bit2 >> i) & 1) << 2);
+        indices |= index << (i * 3);
+    }
+    return HorizontalSum_SSE(squares);
+}
+
+static const DXTEncodeOps s_SSEEncodeOps = {
+    ComputeDXTBounds_SSE,
+    SelectDXTColorIndices_SSE,
+    SelectDXTAlphaIndices_SSE,
+};
+
+void EncodeBlocks_DXT1_Fast_SSE(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks) {
+    EncodeDXTBlockRow(src, srcPitch, blockCount, blocks, _DXT1, false, s_SSEEncodeOps);
+}
+
+void EncodeBlocks_DXT1_High_SSE(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks) {
+    EncodeDXTBlockRow(src, srcPitch, blockCount, blocks, _DXT1, true, s_SSEEncodeOps);
+}
+
+void EncodeBlocks_DXT3_Fast_SSE(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks) {
+    EncodeDXTBlockRow(src, srcPitch, blockCount, blocks, _DXT3, false, s_SSEEncodeOps);
+}
+
+void EncodeBlocks_DXT3_High_SSE(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks) {
+    EncodeDXTBlockRow(src, srcPitch, blockCount, blocks, _DXT3, true, s_SSEEncodeOps);
+}
+
+void EncodeBlocks_DXT5_Fast_SSE(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks) {
+    EncodeDXTBlockRow(src, srcPitch, blockCount, blocks, _DXT5, false, s_SSEEncodeOps);
+}
+
+void EncodeBlocks_DXT5_High_SSE(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks) {
+    EncodeDXTBlockRow(src, srcPitch, blockCount, blocks, _DXT5, true, s_SSEEncodeOps);
+}
+
+//==============================================================================
+//  #11 Separable Resampling
+//==============================================================================
+
+// Weight pair (w0, w1) in every 32-bit lane, for madd against interleaved taps.
+static inline __m128i ResampleWeightPair_SSE(short w0, short w1) {
+    return _mm_set1_epi32((int)(XWORD)w0 | ((int)(XWORD)w1 << 16));
+}
+
+// Sum of weight * channel for one output pixel, one int32 per channel (BGRA).
+static inline __m128i ResampleHorzPixel_SSE(const XDWORD *p, const short *weights, int taps) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+    int t = 0;
+    for (; t + 2 <= taps; t += 2) {
+        // [b0 g0 r0 a0 b1 g1 r1 a1] -> [b0 b1 g0 g1 r0 r1 a0 a1]
+        const __m128i pair = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(p + t)), zero);
+        const __m128i taps2 = _mm_unpacklo_epi16(pair, _mm_srli_si128(pair, 8));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(taps2, ResampleWeightPair_SSE(weights[t], weights[t + 1])));
+    }
+    if (t < taps) {
+        const __m128i single = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int)p[t]), zero);
+        const __m128i taps1 = _mm_unpacklo_epi16(single, zero);
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(taps1, ResampleWeightPair_SSE(weights[t], 0)));
+    }
+    return acc;
+}
+
+void ResampleHorz_32_SSE(const XDWORD *src, short *dst, int dstWidth, const int *first, const short *weights,
+                         int taps) {
+    const __m128i round = _mm_set1_epi32(128);
+    int x = 0;
+    for (; x + 2 <= dstWidth; x += 2, weights += 2 * taps, dst += 8) {
+        const __m128i acc0 = _mm_add_epi32(ResampleHorzPixel_SSE(src + first[x], weights, taps), round);
+        const __m128i acc1 = _mm_add_epi32(ResampleHorzPixel_SSE(src + first[x + 1], weights + taps, taps), round);
+        _mm_storeu_si128((__m128i *)dst, _mm_packs_epi32(_mm_srai_epi32(acc0, 8), _mm_srai_epi32(acc1, 8)));
+    }
+    if (x < dstWidth) {
+        const __m128i acc = _mm_add_epi32(ResampleHorzPixel_SSE(src + first[x], weights, taps), round);
+        _mm_storel_epi64((__m128i *)dst, _mm_packs_epi32(_mm_srai_epi32(acc, 8), acc));
+    }
+}
+
+void ResampleVert_32_SSE(const short *const *rows, const short *weights, int taps, XDWORD *dst, int width) {
+    const int end = width * 4;
+    const __m128i round = _mm_set1_epi32(1 << 19);
+    const __m128i zero = _mm_setzero_si128();
+    XBYTE *out = (XBYTE *)dst;
+
+    int c = 0;
+    for (; c + 8 <= end; c += 8) {
+        __m128i lo = round;
+        __m128i hi = round;
+        int t = 0;
+        for (; t + 2 <= taps; t += 2) {
+            const __m128i a = _mm_loadu_si128((const __m128i *)(rows[t] + c));
+            const __m128i b = _mm_loadu_si128((const __m128i *)(rows[t + 1] + c));
+            const __m128i w = ResampleWeightPair_SSE(weights[t], weights[t + 1]);
+            lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), w));
+            hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), w));
+        }
+        if (t < taps) {
+            const __m128i a = _mm_loadu_si128((const __m128i *)(rows[t] + c));
+            const __m128i w = ResampleWeightPair_SSE(weights[t], 0);
+            lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(a, zero), w));
+            hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(a, zero), w));
+        }
+        const __m128i packed = _mm_packs_epi32(_mm_srai_epi32(lo, 20), _mm_srai_epi32(hi, 20));
+        _mm_storel_epi64((__m128i *)(out + c), _mm_packus_epi16(packed, packed));
+    }
+
+    ResampleVert_32_Scalar(rows, weights, taps, out, c, end);
+}
+
+//==============================================================================
+//  #12 Mip Chain Filtering
+//==============================================================================
+
+void MipHorzPair_SSE(const short *src, short *dst, int dstWidth, const short *weights) {
+    (void)weights;
+    int x = 0;
+    for (; x + 2 <= dstWidth; x += 2) {
+        // Pixels 0..3 -> averages of (0, 1) and (2, 3)
+        const __m128i a = _mm_loadu_si128((const __m128i *)(src + x * 8));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(src + x * 8 + 8));
+        const __m128i avg = _mm_avg_epu16(_mm_unpacklo_epi64(a, b), _mm_unpackhi_epi64(a, b));
+        _mm_storeu_si128((__m128i *)(dst + x * 4), avg);
+    }
+    MipHorzPair_Scalar(src, dst, x, dstWidth);
+}
+
+void MipHorzThree_SSE(const short *src, short *dst, int dstWidth, const short *weights) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(16384);
+    for (int x = 0; x < dstWidth; ++x, src += 8, dst += 4, weights += 3) {
+        const __m128i p0 = _mm_loadl_epi64((const __m128i *)src);
+        const __m128i p1 = _mm_loadl_epi64((const __m128i *)(src + 4));
+        const __m128i p2 = _mm_loadl_epi64((const __m128i *)(src + 8));
+        __m128i sum = _mm_madd_epi16(_mm_unpacklo_epi16(p0, p1), ResampleWeightPair_SSE(weights[0], weights[1]));
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_unpacklo_epi16(p2, zero), ResampleWeightPair_SSE(weights[2], 0)));
+        sum = _mm_srai_epi32(_mm_add_epi32(sum, round), 15);
+        _mm_storel_epi64((__m128i *)dst, _mm_packs_epi32(sum, sum));
+    }
+}
+
+void MipVertPair_SSE(const short *const *rows, const short *weights, short *dst, int count) {
+    (void)weights;
+    int c = 0;
+    for (; c + 8 <= count; c += 8) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(rows[0] + c));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(rows[1] + c));
+        _mm_storeu_si128((__m128i *)(dst + c), _mm_avg_epu16(a, b));
+    }
+    MipVertPair_Scalar(rows, dst, c, count);
+}
+
+void MipVertThree_SSE(const short *const *rows, const short *weights, short *dst, int count) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(16384);
+    const __m128i w01 = ResampleWeightPair_SSE(weights[0], weights[1]);
+    const __m128i w2 = ResampleWeightPair_SSE(weights[2], 0);
+    int c = 0;
+    for (; c + 8 <= count; c += 8) {
+        const __m128i r0 = _mm_loadu_si128((const __m128i *)(rows[0] + c));
+        const __m128i r1 = _mm_loadu_si128((const __m128i *)(rows[1] + c));
+        const __m128i r2 = _mm_loadu_si128((const __m128i *)(rows[2] + c));
+        __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(r0, r1), w01),
+                                   _mm_madd_epi16(_mm_unpacklo_epi16(r2, zero), w2));
+        __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(r0, r1), w01),
+                                   _mm_madd_epi16(_mm_unpackhi_epi16(r2, zero), w2));
+        lo = _mm_srai_epi32(_mm_add_epi32(lo, round), 15);
+        hi = _mm_srai_epi32(_mm_add_epi32(hi, round), 15);
+        _mm_storeu_si128((__m128i *)(dst + c), _mm_packs_epi32(lo, hi));
+    }
+    MipVertThree_Scalar(rows, weights, dst, c, count);
+}
+
+// Vertical pair sums of four pixels -> the 2x2 sums of outputs (0, 1).
+static inline __m128i MipBoxSums_SSE(const XBYTE *row0, const XBYTE *row1) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i a = _mm_loadu_si128((const __m128i *)row0);
+    const __m128i b = _mm_loadu_si128((const __m128i *)row1);
+    const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+    const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+    return _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+}
+
+void MipBoxPair_SSE(const XBYTE *row0, const XBYTE *row1, XBYTE *dst, int dstWidth) {
+    const __m128i round = _mm_set1_epi16(2);
+    int x = 0;
+    for (; x + 4 <= dstWidth; x += 4) {
+        const __m128i s01 = _mm_srli_epi16(_mm_add_epi16(MipBoxSums_SSE(row0 + x * 8, row1 + x * 8), round), 2);
+        const __m128i s23 =
+            _mm_srli_epi16(_mm_add_epi16(MipBoxSums_SSE(row0 + x * 8 + 16, row1 + x * 8 + 16), round), 2);
+        _mm_storeu_si128((__m128i *)(dst + x * 4), _mm_packus_epi16(s01, s23));
+    }
+    MipBoxPair_Scalar(row0, row1, dst, x, dstWidth);
+}
+
+//==============================================================================
+//  #13 Ordered Dithering
+//==============================================================================
+
+void DitherAdd_SSE(const XBYTE *src, XBYTE *dst, int bytes, const XBYTE *pattern) {
+    const __m128i p0 = _mm_loadu_si128((const __m128i *)pattern);
+    const __m128i p1 = _mm_loadu_si128((const __m128i *)(pattern + 16));
+    const __m128i p2 = _mm_loadu_si128((const __m128i *)(pattern + 32));
+    int i = 0;
+    for (; i + DITHER_PATTERN_PERIOD <= bytes; i += DITHER_PATTERN_PERIOD) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(src + i + 16));
+        const __m128i c = _mm_loadu_si128((const __m128i *)(src + i + 32));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_adds_epu8(a, p0));
+        _mm_storeu_si128((__m128i *)(dst + i + 16), _mm_adds_epu8(b, p1));
+        _mm_storeu_si128((__m128i *)(dst + i + 32), _mm_adds_epu8(c, p2));
+    }
+    DitherAdd_Scalar(src, dst, i, bytes, pattern);
+}
+
+//==============================================================================
+//  #14 Compositing
+//
+//  Bytes are widened to 16 bits, combined as src * ws + dst * wd (at most
+//  255 * 255) and rounded back with x / 255 ~= (t + (t >> 8)) >> 8, t = x + 128.
+//==============================================================================
+
+static inline __m128i BlendDiv255_SSE(__m128i x) {
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+// Alpha of each pixel copied to its four 16-bit channel lanes.
+static inline __m128i BlendBroadcastAlpha_SSE(__m128i px16) {
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(px16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+// Straight SrcOver of two pixels widened to 16-bit lanes. Color lanes divide
+// m = s * sa + d * wd + oa / 2 by the output alpha oa through the factor rows
+// of g_SrcOverTable, corrected down by one where the estimate overshoots; the
+// alpha lane receives oa.
+static inline __m128i BlendSrcOver2_SSE(__m128i s16, __m128i d16) {
+    const XWORD (*factors)[8] = g_SrcOverTable.factors16;
+    const __m128i alphaLane = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i sa = BlendBroadcastAlpha_SSE(s16);
+    const __m128i wd = BlendDiv255_SSE(
+        _mm_mullo_epi16(BlendBroadcastAlpha_SSE(d16), _mm_xor_si128(sa, _mm_set1_epi16(0xFF))));
+    const __m128i oa = _mm_add_epi16(sa, wd);
+    const __m128i m = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(s16, sa), _mm_mullo_epi16(d16, wd)),
+                                    _mm_srli_epi16(oa, 1));
+
+    const __m128i f0 = _mm_load_si128((const __m128i *)factors[_mm_extract_epi16(oa, 0)]);
+    const __m128i f1 = _mm_load_si128((const __m128i *)factors[_mm_extract_epi16(oa, 4)]);
+    __m128i q = _mm_add_epi16(_mm_mullo_epi16(m, _mm_unpacklo_epi64(f0, f1)),
+                              _mm_mulhi_epu16(m, _mm_unpackhi_epi64(f0, f1)));
+    // q * oa <= 255 * 256 fits a lane; it exceeds m exactly where q is one too high.
+    const __m128i over = _mm_subs_epu16(_mm_mullo_epi16(q, oa), m);
+    q = _mm_sub_epi16(q, _mm_andnot_si128(_mm_cmpeq_epi16(over, _mm_setzero_si128()), _mm_set1_epi16(1)));
+    return _mm_or_si128(_mm_andnot_si128(alphaLane, q), _mm_and_si128(alphaLane, oa));
+}
+
+void BlendSrcOver_32_SSE(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+    int x = 0;
+
+    for (; x + 4 <= width; x += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + x));
+        // Runs of fully transparent or fully opaque pixels skip the arithmetic.
+        const __m128i sa = _mm_and_si128(s, alphaMask);
+        const __m128i transparent = _mm_cmpeq_epi32(sa, zero);
+        if (_mm_movemask_epi8(transparent) == 0xFFFF) continue;
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, alphaMask)) == 0xFFFF) {
+            _mm_storeu_si128((__m128i *)(dst + x), s);
+            continue;
+        }
+        const __m128i d = _mm_loadu_si128((const __m128i *)(dst + x));
+        const __m128i res = _mm_packus_epi16(BlendSrcOver2_SSE(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero)),
+                                             BlendSrcOver2_SSE(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero)));
+        // Transparent source pixels leave the destination untouched.
+        _mm_storeu_si128((__m128i *)(dst + x),
+                         _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, res)));
+    }
+
+    BlendSrcOver_32_Scalar(src, dst, x, width);
+}
+
+void BlendSrcOverPremultiplied_32_SSE(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+    const __m128i lane255 = _mm_set1_epi16(0xFF);
+    int x = 0;
+
+    for (; x + 4 <= width; x += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + x));
+        const __m128i sa = _mm_and_si128(s, alphaMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, alphaMask)) == 0xFFFF) {
+            _mm_storeu_si128((__m128i *)(dst + x), s);
+            continue;
+        }
+        const __m128i d = _mm_loadu_si128((const __m128i *)(dst + x));
+        const __m128i invLo = _mm_xor_si128(BlendBroadcastAlpha_SSE(_mm_unpacklo_epi8(s, zero)), lane255);
+        const __m128i invHi = _mm_xor_si128(BlendBroadcastAlpha_SSE(_mm_unpackhi_epi8(s, zero)), lane255);
+        const __m128i dLo = BlendDiv255_SSE(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), invLo));
+        const __m128i dHi = BlendDiv255_SSE(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), invHi));
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_adds_epu8(s, _mm_packus_epi16(dLo, dHi)));
+    }
+
+    BlendSrcOverPremultiplied_32_Scalar(src, dst, x, width);
+}
+
+void BlendAdd_32_SSE(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+    int x = 0;
+
+    for (; x + 4 <= width; x += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + x));
+        const __m128i d = _mm_loadu_si128((const __m128i *)(dst + x));
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_adds_epu8(s, d));
+    }
+
+    BlendAdd_32_Scalar(src, dst, x, width);
+}
+
+void BlendScreen_32_SSE(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    // s + d - s * d = ~(~s * ~d), with the same rounding as the scalar form.
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi32(-1);
+    int x = 0;
+
+    for (; x + 4 <= width; x += 4) {
+        const __m128i s = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(src + x)), ones);
+        const __m128i d = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(dst + x)), ones);
+        const __m128i lo = BlendDiv255_SSE(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero)));
+        const __m128i hi = BlendDiv255_SSE(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero)));
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_xor_si128(_mm_packus_epi16(lo, hi), ones));
+    }
+
+    BlendScreen_32_Scalar(src, dst, x, width);
+}
+
+void BlendLerp_32_SSE(const VxBlitInfo *info) {
+    const XDWORD *src = (const XDWORD *)info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+    const XDWORD factor = info->alphaValue;
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ws = _mm_set1_epi16((short)factor);
+    const __m128i wd = _mm_set1_epi16((short)(255 - factor));
+    int x = 0;
+
+    for (; x + 4 <= width; x += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + x));
+        const __m128i d = _mm_loadu_si128((const __m128i *)(dst + x));
+        const __m128i lo = BlendDiv255_SSE(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), ws),
+                                                         _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), wd)));
+        const __m128i hi = BlendDiv255_SSE(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), ws),
+                                                         _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), wd)));
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(lo, hi));
+    }
+
+    BlendLerp_32_Scalar(src, dst, x, width, factor);
+}
+
+//==============================================================================
+//  #15 YUV Conversion
+//
+//  PMADDWD evaluates the VxYUVCoefficients sums exactly: decoding pairs
+//  (y, 1) with (yScale, 4096) and (u, v) with the chroma weights; encoding
+//  pairs (B, G) and (R, A) of each pixel with the row weights.
+//==============================================================================
+
+struct YUVDecodeConstants_SSE {
+    __m128i luma;    // (yScale, 4096) pairs
+    __m128i toR;     // (0, vToR)
+    __m128i toG;     // (uToG, vToG)
+    __m128i toB;     // (uToB, 0)
+    __m128i lumaBias;
+    __m128i chromaBias;
+    __m128i one;
+    __m128i opaque;  // 0x00FF words: alpha bytes after packing
+
+    explicit YUVDecodeConstants_SSE(int matrix) {
+        const VxYUVCoefficients &k = g_YUVCoefficients[matrix];
+        luma = _mm_set1_epi32((4096 << 16) | (XWORD)k.yScale);
+        toR = _mm_set1_epi32(k.vToR << 16);
+        toG = _mm_set1_epi32((k.vToG << 16) | (XWORD)k.uToG);
+        toB = _mm_set1_epi32((XWORD)k.uToB);
+        lumaBias = _mm_set1_epi16(16);
+        chromaBias = _mm_set1_epi16(128);
+        one = _mm_set1_epi16(1);
+        opaque = _mm_set1_epi16(0xFF);
+    }
+};
+
+static inline __m128i YUVChannel_SSE(__m128i luma, __m128i uv, __m128i weights) {
+    return _mm_srai_epi32(_mm_add_epi32(luma, _mm_madd_epi16(uv, weights)), 13);
+}
+
+// Eight pixels from Y, U and V widened to 16 bits, one chroma value per pixel.
+static inline void DecodeYUV8_SSE(XDWORD *dst, __m128i y, __m128i u, __m128i v, const YUVDecodeConstants_SSE &k) {
+    y = _mm_sub_epi16(y, k.lumaBias);
+    u = _mm_sub_epi16(u, k.chromaBias);
+    v = _mm_sub_epi16(v, k.chromaBias);
+
+    const __m128i lumaLo = _mm_madd_epi16(_mm_unpacklo_epi16(y, k.one), k.luma);
+    const __m128i lumaHi = _mm_madd_epi16(_mm_unpackhi_epi16(y, k.one), k.luma);
+    const __m128i uvLo = _mm_unpacklo_epi16(u, v);
+    const __m128i uvHi = _mm_unpackhi_epi16(u, v);
+    const __m128i r = _mm_packs_epi32(YUVChannel_SSE(lumaLo, uvLo, k.toR), YUVChannel_SSE(lumaHi, uvHi, k.toR));
+    const __m128i g = _mm_packs_epi32(YUVChannel_SSE(lumaLo, uvLo, k.toG), YUVChannel_SSE(lumaHi, uvHi, k.toG));
+    const __m128i b = _mm_packs_epi32(YUVChannel_SSE(lumaLo, uvLo, k.toB), YUVChannel_SSE(lumaHi, uvHi, k.toB));
+
+    // Saturating packs clamp to [0, 255].
+    const __m128i br = _mm_packus_epi16(b, r);
+    const __m128i ga = _mm_packus_epi16(g, k.opaque);
+    const __m128i bg = _mm_unpacklo_epi8(br, ga);
+    const __m128i ra = _mm_unpackhi_epi8(br, ga);
+    _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi16(bg, ra));
+    _mm_storeu_si128((__m128i *)(dst + 4), _mm_unpackhi_epi16(bg, ra));
+}
+
+// [U0 V0 U1 V1 U2 V2 U3 V3] -> U and V for eight pixels.
+static inline void SplitChromaPairs_SSE(__m128i pairs, __m128i &u, __m128i &v) {
+    u = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pairs, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 2, 0, 0));
+    v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pairs, _MM_SHUFFLE(3, 3, 1, 1)), _MM_SHUFFLE(3, 3, 1, 1));
+}
+
+void DecodeYUVRow_I420_SSE(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width, int matrix) {
+    const YUVDecodeConstants_SSE k(matrix);
+    const __m128i zero = _mm_setzero_si128();
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        const __m128i luma = _mm_loadu_si128((const __m128i *)(y + x));
+        __m128i cb = _mm_loadl_epi64((const __m128i *)(u + x / 2));
+        __m128i cr = _mm_loadl_epi64((const __m128i *)(v + x / 2));
+        cb = _mm_unpacklo_epi8(cb, cb);
+        cr = _mm_unpacklo_epi8(cr, cr);
+        DecodeYUV8_SSE(dst + x, _mm_unpacklo_epi8(luma, zero), _mm_unpacklo_epi8(cb, zero),
+                       _mm_unpacklo_epi8(cr, zero), k);
+        DecodeYUV8_SSE(dst + x + 8, _mm_unpackhi_epi8(luma, zero), _mm_unpackhi_epi8(cb, zero),
+                       _mm_unpackhi_epi8(cr, zero), k);
+    }
+
+    DecodeYUVRow_I420_Scalar(y, u, v, dst, x, width, matrix);
+}
+
+void DecodeYUVRow_NV12_SSE(const XBYTE *y, const XBYTE *u, const XBYTE *, XDWORD *dst, int width, int matrix) {
+    const YUVDecodeConstants_SSE k(matrix);
+    const __m128i zero = _mm_setzero_si128();
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        const __m128i luma = _mm_loadu_si128((const __m128i *)(y + x));
+        const __m128i pairs = _mm_loadu_si128((const __m128i *)(u + x));
+        __m128i cb, cr;
+        SplitChromaPairs_SSE(_mm_unpacklo_epi8(pairs, zero), cb, cr);
+        DecodeYUV8_SSE(dst + x, _mm_unpacklo_epi8(luma, zero), cb, cr, k);
+        SplitChromaPairs_SSE(_mm_unpackhi_epi8(pairs, zero), cb, cr);
+        DecodeYUV8_SSE(dst + x + 8, _mm_unpackhi_epi8(luma, zero), cb, cr, k);
+    }
+
+    DecodeYUVRow_NV12_Scalar(y, u, dst, x, width, matrix);
+}
+
+void DecodeYUVRow_YUY2_SSE(const XBYTE *y, const XBYTE *, const XBYTE *, XDWORD *dst, int width, int matrix) {
+    const YUVDecodeConstants_SSE k(matrix);
+    const __m128i lumaMask = _mm_set1_epi16(0xFF);
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        const __m128i groups = _mm_loadu_si128((const __m128i *)(y + x * 2));
+        __m128i cb, cr;
+        SplitChromaPairs_SSE(_mm_srli_epi16(groups, 8), cb, cr);
+        DecodeYUV8_SSE(dst + x, _mm_and_si128(groups, lumaMask), cb, cr, k);
+    }
+
+    DecodeYUVRow_YUY2_Scalar(y, dst, x, width, matrix);
+}
+
+struct YUVEncodeConstants_SSE {
+    __m128i toY; // (B, G, R, 0) weights per pixel
+    __m128i toU;
+    __m128i toV;
+    __m128i lumaBias;
+    __m128i chromaBias;
+    __m128i two;
+
+    explicit YUVEncodeConstants_SSE(int matrix) {
+        const VxYUVCoefficients &k = g_YUVCoefficients[matrix];
+        toY = _mm_setr_epi16(k.toY[2], k.toY[1], k.toY[0], 0, k.toY[2], k.toY[1], k.toY[0], 0);
+        toU = _mm_setr_epi16(k.toU[2], k.toU[1], k.toU[0], 0, k.toU[2], k.toU[1], k.toU[0], 0);
+        toV = _mm_setr_epi16(k.toV[2], k.toV[1], k.toV[0], 0, k.toV[2], k.toV[1], k.toV[0], 0);
+        lumaBias = _mm_set1_epi32(128 + (16 << 8));
+        chromaBias = _mm_set1_epi32(128 + (128 << 8));
+        two = _mm_set1_epi16(2);
+    }
+};
+
+// [a0 b0 a1 b1], [a2 b2 a3 b3] -> [a0 + b0, a1 + b1, a2 + b2, a3 + b3]
+static inline __m128i SumPairs_SSE(__m128i m0, __m128i m1) {
+    const __m128 f0 = _mm_castsi128_ps(m0);
+    const __m128 f1 = _mm_castsi128_ps(m1);
+    return _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(f0, f1, _MM_SHUFFLE(2, 0, 2, 0))),
+                         _mm_castps_si128(_mm_shuffle_ps(f0, f1, _MM_SHUFFLE(3, 1, 3, 1))));
+}
+
+// (weights . pixel + bias) >> 8 for four pixels widened to 16 bits (two per register).
+static inline __m128i WeightedSum4_SSE(__m128i lo, __m128i hi, __m128i weights, __m128i bias) {
+    return _mm_srli_epi32(
+        _mm_add_epi32(SumPairs_SSE(_mm_madd_epi16(lo, weights), _mm_madd_epi16(hi, weights)), bias), 8);
+}
+
+static inline __m128i EncodeLuma4_SSE(__m128i pixels, const YUVEncodeConstants_SSE &k) {
+    const __m128i zero = _mm_setzero_si128();
+    return WeightedSum4_SSE(_mm_unpacklo_epi8(pixels, zero), _mm_unpackhi_epi8(pixels, zero), k.toY, k.lumaBias);
+}
+
+// 2x2 channel averages of four pixels from each row: two samples, 16-bit BGRA.
+static inline __m128i AverageQuads_SSE(__m128i row0, __m128i row1, const YUVEncodeConstants_SSE &k) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(row0, zero), _mm_unpacklo_epi8(row1, zero));
+    const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(row0, zero), _mm_unpackhi_epi8(row1, zero));
+    const __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+    return _mm_srli_epi16(_mm_add_epi16(sum, k.two), 2);
+}
+
+// Encodes sixteen pixels of two rows: luma to y0/y1, eight U and V values to cb/cr.
+static inline void EncodeYUV16_SSE(const XDWORD *src0, const XDWORD *src1, XBYTE *y0, XBYTE *y1, __m128i &cb,
+                                   __m128i &cr, const YUVEncodeConstants_SSE &k) {
+    __m128i avg[4];
+    __m128i luma0[4];
+    __m128i luma1[4];
+    for (int i = 0; i < 4; ++i) {
+        const __m128i p0 = _mm_loadu_si128((const __m128i *)(src0 + i * 4));
+        const __m128i p1 = _mm_loadu_si128((const __m128i *)(src1 + i * 4));
+        luma0[i] = EncodeLuma4_SSE(p0, k);
+        luma1[i] = EncodeLuma4_SSE(p1, k);
+        avg[i] = AverageQuads_SSE(p0, p1, k);
+    }
+    _mm_storeu_si128((__m128i *)y0, _mm_packus_epi16(_mm_packs_epi32(luma0[0], luma0[1]),
+                                                     _mm_packs_epi32(luma0[2], luma0[3])));
+    _mm_storeu_si128((__m128i *)y1, _mm_packus_epi16(_mm_packs_epi32(luma1[0], luma1[1]),
+                                                     _mm_packs_epi32(luma1[2], luma1[3])));
+
+    cb = _mm_packs_epi32(WeightedSum4_SSE(avg[0], avg[1], k.toU, k.chromaBias),
+                         WeightedSum4_SSE(avg[2], avg[3], k.toU, k.chromaBias));
+    cr = _mm_packs_epi32(WeightedSum4_SSE(avg[0], avg[1], k.toV, k.chromaBias),
+                         WeightedSum4_SSE(avg[2], avg[3], k.toV, k.chromaBias));
+}
+
+void EncodeYUVRows_I420_SSE(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1, XBYTE *u,
+                            XBYTE *v, int matrix) {
+    const YUVEncodeConstants_SSE k(matrix);
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        __m128i cb, cr;
+        EncodeYUV16_SSE(src0 + x, src1 + x, y0 + x, y1 + x, cb, cr, k);
+        const __m128i chroma = _mm_packus_epi16(cb, cr);
+        _mm_storel_epi64((__m128i *)(u + x / 2), chroma);
+        _mm_storel_epi64((__m128i *)(v + x / 2), _mm_srli_si128(chroma, 8));
+    }
+
+    EncodeYUVRows_Scalar(src0, src1, x, width, y0, y1, u, v, 1, matrix);
+}
+
+void EncodeYUVRows_NV12_SSE(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1, XBYTE *u,
+                            XBYTE *, int matrix) {
+    const YUVEncodeConstants_SSE k(matrix);
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        __m128i cb, cr;
+        EncodeYUV16_SSE(src0 + x, src1 + x, y0 + x, y1 + x, cb, cr, k);
+        _mm_storeu_si128((__m128i *)(u + x),
+                         _mm_packus_epi16(_mm_unpacklo_epi16(cb, cr), _mm_unpackhi_epi16(cb, cr)));
+    }
+
+    EncodeYUVRows_Scalar(src0, src1, x, width, y0, y1, u, u + 1, 2, matrix);
+}
+
+
+//==============================================================================
+//  #16 Normal and Bump Maps
+//
+//  Four columns per iteration on 32-bit heights. Gradient sums are exact in
+//  32-bit integers and normals use a true square root and division, so the
+//  output matches the scalar kernels bit for bit.
+//==============================================================================
+
+void HeightRowLuminance_SSE(const XDWORD *src, int *dst, int width, XDWORD, int) {
+    const __m128i byteMask = _mm_set1_epi32(0xFF);
+    int x = 0;
+
+    for (; x + 4 <= width; x += 4) {
+        const __m128i p = _mm_loadu_si128((const __m128i *)(src + x));
+        const __m128i b = _mm_and_si128(p, byteMask);
+        const __m128i g = _mm_and_si128(_mm_srli_epi32(p, 8), byteMask);
+        const __m128i r = _mm_and_si128(_mm_srli_epi32(p, 16), byteMask);
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_add_epi32(_mm_add_epi32(b, g), r));
+    }
+
+    HeightRowLuminance_Scalar(src, dst, x, width);
+}
+
+void HeightRowMasked_SSE(const XDWORD *src, int *dst, int width, XDWORD mask, int shift) {
+    const __m128i channel = _mm_set1_epi32((int)mask);
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    int x = 0;
+
+    for (; x + 4 <= width; x += 4) {
+        const __m128i p = _mm_loadu_si128((const __m128i *)(src + x));
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_srl_epi32(_mm_and_si128(p, channel), count));
+    }
+
+    HeightRowMasked_Scalar(src, dst, x, width, mask, shift);
+}
+
+static inline __m128i LoadHeights_SSE(const int *row, int x) {
+    return _mm_loadu_si128((const __m128i *)(row + x));
+}
+
+// (1, 2, 1) or (3, 10, 3) smoothing of three differences.
+template <int Filter>
+static inline __m128i Smooth3_SSE(__m128i outer0, __m128i center, __m128i outer1) {
+    const __m128i outer = _mm_add_epi32(outer0, outer1);
+    if (Filter == VX_GRADIENTFILTER_SOBEL) {
+        return _mm_add_epi32(outer, _mm_slli_epi32(center, 1));
+    }
+    return _mm_add_epi32(_mm_add_epi32(outer, _mm_slli_epi32(outer, 1)),
+                         _mm_add_epi32(_mm_slli_epi32(center, 3), _mm_slli_epi32(center, 1)));
+}
+
+// Gradient sums of columns x..x+3; x - 1 and x + 4 must be inside the row.
+template <int Filter>
+static inline void GradientSums_SSE(const int *a, const int *c, const int *b, int x, __m128i &gx, __m128i &gy) {
+    if (Filter == VX_GRADIENTFILTER_CENTRAL) {
+        gx = _mm_sub_epi32(LoadHeights_SSE(c, x + 1), LoadHeights_SSE(c, x - 1));
+        gy = _mm_sub_epi32(LoadHeights_SSE(b, x), LoadHeights_SSE(a, x));
+        return;
+    }
+    const __m128i al = LoadHeights_SSE(a, x - 1), am = LoadHeights_SSE(a, x), ar = LoadHeights_SSE(a, x + 1);
+    const __m128i cl = LoadHeights_SSE(c, x - 1), cr = LoadHeights_SSE(c, x + 1);
+    const __m128i bl = LoadHeights_SSE(b, x - 1), bm = LoadHeights_SSE(b, x), br = LoadHeights_SSE(b, x + 1);
+    gx = Smooth3_SSE<Filter>(_mm_sub_epi32(ar, al), _mm_sub_epi32(cr, cl), _mm_sub_epi32(br, bl));
+    gy = Smooth3_SSE<Filter>(_mm_sub_epi32(bl, al), _mm_sub_epi32(bm, am), _mm_sub_epi32(br, ar));
+}
+
+static inline __m128i NormalChannel_SSE(__m128 n, __m128 scale127, __m128 offset128) {
+    return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(n, scale127), offset128));
+}
+
+static inline void PackNormals_SSE(XDWORD *dst, __m128 dx, __m128 dy, __m128 height) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale127 = _mm_set1_ps(127.0f);
+    const __m128 offset128 = _mm_set1_ps(128.0f);
+
+    const __m128 lenSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), one);
+    const __m128 invLen = _mm_div_ps(one, _mm_sqrt_ps(lenSq));
+    const __m128i nx = NormalChannel_SSE(_mm_mul_ps(dx, invLen), scale127, offset128);
+    const __m128i ny = NormalChannel_SSE(_mm_mul_ps(dy, invLen), scale127, offset128);
+    const __m128i nz = NormalChannel_SSE(invLen, scale127, offset128);
+    const __m128i alpha = _mm_cvttps_epi32(_mm_mul_ps(height, _mm_set1_ps(-255.0f)));
+
+    __m128i packed = _mm_sub_epi32(nx, _mm_slli_epi32(alpha, 8));
+    packed = _mm_add_epi32(_mm_slli_epi32(packed, 8), ny);
+    packed = _mm_add_epi32(_mm_slli_epi32(packed, 8), nz);
+    _mm_storeu_si128((__m128i *)dst, packed);
+}
+
+template <int Filter>
+static void NormalMapRowT_SSE(const int *const *rows, XDWORD *dst, int width, float scale) {
+    const int *a = rows[0];
+    const int *c = rows[1];
+    const int *b = rows[2];
+    const __m128 heightScale = _mm_set1_ps(scale);
+    const __m128 gradientScale = _mm_set1_ps(scale * GradientNormalScale(Filter));
+    int x = 1;
+
+    NormalMapRow_Scalar(rows, dst, 0, XMin(1, width), width, scale, Filter);
+    for (; x + 5 <= width; x += 4) {
+        const __m128 h0 = _mm_mul_ps(_mm_cvtepi32_ps(LoadHeights_SSE(c, x)), heightScale);
+        __m128 dx, dy;
+        if (Filter == VX_GRADIENTFILTER_DEFAULT) {
+            dx = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(LoadHeights_SSE(c, x + 1)), heightScale), h0);
+            dy = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(LoadHeights_SSE(b, x)), heightScale), h0);
+        } else {
+            __m128i gx, gy;
+            GradientSums_SSE<Filter>(a, c, b, x, gx, gy);
+            dx = _mm_mul_ps(_mm_cvtepi32_ps(gx), gradientScale);
+            dy = _mm_mul_ps(_mm_cvtepi32_ps(gy), gradientScale);
+        }
+        PackNormals_SSE(dst + x, dx, dy, h0);
+    }
+    NormalMapRow_Scalar(rows, dst, x, width, width, scale, Filter);
+}
+
+void NormalMapRow_SSE(const int *const *rows, XDWORD *dst, int width, float scale, int filter) {
+    switch (filter) {
+        case VX_GRADIENTFILTER_CENTRAL: NormalMapRowT_SSE<VX_GRADIENTFILTER_CENTRAL>(rows, dst, width, scale); break;
+        case VX_GRADIENTFILTER_SOBEL: NormalMapRowT_SSE<VX_GRADIENTFILTER_SOBEL>(rows, dst, width, scale); break;
+        case VX_GRADIENTFILTER_SCHARR: NormalMapRowT_SSE<VX_GRADIENTFILTER_SCHARR>(rows, dst, width, scale); break;
+        default: NormalMapRowT_SSE<VX_GRADIENTFILTER_DEFAULT>(rows, dst, width, scale); break;
+    }
+}
+
+template <int Filter>
+static void BumpMapRowT_SSE(const int *const *rows, XDWORD *dst, int width) {
+    const int *a = rows[0];
+    const int *c = rows[1];
+    const int *b = rows[2];
+    const __m128i shift = _mm_cvtsi32_si128(GradientBumpShift(Filter));
+    const __m128i bias = _mm_set1_epi32((1 << GradientBumpShift(Filter)) >> 1);
+    const __m128i byteMask = _mm_set1_epi32(0xFF);
+    const __m128i dark = _mm_set1_epi32(1);
+    const __m128i flagDark = _mm_set1_epi32(127);
+    const __m128i flagToggle = _mm_set1_epi32(127 ^ 63);
+    int x = 1;
+
+    // Column 0 wraps (and carries the original first-column terms).
+    BumpMapRow_Scalar(rows, dst, 0, 1, width, Filter);
+    for (; x + 5 <= width; x += 4) {
+        __m128i gx, gy;
+        GradientSums_SSE<Filter == VX_GRADIENTFILTER_DEFAULT ? VX_GRADIENTFILTER_CENTRAL : Filter>(a, c, b, x, gx, gy);
+        const __m128i du = _mm_and_si128(_mm_sra_epi32(_mm_sub_epi32(bias, gy), shift), byteMask);
+        const __m128i dv = _mm_and_si128(_mm_sra_epi32(_mm_sub_epi32(bias, gx), shift), byteMask);
+        const __m128i bright = _mm_cmpgt_epi32(LoadHeights_SSE(c, x), dark);
+        const __m128i flag = _mm_xor_si128(flagDark, _mm_and_si128(bright, flagToggle));
+        const __m128i packed = _mm_or_si128(flag, _mm_or_si128(_mm_slli_epi32(du, 8), _mm_slli_epi32(dv, 16)));
+        _mm_storeu_si128((__m128i *)(dst + x), packed);
+    }
+    BumpMapRow_Scalar(rows, dst, x, width, width, Filter);
+}
+
+void BumpMapRow_SSE(const int *const *rows, XDWORD *dst, int width, int filter) {
+    switch (filter) {
+        case VX_GRADIENTFILTER_CENTRAL: BumpMapRowT_SSE<VX_GRADIENTFILTER_CENTRAL>(rows, dst, width); break;
+        case VX_GRADIENTFILTER_SOBEL: BumpMapRowT_SSE<VX_GRADIENTFILTER_SOBEL>(rows, dst, width); break;
+        case VX_GRADIENTFILTER_SCHARR: BumpMapRowT_SSE<VX_GRADIENTFILTER_SCHARR>(rows, dst, width); break;
+        default: BumpMapRowT_SSE<VX_GRADIENTFILTER_DEFAULT>(rows, dst, width); break;
+    }
+}
+
 #endif // VX_SIMD_SSE2
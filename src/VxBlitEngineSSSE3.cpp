@@ -12,8 +12,10 @@
 
 #if defined(VX_SIMD_SSE2)
 
+#if defined(VX_SIMD_X86)
 #include <emmintrin.h>  // SSE2
-#if defined(__SSSE3__) || defined(_MSC_VER)
+#endif
+#if defined(VX_SIMD_X86) && (defined(__SSSE3__) || defined(_MSC_VER))
 /* Include the native SSSE3 header only when the compiler generates real SSSE3
  * instructions (GCC/Clang with at least -mssse3, or any MSVC version which
  * always exposes intrinsic declarations regardless of /arch).
@@ -212,4 +214,85 @@ void CopyLine_32BGRA_32ARGB_SSE(const VxBlitInfo *info) {
     CopyLine_32ARGB_32BGRA_SSE(info); // Symmetric
 }
 
+//==============================================================================
+//  #3  Byte-Aligned Generic Layouts (shuffle derived in ResolveBlitFunction)
+//==============================================================================
+
+// One _mm_shuffle_epi8 per group of 16 / max(SrcBpp, DstBpp) pixels. Loads and
+// stores are a full 16 bytes, so the loop stops while both still end inside
+// the row; the bytes stored past the group are rewritten by the next group or
+// the scalar tail.
+template<int SrcBpp, int DstBpp>
+static void CopyLineShuffle_SSE(const VxBlitInfo *info) {
+    const int minBpp = SrcBpp < DstBpp ? SrcBpp : DstBpp;
+    const int maxBpp = SrcBpp > DstBpp ? SrcBpp : DstBpp;
+    const int group = 16 / maxBpp;
+    const int reach = (16 + minBpp - 1) / minBpp;
+    const XBYTE *src = info->srcLine;
+    XBYTE *dst = info->dstLine;
+    const int width = info->width;
+
+    const __m128i shufMask = _mm_loadu_si128((const __m128i *)info->byteShuffle);
+    int x = 0;
+
+    for (; x + reach <= width; x += group) {
+        __m128i pixels = _mm_loadu_si128((const __m128i *)(src + x * SrcBpp));
+        _mm_storeu_si128((__m128i *)(dst + x * DstBpp), _mm_shuffle_epi8(pixels, shufMask));
+    }
+
+    CopyLineShuffle_Scalar(info, x);
+}
+
+void CopyLineShuffle_8_8_SSE(const VxBlitInfo *info)   { CopyLineShuffle_SSE<1, 1>(info); }
+void CopyLineShuffle_8_16_SSE(const VxBlitInfo *info)  { CopyLineShuffle_SSE<1, 2>(info); }
+void CopyLineShuffle_8_24_SSE(const VxBlitInfo *info)  { CopyLineShuffle_SSE<1, 3>(info); }
+void CopyLineShuffle_8_32_SSE(const VxBlitInfo *info)  { CopyLineShuffle_SSE<1, 4>(info); }
+void CopyLineShuffle_16_8_SSE(const VxBlitInfo *info)  { CopyLineShuffle_SSE<2, 1>(info); }
+void CopyLineShuffle_16_16_SSE(const VxBlitInfo *info) { CopyLineShuffle_SSE<2, 2>(info); }
+void CopyLineShuffle_16_24_SSE(const VxBlitInfo *info) { CopyLineShuffle_SSE<2, 3>(info); }
+void CopyLineShuffle_16_32_SSE(const VxBlitInfo *info) { CopyLineShuffle_SSE<2, 4>(info); }
+void CopyLineShuffle_24_8_SSE(const VxBlitInfo *info)  { CopyLineShuffle_SSE<3, 1>(info); }
+void CopyLineShuffle_24_16_SSE(const VxBlitInfo *info) { CopyLineShuffle_SSE<3, 2>(info); }
+void CopyLineShuffle_24_24_SSE(const VxBlitInfo *info) { CopyLineShuffle_SSE<3, 3>(info); }
+void CopyLineShuffle_24_32_SSE(const VxBlitInfo *info) { CopyLineShuffle_SSE<3, 4>(info); }
+void CopyLineShuffle_32_8_SSE(const VxBlitInfo *info)  { CopyLineShuffle_SSE<4, 1>(info); }
+void CopyLineShuffle_32_16_SSE(const VxBlitInfo *info) { CopyLineShuffle_SSE<4, 2>(info); }
+void CopyLineShuffle_32_24_SSE(const VxBlitInfo *info) { CopyLineShuffle_SSE<4, 3>(info); }
+void CopyLineShuffle_32_32_SSE(const VxBlitInfo *info) { CopyLineShuffle_SSE<4, 4>(info); }
+
+//==============================================================================
+//  #4  Paletted -> Paletted Remap
+//==============================================================================
+
+void CopyLine_Paletted8_8_SSE(const VxBlitInfo *info) {
+    const XBYTE *remap = info->colorMap ? GetPaletteRemap(info) : nullptr;
+    if (!remap) {
+        memcpy(info->dstLine, info->srcLine, info->width);
+        return;
+    }
+
+    const XBYTE *src = info->srcLine;
+    XBYTE *dst = info->dstLine;
+    const int width = info->width;
+
+    // 256-entry byte lookup as 16 shuffles of 16 entries: entries of row h
+    // are selected while the high nibble, counted down, is zero. Adding 0x70
+    // with saturation sets bit 7 (shuffle -> 0) for every other row.
+    const __m128i rowStep = _mm_set1_epi8(0x10);
+    const __m128i selectBias = _mm_set1_epi8(0x70);
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m128i idx = _mm_loadu_si128((const __m128i *)(src + x));
+        __m128i out = _mm_setzero_si128();
+        for (int h = 0; h < 16; ++h) {
+            const __m128i row = _mm_loadu_si128((const __m128i *)(remap + h * 16));
+            out = _mm_or_si128(out, _mm_shuffle_epi8(row, _mm_adds_epu8(idx, selectBias)));
+            idx = _mm_sub_epi8(idx, rowStep);
+        }
+        _mm_storeu_si128((__m128i *)(dst + x), out);
+    }
+    CopyLine_Paletted8_8_Scalar(info, x, remap);
+}
+
 #endif // VX_SIMD_SSE2
@@ -7,12 +7,13 @@
  *
  * This header is private to the VxMath library implementation.  It is included
  * by VxBlitKernels.cpp, VxBlitEngineSSE2.cpp, VxBlitEngineSSSE3.cpp,
- * VxBlitEngineAVX2.cpp, and VxBlitEngineClass.cpp.  It must NOT be included
- * from any public header.
+ * VxBlitEngineAVX2.cpp, VxBlitEngineAVX512.cpp, and VxBlitEngineClass.cpp.
+ * It must NOT be included from any public header.
  */
 
 #include "VxBlitEngine.h"
 
+#include <cstdint>
 #include <cstring>
 
 //==============================================================================
@@ -84,6 +85,167 @@ static inline void WritePixel(XBYTE *ptr, int bpp, XDWORD pixel) {
     }
 }
 
+//==============================================================================
+// DXT (BC1-BC3) Block Helpers
+//
+// Palette construction is shared by the scalar and SIMD decoders so that every
+// tier produces bit-identical output; the tiers differ only in how the per-pixel
+// indices are expanded and stored.
+//==============================================================================
+
+/// Expand an RGB 565 color to opaque ARGB 8888 by bit replication.
+static inline XDWORD DXTExpand565(XDWORD c) {
+    const XDWORD r = (c >> 11) & 0x1F;
+    const XDWORD g = (c >> 5) & 0x3F;
+    const XDWORD b = c & 0x1F;
+    return 0xFF000000 | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+}
+
+/// Per-channel (w0 * c0 + w1 * c1) / (w0 + w1) on ARGB colors, alpha forced opaque.
+static inline XDWORD DXTBlendColor(XDWORD c0, XDWORD c1, int w0, int w1) {
+    const int div = w0 + w1;
+    XDWORD out = 0xFF000000;
+    for (int shift = 0; shift < 24; shift += 8) {
+        const int v = (w0 * (int)((c0 >> shift) & 0xFF) + w1 * (int)((c1 >> shift) & 0xFF)) / div;
+        out |= (XDWORD)v << shift;
+    }
+    return out;
+}
+
+/**
+ * @brief Build the 4-entry ARGB palette of a BC1 color block.
+ * @param block 8-byte color block (two 565 endpoints followed by 2-bit indices).
+ * @param allowPunchThrough TRUE for DXT1 semantics: when c0 <= c1 the block has
+ *        three colors plus transparent black. DXT2-5 always use four colors.
+ * @param palette Receives the four colors.
+ */
+static inline void DXTBuildColorPalette(const XBYTE *block, bool allowPunchThrough, XDWORD palette[4]) {
+    const XDWORD c0 = block[0] | (block[1] << 8);
+    const XDWORD c1 = block[2] | (block[3] << 8);
+    palette[0] = DXTExpand565(c0);
+    palette[1] = DXTExpand565(c1);
+    if (c0 > c1 || !allowPunchThrough) {
+        palette[2] = DXTBlendColor(palette[0], palette[1], 2, 1);
+        palette[3] = DXTBlendColor(palette[0], palette[1], 1, 2);
+    } else {
+        palette[2] = DXTBlendColor(palette[0], palette[1], 1, 1);
+        palette[3] = 0;
+    }
+}
+
+/// Build the 8-entry alpha palette of a BC3 alpha block (alpha in bits 24-31).
+static inline void DXTBuildAlphaPalette(const XBYTE *block, XDWORD palette[8]) {
+    const int a0 = block[0];
+    const int a1 = block[1];
+    palette[0] = (XDWORD)a0 << 24;
+    palette[1] = (XDWORD)a1 << 24;
+    if (a0 > a1) {
+        for (int i = 1; i <= 6; ++i) {
+            palette[i + 1] = (XDWORD)(((7 - i) * a0 + i * a1) / 7) << 24;
+        }
+    } else {
+        for (int i = 1; i <= 4; ++i) {
+            palette[i + 1] = (XDWORD)(((5 - i) * a0 + i * a1) / 5) << 24;
+        }
+        palette[6] = 0;
+        palette[7] = 0xFF000000;
+    }
+}
+
+/// Read the 48 bits of 3-bit indices of a BC3 alpha block.
+static inline uint64_t DXTReadAlphaIndices(const XBYTE *block) {
+    uint64_t bits = 0;
+    for (int i = 7; i >= 2; --i) {
+        bits = (bits << 8) | block[i];
+    }
+    return bits;
+}
+
+/// Quantize an 8-bit-per-channel ARGB color to RGB 565 with rounding.
+static inline XDWORD DXTQuantize565(XDWORD color) {
+    const XDWORD r = (((color >> 16) & 0xFF) * 31 + 127) / 255;
+    const XDWORD g = (((color >> 8) & 0xFF) * 63 + 127) / 255;
+    const XDWORD b = ((color & 0xFF) * 31 + 127) / 255;
+    return (r << 11) | (g << 5) | b;
+}
+
+/**
+ * @brief Per-tier building blocks of the DXT block encoder.
+ *
+ * Endpoint fitting is shared (EncodeDXTBlockRow in VxBlitKernels.cpp); the
+ * tiers supply the data-parallel steps. Every implementation must return the
+ * same results as the scalar one, so the encoded output does not depend on the
+ * active SIMD tier.
+ */
+struct DXTEncodeOps {
+    /// Per-byte minimum and maximum over the 16 ARGB pixels of a block.
+    void (*computeBounds)(const XDWORD pixels[16], XDWORD &minColor, XDWORD &maxColor);
+
+    /**
+     * Nearest palette entry (squared RGB distance, lowest index on ties) for
+     * every pixel, considering the first @p entryCount entries only.
+     * Returns the summed squared error; indices are packed 2 bits per pixel.
+     */
+    XDWORD (*selectColorIndices)(const XDWORD pixels[16], const XDWORD palette[4], int entryCount,
+                                 XDWORD &indices);
+
+    /**
+     * Nearest alpha palette entry (alpha in bits 24-31, lowest index on ties)
+     * for every pixel. Returns the summed squared error; indices are packed
+     * 3 bits per pixel.
+     */
+    XDWORD (*selectAlphaIndices)(const XDWORD pixels[16], const XDWORD palette[8], uint64_t &indices);
+};
+
+/**
+ * @brief Encodes a row of 4x4 blocks from four rows of ARGB 8888 pixels.
+ * @param src First pixel of the block row (4 * blockCount pixels per row).
+ * @param srcPitch Bytes between source rows.
+ * @param blockCount Number of blocks.
+ * @param blocks Receives blockCount encoded blocks.
+ * @param format _DXT1, _DXT3 or _DXT5.
+ * @param highQuality TRUE for cluster fit, FALSE for range fit.
+ * @param ops Tier building blocks.
+ */
+void EncodeDXTBlockRow(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks, VX_PIXELFORMAT format,
+                       bool highQuality, const DXTEncodeOps &ops);
+
+#if defined(VX_SIMD_SSE2)
+#if defined(VX_SIMD_X86)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief SSE2 form of DXTBuildColorPalette(): the four colors in lanes 0-3.
+ *
+ * Interpolation runs on 16-bit channels; floor(x / 3) is computed as
+ * (x * 0xAAAB) >> 17, which is exact for every x <= 765, so the result is
+ * bit-identical to the scalar builder.
+ */
+static inline __m128i DXTBuildColorPalette_SSE2(const XBYTE *block, bool allowPunchThrough) {
+    const XDWORD c0 = block[0] | (block[1] << 8);
+    const XDWORD c1 = block[2] | (block[3] << 8);
+    const __m128i endpoints = _mm_setr_epi32((int)DXTExpand565(c0), (int)DXTExpand565(c1), 0, 0);
+    const __m128i zero = _mm_setzero_si128();
+
+    // ends = [c0 | c1] and swapped = [c1 | c0] as 16-bit channels.
+    const __m128i ends = _mm_unpacklo_epi8(endpoints, zero);
+    const __m128i swapped = _mm_shuffle_epi32(ends, _MM_SHUFFLE(1, 0, 3, 2));
+    const __m128i sum = _mm_add_epi16(ends, swapped);
+
+    __m128i mixed;
+    if (c0 > c1 || !allowPunchThrough) {
+        // [2*c0 + c1 | c0 + 2*c1] / 3
+        const __m128i num = _mm_add_epi16(sum, ends);
+        mixed = _mm_srli_epi16(_mm_mulhi_epu16(num, _mm_set1_epi16((short)0xAAAB)), 1);
+    } else {
+        // [(c0 + c1) / 2 | transparent black]
+        mixed = _mm_unpacklo_epi64(_mm_srli_epi16(sum, 1), zero);
+    }
+    return _mm_unpacklo_epi64(endpoints, _mm_packus_epi16(mixed, zero));
+}
+#endif // VX_SIMD_SSE2
+
 //==============================================================================
 // Pixel Format Table (shared definition)
 //==============================================================================
@@ -138,6 +300,113 @@ static const int NUM_PIXEL_FORMATS = sizeof(s_PixelFormats) / sizeof(s_PixelForm
 /// Number of blittable (non-DXT/non-bump) formats: indices 0-18.
 static const int NUM_BLITTABLE_FORMATS = 19;
 
+//==============================================================================
+// Converted palettes shared by the scalar and SIMD paletted kernels
+// (defined in VxBlitKernels.cpp)
+//
+// Cached per thread and per operation stamp; valid until the next call on the
+// same thread with a different stamp.
+//==============================================================================
+
+/// 256 ARGB colors of info->colorMap (alpha 0xFF for 3-byte entries).
+const XDWORD *GetPaletteARGB(const VxBlitInfo *info);
+
+/// 256 colors of info->colorMap packed into the 16-bit destination masks,
+/// one per XDWORD.
+const XDWORD *GetPalette16(const VxBlitInfo *info);
+
+/// Nearest info->dstColorMap index for each source index, or NULL when the
+/// indices can be copied as they are.
+const XBYTE *GetPaletteRemap(const VxBlitInfo *info);
+
+//==============================================================================
+// Unpremultiply reciprocals shared by every tier (defined in VxBlitKernels.cpp)
+//
+// For alpha a > 0, reciprocal[a] = ceil(255 * 65536 / a). Then
+// (c * reciprocal[a]) >> 16 == floor(c * 255 / a) for every c < a, because the
+// rounding error c / 65536 stays below the 1 / a gap to the next integer; for
+// c >= a both sides are >= 255 and clamp to 255. Entry 0 is 0, so transparent
+// pixels clear without a branch, and c * reciprocal[a] always fits in 32 bits.
+//==============================================================================
+
+struct VxUnpremultiplyTable {
+    XDWORD reciprocal[256];
+    /// reciprocal[a] split for 16-bit lanes, laid out as one ARGB pixel:
+    /// {hi, hi, hi, 1, lo, lo, lo, 0}. c * hi + mulhi(c, lo) is the unclamped
+    /// quotient, and the alpha lane passes through.
+    alignas(16) XWORD factors16[256][8];
+};
+
+extern const VxUnpremultiplyTable g_UnpremultiplyTable;
+
+//==============================================================================
+// Straight-alpha SrcOver divisors for the SIMD tiers (defined in VxBlitKernels.cpp)
+//
+// Color channels are m / oa with m = s * sa + d * wd + oa / 2 <= 255 * oa + 127,
+// where wd = da * (255 - sa) / 255 and oa = sa + wd is the output alpha. For
+// r = ceil(65536 / oa), (m * r) >> 16 is floor(m / oa) or one more, since the
+// rounding error m / 65536 stays below 1; subtracting one where q * oa > m
+// makes it exact, so every tier matches the scalar division. Entry 0 is 0.
+//==============================================================================
+
+struct VxSrcOverTable {
+    /// ceil(65536 / a) split for 16-bit lanes, laid out as one ARGB pixel:
+    /// {hi, hi, hi, 0, lo, lo, lo, 0}. m * hi + mulhi(m, lo) is the estimate;
+    /// only a = 1 has hi set.
+    alignas(16) XWORD factors16[256][8];
+};
+
+extern const VxSrcOverTable g_SrcOverTable;
+
+//==============================================================================
+// YUV coefficients shared by every tier (defined in VxBlitKernels.cpp)
+//
+// Studio range. Decoding works in 13-bit fixed point on y = Y - 16,
+// u = U - 128 and v = V - 128, each channel clamped to [0, 255]:
+//   R = (yScale * y + vToR * v + 4096) >> 13
+//   G = (yScale * y + uToG * u + vToG * v + 4096) >> 13
+//   B = (yScale * y + uToB * u + 4096) >> 13
+// Encoding works in 8-bit fixed point; chroma uses the 2x2 average
+// (sum + 2) >> 2 of each channel, and the biases keep every sum positive:
+//   Y = (toY . RGB + 128 + (16 << 8)) >> 8
+//   U = (toU . RGB + 128 + (128 << 8)) >> 8, V likewise
+// The SIMD kernels evaluate the same sums (PMADDWD pairs fit every product),
+// so all tiers are bit-identical.
+//==============================================================================
+
+struct VxYUVCoefficients {
+    short yScale;
+    short vToR;
+    short uToG;
+    short vToG;
+    short uToB;
+    short toY[3]; ///< R, G, B weights
+    short toU[3];
+    short toV[3];
+};
+
+/// Indexed by VX_YUVMATRIX.
+extern const VxYUVCoefficients g_YUVCoefficients[2];
+
+//==============================================================================
+// Gradient operator scaling shared by the normal and bump map kernels
+// (operators are documented in VxBlitKernels.cpp, Section 18)
+//==============================================================================
+
+/// Factor taking a normal map gradient sum to the slope of a one-pixel difference.
+static inline float GradientNormalScale(int filter) {
+    if (filter == VX_GRADIENTFILTER_SOBEL) return 1.0f / 8.0f;
+    if (filter == VX_GRADIENTFILTER_SCHARR) return 1.0f / 32.0f;
+    return 0.5f;
+}
+
+/// Right shift taking a bump map gradient sum to the central-difference range.
+static inline int GradientBumpShift(int filter) {
+    if (filter == VX_GRADIENTFILTER_SOBEL) return 2;
+    if (filter == VX_GRADIENTFILTER_SCHARR) return 4;
+    return 0;
+}
+
 //==============================================================================
 // Forward declarations -- scalar tail-loop functions (defined in VxBlitKernels.cpp)
 //
@@ -161,6 +430,8 @@ void CopyLine_32ARGB_32ABGR_Scalar(const VxBlitInfo *info, int startX);
 void CopyLine_32ARGB_32RGBA_Scalar(const VxBlitInfo *info, int startX);
 void CopyLine_32RGBA_32ARGB_Scalar(const VxBlitInfo *info, int startX);
 void CopyLine_32ARGB_32BGRA_Scalar(const VxBlitInfo *info, int startX);
+void CopyLineShuffle_Scalar(const VxBlitInfo *info, int startX);
+void CopyLine_Paletted8_8_Scalar(const VxBlitInfo *info, int startX, const XBYTE *remap);
 
 // --- Alpha / image-operation tail variants -----------------------------------
 void PremultiplyAlpha_32ARGB_Scalar(const VxBlitInfo *info, int startX);
@@ -172,10 +443,30 @@ void SetFullAlpha_32_Scalar(XDWORD *dst, int startX, int width);
 void InvertColors_32_Scalar(XDWORD *dst, int startX, int width);
 void Grayscale_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int width);
 void MultiplyBlend_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int width);
+void BlendSrcOver_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int width);
+void BlendSrcOverPremultiplied_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int width);
+void BlendAdd_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int width);
+void BlendScreen_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int width);
+void BlendLerp_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int width, XDWORD factor);
 void SetAlpha_32_Scalar(XDWORD *dst, int startX, int width, XDWORD alphaValue, XDWORD alphaMaskInv);
 void CopyAlpha_32_Scalar(const XBYTE *src, XDWORD *dst, int startX, int width,
                           int alphaShift, XDWORD alphaMask, XDWORD alphaMaskInv);
 
+// --- YUV tail variants (startX even) -----------------------------------------
+void DecodeYUVRow_I420_Scalar(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int startX, int width,
+                              int matrix);
+void DecodeYUVRow_NV12_Scalar(const XBYTE *y, const XBYTE *uv, XDWORD *dst, int startX, int width, int matrix);
+void DecodeYUVRow_YUY2_Scalar(const XBYTE *yuyv, XDWORD *dst, int startX, int width, int matrix);
+void EncodeYUVRows_Scalar(const XDWORD *src0, const XDWORD *src1, int startX, int width, XBYTE *y0, XBYTE *y1,
+                          XBYTE *u, XBYTE *v, int uvStep, int matrix);
+
+// --- Normal / bump map tail variants (columns [startX, endX) of width) -------
+void HeightRowLuminance_Scalar(const XDWORD *src, int *dst, int startX, int width);
+void HeightRowMasked_Scalar(const XDWORD *src, int *dst, int startX, int width, XDWORD mask, int shift);
+void NormalMapRow_Scalar(const int *const *rows, XDWORD *dst, int startX, int endX, int width, float scale,
+                         int filter);
+void BumpMapRow_Scalar(const int *const *rows, XDWORD *dst, int startX, int endX, int width, int filter);
+
 //==============================================================================
 // Forward declarations -- scalar dispatch-table entries (VxBlitKernels.cpp)
 //
@@ -201,6 +492,24 @@ void CopyLineGeneric_32_16(const VxBlitInfo *i);
 void CopyLineGeneric_32_24(const VxBlitInfo *i);
 void CopyLineGeneric_32_32(const VxBlitInfo *i);
 
+// Byte-shuffle blit functions for byte-aligned channel layouts
+void CopyLineShuffle_8_8(const VxBlitInfo *i);
+void CopyLineShuffle_8_16(const VxBlitInfo *i);
+void CopyLineShuffle_8_24(const VxBlitInfo *i);
+void CopyLineShuffle_8_32(const VxBlitInfo *i);
+void CopyLineShuffle_16_8(const VxBlitInfo *i);
+void CopyLineShuffle_16_16(const VxBlitInfo *i);
+void CopyLineShuffle_16_24(const VxBlitInfo *i);
+void CopyLineShuffle_16_32(const VxBlitInfo *i);
+void CopyLineShuffle_24_8(const VxBlitInfo *i);
+void CopyLineShuffle_24_16(const VxBlitInfo *i);
+void CopyLineShuffle_24_24(const VxBlitInfo *i);
+void CopyLineShuffle_24_32(const VxBlitInfo *i);
+void CopyLineShuffle_32_8(const VxBlitInfo *i);
+void CopyLineShuffle_32_16(const VxBlitInfo *i);
+void CopyLineShuffle_32_24(const VxBlitInfo *i);
+void CopyLineShuffle_32_32(const VxBlitInfo *i);
+
 // Specific format conversions (scalar optimised)
 void CopyLine_32ARGB_32RGB(const VxBlitInfo *info);
 void CopyLine_32RGB_32ARGB(const VxBlitInfo *info);
@@ -224,8 +533,7 @@ void CopyLine_32BGRA_32ARGB(const VxBlitInfo *info);
 // Paletted conversions
 void CopyLine_Paletted8_32ARGB(const VxBlitInfo *info);
 void CopyLine_Paletted8_24RGB(const VxBlitInfo *info);
-void CopyLine_Paletted8_565RGB(const VxBlitInfo *info);
-void CopyLine_Paletted8_16Alpha(const VxBlitInfo *info);
+void CopyLine_Paletted8_16(const VxBlitInfo *info);
 void CopyLine_Paletted8_8(const VxBlitInfo *info);
 
 // Alpha operations (scalar)
@@ -240,6 +548,65 @@ void CopyAlpha_32(const VxBlitInfo *info);
 void PremultiplyAlpha_32ARGB(const VxBlitInfo *info);
 void UnpremultiplyAlpha_32ARGB(const VxBlitInfo *info);
 
+// DXT block-row decoders
+void DecodeBlocks_DXT1(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch);
+void DecodeBlocks_DXT3(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch);
+void DecodeBlocks_DXT5(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch);
+
+// DXT block-row encoders (range fit / cluster fit)
+void EncodeBlocks_DXT1_Fast(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+void EncodeBlocks_DXT1_High(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+void EncodeBlocks_DXT3_Fast(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+void EncodeBlocks_DXT3_High(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+void EncodeBlocks_DXT5_Fast(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+void EncodeBlocks_DXT5_High(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+
+// Separable resampling passes
+void ResampleHorz_32(const XDWORD *src, short *dst, int dstWidth, const int *first, const short *weights, int taps);
+void ResampleVert_32(const short *const *rows, const short *weights, int taps, XDWORD *dst, int width);
+void ResampleVert_32_Scalar(const short *const *rows, const short *weights, int taps, XBYTE *dst, int start,
+                            int end);
+
+// Mip chain passes on rows of four 15-bit channels per pixel
+void MipHorzPair(const short *src, short *dst, int dstWidth, const short *weights);
+void MipHorzThree(const short *src, short *dst, int dstWidth, const short *weights);
+void MipVertPair(const short *const *rows, const short *weights, short *dst, int count);
+void MipVertThree(const short *const *rows, const short *weights, short *dst, int count);
+void MipHorzPair_Scalar(const short *src, short *dst, int start, int dstWidth);
+void MipVertPair_Scalar(const short *const *rows, short *dst, int start, int count);
+void MipVertThree_Scalar(const short *const *rows, const short *weights, short *dst, int start, int count);
+void MipBoxPair(const XBYTE *row0, const XBYTE *row1, XBYTE *dst, int dstWidth);
+void MipBoxPair_Scalar(const XBYTE *row0, const XBYTE *row1, XBYTE *dst, int start, int dstWidth);
+
+// Ordered dithering: saturating add of a pattern of DITHER_PATTERN_PERIOD
+// bytes, stored twice (2 * DITHER_PATTERN_PERIOD bytes)
+static const int DITHER_PATTERN_PERIOD = 48;
+void DitherAdd(const XBYTE *src, XBYTE *dst, int bytes, const XBYTE *pattern);
+void DitherAdd_Scalar(const XBYTE *src, XBYTE *dst, int start, int bytes, const XBYTE *pattern);
+
+// Compositing (dispatch-table form; BlendLerp reads its factor from alphaValue)
+void MultiplyBlend_32(const VxBlitInfo *info);
+void BlendSrcOver_32(const VxBlitInfo *info);
+void BlendSrcOverPremultiplied_32(const VxBlitInfo *info);
+void BlendAdd_32(const VxBlitInfo *info);
+void BlendScreen_32(const VxBlitInfo *info);
+void BlendLerp_32(const VxBlitInfo *info);
+
+// YUV row converters
+void DecodeYUVRow_I420(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width, int matrix);
+void DecodeYUVRow_NV12(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width, int matrix);
+void DecodeYUVRow_YUY2(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width, int matrix);
+void EncodeYUVRows_I420(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1, XBYTE *u,
+                        XBYTE *v, int matrix);
+void EncodeYUVRows_NV12(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1, XBYTE *u,
+                        XBYTE *v, int matrix);
+
+// Normal and bump map rows
+void HeightRowLuminance(const XDWORD *src, int *dst, int width, XDWORD mask, int shift);
+void HeightRowMasked(const XDWORD *src, int *dst, int width, XDWORD mask, int shift);
+void NormalMapRow(const int *const *rows, XDWORD *dst, int width, float scale, int filter);
+void BumpMapRow(const int *const *rows, XDWORD *dst, int width, int filter);
+
 // Resize functions
 void ResizeHLine_EqualY_EqualX_32Bpp(const VxResizeInfo *info);
 void ResizeHLine_EqualY_ShrinkX_32Bpp(const VxResizeInfo *info);
@@ -279,6 +646,40 @@ void SetFullAlpha_32_SSE(const VxBlitInfo *info);
 void InvertColors_32_SSE(const VxBlitInfo *info);
 void Grayscale_32_SSE(const VxBlitInfo *info);
 void MultiplyBlend_32_SSE(const VxBlitInfo *info);
+void DecodeBlocks_DXT1_SSE(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch);
+void DecodeBlocks_DXT3_SSE(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch);
+void DecodeBlocks_DXT5_SSE(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch);
+void EncodeBlocks_DXT1_Fast_SSE(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+void EncodeBlocks_DXT1_High_SSE(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+void EncodeBlocks_DXT3_Fast_SSE(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+void EncodeBlocks_DXT3_High_SSE(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+void EncodeBlocks_DXT5_Fast_SSE(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+void EncodeBlocks_DXT5_High_SSE(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks);
+void ResampleHorz_32_SSE(const XDWORD *src, short *dst, int dstWidth, const int *first, const short *weights,
+                         int taps);
+void ResampleVert_32_SSE(const short *const *rows, const short *weights, int taps, XDWORD *dst, int width);
+void MipHorzPair_SSE(const short *src, short *dst, int dstWidth, const short *weights);
+void MipHorzThree_SSE(const short *src, short *dst, int dstWidth, const short *weights);
+void MipVertPair_SSE(const short *const *rows, const short *weights, short *dst, int count);
+void MipVertThree_SSE(const short *const *rows, const short *weights, short *dst, int count);
+void MipBoxPair_SSE(const XBYTE *row0, const XBYTE *row1, XBYTE *dst, int dstWidth);
+void DitherAdd_SSE(const XBYTE *src, XBYTE *dst, int bytes, const XBYTE *pattern);
+void BlendSrcOver_32_SSE(const VxBlitInfo *info);
+void BlendSrcOverPremultiplied_32_SSE(const VxBlitInfo *info);
+void BlendAdd_32_SSE(const VxBlitInfo *info);
+void BlendScreen_32_SSE(const VxBlitInfo *info);
+void BlendLerp_32_SSE(const VxBlitInfo *info);
+void DecodeYUVRow_I420_SSE(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width, int matrix);
+void DecodeYUVRow_NV12_SSE(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width, int matrix);
+void DecodeYUVRow_YUY2_SSE(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width, int matrix);
+void EncodeYUVRows_I420_SSE(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1, XBYTE *u,
+                            XBYTE *v, int matrix);
+void EncodeYUVRows_NV12_SSE(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1, XBYTE *u,
+                            XBYTE *v, int matrix);
+void HeightRowLuminance_SSE(const XDWORD *src, int *dst, int width, XDWORD mask, int shift);
+void HeightRowMasked_SSE(const XDWORD *src, int *dst, int width, XDWORD mask, int shift);
+void NormalMapRow_SSE(const int *const *rows, XDWORD *dst, int width, float scale, int filter);
+void BumpMapRow_SSE(const int *const *rows, XDWORD *dst, int width, int filter);
 
 // SSSE3 kernels -- compiled with SSE2+SIMDe; installed only when hasSSSE3
 // (VxBlitEngineSSSE3.cpp)
@@ -290,6 +691,23 @@ void CopyLine_32ARGB_32RGBA_SSE(const VxBlitInfo *info);
 void CopyLine_32RGBA_32ARGB_SSE(const VxBlitInfo *info);
 void CopyLine_32ARGB_32BGRA_SSE(const VxBlitInfo *info);
 void CopyLine_32BGRA_32ARGB_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_8_8_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_8_16_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_8_24_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_8_32_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_16_8_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_16_16_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_16_24_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_16_32_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_24_8_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_24_16_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_24_24_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_24_32_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_32_8_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_32_16_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_32_24_SSE(const VxBlitInfo *info);
+void CopyLineShuffle_32_32_SSE(const VxBlitInfo *info);
+void CopyLine_Paletted8_8_SSE(const VxBlitInfo *info);
 #endif // VX_SIMD_SSE2
 
 //==============================================================================
@@ -308,6 +726,9 @@ void CopyLine_32BGRA_32ARGB_AVX2(const VxBlitInfo *info);
 void CopyLine_32ARGB_24RGB_AVX2(const VxBlitInfo *info);
 void CopyLine_24RGB_32ARGB_AVX2(const VxBlitInfo *info);
 void CopyLine_Paletted8_32ARGB_AVX2(const VxBlitInfo *info);
+void CopyLine_Paletted8_24RGB_AVX2(const VxBlitInfo *info);
+void CopyLine_Paletted8_16_AVX2(const VxBlitInfo *info);
+void CopyLine_Paletted8_8_AVX2(const VxBlitInfo *info);
 void CopyLine_32ARGB_565RGB_AVX2(const VxBlitInfo *info);
 void CopyLine_32ARGB_555RGB_AVX2(const VxBlitInfo *info);
 void CopyLine_32ARGB_1555ARGB_AVX2(const VxBlitInfo *info);
@@ -327,6 +748,66 @@ void Grayscale_32_AVX2(const VxBlitInfo *info);
 void SetAlpha_32_AVX2(const VxBlitInfo *info);
 void CopyAlpha_32_AVX2(const VxBlitInfo *info);
 void MultiplyBlend_32_AVX2(const VxBlitInfo *info);
+void DecodeBlocks_DXT1_AVX2(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch);
+void DecodeBlocks_DXT3_AVX2(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch);
+void DecodeBlocks_DXT5_AVX2(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch);
+void ResampleHorz_32_AVX2(const XDWORD *src, short *dst, int dstWidth, const int *first, const short *weights,
+                          int taps);
+void ResampleVert_32_AVX2(const short *const *rows, const short *weights, int taps, XDWORD *dst, int width);
+void MipHorzPair_AVX2(const short *src, short *dst, int dstWidth, const short *weights);
+void MipVertPair_AVX2(const short *const *rows, const short *weights, short *dst, int count);
+void MipVertThree_AVX2(const short *const *rows, const short *weights, short *dst, int count);
+void MipBoxPair_AVX2(const XBYTE *row0, const XBYTE *row1, XBYTE *dst, int dstWidth);
+void DitherAdd_AVX2(const XBYTE *src, XBYTE *dst, int bytes, const XBYTE *pattern);
+void BlendSrcOver_32_AVX2(const VxBlitInfo *info);
+void BlendSrcOverPremultiplied_32_AVX2(const VxBlitInfo *info);
+void BlendAdd_32_AVX2(const VxBlitInfo *info);
+void BlendScreen_32_AVX2(const VxBlitInfo *info);
+void BlendLerp_32_AVX2(const VxBlitInfo *info);
+void DecodeYUVRow_I420_AVX2(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width, int matrix);
+void DecodeYUVRow_NV12_AVX2(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width, int matrix);
+void DecodeYUVRow_YUY2_AVX2(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width, int matrix);
+void EncodeYUVRows_I420_AVX2(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1, XBYTE *u,
+                             XBYTE *v, int matrix);
+void EncodeYUVRows_NV12_AVX2(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1, XBYTE *u,
+                             XBYTE *v, int matrix);
+void HeightRowLuminance_AVX2(const XDWORD *src, int *dst, int width, XDWORD mask, int shift);
+void HeightRowMasked_AVX2(const XDWORD *src, int *dst, int width, XDWORD mask, int shift);
+void NormalMapRow_AVX2(const int *const *rows, XDWORD *dst, int width, float scale, int filter);
+void BumpMapRow_AVX2(const int *const *rows, XDWORD *dst, int width, int filter);
 #endif // VX_SIMD_AVX2
 
+//==============================================================================
+// Forward declarations -- AVX-512 dispatch-table entries (VxBlitEngineAVX512.cpp)
+//
+// Need AVX512F, AVX512BW, AVX512VL and AVX512VBMI.
+//==============================================================================
+
+#if defined(VX_SIMD_AVX512)
+void CopyLine_32ARGB_32RGB_AVX512(const VxBlitInfo *info);
+void CopyLine_24RGB_32ARGB_AVX512(const VxBlitInfo *info);
+void CopyLine_32ARGB_32ABGR_AVX512(const VxBlitInfo *info);
+void CopyLine_32ABGR_32ARGB_AVX512(const VxBlitInfo *info);
+void CopyLine_32ARGB_32RGBA_AVX512(const VxBlitInfo *info);
+void CopyLine_32RGBA_32ARGB_AVX512(const VxBlitInfo *info);
+void CopyLine_32ARGB_32BGRA_AVX512(const VxBlitInfo *info);
+void CopyLine_32BGRA_32ARGB_AVX512(const VxBlitInfo *info);
+void CopyLine_Paletted8_32ARGB_AVX512(const VxBlitInfo *info);
+void CopyLine_Paletted8_24RGB_AVX512(const VxBlitInfo *info);
+void CopyLine_Paletted8_16_AVX512(const VxBlitInfo *info);
+void CopyLine_Paletted8_8_AVX512(const VxBlitInfo *info);
+void CopyLine_32ARGB_565RGB_AVX512(const VxBlitInfo *info);
+void CopyLine_32ARGB_555RGB_AVX512(const VxBlitInfo *info);
+void CopyLine_32ARGB_1555ARGB_AVX512(const VxBlitInfo *info);
+void CopyLine_32ARGB_4444ARGB_AVX512(const VxBlitInfo *info);
+void CopyLine_565RGB_32ARGB_AVX512(const VxBlitInfo *info);
+void CopyLine_555RGB_32ARGB_AVX512(const VxBlitInfo *info);
+void CopyLine_1555ARGB_32ARGB_AVX512(const VxBlitInfo *info);
+void CopyLine_4444ARGB_32ARGB_AVX512(const VxBlitInfo *info);
+void FillLine_32_AVX512(XDWORD *dst, int width, XDWORD color);
+void FillLine_16_AVX512(XWORD *dst, int width, XWORD color);
+void PremultiplyAlpha_32ARGB_AVX512(const VxBlitInfo *info);
+void UnpremultiplyAlpha_32ARGB_AVX512(const VxBlitInfo *info);
+#endif // VX_SIMD_AVX512
+
 #endif // VXBLITINTERNAL_H
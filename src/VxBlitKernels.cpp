@@ -102,6 +102,57 @@ void CopyLineGeneric_32_16(const VxBlitInfo *info) { CopyLineGeneric<4, 2>(info)
 void CopyLineGeneric_32_24(const VxBlitInfo *info) { CopyLineGeneric<4, 3>(info); }
 void CopyLineGeneric_32_32(const VxBlitInfo *info) { CopyLineGeneric<4, 4>(info); }
 
+// Byte-aligned layouts: every destination byte is a source byte or zero, as
+// described by info->byteShuffle (first DstBpp entries cover one pixel).
+template<int SrcBpp, int DstBpp>
+static void CopyLineShuffle(const VxBlitInfo *info) {
+    const XBYTE *shuffle = info->byteShuffle;
+    const XBYTE *src = info->srcLine;
+    XBYTE *dst = info->dstLine;
+    const int width = info->width;
+
+    for (int x = 0; x < width; ++x) {
+        for (int j = 0; j < DstBpp; ++j) {
+            dst[j] = (shuffle[j] & 0x80) ? 0 : src[shuffle[j]];
+        }
+        src += SrcBpp;
+        dst += DstBpp;
+    }
+}
+
+void CopyLineShuffle_Scalar(const VxBlitInfo *info, int startX) {
+    const XBYTE *shuffle = info->byteShuffle;
+    const int srcBpp = static_cast<int>(info->srcBytesPerPixel);
+    const int dstBpp = static_cast<int>(info->dstBytesPerPixel);
+    const XBYTE *src = info->srcLine + startX * srcBpp;
+    XBYTE *dst = info->dstLine + startX * dstBpp;
+
+    for (int x = startX; x < info->width; ++x) {
+        for (int j = 0; j < dstBpp; ++j) {
+            dst[j] = (shuffle[j] & 0x80) ? 0 : src[shuffle[j]];
+        }
+        src += srcBpp;
+        dst += dstBpp;
+    }
+}
+
+void CopyLineShuffle_8_8(const VxBlitInfo *info)   { CopyLineShuffle<1, 1>(info); }
+void CopyLineShuffle_8_16(const VxBlitInfo *info)  { CopyLineShuffle<1, 2>(info); }
+void CopyLineShuffle_8_24(const VxBlitInfo *info)  { CopyLineShuffle<1, 3>(info); }
+void CopyLineShuffle_8_32(const VxBlitInfo *info)  { CopyLineShuffle<1, 4>(info); }
+void CopyLineShuffle_16_8(const VxBlitInfo *info)  { CopyLineShuffle<2, 1>(info); }
+void CopyLineShuffle_16_16(const VxBlitInfo *info) { CopyLineShuffle<2, 2>(info); }
+void CopyLineShuffle_16_24(const VxBlitInfo *info) { CopyLineShuffle<2, 3>(info); }
+void CopyLineShuffle_16_32(const VxBlitInfo *info) { CopyLineShuffle<2, 4>(info); }
+void CopyLineShuffle_24_8(const VxBlitInfo *info)  { CopyLineShuffle<3, 1>(info); }
+void CopyLineShuffle_24_16(const VxBlitInfo *info) { CopyLineShuffle<3, 2>(info); }
+void CopyLineShuffle_24_24(const VxBlitInfo *info) { CopyLineShuffle<3, 3>(info); }
+void CopyLineShuffle_24_32(const VxBlitInfo *info) { CopyLineShuffle<3, 4>(info); }
+void CopyLineShuffle_32_8(const VxBlitInfo *info)  { CopyLineShuffle<4, 1>(info); }
+void CopyLineShuffle_32_16(const VxBlitInfo *info) { CopyLineShuffle<4, 2>(info); }
+void CopyLineShuffle_32_24(const VxBlitInfo *info) { CopyLineShuffle<4, 3>(info); }
+void CopyLineShuffle_32_32(const VxBlitInfo *info) { CopyLineShuffle<4, 4>(info); }
+
 //==============================================================================
 //  Section 2 -- 32-bit <-> 32-bit Conversions
 //==============================================================================
@@ -497,141 +548,50 @@ void CopyLine_4444ARGB_32ARGB_Scalar(const VxBlitInfo *info, int startX) {
 //  Section 5 -- Paletted Image Blitting Functions
 //==============================================================================
 
-// 8-bit paletted -> 32-bit ARGB
-void CopyLine_Paletted8_32ARGB(const VxBlitInfo *info) {
-    const XBYTE *src = info->srcLine;
-    XDWORD *dst = (XDWORD *)info->dstLine;
-    const int width = info->width;
-    const XBYTE *colorMap = info->colorMap;
-    const int bpc = info->bytesPerColorEntry;
-
-    if (!colorMap) return;
-
-    // Pre-build lookup table for the palette
-    XDWORD palette32[256];
-    if (bpc >= 4) {
-        for (int i = 0; i < 256; ++i) {
-            const XBYTE *entry = colorMap + i * bpc;
-            palette32[i] = (entry[3] << 24) | (entry[2] << 16) | (entry[1] << 8) | entry[0];
-        }
-    } else {
-        for (int i = 0; i < 256; ++i) {
-            const XBYTE *entry = colorMap + i * bpc;
-            palette32[i] = 0xFF000000 | (entry[2] << 16) | (entry[1] << 8) | entry[0];
-        }
-    }
+// Palettes converted to the destination format. Each one is built once per
+// operation stamp on each thread instead of once per scanline; stamp 0 never
+// hits the cache. Indices past colorMapEntries map to zero.
 
-    int x = 0;
-    for (; x + 4 <= width; x += 4) {
-        dst[x + 0] = palette32[src[x + 0]];
-        dst[x + 1] = palette32[src[x + 1]];
-        dst[x + 2] = palette32[src[x + 2]];
-        dst[x + 3] = palette32[src[x + 3]];
-    }
-    for (; x < width; ++x) {
-        dst[x] = palette32[src[x]];
-    }
+static int PaletteEntries(const VxBlitInfo *info) {
+    return (info->colorMapEntries > 0) ? XMin(256, info->colorMapEntries) : 256;
 }
 
-// 8-bit paletted -> 24-bit RGB
-void CopyLine_Paletted8_24RGB(const VxBlitInfo *info) {
-    const XBYTE *src = info->srcLine;
-    XBYTE *dst = info->dstLine;
-    const int width = info->width;
-    const XBYTE *colorMap = info->colorMap;
-    const int bpc = info->bytesPerColorEntry;
-
-    if (!colorMap) return;
-
-    // Pre-build lookup table (store BGR in each entry)
-    XDWORD palette32[256];
-    for (int i = 0; i < 256; ++i) {
-        const XBYTE *entry = colorMap + i * bpc;
-        palette32[i] = (entry[2] << 16) | (entry[1] << 8) | entry[0];
-    }
-
-    for (int x = 0; x < width; ++x) {
-        XDWORD color = palette32[src[x]];
-        dst[0] = (XBYTE)color;          // B
-        dst[1] = (XBYTE)(color >> 8);   // G
-        dst[2] = (XBYTE)(color >> 16);  // R
-        dst += 3;
-    }
-}
-
-// 8-bit paletted -> 16-bit 565
-void CopyLine_Paletted8_565RGB(const VxBlitInfo *info) {
-    const XBYTE *src = info->srcLine;
-    XWORD *dst = (XWORD *)info->dstLine;
-    const int width = info->width;
-    const XBYTE *colorMap = info->colorMap;
-    const int bpc = info->bytesPerColorEntry;
-    const int entries = (info->colorMapEntries > 0) ? XMin(256, info->colorMapEntries) : 256;
-
-    if (!colorMap) return;
-
-    struct Pal565Cache {
+const XDWORD *GetPaletteARGB(const VxBlitInfo *info) {
+    struct PalARGBCache {
         const XBYTE *colorMap;
         int bytesPerEntry;
         int entries;
         XDWORD operationStamp;
-        XWORD palette16[256];
-        bool valid;
+        XDWORD colors[256];
     };
-    thread_local Pal565Cache cache = {nullptr, 0, 0, 0u, {}, false};
+    thread_local PalARGBCache cache = {};
 
-    if (!cache.valid ||
+    const XBYTE *colorMap = info->colorMap;
+    const int bpc = info->bytesPerColorEntry;
+    const int entries = PaletteEntries(info);
+    if (info->operationStamp == 0 ||
         cache.operationStamp != info->operationStamp ||
         cache.colorMap != colorMap ||
         cache.bytesPerEntry != bpc ||
         cache.entries != entries) {
         for (int i = 0; i < entries; ++i) {
             const XBYTE *entry = colorMap + i * bpc;
-            cache.palette16[i] = ((entry[2] >> 3) << 11) | ((entry[1] >> 2) << 5) | (entry[0] >> 3);
+            const XDWORD a = (bpc >= 4) ? entry[3] : 0xFFu;
+            cache.colors[i] = (a << 24) | (entry[2] << 16) | (entry[1] << 8) | entry[0];
         }
         for (int i = entries; i < 256; ++i) {
-            cache.palette16[i] = 0;
+            cache.colors[i] = 0;
         }
         cache.colorMap = colorMap;
         cache.bytesPerEntry = bpc;
         cache.entries = entries;
         cache.operationStamp = info->operationStamp;
-        cache.valid = true;
-    }
-
-    int x = 0;
-    for (; x + 4 <= width; x += 4) {
-        dst[x + 0] = cache.palette16[src[x + 0]];
-        dst[x + 1] = cache.palette16[src[x + 1]];
-        dst[x + 2] = cache.palette16[src[x + 2]];
-        dst[x + 3] = cache.palette16[src[x + 3]];
-    }
-    for (; x < width; ++x) {
-        dst[x] = cache.palette16[src[x]];
     }
+    return cache.colors;
 }
 
-// 8-bit paletted -> 16-bit with alpha (1555, 4444)
-void CopyLine_Paletted8_16Alpha(const VxBlitInfo *info) {
-    const XBYTE *src = info->srcLine;
-    XWORD *dst = (XWORD *)info->dstLine;
-    const int width = info->width;
-    const XBYTE *colorMap = info->colorMap;
-    const int bpc = info->bytesPerColorEntry;
-    const int entries = (info->colorMapEntries > 0) ? XMin(256, info->colorMapEntries) : 256;
-
-    if (!colorMap) return;
-
-    const int rShift = info->redShiftDst;
-    const int gShift = info->greenShiftDst;
-    const int bShift = info->blueShiftDst;
-    const int aShift = info->alphaShiftDst;
-    const int rWidth = static_cast<int>(GetBitCountLocal(info->dstRedMask));
-    const int gWidth = static_cast<int>(GetBitCountLocal(info->dstGreenMask));
-    const int bWidth = static_cast<int>(GetBitCountLocal(info->dstBlueMask));
-    const int aWidth = static_cast<int>(GetBitCountLocal(info->dstAlphaMask));
-
-    struct Pal16AlphaCache {
+const XDWORD *GetPalette16(const VxBlitInfo *info) {
+    struct Pal16Cache {
         const XBYTE *colorMap;
         int bytesPerEntry;
         int entries;
@@ -640,16 +600,14 @@ void CopyLine_Paletted8_16Alpha(const VxBlitInfo *info) {
         XDWORD dstGreenMask;
         XDWORD dstBlueMask;
         XDWORD dstAlphaMask;
-        int rShift;
-        int gShift;
-        int bShift;
-        int aShift;
-        XWORD palette16[256];
-        bool valid;
+        XDWORD colors[256]; // Widened so the AVX2 kernel can gather them
     };
-    thread_local Pal16AlphaCache cache = {};
+    thread_local Pal16Cache cache = {};
 
-    if (!cache.valid ||
+    const XBYTE *colorMap = info->colorMap;
+    const int bpc = info->bytesPerColorEntry;
+    const int entries = PaletteEntries(info);
+    if (info->operationStamp == 0 ||
         cache.operationStamp != info->operationStamp ||
         cache.colorMap != colorMap ||
         cache.bytesPerEntry != bpc ||
@@ -657,24 +615,21 @@ void CopyLine_Paletted8_16Alpha(const VxBlitInfo *info) {
         cache.dstRedMask != info->dstRedMask ||
         cache.dstGreenMask != info->dstGreenMask ||
         cache.dstBlueMask != info->dstBlueMask ||
-        cache.dstAlphaMask != info->dstAlphaMask ||
-        cache.rShift != rShift ||
-        cache.gShift != gShift ||
-        cache.bShift != bShift ||
-        cache.aShift != aShift) {
+        cache.dstAlphaMask != info->dstAlphaMask) {
+        const int rWidth = static_cast<int>(GetBitCountLocal(info->dstRedMask));
+        const int gWidth = static_cast<int>(GetBitCountLocal(info->dstGreenMask));
+        const int bWidth = static_cast<int>(GetBitCountLocal(info->dstBlueMask));
+        const int aWidth = static_cast<int>(GetBitCountLocal(info->dstAlphaMask));
         for (int i = 0; i < entries; ++i) {
             const XBYTE *entry = colorMap + i * bpc;
-            const XBYTE b_val = entry[0];
-            const XBYTE g_val = entry[1];
-            const XBYTE r_val = entry[2];
-            const XBYTE a_val = (bpc >= 4) ? entry[3] : 0xFF;
-            cache.palette16[i] = QuantizePaletteComponent(r_val, rWidth, rShift) |
-                                 QuantizePaletteComponent(g_val, gWidth, gShift) |
-                                 QuantizePaletteComponent(b_val, bWidth, bShift) |
-                                 QuantizePaletteComponent(a_val, aWidth, aShift);
+            const XBYTE a = (bpc >= 4) ? entry[3] : 0xFF;
+            cache.colors[i] = QuantizePaletteComponent(entry[2], rWidth, info->redShiftDst) |
+                              QuantizePaletteComponent(entry[1], gWidth, info->greenShiftDst) |
+                              QuantizePaletteComponent(entry[0], bWidth, info->blueShiftDst) |
+                              QuantizePaletteComponent(a, aWidth, info->alphaShiftDst);
         }
         for (int i = entries; i < 256; ++i) {
-            cache.palette16[i] = 0;
+            cache.colors[i] = 0;
         }
         cache.colorMap = colorMap;
         cache.bytesPerEntry = bpc;
@@ -684,28 +639,158 @@ void CopyLine_Paletted8_16Alpha(const VxBlitInfo *info) {
         cache.dstGreenMask = info->dstGreenMask;
         cache.dstBlueMask = info->dstBlueMask;
         cache.dstAlphaMask = info->dstAlphaMask;
-        cache.rShift = rShift;
-        cache.gShift = gShift;
-        cache.bShift = bShift;
-        cache.aShift = aShift;
-        cache.valid = true;
     }
+    return cache.colors;
+}
+
+const XBYTE *GetPaletteRemap(const VxBlitInfo *info) {
+    const XBYTE *colorMap = info->colorMap;
+    const XBYTE *dstColorMap = info->dstColorMap;
+    const int bpc = info->bytesPerColorEntry;
+    const int dstBpc = info->dstBytesPerColorEntry;
+    if (!dstColorMap || info->dstColorMapEntries <= 0 || dstBpc < 3 || bpc < 3) return nullptr;
+    if (dstColorMap == colorMap && dstBpc == bpc) return nullptr;
+
+    struct RemapCache {
+        const XBYTE *colorMap;
+        const XBYTE *dstColorMap;
+        int bytesPerEntry;
+        int dstBytesPerEntry;
+        int entries;
+        int dstEntries;
+        XDWORD operationStamp;
+        XBYTE indices[256];
+    };
+    thread_local RemapCache cache = {};
+
+    const int entries = PaletteEntries(info);
+    const int dstEntries = XMin(256, info->dstColorMapEntries);
+    if (info->operationStamp == 0 ||
+        cache.operationStamp != info->operationStamp ||
+        cache.colorMap != colorMap ||
+        cache.dstColorMap != dstColorMap ||
+        cache.bytesPerEntry != bpc ||
+        cache.dstBytesPerEntry != dstBpc ||
+        cache.entries != entries ||
+        cache.dstEntries != dstEntries) {
+        // Alpha takes part only when both palettes carry it.
+        const bool withAlpha = bpc >= 4 && dstBpc >= 4;
+        for (int i = 0; i < entries; ++i) {
+            const XBYTE *entry = colorMap + i * bpc;
+            int best = 0;
+            int bestDistance = 0x7FFFFFFF;
+            for (int j = 0; j < dstEntries && bestDistance != 0; ++j) {
+                const XBYTE *candidate = dstColorMap + j * dstBpc;
+                const int db = entry[0] - candidate[0];
+                const int dg = entry[1] - candidate[1];
+                const int dr = entry[2] - candidate[2];
+                const int da = withAlpha ? entry[3] - candidate[3] : 0;
+                const int distance = dr * dr + dg * dg + db * db + da * da;
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = j;
+                }
+            }
+            cache.indices[i] = static_cast<XBYTE>(best);
+        }
+        for (int i = entries; i < 256; ++i) {
+            cache.indices[i] = 0;
+        }
+        cache.colorMap = colorMap;
+        cache.dstColorMap = dstColorMap;
+        cache.bytesPerEntry = bpc;
+        cache.dstBytesPerEntry = dstBpc;
+        cache.entries = entries;
+        cache.dstEntries = dstEntries;
+        cache.operationStamp = info->operationStamp;
+    }
+    return cache.indices;
+}
+
+// 8-bit paletted -> 32-bit ARGB
+void CopyLine_Paletted8_32ARGB(const VxBlitInfo *info) {
+    const XBYTE *src = info->srcLine;
+    XDWORD *dst = (XDWORD *)info->dstLine;
+    const int width = info->width;
+
+    if (!info->colorMap) return;
+    const XDWORD *palette = GetPaletteARGB(info);
 
     int x = 0;
     for (; x + 4 <= width; x += 4) {
-        dst[x + 0] = cache.palette16[src[x + 0]];
-        dst[x + 1] = cache.palette16[src[x + 1]];
-        dst[x + 2] = cache.palette16[src[x + 2]];
-        dst[x + 3] = cache.palette16[src[x + 3]];
+        dst[x + 0] = palette[src[x + 0]];
+        dst[x + 1] = palette[src[x + 1]];
+        dst[x + 2] = palette[src[x + 2]];
+        dst[x + 3] = palette[src[x + 3]];
     }
     for (; x < width; ++x) {
-        dst[x] = cache.palette16[src[x]];
+        dst[x] = palette[src[x]];
     }
 }
 
-// 8-bit paletted -> 8-bit (index copy)
+// 8-bit paletted -> 24-bit RGB
+void CopyLine_Paletted8_24RGB(const VxBlitInfo *info) {
+    const XBYTE *src = info->srcLine;
+    XBYTE *dst = info->dstLine;
+    const int width = info->width;
+
+    if (!info->colorMap) return;
+    const XDWORD *palette = GetPaletteARGB(info);
+
+    // Four-byte stores overlap the next pixel, which rewrites the spare byte.
+    int x = 0;
+    for (; x + 1 < width; ++x) {
+        const XDWORD color = palette[src[x]];
+        memcpy(dst, &color, sizeof(color));
+        dst += 3;
+    }
+    if (x < width) {
+        XDWORD color = palette[src[x]];
+        dst[0] = (XBYTE)color;          // B
+        dst[1] = (XBYTE)(color >> 8);   // G
+        dst[2] = (XBYTE)(color >> 16);  // R
+    }
+}
+
+// 8-bit paletted -> any 16-bit layout (565, 555, 1555, 4444, ...)
+void CopyLine_Paletted8_16(const VxBlitInfo *info) {
+    const XBYTE *src = info->srcLine;
+    XWORD *dst = (XWORD *)info->dstLine;
+    const int width = info->width;
+
+    if (!info->colorMap) return;
+    const XDWORD *palette = GetPalette16(info);
+
+    int x = 0;
+    for (; x + 4 <= width; x += 4) {
+        dst[x + 0] = (XWORD)palette[src[x + 0]];
+        dst[x + 1] = (XWORD)palette[src[x + 1]];
+        dst[x + 2] = (XWORD)palette[src[x + 2]];
+        dst[x + 3] = (XWORD)palette[src[x + 3]];
+    }
+    for (; x < width; ++x) {
+        dst[x] = (XWORD)palette[src[x]];
+    }
+}
+
+// 8-bit paletted -> 8-bit: index copy, or a remap into a different
+// destination palette.
 void CopyLine_Paletted8_8(const VxBlitInfo *info) {
-    memcpy(info->dstLine, info->srcLine, info->width);
+    const XBYTE *remap = info->colorMap ? GetPaletteRemap(info) : nullptr;
+    if (!remap) {
+        memcpy(info->dstLine, info->srcLine, info->width);
+        return;
+    }
+    CopyLine_Paletted8_8_Scalar(info, 0, remap);
+}
+
+void CopyLine_Paletted8_8_Scalar(const VxBlitInfo *info, int startX, const XBYTE *remap) {
+    const XBYTE *src = info->srcLine;
+    XBYTE *dst = info->dstLine;
+    const int width = info->width;
+    for (int x = startX; x < width; ++x) {
+        dst[x] = remap[src[x]];
+    }
 }
 
 //==============================================================================
@@ -862,6 +947,23 @@ void CopyLine_32BGRA_32ARGB(const VxBlitInfo *info) {
 //  Section 7 -- Premultiplied Alpha Functions
 //==============================================================================
 
+static constexpr VxUnpremultiplyTable MakeUnpremultiplyTable() {
+    VxUnpremultiplyTable table = {};
+    for (XDWORD a = 0; a < 256; ++a) {
+        const XDWORD reciprocal = a ? (255u * 65536u + a - 1) / a : 0;
+        table.reciprocal[a] = reciprocal;
+        for (int c = 0; c < 3; ++c) {
+            table.factors16[a][c] = (XWORD)(reciprocal >> 16);
+            table.factors16[a][4 + c] = (XWORD)(reciprocal & 0xFFFF);
+        }
+        table.factors16[a][3] = 1;
+        table.factors16[a][7] = 0;
+    }
+    return table;
+}
+
+const VxUnpremultiplyTable g_UnpremultiplyTable = MakeUnpremultiplyTable();
+
 void PremultiplyAlpha_32ARGB(const VxBlitInfo *info) {
     const XDWORD *src = (const XDWORD *)info->srcLine;
     XDWORD *dst = (XDWORD *)info->dstLine;
@@ -899,16 +1001,11 @@ void UnpremultiplyAlpha_32ARGB(const VxBlitInfo *info) {
     for (int x = 0; x < width; ++x) {
         XDWORD p = src[x];
         XDWORD a = (p >> 24) & 0xFF;
-        if (a == 0) {
-            dst[x] = 0;
-        } else if (a == 255) {
-            dst[x] = p;
-        } else {
-            XDWORD r = XMin((XDWORD)255, ((p >> 16) & 0xFF) * 255 / a);
-            XDWORD g = XMin((XDWORD)255, ((p >> 8) & 0xFF) * 255 / a);
-            XDWORD b = XMin((XDWORD)255, (p & 0xFF) * 255 / a);
-            dst[x] = (a << 24) | (r << 16) | (g << 8) | b;
-        }
+        XDWORD rcp = g_UnpremultiplyTable.reciprocal[a];
+        XDWORD r = XMin((XDWORD)255, (((p >> 16) & 0xFF) * rcp) >> 16);
+        XDWORD g = XMin((XDWORD)255, (((p >> 8) & 0xFF) * rcp) >> 16);
+        XDWORD b = XMin((XDWORD)255, ((p & 0xFF) * rcp) >> 16);
+        dst[x] = (a << 24) | (r << 16) | (g << 8) | b;
     }
 }
 
@@ -919,16 +1016,11 @@ void UnpremultiplyAlpha_32ARGB_Scalar(const VxBlitInfo *info, int startX) {
     for (int x = startX; x < width; ++x) {
         XDWORD p = src[x];
         XDWORD a = (p >> 24) & 0xFF;
-        if (a == 0) {
-            dst[x] = 0;
-        } else if (a == 255) {
-            dst[x] = p;
-        } else {
-            XDWORD r = XMin((XDWORD)255, ((p >> 16) & 0xFF) * 255 / a);
-            XDWORD g = XMin((XDWORD)255, ((p >> 8) & 0xFF) * 255 / a);
-            XDWORD b = XMin((XDWORD)255, (p & 0xFF) * 255 / a);
-            dst[x] = (a << 24) | (r << 16) | (g << 8) | b;
-        }
+        XDWORD rcp = g_UnpremultiplyTable.reciprocal[a];
+        XDWORD r = XMin((XDWORD)255, (((p >> 16) & 0xFF) * rcp) >> 16);
+        XDWORD g = XMin((XDWORD)255, (((p >> 8) & 0xFF) * rcp) >> 16);
+        XDWORD b = XMin((XDWORD)255, ((p & 0xFF) * rcp) >> 16);
+        dst[x] = (a << 24) | (r << 16) | (g << 8) | b;
     }
 }
 
@@ -1153,7 +1245,468 @@ void MultiplyBlend_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int wid
 }
 
 //==============================================================================
-//  Section 10 -- Resize Functions (32-bit bilinear)
+//  Section 10 -- DXT Block Decoding
+//
+//  Each decoder expands a row of 4x4 blocks into four rows of 32-bit ARGB.
+//==============================================================================
+
+void DecodeBlocks_DXT1(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch) {
+    for (int b = 0; b < blockCount; ++b, blocks += 8, dst += 16) {
+        XDWORD palette[4];
+        DXTBuildColorPalette(blocks, true, palette);
+        XDWORD indices = blocks[4] | (blocks[5] << 8) | (blocks[6] << 16) | ((XDWORD)blocks[7] << 24);
+        for (int y = 0; y < 4; ++y) {
+            XDWORD *row = (XDWORD *)(dst + y * dstPitch);
+            for (int x = 0; x < 4; ++x, indices >>= 2) {
+                row[x] = palette[indices & 3];
+            }
+        }
+    }
+}
+
+void DecodeBlocks_DXT3(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch) {
+    for (int b = 0; b < blockCount; ++b, blocks += 16, dst += 16) {
+        XDWORD palette[4];
+        DXTBuildColorPalette(blocks + 8, false, palette);
+        XDWORD indices = blocks[12] | (blocks[13] << 8) | (blocks[14] << 16) | ((XDWORD)blocks[15] << 24);
+        for (int y = 0; y < 4; ++y) {
+            XDWORD *row = (XDWORD *)(dst + y * dstPitch);
+            const XDWORD alphaBits = blocks[y * 2] | (blocks[y * 2 + 1] << 8);
+            for (int x = 0; x < 4; ++x, indices >>= 2) {
+                const XDWORD alpha = ((alphaBits >> (x * 4)) & 0xF) * 17;
+                row[x] = (palette[indices & 3] & 0x00FFFFFF) | (alpha << 24);
+            }
+        }
+    }
+}
+
+void DecodeBlocks_DXT5(const XBYTE *blocks, int blockCount, XBYTE *dst, int dstPitch) {
+    for (int b = 0; b < blockCount; ++b, blocks += 16, dst += 16) {
+        XDWORD alphaPalette[8];
+        DXTBuildAlphaPalette(blocks, alphaPalette);
+        uint64_t alphaIndices = DXTReadAlphaIndices(blocks);
+
+        XDWORD palette[4];
+        DXTBuildColorPalette(blocks + 8, false, palette);
+        XDWORD indices = blocks[12] | (blocks[13] << 8) | (blocks[14] << 16) | ((XDWORD)blocks[15] << 24);
+        for (int y = 0; y < 4; ++y) {
+            XDWORD *row = (XDWORD *)(dst + y * dstPitch);
+            for (int x = 0; x < 4; ++x, indices >>= 2, alphaIndices >>= 3) {
+                row[x] = (palette[indices & 3] & 0x00FFFFFF) | alphaPalette[alphaIndices & 7];
+            }
+        }
+    }
+}
+
+//==============================================================================
+//  Section 11 -- DXT Block Encoding
+//
+//  Range fit takes the endpoints from the (slightly inset) bounding box of the
+//  block colors. Cluster fit orders the colors along their principal axis and
+//  solves the least-squares endpoints for every ordered split into the four
+//  palette clusters. Both finish with a nearest-entry index search against
+//  the palette the decoder will reconstruct, and high quality keeps whichever
+//  candidate has the lower error.
+//==============================================================================
+
+static void ComputeBounds_Scalar(const XDWORD pixels[16], XDWORD &minColor, XDWORD &maxColor) {
+    XDWORD mn = 0xFFFFFFFF;
+    XDWORD mx = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        XDWORD lo = 0xFF;
+        XDWORD hi = 0;
+        for (int i = 0; i < 16; ++i) {
+            const XDWORD c = (pixels[i] >> shift) & 0xFF;
+            if (c < lo) lo = c;
+            if (c > hi) hi = c;
+        }
+        mn = (mn & ~(0xFFu << shift)) | (lo << shift);
+        mx |= hi << shift;
+    }
+    minColor = mn;
+    maxColor = mx;
+}
+
+static inline XDWORD ColorDistance(XDWORD a, XDWORD b) {
+    const int dr = (int)((a >> 16) & 0xFF) - (int)((b >> 16) & 0xFF);
+    const int dg = (int)((a >> 8) & 0xFF) - (int)((b >> 8) & 0xFF);
+    const int db = (int)(a & 0xFF) - (int)(b & 0xFF);
+    return (XDWORD)(dr * dr + dg * dg + db * db);
+}
+
+static XDWORD SelectColorIndices_Scalar(const XDWORD pixels[16], const XDWORD palette[4], int entryCount,
+                                        XDWORD &indices) {
+    XDWORD error = 0;
+    indices = 0;
+    for (int i = 0; i < 16; ++i) {
+        XDWORD best = ColorDistance(pixels[i], palette[0]);
+        XDWORD bestIndex = 0;
+        for (int k = 1; k < entryCount; ++k) {
+            const XDWORD d = ColorDistance(pixels[i], palette[k]);
+            if (d < best) {
+                best = d;
+                bestIndex = (XDWORD)k;
+            }
+        }
+        indices |= bestIndex << (i * 2);
+        error += best;
+    }
+    return error;
+}
+
+static XDWORD SelectAlphaIndices_Scalar(const XDWORD pixels[16], const XDWORD palette[8], uint64_t &indices) {
+    XDWORD error = 0;
+    indices = 0;
+    for (int i = 0; i < 16; ++i) {
+        const int a = (int)(pixels[i] >> 24);
+        int best = 256;
+        int bestIndex = 0;
+        for (int k = 0; k < 8; ++k) {
+            int d = a - (int)(palette[k] >> 24);
+            if (d < 0) d = -d;
+            if (d < best) {
+                best = d;
+                bestIndex = k;
+            }
+        }
+        indices |= (uint64_t)bestIndex << (i * 3);
+        error += (XDWORD)(best * best);
+    }
+    return error;
+}
+
+static const DXTEncodeOps s_ScalarEncodeOps = {
+    ComputeBounds_Scalar,
+    SelectColorIndices_Scalar,
+    SelectAlphaIndices_Scalar,
+};
+
+// Bounding-box endpoints, inset by 1/16 of the range to reduce the error of
+// the extremes (they rarely sit exactly on the box corners).
+static void RangeFitEndpoints(XDWORD minColor, XDWORD maxColor, XDWORD &c0, XDWORD &c1) {
+    XDWORD lo = 0;
+    XDWORD hi = 0;
+    for (int shift = 0; shift < 24; shift += 8) {
+        XDWORD mn = (minColor >> shift) & 0xFF;
+        XDWORD mx = (maxColor >> shift) & 0xFF;
+        const XDWORD inset = (mx - mn) >> 4;
+        mn += inset;
+        mx -= inset;
+        lo |= mn << shift;
+        hi |= mx << shift;
+    }
+    c0 = DXTQuantize565(hi);
+    c1 = DXTQuantize565(lo);
+}
+
+// Least-squares endpoints over ordered 4-cluster partitions along the
+// principal axis. Returns false for blocks without a usable axis.
+static bool ClusterFitEndpoints(const XDWORD pixels[16], XDWORD &c0, XDWORD &c1) {
+    float points[16][3];
+    float mean[3] = {0.0f, 0.0f, 0.0f};
+    for (int i = 0; i < 16; ++i) {
+        points[i][0] = (float)((pixels[i] >> 16) & 0xFF);
+        points[i][1] = (float)((pixels[i] >> 8) & 0xFF);
+        points[i][2] = (float)(pixels[i] & 0xFF);
+        for (int c = 0; c < 3; ++c) mean[c] += points[i][c];
+    }
+    for (int c = 0; c < 3; ++c) mean[c] *= 1.0f / 16.0f;
+
+    float cov[6] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f}; // rr rg rb gg gb bb
+    for (int i = 0; i < 16; ++i) {
+        const float r = points[i][0] - mean[0];
+        const float g = points[i][1] - mean[1];
+        const float b = points[i][2] - mean[2];
+        cov[0] += r * r;
+        cov[1] += r * g;
+        cov[2] += r * b;
+        cov[3] += g * g;
+        cov[4] += g * b;
+        cov[5] += b * b;
+    }
+
+    // Power iteration, rescaled by the largest component to stay in range.
+    float axis[3] = {1.0f, 1.0f, 1.0f};
+    for (int iter = 0; iter < 8; ++iter) {
+        const float x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+        const float y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+        const float z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+        float m = x < 0 ? -x : x;
+        if ((y < 0 ? -y : y) > m) m = y < 0 ? -y : y;
+        if ((z < 0 ? -z : z) > m) m = z < 0 ? -z : z;
+        if (m < 1e-6f) return false;
+        axis[0] = x / m;
+        axis[1] = y / m;
+        axis[2] = z / m;
+    }
+
+    // Order the points along the axis (insertion sort, stable).
+    int order[16];
+    float key[16];
+    for (int i = 0; i < 16; ++i) {
+        const float k = points[i][0] * axis[0] + points[i][1] * axis[1] + points[i][2] * axis[2];
+        int j = i;
+        while (j > 0 && key[j - 1] > k) {
+            key[j] = key[j - 1];
+            order[j] = order[j - 1];
+            --j;
+        }
+        key[j] = k;
+        order[j] = i;
+    }
+
+    // Prefix sums of the ordered points.
+    float prefix[17][3];
+    prefix[0][0] = prefix[0][1] = prefix[0][2] = 0.0f;
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < 3; ++c) prefix[i + 1][c] = prefix[i][c] + points[order[i]][c];
+    }
+
+    // Clusters [0,i) [i,j) [j,k) [k,16) take weights 1, 2/3, 1/3, 0 of endpoint a.
+    float bestError = 3.4e38f;
+    float bestA[3] = {0.0f, 0.0f, 0.0f};
+    float bestB[3] = {0.0f, 0.0f, 0.0f};
+    bool found = false;
+    for (int i = 0; i <= 16; ++i) {
+        for (int j = i; j <= 16; ++j) {
+            for (int k = j; k <= 16; ++k) {
+                const float n0 = (float)i;
+                const float n1 = (float)(j - i);
+                const float n2 = (float)(k - j);
+                const float n3 = (float)(16 - k);
+                const float alpha2 = n0 + n1 * (4.0f / 9.0f) + n2 * (1.0f / 9.0f);
+                const float beta2 = n3 + n2 * (4.0f / 9.0f) + n1 * (1.0f / 9.0f);
+                const float alphaBeta = (n1 + n2) * (2.0f / 9.0f);
+                const float det = alpha2 * beta2 - alphaBeta * alphaBeta;
+                if (det < 1e-6f) continue;
+                const float invDet = 1.0f / det;
+
+                float a[3];
+                float b[3];
+                float error = 0.0f;
+                for (int c = 0; c < 3; ++c) {
+                    const float x0 = prefix[i][c];
+                    const float x1 = prefix[j][c] - prefix[i][c];
+                    const float x2 = prefix[k][c] - prefix[j][c];
+                    const float x3 = prefix[16][c] - prefix[k][c];
+                    const float alphaX = x0 + x1 * (2.0f / 3.0f) + x2 * (1.0f / 3.0f);
+                    const float betaX = x3 + x2 * (2.0f / 3.0f) + x1 * (1.0f / 3.0f);
+                    float va = (alphaX * beta2 - betaX * alphaBeta) * invDet;
+                    float vb = (betaX * alpha2 - alphaX * alphaBeta) * invDet;
+                    va = va < 0.0f ? 0.0f : (va > 255.0f ? 255.0f : va);
+                    vb = vb < 0.0f ? 0.0f : (vb > 255.0f ? 255.0f : vb);
+                    a[c] = va;
+                    b[c] = vb;
+                    // Error up to the constant sum of squared points.
+                    error += va * va * alpha2 + vb * vb * beta2 + 2.0f * (va * vb * alphaBeta - va * alphaX - vb * betaX);
+                }
+                if (error < bestError) {
+                    bestError = error;
+                    for (int c = 0; c < 3; ++c) {
+                        bestA[c] = a[c];
+                        bestB[c] = b[c];
+                    }
+                    found = true;
+                }
+            }
+        }
+    }
+    if (!found) return false;
+
+    XDWORD ca = 0;
+    XDWORD cb = 0;
+    for (int c = 0; c < 3; ++c) {
+        ca |= (XDWORD)(bestA[c] + 0.5f) << (16 - c * 8);
+        cb |= (XDWORD)(bestB[c] + 0.5f) << (16 - c * 8);
+    }
+    c0 = DXTQuantize565(ca);
+    c1 = DXTQuantize565(cb);
+    return true;
+}
+
+static inline void WriteColorBlock(XBYTE *block, XDWORD c0, XDWORD c1, XDWORD indices) {
+    block[0] = (XBYTE)c0;
+    block[1] = (XBYTE)(c0 >> 8);
+    block[2] = (XBYTE)c1;
+    block[3] = (XBYTE)(c1 >> 8);
+    block[4] = (XBYTE)indices;
+    block[5] = (XBYTE)(indices >> 8);
+    block[6] = (XBYTE)(indices >> 16);
+    block[7] = (XBYTE)(indices >> 24);
+}
+
+// Indices and error for a four-color (c0 > c1) candidate; c0 == c1 yields a
+// single color. DXT1 decodes c0 == c1 as three colors + transparent, so the
+// transparent entry is excluded there.
+static XDWORD EvaluateColorEndpoints(const XDWORD pixels[16], XDWORD &c0, XDWORD &c1, bool dxt1, XDWORD &indices,
+                                     const DXTEncodeOps &ops) {
+    if (c0 < c1) {
+        const XDWORD t = c0;
+        c0 = c1;
+        c1 = t;
+    }
+    XBYTE endpoints[4] = {(XBYTE)c0, (XBYTE)(c0 >> 8), (XBYTE)c1, (XBYTE)(c1 >> 8)};
+    XDWORD palette[4];
+    DXTBuildColorPalette(endpoints, dxt1, palette);
+    return ops.selectColorIndices(pixels, palette, (dxt1 && c0 == c1) ? 3 : 4, indices);
+}
+
+static void EncodeColorBlock(const XDWORD pixels[16], bool dxt1, bool highQuality, XBYTE *block,
+                             const DXTEncodeOps &ops) {
+    if (dxt1) {
+        bool transparent = false;
+        for (int i = 0; i < 16; ++i) transparent |= (pixels[i] < 0x80000000);
+        if (transparent) {
+            // Punch-through: three colors from the opaque pixels, index 3 transparent.
+            XDWORD opaque[16];
+            int count = 0;
+            for (int i = 0; i < 16; ++i) {
+                if (pixels[i] >= 0x80000000) opaque[count++] = pixels[i];
+            }
+            XDWORD c0 = 0;
+            XDWORD c1 = 0;
+            if (count > 0) {
+                for (int i = count; i < 16; ++i) opaque[i] = opaque[0];
+                XDWORD mn, mx;
+                ops.computeBounds(opaque, mn, mx);
+                RangeFitEndpoints(mn, mx, c1, c0); // c0 <= c1 selects three-color mode
+            }
+            XDWORD palette[4];
+            XBYTE endpoints[4] = {(XBYTE)c0, (XBYTE)(c0 >> 8), (XBYTE)c1, (XBYTE)(c1 >> 8)};
+            DXTBuildColorPalette(endpoints, true, palette);
+            XDWORD indices = 0;
+            ops.selectColorIndices(pixels, palette, 3, indices);
+            for (int i = 0; i < 16; ++i) {
+                if (pixels[i] < 0x80000000) indices |= 3u << (i * 2);
+            }
+            WriteColorBlock(block, c0, c1, indices);
+            return;
+        }
+    }
+
+    XDWORD mn, mx;
+    ops.computeBounds(pixels, mn, mx);
+    XDWORD c0, c1, indices;
+    RangeFitEndpoints(mn, mx, c0, c1);
+    XDWORD error = EvaluateColorEndpoints(pixels, c0, c1, dxt1, indices, ops);
+
+    XDWORD k0, k1;
+    if (highQuality && error > 0 && ClusterFitEndpoints(pixels, k0, k1)) {
+        XDWORD clusterIndices;
+        const XDWORD clusterError = EvaluateColorEndpoints(pixels, k0, k1, dxt1, clusterIndices, ops);
+        if (clusterError < error) {
+            c0 = k0;
+            c1 = k1;
+            indices = clusterIndices;
+        }
+    }
+    WriteColorBlock(block, c0, c1, indices);
+}
+
+static void EncodeExplicitAlpha(const XDWORD pixels[16], XBYTE *block) {
+    for (int i = 0; i < 16; i += 2) {
+        const XDWORD a0 = ((pixels[i] >> 24) * 15 + 127) / 255;
+        const XDWORD a1 = ((pixels[i + 1] >> 24) * 15 + 127) / 255;
+        block[i / 2] = (XBYTE)(a0 | (a1 << 4));
+    }
+}
+
+static XDWORD EvaluateAlphaEndpoints(const XDWORD pixels[16], int a0, int a1, uint64_t &indices,
+                                     const DXTEncodeOps &ops) {
+    const XBYTE endpoints[2] = {(XBYTE)a0, (XBYTE)a1};
+    XDWORD palette[8];
+    DXTBuildAlphaPalette(endpoints, palette);
+    return ops.selectAlphaIndices(pixels, palette, indices);
+}
+
+static void EncodeInterpolatedAlpha(const XDWORD pixels[16], XDWORD minColor, XDWORD maxColor, bool highQuality,
+                                    XBYTE *block, const DXTEncodeOps &ops) {
+    const int mn = (int)(minColor >> 24);
+    const int mx = (int)(maxColor >> 24);
+
+    // Eight-level mode needs a0 > a1; equal endpoints decode as a solid value.
+    int a0 = mx;
+    int a1 = mn;
+    uint64_t indices;
+    XDWORD error = EvaluateAlphaEndpoints(pixels, a0, a1, indices, ops);
+
+    if (highQuality && error > 0) {
+        // Six-level mode with exact 0 and 255, spanning the remaining values.
+        int lo = 255;
+        int hi = 0;
+        for (int i = 0; i < 16; ++i) {
+            const int a = (int)(pixels[i] >> 24);
+            if (a != 0 && a < lo) lo = a;
+            if (a != 255 && a > hi) hi = a;
+        }
+        if (lo <= hi) {
+            uint64_t sixIndices;
+            const XDWORD sixError = EvaluateAlphaEndpoints(pixels, lo, hi, sixIndices, ops);
+            if (sixError < error) {
+                a0 = lo;
+                a1 = hi;
+                indices = sixIndices;
+                error = sixError;
+            }
+        }
+    }
+
+    block[0] = (XBYTE)a0;
+    block[1] = (XBYTE)a1;
+    for (int i = 0; i < 6; ++i) {
+        block[2 + i] = (XBYTE)(indices >> (i * 8));
+    }
+}
+
+void EncodeDXTBlockRow(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks, VX_PIXELFORMAT format,
+                       bool highQuality, const DXTEncodeOps &ops) {
+    const int blockBytes = (format == _DXT1) ? 8 : 16;
+    for (int b = 0; b < blockCount; ++b, src += 16, blocks += blockBytes) {
+        XDWORD pixels[16];
+        for (int y = 0; y < 4; ++y) {
+            memcpy(&pixels[y * 4], src + y * srcPitch, 16);
+        }
+
+        if (format == _DXT1) {
+            EncodeColorBlock(pixels, true, highQuality, blocks, ops);
+        } else if (format == _DXT3) {
+            EncodeExplicitAlpha(pixels, blocks);
+            EncodeColorBlock(pixels, false, highQuality, blocks + 8, ops);
+        } else {
+            XDWORD mn, mx;
+            ops.computeBounds(pixels, mn, mx);
+            EncodeInterpolatedAlpha(pixels, mn, mx, highQuality, blocks, ops);
+            EncodeColorBlock(pixels, false, highQuality, blocks + 8, ops);
+        }
+    }
+}
+
+void EncodeBlocks_DXT1_Fast(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks) {
+    EncodeDXTBlockRow(src, srcPitch, blockCount, blocks, _DXT1, false, s_ScalarEncodeOps);
+}
+
+void EncodeBlocks_DXT1_High(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks) {
+    EncodeDXTBlockRow(src, srcPitch, blockCount, blocks, _DXT1, true, s_ScalarEncodeOps);
+}
+
+void EncodeBlocks_DXT3_Fast(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks) {
+    EncodeDXTBlockRow(src, srcPitch, blockCount, blocks, _DXT3, false, s_ScalarEncodeOps);
+}
+
+void EncodeBlocks_DXT3_High(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks) {
+    EncodeDXTBlockRow(src, srcPitch, blockCount, blocks, _DXT3, true, s_ScalarEncodeOps);
+}
+
+void EncodeBlocks_DXT5_Fast(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks) {
+    EncodeDXTBlockRow(src, srcPitch, blockCount, blocks, _DXT5, false, s_ScalarEncodeOps);
+}
+
+void EncodeBlocks_DXT5_High(const XBYTE *src, int srcPitch, int blockCount, XBYTE *blocks) {
+    EncodeDXTBlockRow(src, srcPitch, blockCount, blocks, _DXT5, true, s_ScalarEncodeOps);
+}
+
+//==============================================================================
+//  Section 12 -- Resize Functions (32-bit bilinear)
 //==============================================================================
 
 // Equal Y, Equal X -- just copy
@@ -1248,3 +1801,503 @@ void ResizeHLine_GrowY_ShrinkX_32Bpp(const VxResizeInfo *info) {
 void ResizeHLine_GrowY_GrowX_32Bpp(const VxResizeInfo *info) {
     ResizeHLine_EqualY_GrowX_32Bpp(info);
 }
+
+//==============================================================================
+//  Section 13 -- Separable Resampling (polyphase filters)
+//
+//  Weights are 1.14 fixed point and every output reads the same number of
+//  taps. The horizontal pass keeps 6 fractional bits per channel in 16-bit
+//  intermediates so negative lobes and overshoot survive until the vertical
+//  pass, which rounds and clamps to 8 bits.
+//==============================================================================
+
+void ResampleHorz_32(const XDWORD *src, short *dst, int dstWidth, const int *first, const short *weights, int taps) {
+    for (int x = 0; x < dstWidth; ++x, weights += taps, dst += 4) {
+        const XDWORD *p = src + first[x];
+        int b = 0, g = 0, r = 0, a = 0;
+        for (int t = 0; t < taps; ++t) {
+            const int w = weights[t];
+            b += w * (int)(p[t] & 0xFF);
+            g += w * (int)((p[t] >> 8) & 0xFF);
+            r += w * (int)((p[t] >> 16) & 0xFF);
+            a += w * (int)(p[t] >> 24);
+        }
+        dst[0] = (short)((b + 128) >> 8);
+        dst[1] = (short)((g + 128) >> 8);
+        dst[2] = (short)((r + 128) >> 8);
+        dst[3] = (short)((a + 128) >> 8);
+    }
+}
+
+void ResampleVert_32_Scalar(const short *const *rows, const short *weights, int taps, XBYTE *dst, int start,
+                            int end) {
+    for (int c = start; c < end; ++c) {
+        int sum = 0;
+        for (int t = 0; t < taps; ++t) {
+            sum += weights[t] * rows[t][c];
+        }
+        sum = (sum + (1 << 19)) >> 20;
+        dst[c] = (XBYTE)(sum < 0 ? 0 : (sum > 255 ? 255 : sum));
+    }
+}
+
+void ResampleVert_32(const short *const *rows, const short *weights, int taps, XDWORD *dst, int width) {
+    ResampleVert_32_Scalar(rows, weights, taps, (XBYTE *)dst, 0, width * 4);
+}
+
+//==============================================================================
+//  Section 14 -- Mip Chain Filtering
+//
+//  Rows hold four 15-bit channels per pixel (0..32767). Even sizes average
+//  pairs with (a + b + 1) >> 1; odd sizes use three taps with 1.15 weights
+//  that sum to 32768, so results never leave the 15-bit range. The default
+//  mode halves even-sized 8-bit levels directly with a rounded 2x2 box.
+//==============================================================================
+
+void MipHorzPair_Scalar(const short *src, short *dst, int start, int dstWidth) {
+    for (int c = start * 4; c < dstWidth * 4; ++c) {
+        const int x = c >> 2;
+        const int ch = c & 3;
+        dst[c] = (short)((src[x * 8 + ch] + src[x * 8 + 4 + ch] + 1) >> 1);
+    }
+}
+
+void MipHorzPair(const short *src, short *dst, int dstWidth, const short *weights) {
+    (void)weights;
+    MipHorzPair_Scalar(src, dst, 0, dstWidth);
+}
+
+void MipHorzThree(const short *src, short *dst, int dstWidth, const short *weights) {
+    for (int x = 0; x < dstWidth; ++x, src += 8, dst += 4, weights += 3) {
+        for (int ch = 0; ch < 4; ++ch) {
+            const int sum = src[ch] * weights[0] + src[4 + ch] * weights[1] + src[8 + ch] * weights[2];
+            dst[ch] = (short)((sum + 16384) >> 15);
+        }
+    }
+}
+
+void MipVertPair_Scalar(const short *const *rows, short *dst, int start, int count) {
+    for (int c = start; c < count; ++c) {
+        dst[c] = (short)((rows[0][c] + rows[1][c] + 1) >> 1);
+    }
+}
+
+void MipVertPair(const short *const *rows, const short *weights, short *dst, int count) {
+    (void)weights;
+    MipVertPair_Scalar(rows, dst, 0, count);
+}
+
+void MipVertThree_Scalar(const short *const *rows, const short *weights, short *dst, int start, int count) {
+    for (int c = start; c < count; ++c) {
+        const int sum = rows[0][c] * weights[0] + rows[1][c] * weights[1] + rows[2][c] * weights[2];
+        dst[c] = (short)((sum + 16384) >> 15);
+    }
+}
+
+void MipVertThree(const short *const *rows, const short *weights, short *dst, int count) {
+    MipVertThree_Scalar(rows, weights, dst, 0, count);
+}
+
+void MipBoxPair_Scalar(const XBYTE *row0, const XBYTE *row1, XBYTE *dst, int start, int dstWidth) {
+    const XDWORD *top = (const XDWORD *)row0;
+    const XDWORD *bottom = (const XDWORD *)row1;
+    XDWORD *out = (XDWORD *)dst;
+    for (int x = start; x < dstWidth; ++x) {
+        const XDWORD p0 = top[2 * x], p1 = top[2 * x + 1], p2 = bottom[2 * x], p3 = bottom[2 * x + 1];
+        // Two channels per 16-bit lane: four bytes plus rounding stay below 1024.
+        const XDWORD rb = (p0 & 0x00FF00FF) + (p1 & 0x00FF00FF) + (p2 & 0x00FF00FF) + (p3 & 0x00FF00FF) + 0x00020002;
+        const XDWORD ag = ((p0 >> 8) & 0x00FF00FF) + ((p1 >> 8) & 0x00FF00FF) + ((p2 >> 8) & 0x00FF00FF) +
+                          ((p3 >> 8) & 0x00FF00FF) + 0x00020002;
+        out[x] = ((rb >> 2) & 0x00FF00FF) | ((ag << 6) & 0xFF00FF00);
+    }
+}
+
+void MipBoxPair(const XBYTE *row0, const XBYTE *row1, XBYTE *dst, int dstWidth) {
+    MipBoxPair_Scalar(row0, row1, dst, 0, dstWidth);
+}
+
+//==============================================================================
+//  Section 15 -- Ordered Dithering
+//
+//  Saturating add of a periodic threshold pattern ahead of a truncating
+//  conversion. The pattern repeats every DITHER_PATTERN_PERIOD bytes (four
+//  pixels of a 4x4 Bayer row at 3 or 4 bytes per pixel) and is stored twice
+//  so wide vectors can load it without wrapping.
+//==============================================================================
+
+void DitherAdd_Scalar(const XBYTE *src, XBYTE *dst, int start, int bytes, const XBYTE *pattern) {
+    // Walk whole pattern periods so the inner loop has no modulo.
+    int phase = start % DITHER_PATTERN_PERIOD;
+    int i = start;
+    while (i < bytes) {
+        const int run = XMin(bytes - i, DITHER_PATTERN_PERIOD - phase);
+        const XBYTE *p = pattern + phase;
+        for (int k = 0; k < run; ++k) {
+            const int v = src[i + k] + p[k];
+            dst[i + k] = (XBYTE)(v > 255 ? 255 : v);
+        }
+        i += run;
+        phase = 0;
+    }
+}
+
+void DitherAdd(const XBYTE *src, XBYTE *dst, int bytes, const XBYTE *pattern) {
+    DitherAdd_Scalar(src, dst, 0, bytes, pattern);
+}
+
+//==============================================================================
+//  Section 16 -- Compositing (VxBlitEngine::BlendImage)
+//
+//  All operations work per byte on 32-bit pixels with alpha in the top byte
+//  and round products to nearest (x / 255). Straight SrcOver divides by the
+//  output alpha, so translucent intermediates composite like premultiplied
+//  ones instead of leaking the color of transparent destination pixels.
+//==============================================================================
+
+static inline XDWORD BlendDiv255(XDWORD x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+static constexpr VxSrcOverTable MakeSrcOverTable() {
+    VxSrcOverTable table = {};
+    for (XDWORD a = 1; a < 256; ++a) {
+        const XDWORD reciprocal = (65536u + a - 1) / a;
+        for (int c = 0; c < 3; ++c) {
+            table.factors16[a][c] = (XWORD)(reciprocal >> 16);
+            table.factors16[a][4 + c] = (XWORD)(reciprocal & 0xFFFF);
+        }
+    }
+    return table;
+}
+
+const VxSrcOverTable g_SrcOverTable = MakeSrcOverTable();
+
+void BlendSrcOver_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int width) {
+    for (int x = startX; x < width; ++x) {
+        const XDWORD s = src[x];
+        const XDWORD sa = s >> 24;
+        if (sa == 0xFF) {
+            dst[x] = s;
+            continue;
+        }
+        if (sa == 0) {
+            continue;
+        }
+        const XDWORD d = dst[x];
+        // The destination contributes with weight da * (1 - sa); the output
+        // alpha a is at least sa, so it is never 0 here.
+        const XDWORD wd = BlendDiv255((d >> 24) * (255 - sa));
+        const XDWORD a = sa + wd;
+        const XDWORD half = a >> 1;
+        const XDWORD r = (((s >> 16) & 0xFF) * sa + ((d >> 16) & 0xFF) * wd + half) / a;
+        const XDWORD g = (((s >> 8) & 0xFF) * sa + ((d >> 8) & 0xFF) * wd + half) / a;
+        const XDWORD b = ((s & 0xFF) * sa + (d & 0xFF) * wd + half) / a;
+        dst[x] = (a << 24) | (r << 16) | (g << 8) | b;
+    }
+}
+
+void BlendSrcOverPremultiplied_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int width) {
+    for (int x = startX; x < width; ++x) {
+        const XDWORD s = src[x];
+        const XDWORD inv = 255 - (s >> 24);
+        const XDWORD d = dst[x];
+        XDWORD out = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            const XDWORD v = ((s >> shift) & 0xFF) + BlendDiv255(((d >> shift) & 0xFF) * inv);
+            out |= (v > 255 ? 255 : v) << shift;
+        }
+        dst[x] = out;
+    }
+}
+
+void BlendAdd_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int width) {
+    for (int x = startX; x < width; ++x) {
+        const XDWORD s = src[x];
+        const XDWORD d = dst[x];
+        XDWORD out = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            const XDWORD v = ((s >> shift) & 0xFF) + ((d >> shift) & 0xFF);
+            out |= (v > 255 ? 255 : v) << shift;
+        }
+        dst[x] = out;
+    }
+}
+
+void BlendScreen_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int width) {
+    for (int x = startX; x < width; ++x) {
+        const XDWORD s = src[x];
+        const XDWORD d = dst[x];
+        XDWORD out = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            const XDWORD sc = (s >> shift) & 0xFF;
+            const XDWORD dc = (d >> shift) & 0xFF;
+            out |= (sc + dc - BlendDiv255(sc * dc)) << shift;
+        }
+        dst[x] = out;
+    }
+}
+
+void BlendLerp_32_Scalar(const XDWORD *src, XDWORD *dst, int startX, int width, XDWORD factor) {
+    const XDWORD inv = 255 - factor;
+    for (int x = startX; x < width; ++x) {
+        const XDWORD s = src[x];
+        const XDWORD d = dst[x];
+        XDWORD out = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            out |= BlendDiv255(((s >> shift) & 0xFF) * factor + ((d >> shift) & 0xFF) * inv) << shift;
+        }
+        dst[x] = out;
+    }
+}
+
+void MultiplyBlend_32(const VxBlitInfo *info) {
+    MultiplyBlend_32_Scalar((const XDWORD *)info->srcLine, (XDWORD *)info->dstLine, 0, info->width);
+}
+
+void BlendSrcOver_32(const VxBlitInfo *info) {
+    BlendSrcOver_32_Scalar((const XDWORD *)info->srcLine, (XDWORD *)info->dstLine, 0, info->width);
+}
+
+void BlendSrcOverPremultiplied_32(const VxBlitInfo *info) {
+    BlendSrcOverPremultiplied_32_Scalar((const XDWORD *)info->srcLine, (XDWORD *)info->dstLine, 0, info->width);
+}
+
+void BlendAdd_32(const VxBlitInfo *info) {
+    BlendAdd_32_Scalar((const XDWORD *)info->srcLine, (XDWORD *)info->dstLine, 0, info->width);
+}
+
+void BlendScreen_32(const VxBlitInfo *info) {
+    BlendScreen_32_Scalar((const XDWORD *)info->srcLine, (XDWORD *)info->dstLine, 0, info->width);
+}
+
+void BlendLerp_32(const VxBlitInfo *info) {
+    BlendLerp_32_Scalar((const XDWORD *)info->srcLine, (XDWORD *)info->dstLine, 0, info->width, info->alphaValue);
+}
+
+//==============================================================================
+//  Section 17 -- YUV Conversion (VxBlitEngine::ConvertFromYUV / ConvertToYUV)
+//
+//  Fixed-point formulas are documented with VxYUVCoefficients. Decoding
+//  replicates each chroma sample over the pixels it covers; encoding averages
+//  the 2x2 pixels under each sample, repeating the last column of odd widths.
+//==============================================================================
+
+const VxYUVCoefficients g_YUVCoefficients[2] = {
+    // BT.601
+    {9539, 13075, -3209, -6660, 16525, {66, 129, 25}, {-38, -74, 112}, {112, -94, -18}},
+    // BT.709
+    {9539, 14686, -1747, -4366, 17305, {47, 157, 16}, {-26, -86, 112}, {112, -102, -10}},
+};
+
+static inline XDWORD YUVClamp(int v) {
+    return (XDWORD)(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+static inline XDWORD YUVToARGB(int y, int u, int v, const VxYUVCoefficients &k) {
+    const int luma = k.yScale * (y - 16) + 4096;
+    u -= 128;
+    v -= 128;
+    const XDWORD r = YUVClamp((luma + k.vToR * v) >> 13);
+    const XDWORD g = YUVClamp((luma + k.uToG * u + k.vToG * v) >> 13);
+    const XDWORD b = YUVClamp((luma + k.uToB * u) >> 13);
+    return 0xFF000000 | (r << 16) | (g << 8) | b;
+}
+
+void DecodeYUVRow_I420_Scalar(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int startX, int width,
+                              int matrix) {
+    const VxYUVCoefficients &k = g_YUVCoefficients[matrix];
+    for (int x = startX; x < width; ++x) {
+        dst[x] = YUVToARGB(y[x], u[x >> 1], v[x >> 1], k);
+    }
+}
+
+void DecodeYUVRow_NV12_Scalar(const XBYTE *y, const XBYTE *uv, XDWORD *dst, int startX, int width, int matrix) {
+    const VxYUVCoefficients &k = g_YUVCoefficients[matrix];
+    for (int x = startX; x < width; ++x) {
+        const XBYTE *c = uv + (x & ~1);
+        dst[x] = YUVToARGB(y[x], c[0], c[1], k);
+    }
+}
+
+void DecodeYUVRow_YUY2_Scalar(const XBYTE *yuyv, XDWORD *dst, int startX, int width, int matrix) {
+    const VxYUVCoefficients &k = g_YUVCoefficients[matrix];
+    for (int x = startX; x < width; ++x) {
+        const XBYTE *group = yuyv + (x & ~1) * 2;
+        dst[x] = YUVToARGB(yuyv[x * 2], group[1], group[3], k);
+    }
+}
+
+static inline XBYTE RGBToYUV(XDWORD r, XDWORD g, XDWORD b, const short *weights, int bias) {
+    return (XBYTE)((weights[0] * (int)r + weights[1] * (int)g + weights[2] * (int)b + 128 + (bias << 8)) >> 8);
+}
+
+void EncodeYUVRows_Scalar(const XDWORD *src0, const XDWORD *src1, int startX, int width, XBYTE *y0, XBYTE *y1,
+                          XBYTE *u, XBYTE *v, int uvStep, int matrix) {
+    const VxYUVCoefficients &k = g_YUVCoefficients[matrix];
+    for (int x = startX; x < width; ++x) {
+        const XDWORD p0 = src0[x];
+        const XDWORD p1 = src1[x];
+        y0[x] = RGBToYUV((p0 >> 16) & 0xFF, (p0 >> 8) & 0xFF, p0 & 0xFF, k.toY, 16);
+        y1[x] = RGBToYUV((p1 >> 16) & 0xFF, (p1 >> 8) & 0xFF, p1 & 0xFF, k.toY, 16);
+    }
+    for (int x = startX; x < width; x += 2) {
+        const int x1 = XMin(x + 1, width - 1);
+        const XDWORD quad[4] = {src0[x], src0[x1], src1[x], src1[x1]};
+        XDWORD sum[3] = {0, 0, 0};
+        for (int i = 0; i < 4; ++i) {
+            sum[0] += (quad[i] >> 16) & 0xFF;
+            sum[1] += (quad[i] >> 8) & 0xFF;
+            sum[2] += quad[i] & 0xFF;
+        }
+        const XDWORD r = (sum[0] + 2) >> 2;
+        const XDWORD g = (sum[1] + 2) >> 2;
+        const XDWORD b = (sum[2] + 2) >> 2;
+        u[(x >> 1) * uvStep] = RGBToYUV(r, g, b, k.toU, 128);
+        v[(x >> 1) * uvStep] = RGBToYUV(r, g, b, k.toV, 128);
+    }
+}
+
+void DecodeYUVRow_I420(const XBYTE *y, const XBYTE *u, const XBYTE *v, XDWORD *dst, int width, int matrix) {
+    DecodeYUVRow_I420_Scalar(y, u, v, dst, 0, width, matrix);
+}
+
+void DecodeYUVRow_NV12(const XBYTE *y, const XBYTE *u, const XBYTE *, XDWORD *dst, int width, int matrix) {
+    DecodeYUVRow_NV12_Scalar(y, u, dst, 0, width, matrix);
+}
+
+void DecodeYUVRow_YUY2(const XBYTE *y, const XBYTE *, const XBYTE *, XDWORD *dst, int width, int matrix) {
+    DecodeYUVRow_YUY2_Scalar(y, dst, 0, width, matrix);
+}
+
+void EncodeYUVRows_I420(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1, XBYTE *u,
+                        XBYTE *v, int matrix) {
+    EncodeYUVRows_Scalar(src0, src1, 0, width, y0, y1, u, v, 1, matrix);
+}
+
+void EncodeYUVRows_NV12(const XDWORD *src0, const XDWORD *src1, int width, XBYTE *y0, XBYTE *y1, XBYTE *u,
+                        XBYTE *, int matrix) {
+    EncodeYUVRows_Scalar(src0, src1, 0, width, y0, y1, u, u + 1, 2, matrix);
+}
+
+//==============================================================================
+//  Section 18 -- Normal and Bump Maps (VxBlitEngine::ConvertToNormalMap /
+//                ConvertToBumpMap)
+//
+//  Rows hold integer heights. The 3x3 operators work on gx = right - left and
+//  gy = below - above, smoothed across the other axis with (1, 2, 1) for Sobel
+//  and (3, 10, 3) for Scharr.
+//
+//  Normal maps clamp columns. The default filter is the original forward
+//  difference (right - here, below - here); the others are divided by 2, 8
+//  and 32 so a unit ramp keeps a slope of 1.
+//
+//  Bump maps wrap columns and keep the original byte layout: [0] 127 where the
+//  luminance is at most 1, else 63; [1] above - below; [2] left - right. Sobel
+//  and Scharr are rounded to the central-difference range (/4, /16). The
+//  default filter keeps the original first column, which reads [1] as
+//  above - below + left - belowRight and [2] as left - here.
+//==============================================================================
+
+void HeightRowLuminance_Scalar(const XDWORD *src, int *dst, int startX, int width) {
+    for (int x = startX; x < width; ++x) {
+        const XDWORD p = src[x];
+        dst[x] = (int)((p & 0xFF) + ((p >> 8) & 0xFF) + ((p >> 16) & 0xFF));
+    }
+}
+
+void HeightRowMasked_Scalar(const XDWORD *src, int *dst, int startX, int width, XDWORD mask, int shift) {
+    for (int x = startX; x < width; ++x) {
+        dst[x] = (int)((src[x] & mask) >> shift);
+    }
+}
+
+// 3x3 gradient sums at column x (central difference unless Sobel or Scharr).
+static inline void GradientSums(const int *a, const int *c, const int *b, int xl, int x, int xr, int filter,
+                                int &gx, int &gy) {
+    if (filter == VX_GRADIENTFILTER_SOBEL) {
+        gx = (a[xr] - a[xl]) + 2 * (c[xr] - c[xl]) + (b[xr] - b[xl]);
+        gy = (b[xl] - a[xl]) + 2 * (b[x] - a[x]) + (b[xr] - a[xr]);
+    } else if (filter == VX_GRADIENTFILTER_SCHARR) {
+        gx = 3 * ((a[xr] - a[xl]) + (b[xr] - b[xl])) + 10 * (c[xr] - c[xl]);
+        gy = 3 * ((b[xl] - a[xl]) + (b[xr] - a[xr])) + 10 * (b[x] - a[x]);
+    } else {
+        gx = c[xr] - c[xl];
+        gy = b[x] - a[x];
+    }
+}
+
+// Channels (n * 127 + 128) and alpha (height * -255), truncated and packed as
+// the original VxConvertToNormalMap did.
+static inline XDWORD PackNormal(float dx, float dy, float height) {
+    const float invLen = 1.0f / sqrtf(dx * dx + dy * dy + 1.0f);
+    const XDWORD nx = (XDWORD)(int)(dx * invLen * 127.0f + 128.0f);
+    const XDWORD ny = (XDWORD)(int)(dy * invLen * 127.0f + 128.0f);
+    const XDWORD nz = (XDWORD)(int)(invLen * 127.0f + 128.0f);
+    const XDWORD alpha = (XDWORD)(int)(height * -255.0f);
+    return ((((nx - (alpha << 8)) << 8) + ny) << 8) + nz;
+}
+
+void NormalMapRow_Scalar(const int *const *rows, XDWORD *dst, int startX, int endX, int width, float scale,
+                         int filter) {
+    const int *a = rows[0];
+    const int *c = rows[1];
+    const int *b = rows[2];
+
+    if (filter == VX_GRADIENTFILTER_DEFAULT) {
+        for (int x = startX; x < endX; ++x) {
+            const int xr = x + 1 < width ? x + 1 : x;
+            const float h0 = (float)c[x] * scale;
+            dst[x] = PackNormal((float)c[xr] * scale - h0, (float)b[x] * scale - h0, h0);
+        }
+        return;
+    }
+
+    const float k = scale * GradientNormalScale(filter);
+    for (int x = startX; x < endX; ++x) {
+        const int xl = x > 0 ? x - 1 : 0;
+        const int xr = x + 1 < width ? x + 1 : x;
+        int gx, gy;
+        GradientSums(a, c, b, xl, x, xr, filter, gx, gy);
+        dst[x] = PackNormal((float)gx * k, (float)gy * k, (float)c[x] * scale);
+    }
+}
+
+void BumpMapRow_Scalar(const int *const *rows, XDWORD *dst, int startX, int endX, int width, int filter) {
+    const int *a = rows[0];
+    const int *c = rows[1];
+    const int *b = rows[2];
+    const int shift = GradientBumpShift(filter);
+    const int bias = (1 << shift) >> 1;
+
+    for (int x = startX; x < endX; ++x) {
+        const int xl = x > 0 ? x - 1 : width - 1;
+        const int xr = x + 1 < width ? x + 1 : 0;
+        int gx, gy;
+        GradientSums(a, c, b, xl, x, xr, filter, gx, gy);
+        int du = (bias - gy) >> shift;
+        int dv = (bias - gx) >> shift;
+        if (filter == VX_GRADIENTFILTER_DEFAULT && x == 0) {
+            du += c[width - 1] - b[1];
+            dv = c[width - 1] - c[0];
+        }
+        const XDWORD flag = c[x] <= 1 ? 127 : 63;
+        dst[x] = flag | ((XDWORD)(du & 0xFF) << 8) | ((XDWORD)(dv & 0xFF) << 16);
+    }
+}
+
+void HeightRowLuminance(const XDWORD *src, int *dst, int width, XDWORD, int) {
+    HeightRowLuminance_Scalar(src, dst, 0, width);
+}
+
+void HeightRowMasked(const XDWORD *src, int *dst, int width, XDWORD mask, int shift) {
+    HeightRowMasked_Scalar(src, dst, 0, width, mask, shift);
+}
+
+void NormalMapRow(const int *const *rows, XDWORD *dst, int width, float scale, int filter) {
+    NormalMapRow_Scalar(rows, dst, 0, width, width, scale, filter);
+}
+
+void BumpMapRow(const int *const *rows, XDWORD *dst, int width, int filter) {
+    BumpMapRow_Scalar(rows, dst, 0, width, width, filter);
+}
@@ -7,6 +7,7 @@
 #include "VxAtomic.h"
 #include "VxSIMD.h"
 #include "VxSIMDDispatchInternal.h"
+#include "VxPerfCountersInternal.h"
 #include "VxVector.h"
 
 namespace {
@@ -206,6 +207,17 @@ const VxDistanceDispatchTable kVxDistanceDispatchSIMD = {
 };
 #endif
 
+const char *const kVxDistanceDispatchEntries[] = {
+    "makeRayPairTerms",
+    "pointLineSquareDistance",
+    "pointRaySquareDistance",
+    "pointSegmentSquareDistance"
+};
+
+const VxSIMDDispatchModule kVxDistanceDispatchModule = {
+    "distance", kVxDistanceDispatchEntries, sizeof(kVxDistanceDispatchEntries) / sizeof(kVxDistanceDispatchEntries[0])
+};
+
 std::atomic<const VxDistanceDispatchTable *> g_VxDistanceDispatch(&kVxDistanceDispatchScalar);
 
 static inline const VxDistanceDispatchTable *GetVxDistanceDispatchTable() {
@@ -219,14 +231,17 @@ static inline RayPairTerms MakeRayPairTerms(const VxRay& r0, const VxRay& r1) {
 }
 
 void VxDistanceDispatchRebuild(int effectiveMode) {
-    const bool useSIMD = (effectiveMode != VX_SIMD_MODE_NONE);
+    static_assert(sizeof(VxDistanceDispatchTable) ==
+                      sizeof(void *) * (sizeof(kVxDistanceDispatchEntries) / sizeof(const char *)),
+                  "every distance dispatch function pointer needs an entry name");
 #if defined(VX_SIMD_SSE)
-    const VxDistanceDispatchTable *next = useSIMD ? &kVxDistanceDispatchSIMD : &kVxDistanceDispatchScalar;
+    const VxDistanceDispatchTable *simd = &kVxDistanceDispatchSIMD;
 #else
-    (void) useSIMD;
-    const VxDistanceDispatchTable *next = &kVxDistanceDispatchScalar;
+    const VxDistanceDispatchTable *simd = nullptr;
 #endif
-    g_VxDistanceDispatch.store(next, std::memory_order_release);
+    g_VxDistanceDispatch.store(
+        VxSIMDDispatchCompose(kVxDistanceDispatchModule, effectiveMode, kVxDistanceDispatchScalar, simd),
+        std::memory_order_release);
 }
 
 // Matches the exact quadratic expansion used in the original implementation.
@@ -237,6 +252,7 @@ static inline float DistanceQuadraticPart(const RayPairTerms& t, float s0, float
 // Line-Line distance calculations
 
 float VxDistance::LineLineSquareDistance(const VxRay &line0, const VxRay &line1, float *t0, float *t1) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_DISTANCE_QUERIES, 1);
     const RayPairTerms t = MakeRayPairTerms(line0, line1);
 
     float s0;
@@ -262,6 +278,7 @@ float VxDistance::LineLineSquareDistance(const VxRay &line0, const VxRay &line1,
 }
 
 float VxDistance::LineRaySquareDistance(const VxRay &line, const VxRay &ray, float *t0, float *t1) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_DISTANCE_QUERIES, 1);
     const RayPairTerms t = MakeRayPairTerms(line, ray);
 
     float s0;
@@ -288,6 +305,7 @@ float VxDistance::LineRaySquareDistance(const VxRay &line, const VxRay &ray, flo
 }
 
 float VxDistance::LineSegmentSquareDistance(const VxRay &line, const VxRay &segment, float *t0, float *t1) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_DISTANCE_QUERIES, 1);
     const RayPairTerms t = MakeRayPairTerms(line, segment);
 
     float s0;
@@ -321,6 +339,7 @@ float VxDistance::LineSegmentSquareDistance(const VxRay &line, const VxRay &segm
 }
 
 float VxDistance::RayRaySquareDistance(const VxRay &ray0, const VxRay &ray1, float *t0, float *t1) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_DISTANCE_QUERIES, 1);
     const RayPairTerms t = MakeRayPairTerms(ray0, ray1);
 
     float s0 = 0.0f;
@@ -384,6 +403,7 @@ float VxDistance::RayRaySquareDistance(const VxRay &ray0, const VxRay &ray1, flo
 }
 
 float VxDistance::RaySegmentSquareDistance(const VxRay &ray, const VxRay &segment, float *t0, float *t1) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_DISTANCE_QUERIES, 1);
     const RayPairTerms t = MakeRayPairTerms(ray, segment);
     const float a = t.a;
     const float b = t.b;
@@ -471,6 +491,7 @@ float VxDistance::RaySegmentSquareDistance(const VxRay &ray, const VxRay &segmen
 }
 
 float VxDistance::SegmentSegmentSquareDistance(const VxRay &segment0, const VxRay &segment1, float *t0, float *t1) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_DISTANCE_QUERIES, 1);
     const RayPairTerms t = MakeRayPairTerms(segment0, segment1);
     const float a = t.a;
     const float b = t.b;
@@ -498,7 +519,7 @@ float VxDistance::SegmentSegmentSquareDistance(const VxRay &segment0, const VxRa
         // p0 -> segment1
         {
             float tParam = 0.0f;
-            float distVal = PointSegmentSquareDistance(p0, segment1, &tParam);
+            float distVal = GetVxDistanceDispatchTable()->pointSegmentSquareDistance(p0, segment1, &tParam);
             if (distVal < bestDist) {
                 bestDist = distVal;
                 bestS0 = 0.0f;
@@ -509,7 +530,7 @@ float VxDistance::SegmentSegmentSquareDistance(const VxRay &segment0, const VxRa
         // q0 -> segment1
         {
             float tParam = 0.0f;
-            float distVal = PointSegmentSquareDistance(q0, segment1, &tParam);
+            float distVal = GetVxDistanceDispatchTable()->pointSegmentSquareDistance(q0, segment1, &tParam);
             if (distVal < bestDist) {
                 bestDist = distVal;
                 bestS0 = 1.0f;
@@ -520,7 +541,7 @@ float VxDistance::SegmentSegmentSquareDistance(const VxRay &segment0, const VxRa
         // p1 -> segment0
         {
             float tParam = 0.0f;
-            float distVal = PointSegmentSquareDistance(p1, segment0, &tParam);
+            float distVal = GetVxDistanceDispatchTable()->pointSegmentSquareDistance(p1, segment0, &tParam);
             if (distVal < bestDist) {
                 bestDist = distVal;
                 bestS0 = tParam;
@@ -531,7 +552,7 @@ float VxDistance::SegmentSegmentSquareDistance(const VxRay &segment0, const VxRa
         // q1 -> segment0
         {
             float tParam = 0.0f;
-            float distVal = PointSegmentSquareDistance(q1, segment0, &tParam);
+            float distVal = GetVxDistanceDispatchTable()->pointSegmentSquareDistance(q1, segment0, &tParam);
             if (distVal < bestDist) {
                 bestDist = distVal;
                 bestS0 = tParam;
@@ -736,14 +757,17 @@ float VxDistance::SegmentSegmentSquareDistance(const VxRay &segment0, const VxRa
 // Point-Line distance calculations
 
 float VxDistance::PointLineSquareDistance(const VxVector &point, const VxRay &line, float *t0) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_DISTANCE_QUERIES, 1);
     return GetVxDistanceDispatchTable()->pointLineSquareDistance(point, line, t0);
 }
 
 float VxDistance::PointRaySquareDistance(const VxVector &point, const VxRay &ray, float *t0) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_DISTANCE_QUERIES, 1);
     return GetVxDistanceDispatchTable()->pointRaySquareDistance(point, ray, t0);
 }
 
 float VxDistance::PointSegmentSquareDistance(const VxVector &point, const VxRay &segment, float *t0) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_DISTANCE_QUERIES, 1);
     return GetVxDistanceDispatchTable()->pointSegmentSquareDistance(point, segment, t0);
 }
 
@@ -6,62 +6,43 @@
 #include "VxSIMD.h"
 #include "VxSIMDDispatchInternal.h"
 #include "VxBlitEngine.h"
+#include "VxPerfCountersInternal.h"
 
 static void GenerateMipMapImpl(const VxImageDescEx &src_desc, XBYTE *Buffer, bool useSIMD);
-static XBOOL ConvertToNormalMapImpl(const VxImageDescEx &image, XDWORD ColorMask, bool useSIMD);
-static XBOOL ConvertToBumpMapImpl(const VxImageDescEx &image, bool useSIMD);
 
 namespace {
 typedef void (*VxGenerateMipMapDispatchFn)(const VxImageDescEx &, XBYTE *);
-typedef XBOOL (*VxConvertToNormalMapDispatchFn)(const VxImageDescEx &, XDWORD);
-typedef XBOOL (*VxConvertToBumpMapDispatchFn)(const VxImageDescEx &);
 
 static void GenerateMipMapScalarDispatch(const VxImageDescEx &src_desc, XBYTE *Buffer) {
     GenerateMipMapImpl(src_desc, Buffer, false);
 }
 
-static XBOOL ConvertToNormalMapScalarDispatch(const VxImageDescEx &image, XDWORD ColorMask) {
-    return ConvertToNormalMapImpl(image, ColorMask, false);
-}
-
-static XBOOL ConvertToBumpMapScalarDispatch(const VxImageDescEx &image) {
-    return ConvertToBumpMapImpl(image, false);
-}
-
 #if defined(VX_SIMD_SSE2)
 static void GenerateMipMapSIMDDispatch(const VxImageDescEx &src_desc, XBYTE *Buffer) {
     GenerateMipMapImpl(src_desc, Buffer, true);
 }
-
-static XBOOL ConvertToNormalMapSIMDDispatch(const VxImageDescEx &image, XDWORD ColorMask) {
-    return ConvertToNormalMapImpl(image, ColorMask, true);
-}
-
-static XBOOL ConvertToBumpMapSIMDDispatch(const VxImageDescEx &image) {
-    return ConvertToBumpMapImpl(image, true);
-}
 #endif
 
 struct VxGraphicDispatchTable {
     VxGenerateMipMapDispatchFn generateMipMap;
-    VxConvertToNormalMapDispatchFn convertToNormalMap;
-    VxConvertToBumpMapDispatchFn convertToBumpMap;
 };
 
 const VxGraphicDispatchTable kVxGraphicDispatchScalar = {
-    GenerateMipMapScalarDispatch,
-    ConvertToNormalMapScalarDispatch,
-    ConvertToBumpMapScalarDispatch
+    GenerateMipMapScalarDispatch
 };
 
 #if defined(VX_SIMD_SSE2)
 const VxGraphicDispatchTable kVxGraphicDispatchSIMD = {
-    GenerateMipMapSIMDDispatch,
-    ConvertToNormalMapSIMDDispatch,
-    ConvertToBumpMapSIMDDispatch
+    GenerateMipMapSIMDDispatch
 };
 #endif
 
+const char *const kVxGraphicDispatchEntries[] = {"generateMipMap"};
+
+const VxSIMDDispatchModule kVxGraphicDispatchModule = {
+    "graphic", kVxGraphicDispatchEntries, sizeof(kVxGraphicDispatchEntries) / sizeof(kVxGraphicDispatchEntries[0])
+};
+
 std::atomic<const VxGraphicDispatchTable *> g_VxGraphicDispatch(&kVxGraphicDispatchScalar);
 
 const VxGraphicDispatchTable *GetVxGraphicDispatchTable() {
@@ -70,14 +51,17 @@ const VxGraphicDispatchTable *GetVxGraphicDispatchTable() {
 }
 
 void VxGraphicDispatchRebuild(int effectiveMode) {
-    const bool useSIMD = (effectiveMode != VX_SIMD_MODE_NONE);
+    static_assert(sizeof(VxGraphicDispatchTable) ==
+                      sizeof(void *) * (sizeof(kVxGraphicDispatchEntries) / sizeof(const char *)),
+                  "every graphic dispatch function pointer needs an entry name");
 #if defined(VX_SIMD_SSE2)
-    const VxGraphicDispatchTable *next = useSIMD ? &kVxGraphicDispatchSIMD : &kVxGraphicDispatchScalar;
+    const VxGraphicDispatchTable *simd = &kVxGraphicDispatchSIMD;
 #else
-    (void) useSIMD;
-    const VxGraphicDispatchTable *next = &kVxGraphicDispatchScalar;
+    const VxGraphicDispatchTable *simd = nullptr;
 #endif
-    g_VxGraphicDispatch.store(next, std::memory_order_release);
+    g_VxGraphicDispatch.store(
+        VxSIMDDispatchCompose(kVxGraphicDispatchModule, effectiveMode, kVxGraphicDispatchScalar, simd),
+        std::memory_order_release);
 }
 
 //------------------------------------------------------------------------------
@@ -199,13 +183,75 @@ void VxBppToMask(VxImageDescEx &desc) {
 //------------------------------------------------------------------------------
 
 void VxDoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
+    VxPerfBlitScope perf(src_desc, dst_desc);
     TheBlitter.DoBlit(src_desc, dst_desc);
 }
 
+void VxDoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VX_DITHERMODE dither) {
+    VxPerfBlitScope perf(src_desc, dst_desc);
+    TheBlitter.DoBlit(src_desc, dst_desc, dither);
+}
+
 void VxDoBlitUpsideDown(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
+    VxPerfBlitScope perf(src_desc, dst_desc);
     TheBlitter.DoBlitUpsideDown(src_desc, dst_desc);
 }
 
+XBOOL VxDoBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, const CKRECT *srcRect,
+               const CKRECT *dstRect) {
+    VxPerfBlitScope perf(src_desc, dst_desc, srcRect, dstRect);
+    return TheBlitter.DoBlit(src_desc, dst_desc, srcRect, dstRect);
+}
+
+XBOOL VxDoBlitUpsideDown(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, const CKRECT *srcRect,
+                         const CKRECT *dstRect) {
+    VxPerfBlitScope perf(src_desc, dst_desc, srcRect, dstRect);
+    return TheBlitter.DoBlitUpsideDown(src_desc, dst_desc, srcRect, dstRect);
+}
+
+XBOOL VxStreamBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VxBlitReadFunc read,
+                   VxBlitWriteFunc write, void *userData, int bandRows) {
+    return TheBlitter.StreamBlit(src_desc, dst_desc, read, write, userData, bandRows);
+}
+
+void VxDoBlitBatch(const VxImageDescEx *src_descs, const VxImageDescEx *dst_descs, int count, XBOOL parallel) {
+    TheBlitter.DoBlitBatch(src_descs, dst_descs, count, parallel);
+}
+
+VxBlitPlan *VxCreateBlitPlan(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, XBOOL upsideDown) {
+    VxBlitPlan *plan = new VxBlitPlan;
+    if (!TheBlitter.InitBlitPlan(*plan, src_desc, dst_desc, upsideDown)) {
+        delete plan;
+        return nullptr;
+    }
+    return plan;
+}
+
+void VxExecuteBlitPlan(const VxBlitPlan *plan, const XBYTE *srcImage, XBYTE *dstImage) {
+    if (!plan) return;
+    TheBlitter.ExecuteBlitPlan(*plan, srcImage, dstImage);
+}
+
+void VxDeleteBlitPlan(VxBlitPlan *plan) {
+    delete plan;
+}
+
+void VxSetBlitParallelism(int threadCount, int minRowsPerBand) {
+    TheBlitter.SetParallelism(threadCount, minRowsPerBand);
+}
+
+void VxGetBlitParallelism(int &threadCount, int &minRowsPerBand) {
+    TheBlitter.GetParallelism(threadCount, minRowsPerBand);
+}
+
+void VxSetDXTCompressionQuality(int quality) {
+    TheBlitter.SetDXTQuality(quality);
+}
+
+int VxGetDXTCompressionQuality() {
+    return TheBlitter.GetDXTQuality();
+}
+
 void VxDoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE AlphaValue) {
     TheBlitter.DoAlphaBlit(dst_desc, AlphaValue);
 }
@@ -214,10 +260,46 @@ void VxDoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE *AlphaValues) {
     TheBlitter.DoAlphaBlit(dst_desc, AlphaValues);
 }
 
+XBOOL VxDoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE AlphaValue, const CKRECT *rect) {
+    return TheBlitter.DoAlphaBlit(dst_desc, AlphaValue, rect);
+}
+
+XBOOL VxDoAlphaBlit(const VxImageDescEx &dst_desc, XBYTE *AlphaValues, const CKRECT *rect) {
+    return TheBlitter.DoAlphaBlit(dst_desc, AlphaValues, rect);
+}
+
+XBOOL VxFillImage(const VxImageDescEx &dst_desc, XDWORD Color, const CKRECT *rect) {
+    return TheBlitter.FillImage(dst_desc, Color, rect);
+}
+
+XBOOL VxBlendImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VX_BLENDOP op, int dstX, int dstY,
+                   int factor) {
+    return TheBlitter.BlendImage(src_desc, dst_desc, op, dstX, dstY, factor);
+}
+
+XBOOL VxBlendImage(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VX_BLENDOP op,
+                   const CKRECT *srcRect, int dstX, int dstY, int factor) {
+    return TheBlitter.BlendImage(src_desc, dst_desc, op, srcRect, dstX, dstY, factor);
+}
+
 void VxResizeImage32(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc) {
+    VxPerfBlitScope perf(src_desc, dst_desc);
     TheBlitter.ResizeImage(src_desc, dst_desc);
 }
 
+void VxResizeImage32(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VX_RESIZEFILTER filter) {
+    VxPerfBlitScope perf(src_desc, dst_desc);
+    TheBlitter.ResizeImage(src_desc, dst_desc, filter);
+}
+
+XBOOL VxConvertFromYUV(const VxYUVImageDesc &src_desc, const VxImageDescEx &dst_desc, VX_RESIZEFILTER filter) {
+    return TheBlitter.ConvertFromYUV(src_desc, dst_desc, filter);
+}
+
+XBOOL VxConvertToYUV(const VxImageDescEx &src_desc, const VxYUVImageDesc &dst_desc) {
+    return TheBlitter.ConvertToYUV(src_desc, dst_desc);
+}
+
 static void GenerateMipMapImpl(const VxImageDescEx &src_desc, XBYTE *Buffer, bool useSIMD) {
     int Height = src_desc.Height;
     int BytesPerLine = src_desc.BytesPerLine;
@@ -448,469 +530,41 @@ void VxGenerateMipMap(const VxImageDescEx &src_desc, XBYTE *Buffer) {
     GetVxGraphicDispatchTable()->generateMipMap(src_desc, Buffer);
 }
 
-//------------------------------------------------------------------------------
-// Normal and bump map generation
-//------------------------------------------------------------------------------
-
-// Helper function to pack normal vector into ARGB pixel
-// Original formula: ((normal * 127.0 + 128.0) for each component, with alpha derived from height
-static XDWORD PackNormalToPixel(const float *normal, float height) {
-    // normal[0] = nx, normal[1] = ny, normal[2] = nz
-    int nx_color = (int) (normal[0] * 127.0f + 128.0f);
-    int ny_color = (int) (normal[1] * 127.0f + 128.0f);
-    int nz_color = (int) (normal[2] * 127.0f + 128.0f);
-    int alpha = (int) (height * -255.0f);
-
-    // Pack as ARGB: (alpha << 24) | (red << 16) | (green << 8) | blue
-    // Original packs: ((nx - alpha<<8) << 8 + ny) << 8 + nz
-    return (XDWORD) (((((nx_color - (alpha << 8)) << 8) + ny_color) << 8) + nz_color);
+int VxGetMipChainSize(int Width, int Height) {
+    return VxBlitEngine::GetMipChainSize(Width, Height);
 }
 
-#if defined(VX_SIMD_SSE2)
-// SSE version: Pack 4 normals to pixels at once
-static void PackNormalToPixelSSE(const __m128 &dx4, const __m128 &dy4, const __m128 &invLen4,
-                                 const __m128 &lum4, XDWORD *outPixels) {
-    __m128 scale127 = _mm_set1_ps(127.0f);
-    __m128 offset128 = _mm_set1_ps(128.0f);
-    __m128 scaleNeg255 = _mm_set1_ps(-255.0f);
-
-    // Calculate normal components
-    __m128 nx = _mm_mul_ps(dx4, invLen4);
-    __m128 ny = _mm_mul_ps(dy4, invLen4);
-    __m128 nz = invLen4;
-
-    // Convert to color space: normal * 127 + 128
-    __m128 nx_color = _mm_add_ps(_mm_mul_ps(nx, scale127), offset128);
-    __m128 ny_color = _mm_add_ps(_mm_mul_ps(ny, scale127), offset128);
-    __m128 nz_color = _mm_add_ps(_mm_mul_ps(nz, scale127), offset128);
-    __m128 alpha = _mm_mul_ps(lum4, scaleNeg255);
-
-    // Convert to integers
-    __m128i nx_i = _mm_cvttps_epi32(nx_color);
-    __m128i ny_i = _mm_cvttps_epi32(ny_color);
-    __m128i nz_i = _mm_cvttps_epi32(nz_color);
-    __m128i alpha_i = _mm_cvttps_epi32(alpha);
-
-    // Pack: ((nx - alpha<<8) << 8 + ny) << 8 + nz
-    // Extract and pack each pixel
-    alignas(16) int nx_arr[4], ny_arr[4], nz_arr[4], alpha_arr[4];
-    _mm_store_si128((__m128i *) nx_arr, nx_i);
-    _mm_store_si128((__m128i *) ny_arr, ny_i);
-    _mm_store_si128((__m128i *) nz_arr, nz_i);
-    _mm_store_si128((__m128i *) alpha_arr, alpha_i);
-
-    for (int i = 0; i < 4; i++) {
-        outPixels[i] = (XDWORD) (((((nx_arr[i] - (alpha_arr[i] << 8)) << 8) + ny_arr[i]) << 8) + nz_arr[i]);
-    }
+int VxGenerateMipChain(const VxImageDescEx &src_desc, XBYTE *DestBuffer, XDWORD Flags) {
+    return TheBlitter.GenerateMipChain(src_desc, DestBuffer, Flags);
 }
 
-// SSE version: Calculate luminance for 4 pixels (returns float values)
-static __m128 CalculateLuminanceSSE4(const XDWORD *pixels, const __m128 &scale) {
-    // Extract R, G, B from each pixel and sum them
-    alignas(16) float lum[4];
-    for (int i = 0; i < 4; i++) {
-        XDWORD p = pixels[i];
-        lum[i] = (float) ((p & 0xFF) + ((p >> 8) & 0xFF) + ((p >> 16) & 0xFF));
-    }
-    return _mm_mul_ps(_mm_load_ps(lum), scale);
-}
-#endif
-
-static XBOOL ConvertToNormalMapImpl(const VxImageDescEx &image, XDWORD ColorMask, bool useSIMD) {
-    if (image.BitsPerPixel != 32) return FALSE;
-    if (image.Width == 0 || image.Height == 0) return FALSE;
-    if (image.Image == nullptr) return FALSE;
-
-    XBYTE *Image = image.Image;
-    int Width = image.Width;
-    int Height = image.Height;
-
-    if (ColorMask == 0xFFFFFFFF) {
-        // Use luminance from RGB
-        const float scale = 0.0013071896f; // 1.0 / 765.0 (255*3)
-
-#if defined(VX_SIMD_SSE2)
-        if (useSIMD && Width >= 8) {
-            __m128 scaleVec = _mm_set1_ps(scale);
-            __m128 one = _mm_set1_ps(1.0f);
-
-            for (int y = 0; y < Height - 1; y++) {
-                XDWORD *rowCurrent = (XDWORD *) (Image + y * image.BytesPerLine);
-                XDWORD *rowBelow = (XDWORD *) (Image + (y + 1) * image.BytesPerLine);
-
-                int x = 0;
-                // Process 4 pixels at a time
-                for (; x + 4 < Width; x += 4) {
-                    XDWORD *pCurrent = rowCurrent + x;
-
-                    // Load 4 current pixels
-                    alignas(16) XDWORD current4[4] = {pCurrent[0], pCurrent[1], pCurrent[2], pCurrent[3]};
-                    // Load 4 right pixels
-                    alignas(16) XDWORD right4[4] = {pCurrent[1], pCurrent[2], pCurrent[3], pCurrent[4]};
-                    // Load 4 below pixels
-                    alignas(16) XDWORD below4[4] = {rowBelow[x], rowBelow[x + 1], rowBelow[x + 2], rowBelow[x + 3]};
-
-                    // Calculate luminances
-                    __m128 lum0 = CalculateLuminanceSSE4(current4, scaleVec);
-                    __m128 lum1 = CalculateLuminanceSSE4(right4, scaleVec);
-                    __m128 lum2 = CalculateLuminanceSSE4(below4, scaleVec);
-
-                    // Calculate derivatives
-                    __m128 dx = _mm_sub_ps(lum1, lum0);
-                    __m128 dy = _mm_sub_ps(lum2, lum0);
-
-                    // Calculate length^2 = dx^2 + dy^2 + 1
-                    __m128 lenSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), one);
-
-                    // Calculate inverse length using fast reciprocal sqrt
-                    __m128 invLen = VxSIMDReciprocalSqrtAccurate(lenSq);
-
-                    // Pack and store 4 output pixels
-                    alignas(16) XDWORD outPixels[4];
-                    PackNormalToPixelSSE(dx, dy, invLen, lum0, outPixels);
-                    pCurrent[0] = outPixels[0];
-                    pCurrent[1] = outPixels[1];
-                    pCurrent[2] = outPixels[2];
-                    pCurrent[3] = outPixels[3];
-                }
-
-                // Handle remaining pixels with scalar code
-                for (; x < Width; x++) {
-                    XDWORD *pCurrent = rowCurrent + x;
-                    XDWORD *pRight = (x + 1 < Width) ? (pCurrent + 1) : pCurrent;
-                    XDWORD *pBelow = rowBelow + x;
-
-                    XDWORD p0 = *pCurrent;
-                    float lum0f = ((p0 & 0xFF) + ((p0 >> 8) & 0xFF) + ((p0 >> 16) & 0xFF)) * scale;
-
-                    XDWORD p1 = *pRight;
-                    float lum1f = ((p1 & 0xFF) + ((p1 >> 8) & 0xFF) + ((p1 >> 16) & 0xFF)) * scale;
-
-                    XDWORD p2 = *pBelow;
-                    float lum2f = ((p2 & 0xFF) + ((p2 >> 8) & 0xFF) + ((p2 >> 16) & 0xFF)) * scale;
-
-                    float dxf = lum1f - lum0f;
-                    float dyf = lum2f - lum0f;
-                    float invLenf = 1.0f / sqrtf(dxf * dxf + dyf * dyf + 1.0f);
-
-                    float normal[3] = {dxf * invLenf, dyf * invLenf, invLenf};
-                    *pCurrent = PackNormalToPixel(normal, lum0f);
-                }
-            }
-        } else
-#endif
-        {
-            // Scalar fallback
-            for (int y = 0; y < Height - 1; y++) {
-                for (int x = 0; x < Width; x++) {
-                    XDWORD *pCurrent = (XDWORD *) (Image + y * image.BytesPerLine + x * 4);
-                    XDWORD *pRight = (XDWORD *) (Image + y * image.BytesPerLine + (x + 1) * 4);
-                    XDWORD *pBelow = (XDWORD *) (Image + (y + 1) * image.BytesPerLine + x * 4);
-
-                    // Calculate luminance for current pixel (R + G + B)
-                    XDWORD p0 = *pCurrent;
-                    float lum0 = ((p0 & 0xFF) + ((p0 >> 8) & 0xFF) + ((p0 >> 16) & 0xFF)) * scale;
-
-                    // Calculate luminance for right pixel
-                    XDWORD p1 = (x + 1 < Width) ? *pRight : p0;
-                    float lum1 = ((p1 & 0xFF) + ((p1 >> 8) & 0xFF) + ((p1 >> 16) & 0xFF)) * scale;
-
-                    // Calculate luminance for below pixel
-                    XDWORD p2 = *pBelow;
-                    float lum2 = ((p2 & 0xFF) + ((p2 >> 8) & 0xFF) + ((p2 >> 16) & 0xFF)) * scale;
-
-                    // Calculate derivatives
-                    float dx = lum1 - lum0;
-                    float dy = lum2 - lum0;
-
-                    // Calculate normal vector and normalize
-                    float invLen = 1.0f / sqrtf(dx * dx + dy * dy + 1.0f);
-                    float normal[3];
-                    normal[0] = dx * invLen;
-                    normal[1] = dy * invLen;
-                    normal[2] = invLen;
-
-                    *pCurrent = PackNormalToPixel(normal, lum0);
-                }
-            }
-        }
-    } else {
-        // Use specified color mask
-        XBYTE BitShift = (XBYTE) GetBitShift(ColorMask);
-        const float scale = 1.0f / 255.0f;
-
-        for (int y = 0; y < Height - 1; y++) {
-            for (int x = 0; x < Width; x++) {
-                XDWORD *pCurrent = (XDWORD *) (Image + y * image.BytesPerLine + x * 4);
-                XDWORD *pRight = (XDWORD *) (Image + y * image.BytesPerLine + (x + 1) * 4);
-                XDWORD *pBelow = (XDWORD *) (Image + (y + 1) * image.BytesPerLine + x * 4);
-
-                // Extract masked value for current pixel
-                XDWORD v0 = ((*pCurrent) & ColorMask) >> BitShift;
-                float h0 = (float) v0 * scale;
-
-                // Extract masked value for right pixel
-                XDWORD v1 = (x + 1 < Width) ? (((*pRight) & ColorMask) >> BitShift) : v0;
-                float h1 = (float) v1 * scale;
-
-                // Extract masked value for below pixel
-                XDWORD v2 = ((*pBelow) & ColorMask) >> BitShift;
-                float h2 = (float) v2 * scale;
-
-                // Calculate derivatives
-                float dx = h1 - h0;
-                float dy = h2 - h0;
-
-                // Calculate normal vector and normalize
-                float invLen = 1.0f / sqrtf(dx * dx + dy * dy + 1.0f);
-                float normal[3];
-                normal[0] = dx * invLen;
-                normal[1] = dy * invLen;
-                normal[2] = invLen;
-
-                *pCurrent = PackNormalToPixel(normal, h0);
-            }
-        }
-    }
-
-    // Copy second-to-last row to last row.
-    // For single-row images there is no previous row, so keep row 0 as-is.
-    if (Height > 1) {
-        memcpy(
-            Image + (Height - 1) * image.BytesPerLine,
-            Image + (Height - 2) * image.BytesPerLine,
-            image.BytesPerLine
-        );
-    }
-
-    return TRUE;
-}
+//------------------------------------------------------------------------------
+// Normal and bump map generation
+//------------------------------------------------------------------------------
 
 XBOOL VxConvertToNormalMap(const VxImageDescEx &image, XDWORD ColorMask) {
-    return GetVxGraphicDispatchTable()->convertToNormalMap(image, ColorMask);
+    return TheBlitter.ConvertToNormalMap(image, image, ColorMask, VX_GRADIENTFILTER_DEFAULT);
 }
 
-#if defined(VX_SIMD_SSE2)
-static inline int SseLuminance(XDWORD pixel) {
-    return (int) ((pixel & 0xFF) + ((pixel >> 8) & 0xFF) + ((pixel >> 16) & 0xFF));
+XBOOL VxConvertToNormalMap(const VxImageDescEx &image, XDWORD ColorMask, VX_GRADIENTFILTER filter) {
+    return TheBlitter.ConvertToNormalMap(image, image, ColorMask, filter);
 }
-#endif
-
-static XBOOL ConvertToBumpMapImpl(const VxImageDescEx &image, bool useSIMD) {
-    if (image.BitsPerPixel != 32) return FALSE;
-    if (image.Image == nullptr) return FALSE;
-    if (image.Width < 2 || image.Height <= 0 || image.BytesPerLine <= 0) return FALSE;
-
-    // Allocate temporary copy of the image
-    const size_t bytesPerLine = static_cast<size_t>(image.BytesPerLine);
-    const size_t imageHeight = static_cast<size_t>(image.Height);
-    if (bytesPerLine > (static_cast<size_t>(-1) / imageHeight)) {
-        return FALSE;
-    }
-
-    const size_t imageSize = bytesPerLine * imageHeight;
-    XBYTE *tempImage = new XBYTE[imageSize];
-    memcpy(tempImage, image.Image, imageSize);
-
-    XBYTE *srcPtr = tempImage;
-    XBYTE *dstPtr = image.Image;
-    int Width = image.Width;
-    int Height = image.Height;
-    int BytesPerLine = image.BytesPerLine;
-
-    // Calculate pointer to last row of source (for wrap-around)
-    XBYTE *lastRowPtr = tempImage + BytesPerLine * (Height - 1);
-
-    for (int y = 0; y < Height; y++) {
-        // Get pointer to row above (wrap to last row if at top)
-        XBYTE *abovePtr;
-        if (y == 0) {
-            abovePtr = lastRowPtr;
-        } else {
-            abovePtr = srcPtr - BytesPerLine;
-        }
-
-        // Get pointer to row below (use current row if at bottom)
-        XBYTE *belowPtr;
-        if (y != Height - 1) {
-            belowPtr = srcPtr + BytesPerLine;
-        } else {
-            belowPtr = srcPtr; // At last row, reuse current
-        }
-
-        XBYTE *currentPtr = srcPtr + 4; // Point to second pixel in row
 
-        // Calculate left pixel luminance (last pixel of row for wrap)
-        int leftPixel = *(int *) (srcPtr + (Width - 1) * 4);
-        int leftLum = (leftPixel & 0xFF) + ((leftPixel >> 8) & 0xFF) + ((leftPixel >> 16) & 0xFF);
-
-        // Calculate below-left luminance for first pixel
-        int belowVal = *(int *) belowPtr;
-        int belowLum = (belowVal & 0xFF) + ((belowVal >> 8) & 0xFF) + ((belowVal >> 16) & 0xFF);
-
-        // Calculate above luminance for first pixel
-        int aboveVal = *(int *) abovePtr;
-        int aboveLum = (aboveVal & 0xFF) + ((aboveVal >> 8) & 0xFF) + ((aboveVal >> 16) & 0xFF);
-
-        // Calculate current pixel luminance
-        int currVal = *(int *) srcPtr;
-        int currLum = (currVal & 0xFF) + ((currVal >> 8) & 0xFF) + ((currVal >> 16) & 0xFF);
-
-        // Calculate right pixel luminance
-        int rightVal = *(int *) (belowPtr + 4);
-        int rightLum = (rightVal & 0xFF) + ((rightVal >> 8) & 0xFF) + ((rightVal >> 16) & 0xFF);
-
-        // First pixel of row
-        *dstPtr = (currLum <= 1) ? 127 : 63;
-        dstPtr[1] = (XBYTE) (aboveLum - belowLum + leftLum - rightLum);
-        dstPtr[2] = (XBYTE) (leftLum - currLum);
-        dstPtr[3] = 0;
-        dstPtr += 4;
-
-        belowPtr += 4;
-        abovePtr += 4;
-
-#if defined(VX_SIMD_SSE2)
-        // SSE2 optimized middle pixels - process 4 pixels at a time
-        if (useSIMD && Width >= 6) {
-            __m128i zero = _mm_setzero_si128();
-
-            unsigned int x = 1;
-            // Process 4 pixels at a time when possible
-            while (x + 4 < (unsigned int) (Width - 1)) {
-                // Load 4 current pixels
-                __m128i curr4 = _mm_loadu_si128((const __m128i *) currentPtr);
-                __m128i below4 = _mm_loadu_si128((const __m128i *) belowPtr);
-                __m128i above4 = _mm_loadu_si128((const __m128i *) abovePtr);
-                __m128i left4 = _mm_loadu_si128((const __m128i *) (currentPtr - 4));
-                __m128i right4 = _mm_loadu_si128((const __m128i *) (currentPtr + 4));
-
-                // Process each of 4 pixels
-                for (int i = 0; i < 4; i++) {
-                    XDWORD currPx = _mm_cvtsi128_si32(curr4);
-                    XDWORD belowPx = _mm_cvtsi128_si32(below4);
-                    XDWORD abovePx = _mm_cvtsi128_si32(above4);
-                    XDWORD leftPx = _mm_cvtsi128_si32(left4);
-                    XDWORD rightPx = _mm_cvtsi128_si32(right4);
-
-                    int cLum = SseLuminance(currPx);
-                    int bLum = SseLuminance(belowPx);
-                    int aLum = SseLuminance(abovePx);
-                    int lLum = SseLuminance(leftPx);
-                    int rLum = SseLuminance(rightPx);
-
-                    *dstPtr = (cLum <= 1) ? 127 : 63;
-                    dstPtr[1] = (XBYTE) (aLum - bLum);
-                    dstPtr[2] = (XBYTE) (lLum - rLum);
-                    dstPtr[3] = 0;
-                    dstPtr += 4;
-
-                    // Shift to next pixel
-                    curr4 = _mm_srli_si128(curr4, 4);
-                    below4 = _mm_srli_si128(below4, 4);
-                    above4 = _mm_srli_si128(above4, 4);
-                    left4 = _mm_srli_si128(left4, 4);
-                    right4 = _mm_srli_si128(right4, 4);
-                }
-
-                currentPtr += 16;
-                belowPtr += 16;
-                abovePtr += 16;
-                x += 4;
-            }
-
-            // Handle remaining middle pixels with scalar code
-            for (; x < (unsigned int) (Width - 1); x++) {
-                leftPixel = *(int *) (currentPtr - 4);
-                leftLum = (leftPixel & 0xFF) + ((leftPixel >> 8) & 0xFF) + ((leftPixel >> 16) & 0xFF);
-
-                int nextRightVal = *(int *) (currentPtr + 4);
-                int nextRightLum = (nextRightVal & 0xFF) + ((nextRightVal >> 8) & 0xFF) + ((nextRightVal >> 16) & 0xFF);
-
-                currVal = *(int *) currentPtr;
-                currLum = (currVal & 0xFF) + ((currVal >> 8) & 0xFF) + ((currVal >> 16) & 0xFF);
-
-                belowVal = *(int *) belowPtr;
-                belowLum = (belowVal & 0xFF) + ((belowVal >> 8) & 0xFF) + ((belowVal >> 16) & 0xFF);
-
-                aboveVal = *(int *) abovePtr;
-                aboveLum = (aboveVal & 0xFF) + ((aboveVal >> 8) & 0xFF) + ((aboveVal >> 16) & 0xFF);
-
-                *dstPtr = (currLum <= 1) ? 127 : 63;
-                dstPtr[1] = (XBYTE) (aboveLum - belowLum);
-                dstPtr[2] = (XBYTE) (leftLum - nextRightLum);
-                dstPtr[3] = 0;
-
-                currentPtr += 4;
-                belowPtr += 4;
-                abovePtr += 4;
-                dstPtr += 4;
-            }
-        } else
-#endif
-        {
-            // Scalar middle pixels
-            for (unsigned int x = 1; x < (unsigned int) (Width - 1); x++) {
-                // Get values
-                leftPixel = *(int *) (currentPtr - 4);
-                leftLum = (leftPixel & 0xFF) + ((leftPixel >> 8) & 0xFF) + ((leftPixel >> 16) & 0xFF);
-
-                int nextRightVal = *(int *) (currentPtr + 4);
-                int nextRightLum = (nextRightVal & 0xFF) + ((nextRightVal >> 8) & 0xFF) + ((nextRightVal >> 16) & 0xFF);
-
-                currVal = *(int *) currentPtr;
-                currLum = (currVal & 0xFF) + ((currVal >> 8) & 0xFF) + ((currVal >> 16) & 0xFF);
-
-                belowVal = *(int *) belowPtr;
-                belowLum = (belowVal & 0xFF) + ((belowVal >> 8) & 0xFF) + ((belowVal >> 16) & 0xFF);
-
-                aboveVal = *(int *) abovePtr;
-                aboveLum = (aboveVal & 0xFF) + ((aboveVal >> 8) & 0xFF) + ((aboveVal >> 16) & 0xFF);
-
-                *dstPtr = (currLum <= 1) ? 127 : 63;
-                dstPtr[1] = (XBYTE) (aboveLum - belowLum);
-                dstPtr[2] = (XBYTE) (leftLum - nextRightLum);
-                dstPtr[3] = 0;
-
-                currentPtr += 4;
-                belowPtr += 4;
-                abovePtr += 4;
-                dstPtr += 4;
-            }
-        }
-
-        // Last pixel of row
-        leftPixel = *(int *) (srcPtr + (Width - 2) * 4);
-        leftLum = (leftPixel & 0xFF) + ((leftPixel >> 8) & 0xFF) + ((leftPixel >> 16) & 0xFF);
-
-        // Right pixel wraps to first pixel
-        int firstVal = *(int *) srcPtr;
-        int firstLum = (firstVal & 0xFF) + ((firstVal >> 8) & 0xFF) + ((firstVal >> 16) & 0xFF);
-
-        currVal = *(int *) currentPtr;
-        currLum = (currVal & 0xFF) + ((currVal >> 8) & 0xFF) + ((currVal >> 16) & 0xFF);
-
-        belowVal = *(int *) belowPtr;
-        belowLum = (belowVal & 0xFF) + ((belowVal >> 8) & 0xFF) + ((belowVal >> 16) & 0xFF);
-
-        aboveVal = *(int *) abovePtr;
-        aboveLum = (aboveVal & 0xFF) + ((aboveVal >> 8) & 0xFF) + ((aboveVal >> 16) & 0xFF);
-
-        *dstPtr = (currLum <= 1) ? 127 : 63;
-        dstPtr[1] = (XBYTE) (aboveLum - belowLum);
-        dstPtr[2] = (XBYTE) (leftLum - firstLum);
-        dstPtr[3] = 0;
-        dstPtr += 4;
+XBOOL VxConvertToNormalMap(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, XDWORD ColorMask,
+                           VX_GRADIENTFILTER filter) {
+    return TheBlitter.ConvertToNormalMap(src_desc, dst_desc, ColorMask, filter);
+}
 
-        srcPtr += BytesPerLine;
-    }
+XBOOL VxConvertToBumpMap(const VxImageDescEx &image) {
+    return TheBlitter.ConvertToBumpMap(image, image, VX_GRADIENTFILTER_DEFAULT);
+}
 
-    delete[] tempImage;
-    return TRUE;
+XBOOL VxConvertToBumpMap(const VxImageDescEx &image, VX_GRADIENTFILTER filter) {
+    return TheBlitter.ConvertToBumpMap(image, image, filter);
 }
 
-XBOOL VxConvertToBumpMap(const VxImageDescEx &image) {
-    return GetVxGraphicDispatchTable()->convertToBumpMap(image);
+XBOOL VxConvertToBumpMap(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, VX_GRADIENTFILTER filter) {
+    return TheBlitter.ConvertToBumpMap(src_desc, dst_desc, filter);
 }
 
 //------------------------------------------------------------------------------
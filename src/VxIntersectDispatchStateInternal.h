@@ -1,9 +1,9 @@
 #ifndef VXINTERSECTDISPATCHSTATEINTERNAL_H
 #define VXINTERSECTDISPATCHSTATEINTERNAL_H
 
-void VxIntersectPlaneDispatchRebuild(bool useSIMD);
-void VxIntersectSphereDispatchRebuild(bool useSIMD);
-void VxIntersectFrustumDispatchRebuild(bool useSIMD);
-void VxIntersectFaceDispatchRebuild(bool useSIMD);
+void VxIntersectPlaneDispatchRebuild(int effectiveMode);
+void VxIntersectSphereDispatchRebuild(int effectiveMode);
+void VxIntersectFrustumDispatchRebuild(int effectiveMode);
+void VxIntersectFaceDispatchRebuild(int effectiveMode);
 
 #endif // VXINTERSECTDISPATCHSTATEINTERNAL_H
@@ -10,6 +10,7 @@
 #include "VxSIMD.h"
 #include "VxSIMDDispatchInternal.h"
 #include "VxIntersectDispatchStateInternal.h"
+#include "VxPerfCountersInternal.h"
 
 constexpr float kHugeT = 1.0e30f;
 constexpr float kSegmentMaxT = 1.0f;
@@ -89,6 +90,24 @@ const VxIntersectBoxDispatchTable kVxIntersectBoxDispatchSIMD = {
 };
 #endif
 
+const char *const kVxIntersectBoxDispatchEntries[] = {
+    "rayBox",
+    "rayBoxDetailed",
+    "segmentBox",
+    "segmentBoxDetailed",
+    "lineBox",
+    "lineBoxDetailed",
+    "aabbAabb",
+    "aabbObb",
+    "obbObb",
+    "aabbFace"
+};
+
+const VxSIMDDispatchModule kVxIntersectBoxDispatchModule = {
+    "intersect", kVxIntersectBoxDispatchEntries,
+    sizeof(kVxIntersectBoxDispatchEntries) / sizeof(kVxIntersectBoxDispatchEntries[0])
+};
+
 std::atomic<const VxIntersectBoxDispatchTable *> g_VxIntersectBoxDispatch(&kVxIntersectBoxDispatchScalar);
 
 const VxIntersectBoxDispatchTable *GetVxIntersectBoxDispatchTable() {
@@ -98,20 +117,22 @@ const VxIntersectBoxDispatchTable *GetVxIntersectBoxDispatchTable() {
 } // namespace
 
 void VxIntersectDispatchRebuild(int effectiveMode) {
-    const bool useSIMD = (effectiveMode != VX_SIMD_MODE_NONE);
-
+    static_assert(sizeof(VxIntersectBoxDispatchTable) ==
+                      sizeof(void *) * (sizeof(kVxIntersectBoxDispatchEntries) / sizeof(const char *)),
+                  "every intersect box dispatch function pointer needs an entry name");
 #if defined(VX_SIMD_SSE)
-    const VxIntersectBoxDispatchTable *next = useSIMD ? &kVxIntersectBoxDispatchSIMD : &kVxIntersectBoxDispatchScalar;
+    const VxIntersectBoxDispatchTable *simd = &kVxIntersectBoxDispatchSIMD;
 #else
-    (void) useSIMD;
-    const VxIntersectBoxDispatchTable *next = &kVxIntersectBoxDispatchScalar;
+    const VxIntersectBoxDispatchTable *simd = nullptr;
 #endif
-    g_VxIntersectBoxDispatch.store(next, std::memory_order_release);
-
-    VxIntersectPlaneDispatchRebuild(useSIMD);
-    VxIntersectSphereDispatchRebuild(useSIMD);
-    VxIntersectFrustumDispatchRebuild(useSIMD);
-    VxIntersectFaceDispatchRebuild(useSIMD);
+    g_VxIntersectBoxDispatch.store(
+        VxSIMDDispatchCompose(kVxIntersectBoxDispatchModule, effectiveMode, kVxIntersectBoxDispatchScalar, simd),
+        std::memory_order_release);
+
+    VxIntersectPlaneDispatchRebuild(effectiveMode);
+    VxIntersectSphereDispatchRebuild(effectiveMode);
+    VxIntersectFrustumDispatchRebuild(effectiveMode);
+    VxIntersectFaceDispatchRebuild(effectiveMode);
 }
 
 #if defined(VX_SIMD_SSE)
@@ -236,6 +257,7 @@ static inline XBOOL PointInAABB_OutCode(const VxBbox &box, const VxVector &p, un
 
 // Intersection Ray - Box (simple boolean version)
 XBOOL VxIntersect::RayBox(const VxRay &ray, const VxBbox &box) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_RAY_QUERIES, 1);
     return GetVxIntersectBoxDispatchTable()->rayBox(ray, box);
 }
 
@@ -319,6 +341,7 @@ static XBOOL RayBoxCore(const VxRay &ray, const VxBbox &box) {
 
 // Intersection Ray - Box (detailed version with intersection points and normals)
 int VxIntersect::RayBox(const VxRay &ray, const VxBbox &box, VxVector &inpoint, VxVector *outpoint, VxVector *innormal, VxVector *outnormal) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_RAY_QUERIES, 1);
     return GetVxIntersectBoxDispatchTable()->rayBoxDetailed(ray, box, inpoint, outpoint, innormal, outnormal);
 }
 
@@ -449,6 +472,7 @@ static int RayBoxDetailedCore(const VxRay &ray, const VxBbox &box, VxVector &inp
 
 // Intersection Segment - Box (simple boolean version)
 XBOOL VxIntersect::SegmentBox(const VxRay &segment, const VxBbox &box) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_RAY_QUERIES, 1);
     return GetVxIntersectBoxDispatchTable()->segmentBox(segment, box);
 }
 
@@ -537,6 +561,7 @@ static XBOOL SegmentBoxCore(const VxRay &segment, const VxBbox &box) {
 
 // Intersection Segment - Box (detailed version)
 int VxIntersect::SegmentBox(const VxRay &segment, const VxBbox &box, VxVector &inpoint, VxVector *outpoint, VxVector *innormal, VxVector *outnormal) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_RAY_QUERIES, 1);
     return GetVxIntersectBoxDispatchTable()->segmentBoxDetailed(segment, box, inpoint, outpoint, innormal, outnormal);
 }
 
@@ -680,6 +705,7 @@ static int SegmentBoxDetailedCore(const VxRay &segment, const VxBbox &box, VxVec
 
 // Intersection Line - Box (simple boolean version)
 XBOOL VxIntersect::LineBox(const VxRay &line, const VxBbox &box) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_RAY_QUERIES, 1);
     return GetVxIntersectBoxDispatchTable()->lineBox(line, box);
 }
 
@@ -748,6 +774,7 @@ static XBOOL LineBoxCore(const VxRay &line, const VxBbox &box) {
 
 // Intersection Line - Box (detailed version)
 int VxIntersect::LineBox(const VxRay &line, const VxBbox &box, VxVector &inpoint, VxVector *outpoint, VxVector *innormal, VxVector *outnormal) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_RAY_QUERIES, 1);
     return GetVxIntersectBoxDispatchTable()->lineBoxDetailed(line, box, inpoint, outpoint, innormal, outnormal);
 }
 
@@ -886,6 +913,7 @@ static int LineBoxDetailedCore(const VxRay &line, const VxBbox &box, VxVector &i
 
 // Intersection Box - Box
 XBOOL VxIntersect::AABBAABB(const VxBbox &box1, const VxBbox &box2) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectBoxDispatchTable()->aabbAabb(box1, box2);
 }
 
@@ -915,6 +943,7 @@ static XBOOL AABBAABBCore(const VxBbox &box1, const VxBbox &box2) {
 
 // AABB - OBB intersection
 XBOOL VxIntersect::AABBOBB(const VxBbox &box1, const VxOBB &box2) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectBoxDispatchTable()->aabbObb(box1, box2);
 }
 
@@ -1085,6 +1114,7 @@ static XBOOL AABBOBBCore(const VxBbox &box1, const VxOBB &box2) {
 
 // OBB - OBB intersection using SAT (Separating Axis Theorem)
 XBOOL VxIntersect::OBBOBB(const VxOBB &box1, const VxOBB &box2) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectBoxDispatchTable()->obbObb(box1, box2);
 }
 
@@ -1276,6 +1306,7 @@ static XBOOL OBBOBBCore(const VxOBB &box1, const VxOBB &box2) {
 
 // AABB - Face (triangle) intersection
 XBOOL VxIntersect::AABBFace(const VxBbox &box, const VxVector &A0, const VxVector &A1, const VxVector &A2, const VxVector &N) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectBoxDispatchTable()->aabbFace(box, A0, A1, A2, N);
 }
 
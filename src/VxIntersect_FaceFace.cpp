@@ -7,7 +7,9 @@
 #include "VxPlane.h"
 #include "VxAtomic.h"
 #include "VxSIMD.h"
+#include "VxSIMDDispatchInternal.h"
 #include "VxIntersectDispatchStateInternal.h"
+#include "VxPerfCountersInternal.h"
 
 #if defined(VX_SIMD_SSE)
 static inline __m128 VxSIMDLoadVector3(const VxVector &v) {
@@ -112,6 +114,17 @@ const VxIntersectFaceDispatchTable kVxIntersectFaceDispatchSIMD = {
 };
 #endif
 
+const char *const kVxIntersectFaceDispatchEntries[] = {
+    "pointInFace",
+    "getPointCoefficients",
+    "faceFace"
+};
+
+const VxSIMDDispatchModule kVxIntersectFaceDispatchModule = {
+    "intersect", kVxIntersectFaceDispatchEntries,
+    sizeof(kVxIntersectFaceDispatchEntries) / sizeof(kVxIntersectFaceDispatchEntries[0])
+};
+
 std::atomic<const VxIntersectFaceDispatchTable *> g_VxIntersectFaceDispatch(&kVxIntersectFaceDispatchScalar);
 
 const VxIntersectFaceDispatchTable *GetVxIntersectFaceDispatchTable() {
@@ -379,6 +392,7 @@ static void GetPointCoefficientsSIMDCore(const VxVector &pt, const VxVector &pt0
 // Intersection Face - Face
 XBOOL VxIntersect::FaceFace(const VxVector &A0, const VxVector &A1, const VxVector &A2, const VxVector &N0,
                             const VxVector &B0, const VxVector &B1, const VxVector &B2, const VxVector &N1) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectFaceDispatchTable()->faceFace(A0, A1, A2, N0, B0, B1, B2, N1);
 }
 
@@ -666,12 +680,16 @@ int coplanar_tri_tri(const VxVector &N, const VxVector &V0, const VxVector &V1,
     return 0;
 }
 
-void VxIntersectFaceDispatchRebuild(bool useSIMD) {
+void VxIntersectFaceDispatchRebuild(int effectiveMode) {
+    static_assert(sizeof(VxIntersectFaceDispatchTable) ==
+                      sizeof(void *) * (sizeof(kVxIntersectFaceDispatchEntries) / sizeof(const char *)),
+                  "every intersect face dispatch function pointer needs an entry name");
 #if defined(VX_SIMD_SSE)
-    const VxIntersectFaceDispatchTable *next = useSIMD ? &kVxIntersectFaceDispatchSIMD : &kVxIntersectFaceDispatchScalar;
+    const VxIntersectFaceDispatchTable *simd = &kVxIntersectFaceDispatchSIMD;
 #else
-    (void) useSIMD;
-    const VxIntersectFaceDispatchTable *next = &kVxIntersectFaceDispatchScalar;
+    const VxIntersectFaceDispatchTable *simd = nullptr;
 #endif
-    g_VxIntersectFaceDispatch.store(next, std::memory_order_release);
+    g_VxIntersectFaceDispatch.store(
+        VxSIMDDispatchCompose(kVxIntersectFaceDispatchModule, effectiveMode, kVxIntersectFaceDispatchScalar, simd),
+        std::memory_order_release);
 }
@@ -9,7 +9,9 @@
 #include "VxMatrix.h"
 #include "VxAtomic.h"
 #include "VxSIMD.h"
+#include "VxSIMDDispatchInternal.h"
 #include "VxIntersectDispatchStateInternal.h"
+#include "VxPerfCountersInternal.h"
 
 static inline XBOOL VxFrustumOBBAxisTest(
     const VxVector &axis,
@@ -174,6 +176,17 @@ const VxIntersectFrustumDispatchTable kVxIntersectFrustumDispatchSIMD = {
 };
 #endif
 
+const char *const kVxIntersectFrustumDispatchEntries[] = {
+    "frustumFace",
+    "frustumOBB",
+    "frustumBox"
+};
+
+const VxSIMDDispatchModule kVxIntersectFrustumDispatchModule = {
+    "intersect", kVxIntersectFrustumDispatchEntries,
+    sizeof(kVxIntersectFrustumDispatchEntries) / sizeof(kVxIntersectFrustumDispatchEntries[0])
+};
+
 std::atomic<const VxIntersectFrustumDispatchTable *> g_VxIntersectFrustumDispatch(&kVxIntersectFrustumDispatchScalar);
 
 const VxIntersectFrustumDispatchTable *GetVxIntersectFrustumDispatchTable() {
@@ -398,17 +411,22 @@ static XBOOL FrustumBoxSIMDCore(const VxFrustum &frustum, const VxBbox &box, con
 
 } // namespace
 
-void VxIntersectFrustumDispatchRebuild(bool useSIMD) {
+void VxIntersectFrustumDispatchRebuild(int effectiveMode) {
+    static_assert(sizeof(VxIntersectFrustumDispatchTable) ==
+                      sizeof(void *) * (sizeof(kVxIntersectFrustumDispatchEntries) / sizeof(const char *)),
+                  "every intersect frustum dispatch function pointer needs an entry name");
 #if defined(VX_SIMD_SSE)
-    const VxIntersectFrustumDispatchTable *next = useSIMD ? &kVxIntersectFrustumDispatchSIMD : &kVxIntersectFrustumDispatchScalar;
+    const VxIntersectFrustumDispatchTable *simd = &kVxIntersectFrustumDispatchSIMD;
 #else
-    (void) useSIMD;
-    const VxIntersectFrustumDispatchTable *next = &kVxIntersectFrustumDispatchScalar;
+    const VxIntersectFrustumDispatchTable *simd = nullptr;
 #endif
-    g_VxIntersectFrustumDispatch.store(next, std::memory_order_release);
+    g_VxIntersectFrustumDispatch.store(
+        VxSIMDDispatchCompose(kVxIntersectFrustumDispatchModule, effectiveMode, kVxIntersectFrustumDispatchScalar, simd),
+        std::memory_order_release);
 }
 
 XBOOL VxIntersect::FrustumFace(const VxFrustum &frustum, const VxVector &pt0, const VxVector &pt1, const VxVector &pt2) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectFrustumDispatchTable()->frustumFace(frustum, pt0, pt1, pt2);
 }
 
@@ -420,11 +438,13 @@ XBOOL VxIntersect::FrustumAABB(const VxFrustum &frustum, const VxBbox &box) {
 }
 
 XBOOL VxIntersect::FrustumOBB(const VxFrustum &frustum, const VxBbox &box, const VxMatrix &mat) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectFrustumDispatchTable()->frustumOBB(frustum, box, mat);
 }
 
 // Intersection Frustum - Box (deprecated, alias for FrustumOBB)
 XBOOL VxIntersect::FrustumBox(const VxFrustum &frustum, const VxBbox &box, const VxMatrix &mat) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectFrustumDispatchTable()->frustumBox(frustum, box, mat);
 }
 
@@ -7,7 +7,9 @@
 #include "VxPlane.h"
 #include "VxAtomic.h"
 #include "VxSIMD.h"
+#include "VxSIMDDispatchInternal.h"
 #include "VxIntersectDispatchStateInternal.h"
+#include "VxPerfCountersInternal.h"
 
 constexpr float kPlaneParallelEps = EPSILON;
 constexpr float kSegmentMaxT = 1.0f + EPSILON;
@@ -99,6 +101,22 @@ const VxIntersectPlaneDispatchTable kVxIntersectPlaneDispatchSIMD = {
 };
 #endif
 
+const char *const kVxIntersectPlaneDispatchEntries[] = {
+    "rayPlane",
+    "rayPlaneCulled",
+    "segmentPlane",
+    "segmentPlaneCulled",
+    "linePlane",
+    "boxPlane",
+    "boxPlaneMatrix",
+    "planes"
+};
+
+const VxSIMDDispatchModule kVxIntersectPlaneDispatchModule = {
+    "intersect", kVxIntersectPlaneDispatchEntries,
+    sizeof(kVxIntersectPlaneDispatchEntries) / sizeof(kVxIntersectPlaneDispatchEntries[0])
+};
+
 std::atomic<const VxIntersectPlaneDispatchTable *> g_VxIntersectPlaneDispatch(&kVxIntersectPlaneDispatchScalar);
 
 const VxIntersectPlaneDispatchTable *GetVxIntersectPlaneDispatchTable() {
@@ -370,46 +388,58 @@ static XBOOL PlanesSIMDCore(const VxPlane &plane1, const VxPlane &plane2, const
 
 } // namespace
 
-void VxIntersectPlaneDispatchRebuild(bool useSIMD) {
+void VxIntersectPlaneDispatchRebuild(int effectiveMode) {
+    static_assert(sizeof(VxIntersectPlaneDispatchTable) ==
+                      sizeof(void *) * (sizeof(kVxIntersectPlaneDispatchEntries) / sizeof(const char *)),
+                  "every intersect plane dispatch function pointer needs an entry name");
 #if defined(VX_SIMD_SSE)
-    const VxIntersectPlaneDispatchTable *next = useSIMD ? &kVxIntersectPlaneDispatchSIMD : &kVxIntersectPlaneDispatchScalar;
+    const VxIntersectPlaneDispatchTable *simd = &kVxIntersectPlaneDispatchSIMD;
 #else
-    (void) useSIMD;
-    const VxIntersectPlaneDispatchTable *next = &kVxIntersectPlaneDispatchScalar;
+    const VxIntersectPlaneDispatchTable *simd = nullptr;
 #endif
-    g_VxIntersectPlaneDispatch.store(next, std::memory_order_release);
+    g_VxIntersectPlaneDispatch.store(
+        VxSIMDDispatchCompose(kVxIntersectPlaneDispatchModule, effectiveMode, kVxIntersectPlaneDispatchScalar, simd),
+        std::memory_order_release);
 }
 
 //---------- Planes
 
 XBOOL VxIntersect::RayPlane(const VxRay &ray, const VxPlane &plane, VxVector &point, float &dist) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_RAY_QUERIES, 1);
     return GetVxIntersectPlaneDispatchTable()->rayPlane(ray, plane, point, dist);
 }
 
 XBOOL VxIntersect::RayPlaneCulled(const VxRay &ray, const VxPlane &plane, VxVector &point, float &dist) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_RAY_QUERIES, 1);
     return GetVxIntersectPlaneDispatchTable()->rayPlaneCulled(ray, plane, point, dist);
 }
 
 XBOOL VxIntersect::SegmentPlane(const VxRay &ray, const VxPlane &plane, VxVector &point, float &dist) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_RAY_QUERIES, 1);
     return GetVxIntersectPlaneDispatchTable()->segmentPlane(ray, plane, point, dist);
 }
 
 XBOOL VxIntersect::SegmentPlaneCulled(const VxRay &ray, const VxPlane &plane, VxVector &point, float &dist) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_RAY_QUERIES, 1);
     return GetVxIntersectPlaneDispatchTable()->segmentPlaneCulled(ray, plane, point, dist);
 }
 
 XBOOL VxIntersect::LinePlane(const VxRay &ray, const VxPlane &plane, VxVector &point, float &dist) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_RAY_QUERIES, 1);
     return GetVxIntersectPlaneDispatchTable()->linePlane(ray, plane, point, dist);
 }
 
 XBOOL VxIntersect::BoxPlane(const VxBbox &box, const VxPlane &plane) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectPlaneDispatchTable()->boxPlane(box, plane);
 }
 
 XBOOL VxIntersect::BoxPlane(const VxBbox &box, const VxMatrix &mat, const VxPlane &plane) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectPlaneDispatchTable()->boxPlaneMatrix(box, mat, plane);
 }
 
 XBOOL VxIntersect::Planes(const VxPlane &plane1, const VxPlane &plane2, const VxPlane &plane3, VxVector &p) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectPlaneDispatchTable()->planes(plane1, plane2, plane3, p);
 }
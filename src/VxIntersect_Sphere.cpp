@@ -7,7 +7,9 @@
 #include "VxSphere.h"
 #include "VxAtomic.h"
 #include "VxSIMD.h"
+#include "VxSIMDDispatchInternal.h"
 #include "VxIntersectDispatchStateInternal.h"
+#include "VxPerfCountersInternal.h"
 
 #if defined(VX_SIMD_SSE)
 static inline float VxSIMDExtractX(__m128 v) {
@@ -122,6 +124,17 @@ const VxIntersectSphereDispatchTable kVxIntersectSphereDispatchSIMD = {
 };
 #endif
 
+const char *const kVxIntersectSphereDispatchEntries[] = {
+    "sphereSphere",
+    "raySphere",
+    "sphereAABB"
+};
+
+const VxSIMDDispatchModule kVxIntersectSphereDispatchModule = {
+    "intersect", kVxIntersectSphereDispatchEntries,
+    sizeof(kVxIntersectSphereDispatchEntries) / sizeof(kVxIntersectSphereDispatchEntries[0])
+};
+
 std::atomic<const VxIntersectSphereDispatchTable *> g_VxIntersectSphereDispatch(&kVxIntersectSphereDispatchScalar);
 
 const VxIntersectSphereDispatchTable *GetVxIntersectSphereDispatchTable() {
@@ -330,28 +343,35 @@ static XBOOL SphereAABBMSIMDCore(const VxSphere &iSphere, const VxBbox &iBox) {
 
 } // namespace
 
-void VxIntersectSphereDispatchRebuild(bool useSIMD) {
+void VxIntersectSphereDispatchRebuild(int effectiveMode) {
+    static_assert(sizeof(VxIntersectSphereDispatchTable) ==
+                      sizeof(void *) * (sizeof(kVxIntersectSphereDispatchEntries) / sizeof(const char *)),
+                  "every intersect sphere dispatch function pointer needs an entry name");
 #if defined(VX_SIMD_SSE)
-    const VxIntersectSphereDispatchTable *next = useSIMD ? &kVxIntersectSphereDispatchSIMD : &kVxIntersectSphereDispatchScalar;
+    const VxIntersectSphereDispatchTable *simd = &kVxIntersectSphereDispatchSIMD;
 #else
-    (void) useSIMD;
-    const VxIntersectSphereDispatchTable *next = &kVxIntersectSphereDispatchScalar;
+    const VxIntersectSphereDispatchTable *simd = nullptr;
 #endif
-    g_VxIntersectSphereDispatch.store(next, std::memory_order_release);
+    g_VxIntersectSphereDispatch.store(
+        VxSIMDDispatchCompose(kVxIntersectSphereDispatchModule, effectiveMode, kVxIntersectSphereDispatchScalar, simd),
+        std::memory_order_release);
 }
 
 //--------- Spheres
 
 XBOOL VxIntersect::SphereSphere(const VxSphere &iS1, const VxVector &iP1, const VxSphere &iS2, const VxVector &iP2,
                                 float *oCollisionTime1, float *oCollisionTime2) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectSphereDispatchTable()->sphereSphere(iS1, iP1, iS2, iP2, oCollisionTime1, oCollisionTime2);
 }
 
 int VxIntersect::RaySphere(const VxRay &iRay, const VxSphere &iSphere, VxVector *oInter1, VxVector *oInter2) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_RAY_QUERIES, 1);
     return GetVxIntersectSphereDispatchTable()->raySphere(iRay, iSphere, oInter1, oInter2);
 }
 
 XBOOL VxIntersect::SphereAABB(const VxSphere &iSphere, const VxBbox &iBox) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_VOLUME_QUERIES, 1);
     return GetVxIntersectSphereDispatchTable()->sphereAABB(iSphere, iBox);
 }
 
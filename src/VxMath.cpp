@@ -226,6 +226,22 @@ const VxMathDispatchTable kVxMathDispatchSIMD = {
 };
 #endif
 
+const char *const kVxMathDispatchEntries[] = {
+    "interpolateFloatArray",
+    "interpolateVectorArray",
+    "fillStructure",
+    "copyStructure",
+    "indexedCopy",
+    "ptInRect",
+    "transformBox2D",
+    "projectBoxZExtents",
+    "projectPointsToAxesExtents"
+};
+
+const VxSIMDDispatchModule kVxMathDispatchModule = {
+    "math", kVxMathDispatchEntries, sizeof(kVxMathDispatchEntries) / sizeof(kVxMathDispatchEntries[0])
+};
+
 std::atomic<const VxMathDispatchTable *> g_VxMathDispatch(&kVxMathDispatchScalar);
 
 const VxMathDispatchTable *GetVxMathDispatchTable() {
@@ -234,14 +250,16 @@ const VxMathDispatchTable *GetVxMathDispatchTable() {
 }
 
 void VxMathDispatchRebuild(int effectiveMode) {
-    const bool useSIMD = (effectiveMode != VX_SIMD_MODE_NONE);
+    static_assert(sizeof(VxMathDispatchTable) ==
+                      sizeof(void *) * (sizeof(kVxMathDispatchEntries) / sizeof(const char *)),
+                  "every math dispatch function pointer needs an entry name");
 #if defined(VX_SIMD_SSE)
-    const VxMathDispatchTable *next = useSIMD ? &kVxMathDispatchSIMD : &kVxMathDispatchScalar;
+    const VxMathDispatchTable *simd = &kVxMathDispatchSIMD;
 #else
-    (void) useSIMD;
-    const VxMathDispatchTable *next = &kVxMathDispatchScalar;
+    const VxMathDispatchTable *simd = nullptr;
 #endif
-    g_VxMathDispatch.store(next, std::memory_order_release);
+    g_VxMathDispatch.store(VxSIMDDispatchCompose(kVxMathDispatchModule, effectiveMode, kVxMathDispatchScalar, simd),
+                           std::memory_order_release);
 }
 
 void InitVxMath() {
@@ -866,6 +884,7 @@ XBOOL VxPtInRect(CKRECT *rect, CKPOINT *pt) {
 }
 
 XBOOL VxComputeBestFitBBox(const XBYTE *Points, XDWORD Stride, int Count, VxMatrix &BBoxMatrix, float AdditionalBorder) {
+    VX_PROFILE_SCOPE("VxComputeBestFitBBox");
     if (Count > 0 && Points) {
         // Create and compute covariance matrix
         VxEigenMatrix eigenMat;
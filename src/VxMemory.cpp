@@ -3,26 +3,34 @@
 #include <stdlib.h>
 #include <stdint.h>
 
+#include "VxPerfCountersInternal.h"
+
 // Basic memory allocation functions
 void *mynew(size_t n) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_ALLOC_CALLS, 1);
+    VX_PERF_COUNT(VX_PERFCOUNTER_ALLOC_BYTES, n);
     void *ptr = operator new(n);
     return ptr;
 }
 
 void mydelete(void *a) {
     if (a) {
+        VX_PERF_COUNT(VX_PERFCOUNTER_FREE_CALLS, 1);
         operator delete(a);
     }
 }
 
 // Array allocation functions
 void *mynewarray(size_t n) {
+    VX_PERF_COUNT(VX_PERFCOUNTER_ALLOC_CALLS, 1);
+    VX_PERF_COUNT(VX_PERFCOUNTER_ALLOC_BYTES, n);
     void *ptr = operator new[](n);
     return ptr;
 }
 
 void mydeletearray(void *a) {
     if (a) {
+        VX_PERF_COUNT(VX_PERFCOUNTER_FREE_CALLS, 1);
         operator delete[](a);
     }
 }
@@ -39,6 +47,8 @@ void *VxNewAligned(size_t size, size_t align) {
         }
         effectiveAlign = pow2;
     }
+    VX_PERF_COUNT(VX_PERFCOUNTER_ALLOC_CALLS, 1);
+    VX_PERF_COUNT(VX_PERFCOUNTER_ALLOC_BYTES, size);
 
 #if defined(_MSC_VER)
     return _aligned_malloc(size, effectiveAlign);
@@ -56,6 +66,9 @@ void *VxNewAligned(size_t size, size_t align) {
 }
 
 void VxDeleteAligned(void *ptr) {
+    if (ptr) {
+        VX_PERF_COUNT(VX_PERFCOUNTER_FREE_CALLS, 1);
+    }
 #if defined(_MSC_VER)
     _aligned_free(ptr);
 #else
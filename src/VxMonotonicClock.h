@@ -0,0 +1,34 @@
+#ifndef VXMONOTONICCLOCK_H
+#define VXMONOTONICCLOCK_H
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+// Nanoseconds from a monotonic clock, shared by the profiler and the
+// performance counters.
+inline uint64_t VxMonotonicNowNs() {
+#if defined(_WIN32)
+    static LARGE_INTEGER frequency = {};
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return static_cast<uint64_t>(counter.QuadPart / frequency.QuadPart) * 1000000000ull +
+           static_cast<uint64_t>(counter.QuadPart % frequency.QuadPart) * 1000000000ull / frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+#endif
+}
+
+#endif // VXMONOTONICCLOCK_H
@@ -0,0 +1,240 @@
+#include "VxPerfCountersInternal.h"
+
+#include <stdio.h>
+
+#include "VxMath.h"
+#include "VxMutex.h"
+
+std::atomic<int> g_VxPerfCountersEnabled(0);
+
+namespace {
+
+const int kBlitFieldCount = 4; // calls, pixels, bytes, nanoseconds
+
+const char *const kPerfCounterNames[VX_PERFCOUNTER_COUNT] = {
+    "ray_queries",
+    "volume_queries",
+    "distance_queries",
+    "hashtable_rehashes",
+    "alloc_calls",
+    "alloc_bytes",
+    "free_calls",
+};
+
+// Only the owning thread writes a shard, so an update is a plain relaxed
+// load/store pair rather than a locked read-modify-write. Readers sum the
+// shards and subtract the baseline recorded by the last reset.
+struct PerfShard {
+    std::atomic<uint64_t> counters[VX_PERFCOUNTER_COUNT];
+    std::atomic<uint64_t> blits[MAX_PIXEL_FORMATS][MAX_PIXEL_FORMATS][kBlitFieldCount];
+    uint64_t counterBase[VX_PERFCOUNTER_COUNT];
+    uint64_t blitBase[MAX_PIXEL_FORMATS][MAX_PIXEL_FORMATS][kBlitFieldCount];
+    PerfShard *next;
+
+    PerfShard() : next(NULL) {
+        for (int i = 0; i < VX_PERFCOUNTER_COUNT; ++i) {
+            counters[i].store(0, std::memory_order_relaxed);
+            counterBase[i] = 0;
+        }
+        for (int s = 0; s < MAX_PIXEL_FORMATS; ++s) {
+            for (int d = 0; d < MAX_PIXEL_FORMATS; ++d) {
+                for (int f = 0; f < kBlitFieldCount; ++f) {
+                    blits[s][d][f].store(0, std::memory_order_relaxed);
+                    blitBase[s][d][f] = 0;
+                }
+            }
+        }
+    }
+};
+
+// Shards are chained rather than kept in an XArray so that registering one
+// never goes through the counted allocator.
+struct PerfCounterState {
+    VxMutex lock;
+    PerfShard *shards;
+
+    PerfCounterState() : shards(NULL) {}
+
+    ~PerfCounterState() {
+        while (shards) {
+            PerfShard *next = shards->next;
+            delete shards;
+            shards = next;
+        }
+    }
+};
+
+PerfCounterState &GetPerfCounterState() {
+    static PerfCounterState state;
+    return state;
+}
+
+// Shards outlive their threads so their counts stay in the totals.
+PerfShard *GetThreadShard() {
+    static thread_local PerfShard *t_Shard = NULL;
+    if (!t_Shard) {
+        PerfShard *shard = new PerfShard;
+        PerfCounterState &state = GetPerfCounterState();
+        VxMutexLock lock(state.lock);
+        shard->next = state.shards;
+        state.shards = shard;
+        t_Shard = shard;
+    }
+    return t_Shard;
+}
+
+inline void Bump(std::atomic<uint64_t> &counter, uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+int PerfFormatIndex(const VxImageDescEx &desc) {
+    const int format = VxImageDesc2PixelFormat(desc);
+    return (format > 0 && format < MAX_PIXEL_FORMATS) ? format : UNKNOWN_PF;
+}
+
+uint64_t RectPixels(const VxImageDescEx &desc, const CKRECT *rect) {
+    if (rect) {
+        const int width = rect->right - rect->left;
+        const int height = rect->bottom - rect->top;
+        return (width > 0 && height > 0) ? (uint64_t) width * height : 0;
+    }
+    return (desc.Width > 0 && desc.Height > 0) ? (uint64_t) desc.Width * desc.Height : 0;
+}
+
+} // namespace
+
+void VxPerfRecordBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, const CKRECT *srcRect,
+                      const CKRECT *dstRect, uint64_t nanoseconds) {
+    const uint64_t srcPixels = RectPixels(src_desc, srcRect);
+    const uint64_t dstPixels = RectPixels(dst_desc, dstRect);
+    const uint64_t bytes = (srcPixels * src_desc.BitsPerPixel + dstPixels * dst_desc.BitsPerPixel) / 8;
+
+    std::atomic<uint64_t> *cell = GetThreadShard()->blits[PerfFormatIndex(src_desc)][PerfFormatIndex(dst_desc)];
+    Bump(cell[0], 1);
+    Bump(cell[1], dstPixels);
+    Bump(cell[2], bytes);
+    Bump(cell[3], nanoseconds);
+}
+
+void VxEnablePerfCounters(XBOOL enable) {
+    g_VxPerfCountersEnabled.store(enable ? 1 : 0, std::memory_order_release);
+}
+
+XBOOL VxArePerfCountersEnabled() {
+    return g_VxPerfCountersEnabled.load(std::memory_order_acquire) != 0;
+}
+
+void VxAddPerfCounter(VX_PERFCOUNTER counter, unsigned long long value) {
+    if (!VxPerfCountersActive() || counter < 0 || counter >= VX_PERFCOUNTER_COUNT) {
+        return;
+    }
+    Bump(GetThreadShard()->counters[counter], value);
+}
+
+void VxGetPerfCounters(VxPerfCounterSnapshot &snapshot) {
+    uint64_t blits[MAX_PIXEL_FORMATS][MAX_PIXEL_FORMATS][kBlitFieldCount] = {};
+    for (int i = 0; i < VX_PERFCOUNTER_COUNT; ++i) {
+        snapshot.Counters[i] = 0;
+    }
+
+    PerfCounterState &state = GetPerfCounterState();
+    {
+        VxMutexLock lock(state.lock);
+        for (PerfShard *shard = state.shards; shard; shard = shard->next) {
+            for (int i = 0; i < VX_PERFCOUNTER_COUNT; ++i) {
+                snapshot.Counters[i] += shard->counters[i].load(std::memory_order_relaxed) - shard->counterBase[i];
+            }
+            for (int s = 0; s < MAX_PIXEL_FORMATS; ++s) {
+                for (int d = 0; d < MAX_PIXEL_FORMATS; ++d) {
+                    for (int f = 0; f < kBlitFieldCount; ++f) {
+                        blits[s][d][f] += shard->blits[s][d][f].load(std::memory_order_relaxed) - shard->blitBase[s][d][f];
+                    }
+                }
+            }
+        }
+    }
+
+    snapshot.Blits.Resize(0);
+    for (int s = 0; s < MAX_PIXEL_FORMATS; ++s) {
+        for (int d = 0; d < MAX_PIXEL_FORMATS; ++d) {
+            if (blits[s][d][0] == 0) {
+                continue;
+            }
+            VxPerfBlitCounters pair;
+            pair.SrcFormat = (VX_PIXELFORMAT) s;
+            pair.DstFormat = (VX_PIXELFORMAT) d;
+            pair.Calls = blits[s][d][0];
+            pair.Pixels = blits[s][d][1];
+            pair.Bytes = blits[s][d][2];
+            pair.Nanoseconds = blits[s][d][3];
+            snapshot.Blits.PushBack(pair);
+        }
+    }
+}
+
+void VxResetPerfCounters() {
+    PerfCounterState &state = GetPerfCounterState();
+    VxMutexLock lock(state.lock);
+    for (PerfShard *shard = state.shards; shard; shard = shard->next) {
+        for (int i = 0; i < VX_PERFCOUNTER_COUNT; ++i) {
+            shard->counterBase[i] = shard->counters[i].load(std::memory_order_relaxed);
+        }
+        for (int s = 0; s < MAX_PIXEL_FORMATS; ++s) {
+            for (int d = 0; d < MAX_PIXEL_FORMATS; ++d) {
+                for (int f = 0; f < kBlitFieldCount; ++f) {
+                    shard->blitBase[s][d][f] = shard->blits[s][d][f].load(std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+}
+
+const char *VxGetPerfCounterName(VX_PERFCOUNTER counter) {
+    if (counter < 0 || counter >= VX_PERFCOUNTER_COUNT) {
+        return NULL;
+    }
+    return kPerfCounterNames[counter];
+}
+
+XBOOL VxWritePerfCounters(const VxPerfCounterSnapshot &snapshot, const char *path, XBOOL json) {
+    if (!path) {
+        return FALSE;
+    }
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        return FALSE;
+    }
+
+    if (json) {
+        fprintf(file, "{\n  \"counters\": {");
+        for (int i = 0; i < VX_PERFCOUNTER_COUNT; ++i) {
+            fprintf(file, "%s\n    \"%s\": %llu", i ? "," : "", kPerfCounterNames[i], snapshot.Counters[i]);
+        }
+        fprintf(file, "\n  },\n  \"blits\": [");
+        for (int i = 0; i < snapshot.Blits.Size(); ++i) {
+            const VxPerfBlitCounters &pair = snapshot.Blits[i];
+            fprintf(file, "%s\n    {\"src\": \"%s\", \"dst\": \"%s\", \"calls\": %llu, \"pixels\": %llu, "
+                          "\"bytes\": %llu, \"nanoseconds\": %llu}",
+                    i ? "," : "", VxPixelFormat2String(pair.SrcFormat), VxPixelFormat2String(pair.DstFormat),
+                    pair.Calls, pair.Pixels, pair.Bytes, pair.Nanoseconds);
+        }
+        fprintf(file, "\n  ]\n}\n");
+    } else {
+        for (int i = 0; i < VX_PERFCOUNTER_COUNT; ++i) {
+            fprintf(file, "%-24s %20llu\n", kPerfCounterNames[i], snapshot.Counters[i]);
+        }
+        if (snapshot.Blits.Size() > 0) {
+            fprintf(file, "\n%-24s %-24s %10s %14s %10s %12s\n", "blit src", "dst", "calls", "pixels", "MB", "ms");
+        }
+        for (int i = 0; i < snapshot.Blits.Size(); ++i) {
+            const VxPerfBlitCounters &pair = snapshot.Blits[i];
+            fprintf(file, "%-24s %-24s %10llu %14llu %10.1f %12.3f\n", VxPixelFormat2String(pair.SrcFormat),
+                    VxPixelFormat2String(pair.DstFormat), pair.Calls, pair.Pixels, pair.Bytes / (1024.0 * 1024.0),
+                    pair.Nanoseconds / 1000000.0);
+        }
+    }
+
+    const bool failed = ferror(file) != 0;
+    fclose(file);
+    return failed ? FALSE : TRUE;
+}
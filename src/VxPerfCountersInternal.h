@@ -0,0 +1,59 @@
+#ifndef VXPERFCOUNTERSINTERNAL_H
+#define VXPERFCOUNTERSINTERNAL_H
+
+#include <atomic>
+#include <stdint.h>
+
+#include "VxPerfCounters.h"
+#include "VxMonotonicClock.h"
+
+struct VxImageDescEx;
+
+extern std::atomic<int> g_VxPerfCountersEnabled;
+
+inline bool VxPerfCountersActive() {
+    return g_VxPerfCountersEnabled.load(std::memory_order_relaxed) != 0;
+}
+
+/// Adds to a counter; costs one flag test while counters are off.
+#define VX_PERF_COUNT(counter, value)                                                                                 \
+    do {                                                                                                              \
+        if (VxPerfCountersActive()) VxAddPerfCounter(counter, value);                                                 \
+    } while (0)
+
+void VxPerfRecordBlit(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, const CKRECT *srcRect,
+                      const CKRECT *dstRect, uint64_t nanoseconds);
+
+/**
+ * Times one public blit entry point and adds it to its format pair when
+ * counters are on. Rectangles, when given, limit the counted pixels.
+ */
+class VxPerfBlitScope {
+public:
+    VxPerfBlitScope(const VxImageDescEx &src_desc, const VxImageDescEx &dst_desc, const CKRECT *srcRect = NULL,
+                    const CKRECT *dstRect = NULL)
+        : m_Src(NULL), m_Dst(&dst_desc), m_SrcRect(srcRect), m_DstRect(dstRect), m_Start(0) {
+        if (VxPerfCountersActive()) {
+            m_Src = &src_desc;
+            m_Start = VxMonotonicNowNs();
+        }
+    }
+
+    ~VxPerfBlitScope() {
+        if (m_Src) {
+            VxPerfRecordBlit(*m_Src, *m_Dst, m_SrcRect, m_DstRect, VxMonotonicNowNs() - m_Start);
+        }
+    }
+
+private:
+    VxPerfBlitScope(const VxPerfBlitScope &);
+    VxPerfBlitScope &operator=(const VxPerfBlitScope &);
+
+    const VxImageDescEx *m_Src;
+    const VxImageDescEx *m_Dst;
+    const CKRECT *m_SrcRect;
+    const CKRECT *m_DstRect;
+    uint64_t m_Start;
+};
+
+#endif // VXPERFCOUNTERSINTERNAL_H
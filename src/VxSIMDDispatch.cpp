@@ -1,11 +1,15 @@
 #include "VxSIMDDispatchInternal.h"
 
+#include <stdio.h>
+#include <string.h>
+
 #include "VxAtomic.h"
 #include "VxBlitDispatchBridge.h"
 
 #include "VxMath.h"
 #include "VxMutex.h"
 #include "VxSIMD.h"
+#include "XArray.h"
 
 namespace {
 
@@ -35,7 +39,10 @@ bool IsValidSIMDMode(int mode) {
            mode == VX_SIMD_MODE_SSSE3 ||
            mode == VX_SIMD_MODE_SSE4_1 ||
            mode == VX_SIMD_MODE_AVX ||
-           mode == VX_SIMD_MODE_AVX2;
+           mode == VX_SIMD_MODE_AVX2 ||
+           mode == VX_SIMD_MODE_AVX512 ||
+           mode == VX_SIMD_MODE_NEON ||
+           mode == VX_SIMD_MODE_WASM_SIMD128;
 }
 
 bool IsSIMDModeAvailable(int mode, const VxSIMDFeatures &features) {
@@ -78,18 +85,93 @@ bool IsSIMDModeAvailable(int mode, const VxSIMDFeatures &features) {
             return false;
 #endif
 
+        case VX_SIMD_MODE_AVX512:
+#if defined(VX_SIMD_AVX512)
+            return features.AVX2 && features.AVX512F && features.AVX512BW &&
+                   features.AVX512VL && features.AVX512VBMI;
+#else
+            return false;
+#endif
+
+        case VX_SIMD_MODE_NEON:
+#if defined(VX_SIMD_NEON) && defined(VX_SIMD_SSE2)
+            return features.NEON;
+#else
+            return false;
+#endif
+
+        case VX_SIMD_MODE_WASM_SIMD128:
+#if defined(VX_SIMD_WASM_SIMD128) && defined(VX_SIMD_SSE2)
+            return features.WASM_SIMD128;
+#else
+            return false;
+#endif
+
         default:
             return false;
     }
 }
 
-int ResolveSIMDModeFromChain(const int *chain, int count, const VxSIMDFeatures &features) {
-    for (int i = 0; i < count; ++i) {
-        if (IsSIMDModeAvailable(chain[i], features)) {
-            return chain[i];
-        }
+// Fallback chain of a requested mode, best first and ending with NONE.
+const int *GetSIMDModeChain(int requestedMode, int &count) {
+    static const int kAutoChain[] = {
+        VX_SIMD_MODE_AVX512,
+        VX_SIMD_MODE_AVX2,
+        VX_SIMD_MODE_AVX,
+        VX_SIMD_MODE_SSE4_1,
+        VX_SIMD_MODE_SSSE3,
+        VX_SIMD_MODE_SSE2,
+        VX_SIMD_MODE_NEON,
+        VX_SIMD_MODE_WASM_SIMD128,
+        VX_SIMD_MODE_NONE
+    };
+    // AVX512 -> ... -> NONE; every x86 mode falls back along this suffix.
+    static const int kX86Chain[] = {
+        VX_SIMD_MODE_AVX512,
+        VX_SIMD_MODE_AVX2,
+        VX_SIMD_MODE_AVX,
+        VX_SIMD_MODE_SSE4_1,
+        VX_SIMD_MODE_SSSE3,
+        VX_SIMD_MODE_SSE2,
+        VX_SIMD_MODE_NONE
+    };
+    static const int kNeonChain[] = {VX_SIMD_MODE_NEON, VX_SIMD_MODE_NONE};
+    static const int kWasmChain[] = {VX_SIMD_MODE_WASM_SIMD128, VX_SIMD_MODE_NONE};
+    static const int kNoneChain[] = {VX_SIMD_MODE_NONE};
+    const int x86Count = sizeof(kX86Chain) / sizeof(kX86Chain[0]);
+
+    switch (requestedMode) {
+        case VX_SIMD_MODE_AUTO:
+            count = sizeof(kAutoChain) / sizeof(kAutoChain[0]);
+            return kAutoChain;
+        case VX_SIMD_MODE_AVX512:
+            count = x86Count;
+            return kX86Chain;
+        case VX_SIMD_MODE_AVX2:
+            count = x86Count - 1;
+            return kX86Chain + 1;
+        case VX_SIMD_MODE_AVX:
+            count = x86Count - 2;
+            return kX86Chain + 2;
+        case VX_SIMD_MODE_SSE4_1:
+            count = x86Count - 3;
+            return kX86Chain + 3;
+        case VX_SIMD_MODE_SSSE3:
+            count = x86Count - 4;
+            return kX86Chain + 4;
+        case VX_SIMD_MODE_SSE2:
+            count = x86Count - 5;
+            return kX86Chain + 5;
+        case VX_SIMD_MODE_NEON:
+            count = 2;
+            return kNeonChain;
+        case VX_SIMD_MODE_WASM_SIMD128:
+            count = 2;
+            return kWasmChain;
+        default:
+            count = 1;
+            return kNoneChain;
     }
-    return VX_SIMD_MODE_NONE;
 }
 
 int ResolveSIMDMode(int requestedMode, const VxSIMDFeatures &features) {
@@ -97,69 +179,13 @@ int ResolveSIMDMode(int requestedMode, const VxSIMDFeatures &features) {
         requestedMode = VX_SIMD_MODE_AUTO;
     }
 
-    if (requestedMode == VX_SIMD_MODE_AUTO) {
-        static const int kAutoChain[] = {
-            VX_SIMD_MODE_AVX2,
-            VX_SIMD_MODE_AVX,
-            VX_SIMD_MODE_SSE4_1,
-            VX_SIMD_MODE_SSSE3,
-            VX_SIMD_MODE_SSE2,
-            VX_SIMD_MODE_NONE
-        };
-        return ResolveSIMDModeFromChain(kAutoChain, sizeof(kAutoChain) / sizeof(kAutoChain[0]), features);
-    }
-
-    if (requestedMode == VX_SIMD_MODE_NONE) {
-        return VX_SIMD_MODE_NONE;
-    }
-
-    if (requestedMode == VX_SIMD_MODE_SSE2) {
-        static const int kChain[] = {VX_SIMD_MODE_SSE2, VX_SIMD_MODE_NONE};
-        return ResolveSIMDModeFromChain(kChain, sizeof(kChain) / sizeof(kChain[0]), features);
-    }
-
-    if (requestedMode == VX_SIMD_MODE_SSSE3) {
-        static const int kChain[] = {
-            VX_SIMD_MODE_SSSE3,
-            VX_SIMD_MODE_SSE2,
-            VX_SIMD_MODE_NONE
-        };
-        return ResolveSIMDModeFromChain(kChain, sizeof(kChain) / sizeof(kChain[0]), features);
-    }
-
-    if (requestedMode == VX_SIMD_MODE_SSE4_1) {
-        static const int kChain[] = {
-            VX_SIMD_MODE_SSE4_1,
-            VX_SIMD_MODE_SSSE3,
-            VX_SIMD_MODE_SSE2,
-            VX_SIMD_MODE_NONE
-        };
-        return ResolveSIMDModeFromChain(kChain, sizeof(kChain) / sizeof(kChain[0]), features);
-    }
-
-    if (requestedMode == VX_SIMD_MODE_AVX) {
-        static const int kChain[] = {
-            VX_SIMD_MODE_AVX,
-            VX_SIMD_MODE_SSE4_1,
-            VX_SIMD_MODE_SSSE3,
-            VX_SIMD_MODE_SSE2,
-            VX_SIMD_MODE_NONE
-        };
-        return ResolveSIMDModeFromChain(kChain, sizeof(kChain) / sizeof(kChain[0]), features);
-    }
-
-    if (requestedMode == VX_SIMD_MODE_AVX2) {
-        static const int kChain[] = {
-            VX_SIMD_MODE_AVX2,
-            VX_SIMD_MODE_AVX,
-            VX_SIMD_MODE_SSE4_1,
-            VX_SIMD_MODE_SSSE3,
-            VX_SIMD_MODE_SSE2,
-            VX_SIMD_MODE_NONE
-        };
-        return ResolveSIMDModeFromChain(kChain, sizeof(kChain) / sizeof(kChain[0]), features);
+    int count = 0;
+    const int *chain = GetSIMDModeChain(requestedMode, count);
+    for (int i = 0; i < count; ++i) {
+        if (IsSIMDModeAvailable(chain[i], features)) {
+            return chain[i];
+        }
     }
-
     return VX_SIMD_MODE_NONE;
 }
 
@@ -193,6 +219,265 @@ void EnsureInitialized() {
     EnsureInitializedLocked(state);
 }
 
+// Module tables register on their first rebuild; the registry calls need
+// every module listed.
+void EnsureRegisteredLocked(SIMDDispatchState &state) {
+    EnsureInitializedLocked(state);
+    if (VxAtomicLoadInt(&state.generation) == 0) {
+        RebuildAllLocked(state);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Per-function registry
+//------------------------------------------------------------------------------
+
+struct SIMDDispatchEntry {
+    const VxSIMDDispatchModule *module;
+    char *name; // "<module>.<entry>"
+    int overrideMode;
+    int boundMode;
+    unsigned int candidates;
+};
+
+struct SIMDComposedTable {
+    const VxSIMDDispatchModule *module;
+    unsigned int mask; // Bit i set: entry i bound from the SIMD table
+    XBYTE *table;
+};
+
+// Nothing here is ever freed: composed tables are read without a lock and
+// entry names are handed out by VxGetSIMDDispatchEntry().
+struct SIMDDispatchRegistry {
+    VxMutex lock; // Leaf lock, taken under the dispatch and blit engine locks
+    XArray<SIMDDispatchEntry> entries;
+    XArray<SIMDComposedTable> composed;
+};
+
+SIMDDispatchRegistry &GetSIMDDispatchRegistry() {
+    static SIMDDispatchRegistry registry;
+    return registry;
+}
+
+// Index of the first entry of @a module, registering its entries on first use.
+int FindModuleEntriesLocked(SIMDDispatchRegistry &registry, const VxSIMDDispatchModule &module) {
+    for (int i = 0; i < registry.entries.Size(); ++i) {
+        if (registry.entries[i].module == &module) {
+            return i;
+        }
+    }
+
+    const int first = registry.entries.Size();
+    for (int i = 0; i < module.count; ++i) {
+        SIMDDispatchEntry entry;
+        const size_t length = strlen(module.name) + strlen(module.entries[i]) + 2;
+        entry.module = &module;
+        entry.name = new char[length];
+        snprintf(entry.name, length, "%s.%s", module.name, module.entries[i]);
+        entry.overrideMode = VX_SIMD_MODE_AUTO;
+        entry.boundMode = VX_SIMD_MODE_NONE;
+        entry.candidates = 1u << VX_SIMD_MODE_NONE;
+        registry.entries.PushBack(entry);
+    }
+    return first;
+}
+
+int FindEntryLocked(SIMDDispatchRegistry &registry, const char *name) {
+    for (int i = 0; i < registry.entries.Size(); ++i) {
+        if (strcmp(registry.entries[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// An override binds only where it lies on the fallback chain of the
+// effective mode; anything above it binds the effective mode instead.
+int ClampSIMDMode(int mode, int effectiveMode) {
+    if (mode == VX_SIMD_MODE_AUTO) {
+        return effectiveMode;
+    }
+
+    int count = 0;
+    const int *chain = GetSIMDModeChain(effectiveMode, count);
+    for (int i = 0; i < count; ++i) {
+        if (chain[i] == mode) {
+            return IsSIMDModeAvailable(mode, VxGetSIMDFeatures()) ? mode : effectiveMode;
+        }
+    }
+    return effectiveMode;
+}
+
+// Lowest SIMD mode available on this CPU; the SSE-based module tables are
+// reported under it.
+int BaselineSIMDMode() {
+    int count = 0;
+    const int *chain = GetSIMDModeChain(VX_SIMD_MODE_AUTO, count);
+    for (int i = count - 1; i >= 0; --i) {
+        if (chain[i] != VX_SIMD_MODE_NONE && IsSIMDModeAvailable(chain[i], VxGetSIMDFeatures())) {
+            return chain[i];
+        }
+    }
+    return VX_SIMD_MODE_NONE;
+}
+
+int FindSIMDModeByName(const char *name) {
+    for (int mode = VX_SIMD_MODE_AUTO; mode <= VX_SIMD_MODE_WASM_SIMD128; ++mode) {
+        if (strcmp(VxGetSIMDBackendName(mode), name) == 0) {
+            return mode;
+        }
+    }
+    return -1;
+}
+
+void ResetOverridesLocked(SIMDDispatchRegistry &registry) {
+    for (int i = 0; i < registry.entries.Size(); ++i) {
+        registry.entries[i].overrideMode = VX_SIMD_MODE_AUTO;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Calibration
+//------------------------------------------------------------------------------
+
+const int kCalibrationRuns = 5;
+
+// Each timed run repeats the workload so it is long enough to time reliably.
+const int kCalibrationRepeats = 4;
+
+// A candidate replaces the default binding only when it is this much faster,
+// so timer noise does not flip entries between equal kernels.
+const float kCalibrationMargin = 0.97f;
+
+// Header of a calibration cache; a cache is reused only on an identical one.
+void FormatCalibrationHeader(int effectiveMode, char *buffer, size_t size) {
+    const VxSIMDFeatures &f = VxGetSIMDFeatures();
+    const bool bits[] = {f.SSE, f.SSE2, f.SSE3, f.SSSE3, f.SSE4_1, f.SSE4_2, f.AVX, f.AVX2, f.FMA, f.AVX512F,
+                         f.AVX512BW, f.AVX512VL, f.AVX512VBMI, f.NEON, f.WASM_SIMD128};
+    XDWORD features = 0;
+    for (size_t i = 0; i < sizeof(bits) / sizeof(bits[0]); ++i) {
+        features |= bits[i] ? (1u << i) : 0u;
+    }
+    snprintf(buffer, size, "VxMath SIMD dispatch calibration 1\ncpu %s\nfeatures %08X\nbackend %s\n",
+             GetProcessorDescription(), features, VxGetSIMDBackendName(effectiveMode));
+}
+
+// Applies the overrides of a cache written by SaveCalibration().
+bool LoadCalibrationLocked(SIMDDispatchRegistry &registry, const char *path, const char *header) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+
+    char line[512];
+    const char *expected = header;
+    bool matches = true;
+    while (matches && *expected) {
+        const char *end = strchr(expected, '\n');
+        const size_t length = static_cast<size_t>(end - expected + 1);
+        matches = fgets(line, sizeof(line), file) && strlen(line) == length && strncmp(line, expected, length) == 0;
+        expected = end + 1;
+    }
+
+    if (matches) {
+        ResetOverridesLocked(registry);
+        char name[128];
+        char modeName[32];
+        while (fgets(line, sizeof(line), file)) {
+            if (sscanf(line, "%127s %31s", name, modeName) != 2) {
+                continue;
+            }
+            const int entry = FindEntryLocked(registry, name);
+            const int mode = FindSIMDModeByName(modeName);
+            if (entry >= 0 && mode >= 0 && (mode == VX_SIMD_MODE_AUTO || IsSIMDModeAvailable(mode, VxGetSIMDFeatures()))) {
+                registry.entries[entry].overrideMode = mode;
+            }
+        }
+    }
+    fclose(file);
+    return matches;
+}
+
+bool SaveCalibration(const SIMDDispatchRegistry &registry, const char *path, const char *header,
+                     const XArray<int> &calibrated) {
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+
+    fputs(header, file);
+    for (int i = 0; i < calibrated.Size(); ++i) {
+        const SIMDDispatchEntry &entry = registry.entries[calibrated[i]];
+        fprintf(file, "%s %s\n", entry.name, VxGetSIMDBackendName(entry.overrideMode));
+    }
+    return fclose(file) == 0;
+}
+
+// Best of kCalibrationRuns timings of an entry's workload, after a warm-up.
+float TimeProbe(const char *name) {
+    VxRunSIMDDispatchProbe(name);
+    float best = 0.0f;
+    for (int run = 0; run < kCalibrationRuns; ++run) {
+        VxTimeProfiler timer;
+        for (int repeat = 0; repeat < kCalibrationRepeats; ++repeat) {
+            VxRunSIMDDispatchProbe(name);
+        }
+        const float elapsed = timer.Current();
+        if (run == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+void SetEntryOverride(SIMDDispatchRegistry &registry, int index, int mode) {
+    VxMutexLock lock(registry.lock);
+    registry.entries[index].overrideMode = mode;
+}
+
+// Times every candidate of one entry and keeps the fastest bound. Returns
+// false when the entry has no workload or nothing to choose from.
+bool CalibrateEntryLocked(SIMDDispatchState &state, SIMDDispatchRegistry &registry, int index) {
+    const int effectiveMode = VxAtomicLoadInt(&state.effectiveMode);
+    int candidates[VX_SIMD_MODE_WASM_SIMD128 + 1];
+    int candidateCount = 0;
+    int defaultMode;
+    const char *name;
+    {
+        VxMutexLock lock(registry.lock);
+        const SIMDDispatchEntry &entry = registry.entries[index];
+        for (int mode = VX_SIMD_MODE_NONE; mode <= VX_SIMD_MODE_WASM_SIMD128; ++mode) {
+            if ((entry.candidates & (1u << mode)) && ClampSIMDMode(mode, effectiveMode) == mode) {
+                candidates[candidateCount++] = mode;
+            }
+        }
+        defaultMode = entry.boundMode;
+        name = entry.name;
+    }
+    if (candidateCount < 2 || !VxRunSIMDDispatchProbe(name)) {
+        return false;
+    }
+
+    int bestMode = VX_SIMD_MODE_AUTO;
+    float bestTime = TimeProbe(name) * kCalibrationMargin;
+    for (int i = 0; i < candidateCount; ++i) {
+        if (candidates[i] == defaultMode) {
+            continue;
+        }
+        SetEntryOverride(registry, index, candidates[i]);
+        RebuildAllLocked(state);
+        const float elapsed = TimeProbe(name);
+        if (elapsed < bestTime) {
+            bestTime = elapsed;
+            bestMode = candidates[i];
+        }
+    }
+
+    SetEntryOverride(registry, index, bestMode);
+    RebuildAllLocked(state);
+    return true;
+}
+
 } // namespace
 
 void VxSIMDDispatchInitialize() {
@@ -262,7 +547,204 @@ const char *VxGetSIMDBackendName(int mode) {
             return "avx";
         case VX_SIMD_MODE_AVX2:
             return "avx2";
+        case VX_SIMD_MODE_AVX512:
+            return "avx512";
+        case VX_SIMD_MODE_NEON:
+            return "neon";
+        case VX_SIMD_MODE_WASM_SIMD128:
+            return "wasm_simd128";
         default:
             return "unknown";
     }
 }
+
+//------------------------------------------------------------------------------
+// Per-function registry
+//------------------------------------------------------------------------------
+
+int VxGetSIMDAutoBackendInternal() {
+    return ResolveSIMDMode(VX_SIMD_MODE_AUTO, VxGetSIMDFeatures());
+}
+
+void VxSIMDDispatchResolve(const VxSIMDDispatchModule &module, int effectiveMode, int *modes) {
+    SIMDDispatchRegistry &registry = GetSIMDDispatchRegistry();
+    VxMutexLock lock(registry.lock);
+    const int first = FindModuleEntriesLocked(registry, module);
+    for (int i = 0; i < module.count; ++i) {
+        modes[i] = ClampSIMDMode(registry.entries[first + i].overrideMode, effectiveMode);
+    }
+}
+
+void VxSIMDDispatchPublish(const VxSIMDDispatchModule &module, const int *boundModes, const unsigned int *candidates) {
+    SIMDDispatchRegistry &registry = GetSIMDDispatchRegistry();
+    VxMutexLock lock(registry.lock);
+    const int first = FindModuleEntriesLocked(registry, module);
+    for (int i = 0; i < module.count; ++i) {
+        registry.entries[first + i].boundMode = boundModes[i];
+        registry.entries[first + i].candidates = candidates[i];
+    }
+}
+
+const void *VxSIMDDispatchComposeTable(const VxSIMDDispatchModule &module, int effectiveMode, const void *scalar,
+                                       const void *simd, size_t size) {
+    const int kMaxEntries = 32;
+    int modes[kMaxEntries];
+    int bound[kMaxEntries];
+    unsigned int candidates[kMaxEntries];
+    // Tables are one function pointer per entry (each module static_asserts
+    // this); anything else cannot be spliced slot by slot.
+    if (module.count > kMaxEntries || size != module.count * sizeof(void *)) {
+        return scalar;
+    }
+
+    VxSIMDDispatchResolve(module, effectiveMode, modes);
+    const int simdMode = BaselineSIMDMode();
+    const unsigned int fullMask = (module.count == 32) ? 0xFFFFFFFFu : ((1u << module.count) - 1u);
+    unsigned int mask = 0;
+    for (int i = 0; i < module.count; ++i) {
+        const bool useSIMD = simd && modes[i] != VX_SIMD_MODE_NONE;
+        mask |= useSIMD ? (1u << i) : 0u;
+        bound[i] = useSIMD ? simdMode : VX_SIMD_MODE_NONE;
+        candidates[i] = (1u << VX_SIMD_MODE_NONE) | (simd && simdMode != VX_SIMD_MODE_NONE ? 1u << simdMode : 0u);
+    }
+    VxSIMDDispatchPublish(module, bound, candidates);
+
+    if (mask == 0) {
+        return scalar;
+    }
+    if (mask == fullMask) {
+        return simd;
+    }
+
+    SIMDDispatchRegistry &registry = GetSIMDDispatchRegistry();
+    VxMutexLock lock(registry.lock);
+    for (int i = 0; i < registry.composed.Size(); ++i) {
+        if (registry.composed[i].module == &module && registry.composed[i].mask == mask) {
+            return registry.composed[i].table;
+        }
+    }
+
+    // Every entry is one function pointer, in declaration order.
+    const size_t slot = size / module.count;
+    SIMDComposedTable composed;
+    composed.module = &module;
+    composed.mask = mask;
+    composed.table = new XBYTE[size];
+    for (int i = 0; i < module.count; ++i) {
+        const XBYTE *from = static_cast<const XBYTE *>((mask & (1u << i)) ? simd : scalar);
+        memcpy(composed.table + i * slot, from + i * slot, slot);
+    }
+    registry.composed.PushBack(composed);
+    return composed.table;
+}
+
+int VxGetSIMDDispatchEntryCount() {
+    SIMDDispatchState &state = GetSIMDDispatchState();
+    VxMutexLock lock(state.lock);
+    EnsureRegisteredLocked(state);
+
+    SIMDDispatchRegistry &registry = GetSIMDDispatchRegistry();
+    VxMutexLock registryLock(registry.lock);
+    return registry.entries.Size();
+}
+
+XBOOL VxGetSIMDDispatchEntry(int index, VxSIMDDispatchEntryInfo &info) {
+    SIMDDispatchState &state = GetSIMDDispatchState();
+    VxMutexLock lock(state.lock);
+    EnsureRegisteredLocked(state);
+
+    SIMDDispatchRegistry &registry = GetSIMDDispatchRegistry();
+    VxMutexLock registryLock(registry.lock);
+    if (index < 0 || index >= registry.entries.Size()) {
+        return FALSE;
+    }
+
+    const SIMDDispatchEntry &entry = registry.entries[index];
+    info.Name = entry.name;
+    info.BoundMode = entry.boundMode;
+    info.OverrideMode = entry.overrideMode;
+    info.CandidateModes = entry.candidates;
+    return TRUE;
+}
+
+XBOOL VxSetSIMDDispatchEntryOverride(const char *name, int mode) {
+    if (!name || !IsValidSIMDMode(mode)) {
+        return FALSE;
+    }
+    if (mode != VX_SIMD_MODE_AUTO && !IsSIMDModeAvailable(mode, VxGetSIMDFeatures())) {
+        return FALSE;
+    }
+
+    SIMDDispatchState &state = GetSIMDDispatchState();
+    VxMutexLock lock(state.lock);
+    EnsureRegisteredLocked(state);
+
+    SIMDDispatchRegistry &registry = GetSIMDDispatchRegistry();
+    {
+        VxMutexLock registryLock(registry.lock);
+        const int index = FindEntryLocked(registry, name);
+        if (index < 0) {
+            return FALSE;
+        }
+        if (registry.entries[index].overrideMode == mode) {
+            return TRUE;
+        }
+        registry.entries[index].overrideMode = mode;
+    }
+    RebuildAllLocked(state);
+    return TRUE;
+}
+
+void VxResetSIMDDispatchEntryOverrides() {
+    SIMDDispatchState &state = GetSIMDDispatchState();
+    VxMutexLock lock(state.lock);
+    EnsureRegisteredLocked(state);
+
+    SIMDDispatchRegistry &registry = GetSIMDDispatchRegistry();
+    {
+        VxMutexLock registryLock(registry.lock);
+        ResetOverridesLocked(registry);
+    }
+    RebuildAllLocked(state);
+}
+
+XBOOL VxCalibrateSIMDDispatch(const char *cacheFile) {
+    SIMDDispatchState &state = GetSIMDDispatchState();
+    VxMutexLock lock(state.lock);
+    EnsureRegisteredLocked(state);
+
+    SIMDDispatchRegistry &registry = GetSIMDDispatchRegistry();
+    char header[512];
+    FormatCalibrationHeader(VxAtomicLoadInt(&state.effectiveMode), header, sizeof(header));
+
+    if (cacheFile) {
+        bool loaded;
+        {
+            VxMutexLock registryLock(registry.lock);
+            loaded = LoadCalibrationLocked(registry, cacheFile, header);
+        }
+        if (loaded) {
+            RebuildAllLocked(state);
+            return TRUE;
+        }
+    }
+
+    {
+        VxMutexLock registryLock(registry.lock);
+        ResetOverridesLocked(registry);
+    }
+    RebuildAllLocked(state);
+
+    XArray<int> calibrated;
+    for (int i = 0; i < registry.entries.Size(); ++i) {
+        if (CalibrateEntryLocked(state, registry, i)) {
+            calibrated.PushBack(i);
+        }
+    }
+
+    if (cacheFile) {
+        VxMutexLock registryLock(registry.lock);
+        return SaveCalibration(registry, cacheFile, header, calibrated) ? TRUE : FALSE;
+    }
+    return TRUE;
+}
@@ -1,6 +1,8 @@
 #ifndef VXSIMDDISPATCHINTERNAL_H
 #define VXSIMDDISPATCHINTERNAL_H
 
+#include <stddef.h>
+
 #include "VxSIMDMode.h"
 
 int VxGetSIMDOverrideInternal();
@@ -14,4 +16,44 @@ void VxDistanceDispatchRebuild(int effectiveMode);
 void VxIntersectDispatchRebuild(int effectiveMode);
 void VxGraphicDispatchRebuild(int effectiveMode);
 
+// Per-function dispatch registry.
+//
+// A module lists the entries of its dispatch table; each entry is one
+// function (or a group of table slots that must change together) and is
+// reported as "<module>.<function>". An entry follows the effective mode
+// unless it has its own override, which is clamped to the fallback chain of
+// the effective mode so VX_SIMD_MODE_NONE still means scalar everywhere.
+// Best mode this CPU supports, regardless of VxSetSIMDOverride().
+int VxGetSIMDAutoBackendInternal();
+
+struct VxSIMDDispatchModule {
+    const char *name;
+    const char *const *entries;
+    int count;
+};
+
+// Mode each entry of @a module should bind under @a effectiveMode.
+void VxSIMDDispatchResolve(const VxSIMDDispatchModule &module, int effectiveMode, int *modes);
+
+// Records the implementation bound to each entry and the modes that have a
+// distinct implementation on this CPU (bit 1 << mode).
+void VxSIMDDispatchPublish(const VxSIMDDispatchModule &module, const int *boundModes, const unsigned int *candidates);
+
+// Binds a table of function pointers entry by entry from its scalar and SIMD
+// instances (simd may be null). Returns one of the two when every entry
+// agrees, otherwise a composed copy that lives as long as the process.
+const void *VxSIMDDispatchComposeTable(const VxSIMDDispatchModule &module, int effectiveMode, const void *scalar,
+                                       const void *simd, size_t size);
+
+template <class Table>
+const Table *VxSIMDDispatchCompose(const VxSIMDDispatchModule &module, int effectiveMode, const Table &scalar,
+                                   const Table *simd) {
+    return static_cast<const Table *>(VxSIMDDispatchComposeTable(module, effectiveMode, &scalar, simd, sizeof(Table)));
+}
+
+// Calibration workloads (VxSIMDDispatchProbes.cpp): runs a representative
+// call mix for one registry entry through the public API. Returns false when
+// the entry has no workload.
+bool VxRunSIMDDispatchProbe(const char *name);
+
 #endif // VXSIMDDISPATCHINTERNAL_H
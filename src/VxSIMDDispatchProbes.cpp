@@ -0,0 +1,294 @@
+#include "VxSIMDDispatchInternal.h"
+
+#include <string.h>
+
+#include "VxMath.h"
+#include "VxDistance.h"
+#include "VxIntersect.h"
+#include "VxFrustum.h"
+#include "VxOBB.h"
+#include "VxRay.h"
+#include "VxSphere.h"
+
+// Calibration workloads for VxCalibrateSIMDDispatch. Each probe drives one
+// registry entry through the public API with a small, fixed input so that a
+// run takes well under a millisecond; timing is done by the caller.
+
+namespace {
+
+const int kProbeImageSize = 128;
+const int kProbeElementCount = 1024;
+
+// Keeps the optimizer from discarding probe results.
+volatile int g_ProbeSink = 0;
+
+struct ProbeBuffers {
+    XBYTE *argb;     // kProbeImageSize^2 32-bit pixels
+    XBYTE *scratch;  // same size, conversion / resize destination
+    XBYTE *mipChain; // full 32-bit mip chain of the image
+    XBYTE *yuv;      // I420 planes of the image
+    float *floats;   // 3 * kProbeElementCount floats
+    VxVector *vectors;
+    int *indices;
+
+    ProbeBuffers() {
+        const int pixels = kProbeImageSize * kProbeImageSize;
+        argb = new XBYTE[pixels * 4];
+        scratch = new XBYTE[pixels * 4];
+        mipChain = new XBYTE[VxGetMipChainSize(kProbeImageSize, kProbeImageSize)];
+        yuv = new XBYTE[pixels * 3 / 2];
+        floats = new float[kProbeElementCount * 3];
+        vectors = new VxVector[kProbeElementCount * 3];
+        indices = new int[kProbeElementCount];
+
+        for (int i = 0; i < pixels * 4; ++i) {
+            argb[i] = (XBYTE) ((i * 131 + (i >> 9) * 7) & 0xFF);
+        }
+        for (int i = 0; i < pixels * 3 / 2; ++i) {
+            yuv[i] = (XBYTE) (16 + (i * 37 & 0xBF));
+        }
+        for (int i = 0; i < kProbeElementCount * 3; ++i) {
+            floats[i] = (float) ((i * 17) % 101) * 0.01f;
+            vectors[i] = VxVector(floats[i], 1.0f - floats[i], floats[i] * 0.5f);
+        }
+        for (int i = 0; i < kProbeElementCount; ++i) {
+            indices[i] = (i * 7) % kProbeElementCount;
+        }
+    }
+};
+
+ProbeBuffers &GetProbeBuffers() {
+    static ProbeBuffers buffers;
+    return buffers;
+}
+
+VxImageDescEx MakeProbeDesc(VX_PIXELFORMAT format, int size, XBYTE *image) {
+    VxImageDescEx desc;
+    VxPixelFormat2ImageDesc(format, desc);
+    desc.Width = size;
+    desc.Height = size;
+    desc.BytesPerLine = size * (desc.BitsPerPixel / 8);
+    desc.Image = image;
+    return desc;
+}
+
+VxYUVImageDesc MakeProbeYUV(ProbeBuffers &buffers) {
+    VxYUVImageDesc yuv;
+    const int half = kProbeImageSize / 2;
+    yuv.Format = VX_YUV_I420;
+    yuv.Width = kProbeImageSize;
+    yuv.Height = kProbeImageSize;
+    yuv.Planes[0] = buffers.yuv;
+    yuv.Pitches[0] = kProbeImageSize;
+    yuv.Planes[1] = buffers.yuv + kProbeImageSize * kProbeImageSize;
+    yuv.Pitches[1] = half;
+    yuv.Planes[2] = yuv.Planes[1] + half * half;
+    yuv.Pitches[2] = half;
+    return yuv;
+}
+
+VxRay ProbeRay(const ProbeBuffers &buffers, int i) {
+    return VxRay(buffers.vectors[i] * 4.0f - VxVector(2.0f, 2.0f, 2.0f), buffers.vectors[i + kProbeElementCount]);
+}
+
+VxBbox ProbeBox(const ProbeBuffers &buffers, int i) {
+    const VxVector &center = buffers.vectors[i];
+    return VxBbox(center - VxVector(0.5f, 0.5f, 0.5f), center + VxVector(0.5f, 0.5f, 0.5f));
+}
+
+// --- math ---
+
+bool ProbeMath(const char *entry, ProbeBuffers &buffers) {
+    const int count = kProbeElementCount;
+    if (!strcmp(entry, "interpolateFloatArray")) {
+        // Short spans dominate real use, so mix them with one long span.
+        for (int offset = 0; offset < count; offset += 16) {
+            InterpolateFloatArray(buffers.floats + 2 * count + offset, buffers.floats + offset,
+                                  buffers.floats + count + offset, 0.25f, 16);
+        }
+        InterpolateFloatArray(buffers.floats + 2 * count, buffers.floats, buffers.floats + count, 0.75f, count);
+    } else if (!strcmp(entry, "interpolateVectorArray")) {
+        InterpolateVectorArray(buffers.vectors + 2 * count, buffers.vectors, buffers.vectors + count, 0.5f, count,
+                               sizeof(VxVector), sizeof(VxVector));
+    } else if (!strcmp(entry, "fillStructure")) {
+        VxFillStructure(count, buffers.scratch, 16, sizeof(VxVector), buffers.vectors);
+    } else if (!strcmp(entry, "copyStructure")) {
+        VxCopyStructure(count, buffers.scratch, 16, sizeof(VxVector), buffers.vectors, sizeof(VxVector));
+    } else if (!strcmp(entry, "indexedCopy")) {
+        VxStridedData dst(buffers.scratch, sizeof(VxVector));
+        VxStridedData src(buffers.vectors, sizeof(VxVector));
+        VxIndexedCopy(dst, src, sizeof(VxVector), buffers.indices, count);
+    } else if (!strcmp(entry, "projectPointsToAxesExtents")) {
+        VxMatrix box;
+        VxComputeBestFitBBox((const XBYTE *) buffers.vectors, sizeof(VxVector), count, box, 0.0f);
+        g_ProbeSink += (int) box[3][0];
+    } else if (!strcmp(entry, "transformBox2D")) {
+        VxMatrix projection;
+        Vx3DMatrixIdentity(projection);
+        projection[2][3] = 1.0f;
+        VxRect screen(0.0f, 0.0f, 640.0f, 480.0f);
+        for (int i = 0; i < 256; ++i) {
+            VxRect extents;
+            VXCLIP_FLAGS orFlags, andFlags;
+            VxBbox box = ProbeBox(buffers, i);
+            box.Min.z += 2.0f;
+            box.Max.z += 2.0f;
+            g_ProbeSink += VxTransformBox2D(projection, box, &screen, &extents, orFlags, andFlags);
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// --- distance ---
+
+bool ProbeDistance(const char *entry, ProbeBuffers &buffers) {
+    float sum = 0.0f;
+    if (!strcmp(entry, "makeRayPairTerms")) {
+        for (int i = 0; i < 512; ++i) {
+            sum += VxDistance::SegmentSegmentSquareDistance(ProbeRay(buffers, i), ProbeRay(buffers, i + 512));
+        }
+    } else if (!strcmp(entry, "pointSegmentSquareDistance")) {
+        for (int i = 0; i < kProbeElementCount; ++i) {
+            sum += VxDistance::PointSegmentSquareDistance(buffers.vectors[i + 2 * kProbeElementCount],
+                                                          ProbeRay(buffers, i));
+        }
+    } else {
+        return false;
+    }
+    g_ProbeSink += (int) sum;
+    return true;
+}
+
+// --- intersect ---
+
+bool ProbeIntersect(const char *entry, ProbeBuffers &buffers) {
+    const int count = 512;
+    int hits = 0;
+    if (!strcmp(entry, "rayBox")) {
+        for (int i = 0; i < count; ++i) {
+            hits += VxIntersect::RayBox(ProbeRay(buffers, i), ProbeBox(buffers, i + count));
+        }
+    } else if (!strcmp(entry, "aabbAabb")) {
+        for (int i = 0; i < count; ++i) {
+            hits += VxIntersect::AABBAABB(ProbeBox(buffers, i), ProbeBox(buffers, i + count));
+        }
+    } else if (!strcmp(entry, "obbObb")) {
+        VxMatrix rotation;
+        Vx3DMatrixFromRotation(rotation, VxVector(0.0f, 1.0f, 0.0f), 0.5f);
+        for (int i = 0; i < count; ++i) {
+            hits += VxIntersect::OBBOBB(VxOBB(ProbeBox(buffers, i), rotation), VxOBB(ProbeBox(buffers, i + count), rotation));
+        }
+    } else if (!strcmp(entry, "sphereSphere")) {
+        for (int i = 0; i < count; ++i) {
+            hits += VxIntersect::SphereSphere(VxSphere(buffers.vectors[i], 0.5f), buffers.vectors[i + count],
+                                              VxSphere(buffers.vectors[i + 2 * count], 0.5f), buffers.vectors[i + 3 * count],
+                                              NULL, NULL);
+        }
+    } else if (!strcmp(entry, "raySphere")) {
+        for (int i = 0; i < count; ++i) {
+            hits += VxIntersect::RaySphere(ProbeRay(buffers, i), VxSphere(buffers.vectors[i + count], 0.5f), NULL, NULL);
+        }
+    } else if (!strcmp(entry, "frustumBox")) {
+        VxFrustum frustum(VxVector(0.0f, 0.0f, -4.0f), VxVector(1.0f, 0.0f, 0.0f), VxVector(0.0f, 1.0f, 0.0f),
+                          VxVector(0.0f, 0.0f, 1.0f), 0.1f, 100.0f, 1.0f, 1.333f);
+        VxMatrix identity;
+        Vx3DMatrixIdentity(identity);
+        for (int i = 0; i < count; ++i) {
+            hits += VxIntersect::FrustumBox(frustum, ProbeBox(buffers, i), identity);
+        }
+    } else if (!strcmp(entry, "boxPlane")) {
+        const VxPlane plane(VxVector(0.0f, 1.0f, 0.0f), -0.5f);
+        for (int i = 0; i < count; ++i) {
+            hits += VxIntersect::BoxPlane(ProbeBox(buffers, i), plane);
+        }
+    } else if (!strcmp(entry, "faceFace")) {
+        const VxVector *v = buffers.vectors;
+        for (int i = 0; i < count; i += 2) {
+            const VxVector n0 = Normalize(CrossProduct(v[i + 1] - v[i], v[i + 2] - v[i]));
+            const VxVector n1 = Normalize(CrossProduct(v[i + count + 1] - v[i + count], v[i + count + 2] - v[i + count]));
+            hits += VxIntersect::FaceFace(v[i], v[i + 1], v[i + 2], n0, v[i + count], v[i + count + 1], v[i + count + 2], n1);
+        }
+    } else {
+        return false;
+    }
+    g_ProbeSink += hits;
+    return true;
+}
+
+// --- graphic / blit ---
+
+bool ProbeImage(const char *module, const char *entry, ProbeBuffers &buffers) {
+    const VxImageDescEx argb = MakeProbeDesc(_32_ARGB8888, kProbeImageSize, buffers.argb);
+    const VxImageDescEx scratch = MakeProbeDesc(_32_ARGB8888, kProbeImageSize, buffers.scratch);
+
+    if (!strcmp(module, "graphic")) {
+        if (strcmp(entry, "generateMipMap") != 0) {
+            return false;
+        }
+        VxGenerateMipMap(argb, buffers.scratch);
+        return true;
+    }
+
+    if (!strcmp(entry, "convert")) {
+        const VxImageDescEx rgb565 = MakeProbeDesc(_16_RGB565, kProbeImageSize, buffers.scratch);
+        VxDoBlit(argb, rgb565);
+        VxDoBlit(rgb565, argb);
+        const VxImageDescEx rgb24 = MakeProbeDesc(_24_RGB888, kProbeImageSize, buffers.scratch);
+        VxDoBlit(argb, rgb24);
+    } else if (!strcmp(entry, "alpha")) {
+        VxDoAlphaBlit(scratch, (XBYTE) 0x80);
+    } else if (!strcmp(entry, "fill")) {
+        VxFillImage(scratch, 0x80402010);
+    } else if (!strcmp(entry, "resample")) {
+        VxImageDescEx half = MakeProbeDesc(_32_ARGB8888, kProbeImageSize / 2, buffers.scratch);
+        VxResizeImage32(argb, half, VX_RESIZEFILTER_BILINEAR);
+        VxResizeImage32(half, argb, VX_RESIZEFILTER_BILINEAR);
+    } else if (!strcmp(entry, "mipmap")) {
+        VxGenerateMipChain(argb, buffers.mipChain);
+    } else if (!strcmp(entry, "blend")) {
+        VxBlendImage(argb, scratch, VX_BLEND_SRCOVER);
+    } else if (!strcmp(entry, "yuvDecode")) {
+        VxConvertFromYUV(MakeProbeYUV(buffers), scratch);
+    } else if (!strcmp(entry, "yuvEncode")) {
+        VxConvertToYUV(argb, MakeProbeYUV(buffers));
+    } else if (!strcmp(entry, "normalMap")) {
+        memcpy(buffers.scratch, buffers.argb, kProbeImageSize * kProbeImageSize * 4);
+        VxConvertToNormalMap(scratch, 0x00FF0000);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool VxRunSIMDDispatchProbe(const char *name) {
+    if (!name) {
+        return false;
+    }
+    const char *dot = strchr(name, '.');
+    if (!dot || dot - name >= 16) {
+        return false;
+    }
+    char module[16];
+    memcpy(module, name, dot - name);
+    module[dot - name] = '\0';
+    const char *entry = dot + 1;
+
+    ProbeBuffers &buffers = GetProbeBuffers();
+    if (!strcmp(module, "math")) {
+        return ProbeMath(entry, buffers);
+    }
+    if (!strcmp(module, "distance")) {
+        return ProbeDistance(entry, buffers);
+    }
+    if (!strcmp(module, "intersect")) {
+        return ProbeIntersect(entry, buffers);
+    }
+    if (!strcmp(module, "graphic") || !strcmp(module, "blit")) {
+        return ProbeImage(module, entry, buffers);
+    }
+    return false;
+}
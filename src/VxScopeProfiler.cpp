@@ -0,0 +1,271 @@
+#include "VxScopeProfiler.h"
+
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+
+#include "VxMonotonicClock.h"
+#include "VxMutex.h"
+#include "XArray.h"
+
+namespace {
+
+// Events per thread buffer; a power of two so the ring index is a mask.
+const int kProfileBufferCapacity = 1 << 16;
+
+// A begin event carries its scope name; an end event has a NULL name.
+struct ProfileEvent {
+    const char *name;
+    uint64_t time;
+};
+
+// Single-producer ring: only the owning thread writes, and it publishes each
+// event by advancing head. Readers see events [max(base, head - capacity), head).
+struct ProfileThreadBuffer {
+    ProfileEvent *events;
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> base;
+    int threadIndex;
+
+    explicit ProfileThreadBuffer(int index) : events(new ProfileEvent[kProfileBufferCapacity]), head(0), base(0),
+                                              threadIndex(index) {}
+    ~ProfileThreadBuffer() { delete[] events; }
+
+    void Push(const char *name, uint64_t time) {
+        const uint64_t index = head.load(std::memory_order_relaxed);
+        ProfileEvent &event = events[index & (kProfileBufferCapacity - 1)];
+        event.name = name;
+        event.time = time;
+        head.store(index + 1, std::memory_order_release);
+    }
+};
+
+struct ProfilerState {
+    VxMutex lock;
+    XArray<ProfileThreadBuffer *> buffers;
+    std::atomic<int> capturing;
+    uint64_t epoch;
+
+    ProfilerState() : capturing(0), epoch(VxMonotonicNowNs()) {}
+
+    ~ProfilerState() {
+        for (int i = 0; i < buffers.Size(); ++i) {
+            delete buffers[i];
+        }
+    }
+};
+
+ProfilerState &GetProfilerState() {
+    static ProfilerState state;
+    return state;
+}
+
+// Buffers outlive their threads so a trace can still be exported after a
+// worker exits; they are released with the profiler state.
+ProfileThreadBuffer *GetThreadBuffer() {
+    static thread_local ProfileThreadBuffer *t_Buffer = NULL;
+    if (!t_Buffer) {
+        ProfilerState &state = GetProfilerState();
+        VxMutexLock lock(state.lock);
+        t_Buffer = new ProfileThreadBuffer(state.buffers.Size() + 1);
+        state.buffers.PushBack(t_Buffer);
+    }
+    return t_Buffer;
+}
+
+struct CallTreeNode {
+    const char *name;
+    int parent;
+    int firstChild;
+    int nextSibling;
+    int calls;
+    uint64_t total;
+    uint64_t children;
+    uint64_t minimum;
+    uint64_t maximum;
+};
+
+int FindOrAddChild(XArray<CallTreeNode> &tree, int parent, const char *name) {
+    // Index 0 is a synthetic root holding the real roots as children.
+    int previous = -1;
+    for (int child = tree[parent].firstChild; child != -1; child = tree[child].nextSibling) {
+        if (tree[child].name == name || strcmp(tree[child].name, name) == 0) {
+            return child;
+        }
+        previous = child;
+    }
+    CallTreeNode node = {name, parent, -1, -1, 0, 0, 0, 0, 0};
+    tree.PushBack(node);
+    const int index = tree.Size() - 1;
+    if (previous == -1) {
+        tree[parent].firstChild = index;
+    } else {
+        tree[previous].nextSibling = index;
+    }
+    return index;
+}
+
+struct OpenScope {
+    int node;
+    uint64_t start;
+    const char *name;
+};
+
+// Replays every buffer, calling emit(thread, name, start, end) once per
+// completed scope. Ends without a begin (lost to wrap-around) are skipped.
+template <typename Emit>
+void ReplayBuffers(XArray<CallTreeNode> &tree, Emit emit) {
+    ProfilerState &state = GetProfilerState();
+    VxMutexLock lock(state.lock);
+
+    CallTreeNode root = {"", -1, -1, -1, 0, 0, 0, 0, 0};
+    tree.PushBack(root);
+
+    XArray<OpenScope> stack;
+    for (int b = 0; b < state.buffers.Size(); ++b) {
+        ProfileThreadBuffer *buffer = state.buffers[b];
+        const uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t first = buffer->base.load(std::memory_order_relaxed);
+        if (head - first > (uint64_t) kProfileBufferCapacity) {
+            first = head - kProfileBufferCapacity;
+        }
+
+        stack.Resize(0);
+        for (uint64_t i = first; i < head; ++i) {
+            const ProfileEvent &event = buffer->events[i & (kProfileBufferCapacity - 1)];
+            if (event.name) {
+                const int parent = stack.Size() ? stack.Back().node : 0;
+                OpenScope scope = {FindOrAddChild(tree, parent, event.name), event.time, event.name};
+                stack.PushBack(scope);
+                continue;
+            }
+            if (stack.Size() == 0) {
+                continue;
+            }
+            const OpenScope scope = stack.Back();
+            stack.PopBack();
+            const uint64_t elapsed = event.time - scope.start;
+            CallTreeNode &node = tree[scope.node];
+            if (node.calls == 0 || elapsed < node.minimum) {
+                node.minimum = elapsed;
+            }
+            if (elapsed > node.maximum) {
+                node.maximum = elapsed;
+            }
+            ++node.calls;
+            node.total += elapsed;
+            if (stack.Size()) {
+                tree[stack.Back().node].children += elapsed;
+            }
+            emit(buffer->threadIndex, scope.name, scope.start, event.time);
+        }
+    }
+}
+
+double NsToMs(uint64_t ns) {
+    return static_cast<double>(ns) / 1000000.0;
+}
+
+void FlattenCallTree(const XArray<CallTreeNode> &tree, int index, int parent, int depth, VxProfileNode *nodes,
+                     int maxNodes, int &count) {
+    for (int child = tree[index].firstChild; child != -1; child = tree[child].nextSibling) {
+        const CallTreeNode &node = tree[child];
+        const int slot = count++;
+        if (nodes && slot < maxNodes) {
+            VxProfileNode &out = nodes[slot];
+            out.Name = node.name;
+            out.Parent = parent;
+            out.Depth = depth;
+            out.Calls = node.calls;
+            out.TotalMs = NsToMs(node.total);
+            out.SelfMs = NsToMs(node.total - node.children);
+            out.MinMs = NsToMs(node.minimum);
+            out.MaxMs = NsToMs(node.maximum);
+        }
+        FlattenCallTree(tree, child, slot, depth + 1, nodes, maxNodes, count);
+    }
+}
+
+void WriteJSONString(FILE *file, const char *text) {
+    fputc('"', file);
+    for (const char *c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', file);
+        }
+        if ((unsigned char) *c >= 0x20) {
+            fputc(*c, file);
+        }
+    }
+    fputc('"', file);
+}
+
+} // namespace
+
+void VxProfilerStart() {
+    GetProfilerState().capturing.store(1, std::memory_order_release);
+}
+
+void VxProfilerStop() {
+    GetProfilerState().capturing.store(0, std::memory_order_release);
+}
+
+XBOOL VxProfilerIsCapturing() {
+    return GetProfilerState().capturing.load(std::memory_order_acquire) != 0;
+}
+
+void VxProfilerReset() {
+    ProfilerState &state = GetProfilerState();
+    VxMutexLock lock(state.lock);
+    for (int i = 0; i < state.buffers.Size(); ++i) {
+        ProfileThreadBuffer *buffer = state.buffers[i];
+        buffer->base.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
+
+XBOOL VxProfilerBeginScope(const char *name) {
+    if (!name || !GetProfilerState().capturing.load(std::memory_order_relaxed)) {
+        return FALSE;
+    }
+    GetThreadBuffer()->Push(name, VxMonotonicNowNs());
+    return TRUE;
+}
+
+void VxProfilerEndScope() {
+    GetThreadBuffer()->Push(NULL, VxMonotonicNowNs());
+}
+
+int VxProfilerGetCallTree(VxProfileNode *nodes, int maxNodes) {
+    XArray<CallTreeNode> tree;
+    ReplayBuffers(tree, [](int, const char *, uint64_t, uint64_t) {});
+    int count = 0;
+    FlattenCallTree(tree, 0, -1, 0, nodes, maxNodes, count);
+    return count;
+}
+
+XBOOL VxProfilerWriteChromeTrace(const char *path) {
+    if (!path) {
+        return FALSE;
+    }
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        return FALSE;
+    }
+
+    // Complete ("X") events with microsecond timestamps relative to startup.
+    const uint64_t epoch = GetProfilerState().epoch;
+    bool first = true;
+    fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+    XArray<CallTreeNode> tree;
+    ReplayBuffers(tree, [&](int thread, const char *name, uint64_t start, uint64_t end) {
+        fprintf(file, "%s\n{\"name\": ", first ? "" : ",");
+        WriteJSONString(file, name);
+        fprintf(file, ", \"cat\": \"VxMath\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+                thread, static_cast<double>(start - epoch) / 1000.0, static_cast<double>(end - start) / 1000.0);
+        first = false;
+    });
+    fprintf(file, "\n]}\n");
+
+    const bool failed = ferror(file) != 0;
+    fclose(file);
+    return failed ? FALSE : TRUE;
+}
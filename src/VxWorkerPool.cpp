@@ -0,0 +1,168 @@
+#include "VxWorkerPool.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// VxThread is not used here: the first VxThread created is treated as the
+// process main thread, so a lazily started pool cannot rely on it.
+
+namespace {
+
+const int kMaxPoolWorkers = 63;
+
+struct ParallelJob {
+    VxParallelRangeFunc func;
+    void *userData;
+    int count;
+    int chunkSize;
+    int chunkCount;
+    int nextChunk;     // Guarded by the pool mutex
+    int pendingChunks; // Unfinished chunks, guarded by doneMutex
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+};
+
+thread_local bool t_IsPoolWorker = false;
+
+class WorkerPool {
+public:
+    // Grows the pool so that at least @p workers helper threads exist.
+    void EnsureWorkers(int workers) {
+        if (workers > kMaxPoolWorkers) {
+            workers = kMaxPoolWorkers;
+        }
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        while (m_WorkerCount < workers) {
+            std::thread(&WorkerPool::WorkerMain, this).detach();
+            ++m_WorkerCount;
+        }
+    }
+
+    void Submit(ParallelJob *job) {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Jobs.push_back(job);
+        }
+        m_WorkAvailable.notify_all();
+    }
+
+    // Claims the next chunk of @p job; returns -1 once all chunks are taken.
+    int ClaimChunk(ParallelJob *job) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return ClaimChunkLocked(job);
+    }
+
+    static void RunChunk(ParallelJob *job, int chunk) {
+        const int begin = chunk * job->chunkSize;
+        int end = begin + job->chunkSize;
+        if (end > job->count) {
+            end = job->count;
+        }
+        job->func(job->userData, begin, end);
+
+        // Decrement under the lock so the owner cannot observe completion and
+        // destroy the job while this thread still touches it.
+        std::lock_guard<std::mutex> lock(job->doneMutex);
+        if (--job->pendingChunks == 0) {
+            job->doneCondition.notify_all();
+        }
+    }
+
+private:
+    int ClaimChunkLocked(ParallelJob *job) {
+        if (job->nextChunk >= job->chunkCount) {
+            return -1;
+        }
+        const int chunk = job->nextChunk++;
+        if (job->nextChunk >= job->chunkCount) {
+            // Fully claimed: drop it so no thread touches the job again.
+            for (std::deque<ParallelJob *>::iterator it = m_Jobs.begin(); it != m_Jobs.end(); ++it) {
+                if (*it == job) {
+                    m_Jobs.erase(it);
+                    break;
+                }
+            }
+        }
+        return chunk;
+    }
+
+    void WorkerMain() {
+        t_IsPoolWorker = true;
+        for (;;) {
+            ParallelJob *job = nullptr;
+            int chunk = -1;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_WorkAvailable.wait(lock, [this]() { return !m_Jobs.empty(); });
+                job = m_Jobs.front();
+                chunk = ClaimChunkLocked(job);
+            }
+            if (chunk >= 0) {
+                RunChunk(job, chunk);
+            }
+        }
+    }
+
+    std::mutex m_Mutex;
+    std::condition_variable m_WorkAvailable;
+    std::deque<ParallelJob *> m_Jobs;
+    int m_WorkerCount = 0;
+};
+
+WorkerPool &GetWorkerPool() {
+    // Intentionally leaked: worker threads stay parked until process exit, and
+    // joining them from a static destructor can deadlock during DLL unload.
+    static WorkerPool *pool = new WorkerPool();
+    return *pool;
+}
+
+} // namespace
+
+int VxGetHardwareConcurrency() {
+    const unsigned int count = std::thread::hardware_concurrency();
+    return count > 0 ? static_cast<int>(count) : 1;
+}
+
+void VxParallelFor(int count, int minChunk, int maxTasks, VxParallelRangeFunc func, void *userData) {
+    if (!func || count <= 0) {
+        return;
+    }
+    if (minChunk < 1) {
+        minChunk = 1;
+    }
+
+    int chunkCount = count / minChunk;
+    if (chunkCount > maxTasks) {
+        chunkCount = maxTasks;
+    }
+    if (chunkCount > kMaxPoolWorkers + 1) {
+        chunkCount = kMaxPoolWorkers + 1;
+    }
+    if (chunkCount <= 1 || t_IsPoolWorker) {
+        func(userData, 0, count);
+        return;
+    }
+
+    ParallelJob job;
+    job.func = func;
+    job.userData = userData;
+    job.count = count;
+    job.chunkSize = (count + chunkCount - 1) / chunkCount;
+    job.chunkCount = (count + job.chunkSize - 1) / job.chunkSize;
+    job.nextChunk = 0;
+    job.pendingChunks = job.chunkCount;
+
+    WorkerPool &pool = GetWorkerPool();
+    pool.EnsureWorkers(job.chunkCount - 1);
+    pool.Submit(&job);
+
+    // The caller works on its own job until every chunk is claimed.
+    for (int chunk = pool.ClaimChunk(&job); chunk >= 0; chunk = pool.ClaimChunk(&job)) {
+        WorkerPool::RunChunk(&job, chunk);
+    }
+
+    std::unique_lock<std::mutex> lock(job.doneMutex);
+    job.doneCondition.wait(lock, [&job]() { return job.pendingChunks == 0; });
+}
@@ -0,0 +1,33 @@
+#ifndef VXWORKERPOOL_H
+#define VXWORKERPOOL_H
+
+/**
+ * @file VxWorkerPool.h
+ * @brief Internal helper-thread pool used by the parallel image paths.
+ *
+ * This header is private to the VxMath library implementation.
+ */
+
+/// Callback processing the half-open item range [begin, end).
+typedef void (*VxParallelRangeFunc)(void *userData, int begin, int end);
+
+/**
+ * @brief Runs @p func over [0, count) split into contiguous chunks.
+ * @param count Number of items.
+ * @param minChunk Minimum number of items per chunk (values < 1 are treated as 1).
+ * @param maxTasks Maximum number of chunks, i.e. threads including the caller.
+ * @param func Range callback; it must be safe to call concurrently.
+ * @param userData Opaque pointer forwarded to @p func.
+ *
+ * The calling thread processes chunks too and returns once every chunk has
+ * completed. The call runs inline when only one chunk results or when issued
+ * from a pool worker (nested parallelism is flattened).
+ */
+void VxParallelFor(int count, int minChunk, int maxTasks, VxParallelRangeFunc func, void *userData);
+
+/**
+ * @brief Returns the number of hardware threads (at least 1).
+ */
+int VxGetHardwareConcurrency();
+
+#endif // VXWORKERPOOL_H
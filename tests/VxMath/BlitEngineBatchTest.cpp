@@ -0,0 +1,156 @@
+/**
+ * @file BlitEngineBatchTest.cpp
+ * @brief Tests for batched blitting (VxDoBlitBatch).
+ *
+ * Tests:
+ * - Mixed format pairs match individual VxDoBlit calls
+ * - Paletted jobs with different palettes in one group
+ * - Resize and quantize jobs fall back to VxDoBlit
+ * - Serial and parallel batches produce identical output
+ * - Degenerate inputs
+ */
+
+#include <memory>
+
+#include "BlitEngineTestHelpers.h"
+
+using namespace BlitEngineTest;
+
+namespace {
+
+struct BatchImage {
+    ImageBuffer src;
+    ImageBuffer expected;
+    ImageBuffer actual;
+    PaletteBuffer palette;
+    VxImageDescEx srcDesc;
+    VxImageDescEx expectedDesc;
+    VxImageDescEx actualDesc;
+
+    BatchImage() : palette(4) {}
+};
+
+} // namespace
+
+class BlitEngineBatchTest : public BlitEngineTestBase {
+protected:
+    void AddImage(const VxImageDescEx &srcTemplate, const VxImageDescEx &dstTemplate) {
+        const int seed = static_cast<int>(m_Images.size());
+        BatchImage *image = new BatchImage();
+        image->src.Resize(ImageDescFactory::CalcBufferSize(srcTemplate));
+        image->expected.Resize(ImageDescFactory::CalcBufferSize(dstTemplate));
+        image->actual.Resize(ImageDescFactory::CalcBufferSize(dstTemplate));
+        for (size_t i = 0; i < image->src.Size(); ++i) {
+            image->src[i] = static_cast<XBYTE>((i * 29 + seed * 53) & 0xFF);
+        }
+
+        image->srcDesc = srcTemplate;
+        image->srcDesc.Image = image->src.Data();
+        if (srcTemplate.ColorMapEntries > 0) {
+            for (int i = 0; i < 256; ++i) {
+                const XDWORD rgb = static_cast<XDWORD>((i * 0x030507 + seed * 0x112233) & 0xFFFFFF);
+                image->palette.SetColor(i, 0xFF000000u | rgb);
+            }
+            image->srcDesc.ColorMap = image->palette.Data();
+        }
+
+        image->expectedDesc = dstTemplate;
+        image->expectedDesc.Image = image->expected.Data();
+        image->actualDesc = dstTemplate;
+        image->actualDesc.Image = image->actual.Data();
+
+        if (dstTemplate.ColorMapEntries > 0) {
+            // Quantizing destinations need their own palettes.
+            m_DstPalettes.emplace_back(new PaletteBuffer(4));
+            image->expectedDesc.ColorMap = m_DstPalettes.back()->Data();
+            m_DstPalettes.emplace_back(new PaletteBuffer(4));
+            image->actualDesc.ColorMap = m_DstPalettes.back()->Data();
+        }
+
+        m_Images.emplace_back(image);
+    }
+
+    void RunAndCompare(XBOOL parallel) {
+        std::vector<VxImageDescEx> srcDescs;
+        std::vector<VxImageDescEx> dstDescs;
+        for (const std::unique_ptr<BatchImage> &image : m_Images) {
+            VxDoBlit(image->srcDesc, image->expectedDesc);
+            image->actual.Clear();
+            srcDescs.push_back(image->srcDesc);
+            dstDescs.push_back(image->actualDesc);
+        }
+
+        VxDoBlitBatch(srcDescs.data(), dstDescs.data(), static_cast<int>(m_Images.size()), parallel);
+
+        for (size_t i = 0; i < m_Images.size(); ++i) {
+            const BatchImage &image = *m_Images[i];
+            EXPECT_EQ(0, memcmp(image.expected.Data(), image.actual.Data(), image.expected.Size()))
+                << "batch entry " << i << " parallel=" << parallel;
+        }
+    }
+
+    std::vector<std::unique_ptr<BatchImage>> m_Images;
+    std::vector<std::unique_ptr<PaletteBuffer>> m_DstPalettes;
+};
+
+TEST_F(BlitEngineBatchTest, MixedFormatPairsMatchIndividualBlits) {
+    for (int i = 0; i < 12; ++i) {
+        const int w = 8 + i * 3;
+        const int h = 5 + i;
+        switch (i % 4) {
+            case 0:
+                AddImage(ImageDescFactory::Create32BitARGB(w, h), ImageDescFactory::Create16Bit565(w, h));
+                break;
+            case 1:
+                AddImage(ImageDescFactory::Create16Bit4444(w, h), ImageDescFactory::Create32BitARGB(w, h));
+                break;
+            case 2:
+                AddImage(ImageDescFactory::Create24BitRGB(w, h), ImageDescFactory::Create32BitRGBA(w, h));
+                break;
+            default:
+                AddImage(ImageDescFactory::Create32BitARGB(w, h), ImageDescFactory::Create32BitARGB(w, h));
+                break;
+        }
+    }
+    RunAndCompare(FALSE);
+}
+
+TEST_F(BlitEngineBatchTest, PalettedJobsWithDistinctPalettes) {
+    for (int i = 0; i < 6; ++i) {
+        AddImage(ImageDescFactory::Create8BitPaletted(31, 9), ImageDescFactory::Create16Bit565(31, 9));
+        AddImage(ImageDescFactory::Create8BitPaletted(17, 4), ImageDescFactory::Create16Bit1555(17, 4));
+    }
+    RunAndCompare(FALSE);
+}
+
+TEST_F(BlitEngineBatchTest, ResizeAndQuantizeFallBackToDoBlit) {
+    AddImage(ImageDescFactory::Create32BitARGB(32, 32), ImageDescFactory::Create32BitARGB(48, 20));
+    AddImage(ImageDescFactory::Create32BitARGB(16, 16), ImageDescFactory::Create8BitPaletted(16, 16));
+    AddImage(ImageDescFactory::Create32BitARGB(16, 16), ImageDescFactory::Create16Bit565(16, 16));
+    RunAndCompare(FALSE);
+}
+
+TEST_F(BlitEngineBatchTest, ParallelBatchMatchesIndividualBlits) {
+    for (int i = 0; i < 200; ++i) {
+        const int w = 4 + (i % 23);
+        const int h = 3 + (i % 11);
+        if (i % 3 == 0) {
+            AddImage(ImageDescFactory::Create32BitARGB(w, h), ImageDescFactory::Create16Bit555(w, h));
+        } else if (i % 3 == 1) {
+            AddImage(ImageDescFactory::Create8BitPaletted(w, h), ImageDescFactory::Create16Bit565(w, h));
+        } else {
+            AddImage(ImageDescFactory::Create16Bit565(w, h), ImageDescFactory::Create32BitARGB(w, h));
+        }
+    }
+    RunAndCompare(TRUE);
+}
+
+TEST_F(BlitEngineBatchTest, DegenerateInputsAreIgnored) {
+    VxDoBlitBatch(nullptr, nullptr, 4, FALSE);
+
+    VxImageDescEx src = ImageDescFactory::Create32BitARGB(4, 4);
+    VxImageDescEx dst = ImageDescFactory::Create16Bit565(4, 4);
+    VxDoBlitBatch(&src, &dst, 0, FALSE);
+    // Null image pointers are skipped just like VxDoBlit does.
+    VxDoBlitBatch(&src, &dst, 1, TRUE);
+}
@@ -0,0 +1,250 @@
+/**
+ * @file BlitEngineBlendTest.cpp
+ * @brief Tests for two-image compositing (VxBlendImage / VxBlitEngine::BlendImage).
+ *
+ * Tests:
+ * - Every VX_BLENDOP matches a per-channel reference with exact rounding
+ * - Straight SrcOver over translucent destinations follows Porter-Duff over
+ * - All SIMD tiers and parallel row bands produce identical output
+ * - Sources placed partly outside the destination are clipped
+ * - Invalid images and parameters are rejected without touching the destination
+ */
+
+#include "BlitEngineTestHelpers.h"
+
+using namespace BlitEngineTest;
+
+class BlitEngineBlendTest : public BlitEngineTestBase {
+protected:
+    void SetUp() override {
+        BlitEngineTestBase::SetUp();
+        m_PreviousSIMDMode = VxGetSIMDOverride();
+        VxGetBlitParallelism(m_PreviousThreads, m_PreviousMinRows);
+    }
+
+    void TearDown() override {
+        VxSetSIMDOverride(m_PreviousSIMDMode);
+        VxSetBlitParallelism(m_PreviousThreads, m_PreviousMinRows);
+        BlitEngineTestBase::TearDown();
+    }
+
+    // Pseudo-random pixels with runs of transparent and opaque alpha so the
+    // SIMD early-outs are exercised alongside the blended path.
+    static void FillPixels(ImageBuffer &buffer, int count, XDWORD seed) {
+        XDWORD *pixels = reinterpret_cast<XDWORD *>(buffer.Data());
+        XDWORD state = seed;
+        for (int i = 0; i < count; ++i) {
+            state = state * 1664525u + 1013904223u;
+            XDWORD p = state;
+            const int run = (i / 16) % 4;
+            if (run == 1) p &= 0x00FFFFFF;
+            if (run == 2) p |= 0xFF000000;
+            pixels[i] = p;
+        }
+    }
+
+    // Premultiplies each pixel by its own alpha.
+    static void Premultiply(ImageBuffer &buffer, int count) {
+        XDWORD *pixels = reinterpret_cast<XDWORD *>(buffer.Data());
+        for (int i = 0; i < count; ++i) {
+            const XDWORD a = pixels[i] >> 24;
+            XDWORD out = a << 24;
+            for (int shift = 0; shift < 24; shift += 8) {
+                out |= Div255(((pixels[i] >> shift) & 0xFF) * a) << shift;
+            }
+            pixels[i] = out;
+        }
+    }
+
+    static XDWORD Div255(XDWORD x) { return (x + 127) / 255; }
+
+    // Porter-Duff over on straight colors, rounded to nearest.
+    static XDWORD ReferenceSrcOver(XDWORD s, XDWORD d) {
+        const XDWORD sa = s >> 24;
+        if (sa == 0) return d;
+        const XDWORD wd = Div255((d >> 24) * (255 - sa));
+        const XDWORD a = sa + wd;
+        XDWORD out = a << 24;
+        for (int shift = 0; shift < 24; shift += 8) {
+            out |= ((((s >> shift) & 0xFF) * sa + ((d >> shift) & 0xFF) * wd + a / 2) / a) << shift;
+        }
+        return out;
+    }
+
+    static XDWORD Reference(int op, XDWORD s, XDWORD d, XDWORD factor) {
+        if (op == VX_BLEND_SRCOVER) return ReferenceSrcOver(s, d);
+        const XDWORD sa = s >> 24;
+        XDWORD out = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            const XDWORD sc = (s >> shift) & 0xFF;
+            const XDWORD dc = (d >> shift) & 0xFF;
+            XDWORD v = 0;
+            switch (op) {
+            case VX_BLEND_MULTIPLY: v = Div255(sc * dc); break;
+            case VX_BLEND_SRCOVER_PREMULTIPLIED: v = (std::min)(sc + Div255(dc * (255 - sa)), 255u); break;
+            case VX_BLEND_ADD: v = (std::min)(sc + dc, 255u); break;
+            case VX_BLEND_SCREEN: v = sc + dc - Div255(sc * dc); break;
+            case VX_BLEND_LERP: v = Div255(sc * factor + dc * (255 - factor)); break;
+            }
+            out |= v << shift;
+        }
+        return out;
+    }
+
+    int m_PreviousSIMDMode = VX_SIMD_MODE_AUTO;
+    int m_PreviousThreads = 1;
+    int m_PreviousMinRows = 64;
+};
+
+TEST_F(BlitEngineBlendTest, AllOpsMatchReference) {
+    const int width = 77;
+    const int height = 5;
+    const int count = width * height;
+    ImageBuffer src(count * 4);
+    ImageBuffer base(count * 4);
+    ImageBuffer dst(count * 4);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, height, src.Data());
+    VxImageDescEx dstDesc = ImageDescFactory::Create32BitARGB(width, height, dst.Data());
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2};
+
+    for (int op = VX_BLEND_MULTIPLY; op <= VX_BLEND_LERP; ++op) {
+        FillPixels(src, count, 7);
+        FillPixels(base, count, 99);
+        if (op == VX_BLEND_SRCOVER_PREMULTIPLIED) Premultiply(src, count);
+        const XDWORD factor = 96;
+        const XDWORD *s = reinterpret_cast<const XDWORD *>(src.Data());
+        const XDWORD *d = reinterpret_cast<const XDWORD *>(base.Data());
+
+        for (int mode : modes) {
+            if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) continue;
+            memcpy(dst.Data(), base.Data(), dst.Size());
+            ASSERT_TRUE(VxBlendImage(srcDesc, dstDesc, static_cast<VX_BLENDOP>(op), 0, 0, factor));
+            const XDWORD *out = reinterpret_cast<const XDWORD *>(dst.Data());
+            for (int i = 0; i < count; ++i) {
+                ASSERT_EQ(Reference(op, s[i], d[i], factor), out[i])
+                    << "op=" << op << " mode=" << mode << " pixel=" << i << std::hex << " src=" << s[i]
+                    << " dst=" << d[i];
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineBlendTest, SrcOverTranslucentDestination) {
+    // 50% blue over transparent red stays blue: a transparent destination
+    // contributes no color.
+    const int width = 37;
+    ImageBuffer src(width * 4);
+    ImageBuffer base(width * 4);
+    ImageBuffer dst(width * 4);
+    XDWORD *s = reinterpret_cast<XDWORD *>(src.Data());
+    XDWORD *d = reinterpret_cast<XDWORD *>(base.Data());
+    for (int i = 0; i < width; ++i) {
+        s[i] = 0x800000FF;
+        d[i] = 0x00FF0000;
+    }
+    // Then translucent sources over translucent destinations of every kind.
+    XDWORD state = 5;
+    for (int i = 16; i < width; ++i) {
+        state = state * 1664525u + 1013904223u;
+        s[i] = (state & 0x00FFFFFF) | ((1 + (state >> 24) % 254) << 24);
+        state = state * 1664525u + 1013904223u;
+        d[i] = (state & 0x00FFFFFF) | ((i % 3 == 0 ? 0 : 1 + (state >> 24) % 254) << 24);
+    }
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, 1, src.Data());
+    VxImageDescEx dstDesc = ImageDescFactory::Create32BitARGB(width, 1, dst.Data());
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2};
+
+    for (int mode : modes) {
+        if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) continue;
+        memcpy(dst.Data(), base.Data(), dst.Size());
+        ASSERT_TRUE(VxBlendImage(srcDesc, dstDesc, VX_BLEND_SRCOVER));
+        const XDWORD *out = reinterpret_cast<const XDWORD *>(dst.Data());
+        for (int i = 0; i < 16; ++i) {
+            ASSERT_EQ(0x800000FFu, out[i]) << "mode=" << mode << " pixel=" << i;
+        }
+        for (int i = 0; i < width; ++i) {
+            ASSERT_EQ(ReferenceSrcOver(s[i], d[i]), out[i])
+                << "mode=" << mode << " pixel=" << i << std::hex << " src=" << s[i] << " dst=" << d[i];
+        }
+    }
+}
+
+TEST_F(BlitEngineBlendTest, ParallelBandsMatchSerial) {
+    const int width = 150;
+    const int height = 96;
+    const int count = width * height;
+    ImageBuffer src(count * 4);
+    ImageBuffer serial(count * 4);
+    ImageBuffer banded(count * 4);
+    FillPixels(src, count, 3);
+    FillPixels(serial, count, 4);
+    memcpy(banded.Data(), serial.Data(), serial.Size());
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, height, src.Data());
+    VxImageDescEx serialDesc = ImageDescFactory::Create32BitARGB(width, height, serial.Data());
+    VxImageDescEx bandedDesc = ImageDescFactory::Create32BitARGB(width, height, banded.Data());
+
+    VxSetBlitParallelism(1, 64);
+    ASSERT_TRUE(VxBlendImage(srcDesc, serialDesc, VX_BLEND_SRCOVER));
+    VxSetBlitParallelism(4, 8);
+    ASSERT_TRUE(VxBlendImage(srcDesc, bandedDesc, VX_BLEND_SRCOVER));
+    EXPECT_EQ(0, memcmp(serial.Data(), banded.Data(), serial.Size()));
+}
+
+TEST_F(BlitEngineBlendTest, ClipsToDestination) {
+    const int width = 10;
+    const int height = 8;
+    ImageBuffer src(6 * 5 * 4);
+    ImageBuffer dst(width * height * 4);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(6, 5, src.Data());
+    VxImageDescEx dstDesc = ImageDescFactory::Create32BitARGB(width, height, dst.Data());
+    XDWORD *srcPixels = reinterpret_cast<XDWORD *>(src.Data());
+    for (int i = 0; i < 6 * 5; ++i) srcPixels[i] = 0x00010101 * i;
+    const XDWORD *dstPixels = reinterpret_cast<const XDWORD *>(dst.Data());
+
+    // Source overhanging the top-left and the bottom-right corners.
+    const int origins[][2] = {{-2, -3}, {7, 5}, {2, 1}};
+    for (const auto &origin : origins) {
+        dst.Clear();
+        ASSERT_TRUE(VxBlendImage(srcDesc, dstDesc, VX_BLEND_ADD, origin[0], origin[1]));
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                const int sx = x - origin[0];
+                const int sy = y - origin[1];
+                const bool inside = sx >= 0 && sx < 6 && sy >= 0 && sy < 5;
+                const XDWORD expected = inside ? srcPixels[sy * 6 + sx] : 0;
+                ASSERT_EQ(expected, dstPixels[y * width + x]) << "origin " << origin[0] << "," << origin[1];
+            }
+        }
+    }
+
+    // Entirely outside is a no-op, not an error.
+    dst.Fill(0x5A);
+    EXPECT_TRUE(VxBlendImage(srcDesc, dstDesc, VX_BLEND_ADD, width, 0));
+    EXPECT_TRUE(VxBlendImage(srcDesc, dstDesc, VX_BLEND_ADD, 0, -5));
+    for (size_t i = 0; i < dst.Size(); ++i) ASSERT_EQ(0x5A, dst[i]);
+}
+
+TEST_F(BlitEngineBlendTest, RejectsInvalidInput) {
+    const int size = 4;
+    ImageBuffer src(size * size * 4, 0xFF);
+    ImageBuffer dst(size * size * 4, 0x11);
+    ImageBuffer dst16(size * size * 2, 0x11);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(size, size, src.Data());
+    VxImageDescEx dstDesc = ImageDescFactory::Create32BitARGB(size, size, dst.Data());
+
+    VxImageDescEx noImage = srcDesc;
+    noImage.Image = nullptr;
+    EXPECT_FALSE(VxBlendImage(noImage, dstDesc, VX_BLEND_ADD));
+    EXPECT_FALSE(VxBlendImage(srcDesc, ImageDescFactory::Create16Bit565(size, size, dst16.Data()), VX_BLEND_ADD));
+    EXPECT_FALSE(VxBlendImage(srcDesc, ImageDescFactory::Create32BitABGR(size, size, dst.Data()), VX_BLEND_ADD));
+    EXPECT_FALSE(VxBlendImage(srcDesc, dstDesc, static_cast<VX_BLENDOP>(VX_BLEND_LERP + 1)));
+    EXPECT_FALSE(VxBlendImage(srcDesc, dstDesc, VX_BLEND_LERP, 0, 0, 256));
+
+    // SrcOver reads alpha from the top byte.
+    VxImageDescEx rgbaSrc = ImageDescFactory::Create32BitRGBA(size, size, src.Data());
+    VxImageDescEx rgbaDst = ImageDescFactory::Create32BitRGBA(size, size, dst.Data());
+    EXPECT_FALSE(VxBlendImage(rgbaSrc, rgbaDst, VX_BLEND_SRCOVER));
+    for (size_t i = 0; i < dst.Size(); ++i) ASSERT_EQ(0x11, dst[i]);
+
+    EXPECT_TRUE(VxBlendImage(rgbaSrc, rgbaDst, VX_BLEND_SCREEN));
+}
@@ -0,0 +1,165 @@
+/**
+ * @file BlitEngineConcurrencyTest.cpp
+ * @brief Concurrency tests for the shared VxBlitEngine instance.
+ *
+ * Tests:
+ * - Concurrent DoBlit / DoBlitUpsideDown calls produce the single-threaded result
+ * - Paletted blits keep their per-operation caches isolated across threads
+ * - Resizing blits use per-thread scratch memory
+ * - Dispatch table rebuilds do not disturb in-flight blits
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "BlitEngineTestHelpers.h"
+
+using namespace BlitEngineTest;
+
+namespace {
+
+const int kThreadCount = 8;
+const int kIterations = 64;
+
+struct BlitJob {
+    ImageBuffer srcBuffer;
+    ImageBuffer dstBuffer;
+    ImageBuffer expected;
+    PaletteBuffer palette;
+    VxImageDescEx srcDesc;
+    VxImageDescEx dstDesc;
+    bool upsideDown;
+
+    BlitJob() : palette(4), upsideDown(false) {}
+
+    void Run() {
+        if (upsideDown) {
+            VxDoBlitUpsideDown(srcDesc, dstDesc);
+        } else {
+            VxDoBlit(srcDesc, dstDesc);
+        }
+    }
+};
+
+} // namespace
+
+class BlitEngineConcurrencyTest : public BlitEngineTestBase {
+protected:
+    // Builds a job, runs it once on the calling thread and records the result.
+    void PrepareJob(BlitJob &job, const VxImageDescEx &srcTemplate, const VxImageDescEx &dstTemplate,
+                    int seed, bool upsideDown = false) {
+        job.srcBuffer.Resize(ImageDescFactory::CalcBufferSize(srcTemplate));
+        job.dstBuffer.Resize(ImageDescFactory::CalcBufferSize(dstTemplate));
+        job.srcDesc = srcTemplate;
+        job.dstDesc = dstTemplate;
+        job.srcDesc.Image = job.srcBuffer.Data();
+        job.dstDesc.Image = job.dstBuffer.Data();
+        job.upsideDown = upsideDown;
+
+        for (size_t i = 0; i < job.srcBuffer.Size(); ++i) {
+            job.srcBuffer[i] = static_cast<XBYTE>((i * 31 + seed * 17) & 0xFF);
+        }
+        if (job.srcDesc.ColorMapEntries > 0) {
+            for (int i = 0; i < 256; ++i) {
+                const XDWORD alpha = static_cast<XDWORD>((i * 37 + seed) & 0xFF) << 24;
+                const XDWORD rgb = static_cast<XDWORD>((i * 0x010203 + seed * 0x0F0F0F) & 0xFFFFFF);
+                job.palette.SetColor(i, alpha | rgb);
+            }
+            job.srcDesc.ColorMap = job.palette.Data();
+        }
+
+        job.Run();
+        job.expected = job.dstBuffer;
+    }
+
+    static void RunJobsConcurrently(std::vector<BlitJob> &jobs, std::atomic<int> &mismatches) {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreadCount; ++t) {
+            threads.emplace_back([&jobs, &mismatches, t]() {
+                for (int it = 0; it < kIterations; ++it) {
+                    BlitJob &job = jobs[(t + it) % jobs.size()];
+                    // Each thread writes to its own copy of the destination.
+                    std::vector<XBYTE> dst(job.dstBuffer.Size(), 0);
+                    VxImageDescEx dstDesc = job.dstDesc;
+                    dstDesc.Image = dst.data();
+                    if (job.upsideDown) {
+                        VxDoBlitUpsideDown(job.srcDesc, dstDesc);
+                    } else {
+                        VxDoBlit(job.srcDesc, dstDesc);
+                    }
+                    if (memcmp(dst.data(), job.expected.Data(), dst.size()) != 0) {
+                        mismatches.fetch_add(1);
+                    }
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+    }
+};
+
+TEST_F(BlitEngineConcurrencyTest, ConcurrentFormatConversionsMatchSerialResult) {
+    std::vector<BlitJob> jobs(6);
+    PrepareJob(jobs[0], ImageDescFactory::Create32BitARGB(67, 33), ImageDescFactory::Create16Bit565(67, 33), 1);
+    PrepareJob(jobs[1], ImageDescFactory::Create32BitARGB(64, 48), ImageDescFactory::Create24BitRGB(64, 48), 2);
+    PrepareJob(jobs[2], ImageDescFactory::Create16Bit1555(45, 20), ImageDescFactory::Create32BitARGB(45, 20), 3);
+    PrepareJob(jobs[3], ImageDescFactory::Create32BitARGB(31, 17), ImageDescFactory::Create32BitABGR(31, 17), 4, true);
+    PrepareJob(jobs[4], ImageDescFactory::Create24BitRGB(40, 40), ImageDescFactory::Create16Bit4444(40, 40), 5);
+    PrepareJob(jobs[5], ImageDescFactory::Create16Bit565(29, 13), ImageDescFactory::Create16Bit555(29, 13), 6, true);
+
+    std::atomic<int> mismatches(0);
+    RunJobsConcurrently(jobs, mismatches);
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+TEST_F(BlitEngineConcurrencyTest, ConcurrentPalettedBlitsKeepCachesIsolated) {
+    // Paletted -> 16bpp kernels cache the converted palette per operation stamp,
+    // so interleaving different palettes across threads must not leak entries.
+    std::vector<BlitJob> jobs(4);
+    PrepareJob(jobs[0], ImageDescFactory::Create8BitPaletted(50, 30),
+               ImageDescFactory::Create16Bit565(50, 30), 11);
+    PrepareJob(jobs[1], ImageDescFactory::Create8BitPaletted(50, 30),
+               ImageDescFactory::Create16Bit565(50, 30), 12);
+    PrepareJob(jobs[2], ImageDescFactory::Create8BitPaletted(33, 21),
+               ImageDescFactory::Create16Bit1555(33, 21), 13);
+    PrepareJob(jobs[3], ImageDescFactory::Create8BitPaletted(33, 21),
+               ImageDescFactory::Create16Bit4444(33, 21), 14);
+
+    std::atomic<int> mismatches(0);
+    RunJobsConcurrently(jobs, mismatches);
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+TEST_F(BlitEngineConcurrencyTest, ConcurrentResizingBlitsMatchSerialResult) {
+    std::vector<BlitJob> jobs(3);
+    PrepareJob(jobs[0], ImageDescFactory::Create32BitARGB(64, 64), ImageDescFactory::Create32BitARGB(97, 41), 21);
+    PrepareJob(jobs[1], ImageDescFactory::Create32BitARGB(128, 32), ImageDescFactory::Create16Bit565(40, 80), 22);
+    PrepareJob(jobs[2], ImageDescFactory::Create32BitARGB(17, 90), ImageDescFactory::Create24BitRGB(300, 45), 23);
+
+    std::atomic<int> mismatches(0);
+    RunJobsConcurrently(jobs, mismatches);
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+TEST_F(BlitEngineConcurrencyTest, RebuildDuringBlitsDoesNotDisturbResults) {
+    std::vector<BlitJob> jobs(2);
+    PrepareJob(jobs[0], ImageDescFactory::Create32BitARGB(80, 40), ImageDescFactory::Create16Bit565(80, 40), 31);
+    PrepareJob(jobs[1], ImageDescFactory::Create32BitARGB(80, 40), ImageDescFactory::Create32BitRGBA(80, 40), 32);
+
+    std::atomic<bool> done(false);
+    std::thread rebuilder([&done]() {
+        while (!done.load()) {
+            TheBlitter.RebuildTables();
+            std::this_thread::yield();
+        }
+    });
+
+    std::atomic<int> mismatches(0);
+    RunJobsConcurrently(jobs, mismatches);
+    done.store(true);
+    rebuilder.join();
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
@@ -218,7 +218,7 @@ TEST_F(BlitEngineResizeContractTest, Resize_24BitSource_MayConvertFirst) {
     EXPECT_NO_THROW(blitter.ResizeImage(srcDesc, dstDesc));
 }
 
-TEST_F(BlitEngineResizeContractTest, Resize_16BitSource_UsesNearestPath) {
+TEST_F(BlitEngineResizeContractTest, Resize_16BitSource_UsesFusedPath) {
     const int srcW = 32, srcH = 32;
     const int dstW = 16, dstH = 16;
 
@@ -228,7 +228,7 @@ TEST_F(BlitEngineResizeContractTest, Resize_16BitSource_UsesNearestPath) {
     auto srcDesc = ImageDescFactory::Create16Bit565(srcW, srcH, srcBuf.Data());
     auto dstDesc = ImageDescFactory::Create16Bit565(dstW, dstH, dstBuf.Data());
 
-    // 16-bit same-format resize is supported through nearest-neighbor path.
+    // 16-bit same-format resize is supported through the fused bilinear path.
     EXPECT_NO_THROW(blitter.ResizeImage(srcDesc, dstDesc));
 }
 
@@ -0,0 +1,441 @@
+/**
+ * @file BlitEngineDXTEncodeTest.cpp
+ * @brief Tests for DXT1/DXT3/DXT5 compression through VxDoBlit.
+ *
+ * Tests:
+ * - Round-trip quality (PSNR) for range fit and cluster fit
+ * - Every SIMD tier produces the same blocks
+ * - Cluster fit is never worse than range fit
+ * - Solid blocks, DXT1 punch-through and DXT3 explicit alpha
+ * - Sources without alpha encode opaque; DXT2/DXT4 store premultiplied color
+ * - Sizes that are not multiples of the block size
+ * - Padded block rows, with the pitch given by TotalImageSize
+ * - Non-ARGB sources, upside-down encoding, batches, plans and row-band parallelism
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "BlitEngineTestHelpers.h"
+
+using namespace BlitEngineTest;
+
+namespace {
+
+int BlockBytes(VX_PIXELFORMAT format) {
+    return format == _DXT1 ? 8 : 16;
+}
+
+VxImageDescEx CreateDXTDesc(VX_PIXELFORMAT format, int width, int height, XBYTE *image = nullptr) {
+    VxImageDescEx desc;
+    VxPixelFormat2ImageDesc(format, desc);
+    desc.Width = width;
+    desc.Height = height;
+    desc.TotalImageSize = ((width + 3) / 4) * ((height + 3) / 4) * BlockBytes(format);
+    desc.Image = image;
+    return desc;
+}
+
+int Clamp255(int v) {
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+// Smooth gradients with a little noise and a varying alpha ramp, the kind of
+// content block compression is meant for.
+std::vector<XDWORD> MakeImage(int width, int height, XDWORD seed) {
+    std::vector<XDWORD> image(width * height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            seed = seed * 1664525u + 1013904223u;
+            const int noise = static_cast<int>(seed >> 29) - 4;
+            const int r = Clamp255(x * 255 / (width > 1 ? width - 1 : 1) + noise);
+            const int g = Clamp255(y * 255 / (height > 1 ? height - 1 : 1) - noise);
+            const int b = (x + y) * 255 / (width + height);
+            const int a = 255 - (x + y * 2) * 255 / (width + height * 2);
+            image[y * width + x] = (static_cast<XDWORD>(a) << 24) | (r << 16) | (g << 8) | b;
+        }
+    }
+    return image;
+}
+
+std::vector<XDWORD> MakeNoise(int width, int height, XDWORD seed) {
+    std::vector<XDWORD> image(width * height);
+    for (XDWORD &pixel : image) {
+        seed = seed * 1664525u + 1013904223u;
+        pixel = seed ^ (seed >> 13);
+    }
+    return image;
+}
+
+// Encodes an ARGB image with VxDoBlit.
+std::vector<XBYTE> Encode(VX_PIXELFORMAT format, const std::vector<XDWORD> &image, int width, int height) {
+    std::vector<XBYTE> blocks(CreateDXTDesc(format, width, height).TotalImageSize, 0xCD);
+    VxImageDescEx src = ImageDescFactory::Create32BitARGB(width, height);
+    src.Image = reinterpret_cast<XBYTE *>(const_cast<XDWORD *>(image.data()));
+    VxDoBlit(src, CreateDXTDesc(format, width, height, blocks.data()));
+    return blocks;
+}
+
+std::vector<XDWORD> Decode(VX_PIXELFORMAT format, const std::vector<XBYTE> &blocks, int width, int height) {
+    std::vector<XDWORD> image(width * height, 0xDEADBEEF);
+    VxImageDescEx src = CreateDXTDesc(format, width, height, const_cast<XBYTE *>(blocks.data()));
+    VxDoBlit(src, ImageDescFactory::Create32BitARGB(width, height, reinterpret_cast<XBYTE *>(image.data())));
+    return image;
+}
+
+// Summed squared error over the RGB channels (or alpha only).
+double SquaredError(const std::vector<XDWORD> &a, const std::vector<XDWORD> &b, bool alpha) {
+    double sum = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        const int first = alpha ? 24 : 0;
+        const int last = alpha ? 24 : 16;
+        for (int shift = first; shift <= last; shift += 8) {
+            const int d = static_cast<int>((a[i] >> shift) & 0xFF) - static_cast<int>((b[i] >> shift) & 0xFF);
+            sum += d * d;
+        }
+    }
+    return sum;
+}
+
+double PSNR(const std::vector<XDWORD> &a, const std::vector<XDWORD> &b, bool alpha) {
+    const double mse = SquaredError(a, b, alpha) / (a.size() * (alpha ? 1.0 : 3.0));
+    return mse <= 0.0 ? 99.0 : 10.0 * std::log10(255.0 * 255.0 / mse);
+}
+
+const VX_PIXELFORMAT kDXTFormats[] = {_DXT1, _DXT3, _DXT5};
+
+} // namespace
+
+class BlitEngineDXTEncodeTest : public BlitEngineTestBase {
+protected:
+    void SetUp() override {
+        BlitEngineTestBase::SetUp();
+        m_PreviousSIMDMode = VxGetSIMDOverride();
+        m_PreviousQuality = VxGetDXTCompressionQuality();
+        VxGetBlitParallelism(m_SavedThreads, m_SavedMinRows);
+    }
+
+    void TearDown() override {
+        VxSetSIMDOverride(m_PreviousSIMDMode);
+        VxSetDXTCompressionQuality(m_PreviousQuality);
+        VxSetBlitParallelism(m_SavedThreads, m_SavedMinRows);
+        BlitEngineTestBase::TearDown();
+    }
+
+private:
+    int m_PreviousSIMDMode = VX_SIMD_MODE_AUTO;
+    int m_PreviousQuality = VX_DXTQUALITY_FAST;
+    int m_SavedThreads = 1;
+    int m_SavedMinRows = 64;
+};
+
+TEST_F(BlitEngineDXTEncodeTest, QualitySettingRoundTripsAndClamps) {
+    VxSetDXTCompressionQuality(VX_DXTQUALITY_HIGH);
+    EXPECT_EQ(VX_DXTQUALITY_HIGH, VxGetDXTCompressionQuality());
+    VxSetDXTCompressionQuality(VX_DXTQUALITY_FAST);
+    EXPECT_EQ(VX_DXTQUALITY_FAST, VxGetDXTCompressionQuality());
+    VxSetDXTCompressionQuality(7);
+    EXPECT_EQ(VX_DXTQUALITY_HIGH, VxGetDXTCompressionQuality());
+    VxSetDXTCompressionQuality(-1);
+    EXPECT_EQ(VX_DXTQUALITY_FAST, VxGetDXTCompressionQuality());
+}
+
+TEST_F(BlitEngineDXTEncodeTest, RoundTripQuality) {
+    const int w = 64;
+    const int h = 64;
+    const std::vector<XDWORD> image = MakeImage(w, h, 3);
+    const int qualities[] = {VX_DXTQUALITY_FAST, VX_DXTQUALITY_HIGH};
+    for (int quality : qualities) {
+        VxSetDXTCompressionQuality(quality);
+        for (VX_PIXELFORMAT format : kDXTFormats) {
+            std::vector<XDWORD> source = image;
+            if (format == _DXT1) {
+                for (XDWORD &pixel : source) pixel |= 0xFF000000;
+            }
+            const std::vector<XDWORD> decoded = Decode(format, Encode(format, source, w, h), w, h);
+            EXPECT_GT(PSNR(source, decoded, false), 35.0) << VxPixelFormat2String(format) << " quality " << quality;
+            if (format == _DXT3) {
+                EXPECT_GT(PSNR(source, decoded, true), 32.0) << "quality " << quality;
+            } else if (format == _DXT5) {
+                EXPECT_GT(PSNR(source, decoded, true), 45.0) << "quality " << quality;
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineDXTEncodeTest, AllBackendsEncodeIdentically) {
+    const int w = 36;
+    const int h = 20;
+    const std::vector<XDWORD> images[] = {MakeImage(w, h, 5), MakeNoise(w, h, 6)};
+    const int modes[] = {VX_SIMD_MODE_SSE2, VX_SIMD_MODE_SSSE3, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_AUTO};
+    const int qualities[] = {VX_DXTQUALITY_FAST, VX_DXTQUALITY_HIGH};
+
+    for (const std::vector<XDWORD> &image : images) {
+        for (int quality : qualities) {
+            VxSetDXTCompressionQuality(quality);
+            for (VX_PIXELFORMAT format : kDXTFormats) {
+                ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_NONE));
+                const std::vector<XBYTE> expected = Encode(format, image, w, h);
+                for (int mode : modes) {
+                    ASSERT_TRUE(VxSetSIMDOverride(mode));
+                    EXPECT_EQ(expected, Encode(format, image, w, h))
+                        << VxPixelFormat2String(format) << " quality " << quality << " backend "
+                        << VxGetSIMDBackendName(VxGetSIMDEffectiveBackend());
+                }
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineDXTEncodeTest, ClusterFitNeverWorseThanRangeFit) {
+    const int w = 48;
+    const int h = 48;
+    const std::vector<XDWORD> images[] = {MakeImage(w, h, 9), MakeNoise(w, h, 10)};
+    for (const std::vector<XDWORD> &image : images) {
+        for (VX_PIXELFORMAT format : kDXTFormats) {
+            VxSetDXTCompressionQuality(VX_DXTQUALITY_FAST);
+            const std::vector<XDWORD> fast = Decode(format, Encode(format, image, w, h), w, h);
+            VxSetDXTCompressionQuality(VX_DXTQUALITY_HIGH);
+            const std::vector<XDWORD> high = Decode(format, Encode(format, image, w, h), w, h);
+
+            // DXT1 punch-through blocks take the same path at both qualities.
+            EXPECT_LE(SquaredError(image, high, false), SquaredError(image, fast, false))
+                << VxPixelFormat2String(format);
+            EXPECT_LE(SquaredError(image, high, true), SquaredError(image, fast, true))
+                << VxPixelFormat2String(format);
+        }
+    }
+}
+
+TEST_F(BlitEngineDXTEncodeTest, SolidBlocksAndExplicitAlpha) {
+    const int w = 8;
+    const int h = 8;
+    // Colors that are exactly representable in 565.
+    std::vector<XDWORD> image(w * h, 0x80FF0084);
+    const std::vector<XDWORD> dxt5 = Decode(_DXT5, Encode(_DXT5, image, w, h), w, h);
+    EXPECT_EQ(image, dxt5);
+
+    for (int i = 0; i < w * h; ++i) {
+        image[i] = (static_cast<XDWORD>(i * 4) << 24) | 0x00FF0084;
+    }
+    const std::vector<XDWORD> dxt3 = Decode(_DXT3, Encode(_DXT3, image, w, h), w, h);
+    for (int i = 0; i < w * h; ++i) {
+        const XDWORD alpha = ((image[i] >> 24) * 15 + 127) / 255 * 17;
+        EXPECT_EQ((alpha << 24) | 0x00FF0084, dxt3[i]) << "pixel " << i;
+    }
+}
+
+TEST_F(BlitEngineDXTEncodeTest, DXT1PunchThrough) {
+    const int w = 8;
+    const int h = 4;
+    std::vector<XDWORD> image = MakeImage(w, h, 11);
+    for (int i = 0; i < w * h; ++i) {
+        // First block fully transparent, second block a checkerboard.
+        const bool transparent = (i % w) < 4 || ((i % w) + i / w) % 2 == 0;
+        image[i] = (image[i] & 0x00FFFFFF) | (transparent ? 0x10000000u : 0xF0000000u);
+    }
+
+    const int qualities[] = {VX_DXTQUALITY_FAST, VX_DXTQUALITY_HIGH};
+    for (int quality : qualities) {
+        VxSetDXTCompressionQuality(quality);
+        const std::vector<XDWORD> decoded = Decode(_DXT1, Encode(_DXT1, image, w, h), w, h);
+        for (int i = 0; i < w * h; ++i) {
+            if (image[i] < 0x80000000) {
+                EXPECT_EQ(0u, decoded[i]) << "pixel " << i;
+            } else {
+                EXPECT_EQ(0xFF000000u, decoded[i] & 0xFF000000u) << "pixel " << i;
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineDXTEncodeTest, SourcesWithoutAlphaAreOpaque) {
+    const int w = 12;
+    const int h = 8;
+    // Transparent ARGB input: only the color may survive the conversion.
+    std::vector<XDWORD> image = MakeImage(w, h, 17);
+    for (XDWORD &pixel : image) {
+        pixel &= 0x00FFFFFF;
+    }
+    VxImageDescEx argbDesc = ImageDescFactory::Create32BitARGB(w, h);
+    argbDesc.Image = reinterpret_cast<XBYTE *>(image.data());
+
+    const VxImageDescEx sources[] = {ImageDescFactory::Create24BitRGB(w, h), ImageDescFactory::Create32BitRGB(w, h),
+                                     ImageDescFactory::Create16Bit565(w, h), ImageDescFactory::Create16Bit555(w, h),
+                                     ImageDescFactory::Create16BitBGR565(w, h)};
+    const VX_PIXELFORMAT formats[] = {_DXT1, _DXT2, _DXT3, _DXT4, _DXT5};
+    for (const VxImageDescEx &source : sources) {
+        ImageBuffer pixels(ImageDescFactory::CalcBufferSize(source));
+        VxImageDescEx srcDesc = source;
+        srcDesc.Image = pixels.Data();
+        VxDoBlit(argbDesc, srcDesc);
+
+        for (VX_PIXELFORMAT format : formats) {
+            std::vector<XBYTE> blocks(CreateDXTDesc(format, w, h).TotalImageSize);
+            VxDoBlit(srcDesc, CreateDXTDesc(format, w, h, blocks.data()));
+            const std::vector<XDWORD> decoded = Decode(format, blocks, w, h);
+            for (int i = 0; i < w * h; ++i) {
+                ASSERT_EQ(0xFF000000u, decoded[i] & 0xFF000000u)
+                    << source.BitsPerPixel << "bpp -> " << VxPixelFormat2String(format) << " pixel " << i;
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineDXTEncodeTest, PremultipliedFormatsRoundTrip) {
+    const int w = 8;
+    const int h = 4;
+    // DXT3 stores 0x88 exactly; its premultiplied color is (136, 68, 34).
+    const std::vector<XDWORD> image(w * h, 0x88FF8040);
+    const XDWORD straight = 0x88FF8040;
+    const XDWORD premultiplied = 0x88884422;
+
+    struct Case {
+        VX_PIXELFORMAT format;
+        XDWORD expected;
+    } cases[] = {{_DXT2, premultiplied}, {_DXT3, straight}, {_DXT4, premultiplied}, {_DXT5, straight}};
+
+    for (const Case &c : cases) {
+        const std::vector<XDWORD> decoded = Decode(c.format, Encode(c.format, image, w, h), w, h);
+        for (int i = 0; i < w * h; ++i) {
+            EXPECT_EQ(c.expected >> 24, decoded[i] >> 24) << VxPixelFormat2String(c.format) << " pixel " << i;
+            // 565 endpoints: up to 4 levels off in red and blue, 2 in green.
+            for (int shift = 0; shift <= 16; shift += 8) {
+                const int d = static_cast<int>((c.expected >> shift) & 0xFF) -
+                              static_cast<int>((decoded[i] >> shift) & 0xFF);
+                EXPECT_LE(std::abs(d), shift == 8 ? 2 : 4)
+                    << VxPixelFormat2String(c.format) << " pixel " << i << " channel " << shift;
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineDXTEncodeTest, PartialBlocksRepeatEdgePixels) {
+    const int w = 13;
+    const int h = 7;
+    const std::vector<XDWORD> image = MakeImage(w, h, 12);
+
+    // The same image padded by hand to whole blocks.
+    const int pw = 16;
+    const int ph = 8;
+    std::vector<XDWORD> padded(pw * ph);
+    for (int y = 0; y < ph; ++y) {
+        for (int x = 0; x < pw; ++x) {
+            padded[y * pw + x] = image[(y < h ? y : h - 1) * w + (x < w ? x : w - 1)];
+        }
+    }
+
+    for (VX_PIXELFORMAT format : kDXTFormats) {
+        EXPECT_EQ(Encode(format, padded, pw, ph), Encode(format, image, w, h)) << VxPixelFormat2String(format);
+    }
+}
+
+TEST_F(BlitEngineDXTEncodeTest, BlockRowPitch) {
+    const int w = 13;
+    const int h = 10;
+    const std::vector<XDWORD> image = MakeImage(w, h, 16);
+    VxImageDescEx src = ImageDescFactory::Create32BitARGB(w, h);
+    src.Image = reinterpret_cast<XBYTE *>(const_cast<XDWORD *>(image.data()));
+
+    for (VX_PIXELFORMAT format : kDXTFormats) {
+        const std::vector<XBYTE> packed = Encode(format, image, w, h);
+        const int rowBytes = ((w + 3) / 4) * BlockBytes(format);
+        const int pitch = rowBytes + 24;
+        const int blockRows = (h + 3) / 4;
+
+        // BytesPerLine and TotalImageSize share storage: the size gives the pitch.
+        std::vector<XBYTE> padded(pitch * blockRows, 0xCD);
+        VxImageDescEx dst = CreateDXTDesc(format, w, h, padded.data());
+        dst.TotalImageSize = pitch * blockRows;
+        VxDoBlit(src, dst);
+        for (int by = 0; by < blockRows; ++by) {
+            EXPECT_EQ(0, memcmp(&packed[by * rowBytes], &padded[by * pitch], rowBytes))
+                << VxPixelFormat2String(format) << " block row " << by;
+            for (int i = rowBytes; i < pitch; ++i) {
+                ASSERT_EQ(0xCD, padded[by * pitch + i]) << VxPixelFormat2String(format) << " block row " << by;
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineDXTEncodeTest, ConvertedSourcesMatchARGB) {
+    const int w = 20;
+    const int h = 12;
+    const std::vector<XDWORD> image = MakeImage(w, h, 13);
+
+    // 16-bit source: encoding it equals encoding its ARGB expansion.
+    ImageBuffer rgb565(w * h * 2);
+    VxImageDescEx argbDesc = ImageDescFactory::Create32BitARGB(w, h);
+    argbDesc.Image = reinterpret_cast<XBYTE *>(const_cast<XDWORD *>(image.data()));
+    VxImageDescEx rgb565Desc = ImageDescFactory::Create16Bit565(w, h, rgb565.Data());
+    VxDoBlit(argbDesc, rgb565Desc);
+
+    std::vector<XDWORD> expanded(w * h);
+    VxDoBlit(rgb565Desc, ImageDescFactory::Create32BitARGB(w, h, reinterpret_cast<XBYTE *>(expanded.data())));
+
+    for (VX_PIXELFORMAT format : kDXTFormats) {
+        std::vector<XBYTE> blocks(CreateDXTDesc(format, w, h).TotalImageSize);
+        VxDoBlit(rgb565Desc, CreateDXTDesc(format, w, h, blocks.data()));
+        EXPECT_EQ(Encode(format, expanded, w, h), blocks) << VxPixelFormat2String(format);
+    }
+
+    // Upside-down encoding equals encoding the flipped image.
+    std::vector<XDWORD> flipped(w * h);
+    for (int y = 0; y < h; ++y) {
+        memcpy(&flipped[y * w], &image[(h - 1 - y) * w], w * 4);
+    }
+    for (VX_PIXELFORMAT format : kDXTFormats) {
+        std::vector<XBYTE> blocks(CreateDXTDesc(format, w, h).TotalImageSize);
+        VxDoBlitUpsideDown(argbDesc, CreateDXTDesc(format, w, h, blocks.data()));
+        EXPECT_EQ(Encode(format, flipped, w, h), blocks) << VxPixelFormat2String(format);
+    }
+}
+
+TEST_F(BlitEngineDXTEncodeTest, RejectsResizeAndShortDestinations) {
+    const std::vector<XDWORD> image = MakeImage(16, 16, 14);
+    VxImageDescEx src = ImageDescFactory::Create32BitARGB(16, 16);
+    src.Image = reinterpret_cast<XBYTE *>(const_cast<XDWORD *>(image.data()));
+
+    std::vector<XBYTE> blocks(256, 0xCD);
+    VxDoBlit(src, CreateDXTDesc(_DXT5, 8, 8, blocks.data()));
+    VxImageDescEx shortDesc = CreateDXTDesc(_DXT5, 16, 16, blocks.data());
+    shortDesc.TotalImageSize = 128;
+    VxDoBlit(src, shortDesc);
+    for (XBYTE b : blocks) {
+        ASSERT_EQ(0xCD, b);
+    }
+}
+
+TEST_F(BlitEngineDXTEncodeTest, BatchPlanAndParallelMatchDoBlit) {
+    const int w = 64;
+    const int h = 96;
+    const std::vector<XDWORD> image = MakeImage(w, h, 15);
+    VxImageDescEx src = ImageDescFactory::Create32BitARGB(w, h);
+    src.Image = reinterpret_cast<XBYTE *>(const_cast<XDWORD *>(image.data()));
+
+    for (VX_PIXELFORMAT format : kDXTFormats) {
+        const std::vector<XBYTE> expected = Encode(format, image, w, h);
+
+        std::vector<XBYTE> batched(expected.size());
+        VxImageDescEx dst = CreateDXTDesc(format, w, h, batched.data());
+        VxDoBlitBatch(&src, &dst, 1, FALSE);
+        EXPECT_EQ(expected, batched) << VxPixelFormat2String(format);
+
+        std::vector<XBYTE> planned(expected.size());
+        VxImageDescEx planSrc = src;
+        planSrc.Image = nullptr;
+        VxBlitPlan *plan = VxCreateBlitPlan(planSrc, CreateDXTDesc(format, w, h));
+        ASSERT_NE(nullptr, plan);
+        VxExecuteBlitPlan(plan, src.Image, planned.data());
+        VxDeleteBlitPlan(plan);
+        EXPECT_EQ(expected, planned) << VxPixelFormat2String(format);
+
+        VxSetBlitParallelism(4, 8);
+        std::vector<XBYTE> parallel(expected.size());
+        VxDoBlit(src, CreateDXTDesc(format, w, h, parallel.data()));
+        VxSetBlitParallelism(1, 64);
+        EXPECT_EQ(expected, parallel) << VxPixelFormat2String(format);
+    }
+}
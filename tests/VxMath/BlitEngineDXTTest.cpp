@@ -0,0 +1,349 @@
+/**
+ * @file BlitEngineDXTTest.cpp
+ * @brief Tests for DXT1/DXT3/DXT5 decompression through VxDoBlit.
+ *
+ * Tests:
+ * - Every SIMD tier matches an independent scalar reference bit-for-bit
+ * - DXT1 punch-through and DXT5 six/four-level alpha blocks
+ * - Sizes that are not multiples of the block size
+ * - Padded block rows, with the pitch given by TotalImageSize
+ * - Conversion to other 32-bit layouts and 16-bit formats
+ * - Upside-down decoding, batches, plans and row-band parallelism
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "BlitEngineTestHelpers.h"
+
+using namespace BlitEngineTest;
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Reference decoder (straight from the BC1-BC3 format description)
+//------------------------------------------------------------------------------
+
+struct RefColor {
+    int a, r, g, b;
+};
+
+RefColor Ref565(int c) {
+    const int r = (c >> 11) & 0x1F;
+    const int g = (c >> 5) & 0x3F;
+    const int b = c & 0x1F;
+    return {255, (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+}
+
+RefColor RefMix(const RefColor &c0, const RefColor &c1, int w0, int w1) {
+    const int d = w0 + w1;
+    return {255, (w0 * c0.r + w1 * c1.r) / d, (w0 * c0.g + w1 * c1.g) / d, (w0 * c0.b + w1 * c1.b) / d};
+}
+
+XDWORD RefPack(const RefColor &c) {
+    return (static_cast<XDWORD>(c.a) << 24) | (c.r << 16) | (c.g << 8) | c.b;
+}
+
+// Decodes one block to 16 ARGB pixels (row-major).
+void RefDecodeBlock(VX_PIXELFORMAT format, const XBYTE *block, XDWORD out[16]) {
+    const XBYTE *colorBlock = (format == _DXT1) ? block : block + 8;
+    const int c0 = colorBlock[0] | (colorBlock[1] << 8);
+    const int c1 = colorBlock[2] | (colorBlock[3] << 8);
+    RefColor colors[4];
+    colors[0] = Ref565(c0);
+    colors[1] = Ref565(c1);
+    if (format != _DXT1 || c0 > c1) {
+        colors[2] = RefMix(colors[0], colors[1], 2, 1);
+        colors[3] = RefMix(colors[0], colors[1], 1, 2);
+    } else {
+        colors[2] = RefMix(colors[0], colors[1], 1, 1);
+        colors[3] = {0, 0, 0, 0};
+    }
+
+    int alphas[8] = {};
+    if (format == _DXT5) {
+        const int a0 = block[0];
+        const int a1 = block[1];
+        alphas[0] = a0;
+        alphas[1] = a1;
+        if (a0 > a1) {
+            for (int i = 1; i <= 6; ++i) alphas[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+        } else {
+            for (int i = 1; i <= 4; ++i) alphas[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+            alphas[6] = 0;
+            alphas[7] = 255;
+        }
+    }
+
+    for (int p = 0; p < 16; ++p) {
+        const int index = (colorBlock[4 + p / 4] >> ((p % 4) * 2)) & 3;
+        RefColor c = colors[index];
+        if (format == _DXT3) {
+            c.a = ((block[p / 2] >> ((p % 2) * 4)) & 0xF) * 17;
+        } else if (format == _DXT5) {
+            const int bit = p * 3;
+            int bits = block[2 + bit / 8] >> (bit % 8);
+            if (bit % 8 > 5) bits |= block[2 + bit / 8 + 1] << (8 - bit % 8);
+            c.a = alphas[bits & 7];
+        }
+        out[p] = RefPack(c);
+    }
+}
+
+int BlockBytes(VX_PIXELFORMAT format) {
+    return format == _DXT1 ? 8 : 16;
+}
+
+VxImageDescEx CreateDXTDesc(VX_PIXELFORMAT format, int width, int height) {
+    VxImageDescEx desc;
+    VxPixelFormat2ImageDesc(format, desc);
+    desc.Width = width;
+    desc.Height = height;
+    desc.TotalImageSize = ((width + 3) / 4) * ((height + 3) / 4) * BlockBytes(format);
+    return desc;
+}
+
+// Random blocks with both endpoint orderings and every index pattern.
+std::vector<XBYTE> MakeBlocks(VX_PIXELFORMAT format, int width, int height, XDWORD seed) {
+    std::vector<XBYTE> data(((width + 3) / 4) * ((height + 3) / 4) * BlockBytes(format));
+    for (size_t i = 0; i < data.size(); ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        data[i] = static_cast<XBYTE>(seed >> 24);
+    }
+    return data;
+}
+
+// Reference ARGB image of the full (unpadded) size.
+std::vector<XDWORD> RefDecodeImage(VX_PIXELFORMAT format, const std::vector<XBYTE> &data, int width, int height) {
+    std::vector<XDWORD> image(width * height);
+    const int blocksX = (width + 3) / 4;
+    for (int by = 0; by < (height + 3) / 4; ++by) {
+        for (int bx = 0; bx < blocksX; ++bx) {
+            XDWORD block[16];
+            RefDecodeBlock(format, &data[(by * blocksX + bx) * BlockBytes(format)], block);
+            for (int p = 0; p < 16; ++p) {
+                const int x = bx * 4 + p % 4;
+                const int y = by * 4 + p / 4;
+                if (x < width && y < height) image[y * width + x] = block[p];
+            }
+        }
+    }
+    return image;
+}
+
+const VX_PIXELFORMAT kDXTFormats[] = {_DXT1, _DXT3, _DXT5};
+
+} // namespace
+
+class BlitEngineDXTTest : public BlitEngineTestBase {
+protected:
+    void SetUp() override {
+        BlitEngineTestBase::SetUp();
+        m_PreviousSIMDMode = VxGetSIMDOverride();
+        VxGetBlitParallelism(m_SavedThreads, m_SavedMinRows);
+    }
+
+    void TearDown() override {
+        VxSetSIMDOverride(m_PreviousSIMDMode);
+        VxSetBlitParallelism(m_SavedThreads, m_SavedMinRows);
+        BlitEngineTestBase::TearDown();
+    }
+
+    // Decodes through VxDoBlit into ARGB 8888 and compares with the reference.
+    void ExpectDecodeMatchesReference(VX_PIXELFORMAT format, int width, int height, XDWORD seed) {
+        std::vector<XBYTE> data = MakeBlocks(format, width, height, seed);
+        const std::vector<XDWORD> expected = RefDecodeImage(format, data, width, height);
+
+        VxImageDescEx src = CreateDXTDesc(format, width, height);
+        src.Image = data.data();
+        VxImageDescEx dst = ImageDescFactory::Create32BitARGB(width, height);
+        std::vector<XDWORD> actual(width * height, 0xDEADBEEF);
+        dst.Image = reinterpret_cast<XBYTE *>(actual.data());
+
+        VxDoBlit(src, dst);
+        for (int i = 0; i < width * height; ++i) {
+            ASSERT_EQ(expected[i], actual[i]) << VxPixelFormat2String(format) << " " << width << "x" << height
+                                              << " pixel " << i << " backend "
+                                              << VxGetSIMDBackendName(VxGetSIMDEffectiveBackend());
+        }
+    }
+
+private:
+    int m_PreviousSIMDMode = VX_SIMD_MODE_AUTO;
+    int m_SavedThreads = 1;
+    int m_SavedMinRows = 64;
+};
+
+TEST_F(BlitEngineDXTTest, AllBackendsMatchReference) {
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_SSSE3, VX_SIMD_MODE_AVX2,
+                         VX_SIMD_MODE_AUTO};
+    for (int mode : modes) {
+        ASSERT_TRUE(VxSetSIMDOverride(mode));
+        for (VX_PIXELFORMAT format : kDXTFormats) {
+            ExpectDecodeMatchesReference(format, 64, 64, 1);
+            ExpectDecodeMatchesReference(format, 128, 8, 2);
+        }
+    }
+}
+
+TEST_F(BlitEngineDXTTest, PunchThroughAndAlphaModes) {
+    // DXT1: c0 <= c1 selects three colors + transparent black.
+    const XBYTE dxt1[8] = {0x10, 0x42, 0x1F, 0xF8, 0xE4, 0x1B, 0xFF, 0x00};
+    // DXT5: a0 <= a1 selects four interpolated levels plus 0 and 255.
+    const XBYTE dxt5[16] = {40, 200, 0x88, 0xC6, 0xFA, 0x05, 0x39, 0x77,
+                            0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xE4, 0x1B, 0xE4};
+    struct Case {
+        VX_PIXELFORMAT format;
+        const XBYTE *block;
+    } cases[] = {{_DXT1, dxt1}, {_DXT5, dxt5}};
+
+    for (const Case &c : cases) {
+        XDWORD expected[16];
+        RefDecodeBlock(c.format, c.block, expected);
+
+        VxImageDescEx src = CreateDXTDesc(c.format, 4, 4);
+        src.Image = const_cast<XBYTE *>(c.block);
+        VxImageDescEx dst = ImageDescFactory::Create32BitARGB(4, 4);
+        XDWORD actual[16] = {};
+        dst.Image = reinterpret_cast<XBYTE *>(actual);
+        VxDoBlit(src, dst);
+        for (int i = 0; i < 16; ++i) {
+            EXPECT_EQ(expected[i], actual[i]) << VxPixelFormat2String(c.format) << " pixel " << i;
+        }
+    }
+
+    // The transparent entry really is used by the DXT1 block above.
+    XDWORD decoded[16];
+    RefDecodeBlock(_DXT1, dxt1, decoded);
+    bool sawTransparent = false;
+    for (XDWORD p : decoded) sawTransparent |= (p == 0);
+    EXPECT_TRUE(sawTransparent);
+}
+
+TEST_F(BlitEngineDXTTest, PartialBlocks) {
+    for (VX_PIXELFORMAT format : kDXTFormats) {
+        ExpectDecodeMatchesReference(format, 1, 1, 3);
+        ExpectDecodeMatchesReference(format, 3, 7, 4);
+        ExpectDecodeMatchesReference(format, 13, 6, 5);
+        ExpectDecodeMatchesReference(format, 33, 17, 6);
+    }
+}
+
+TEST_F(BlitEngineDXTTest, BlockRowPitch) {
+    const int width = 13, height = 10;
+    for (VX_PIXELFORMAT format : kDXTFormats) {
+        const std::vector<XBYTE> packed = MakeBlocks(format, width, height, 10);
+        const std::vector<XDWORD> expected = RefDecodeImage(format, packed, width, height);
+
+        // Copy the block rows into a surface with 24 bytes of padding per row.
+        const int rowBytes = ((width + 3) / 4) * BlockBytes(format);
+        const int pitch = rowBytes + 24;
+        const int blockRows = (height + 3) / 4;
+        std::vector<XBYTE> padded(pitch * blockRows, 0xCD);
+        for (int by = 0; by < blockRows; ++by) {
+            memcpy(&padded[by * pitch], &packed[by * rowBytes], rowBytes);
+        }
+
+        // BytesPerLine and TotalImageSize share storage: the size gives the pitch.
+        VxImageDescEx src = CreateDXTDesc(format, width, height);
+        src.TotalImageSize = pitch * blockRows;
+        src.Image = padded.data();
+        std::vector<XDWORD> actual(width * height, 0xDEADBEEF);
+        VxImageDescEx dst = ImageDescFactory::Create32BitARGB(width, height);
+        dst.Image = reinterpret_cast<XBYTE *>(actual.data());
+        VxDoBlit(src, dst);
+        EXPECT_EQ(expected, actual) << VxPixelFormat2String(format);
+
+        // A pitch shorter than one row of blocks is rejected.
+        std::fill(actual.begin(), actual.end(), 0xDEADBEEF);
+        src.TotalImageSize = rowBytes * blockRows - 1;
+        VxDoBlit(src, dst);
+        EXPECT_EQ(std::vector<XDWORD>(width * height, 0xDEADBEEF), actual) << VxPixelFormat2String(format);
+    }
+}
+
+TEST_F(BlitEngineDXTTest, ConvertsToOtherLayouts) {
+    const int w = 22;
+    const int h = 10;
+    for (VX_PIXELFORMAT format : kDXTFormats) {
+        std::vector<XBYTE> data = MakeBlocks(format, w, h, 7);
+        VxImageDescEx src = CreateDXTDesc(format, w, h);
+        src.Image = data.data();
+
+        // Decode to ARGB first, then convert; a direct blit must agree.
+        ImageBuffer argb(w * h * 4);
+        VxImageDescEx argbDesc = ImageDescFactory::Create32BitARGB(w, h);
+        argbDesc.Image = argb.Data();
+        VxDoBlit(src, argbDesc);
+
+        const VxImageDescEx targets[] = {ImageDescFactory::Create32BitABGR(w, h), ImageDescFactory::Create32BitRGBA(w, h),
+                                         ImageDescFactory::Create16Bit565(w, h),
+                                         ImageDescFactory::Create16Bit4444(w, h)};
+        for (const VxImageDescEx &target : targets) {
+            ImageBuffer expected(ImageDescFactory::CalcBufferSize(target));
+            ImageBuffer actual(ImageDescFactory::CalcBufferSize(target));
+            VxImageDescEx expectedDesc = target;
+            expectedDesc.Image = expected.Data();
+            VxImageDescEx actualDesc = target;
+            actualDesc.Image = actual.Data();
+
+            VxDoBlit(argbDesc, expectedDesc);
+            VxDoBlit(src, actualDesc);
+            EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), expected.Size()))
+                << VxPixelFormat2String(format) << " -> " << target.BitsPerPixel << "bpp";
+        }
+    }
+}
+
+TEST_F(BlitEngineDXTTest, UpsideDownBatchPlanAndParallel) {
+    const int w = 40;
+    const int h = 300;
+    for (VX_PIXELFORMAT format : kDXTFormats) {
+        std::vector<XBYTE> data = MakeBlocks(format, w, h, 8);
+        const std::vector<XDWORD> expected = RefDecodeImage(format, data, w, h);
+        VxImageDescEx src = CreateDXTDesc(format, w, h);
+        src.Image = data.data();
+        VxImageDescEx dst = ImageDescFactory::Create32BitARGB(w, h);
+        std::vector<XDWORD> actual(w * h);
+        dst.Image = reinterpret_cast<XBYTE *>(actual.data());
+
+        VxDoBlitUpsideDown(src, dst);
+        for (int y = 0; y < h; ++y) {
+            ASSERT_EQ(0, memcmp(&expected[y * w], &actual[(h - 1 - y) * w], w * 4)) << "row " << y;
+        }
+
+        std::fill(actual.begin(), actual.end(), 0u);
+        VxDoBlitBatch(&src, &dst, 1);
+        EXPECT_EQ(expected, actual);
+
+        std::fill(actual.begin(), actual.end(), 0u);
+        VxBlitPlan *plan = VxCreateBlitPlan(src, dst);
+        ASSERT_NE(nullptr, plan);
+        VxExecuteBlitPlan(plan, data.data(), dst.Image);
+        VxDeleteBlitPlan(plan);
+        EXPECT_EQ(expected, actual);
+
+        std::fill(actual.begin(), actual.end(), 0u);
+        VxSetBlitParallelism(4, 8);
+        VxDoBlit(src, dst);
+        VxSetBlitParallelism(1, 64);
+        EXPECT_EQ(expected, actual);
+    }
+}
+
+TEST_F(BlitEngineDXTTest, UnsupportedDestinationsAreIgnored) {
+    std::vector<XBYTE> data = MakeBlocks(_DXT1, 8, 8, 9);
+    VxImageDescEx src = CreateDXTDesc(_DXT1, 8, 8);
+    src.Image = data.data();
+
+    // Resizing a DXT source is rejected like any non-32-bit resize.
+    ImageBuffer dst(16 * 16 * 4);
+    VxImageDescEx resized = ImageDescFactory::Create32BitARGB(16, 16);
+    resized.Image = dst.Data();
+    VxDoBlit(src, resized);
+    for (size_t i = 0; i < dst.Size(); ++i) {
+        ASSERT_EQ(0, dst[i]);
+    }
+
+    EXPECT_EQ(nullptr, VxCreateBlitPlan(src, CreateDXTDesc(_DXT5, 8, 8)));
+}
@@ -0,0 +1,236 @@
+/**
+ * @file BlitEngineDitherTest.cpp
+ * @brief Tests for dithered blits (VxDoBlit with a VX_DITHERMODE).
+ *
+ * Tests:
+ * - Ordered dithering keeps exact 16-bit levels and preserves local averages
+ * - Ordered dithering is bit-identical across SIMD tiers and parallel bands
+ * - Error diffusion preserves local averages of paletted output
+ * - Error diffusion pipelined over several threads matches the serial result
+ * - Pairs without a dithered path behave like VxDoBlit
+ */
+
+#include "BlitEngineTestHelpers.h"
+
+using namespace BlitEngineTest;
+
+class BlitEngineDitherTest : public BlitEngineTestBase {
+protected:
+    void SetUp() override {
+        BlitEngineTestBase::SetUp();
+        m_PreviousSIMDMode = VxGetSIMDOverride();
+        VxGetBlitParallelism(m_PreviousThreads, m_PreviousMinRows);
+    }
+
+    void TearDown() override {
+        VxSetSIMDOverride(m_PreviousSIMDMode);
+        VxSetBlitParallelism(m_PreviousThreads, m_PreviousMinRows);
+        BlitEngineTestBase::TearDown();
+    }
+
+    // Smooth gradients in every channel: many levels between 16-bit steps.
+    static void FillGradient(ImageBuffer &buffer, int width, int height, int bpp) {
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                XBYTE *p = buffer.Data() + (y * width + x) * bpp;
+                p[0] = static_cast<XBYTE>(x * 255 / (width - 1));
+                p[1] = static_cast<XBYTE>(y * 255 / (height - 1));
+                p[2] = static_cast<XBYTE>((x + y) * 255 / (width + height - 2));
+                if (bpp == 4) p[3] = static_cast<XBYTE>(255 - x * 255 / (width - 1));
+            }
+        }
+    }
+
+    int m_PreviousSIMDMode = VX_SIMD_MODE_AUTO;
+    int m_PreviousThreads = 1;
+    int m_PreviousMinRows = 64;
+};
+
+TEST_F(BlitEngineDitherTest, OrderedKeepsExactLevels) {
+    const int width = 37;
+    const int height = 9;
+    ImageBuffer src(width * height * 4);
+    ImageBuffer expected(width * height * 2);
+    ImageBuffer actual(width * height * 2);
+    // Channels on 5/6-bit levels (multiples of 8) plus the extremes.
+    XDWORD *pixels = reinterpret_cast<XDWORD *>(src.Data());
+    for (int i = 0; i < width * height; ++i) {
+        const XDWORD r = (i * 8) & 0xF8;
+        const XDWORD g = (i * 12) & 0xF8;
+        const XDWORD b = (i % 3 == 0) ? 0xFF : (i * 16) & 0xF8;
+        pixels[i] = 0xFF000000 | (r << 16) | (g << 8) | b;
+    }
+
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, height, src.Data());
+    VxImageDescEx expectedDesc = ImageDescFactory::Create16Bit565(width, height, expected.Data());
+    VxImageDescEx actualDesc = ImageDescFactory::Create16Bit565(width, height, actual.Data());
+    VxDoBlit(srcDesc, expectedDesc);
+    VxDoBlit(srcDesc, actualDesc, VX_DITHER_ORDERED);
+    EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), expected.Size()));
+}
+
+TEST_F(BlitEngineDitherTest, OrderedPreservesLocalAverages) {
+    // Every 4x4 tile of a flat color averages back to that color, where plain
+    // truncation is biased down by up to one 5-bit step. Values from 248 up
+    // saturate at the top level either way.
+    const int size = 4;
+    ImageBuffer src(size * size * 4);
+    ImageBuffer dst(size * size * 2);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(size, size, src.Data());
+    VxImageDescEx dstDesc = ImageDescFactory::Create16Bit565(size, size, dst.Data());
+    double worstDithered = 0.0;
+    double worstTruncated = 0.0;
+    for (int v = 0; v < 248; ++v) {
+        PatternGenerator::FillSolid32(src.Data(), size, size, static_cast<XBYTE>(v), 0, 0, 0xFF);
+        for (int dither = 0; dither < 2; ++dither) {
+            VxDoBlit(srcDesc, dstDesc, dither ? VX_DITHER_ORDERED : VX_DITHER_NONE);
+            const XWORD *texels = reinterpret_cast<const XWORD *>(dst.Data());
+            double sum = 0.0;
+            for (int i = 0; i < size * size; ++i) sum += (texels[i] >> 11) * 8.0;
+            const double error = std::fabs(sum / (size * size) - v);
+            double &worst = dither ? worstDithered : worstTruncated;
+            worst = (std::max)(worst, error);
+        }
+    }
+    EXPECT_LT(worstDithered, 1.0);
+    EXPECT_GT(worstTruncated, 6.0);
+}
+
+TEST_F(BlitEngineDitherTest, OrderedAllBackendsAndBandsMatch) {
+    const int width = 133;
+    const int height = 70;
+    struct Pair {
+        VxImageDescEx src;
+        VxImageDescEx dst;
+    };
+    const Pair pairs[] = {
+        {ImageDescFactory::Create32BitARGB(width, height), ImageDescFactory::Create16Bit565(width, height)},
+        {ImageDescFactory::Create32BitARGB(width, height), ImageDescFactory::Create16Bit555(width, height)},
+        {ImageDescFactory::Create32BitARGB(width, height), ImageDescFactory::Create16Bit1555(width, height)},
+        {ImageDescFactory::Create32BitARGB(width, height), ImageDescFactory::Create16Bit4444(width, height)},
+        {ImageDescFactory::Create24BitRGB(width, height), ImageDescFactory::Create16Bit565(width, height)},
+        {ImageDescFactory::Create32BitABGR(width, height), ImageDescFactory::Create16BitBGR565(width, height)},
+    };
+    const int modes[] = {VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2};
+
+    for (const Pair &pair : pairs) {
+        const int bpp = pair.src.BitsPerPixel / 8;
+        ImageBuffer src(width * height * bpp);
+        FillGradient(src, width, height, bpp);
+        ImageBuffer expected(width * height * 2);
+        ImageBuffer actual(width * height * 2);
+        VxImageDescEx srcDesc = pair.src;
+        srcDesc.Image = src.Data();
+        VxImageDescEx expectedDesc = pair.dst;
+        expectedDesc.Image = expected.Data();
+        VxImageDescEx actualDesc = pair.dst;
+        actualDesc.Image = actual.Data();
+
+        ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_NONE));
+        VxSetBlitParallelism(1, 64);
+        VxDoBlit(srcDesc, expectedDesc, VX_DITHER_ORDERED);
+
+        for (int mode : modes) {
+            if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) continue;
+            actual.Clear();
+            VxDoBlit(srcDesc, actualDesc, VX_DITHER_ORDERED);
+            EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), expected.Size()))
+                << "bpp=" << bpp << " dstMask=" << pair.dst.RedMask << " mode=" << mode;
+        }
+
+        VxSetBlitParallelism(4, 8);
+        actual.Clear();
+        VxDoBlit(srcDesc, actualDesc, VX_DITHER_ORDERED);
+        EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), expected.Size())) << "parallel bpp=" << bpp;
+    }
+}
+
+TEST_F(BlitEngineDitherTest, ErrorDiffusionPreservesLocalAverages) {
+    const int width = 512;
+    const int height = 64;
+    ImageBuffer src(width * height * 3);
+    FillGradient(src, width, height, 3);
+    VxImageDescEx srcDesc = ImageDescFactory::Create24BitRGB(width, height, src.Data());
+
+    // Mean error of 8x8 block averages: diffusion pushes rounding error into
+    // neighbors, so block averages track the source more closely.
+    double blockError[2] = {0.0, 0.0};
+    for (int dither = 0; dither < 2; ++dither) {
+        ImageBuffer indices(width * height);
+        PaletteBuffer palette;
+        VxImageDescEx dstDesc = ImageDescFactory::Create8BitPaletted(width, height, indices.Data(), palette.Data());
+        ASSERT_TRUE(TheBlitter.QuantizeImageMedianCut(srcDesc, dstDesc,
+                                                      dither ? VX_DITHER_ERRORDIFFUSION : VX_DITHER_NONE));
+        for (int by = 0; by < height; by += 8) {
+            for (int bx = 0; bx < width; bx += 8) {
+                for (int c = 0; c < 3; ++c) {
+                    double sum = 0.0;
+                    for (int y = by; y < by + 8; ++y) {
+                        for (int x = bx; x < bx + 8; ++x) {
+                            const XDWORD color = palette.GetColor(indices[y * width + x]);
+                            sum += static_cast<double>((color >> (c * 8)) & 0xFF) - src[(y * width + x) * 3 + c];
+                        }
+                    }
+                    blockError[dither] += std::fabs(sum / 64.0);
+                }
+            }
+        }
+    }
+    EXPECT_LT(blockError[1], blockError[0] * 0.5) << "nearest=" << blockError[0] << " diffused=" << blockError[1];
+}
+
+TEST_F(BlitEngineDitherTest, ErrorDiffusionPipelineMatchesSerial) {
+    const int width = 150;
+    const int height = 90;
+    ImageBuffer src(width * height * 3);
+    FillGradient(src, width, height, 3);
+    VxImageDescEx srcDesc = ImageDescFactory::Create24BitRGB(width, height, src.Data());
+
+    ImageBuffer serial(width * height);
+    ImageBuffer pipelined(width * height);
+    PaletteBuffer serialPalette;
+    PaletteBuffer pipelinedPalette;
+    VxImageDescEx serialDesc = ImageDescFactory::Create8BitPaletted(width, height, serial.Data(), serialPalette.Data());
+    VxImageDescEx pipelinedDesc =
+        ImageDescFactory::Create8BitPaletted(width, height, pipelined.Data(), pipelinedPalette.Data());
+
+    VxSetBlitParallelism(1, 64);
+    VxDoBlit(srcDesc, serialDesc, VX_DITHER_ERRORDIFFUSION);
+    VxSetBlitParallelism(4, 8);
+    VxDoBlit(srcDesc, pipelinedDesc, VX_DITHER_ERRORDIFFUSION);
+    EXPECT_EQ(0, memcmp(serial.Data(), pipelined.Data(), serial.Size()));
+    EXPECT_EQ(0, memcmp(serialPalette.Data(), pipelinedPalette.Data(), 256 * sizeof(XDWORD)));
+
+    VxSetBlitParallelism(1, 64);
+    TheBlitter.QuantizeImageMedianCut(srcDesc, serialDesc, VX_DITHER_ERRORDIFFUSION);
+    VxSetBlitParallelism(3, 8);
+    TheBlitter.QuantizeImageMedianCut(srcDesc, pipelinedDesc, VX_DITHER_ERRORDIFFUSION);
+    EXPECT_EQ(0, memcmp(serial.Data(), pipelined.Data(), serial.Size()));
+}
+
+TEST_F(BlitEngineDitherTest, PairsWithoutDitheredPathMatchDoBlit) {
+    const int width = 24;
+    const int height = 10;
+    ImageBuffer src(width * height * 4);
+    FillGradient(src, width, height, 4);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, height, src.Data());
+
+    const VxImageDescEx targets[] = {
+        ImageDescFactory::Create32BitABGR(width, height),  // No precision lost
+        ImageDescFactory::Create16Bit565(width, height),   // Error diffusion is for palettes
+        ImageDescFactory::Create16Bit565(width / 2, height / 2), // Resizing blit
+    };
+    const VX_DITHERMODE modes[] = {VX_DITHER_ORDERED, VX_DITHER_ERRORDIFFUSION, VX_DITHER_ORDERED};
+    for (int t = 0; t < 3; ++t) {
+        const size_t size = ImageDescFactory::CalcBufferSize(targets[t]);
+        ImageBuffer expected(size);
+        ImageBuffer actual(size);
+        VxImageDescEx expectedDesc = targets[t];
+        expectedDesc.Image = expected.Data();
+        VxImageDescEx actualDesc = targets[t];
+        actualDesc.Image = actual.Data();
+        VxDoBlit(srcDesc, expectedDesc);
+        VxDoBlit(srcDesc, actualDesc, modes[t]);
+        EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), size)) << "target " << t;
+    }
+}
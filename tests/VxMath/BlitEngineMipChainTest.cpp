@@ -0,0 +1,258 @@
+/**
+ * @file BlitEngineMipChainTest.cpp
+ * @brief Tests for single-pass mip chain generation (VxGenerateMipChain).
+ *
+ * Tests:
+ * - Level count and packed chain size
+ * - Solid colors stay exact in every mode
+ * - Level 1 matches VxGenerateMipMap on even sizes
+ * - Default mode rounds a 2x2 box of each even-sized 8-bit level
+ * - Odd and non-power-of-two sizes weigh every texel
+ * - sRGB-correct and alpha-weighted averaging
+ * - SIMD tiers and parallel bands are bit-identical to the scalar path
+ */
+
+#include "BlitEngineTestHelpers.h"
+
+using namespace BlitEngineTest;
+
+class BlitEngineMipChainTest : public BlitEngineTestBase {
+protected:
+    void SetUp() override {
+        BlitEngineTestBase::SetUp();
+        m_PreviousSIMDMode = VxGetSIMDOverride();
+        VxGetBlitParallelism(m_PreviousThreads, m_PreviousMinRows);
+    }
+
+    void TearDown() override {
+        VxSetSIMDOverride(m_PreviousSIMDMode);
+        VxSetBlitParallelism(m_PreviousThreads, m_PreviousMinRows);
+        BlitEngineTestBase::TearDown();
+    }
+
+    static void FillSolid(ImageBuffer &buffer, XDWORD color) {
+        XDWORD *pixels = reinterpret_cast<XDWORD *>(buffer.Data());
+        for (size_t i = 0; i < buffer.Size() / 4; ++i) pixels[i] = color;
+    }
+
+    static void FillNoise(ImageBuffer &buffer, int seed) {
+        XDWORD state = 0x9E3779B9u ^ static_cast<XDWORD>(seed);
+        for (size_t i = 0; i < buffer.Size(); ++i) {
+            state = state * 1664525u + 1013904223u;
+            buffer[i] = static_cast<XBYTE>(state >> 24);
+        }
+    }
+
+    std::vector<XBYTE> Generate(const VxImageDescEx &src, XDWORD flags, int *levels = nullptr) {
+        std::vector<XBYTE> chain(VxGetMipChainSize(src.Width, src.Height) + 16, 0xCD);
+        const int count = VxGenerateMipChain(src, chain.data(), flags);
+        if (levels) *levels = count;
+        // Nothing is written past the chain.
+        for (size_t i = chain.size() - 16; i < chain.size(); ++i) {
+            EXPECT_EQ(0xCD, chain[i]);
+        }
+        chain.resize(chain.size() - 16);
+        return chain;
+    }
+
+    int m_PreviousSIMDMode = VX_SIMD_MODE_AUTO;
+    int m_PreviousThreads = 1;
+    int m_PreviousMinRows = 64;
+};
+
+TEST_F(BlitEngineMipChainTest, LevelCountAndSize) {
+    EXPECT_EQ(8 * 4 * 4 + 4 * 2 * 4 + 2 * 1 * 4 + 1 * 1 * 4, VxGetMipChainSize(16, 8));
+    EXPECT_EQ(3 * 4 + 1 * 4, VxGetMipChainSize(7, 1));
+    EXPECT_EQ(0, VxGetMipChainSize(1, 1));
+    EXPECT_EQ(0, VxGetMipChainSize(0, 4));
+
+    ImageBuffer src(16 * 8 * 4);
+    VxImageDescEx desc = ImageDescFactory::Create32BitARGB(16, 8);
+    desc.Image = src.Data();
+    int levels = 0;
+    Generate(desc, VX_MIPCHAIN_DEFAULT, &levels);
+    EXPECT_EQ(4, levels);
+
+    ImageBuffer tiny(4);
+    VxImageDescEx one = ImageDescFactory::Create32BitARGB(1, 1);
+    one.Image = tiny.Data();
+    XBYTE out[4] = {};
+    EXPECT_EQ(0, VxGenerateMipChain(one, out));
+    EXPECT_EQ(0, VxGenerateMipChain(desc, nullptr));
+
+    VxImageDescEx wrong = ImageDescFactory::Create16Bit565(16, 8);
+    wrong.Image = src.Data();
+    std::vector<XBYTE> chain(VxGetMipChainSize(16, 8));
+    EXPECT_EQ(0, VxGenerateMipChain(wrong, chain.data()));
+}
+
+TEST_F(BlitEngineMipChainTest, SolidColorIsExactInEveryMode) {
+    const int sizes[][2] = {{64, 64}, {37, 21}, {1, 19}, {100, 3}};
+    const XDWORD flagSets[] = {VX_MIPCHAIN_DEFAULT, VX_MIPCHAIN_SRGB, VX_MIPCHAIN_ALPHA_WEIGHTED,
+                               VX_MIPCHAIN_SRGB | VX_MIPCHAIN_ALPHA_WEIGHTED};
+    const XDWORD color = 0xC8336699;
+    for (const auto &size : sizes) {
+        ImageBuffer src(size[0] * size[1] * 4);
+        FillSolid(src, color);
+        VxImageDescEx desc = ImageDescFactory::Create32BitARGB(size[0], size[1]);
+        desc.Image = src.Data();
+        for (XDWORD flags : flagSets) {
+            const std::vector<XBYTE> chain = Generate(desc, flags);
+            const XDWORD *texels = reinterpret_cast<const XDWORD *>(chain.data());
+            for (size_t i = 0; i < chain.size() / 4; ++i) {
+                ASSERT_EQ(color, texels[i]) << size[0] << "x" << size[1] << " flags=" << flags << " texel " << i;
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineMipChainTest, FirstLevelMatchesGenerateMipMap) {
+    const int w = 64;
+    const int h = 32;
+    ImageBuffer src(w * h * 4);
+    FillNoise(src, 1);
+    VxImageDescEx desc = ImageDescFactory::Create32BitARGB(w, h);
+    desc.Image = src.Data();
+
+    std::vector<XBYTE> expected((w / 2) * (h / 2) * 4);
+    VxGenerateMipMap(desc, expected.data());
+    const std::vector<XBYTE> chain = Generate(desc, VX_MIPCHAIN_DEFAULT);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_NEAR(expected[i], chain[i], 1) << "byte " << i;
+    }
+}
+
+TEST_F(BlitEngineMipChainTest, DefaultModeBoxesEvenLevels) {
+    const int w = 256;
+    const int h = 192;
+    ImageBuffer src(w * h * 4);
+    FillNoise(src, 2);
+    VxImageDescEx desc = ImageDescFactory::Create32BitARGB(w, h);
+    desc.Image = src.Data();
+
+    VxSetBlitParallelism(1, 64);
+    const std::vector<XBYTE> chain = Generate(desc, VX_MIPCHAIN_DEFAULT);
+    const XBYTE *above = src.Data();
+    const XBYTE *level = chain.data();
+    // 256x192 halves evenly down to 4x3.
+    for (int lw = w / 2, lh = h / 2; lh >= 3; lw /= 2, lh /= 2) {
+        for (int y = 0; y < lh; ++y) {
+            for (int i = 0; i < lw * 4; ++i) {
+                const XBYTE *p = above + (2 * y * lw * 2) * 4 + (i / 4) * 8 + (i % 4);
+                const int sum = p[0] + p[4] + p[lw * 8] + p[lw * 8 + 4];
+                ASSERT_EQ((sum + 2) >> 2, level[y * lw * 4 + i]) << lw << "x" << lh << " row " << y << " byte " << i;
+            }
+        }
+        above = level;
+        level += lw * lh * 4;
+    }
+
+    VxSetBlitParallelism(4, 8);
+    EXPECT_EQ(chain, Generate(desc, VX_MIPCHAIN_DEFAULT));
+}
+
+TEST_F(BlitEngineMipChainTest, OddSizesWeighEveryTexel) {
+    // 3x3 -> 1x1 averages all nine texels, so a single bright corner shows up.
+    ImageBuffer src(3 * 3 * 4);
+    FillSolid(src, 0xFF000000);
+    reinterpret_cast<XDWORD *>(src.Data())[8] = 0xFFFFFFFF;
+    VxImageDescEx desc = ImageDescFactory::Create32BitARGB(3, 3);
+    desc.Image = src.Data();
+    std::vector<XBYTE> chain = Generate(desc, VX_MIPCHAIN_DEFAULT);
+    ASSERT_EQ(4u, chain.size());
+    EXPECT_NEAR(255 / 9, chain[0], 1);
+    EXPECT_EQ(0xFF, chain[3]);
+
+    // 5 -> 2 spreads the middle texel over both outputs.
+    ImageBuffer row(5 * 4);
+    FillSolid(row, 0xFF000000);
+    reinterpret_cast<XDWORD *>(row.Data())[2] = 0xFFFFFFFF;
+    VxImageDescEx rowDesc = ImageDescFactory::Create32BitARGB(5, 1);
+    rowDesc.Image = row.Data();
+    chain = Generate(rowDesc, VX_MIPCHAIN_DEFAULT);
+    ASSERT_EQ((2 + 1) * 4u, chain.size());
+    EXPECT_GT(chain[0], 0);
+    EXPECT_EQ(chain[0], chain[4]);
+}
+
+TEST_F(BlitEngineMipChainTest, SRGBAveragesInLinearLight) {
+    // Black/white checker: gamma-space averaging gives 128, linear-light 188.
+    const int w = 8;
+    const int h = 8;
+    ImageBuffer src(w * h * 4);
+    XDWORD *pixels = reinterpret_cast<XDWORD *>(src.Data());
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) pixels[y * w + x] = ((x + y) & 1) ? 0xFFFFFFFF : 0xFF000000;
+    }
+    VxImageDescEx desc = ImageDescFactory::Create32BitARGB(w, h);
+    desc.Image = src.Data();
+
+    const std::vector<XBYTE> plain = Generate(desc, VX_MIPCHAIN_DEFAULT);
+    const std::vector<XBYTE> srgb = Generate(desc, VX_MIPCHAIN_SRGB);
+    EXPECT_NEAR(128, plain[0], 1);
+    EXPECT_NEAR(188, srgb[0], 1);
+    EXPECT_EQ(0xFF, srgb[3]);
+    // Every level of the chain keeps the linear-light mid grey.
+    for (size_t i = 0; i < srgb.size(); i += 4) {
+        EXPECT_NEAR(188, srgb[i + 1], 1) << "texel " << i / 4;
+    }
+}
+
+TEST_F(BlitEngineMipChainTest, AlphaWeightingStopsTransparentColorBleed) {
+    ImageBuffer src(2 * 2 * 4);
+    XDWORD *pixels = reinterpret_cast<XDWORD *>(src.Data());
+    pixels[0] = 0x00FF0000; // Transparent red
+    pixels[1] = 0xFF00FF00; // Opaque green
+    pixels[2] = 0x00FF0000;
+    pixels[3] = 0xFF00FF00;
+    VxImageDescEx desc = ImageDescFactory::Create32BitARGB(2, 2);
+    desc.Image = src.Data();
+
+    const std::vector<XBYTE> plain = Generate(desc, VX_MIPCHAIN_DEFAULT);
+    const std::vector<XBYTE> weighted = Generate(desc, VX_MIPCHAIN_ALPHA_WEIGHTED);
+    EXPECT_NEAR(128, plain[2], 1);
+    EXPECT_EQ(0, weighted[2]);
+    EXPECT_EQ(0xFF, weighted[1]);
+    EXPECT_NEAR(128, weighted[3], 1);
+
+    // Without an alpha channel the flag is ignored.
+    VxImageDescEx noAlpha = desc;
+    noAlpha.AlphaMask = 0;
+    EXPECT_EQ(plain, Generate(noAlpha, VX_MIPCHAIN_ALPHA_WEIGHTED));
+}
+
+TEST_F(BlitEngineMipChainTest, AllBackendsMatch) {
+    const int sizes[][2] = {{128, 96}, {67, 45}, {33, 1}, {2, 81}};
+    const XDWORD flagSets[] = {VX_MIPCHAIN_DEFAULT, VX_MIPCHAIN_SRGB | VX_MIPCHAIN_ALPHA_WEIGHTED};
+    const int modes[] = {VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2};
+    for (const auto &size : sizes) {
+        ImageBuffer src(size[0] * size[1] * 4);
+        FillNoise(src, size[0]);
+        VxImageDescEx desc = ImageDescFactory::Create32BitARGB(size[0], size[1]);
+        desc.Image = src.Data();
+        for (XDWORD flags : flagSets) {
+            ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_NONE));
+            const std::vector<XBYTE> expected = Generate(desc, flags);
+            for (int mode : modes) {
+                if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) continue;
+                EXPECT_EQ(expected, Generate(desc, flags))
+                    << size[0] << "x" << size[1] << " flags=" << flags << " mode=" << mode;
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineMipChainTest, ParallelBandsMatchSerial) {
+    const int sizes[][2] = {{256, 256}, {96, 200}, {75, 144}, {64, 130}};
+    for (const auto &size : sizes) {
+        ImageBuffer src(size[0] * size[1] * 4);
+        FillNoise(src, size[1]);
+        VxImageDescEx desc = ImageDescFactory::Create32BitARGB(size[0], size[1]);
+        desc.Image = src.Data();
+
+        VxSetBlitParallelism(1, 64);
+        const std::vector<XBYTE> expected = Generate(desc, VX_MIPCHAIN_SRGB);
+        VxSetBlitParallelism(4, 8);
+        EXPECT_EQ(expected, Generate(desc, VX_MIPCHAIN_SRGB)) << size[0] << "x" << size[1];
+    }
+}
@@ -0,0 +1,416 @@
+/**
+ * @file BlitEngineNormalMapTest.cpp
+ * @brief Tests for normal and bump map generation (VxConvertToNormalMap / VxConvertToBumpMap).
+ *
+ * Tests:
+ * - The default operator matches the original per-pixel stencils on every
+ *   available SIMD tier, at odd sizes, for luminance and masked heights
+ * - Central, Sobel and Scharr match a per-pixel reference on every tier
+ * - Out-of-place conversion matches in-place and leaves the source untouched
+ * - Parallel row bands produce the same output as a single band
+ * - A linear ramp keeps the same slope under every operator
+ * - Invalid descriptors and filters are rejected
+ */
+
+#include "BlitEngineTestHelpers.h"
+
+#include <cmath>
+
+using namespace BlitEngineTest;
+
+class BlitEngineNormalMapTest : public BlitEngineTestBase {
+protected:
+    void SetUp() override {
+        BlitEngineTestBase::SetUp();
+        m_PreviousSIMDMode = VxGetSIMDOverride();
+        VxGetBlitParallelism(m_PreviousThreads, m_PreviousMinRows);
+    }
+
+    void TearDown() override {
+        VxSetSIMDOverride(m_PreviousSIMDMode);
+        VxSetBlitParallelism(m_PreviousThreads, m_PreviousMinRows);
+        BlitEngineTestBase::TearDown();
+    }
+
+    static std::vector<int> AvailableModes() {
+        const int candidates[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_AVX512,
+                                  VX_SIMD_MODE_NEON, VX_SIMD_MODE_WASM_SIMD128};
+        std::vector<int> modes;
+        for (int mode : candidates) {
+            if (VxSetSIMDOverride(mode) && VxGetSIMDEffectiveBackend() == mode) modes.push_back(mode);
+        }
+        return modes;
+    }
+
+    // Pixels with smooth regions, sharp edges and a few near-black texels so
+    // the bump map flag byte takes both values.
+    static std::vector<XDWORD> MakePixels(int width, int height, XDWORD seed) {
+        std::vector<XDWORD> pixels(width * height);
+        XDWORD state = seed;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                state = state * 1664525u + 1013904223u;
+                XDWORD p = state;
+                if (((x / 5) + y) % 4 == 0) p = 0x01010101u * static_cast<XDWORD>((x * 9 + y * 5) & 0xFF);
+                if ((x + y * 3) % 11 == 0) p &= 0xFF000001u;
+                pixels[y * width + x] = p;
+            }
+        }
+        return pixels;
+    }
+
+    // Copies pixels into a buffer with a padded pitch.
+    static ImageBuffer MakeImage(const std::vector<XDWORD> &pixels, int width, int height, int pitch) {
+        ImageBuffer image(pitch * height, 0xCD);
+        for (int y = 0; y < height; ++y) {
+            memcpy(image.Data() + y * pitch, &pixels[y * width], width * 4);
+        }
+        return image;
+    }
+
+    static XDWORD Pixel(const ImageBuffer &image, int pitch, int x, int y) {
+        XDWORD p;
+        memcpy(&p, image.Data() + y * pitch + x * 4, 4);
+        return p;
+    }
+
+    static int Luminance(XDWORD p) { return static_cast<int>((p & 0xFF) + ((p >> 8) & 0xFF) + ((p >> 16) & 0xFF)); }
+
+    static int MaskShift(XDWORD mask) {
+        int shift = 0;
+        while (shift < 32 && !(mask & (1u << shift))) ++shift;
+        return shift;
+    }
+
+    static XDWORD PackNormal(float dx, float dy, float height) {
+        const float invLen = 1.0f / sqrtf(dx * dx + dy * dy + 1.0f);
+        const int nx = static_cast<int>(dx * invLen * 127.0f + 128.0f);
+        const int ny = static_cast<int>(dy * invLen * 127.0f + 128.0f);
+        const int nz = static_cast<int>(invLen * 127.0f + 128.0f);
+        const int alpha = static_cast<int>(height * -255.0f);
+        return static_cast<XDWORD>((((nx - alpha * 256) * 256 + ny) * 256) + nz);
+    }
+
+    // The original VxConvertToNormalMap: forward differences in place, the
+    // right edge repeats its column and the last row copies the one above.
+    static std::vector<XDWORD> OriginalNormalMap(std::vector<XDWORD> pixels, int width, int height, XDWORD mask) {
+        const bool luminance = mask == 0xFFFFFFFF;
+        const float scale = luminance ? 0.0013071896f : 1.0f / 255.0f;
+        const int shift = MaskShift(mask);
+        auto heightOf = [&](XDWORD p) {
+            return static_cast<float>(luminance ? Luminance(p) : static_cast<int>((p & mask) >> shift)) * scale;
+        };
+        for (int y = 0; y < height - 1; ++y) {
+            for (int x = 0; x < width; ++x) {
+                const XDWORD p0 = pixels[y * width + x];
+                const XDWORD p1 = x + 1 < width ? pixels[y * width + x + 1] : p0;
+                const XDWORD p2 = pixels[(y + 1) * width + x];
+                const float h0 = heightOf(p0);
+                pixels[y * width + x] = PackNormal(heightOf(p1) - h0, heightOf(p2) - h0, h0);
+            }
+        }
+        if (height > 1) {
+            memcpy(&pixels[(height - 1) * width], &pixels[(height - 2) * width], width * 4);
+        }
+        return pixels;
+    }
+
+    static XDWORD PackBump(int lum, int du, int dv) {
+        return (lum <= 1 ? 127u : 63u) | (static_cast<XDWORD>(du & 0xFF) << 8) | (static_cast<XDWORD>(dv & 0xFF) << 16);
+    }
+
+    // The original VxConvertToBumpMap: rows wrap at the top and repeat at the
+    // bottom, columns wrap, and the first column has its own formula.
+    static std::vector<XDWORD> OriginalBumpMap(const std::vector<XDWORD> &pixels, int width, int height) {
+        std::vector<XDWORD> out(pixels.size());
+        for (int y = 0; y < height; ++y) {
+            const XDWORD *c = &pixels[y * width];
+            const XDWORD *a = &pixels[(y > 0 ? y - 1 : height - 1) * width];
+            const XDWORD *b = &pixels[(y + 1 < height ? y + 1 : y) * width];
+            XDWORD *dst = &out[y * width];
+            const int left = Luminance(c[width - 1]);
+            dst[0] = PackBump(Luminance(c[0]), Luminance(a[0]) - Luminance(b[0]) + left - Luminance(b[1]),
+                              left - Luminance(c[0]));
+            for (int x = 1; x < width - 1; ++x) {
+                dst[x] = PackBump(Luminance(c[x]), Luminance(a[x]) - Luminance(b[x]),
+                                  Luminance(c[x - 1]) - Luminance(c[x + 1]));
+            }
+            const int x = width - 1;
+            dst[x] = PackBump(Luminance(c[x]), Luminance(a[x]) - Luminance(b[x]),
+                              Luminance(c[x - 1]) - Luminance(c[0]));
+        }
+        return out;
+    }
+
+    // 3x3 gradient at (x, y) with the neighbor coordinates already resolved.
+    static void Gradient(const std::vector<int> &h, int width, int filter, int xl, int x, int xr, int ya, int y, int yb,
+                         int &gx, int &gy) {
+        auto at = [&](int px, int py) { return h[py * width + px]; };
+        const int side = filter == VX_GRADIENTFILTER_SOBEL ? 1 : filter == VX_GRADIENTFILTER_SCHARR ? 3 : 0;
+        const int centre = filter == VX_GRADIENTFILTER_SOBEL ? 2 : filter == VX_GRADIENTFILTER_SCHARR ? 10 : 1;
+        gx = side * (at(xr, ya) - at(xl, ya)) + centre * (at(xr, y) - at(xl, y)) + side * (at(xr, yb) - at(xl, yb));
+        gy = side * (at(xl, yb) - at(xl, ya)) + centre * (at(x, yb) - at(x, ya)) + side * (at(xr, yb) - at(xr, ya));
+    }
+
+    static std::vector<int> Heights(const std::vector<XDWORD> &pixels, XDWORD mask) {
+        std::vector<int> h(pixels.size());
+        const int shift = MaskShift(mask);
+        for (size_t i = 0; i < pixels.size(); ++i) {
+            h[i] = mask == 0xFFFFFFFF ? Luminance(pixels[i]) : static_cast<int>((pixels[i] & mask) >> shift);
+        }
+        return h;
+    }
+
+    // Central, Sobel and Scharr normal maps: every row computed, edges clamped.
+    static std::vector<XDWORD> ReferenceNormalMap(const std::vector<XDWORD> &pixels, int width, int height,
+                                                  XDWORD mask, int filter) {
+        const std::vector<int> h = Heights(pixels, mask);
+        const float scale = mask == 0xFFFFFFFF ? 0.0013071896f : 1.0f / 255.0f;
+        const float norm = filter == VX_GRADIENTFILTER_SOBEL ? 0.125f
+                           : filter == VX_GRADIENTFILTER_SCHARR ? 1.0f / 32.0f
+                                                                : 0.5f;
+        const float k = scale * norm;
+        std::vector<XDWORD> out(pixels.size());
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int gx, gy;
+                Gradient(h, width, filter, XMax(x - 1, 0), x, XMin(x + 1, width - 1), XMax(y - 1, 0), y,
+                         XMin(y + 1, height - 1), gx, gy);
+                out[y * width + x] = PackNormal(static_cast<float>(gx) * k, static_cast<float>(gy) * k,
+                                                static_cast<float>(h[y * width + x]) * scale);
+            }
+        }
+        return out;
+    }
+
+    // Central, Sobel and Scharr bump maps: edges wrap both ways.
+    static std::vector<XDWORD> ReferenceBumpMap(const std::vector<XDWORD> &pixels, int width, int height,
+                                                int filter) {
+        const std::vector<int> h = Heights(pixels, 0xFFFFFFFF);
+        const int divisor = filter == VX_GRADIENTFILTER_SOBEL ? 4 : filter == VX_GRADIENTFILTER_SCHARR ? 16 : 1;
+        std::vector<XDWORD> out(pixels.size());
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int gx, gy;
+                Gradient(h, width, filter, (x + width - 1) % width, x, (x + 1) % width, (y + height - 1) % height, y,
+                         (y + 1) % height, gx, gy);
+                // Round half toward the positive difference.
+                const int du = static_cast<int>(std::floor((divisor / 2 - gy) / static_cast<double>(divisor)));
+                const int dv = static_cast<int>(std::floor((divisor / 2 - gx) / static_cast<double>(divisor)));
+                out[y * width + x] = PackBump(h[y * width + x], du, dv);
+            }
+        }
+        return out;
+    }
+
+    static void ExpectImage(const std::vector<XDWORD> &expected, const ImageBuffer &image, int width, int height,
+                            int pitch, const std::string &what) {
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                ASSERT_EQ(expected[y * width + x], Pixel(image, pitch, x, y))
+                    << what << " size=" << width << "x" << height << " at " << x << "," << y;
+            }
+            ASSERT_EQ(0xCD, image[y * pitch + width * 4]) << what << " row " << y << " padding";
+        }
+    }
+
+    int m_PreviousSIMDMode = VX_SIMD_MODE_AUTO;
+    int m_PreviousThreads = 1;
+    int m_PreviousMinRows = 64;
+};
+
+namespace {
+
+const int kSizes[][2] = {{1, 1}, {2, 1}, {3, 2}, {5, 3}, {9, 4}, {16, 5}, {17, 3}, {33, 6}, {70, 4}};
+const XDWORD kMasks[] = {0xFFFFFFFF, 0x00FF0000, 0x0000FF00, 0xFF000000};
+
+std::string Describe(const char *kind, int mode, int filter, XDWORD mask = 0) {
+    char text[96];
+    snprintf(text, sizeof(text), "%s mode=%d filter=%d mask=%08X", kind, mode, filter, mask);
+    return text;
+}
+
+} // namespace
+
+TEST_F(BlitEngineNormalMapTest, DefaultNormalMapMatchesOriginal) {
+    for (int mode : AvailableModes()) {
+        ASSERT_TRUE(VxSetSIMDOverride(mode));
+        for (XDWORD mask : kMasks) {
+            for (const auto &size : kSizes) {
+                const int width = size[0];
+                const int height = size[1];
+                const int pitch = width * 4 + 8;
+                const std::vector<XDWORD> pixels = MakePixels(width, height, 7 + width);
+                ImageBuffer image = MakeImage(pixels, width, height, pitch);
+                VxImageDescEx desc = ImageDescFactory::Create32BitARGB(width, height, image.Data());
+                desc.BytesPerLine = pitch;
+
+                ASSERT_TRUE(VxConvertToNormalMap(desc, mask));
+                ExpectImage(OriginalNormalMap(pixels, width, height, mask), image, width, height, pitch,
+                            Describe("normal", mode, VX_GRADIENTFILTER_DEFAULT, mask));
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineNormalMapTest, DefaultBumpMapMatchesOriginal) {
+    for (int mode : AvailableModes()) {
+        ASSERT_TRUE(VxSetSIMDOverride(mode));
+        for (const auto &size : kSizes) {
+            const int width = size[0];
+            const int height = size[1];
+            if (width < 2) continue;
+            const int pitch = width * 4 + 8;
+            const std::vector<XDWORD> pixels = MakePixels(width, height, 11 + height);
+            ImageBuffer image = MakeImage(pixels, width, height, pitch);
+            VxImageDescEx desc = ImageDescFactory::Create32BitARGB(width, height, image.Data());
+            desc.BytesPerLine = pitch;
+
+            ASSERT_TRUE(VxConvertToBumpMap(desc));
+            ExpectImage(OriginalBumpMap(pixels, width, height), image, width, height, pitch,
+                        Describe("bump", mode, VX_GRADIENTFILTER_DEFAULT));
+        }
+    }
+}
+
+TEST_F(BlitEngineNormalMapTest, FiltersMatchReference) {
+    for (int mode : AvailableModes()) {
+        ASSERT_TRUE(VxSetSIMDOverride(mode));
+        for (int filter = VX_GRADIENTFILTER_CENTRAL; filter <= VX_GRADIENTFILTER_SCHARR; ++filter) {
+            for (const auto &size : kSizes) {
+                const int width = size[0];
+                const int height = size[1];
+                const int pitch = width * 4 + 8;
+                const std::vector<XDWORD> pixels = MakePixels(width, height, 3 + width * height);
+
+                for (XDWORD mask : kMasks) {
+                    ImageBuffer image = MakeImage(pixels, width, height, pitch);
+                    VxImageDescEx desc = ImageDescFactory::Create32BitARGB(width, height, image.Data());
+                    desc.BytesPerLine = pitch;
+                    ASSERT_TRUE(VxConvertToNormalMap(desc, mask, static_cast<VX_GRADIENTFILTER>(filter)));
+                    ExpectImage(ReferenceNormalMap(pixels, width, height, mask, filter), image, width, height, pitch,
+                                Describe("normal", mode, filter, mask));
+                }
+
+                if (width < 2) continue;
+                ImageBuffer image = MakeImage(pixels, width, height, pitch);
+                VxImageDescEx desc = ImageDescFactory::Create32BitARGB(width, height, image.Data());
+                desc.BytesPerLine = pitch;
+                ASSERT_TRUE(VxConvertToBumpMap(desc, static_cast<VX_GRADIENTFILTER>(filter)));
+                ExpectImage(ReferenceBumpMap(pixels, width, height, filter), image, width, height, pitch,
+                            Describe("bump", mode, filter));
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineNormalMapTest, OutOfPlaceMatchesInPlace) {
+    const int width = 37;
+    const int height = 9;
+    const std::vector<XDWORD> pixels = MakePixels(width, height, 21);
+    for (int filter = VX_GRADIENTFILTER_DEFAULT; filter <= VX_GRADIENTFILTER_SCHARR; ++filter) {
+        const VX_GRADIENTFILTER f = static_cast<VX_GRADIENTFILTER>(filter);
+        for (int bump = 0; bump < 2; ++bump) {
+            ImageBuffer inPlace = MakeImage(pixels, width, height, width * 4);
+            ImageBuffer src = MakeImage(pixels, width, height, width * 4);
+            ImageBuffer dst(width * height * 4, 0x5A);
+            VxImageDescEx inPlaceDesc = ImageDescFactory::Create32BitARGB(width, height, inPlace.Data());
+            VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, height, src.Data());
+            VxImageDescEx dstDesc = ImageDescFactory::Create32BitARGB(width, height, dst.Data());
+
+            if (bump) {
+                ASSERT_TRUE(VxConvertToBumpMap(inPlaceDesc, f));
+                ASSERT_TRUE(VxConvertToBumpMap(srcDesc, dstDesc, f));
+            } else {
+                ASSERT_TRUE(VxConvertToNormalMap(inPlaceDesc, 0x0000FF00, f));
+                ASSERT_TRUE(VxConvertToNormalMap(srcDesc, dstDesc, 0x0000FF00, f));
+            }
+            EXPECT_EQ(0, memcmp(inPlace.Data(), dst.Data(), dst.Size())) << "filter=" << filter << " bump=" << bump;
+            EXPECT_EQ(0, memcmp(src.Data(), pixels.data(), src.Size())) << "filter=" << filter << " bump=" << bump;
+        }
+    }
+
+    // A single row is copied to the destination unchanged by the default operator.
+    const XDWORD row[3] = {0x11223344, 0x55667788, 0x99AABBCC};
+    XDWORD out[3] = {};
+    VxImageDescEx rowDesc = ImageDescFactory::Create32BitARGB(3, 1, reinterpret_cast<XBYTE *>(const_cast<XDWORD *>(row)));
+    VxImageDescEx outDesc = ImageDescFactory::Create32BitARGB(3, 1, reinterpret_cast<XBYTE *>(out));
+    ASSERT_TRUE(VxConvertToNormalMap(rowDesc, outDesc, 0xFFFFFFFF));
+    EXPECT_EQ(0, memcmp(row, out, sizeof(out)));
+}
+
+TEST_F(BlitEngineNormalMapTest, ParallelBandsMatchSerial) {
+    const int width = 83;
+    const int height = 101;
+    const std::vector<XDWORD> pixels = MakePixels(width, height, 5);
+    for (int filter = VX_GRADIENTFILTER_DEFAULT; filter <= VX_GRADIENTFILTER_SCHARR; ++filter) {
+        const VX_GRADIENTFILTER f = static_cast<VX_GRADIENTFILTER>(filter);
+        for (int bump = 0; bump < 2; ++bump) {
+            ImageBuffer serial = MakeImage(pixels, width, height, width * 4);
+            ImageBuffer banded = MakeImage(pixels, width, height, width * 4);
+            VxImageDescEx serialDesc = ImageDescFactory::Create32BitARGB(width, height, serial.Data());
+            VxImageDescEx bandedDesc = ImageDescFactory::Create32BitARGB(width, height, banded.Data());
+
+            // In place, so a band that reads rows another band has already
+            // written would show up as a difference.
+            VxSetBlitParallelism(1, 64);
+            ASSERT_TRUE(bump ? VxConvertToBumpMap(serialDesc, f) : VxConvertToNormalMap(serialDesc, 0xFFFFFFFF, f));
+            VxSetBlitParallelism(4, 8);
+            ASSERT_TRUE(bump ? VxConvertToBumpMap(bandedDesc, f) : VxConvertToNormalMap(bandedDesc, 0xFFFFFFFF, f));
+            EXPECT_EQ(0, memcmp(serial.Data(), banded.Data(), serial.Size())) << "filter=" << filter
+                                                                              << " bump=" << bump;
+        }
+    }
+}
+
+TEST_F(BlitEngineNormalMapTest, RampKeepsItsSlope) {
+    // Red rises by 4 per column, so every operator sees dx = 4/255, dy = 0 away
+    // from the clamped edges.
+    const int width = 24;
+    const int height = 6;
+    std::vector<XDWORD> pixels(width * height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) pixels[y * width + x] = 0xFF000000u | static_cast<XDWORD>(x * 4) << 16;
+    }
+    const XDWORD expected = PackNormal(4.0f / 255.0f, 0.0f, 40.0f / 255.0f);
+
+    for (int filter = VX_GRADIENTFILTER_DEFAULT; filter <= VX_GRADIENTFILTER_SCHARR; ++filter) {
+        ImageBuffer image = MakeImage(pixels, width, height, width * 4);
+        VxImageDescEx desc = ImageDescFactory::Create32BitARGB(width, height, image.Data());
+        ASSERT_TRUE(VxConvertToNormalMap(desc, 0x00FF0000, static_cast<VX_GRADIENTFILTER>(filter)));
+        for (int y = 0; y < height; ++y) {
+            const XDWORD pixel = Pixel(image, width * 4, 10, y);
+            EXPECT_EQ(expected & 0x00FFFFFF, pixel & 0x00FFFFFF) << "filter=" << filter << " row " << y;
+        }
+    }
+}
+
+TEST_F(BlitEngineNormalMapTest, RejectsInvalidDescriptors) {
+    ImageBuffer a(8 * 4 * 4, 0x42);
+    ImageBuffer b(8 * 4 * 4, 0x42);
+    VxImageDescEx src = ImageDescFactory::Create32BitARGB(8, 4, a.Data());
+    VxImageDescEx dst = ImageDescFactory::Create32BitARGB(8, 4, b.Data());
+
+    VxImageDescEx smaller = ImageDescFactory::Create32BitARGB(8, 3, b.Data());
+    EXPECT_FALSE(VxConvertToNormalMap(src, smaller, 0xFFFFFFFF));
+    EXPECT_FALSE(VxConvertToBumpMap(src, smaller));
+
+    VxImageDescEx rgb24 = ImageDescFactory::Create24BitRGB(8, 4, b.Data());
+    EXPECT_FALSE(VxConvertToNormalMap(src, rgb24, 0xFFFFFFFF));
+    EXPECT_FALSE(VxConvertToBumpMap(src, rgb24));
+
+    VxImageDescEx noImage = dst;
+    noImage.Image = nullptr;
+    EXPECT_FALSE(VxConvertToNormalMap(src, noImage, 0xFFFFFFFF));
+    EXPECT_FALSE(VxConvertToBumpMap(noImage, dst));
+
+    const VX_GRADIENTFILTER badFilter = static_cast<VX_GRADIENTFILTER>(VX_GRADIENTFILTER_SCHARR + 1);
+    EXPECT_FALSE(VxConvertToNormalMap(src, dst, 0xFFFFFFFF, badFilter));
+    EXPECT_FALSE(VxConvertToBumpMap(src, badFilter));
+
+    VxImageDescEx narrow = ImageDescFactory::Create32BitARGB(1, 4, a.Data());
+    EXPECT_FALSE(VxConvertToBumpMap(narrow));
+
+    for (size_t i = 0; i < b.Size(); ++i) ASSERT_EQ(0x42, b[i]);
+    for (size_t i = 0; i < a.Size(); ++i) ASSERT_EQ(0x42, a[i]);
+}
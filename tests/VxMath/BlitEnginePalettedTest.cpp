@@ -7,6 +7,8 @@
  * - 32/24/16-bit to 8-bit paletted (via quantization)
  * - Palette color mapping accuracy
  * - Standard palette handling
+ * - 16-bit destinations follow the destination masks
+ * - Paletted -> paletted remaps into a different destination palette
  */
 
 #include "BlitEngineTestHelpers.h"
@@ -596,6 +598,36 @@ TEST_F(PalettedBlitTest, PalettedToPaletted_SameFormat_AllWidths) {
     }
 }
 
+TEST_F(PalettedBlitTest, PalettedToPaletted_DifferentPalette_RemapsToNearest) {
+    const int widths[] = {1, 15, 16, 17, 31, 32, 33, 100};
+    PaletteBuffer srcPalette;
+    PaletteBuffer dstPalette;
+
+    // Destination palette: the source palette reversed, with a few colors
+    // nudged so the nearest match is not exact.
+    for (int i = 0; i < 256; ++i) {
+        srcPalette.SetColor(i, 0xFF000000 | (i << 16) | ((i * 3 & 0xFF) << 8) | (255 - i));
+    }
+    for (int i = 0; i < 256; ++i) {
+        dstPalette.SetColor(255 - i, srcPalette.GetColor(i));
+    }
+    dstPalette.SetColor(255 - 40, srcPalette.GetColor(40) + 0x00020000);
+
+    for (int width : widths) {
+        ImageBuffer srcBuffer(width * 4);
+        ImageBuffer dstBuffer(width * 4);
+        FillWithIndices(srcBuffer.Data(), width, 4, static_cast<XBYTE>(width));
+
+        auto src = ImageDescFactory::Create8BitPaletted(width, 4, srcBuffer.Data(), srcPalette.Data());
+        auto dst = ImageDescFactory::Create8BitPaletted(width, 4, dstBuffer.Data(), dstPalette.Data());
+        blitter.DoBlit(src, dst);
+
+        for (int i = 0; i < width * 4; ++i) {
+            ASSERT_EQ(255 - srcBuffer[i], dstBuffer[i]) << "Pixel " << i << " (width=" << width << ")";
+        }
+    }
+}
+
 // Note: 4-bit paletted to 4-bit paletted copy is not supported by VxBlitEngine
 // (the generic blit path doesn't handle sub-byte bit widths correctly)
 // Use 4-bit to 32-bit conversion tests instead
@@ -815,6 +847,32 @@ TEST_F(PalettedBlitTest, Paletted8_to_4444_WithAlpha) {
     }
 }
 
+TEST_F(PalettedBlitTest, Paletted8_to_RGB555_UsesDestinationMasks) {
+    const int widths[] = {1, 8, 16, 17, 33};
+    PaletteBuffer palette;
+    for (int i = 0; i < 256; ++i) {
+        palette.SetColor(i, 0xFF000000 | (i << 16) | ((255 - i) << 8) | (i * 5 & 0xFF));
+    }
+
+    for (int width : widths) {
+        ImageBuffer srcBuffer(width * 4);
+        ImageBuffer dstBuffer(width * 4 * 2);
+        FillWithIndices(srcBuffer.Data(), width, 4, 7);
+
+        auto src = ImageDescFactory::Create8BitPaletted(width, 4, srcBuffer.Data(), palette.Data());
+        auto dst = ImageDescFactory::Create16Bit555(width, 4, dstBuffer.Data());
+        blitter.DoBlit(src, dst);
+
+        const XWORD *dstPixels = reinterpret_cast<const XWORD *>(dstBuffer.Data());
+        for (int i = 0; i < width * 4; ++i) {
+            const XDWORD c = palette.GetColor(srcBuffer[i]);
+            const XWORD expected = static_cast<XWORD>((((c >> 16) & 0xFF) >> 3) << 10 |
+                                                      (((c >> 8) & 0xFF) >> 3) << 5 | ((c & 0xFF) >> 3));
+            ASSERT_EQ(expected, dstPixels[i]) << "Pixel " << i << " (width=" << width << ")";
+        }
+    }
+}
+
 TEST_F(PalettedBlitTest, Paletted8_to_RGB24_AllWidths) {
     const int widths[] = {3, 8, 15, 16, 17};
     PaletteBuffer palette;
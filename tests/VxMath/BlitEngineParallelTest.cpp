@@ -0,0 +1,124 @@
+/**
+ * @file BlitEngineParallelTest.cpp
+ * @brief Tests for row-band parallel blitting (VxSetBlitParallelism).
+ *
+ * Tests:
+ * - Settings round-trip and clamping
+ * - Parallel DoBlit / DoBlitUpsideDown match the single-threaded result
+ * - Band boundaries with heights that do not divide evenly
+ * - Small blits below the band threshold
+ */
+
+#include "BlitEngineTestHelpers.h"
+
+using namespace BlitEngineTest;
+
+class BlitEngineParallelTest : public BlitEngineTestBase {
+protected:
+    void SetUp() override {
+        BlitEngineTestBase::SetUp();
+        VxGetBlitParallelism(m_SavedThreads, m_SavedMinRows);
+    }
+
+    void TearDown() override {
+        VxSetBlitParallelism(m_SavedThreads, m_SavedMinRows);
+        BlitEngineTestBase::TearDown();
+    }
+
+    // Runs the blit serially and with @p threads, and compares the outputs.
+    void ExpectParallelMatchesSerial(const VxImageDescEx &srcTemplate, const VxImageDescEx &dstTemplate,
+                                     int threads, int minRows, bool upsideDown) {
+        ImageBuffer src(ImageDescFactory::CalcBufferSize(srcTemplate));
+        ImageBuffer serial(ImageDescFactory::CalcBufferSize(dstTemplate));
+        ImageBuffer parallel(ImageDescFactory::CalcBufferSize(dstTemplate));
+        for (size_t i = 0; i < src.Size(); ++i) {
+            src[i] = static_cast<XBYTE>((i * 37 + 11) & 0xFF);
+        }
+
+        PaletteBuffer palette(4);
+        VxImageDescEx srcDesc = srcTemplate;
+        srcDesc.Image = src.Data();
+        if (srcDesc.ColorMapEntries > 0) {
+            PatternGenerator::CreateStandardPalette(palette.Data(), 4);
+            srcDesc.ColorMap = palette.Data();
+        }
+
+        VxImageDescEx serialDesc = dstTemplate;
+        serialDesc.Image = serial.Data();
+        VxImageDescEx parallelDesc = dstTemplate;
+        parallelDesc.Image = parallel.Data();
+
+        VxSetBlitParallelism(1, minRows);
+        if (upsideDown) {
+            VxDoBlitUpsideDown(srcDesc, serialDesc);
+        } else {
+            VxDoBlit(srcDesc, serialDesc);
+        }
+
+        VxSetBlitParallelism(threads, minRows);
+        if (upsideDown) {
+            VxDoBlitUpsideDown(srcDesc, parallelDesc);
+        } else {
+            VxDoBlit(srcDesc, parallelDesc);
+        }
+
+        EXPECT_EQ(0, memcmp(serial.Data(), parallel.Data(), serial.Size()))
+            << "threads=" << threads << " minRows=" << minRows << " upsideDown=" << upsideDown;
+    }
+
+private:
+    int m_SavedThreads = 1;
+    int m_SavedMinRows = 64;
+};
+
+TEST_F(BlitEngineParallelTest, SettingsRoundTripAndClamp) {
+    VxSetBlitParallelism(4, 16);
+    int threads = 0;
+    int minRows = 0;
+    VxGetBlitParallelism(threads, minRows);
+    EXPECT_EQ(4, threads);
+    EXPECT_EQ(16, minRows);
+
+    VxSetBlitParallelism(0, -5);
+    VxGetBlitParallelism(threads, minRows);
+    EXPECT_EQ(1, threads);
+    EXPECT_EQ(1, minRows);
+}
+
+TEST_F(BlitEngineParallelTest, FormatConversionMatchesSerial) {
+    const int w = 203;
+    const int h = 517;
+    ExpectParallelMatchesSerial(ImageDescFactory::Create32BitARGB(w, h), ImageDescFactory::Create16Bit565(w, h),
+                                4, 16, false);
+    ExpectParallelMatchesSerial(ImageDescFactory::Create32BitARGB(w, h), ImageDescFactory::Create24BitRGB(w, h),
+                                3, 32, false);
+    ExpectParallelMatchesSerial(ImageDescFactory::Create16Bit4444(w, h), ImageDescFactory::Create32BitARGB(w, h),
+                                8, 1, false);
+    ExpectParallelMatchesSerial(ImageDescFactory::Create24BitRGB(w, h), ImageDescFactory::Create16Bit1555(w, h),
+                                5, 7, false);
+}
+
+TEST_F(BlitEngineParallelTest, UpsideDownMatchesSerial) {
+    const int w = 97;
+    const int h = 301;
+    ExpectParallelMatchesSerial(ImageDescFactory::Create32BitARGB(w, h), ImageDescFactory::Create32BitABGR(w, h),
+                                4, 16, true);
+    ExpectParallelMatchesSerial(ImageDescFactory::Create16Bit565(w, h), ImageDescFactory::Create32BitARGB(w, h),
+                                6, 3, true);
+}
+
+TEST_F(BlitEngineParallelTest, PalettedMatchesSerial) {
+    const int w = 130;
+    const int h = 260;
+    ExpectParallelMatchesSerial(ImageDescFactory::Create8BitPaletted(w, h), ImageDescFactory::Create16Bit565(w, h),
+                                4, 8, false);
+    ExpectParallelMatchesSerial(ImageDescFactory::Create8BitPaletted(w, h), ImageDescFactory::Create32BitARGB(w, h),
+                                4, 8, true);
+}
+
+TEST_F(BlitEngineParallelTest, SmallBlitBelowThresholdMatchesSerial) {
+    ExpectParallelMatchesSerial(ImageDescFactory::Create32BitARGB(64, 10), ImageDescFactory::Create16Bit555(64, 10),
+                                8, 64, false);
+    ExpectParallelMatchesSerial(ImageDescFactory::Create32BitARGB(3, 1), ImageDescFactory::Create16Bit565(3, 1),
+                                8, 1, true);
+}
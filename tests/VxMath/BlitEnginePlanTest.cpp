@@ -0,0 +1,195 @@
+/**
+ * @file BlitEnginePlanTest.cpp
+ * @brief Tests for precompiled blit plans (VxCreateBlitPlan / VxExecuteBlitPlan).
+ *
+ * Tests:
+ * - Plans match VxDoBlit / VxDoBlitUpsideDown for converting, paletted, resizing
+ *   and quantizing pairs
+ * - One plan reused across many image buffers
+ * - Plans stay valid across SIMD mode changes
+ * - Rejected pairs and null arguments
+ */
+
+#include "BlitEngineTestHelpers.h"
+
+using namespace BlitEngineTest;
+
+class BlitEnginePlanTest : public BlitEngineTestBase {
+protected:
+    void SetUp() override {
+        BlitEngineTestBase::SetUp();
+        m_PreviousSIMDMode = VxGetSIMDOverride();
+    }
+
+    void TearDown() override {
+        VxSetSIMDOverride(m_PreviousSIMDMode);
+        BlitEngineTestBase::TearDown();
+    }
+
+    // Blits once through VxDoBlit and once through a plan, and compares.
+    void ExpectPlanMatchesDoBlit(const VxImageDescEx &srcTemplate, const VxImageDescEx &dstTemplate,
+                                 XBOOL upsideDown, int seed) {
+        ImageBuffer src(ImageDescFactory::CalcBufferSize(srcTemplate));
+        ImageBuffer expected(ImageDescFactory::CalcBufferSize(dstTemplate));
+        ImageBuffer actual(ImageDescFactory::CalcBufferSize(dstTemplate));
+        for (size_t i = 0; i < src.Size(); ++i) {
+            src[i] = static_cast<XBYTE>((i * 41 + seed * 13) & 0xFF);
+        }
+
+        PaletteBuffer srcPalette(4);
+        PaletteBuffer expectedPalette(4);
+        PaletteBuffer actualPalette(4);
+
+        VxImageDescEx srcDesc = srcTemplate;
+        srcDesc.Image = src.Data();
+        if (srcDesc.ColorMapEntries > 0) {
+            PatternGenerator::CreateStandardPalette(srcPalette.Data(), 4);
+            srcDesc.ColorMap = srcPalette.Data();
+        }
+        VxImageDescEx expectedDesc = dstTemplate;
+        expectedDesc.Image = expected.Data();
+        VxImageDescEx actualDesc = dstTemplate;
+        actualDesc.Image = nullptr;
+        if (dstTemplate.ColorMapEntries > 0) {
+            expectedDesc.ColorMap = expectedPalette.Data();
+            actualDesc.ColorMap = actualPalette.Data();
+        }
+
+        if (upsideDown) {
+            VxDoBlitUpsideDown(srcDesc, expectedDesc);
+        } else {
+            VxDoBlit(srcDesc, expectedDesc);
+        }
+
+        // The plan never sees the pixel pointers used at creation.
+        VxImageDescEx planSrcDesc = srcDesc;
+        planSrcDesc.Image = nullptr;
+        VxBlitPlan *plan = VxCreateBlitPlan(planSrcDesc, actualDesc, upsideDown);
+        ASSERT_NE(nullptr, plan);
+        VxExecuteBlitPlan(plan, src.Data(), actual.Data());
+        VxDeleteBlitPlan(plan);
+
+        EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), expected.Size()))
+            << "upsideDown=" << upsideDown << " seed=" << seed;
+        if (dstTemplate.ColorMapEntries > 0) {
+            EXPECT_EQ(0, memcmp(expectedPalette.Data(), actualPalette.Data(), 256 * 4));
+        }
+    }
+
+    int m_PreviousSIMDMode = VX_SIMD_MODE_AUTO;
+};
+
+TEST_F(BlitEnginePlanTest, FormatConversionMatchesDoBlit) {
+    const int w = 67;
+    const int h = 23;
+    for (int upsideDown = 0; upsideDown < 2; ++upsideDown) {
+        ExpectPlanMatchesDoBlit(ImageDescFactory::Create32BitARGB(w, h), ImageDescFactory::Create16Bit565(w, h),
+                                upsideDown, 1);
+        ExpectPlanMatchesDoBlit(ImageDescFactory::Create16Bit4444(w, h), ImageDescFactory::Create32BitARGB(w, h),
+                                upsideDown, 2);
+        ExpectPlanMatchesDoBlit(ImageDescFactory::Create24BitRGB(w, h), ImageDescFactory::Create16Bit1555(w, h),
+                                upsideDown, 3);
+        ExpectPlanMatchesDoBlit(ImageDescFactory::Create32BitARGB(w, h), ImageDescFactory::Create32BitABGR(w, h),
+                                upsideDown, 4);
+        ExpectPlanMatchesDoBlit(ImageDescFactory::Create32BitARGB(w, h), ImageDescFactory::Create32BitARGB(w, h),
+                                upsideDown, 5);
+    }
+}
+
+TEST_F(BlitEnginePlanTest, PalettedSourceMatchesDoBlit) {
+    ExpectPlanMatchesDoBlit(ImageDescFactory::Create8BitPaletted(45, 17), ImageDescFactory::Create16Bit565(45, 17),
+                            FALSE, 6);
+    ExpectPlanMatchesDoBlit(ImageDescFactory::Create8BitPaletted(45, 17), ImageDescFactory::Create32BitARGB(45, 17),
+                            TRUE, 7);
+}
+
+TEST_F(BlitEnginePlanTest, ResizeMatchesDoBlit) {
+    ExpectPlanMatchesDoBlit(ImageDescFactory::Create32BitARGB(64, 48), ImageDescFactory::Create32BitARGB(37, 91),
+                            FALSE, 8);
+    ExpectPlanMatchesDoBlit(ImageDescFactory::Create32BitARGB(30, 30), ImageDescFactory::Create16Bit565(60, 15),
+                            FALSE, 9);
+}
+
+TEST_F(BlitEnginePlanTest, QuantizeMatchesDoBlit) {
+    ExpectPlanMatchesDoBlit(ImageDescFactory::Create32BitARGB(32, 32), ImageDescFactory::Create8BitPaletted(32, 32),
+                            FALSE, 10);
+    ExpectPlanMatchesDoBlit(ImageDescFactory::Create24BitRGB(16, 24), ImageDescFactory::Create8BitPaletted(16, 24),
+                            TRUE, 11);
+}
+
+TEST_F(BlitEnginePlanTest, PlanIsReusableAcrossBuffers) {
+    const int w = 19;
+    const int h = 7;
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(w, h);
+    VxImageDescEx dstDesc = ImageDescFactory::Create16Bit555(w, h);
+    VxBlitPlan *plan = VxCreateBlitPlan(srcDesc, dstDesc);
+    ASSERT_NE(nullptr, plan);
+
+    ImageBuffer src(ImageDescFactory::CalcBufferSize(srcDesc));
+    ImageBuffer expected(ImageDescFactory::CalcBufferSize(dstDesc));
+    ImageBuffer actual(ImageDescFactory::CalcBufferSize(dstDesc));
+    for (int round = 0; round < 8; ++round) {
+        for (size_t i = 0; i < src.Size(); ++i) {
+            src[i] = static_cast<XBYTE>((i * 7 + round * 31) & 0xFF);
+        }
+        srcDesc.Image = src.Data();
+        dstDesc.Image = expected.Data();
+        VxDoBlit(srcDesc, dstDesc);
+
+        actual.Clear();
+        VxExecuteBlitPlan(plan, src.Data(), actual.Data());
+        EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), expected.Size())) << "round " << round;
+    }
+
+    VxDeleteBlitPlan(plan);
+}
+
+TEST_F(BlitEnginePlanTest, PlanSurvivesSIMDModeChanges) {
+    const int w = 131;
+    const int h = 9;
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(w, h);
+    VxImageDescEx dstDesc = ImageDescFactory::Create16Bit565(w, h);
+
+    ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_NONE));
+    VxBlitPlan *plan = VxCreateBlitPlan(srcDesc, dstDesc);
+    ASSERT_NE(nullptr, plan);
+
+    ImageBuffer src(ImageDescFactory::CalcBufferSize(srcDesc));
+    ImageBuffer expected(ImageDescFactory::CalcBufferSize(dstDesc));
+    ImageBuffer actual(ImageDescFactory::CalcBufferSize(dstDesc));
+    for (size_t i = 0; i < src.Size(); ++i) {
+        src[i] = static_cast<XBYTE>((i * 97 + 3) & 0xFF);
+    }
+    srcDesc.Image = src.Data();
+    dstDesc.Image = expected.Data();
+
+    const int modes[] = {VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_NONE, VX_SIMD_MODE_AUTO};
+    for (int mode : modes) {
+        ASSERT_TRUE(VxSetSIMDOverride(mode));
+        VxDoBlit(srcDesc, dstDesc);
+
+        actual.Clear();
+        VxExecuteBlitPlan(plan, src.Data(), actual.Data());
+        EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), expected.Size())) << "mode " << mode;
+    }
+
+    VxDeleteBlitPlan(plan);
+}
+
+TEST_F(BlitEnginePlanTest, RejectedPairsAndNullArguments) {
+    // Non-32-bit sources cannot be resized, and flipped blits cannot resize.
+    EXPECT_EQ(nullptr, VxCreateBlitPlan(ImageDescFactory::Create16Bit565(8, 8), ImageDescFactory::Create16Bit565(4, 4)));
+    EXPECT_EQ(nullptr,
+              VxCreateBlitPlan(ImageDescFactory::Create32BitARGB(8, 8), ImageDescFactory::Create32BitARGB(4, 4), TRUE));
+    EXPECT_EQ(nullptr, VxCreateBlitPlan(ImageDescFactory::Create32BitARGB(0, 8), ImageDescFactory::Create32BitARGB(0, 8)));
+
+    VxBlitPlan *plan =
+        VxCreateBlitPlan(ImageDescFactory::Create32BitARGB(4, 4), ImageDescFactory::Create16Bit565(4, 4));
+    ASSERT_NE(nullptr, plan);
+    ImageBuffer buffer(64);
+    VxExecuteBlitPlan(plan, nullptr, buffer.Data());
+    VxExecuteBlitPlan(plan, buffer.Data(), nullptr);
+    VxExecuteBlitPlan(nullptr, buffer.Data(), buffer.Data());
+    VxDeleteBlitPlan(plan);
+    VxDeleteBlitPlan(nullptr);
+}
@@ -7,6 +7,7 @@
  * - Palette generation quality
  * - Color mapping accuracy
  * - Various input formats
+ * - Median-cut palettes, PSNR bounds and parallel remapping
  *
  * Note: NeuQuant is a neural network based quantizer that works best with
  * images containing many colors. For images with few unique colors, the
@@ -533,3 +534,149 @@ TEST_F(QuantizeTest, Deterministic_SameResult) {
     EXPECT_EQ(0, memcmp(dstBuffer1.Data(), dstBuffer2.Data(), width * height));
     EXPECT_EQ(0, memcmp(dst1.ColorMap, dst2.ColorMap, 256 * sizeof(XDWORD)));
 }
+
+//==============================================================================
+// Median-Cut and Remapping Tests
+//==============================================================================
+
+namespace {
+
+// Smooth gradients plus light noise, like a photographic texture.
+void FillPhotoLike32(XBYTE *pixels, int width, int height) {
+    XDWORD state = 777;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            state = state * 1664525u + 1013904223u;
+            const int noise = static_cast<int>(state >> 29) - 4;
+            XBYTE *p = pixels + (y * width + x) * 4;
+            p[0] = static_cast<XBYTE>((std::max)(0, (std::min)(255, (x + y) * 255 / (width + height) + noise)));
+            p[1] = static_cast<XBYTE>((std::max)(0, (std::min)(255, y * 255 / height + noise)));
+            p[2] = static_cast<XBYTE>((std::max)(0, (std::min)(255, x * 255 / width + noise)));
+            p[3] = 0xFF;
+        }
+    }
+}
+
+double PalettedPSNR(const XBYTE *src, const XBYTE *indices, const PaletteBuffer &palette, int count) {
+    double squaredError = 0.0;
+    for (int i = 0; i < count; ++i) {
+        const XDWORD color = palette.GetColor(indices[i]);
+        for (int c = 0; c < 3; ++c) {
+            const double d = static_cast<double>(src[i * 4 + c]) - static_cast<double>((color >> (c * 8)) & 0xFF);
+            squaredError += d * d;
+        }
+    }
+    return 10.0 * std::log10(255.0 * 255.0 * 3.0 * count / (squaredError + 1e-9));
+}
+
+} // namespace
+
+TEST_F(QuantizeTest, MedianCut_SolidColorIsExact) {
+    const int width = 20, height = 12;
+    ImageBuffer srcBuffer(width * height * 4);
+    ImageBuffer dstBuffer(width * height);
+    PaletteBuffer palette;
+
+    auto src = ImageDescFactory::Create32BitARGB(width, height, srcBuffer.Data());
+    auto dst = ImageDescFactory::Create8BitPaletted(width, height, dstBuffer.Data(), palette.Data());
+    PatternGenerator::FillSolid32(srcBuffer.Data(), width, height, 0x81, 0x42, 0xC3, 0xFF);
+
+    EXPECT_TRUE(TheBlitter.QuantizeImageMedianCut(src, dst));
+    for (int i = 0; i < width * height; ++i) {
+        ASSERT_EQ(0u, dstBuffer[i]);
+    }
+    EXPECT_EQ(0x008142C3u, palette.GetColor(0) & 0x00FFFFFF);
+}
+
+TEST_F(QuantizeTest, MedianCut_FewColorsAreReproducedExactly) {
+    const int width = 64, height = 16;
+    ImageBuffer srcBuffer(width * height * 4);
+    ImageBuffer dstBuffer(width * height);
+    PaletteBuffer palette;
+
+    // 64 well separated colors, each filling one column.
+    XDWORD *pixels = reinterpret_cast<XDWORD *>(srcBuffer.Data());
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            pixels[y * width + x] = 0xFF000000 | ((x & 3) * 80 << 16) | (((x >> 2) & 3) * 80 << 8) | ((x >> 4) * 80);
+        }
+    }
+    auto src = ImageDescFactory::Create32BitARGB(width, height, srcBuffer.Data());
+    auto dst = ImageDescFactory::Create8BitPaletted(width, height, dstBuffer.Data(), palette.Data());
+
+    EXPECT_TRUE(TheBlitter.QuantizeImageMedianCut(src, dst));
+    for (int i = 0; i < width * height; ++i) {
+        ASSERT_EQ(pixels[i] & 0x00FFFFFF, palette.GetColor(dstBuffer[i]) & 0x00FFFFFF) << "pixel " << i;
+    }
+}
+
+TEST_F(QuantizeTest, MedianCut_PhotoLikeImageQuality) {
+    const int width = 256, height = 256;
+    ImageBuffer srcBuffer(width * height * 4);
+    ImageBuffer dstBuffer(width * height);
+    PaletteBuffer palette;
+    FillPhotoLike32(srcBuffer.Data(), width, height);
+
+    auto src = ImageDescFactory::Create32BitARGB(width, height, srcBuffer.Data());
+    auto dst = ImageDescFactory::Create8BitPaletted(width, height, dstBuffer.Data(), palette.Data());
+    EXPECT_TRUE(TheBlitter.QuantizeImageMedianCut(src, dst));
+    EXPECT_GT(PalettedPSNR(srcBuffer.Data(), dstBuffer.Data(), palette, width * height), 34.0);
+
+    // Every pixel maps to a palette entry about as close as the true nearest.
+    const XDWORD *pixels = reinterpret_cast<const XDWORD *>(srcBuffer.Data());
+    const XDWORD *entries = reinterpret_cast<const XDWORD *>(palette.Data());
+    for (int i = 0; i < width * height; i += 7) {
+        const XBYTE nearest = FindNearestPaletteIndex(pixels[i], entries, 256);
+        ASSERT_LE(ColorDistance(pixels[i], entries[dstBuffer[i]]), ColorDistance(pixels[i], entries[nearest]) + 8.0)
+            << "pixel " << i;
+    }
+}
+
+TEST_F(QuantizeTest, NeuQuant_PhotoLikeImageQuality) {
+    const int width = 256, height = 256;
+    ImageBuffer srcBuffer(width * height * 4);
+    ImageBuffer dstBuffer(width * height);
+    PaletteBuffer palette;
+    FillPhotoLike32(srcBuffer.Data(), width, height);
+
+    auto src = ImageDescFactory::Create32BitARGB(width, height, srcBuffer.Data());
+    auto dst = ImageDescFactory::Create8BitPaletted(width, height, dstBuffer.Data(), palette.Data());
+    EXPECT_TRUE(blitter.QuantizeImage(src, dst));
+    // Per-pixel inxsearch mapping reached 31.3 dB here.
+    EXPECT_GT(PalettedPSNR(srcBuffer.Data(), dstBuffer.Data(), palette, width * height), 30.8);
+}
+
+TEST_F(QuantizeTest, ParallelRemapMatchesSerial) {
+    const int width = 200, height = 300;
+    ImageBuffer srcBuffer(width * height * 4);
+    ImageBuffer serial(width * height);
+    ImageBuffer parallel(width * height);
+    PaletteBuffer serialPalette;
+    PaletteBuffer parallelPalette;
+    FillPhotoLike32(srcBuffer.Data(), width, height);
+
+    auto src = ImageDescFactory::Create32BitARGB(width, height, srcBuffer.Data());
+    auto serialDst = ImageDescFactory::Create8BitPaletted(width, height, serial.Data(), serialPalette.Data());
+    auto parallelDst = ImageDescFactory::Create8BitPaletted(width, height, parallel.Data(), parallelPalette.Data());
+
+    int previousThreads = 1;
+    int previousMinRows = 64;
+    VxGetBlitParallelism(previousThreads, previousMinRows);
+    for (int method = 0; method < 2; ++method) {
+        VxSetBlitParallelism(1, 64);
+        if (method == 0) {
+            blitter.QuantizeImage(src, serialDst);
+        } else {
+            TheBlitter.QuantizeImageMedianCut(src, serialDst);
+        }
+        VxSetBlitParallelism(4, 8);
+        if (method == 0) {
+            blitter.QuantizeImage(src, parallelDst);
+        } else {
+            TheBlitter.QuantizeImageMedianCut(src, parallelDst);
+        }
+        EXPECT_EQ(0, memcmp(serial.Data(), parallel.Data(), width * height)) << "method " << method;
+        EXPECT_EQ(0, memcmp(serialPalette.Data(), parallelPalette.Data(), 256 * sizeof(XDWORD)));
+    }
+    VxSetBlitParallelism(previousThreads, previousMinRows);
+}
@@ -0,0 +1,235 @@
+/**
+ * @file BlitEngineRectTest.cpp
+ * @brief Tests for sub-rectangle blits, fills, alpha and blend operations.
+ *
+ * Tests:
+ * - Same-size rectangles copy and convert pixel by pixel, clipped against both images
+ * - Upside-down rectangles drop the matching rows when clipped
+ * - Scaled rectangles match a resize blit of the region and are never clipped
+ * - Fill and alpha rectangles are clipped to the image
+ * - Blend source rectangles compose with the destination offset
+ * - Empty rectangles and unaligned DXT rectangles are rejected
+ */
+
+#include "BlitEngineTestHelpers.h"
+
+using namespace BlitEngineTest;
+
+class BlitEngineRectTest : public BlitEngineTestBase {
+protected:
+    static XDWORD PixelAt(int x, int y) { return 0xFF000000 | (x << 16) | (y << 8) | ((x * 7 + y * 13) & 0xFF); }
+
+    static void FillCoordinates(ImageBuffer &buffer, int width, int height) {
+        XDWORD *pixels = reinterpret_cast<XDWORD *>(buffer.Data());
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) pixels[y * width + x] = PixelAt(x, y);
+        }
+    }
+
+    static CKRECT Rect(int left, int top, int right, int bottom) {
+        CKRECT r = {left, top, right, bottom};
+        return r;
+    }
+};
+
+TEST_F(BlitEngineRectTest, CopiesAndClipsSameSizeRects) {
+    const int srcW = 20, srcH = 16, dstW = 12, dstH = 10;
+    ImageBuffer src(srcW * srcH * 4);
+    ImageBuffer dst(dstW * dstH * 4);
+    FillCoordinates(src, srcW, srcH);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(srcW, srcH, src.Data());
+    VxImageDescEx dstDesc = ImageDescFactory::Create32BitARGB(dstW, dstH, dst.Data());
+    const XDWORD *out = reinterpret_cast<const XDWORD *>(dst.Data());
+
+    struct Case {
+        CKRECT s;
+        CKRECT d;
+    };
+    const Case cases[] = {
+        {Rect(3, 2, 9, 7), Rect(1, 1, 7, 6)},       // Inside both
+        {Rect(-2, -3, 5, 4), Rect(0, 0, 7, 7)},     // Source overhangs top-left
+        {Rect(10, 8, 20, 16), Rect(6, 5, 16, 13)},  // Destination overhangs bottom-right
+        {Rect(15, 12, 25, 20), Rect(-4, -2, 6, 6)}, // Both overhang
+    };
+    for (const Case &c : cases) {
+        dst.Clear();
+        ASSERT_TRUE(VxDoBlit(srcDesc, dstDesc, &c.s, &c.d));
+        for (int y = 0; y < dstH; ++y) {
+            for (int x = 0; x < dstW; ++x) {
+                const int sx = x - c.d.left + c.s.left;
+                const int sy = y - c.d.top + c.s.top;
+                const bool inside = x >= c.d.left && x < c.d.right && y >= c.d.top && y < c.d.bottom &&
+                                    sx >= 0 && sx < srcW && sy >= 0 && sy < srcH;
+                ASSERT_EQ(inside ? PixelAt(sx, sy) : 0u, out[y * dstW + x])
+                    << "case src " << c.s.left << "," << c.s.top << " at " << x << "," << y;
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineRectTest, ConvertsFormatsInsideRect) {
+    const int width = 16, height = 8;
+    ImageBuffer src(width * height * 4);
+    FillCoordinates(src, width, height);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, height, src.Data());
+
+    // A converted rectangle equals the same rectangle of a whole-image conversion.
+    ImageBuffer whole(width * height * 2);
+    ImageBuffer part(width * height * 2, 0xCD);
+    VxImageDescEx wholeDesc = ImageDescFactory::Create16Bit565(width, height, whole.Data());
+    VxImageDescEx partDesc = ImageDescFactory::Create16Bit565(width, height, part.Data());
+    VxDoBlit(srcDesc, wholeDesc);
+    const CKRECT r = Rect(3, 2, 14, 7);
+    ASSERT_TRUE(VxDoBlit(srcDesc, partDesc, &r, &r));
+
+    const XWORD *w = reinterpret_cast<const XWORD *>(whole.Data());
+    const XWORD *p = reinterpret_cast<const XWORD *>(part.Data());
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const bool inside = x >= r.left && x < r.right && y >= r.top && y < r.bottom;
+            ASSERT_EQ(inside ? w[y * width + x] : 0xCDCD, p[y * width + x]) << x << "," << y;
+        }
+    }
+}
+
+TEST_F(BlitEngineRectTest, UpsideDownDropsMatchingRows) {
+    const int width = 8, height = 12;
+    ImageBuffer src(width * height * 4);
+    ImageBuffer dst(width * height * 4);
+    FillCoordinates(src, width, height);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, height, src.Data());
+    VxImageDescEx dstDesc = ImageDescFactory::Create32BitARGB(width, height, dst.Data());
+    const XDWORD *out = reinterpret_cast<const XDWORD *>(dst.Data());
+
+    // Source rows 2..9 into destination rows -3..4: the rows that would land
+    // above the image are the bottom source rows 7..9.
+    const CKRECT s = Rect(1, 2, 6, 10);
+    const CKRECT d = Rect(2, -3, 7, 5);
+    ASSERT_TRUE(VxDoBlitUpsideDown(srcDesc, dstDesc, &s, &d));
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const bool inside = x >= d.left && x < d.right && y >= 0 && y < d.bottom;
+            const int sx = x - d.left + s.left;
+            const int sy = s.bottom - 1 - (y - d.top);
+            ASSERT_EQ(inside ? PixelAt(sx, sy) : 0u, out[y * width + x]) << x << "," << y;
+        }
+    }
+
+    EXPECT_FALSE(VxDoBlitUpsideDown(srcDesc, dstDesc, &s, nullptr)); // Sizes differ
+}
+
+TEST_F(BlitEngineRectTest, ScaledRectMatchesResizedRegion) {
+    const int srcW = 32, srcH = 24, dstW = 40, dstH = 30;
+    ImageBuffer src(srcW * srcH * 4);
+    FillCoordinates(src, srcW, srcH);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(srcW, srcH, src.Data());
+
+    const CKRECT s = Rect(4, 2, 20, 14);
+    const CKRECT d = Rect(5, 3, 37, 27);
+
+    // Reference: resize blit between hand-made views of the two regions.
+    ImageBuffer expected(dstW * dstH * 4);
+    VxImageDescEx srcView = srcDesc;
+    srcView.Width = s.right - s.left;
+    srcView.Height = s.bottom - s.top;
+    srcView.Image = src.Data() + s.top * srcDesc.BytesPerLine + s.left * 4;
+    VxImageDescEx dstView = ImageDescFactory::Create32BitARGB(d.right - d.left, d.bottom - d.top);
+    dstView.BytesPerLine = dstW * 4;
+    dstView.Image = expected.Data() + d.top * dstView.BytesPerLine + d.left * 4;
+    VxDoBlit(srcView, dstView);
+
+    ImageBuffer actual(dstW * dstH * 4);
+    VxImageDescEx dstDesc = ImageDescFactory::Create32BitARGB(dstW, dstH, actual.Data());
+    ASSERT_TRUE(VxDoBlit(srcDesc, dstDesc, &s, &d));
+    EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), expected.Size()));
+
+    // Scaled rectangles outside their image are rejected rather than clipped.
+    const CKRECT outside = Rect(-1, 0, 16, 12);
+    actual.Clear();
+    EXPECT_FALSE(VxDoBlit(srcDesc, dstDesc, &outside, &d));
+    for (size_t i = 0; i < actual.Size(); ++i) ASSERT_EQ(0, actual[i]);
+}
+
+TEST_F(BlitEngineRectTest, FillAndAlphaClipToImage) {
+    const int width = 10, height = 6;
+    ImageBuffer image(width * height * 4);
+    VxImageDescEx desc = ImageDescFactory::Create32BitARGB(width, height, image.Data());
+    const XDWORD *pixels = reinterpret_cast<const XDWORD *>(image.Data());
+
+    const CKRECT fill = Rect(6, -2, 14, 3);
+    ASSERT_TRUE(VxFillImage(desc, 0x00123456, &fill));
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const bool inside = x >= 6 && y < 3;
+            ASSERT_EQ(inside ? 0x00123456u : 0u, pixels[y * width + x]) << x << "," << y;
+        }
+    }
+
+    const CKRECT constant = Rect(-3, 4, 2, 8);
+    ASSERT_TRUE(VxDoAlphaBlit(desc, static_cast<XBYTE>(0x80), &constant));
+    EXPECT_EQ(0x80000000u, pixels[4 * width + 0]);
+    EXPECT_EQ(0x80000000u, pixels[5 * width + 1]);
+    EXPECT_EQ(0u, pixels[5 * width + 2]);
+    EXPECT_EQ(0u, pixels[3 * width + 0]);
+
+    // Alpha values are laid out for the whole rectangle, clipped rows and
+    // columns included.
+    const CKRECT array = Rect(8, 4, 12, 7);
+    XBYTE alphas[3 * 4];
+    for (int i = 0; i < 12; ++i) alphas[i] = static_cast<XBYTE>(0x10 * (i + 1));
+    ASSERT_TRUE(VxDoAlphaBlit(desc, alphas, &array));
+    EXPECT_EQ(static_cast<XDWORD>(alphas[0]) << 24, pixels[4 * width + 8]);
+    EXPECT_EQ(static_cast<XDWORD>(alphas[1]) << 24, pixels[4 * width + 9]);
+    EXPECT_EQ(static_cast<XDWORD>(alphas[5]) << 24, pixels[5 * width + 9]);
+}
+
+TEST_F(BlitEngineRectTest, BlendSourceRect) {
+    const int srcW = 8, srcH = 8, dstW = 6, dstH = 6;
+    ImageBuffer src(srcW * srcH * 4);
+    ImageBuffer dst(dstW * dstH * 4);
+    FillCoordinates(src, srcW, srcH);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(srcW, srcH, src.Data());
+    VxImageDescEx dstDesc = ImageDescFactory::Create32BitARGB(dstW, dstH, dst.Data());
+    const XDWORD *out = reinterpret_cast<const XDWORD *>(dst.Data());
+
+    // Opaque SrcOver is a copy: rectangle (2,3)-(7,9) clipped to the source,
+    // placed at (-1, 1) and clipped to the destination.
+    const CKRECT s = Rect(2, 3, 7, 9);
+    ASSERT_TRUE(VxBlendImage(srcDesc, dstDesc, VX_BLEND_SRCOVER, &s, -1, 1));
+    for (int y = 0; y < dstH; ++y) {
+        for (int x = 0; x < dstW; ++x) {
+            const int sx = x + 1 + s.left;
+            const int sy = y - 1 + s.top;
+            const bool inside = sx < s.right && y >= 1 && sy < srcH;
+            ASSERT_EQ(inside ? PixelAt(sx, sy) : 0u, out[y * dstW + x]) << x << "," << y;
+        }
+    }
+}
+
+TEST_F(BlitEngineRectTest, RejectsInvalidRects) {
+    const int size = 8;
+    ImageBuffer src(size * size * 4);
+    ImageBuffer dst(size * size * 4);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(size, size, src.Data());
+    VxImageDescEx dstDesc = ImageDescFactory::Create32BitARGB(size, size, dst.Data());
+
+    const CKRECT empty = Rect(3, 3, 3, 5);
+    const CKRECT inverted = Rect(5, 5, 2, 2);
+    const CKRECT away = Rect(20, 20, 24, 24);
+    EXPECT_FALSE(VxDoBlit(srcDesc, dstDesc, &empty, &empty));
+    EXPECT_FALSE(VxFillImage(dstDesc, 0, &inverted));
+    EXPECT_TRUE(VxFillImage(dstDesc, 0, &away)); // Valid, nothing left after clipping
+
+    // DXT images only take whole-image rectangles.
+    ImageBuffer blocks(size * size / 2);
+    VxImageDescEx dxtDesc;
+    VxPixelFormat2ImageDesc(_DXT1, dxtDesc);
+    dxtDesc.Width = size;
+    dxtDesc.Height = size;
+    dxtDesc.TotalImageSize = static_cast<int>(blocks.Size());
+    dxtDesc.Image = blocks.Data();
+    const CKRECT part = Rect(0, 0, 4, 4);
+    const CKRECT whole = Rect(0, 0, size, size);
+    EXPECT_FALSE(VxDoBlit(dxtDesc, dstDesc, &part, &part));
+    EXPECT_TRUE(VxDoBlit(dxtDesc, dstDesc, &whole, nullptr));
+}
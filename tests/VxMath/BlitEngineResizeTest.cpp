@@ -8,6 +8,9 @@
  * - Same-size resize (identity)
  * - Non-power-of-2 dimensions
  * - Quality assessment
+ * - Separable filters (box, triangle, Mitchell, Lanczos3)
+ * - 16-bit and mixed-format resize through row converters
+ * - DXT resize through ARGB temporaries
  */
 
 #include "BlitEngineTestHelpers.h"
@@ -84,7 +87,7 @@ TEST_F(ResizeTest, SameSize_1x1) {
     EXPECT_EQ(0xFF123456, *dst);
 }
 
-TEST_F(ResizeTest, Resize16Bit565_UsesNearestNeighborMapping) {
+TEST_F(ResizeTest, Resize16Bit565_IntegerRatioSamplesSourceGrid) {
     const int srcW = 4, srcH = 4;
     const int dstW = 2, dstH = 2;
     ImageBuffer srcBuffer(srcW * srcH * 2);
@@ -102,6 +105,7 @@ TEST_F(ResizeTest, Resize16Bit565_UsesNearestNeighborMapping) {
     auto dstDesc = ImageDescFactory::Create16Bit565(dstW, dstH, dstBuffer.Data());
     blitter.ResizeImage(srcDesc, dstDesc);
 
+    // A 2:1 shrink lands exactly on source pixels, and 565 survives the ARGB round trip.
     const XWORD *dst = reinterpret_cast<const XWORD *>(dstBuffer.Data());
     EXPECT_EQ(src[0], dst[0]);   // (0,0) <- (0,0)
     EXPECT_EQ(src[2], dst[1]);   // (1,0) <- (2,0)
@@ -468,3 +472,259 @@ TEST_F(ResizeTest, Alpha_PreservedDuringDownscale) {
         EXPECT_NEAR(64, alpha, 5) << "Alpha should be preserved at pixel " << i;
     }
 }
+
+//==============================================================================
+// Separable Filters
+//==============================================================================
+
+static const VX_RESIZEFILTER kSeparableFilters[] = {VX_RESIZEFILTER_BOX, VX_RESIZEFILTER_TRIANGLE,
+                                                    VX_RESIZEFILTER_MITCHELL, VX_RESIZEFILTER_LANCZOS3};
+
+TEST_F(ResizeTest, Filtered_SolidColorIsExact) {
+    const int sizes[][4] = {{16, 16, 40, 23}, {64, 48, 7, 5}, {33, 1, 1, 9}};
+    for (VX_RESIZEFILTER filter : kSeparableFilters) {
+        for (const int *size : sizes) {
+            auto pair = CreateResizePair(size[0], size[1], size[2], size[3]);
+            PatternGenerator::FillSolid32(pair.srcBuffer.Data(), size[0], size[1], 201, 7, 99, 130);
+            blitter.ResizeImage(pair.srcDesc, pair.dstDesc, filter);
+
+            const XDWORD *dst = reinterpret_cast<const XDWORD *>(pair.dstBuffer.Data());
+            for (int i = 0; i < size[2] * size[3]; ++i) {
+                ASSERT_EQ(0x82C90763u, dst[i]) << "filter " << filter << " pixel " << i;
+            }
+        }
+    }
+}
+
+TEST_F(ResizeTest, Filtered_BoxHalvingAveragesQuads) {
+    const int srcSize = 16;
+    const int dstSize = 8;
+    auto pair = CreateResizePair(srcSize, srcSize, dstSize, dstSize);
+    PatternGenerator::FillUniquePixels32(pair.srcBuffer.Data(), srcSize, srcSize);
+    blitter.ResizeImage(pair.srcDesc, pair.dstDesc, VX_RESIZEFILTER_BOX);
+
+    const XDWORD *src = reinterpret_cast<const XDWORD *>(pair.srcBuffer.Data());
+    const XDWORD *dst = reinterpret_cast<const XDWORD *>(pair.dstBuffer.Data());
+    for (int y = 0; y < dstSize; ++y) {
+        for (int x = 0; x < dstSize; ++x) {
+            XDWORD expected = 0;
+            for (int shift = 0; shift < 32; shift += 8) {
+                int sum = 2;
+                for (int k = 0; k < 4; ++k) {
+                    sum += (src[(y * 2 + k / 2) * srcSize + x * 2 + k % 2] >> shift) & 0xFF;
+                }
+                expected |= static_cast<XDWORD>(sum / 4) << shift;
+            }
+            EXPECT_EQ(expected, dst[y * dstSize + x]) << "x=" << x << " y=" << y;
+        }
+    }
+}
+
+TEST_F(ResizeTest, Filtered_ShrinkingFineDetailDoesNotAlias) {
+    // One-pixel checkerboard: bilinear picks single texels, the separable
+    // filters average them to mid-gray.
+    const int srcSize = 64;
+    const int dstSize = 15;
+    auto pair = CreateResizePair(srcSize, srcSize, dstSize, dstSize);
+    PatternGenerator::FillCheckerboard32(pair.srcBuffer.Data(), srcSize, srcSize, 1);
+
+    for (VX_RESIZEFILTER filter : kSeparableFilters) {
+        blitter.ResizeImage(pair.srcDesc, pair.dstDesc, filter);
+        const XDWORD *dst = reinterpret_cast<const XDWORD *>(pair.dstBuffer.Data());
+        for (int i = 0; i < dstSize * dstSize; ++i) {
+            EXPECT_NEAR(128, static_cast<int>(dst[i] & 0xFF), 16) << "filter " << filter << " pixel " << i;
+        }
+    }
+}
+
+TEST_F(ResizeTest, Filtered_AllBackendsMatch) {
+    const int sizes[][4] = {{37, 29, 101, 61}, {128, 96, 31, 17}, {20, 20, 20, 20}, {9, 64, 3, 200}};
+    const int modes[] = {VX_SIMD_MODE_SSE2, VX_SIMD_MODE_SSSE3, VX_SIMD_MODE_AVX2};
+    const int previousMode = VxGetSIMDOverride();
+
+    for (VX_RESIZEFILTER filter : kSeparableFilters) {
+        for (const int *size : sizes) {
+            auto pair = CreateResizePair(size[0], size[1], size[2], size[3]);
+            for (size_t i = 0; i < pair.srcBuffer.Size(); ++i) {
+                pair.srcBuffer[i] = static_cast<XBYTE>((i * 113 + (i >> 7) * 7) & 0xFF);
+            }
+
+            ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_NONE));
+            blitter.ResizeImage(pair.srcDesc, pair.dstDesc, filter);
+            ImageBuffer expected(pair.dstBuffer.Size());
+            memcpy(expected.Data(), pair.dstBuffer.Data(), expected.Size());
+
+            for (int mode : modes) {
+                ASSERT_TRUE(VxSetSIMDOverride(mode));
+                pair.dstBuffer.Fill(0);
+                blitter.ResizeImage(pair.srcDesc, pair.dstDesc, filter);
+                EXPECT_EQ(0, memcmp(expected.Data(), pair.dstBuffer.Data(), expected.Size()))
+                    << "filter " << filter << " " << size[0] << "x" << size[1] << "->" << size[2] << "x"
+                    << size[3] << " backend " << VxGetSIMDBackendName(VxGetSIMDEffectiveBackend());
+            }
+        }
+    }
+    VxSetSIMDOverride(previousMode);
+}
+
+TEST_F(ResizeTest, Filtered_BilinearMatchesDefaultAndOtherFormatsConvert) {
+    auto pair = CreateResizePair(24, 24, 10, 13);
+    PatternGenerator::FillColorBars32(pair.srcBuffer.Data(), 24, 24);
+    blitter.ResizeImage(pair.srcDesc, pair.dstDesc);
+    ImageBuffer expected(pair.dstBuffer.Size());
+    memcpy(expected.Data(), pair.dstBuffer.Data(), expected.Size());
+    pair.dstBuffer.Fill(0);
+    blitter.ResizeImage(pair.srcDesc, pair.dstDesc, VX_RESIZEFILTER_BILINEAR);
+    EXPECT_EQ(0, memcmp(expected.Data(), pair.dstBuffer.Data(), expected.Size()));
+
+    // 565 -> 565 goes through ARGB; a solid color survives unchanged.
+    ImageBuffer src565(24 * 24 * 2);
+    ImageBuffer dst565(10 * 13 * 2);
+    for (size_t i = 0; i < src565.Size(); i += 2) {
+        src565[i] = 0x34;
+        src565[i + 1] = 0xA2;
+    }
+    blitter.ResizeImage(ImageDescFactory::Create16Bit565(24, 24, src565.Data()),
+                        ImageDescFactory::Create16Bit565(10, 13, dst565.Data()), VX_RESIZEFILTER_LANCZOS3);
+    for (size_t i = 0; i < dst565.Size(); i += 2) {
+        ASSERT_EQ(0x34, dst565[i]) << "pixel " << i / 2;
+        ASSERT_EQ(0xA2, dst565[i + 1]) << "pixel " << i / 2;
+    }
+}
+
+//==============================================================================
+// 16-bit and Mixed Formats
+//==============================================================================
+
+namespace {
+
+struct FormatPairCase {
+    const char *name;
+    VxImageDescEx (*src)(int, int, XBYTE *);
+    VxImageDescEx (*dst)(int, int, XBYTE *);
+};
+
+const FormatPairCase kFormatPairs[] = {
+    {"565->565", ImageDescFactory::Create16Bit565, ImageDescFactory::Create16Bit565},
+    {"4444->4444", ImageDescFactory::Create16Bit4444, ImageDescFactory::Create16Bit4444},
+    {"1555->555", ImageDescFactory::Create16Bit1555, ImageDescFactory::Create16Bit555},
+    {"BGR565->565", ImageDescFactory::Create16BitBGR565, ImageDescFactory::Create16Bit565},
+    {"565->ARGB", ImageDescFactory::Create16Bit565, ImageDescFactory::Create32BitARGB},
+    {"ARGB->4444", ImageDescFactory::Create32BitARGB, ImageDescFactory::Create16Bit4444},
+    {"RGB24->1555", ImageDescFactory::Create24BitRGB, ImageDescFactory::Create16Bit1555},
+    {"ABGR->565", ImageDescFactory::Create32BitABGR, ImageDescFactory::Create16Bit565},
+};
+
+} // namespace
+
+class ResizeFormatTest : public ResizeTest {
+protected:
+    // Resizes through the engine and through explicit whole-image ARGB
+    // conversions, and compares the two destinations byte for byte.
+    void ExpectMatchesArgbRoundTrip(const FormatPairCase &pair, int srcW, int srcH, int dstW, int dstH,
+                                    int filter) {
+        const VxImageDescEx srcTemplate = pair.src(srcW, srcH, nullptr);
+        const VxImageDescEx dstTemplate = pair.dst(dstW, dstH, nullptr);
+        ImageBuffer src(ImageDescFactory::CalcBufferSize(srcTemplate));
+        ImageBuffer actual(ImageDescFactory::CalcBufferSize(dstTemplate));
+        ImageBuffer expected(ImageDescFactory::CalcBufferSize(dstTemplate));
+        for (size_t i = 0; i < src.Size(); ++i) {
+            src[i] = static_cast<XBYTE>((i * 37 + (i / 97) * 11) & 0xFF);
+        }
+        const VxImageDescEx srcDesc = pair.src(srcW, srcH, src.Data());
+
+        ImageBuffer srcArgb(srcW * srcH * 4);
+        ImageBuffer dstArgb(dstW * dstH * 4);
+        const VxImageDescEx srcArgbDesc = ImageDescFactory::Create32BitARGB(srcW, srcH, srcArgb.Data());
+        const VxImageDescEx dstArgbDesc = ImageDescFactory::Create32BitARGB(dstW, dstH, dstArgb.Data());
+        VxDoBlit(srcDesc, srcArgbDesc);
+        VxResizeImage32(srcArgbDesc, dstArgbDesc, static_cast<VX_RESIZEFILTER>(filter));
+        VxDoBlit(dstArgbDesc, pair.dst(dstW, dstH, expected.Data()));
+
+        VxResizeImage32(srcDesc, pair.dst(dstW, dstH, actual.Data()), static_cast<VX_RESIZEFILTER>(filter));
+        EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), expected.Size()))
+            << pair.name << " " << srcW << "x" << srcH << "->" << dstW << "x" << dstH << " filter " << filter
+            << " backend " << VxGetSIMDBackendName(VxGetSIMDEffectiveBackend());
+    }
+};
+
+TEST_F(ResizeFormatTest, BilinearMatchesArgbRoundTrip) {
+    const int sizes[][4] = {{64, 48, 23, 17}, {19, 13, 70, 41}, {32, 32, 32, 32}, {40, 9, 40, 30}};
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2};
+    const int previousMode = VxGetSIMDOverride();
+
+    for (int mode : modes) {
+        ASSERT_TRUE(VxSetSIMDOverride(mode));
+        for (const FormatPairCase &pair : kFormatPairs) {
+            for (const int *size : sizes) {
+                ExpectMatchesArgbRoundTrip(pair, size[0], size[1], size[2], size[3], VX_RESIZEFILTER_BILINEAR);
+            }
+        }
+    }
+    VxSetSIMDOverride(previousMode);
+}
+
+TEST_F(ResizeFormatTest, WideImagesSpanSeveralStrips) {
+    // Strips cover about 512 source columns, so these widths take several strips.
+    ExpectMatchesArgbRoundTrip(kFormatPairs[0], 1700, 6, 613, 5, VX_RESIZEFILTER_BILINEAR);
+    ExpectMatchesArgbRoundTrip(kFormatPairs[1], 900, 4, 2311, 9, VX_RESIZEFILTER_BILINEAR);
+    ExpectMatchesArgbRoundTrip(kFormatPairs[5], 1300, 3, 1299, 7, VX_RESIZEFILTER_BILINEAR);
+}
+
+TEST_F(ResizeFormatTest, FilteredMatchesArgbRoundTrip) {
+    for (const FormatPairCase &pair : kFormatPairs) {
+        ExpectMatchesArgbRoundTrip(pair, 45, 31, 17, 50, VX_RESIZEFILTER_MITCHELL);
+        ExpectMatchesArgbRoundTrip(pair, 16, 16, 8, 8, VX_RESIZEFILTER_BOX);
+    }
+}
+
+TEST_F(ResizeFormatTest, SameFormat16BitIsFiltered) {
+    // A hard 565 edge between black and white gains intermediate values when
+    // enlarged (nearest-neighbor would only repeat the two source colors).
+    const int srcW = 4, dstW = 16;
+    ImageBuffer src(srcW * 2);
+    ImageBuffer dst(dstW * 2);
+    XWORD *srcPixels = reinterpret_cast<XWORD *>(src.Data());
+    srcPixels[0] = srcPixels[1] = 0x0000;
+    srcPixels[2] = srcPixels[3] = 0xFFFF;
+    blitter.ResizeImage(ImageDescFactory::Create16Bit565(srcW, 1, src.Data()),
+                        ImageDescFactory::Create16Bit565(dstW, 1, dst.Data()));
+
+    const XWORD *dstPixels = reinterpret_cast<const XWORD *>(dst.Data());
+    int intermediate = 0;
+    for (int x = 0; x < dstW; ++x) {
+        if (dstPixels[x] != 0x0000 && dstPixels[x] != 0xFFFF) ++intermediate;
+        if (x > 0) {
+            EXPECT_GE(dstPixels[x] >> 11, dstPixels[x - 1] >> 11) << "x=" << x;
+        }
+    }
+    EXPECT_GT(intermediate, 0);
+}
+
+TEST_F(ResizeFormatTest, DXTIsDecodedBeforeFiltering) {
+    // DXT5 is 8 bpp, so it must not take the same-format 8-bit nearest path
+    // over compressed bytes: both sides go through ARGB temporaries.
+    const int srcW = 16, srcH = 16, dstW = 8, dstH = 8;
+    ImageBuffer argb(srcW * srcH * 4);
+    PatternGenerator::FillColorBars32(argb.Data(), srcW, srcH);
+    const VxImageDescEx argbDesc = ImageDescFactory::Create32BitARGB(srcW, srcH, argb.Data());
+
+    VxImageDescEx srcDesc;
+    VxPixelFormat2ImageDesc(_DXT5, srcDesc);
+    srcDesc.Width = srcW;
+    srcDesc.Height = srcH;
+    srcDesc.TotalImageSize = (srcW / 4) * (srcH / 4) * 16;
+    ImageBuffer src(srcDesc.TotalImageSize);
+    srcDesc.Image = src.Data();
+    VxDoBlit(argbDesc, srcDesc);
+
+    ImageBuffer decoded(srcW * srcH * 4);
+    ImageBuffer expected(dstW * dstH * 4);
+    ImageBuffer actual(dstW * dstH * 4);
+    const VxImageDescEx decodedDesc = ImageDescFactory::Create32BitARGB(srcW, srcH, decoded.Data());
+    VxDoBlit(srcDesc, decodedDesc);
+    blitter.ResizeImage(decodedDesc, ImageDescFactory::Create32BitARGB(dstW, dstH, expected.Data()));
+
+    blitter.ResizeImage(srcDesc, ImageDescFactory::Create32BitARGB(dstW, dstH, actual.Data()));
+    EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), expected.Size()));
+}
@@ -819,4 +819,192 @@ TEST_F(BlitEngineSIMDBackendDiffTest, Blit_Paletted8_To_32ARGB_OddWidthMisaligne
     }
 }
 
+TEST_F(BlitEngineSIMDBackendDiffTest, Blit_Paletted8_AllDestinations_BackendsMatchScalar) {
+    ScopedSIMDOverride restore;
+    const int width = 1919;
+    const int height = 3;
+
+    std::vector<XBYTE> srcStorage(static_cast<std::size_t>(width) * height + 16u);
+    std::vector<XBYTE> palette(256u * 4u);
+    std::vector<XBYTE> dstPalette(256u * 4u);
+    XBYTE *srcImage = srcStorage.data() + 5;
+    uint32_t seed = 0x5EED1234u;
+    for (std::size_t i = 0; i < palette.size(); ++i) {
+        palette[i] = (XBYTE)(NextRand(seed) >> 24);
+        dstPalette[i] = (XBYTE)(NextRand(seed) >> 24);
+    }
+    for (int i = 0; i < width * height; ++i) {
+        srcImage[i] = (XBYTE)(NextRand(seed) >> 24);
+    }
+    VxImageDescEx srcDesc = ImageDescFactory::Create8BitPaletted(width, height, srcImage, palette.data());
+
+    const VxImageDescEx targets[] = {
+        ImageDescFactory::Create16Bit565(width, height),
+        ImageDescFactory::Create16Bit555(width, height),
+        ImageDescFactory::Create16Bit1555(width, height),
+        ImageDescFactory::Create16Bit4444(width, height),
+        ImageDescFactory::Create24BitRGB(width, height),
+        ImageDescFactory::Create32BitARGB(width, height),
+        ImageDescFactory::Create8BitPaletted(width, height, nullptr, dstPalette.data()),
+    };
+    const int modes[] = {VX_SIMD_MODE_SSE2, VX_SIMD_MODE_SSSE3, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_AVX512,
+                         VX_SIMD_MODE_NEON, VX_SIMD_MODE_WASM_SIMD128};
+
+    for (const VxImageDescEx &target : targets) {
+        const std::size_t size = static_cast<std::size_t>(target.BytesPerLine) * height;
+        std::vector<XBYTE> expected(size + 16u, 0xCDu);
+        std::vector<XBYTE> actual(size + 16u, 0xCDu);
+
+        VxImageDescEx dstDesc = target;
+        dstDesc.Image = expected.data() + 3;
+        ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_NONE));
+        blitter.DoBlit(srcDesc, dstDesc);
+
+        for (int mode : modes) {
+            if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) continue;
+            std::fill(actual.begin(), actual.end(), 0xCDu);
+            dstDesc.Image = actual.data() + 3;
+            blitter.DoBlit(srcDesc, dstDesc);
+            EXPECT_EQ(0, std::memcmp(expected.data(), actual.data(), actual.size()))
+                << "bpp=" << target.BitsPerPixel << " alphaMask=" << std::hex << target.AlphaMask << std::dec
+                << " mode=" << mode;
+        }
+    }
+}
+
+TEST_F(BlitEngineSIMDBackendDiffTest, UnpremultiplyAlpha_AllAlphaChannelPairs_MatchesReference) {
+    // One row per alpha value, one column per channel value.
+    const int width = 256;
+    const int height = 256;
+    const int pitch = width * 4;
+
+    std::vector<XBYTE> storage(static_cast<std::size_t>(pitch) * height + 16u);
+    XBYTE *image = storage.data() + 3;
+    for (int a = 0; a < height; ++a) {
+        for (int c = 0; c < width; ++c) {
+            const XDWORD r = static_cast<XDWORD>(c);
+            const XDWORD g = static_cast<XDWORD>(255 - c);
+            const XDWORD b = static_cast<XDWORD>(c ^ 0x5A);
+            StorePixel32(image + a * pitch + c * 4, (static_cast<XDWORD>(a) << 24) | (r << 16) | (g << 8) | b);
+        }
+    }
+
+    std::vector<XBYTE> original(image, image + static_cast<std::size_t>(pitch) * height);
+    VxImageDescEx desc = ImageDescFactory::Create32BitARGB(width, height, image);
+
+    blitter.UnpremultiplyAlpha(desc);
+
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const XDWORD src = LoadPixel32(original.data() + y * pitch + x * 4);
+            const XDWORD a = (src >> 24) & 0xFFu;
+            XDWORD expected = 0;
+            if (a != 0) {
+                const XDWORD r = XMin(255u, ((src >> 16) & 0xFFu) * 255u / a);
+                const XDWORD g = XMin(255u, ((src >> 8) & 0xFFu) * 255u / a);
+                const XDWORD b = XMin(255u, (src & 0xFFu) * 255u / a);
+                expected = (a << 24) | (r << 16) | (g << 8) | b;
+            }
+            ASSERT_EQ(expected, LoadPixel32(image + y * pitch + x * 4)) << "a=" << y << " c=" << x;
+        }
+    }
+}
+
+TEST_F(BlitEngineSIMDBackendDiffTest, PremultiplyUnpremultiply_AllAlphaChannelPairs_RoundTrip) {
+    // Straight colors in every (alpha, value) pair go through both passes.
+    const int width = 256;
+    const int height = 256;
+    const int pitch = width * 4;
+
+    std::vector<XBYTE> storage(static_cast<std::size_t>(pitch) * height + 16u);
+    XBYTE *image = storage.data() + 1;
+    for (int a = 0; a < height; ++a) {
+        for (int c = 0; c < width; ++c) {
+            const XDWORD v = static_cast<XDWORD>(c);
+            StorePixel32(image + a * pitch + c * 4,
+                         (static_cast<XDWORD>(a) << 24) | (v << 16) | ((v ^ 0xFFu) << 8) | (v ^ 0x5Au));
+        }
+    }
+
+    std::vector<XBYTE> original(image, image + static_cast<std::size_t>(pitch) * height);
+    VxImageDescEx desc = ImageDescFactory::Create32BitARGB(width, height, image);
+
+    blitter.PremultiplyAlpha(desc);
+    blitter.UnpremultiplyAlpha(desc);
+
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const XDWORD src = LoadPixel32(original.data() + y * pitch + x * 4);
+            const XDWORD a = (src >> 24) & 0xFFu;
+            XDWORD expected = a << 24;
+            for (int shift = 0; shift < 24; shift += 8) {
+                const XDWORD premultiplied = ((src >> shift) & 0xFFu) * a / 255u;
+                expected |= (a ? premultiplied * 255u / a : 0u) << shift;
+            }
+            ASSERT_EQ(expected, LoadPixel32(image + y * pitch + x * 4)) << "a=" << y << " c=" << x;
+        }
+    }
+}
+
+TEST_F(BlitEngineSIMDBackendDiffTest, Blit_SpecificPairs_ShortRows_BackendsMatchScalar) {
+    ScopedSIMDOverride restore;
+    const int maxWidth = 70;
+
+    VxImageDescEx bgra = ImageDescFactory::Create32BitARGB(maxWidth, 1);
+    bgra.RedMask = 0x0000FF00u;
+    bgra.GreenMask = 0x00FF0000u;
+    bgra.BlueMask = 0xFF000000u;
+    bgra.AlphaMask = 0x000000FFu;
+    const VxImageDescEx formats[] = {
+        ImageDescFactory::Create32BitRGB(maxWidth, 1),
+        ImageDescFactory::Create24BitRGB(maxWidth, 1),
+        ImageDescFactory::Create16Bit565(maxWidth, 1),
+        ImageDescFactory::Create16Bit555(maxWidth, 1),
+        ImageDescFactory::Create16Bit1555(maxWidth, 1),
+        ImageDescFactory::Create16Bit4444(maxWidth, 1),
+        ImageDescFactory::Create32BitABGR(maxWidth, 1),
+        ImageDescFactory::Create32BitRGBA(maxWidth, 1),
+        bgra,
+    };
+    const int modes[] = {VX_SIMD_MODE_SSE2, VX_SIMD_MODE_SSSE3, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_AVX512,
+                         VX_SIMD_MODE_NEON, VX_SIMD_MODE_WASM_SIMD128};
+
+    std::vector<XBYTE> source(maxWidth * 4 + 16u);
+    uint32_t seed = 0x0DDC0FFEu;
+    for (XBYTE &b : source) b = (XBYTE)(NextRand(seed) >> 24);
+    std::vector<XBYTE> expected(maxWidth * 4 + 16u);
+    std::vector<XBYTE> actual(maxWidth * 4 + 16u);
+
+    for (const VxImageDescEx &format : formats) {
+        for (int direction = 0; direction < 2; ++direction) {
+            for (int width = 1; width <= maxWidth; ++width) {
+                VxImageDescEx argb = ImageDescFactory::Create32BitARGB(width, 1, source.data() + 1);
+                VxImageDescEx other = format;
+                other.Width = width;
+                other.BytesPerLine = width * format.BitsPerPixel / 8;
+                other.Image = source.data() + 1;
+                VxImageDescEx src = direction == 0 ? argb : other;
+                VxImageDescEx dst = direction == 0 ? other : argb;
+                const std::size_t size = static_cast<std::size_t>(dst.BytesPerLine) + 8u;
+
+                std::fill(expected.begin(), expected.end(), 0xCDu);
+                dst.Image = expected.data() + 3;
+                ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_NONE));
+                blitter.DoBlit(src, dst);
+
+                for (int mode : modes) {
+                    if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) continue;
+                    std::fill(actual.begin(), actual.end(), 0xCDu);
+                    dst.Image = actual.data() + 3;
+                    blitter.DoBlit(src, dst);
+                    ASSERT_EQ(0, std::memcmp(expected.data(), actual.data(), size))
+                        << "bpp=" << format.BitsPerPixel << std::hex << " masks " << format.RedMask << "/"
+                        << format.AlphaMask << std::dec << " direction=" << direction << " width=" << width
+                        << " mode=" << mode;
+                }
+            }
+        }
+    }
+}
+
 } // namespace
@@ -10,6 +10,9 @@ struct BackendCaps {
     bool sse4_1;
     bool avx;
     bool avx2;
+    bool avx512;
+    bool neon;
+    bool wasmSimd128;
 };
 
 int ProbeEffectiveMode(int requestedMode) {
@@ -24,16 +27,22 @@ BackendCaps ProbeCaps() {
     caps.sse4_1 = (ProbeEffectiveMode(VX_SIMD_MODE_SSE4_1) == VX_SIMD_MODE_SSE4_1);
     caps.avx = (ProbeEffectiveMode(VX_SIMD_MODE_AVX) == VX_SIMD_MODE_AVX);
     caps.avx2 = (ProbeEffectiveMode(VX_SIMD_MODE_AVX2) == VX_SIMD_MODE_AVX2);
+    caps.avx512 = (ProbeEffectiveMode(VX_SIMD_MODE_AVX512) == VX_SIMD_MODE_AVX512);
+    caps.neon = (ProbeEffectiveMode(VX_SIMD_MODE_NEON) == VX_SIMD_MODE_NEON);
+    caps.wasmSimd128 = (ProbeEffectiveMode(VX_SIMD_MODE_WASM_SIMD128) == VX_SIMD_MODE_WASM_SIMD128);
     return caps;
 }
 
 int ResolveExpectedMode(int requestedMode, const BackendCaps &caps) {
     if (requestedMode == VX_SIMD_MODE_AUTO) {
+        if (caps.avx512) return VX_SIMD_MODE_AVX512;
         if (caps.avx2) return VX_SIMD_MODE_AVX2;
         if (caps.avx) return VX_SIMD_MODE_AVX;
         if (caps.sse4_1) return VX_SIMD_MODE_SSE4_1;
         if (caps.ssse3) return VX_SIMD_MODE_SSSE3;
         if (caps.sse2) return VX_SIMD_MODE_SSE2;
+        if (caps.neon) return VX_SIMD_MODE_NEON;
+        if (caps.wasmSimd128) return VX_SIMD_MODE_WASM_SIMD128;
         return VX_SIMD_MODE_NONE;
     }
 
@@ -75,6 +84,24 @@ int ResolveExpectedMode(int requestedMode, const BackendCaps &caps) {
         return VX_SIMD_MODE_NONE;
     }
 
+    if (requestedMode == VX_SIMD_MODE_AVX512) {
+        if (caps.avx512) return VX_SIMD_MODE_AVX512;
+        if (caps.avx2) return VX_SIMD_MODE_AVX2;
+        if (caps.avx) return VX_SIMD_MODE_AVX;
+        if (caps.sse4_1) return VX_SIMD_MODE_SSE4_1;
+        if (caps.ssse3) return VX_SIMD_MODE_SSSE3;
+        if (caps.sse2) return VX_SIMD_MODE_SSE2;
+        return VX_SIMD_MODE_NONE;
+    }
+
+    if (requestedMode == VX_SIMD_MODE_NEON) {
+        return caps.neon ? VX_SIMD_MODE_NEON : VX_SIMD_MODE_NONE;
+    }
+
+    if (requestedMode == VX_SIMD_MODE_WASM_SIMD128) {
+        return caps.wasmSimd128 ? VX_SIMD_MODE_WASM_SIMD128 : VX_SIMD_MODE_NONE;
+    }
+
     return VX_SIMD_MODE_NONE;
 }
 
@@ -142,6 +169,31 @@ TEST_F(BlitEngineSIMDOverrideTest, SetAVX2FallsBackByLadder) {
     EXPECT_EQ(ExpectedFor(VX_SIMD_MODE_AVX2), VxGetSIMDEffectiveBackend());
 }
 
+TEST_F(BlitEngineSIMDOverrideTest, SetAVX512FallsBackByLadder) {
+    ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_AVX512));
+    EXPECT_EQ(VX_SIMD_MODE_AVX512, VxGetSIMDOverride());
+    EXPECT_EQ(ExpectedFor(VX_SIMD_MODE_AVX512), VxGetSIMDEffectiveBackend());
+}
+
+TEST_F(BlitEngineSIMDOverrideTest, SetNEONFallsBackToNone) {
+    ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_NEON));
+    EXPECT_EQ(VX_SIMD_MODE_NEON, VxGetSIMDOverride());
+    EXPECT_EQ(ExpectedFor(VX_SIMD_MODE_NEON), VxGetSIMDEffectiveBackend());
+}
+
+TEST_F(BlitEngineSIMDOverrideTest, SetWASMSIMD128FallsBackToNone) {
+    ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_WASM_SIMD128));
+    EXPECT_EQ(VX_SIMD_MODE_WASM_SIMD128, VxGetSIMDOverride());
+    EXPECT_EQ(ExpectedFor(VX_SIMD_MODE_WASM_SIMD128), VxGetSIMDEffectiveBackend());
+}
+
+TEST_F(BlitEngineSIMDOverrideTest, PortableAndX86TiersAreExclusive) {
+    const bool portable = ProbeEffectiveMode(VX_SIMD_MODE_NEON) == VX_SIMD_MODE_NEON ||
+                          ProbeEffectiveMode(VX_SIMD_MODE_WASM_SIMD128) == VX_SIMD_MODE_WASM_SIMD128;
+    const bool x86 = ProbeEffectiveMode(VX_SIMD_MODE_SSE2) == VX_SIMD_MODE_SSE2;
+    EXPECT_FALSE(portable && x86);
+}
+
 TEST_F(BlitEngineSIMDOverrideTest, InvalidModeIsRejectedWithoutStateChange) {
     ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_SSE2));
     const int beforeRequested = VxGetSIMDOverride();
@@ -160,5 +212,8 @@ TEST(BlitEngineSIMDOverrideNameTest, ReturnsExpectedNames) {
     EXPECT_STREQ("sse4_1", VxGetSIMDBackendName(VX_SIMD_MODE_SSE4_1));
     EXPECT_STREQ("avx", VxGetSIMDBackendName(VX_SIMD_MODE_AVX));
     EXPECT_STREQ("avx2", VxGetSIMDBackendName(VX_SIMD_MODE_AVX2));
+    EXPECT_STREQ("avx512", VxGetSIMDBackendName(VX_SIMD_MODE_AVX512));
+    EXPECT_STREQ("neon", VxGetSIMDBackendName(VX_SIMD_MODE_NEON));
+    EXPECT_STREQ("wasm_simd128", VxGetSIMDBackendName(VX_SIMD_MODE_WASM_SIMD128));
     EXPECT_STREQ("unknown", VxGetSIMDBackendName(-1));
 }
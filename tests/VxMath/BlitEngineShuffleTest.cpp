@@ -0,0 +1,168 @@
+/**
+ * @file BlitEngineShuffleTest.cpp
+ * @brief Tests for the byte-shuffle fallback used by byte-aligned channel layouts.
+ *
+ * Tests:
+ * - Pairs without a specific kernel (bump maps, custom masks) match a
+ *   per-channel reference at every width, on the scalar, SSSE3 and NEON/SIMD128 tiers
+ * - Absent source channels, alpha included, come out as zero like the generic path
+ * - Layouts that are not byte-aligned keep going through the generic path
+ * - Blit plans keep the shuffle control when the SIMD mode changes
+ */
+
+#include "BlitEngineTestHelpers.h"
+
+using namespace BlitEngineTest;
+
+class BlitEngineShuffleTest : public BlitEngineTestBase {
+protected:
+    void SetUp() override {
+        BlitEngineTestBase::SetUp();
+        m_PreviousSIMDMode = VxGetSIMDOverride();
+    }
+
+    void TearDown() override {
+        VxSetSIMDOverride(m_PreviousSIMDMode);
+        BlitEngineTestBase::TearDown();
+    }
+
+    struct Layout {
+        int bpp;
+        XDWORD r, g, b, a;
+    };
+
+    static VxImageDescEx MakeDesc(const Layout &layout, int width, XBYTE *image) {
+        VxImageDescEx desc;
+        desc.Width = width;
+        desc.Height = 1;
+        desc.BitsPerPixel = layout.bpp;
+        desc.BytesPerLine = width * layout.bpp / 8;
+        desc.RedMask = layout.r;
+        desc.GreenMask = layout.g;
+        desc.BlueMask = layout.b;
+        desc.AlphaMask = layout.a;
+        desc.Image = image;
+        return desc;
+    }
+
+    // Standard formats may have a dedicated kernel with its own conventions.
+    static bool IsStandard(const Layout &layout) {
+        const VX_PIXELFORMAT format = VxImageDesc2PixelFormat(MakeDesc(layout, 1, nullptr));
+        return format > UNKNOWN_PF && format < _DXT1;
+    }
+
+    static int Shift(XDWORD mask) {
+        int shift = 0;
+        while (mask && !(mask & 1)) {
+            mask >>= 1;
+            ++shift;
+        }
+        return shift;
+    }
+
+    // Channels present on both sides move as whole bytes; everything else is zero.
+    static XDWORD Reference(const Layout &src, const Layout &dst, XDWORD pixel) {
+        const XDWORD srcMasks[4] = {src.r, src.g, src.b, src.a};
+        const XDWORD dstMasks[4] = {dst.r, dst.g, dst.b, dst.a};
+        XDWORD out = 0;
+        for (int c = 0; c < 4; ++c) {
+            if (!srcMasks[c] || !dstMasks[c]) continue;
+            out |= ((pixel & srcMasks[c]) >> Shift(srcMasks[c])) << Shift(dstMasks[c]);
+        }
+        return out;
+    }
+
+    static XDWORD ReadBytes(const XBYTE *p, int bytes) {
+        XDWORD v = 0;
+        for (int i = 0; i < bytes; ++i) v |= static_cast<XDWORD>(p[i]) << (i * 8);
+        return v;
+    }
+
+    int m_PreviousSIMDMode = VX_SIMD_MODE_AUTO;
+};
+
+TEST_F(BlitEngineShuffleTest, ByteAlignedLayoutsMatchReference) {
+    const Layout layouts[] = {
+        {16, 0x00FF, 0xFF00, 0, 0},                             // V8U8
+        {32, 0x000000FF, 0x0000FF00, 0x00FF0000, 0},            // X8L8V8U8
+        {24, 0x000000FF, 0x0000FF00, 0x00FF0000, 0},            // BGR 888
+        {24, 0x00FF0000, 0x0000FF00, 0x000000FF, 0},            // RGB 888
+        {32, 0x0000FF00, 0x00FF0000, 0xFF000000, 0},            // BGR 888 (32)
+        {32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000},   // ARGB 8888
+        {32, 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF},   // RGBA 8888
+        {16, 0xFF00, 0, 0, 0x00FF},                             // custom A8R8
+        {8, 0xFF, 0, 0, 0},                                     // R8
+        {8, 0, 0, 0, 0xFF},                                     // A8
+    };
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSSE3, VX_SIMD_MODE_NEON, VX_SIMD_MODE_WASM_SIMD128};
+    const int maxWidth = 53;
+
+    ImageBuffer src(maxWidth * 4);
+    ImageBuffer dst(maxWidth * 4 + 16);
+    for (size_t i = 0; i < src.Size(); ++i) src[i] = static_cast<XBYTE>(i * 37 + 11);
+
+    for (int mode : modes) {
+        if (!VxSetSIMDOverride(mode) || VxGetSIMDEffectiveBackend() != mode) continue;
+        for (const Layout &from : layouts) {
+            for (const Layout &to : layouts) {
+                if (IsStandard(from) && IsStandard(to)) continue;
+                const int sb = from.bpp / 8;
+                const int db = to.bpp / 8;
+                for (int width = 1; width <= maxWidth; width += (width < 20 ? 1 : 11)) {
+                    dst.Fill(0xCD);
+                    VxDoBlit(MakeDesc(from, width, src.Data()), MakeDesc(to, width, dst.Data()));
+                    for (int x = 0; x < width; ++x) {
+                        const XDWORD expected = Reference(from, to, ReadBytes(src.Data() + x * sb, sb));
+                        ASSERT_EQ(expected, ReadBytes(dst.Data() + x * db, db))
+                            << "mode=" << mode << " bpp " << from.bpp << "->" << to.bpp << std::hex << " masks "
+                            << from.r << "/" << from.g << "/" << from.b << "/" << from.a << " -> " << to.r << "/"
+                            << to.g << "/" << to.b << "/" << to.a << std::dec << " width=" << width << " x=" << x;
+                    }
+                    // Nothing is written past the row.
+                    ASSERT_EQ(0xCD, dst[width * db]) << "width=" << width;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineShuffleTest, NonByteAlignedLayoutsUseGenericPath) {
+    // 24-bit source to a 16-bit 6:5:5 layout with no specific kernel.
+    const Layout from = {24, 0x00FF0000, 0x0000FF00, 0x000000FF, 0};
+    const Layout to = {16, 0xFC00, 0x03E0, 0x001F, 0};
+    const XBYTE pixel[3] = {0xFF, 0x80, 0x40}; // B, G, R
+
+    XBYTE out[2] = {0, 0};
+    VxDoBlit(MakeDesc(from, 1, const_cast<XBYTE *>(pixel)), MakeDesc(to, 1, out));
+    const XWORD value = static_cast<XWORD>(out[0] | (out[1] << 8));
+    EXPECT_EQ(0x40u >> 2, (value >> 10) & 0x3Fu);
+    EXPECT_EQ(0x80u >> 3, (value >> 5) & 0x1Fu);
+    EXPECT_EQ(0xFFu >> 3, value & 0x1Fu);
+}
+
+TEST_F(BlitEngineShuffleTest, PlansCarryTheShuffleAcrossModes) {
+    // The shuffle control is derived with the kernel and cached in the plan.
+    const Layout from = {16, 0xFF00, 0, 0, 0x00FF};                           // custom A8R8
+    const Layout to = {32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000}; // ARGB 8888
+    ASSERT_FALSE(IsStandard(from));
+    const int width = 45;
+    ImageBuffer src(width * 2);
+    ImageBuffer dst(width * 4);
+    for (size_t i = 0; i < src.Size(); ++i) src[i] = static_cast<XBYTE>(i * 53 + 7);
+
+    ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_NONE));
+    VxBlitPlan *plan = VxCreateBlitPlan(MakeDesc(from, width, nullptr), MakeDesc(to, width, nullptr));
+    ASSERT_NE(nullptr, plan);
+
+    const int modes[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSSE3, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_AUTO};
+    for (int mode : modes) {
+        if (!VxSetSIMDOverride(mode)) continue;
+        dst.Fill(0xCD);
+        VxExecuteBlitPlan(plan, src.Data(), dst.Data());
+        for (int x = 0; x < width; ++x) {
+            ASSERT_EQ(Reference(from, to, ReadBytes(src.Data() + x * 2, 2)), ReadBytes(dst.Data() + x * 4, 4))
+                << "mode=" << mode << " x=" << x;
+        }
+    }
+    VxDeleteBlitPlan(plan);
+}
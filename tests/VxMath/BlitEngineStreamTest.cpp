@@ -0,0 +1,232 @@
+/**
+ * @file BlitEngineStreamTest.cpp
+ * @brief Tests for streaming blits (VxStreamBlit).
+ *
+ * Tests:
+ * - Same-size and resizing streams match VxDoBlit for any band height
+ * - Source rows are requested once each, in increasing order
+ * - Resident source images and resident destinations mix with callbacks
+ * - Parallel bands match the serial stream
+ * - A callback returning FALSE aborts; unsupported pairs are rejected
+ */
+
+#include "BlitEngineTestHelpers.h"
+
+#include <vector>
+
+using namespace BlitEngineTest;
+
+namespace {
+
+// In-memory stand-in for a file: serves source rows and collects destination rows.
+struct StreamContext {
+    const XBYTE *source = nullptr;
+    int sourcePitch = 0;
+    XBYTE *destination = nullptr;
+    int destinationPitch = 0;
+    std::vector<int> rowsRead;
+    int abortAfterReads = -1;
+    int maxRowsPerWrite = 0;
+};
+
+XBOOL ReadRows(void *userData, int firstRow, int rowCount, XBYTE *rows, int pitch) {
+    StreamContext &ctx = *static_cast<StreamContext *>(userData);
+    if (ctx.abortAfterReads >= 0 && static_cast<int>(ctx.rowsRead.size()) >= ctx.abortAfterReads) return FALSE;
+    for (int r = 0; r < rowCount; ++r) {
+        memcpy(rows + r * pitch, ctx.source + (firstRow + r) * ctx.sourcePitch, pitch);
+        ctx.rowsRead.push_back(firstRow + r);
+    }
+    return TRUE;
+}
+
+XBOOL WriteRows(void *userData, int firstRow, int rowCount, const XBYTE *rows, int pitch) {
+    StreamContext &ctx = *static_cast<StreamContext *>(userData);
+    for (int r = 0; r < rowCount; ++r) {
+        memcpy(ctx.destination + (firstRow + r) * ctx.destinationPitch, rows + r * pitch, pitch);
+    }
+    ctx.maxRowsPerWrite = (std::max)(ctx.maxRowsPerWrite, rowCount);
+    return TRUE;
+}
+
+} // namespace
+
+class BlitEngineStreamTest : public BlitEngineTestBase {
+protected:
+    void SetUp() override {
+        BlitEngineTestBase::SetUp();
+        VxGetBlitParallelism(m_PreviousThreads, m_PreviousMinRows);
+    }
+
+    void TearDown() override {
+        VxSetBlitParallelism(m_PreviousThreads, m_PreviousMinRows);
+        BlitEngineTestBase::TearDown();
+    }
+
+    static void FillNoise(ImageBuffer &buffer, XDWORD seed) {
+        for (size_t i = 0; i < buffer.Size(); ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            buffer[i] = static_cast<XBYTE>(seed >> 24);
+        }
+    }
+
+    static void ExpectIncreasingOnce(const std::vector<int> &rows) {
+        for (size_t i = 1; i < rows.size(); ++i) {
+            ASSERT_LT(rows[i - 1], rows[i]) << "read " << i;
+        }
+    }
+
+    // Streams src -> dst through both callbacks and compares with VxDoBlit.
+    static void ExpectStreamMatchesDoBlit(const VxImageDescEx &srcDesc, const VxImageDescEx &dstTemplate,
+                                          int bandRows, std::vector<int> *rowsRead = nullptr) {
+        const size_t dstSize = ImageDescFactory::CalcBufferSize(dstTemplate);
+        ImageBuffer expected(dstSize);
+        ImageBuffer actual(dstSize);
+        VxImageDescEx expectedDesc = dstTemplate;
+        expectedDesc.Image = expected.Data();
+        VxDoBlit(srcDesc, expectedDesc);
+
+        StreamContext ctx;
+        ctx.source = srcDesc.Image;
+        ctx.sourcePitch = srcDesc.BytesPerLine;
+        ctx.destination = actual.Data();
+        ctx.destinationPitch = dstTemplate.BytesPerLine;
+        VxImageDescEx streamSrc = srcDesc;
+        streamSrc.Image = nullptr;
+        VxImageDescEx streamDst = dstTemplate;
+        streamDst.Image = nullptr;
+        ASSERT_TRUE(VxStreamBlit(streamSrc, streamDst, ReadRows, WriteRows, &ctx, bandRows));
+        EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), dstSize))
+            << srcDesc.Width << "x" << srcDesc.Height << " -> " << dstTemplate.Width << "x" << dstTemplate.Height
+            << " band " << bandRows;
+        ExpectIncreasingOnce(ctx.rowsRead);
+        if (bandRows > 0) {
+            EXPECT_LE(ctx.maxRowsPerWrite, bandRows);
+        }
+        if (rowsRead) *rowsRead = ctx.rowsRead;
+    }
+
+    int m_PreviousThreads = 1;
+    int m_PreviousMinRows = 64;
+};
+
+TEST_F(BlitEngineStreamTest, SameSizeMatchesDoBlit) {
+    const int width = 45;
+    const int height = 37;
+    ImageBuffer src(width * height * 4);
+    FillNoise(src, 1);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, height, src.Data());
+
+    const VxImageDescEx targets[] = {
+        ImageDescFactory::Create16Bit565(width, height),
+        ImageDescFactory::Create24BitRGB(width, height),
+        ImageDescFactory::Create32BitABGR(width, height),
+    };
+    const int bands[] = {0, 1, 5, 37, 100};
+    for (const VxImageDescEx &target : targets) {
+        for (int band : bands) {
+            std::vector<int> rowsRead;
+            ExpectStreamMatchesDoBlit(srcDesc, target, band, &rowsRead);
+            EXPECT_EQ(static_cast<size_t>(height), rowsRead.size());
+        }
+    }
+}
+
+TEST_F(BlitEngineStreamTest, ResizeMatchesDoBlitAndReadsSampledRowsOnce) {
+    ImageBuffer src(64 * 60 * 4);
+    FillNoise(src, 2);
+    struct Size {
+        int w, h;
+    };
+    const Size sources[] = {{64, 60}, {17, 9}};
+    const Size targets[] = {{32, 20}, {100, 131}, {64, 7}, {17, 60}};
+    const int bands[] = {0, 1, 3, 16};
+    for (const Size &s : sources) {
+        VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(s.w, s.h, src.Data());
+        for (const Size &t : targets) {
+            if (t.w == s.w && t.h == s.h) continue;
+            for (int band : bands) {
+                ExpectStreamMatchesDoBlit(srcDesc, ImageDescFactory::Create32BitARGB(t.w, t.h), band);
+                ExpectStreamMatchesDoBlit(srcDesc, ImageDescFactory::Create16Bit565(t.w, t.h), band);
+            }
+        }
+    }
+
+    // Shrinking 4:1 vertically only reads the rows that are sampled.
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(64, 60, src.Data());
+    std::vector<int> rowsRead;
+    ExpectStreamMatchesDoBlit(srcDesc, ImageDescFactory::Create32BitARGB(64, 15), 4, &rowsRead);
+    ASSERT_EQ(15u, rowsRead.size());
+    for (int i = 0; i < 15; ++i) EXPECT_EQ(i * 4, rowsRead[i]);
+}
+
+TEST_F(BlitEngineStreamTest, ResidentImagesMixWithCallbacks) {
+    const int width = 30;
+    const int height = 25;
+    ImageBuffer src(width * height * 4);
+    FillNoise(src, 3);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, height, src.Data());
+
+    ImageBuffer expected(40 * 50 * 2);
+    VxImageDescEx expectedDesc = ImageDescFactory::Create16Bit565(40, 50, expected.Data());
+    VxDoBlit(srcDesc, expectedDesc);
+
+    // Resident source (e.g. a memory-mapped file), streamed destination.
+    ImageBuffer written(expected.Size());
+    StreamContext ctx;
+    ctx.destination = written.Data();
+    ctx.destinationPitch = expectedDesc.BytesPerLine;
+    VxImageDescEx streamDst = ImageDescFactory::Create16Bit565(40, 50);
+    ASSERT_TRUE(VxStreamBlit(srcDesc, streamDst, nullptr, WriteRows, &ctx, 6));
+    EXPECT_EQ(0, memcmp(expected.Data(), written.Data(), expected.Size()));
+
+    // Streamed source, resident destination.
+    ImageBuffer direct(expected.Size());
+    StreamContext readCtx;
+    readCtx.source = src.Data();
+    readCtx.sourcePitch = srcDesc.BytesPerLine;
+    VxImageDescEx streamSrc = srcDesc;
+    streamSrc.Image = nullptr;
+    VxImageDescEx directDesc = ImageDescFactory::Create16Bit565(40, 50, direct.Data());
+    ASSERT_TRUE(VxStreamBlit(streamSrc, directDesc, ReadRows, nullptr, &readCtx, 7));
+    EXPECT_EQ(0, memcmp(expected.Data(), direct.Data(), expected.Size()));
+}
+
+TEST_F(BlitEngineStreamTest, ParallelBandsMatchSerial) {
+    const int width = 200;
+    const int height = 300;
+    ImageBuffer src(width * height * 4);
+    FillNoise(src, 4);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, height, src.Data());
+
+    VxSetBlitParallelism(4, 8);
+    ExpectStreamMatchesDoBlit(srcDesc, ImageDescFactory::Create16Bit565(width, height), 64);
+}
+
+TEST_F(BlitEngineStreamTest, AbortsAndRejects) {
+    const int width = 16;
+    const int height = 16;
+    ImageBuffer src(width * height * 4);
+    ImageBuffer dst(width * height * 2);
+    VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, height);
+    VxImageDescEx dstDesc = ImageDescFactory::Create16Bit565(width, height, dst.Data());
+
+    StreamContext ctx;
+    ctx.source = src.Data();
+    ctx.sourcePitch = width * 4;
+    ctx.abortAfterReads = 8;
+    EXPECT_FALSE(VxStreamBlit(srcDesc, dstDesc, ReadRows, nullptr, &ctx, 4));
+    EXPECT_EQ(8u, ctx.rowsRead.size());
+
+    // No source, no destination, and pairs that need the whole image.
+    EXPECT_FALSE(VxStreamBlit(srcDesc, dstDesc, nullptr, nullptr, nullptr));
+    EXPECT_FALSE(VxStreamBlit(ImageDescFactory::Create32BitARGB(width, height, src.Data()),
+                              ImageDescFactory::Create16Bit565(width, height), nullptr, nullptr, nullptr));
+    ImageBuffer indices(width * height);
+    PaletteBuffer palette;
+    VxImageDescEx paletted = ImageDescFactory::Create8BitPaletted(width, height, indices.Data(), palette.Data());
+    EXPECT_FALSE(VxStreamBlit(ImageDescFactory::Create32BitARGB(width, height, src.Data()), paletted, nullptr,
+                              nullptr, nullptr));
+    EXPECT_FALSE(VxStreamBlit(ImageDescFactory::Create16Bit565(width, height, dst.Data()),
+                              ImageDescFactory::Create16Bit565(width * 2, height, src.Data()), nullptr, nullptr,
+                              nullptr));
+}
@@ -748,6 +748,10 @@ public:
         VxResizeImage32(src, dst);
     }
 
+    void ResizeImage(const VxImageDescEx& src, const VxImageDescEx& dst, VX_RESIZEFILTER filter) {
+        VxResizeImage32(src, dst, filter);
+    }
+
     XBOOL QuantizeImage(const VxImageDescEx& src, VxImageDescEx& dst) {
         // Call TheBlitter.QuantizeImage directly
         return TheBlitter.QuantizeImage(src, dst);
@@ -0,0 +1,355 @@
+/**
+ * @file BlitEngineYUVTest.cpp
+ * @brief Tests for YUV (I420, NV12, YUY2) to and from ARGB conversion.
+ *
+ * Tests:
+ * - Decoding matches a per-pixel reference for every format and matrix, at
+ *   odd sizes, on every available SIMD tier
+ * - Encoding to I420 and NV12 matches a per-pixel reference on every tier
+ * - Flat 2x2 blocks survive an encode/decode round trip
+ * - Converting with a resize matches decoding and then resizing
+ * - Invalid descriptors are rejected
+ */
+
+#include "BlitEngineTestHelpers.h"
+
+using namespace BlitEngineTest;
+
+class BlitEngineYUVTest : public BlitEngineTestBase {
+protected:
+    void SetUp() override {
+        BlitEngineTestBase::SetUp();
+        m_PreviousSIMDMode = VxGetSIMDOverride();
+    }
+
+    void TearDown() override {
+        VxSetSIMDOverride(m_PreviousSIMDMode);
+        BlitEngineTestBase::TearDown();
+    }
+
+    // Planes of one YUV image with deterministic content.
+    struct YUVImage {
+        std::vector<XBYTE> planes[3];
+        VxYUVImageDesc desc;
+
+        YUVImage(int format, int matrix, int width, int height) {
+            const int chromaWidth = (width + 1) / 2;
+            const int chromaHeight = (height + 1) / 2;
+            desc.Format = format;
+            desc.Matrix = matrix;
+            desc.Width = width;
+            desc.Height = height;
+            switch (format) {
+                case VX_YUV_I420:
+                    Allocate(0, width + 3, height);
+                    Allocate(1, chromaWidth + 1, chromaHeight);
+                    Allocate(2, chromaWidth + 2, chromaHeight);
+                    break;
+                case VX_YUV_NV12:
+                    Allocate(0, width + 3, height);
+                    Allocate(1, chromaWidth * 2 + 2, chromaHeight);
+                    break;
+                default:
+                    Allocate(0, chromaWidth * 4 + 4, height);
+                    break;
+            }
+        }
+
+        void Allocate(int plane, int pitch, int rows) {
+            planes[plane].resize(pitch * rows);
+            for (size_t i = 0; i < planes[plane].size(); ++i) {
+                planes[plane][i] = static_cast<XBYTE>((i * 97 + plane * 51 + 13) ^ (i >> 3));
+            }
+            desc.Planes[plane] = planes[plane].data();
+            desc.Pitches[plane] = pitch;
+        }
+
+        void Sample(int x, int y, int &luma, int &u, int &v) const {
+            const int cx = x / 2;
+            const int cy = y / 2;
+            switch (desc.Format) {
+                case VX_YUV_I420:
+                    luma = desc.Planes[0][y * desc.Pitches[0] + x];
+                    u = desc.Planes[1][cy * desc.Pitches[1] + cx];
+                    v = desc.Planes[2][cy * desc.Pitches[2] + cx];
+                    break;
+                case VX_YUV_NV12:
+                    luma = desc.Planes[0][y * desc.Pitches[0] + x];
+                    u = desc.Planes[1][cy * desc.Pitches[1] + cx * 2];
+                    v = desc.Planes[1][cy * desc.Pitches[1] + cx * 2 + 1];
+                    break;
+                default: {
+                    const XBYTE *group = desc.Planes[0] + y * desc.Pitches[0] + cx * 4;
+                    luma = group[(x & 1) * 2];
+                    u = group[1];
+                    v = group[3];
+                    break;
+                }
+            }
+        }
+    };
+
+    // 13-bit fixed-point studio-range coefficients.
+    static XDWORD DecodeReference(int matrix, int luma, int u, int v) {
+        static const int k[2][5] = {{9539, 13075, -3209, -6660, 16525}, {9539, 14686, -1747, -4366, 17305}};
+        const int *c = k[matrix];
+        const int base = c[0] * (luma - 16) + 4096;
+        u -= 128;
+        v -= 128;
+        const int r = XMax(0, XMin(255, (base + c[1] * v) >> 13));
+        const int g = XMax(0, XMin(255, (base + c[2] * u + c[3] * v) >> 13));
+        const int b = XMax(0, XMin(255, (base + c[4] * u) >> 13));
+        return 0xFF000000u | (r << 16) | (g << 8) | b;
+    }
+
+    static int Weigh(const int w[3], int r, int g, int b, int bias) {
+        return (w[0] * r + w[1] * g + w[2] * b + 128 + (bias << 8)) >> 8;
+    }
+
+    static const int *Weights(int matrix, int row) {
+        static const int w[2][3][3] = {{{66, 129, 25}, {-38, -74, 112}, {112, -94, -18}},
+                                       {{47, 157, 16}, {-26, -86, 112}, {112, -102, -10}}};
+        return w[matrix][row];
+    }
+
+    static int Channel(XDWORD pixel, int shift) { return (pixel >> shift) & 0xFF; }
+
+    static std::vector<int> AvailableModes() {
+        const int candidates[] = {VX_SIMD_MODE_NONE, VX_SIMD_MODE_SSE2, VX_SIMD_MODE_AVX2, VX_SIMD_MODE_AVX512,
+                                  VX_SIMD_MODE_NEON, VX_SIMD_MODE_WASM_SIMD128};
+        std::vector<int> modes;
+        for (int mode : candidates) {
+            if (VxSetSIMDOverride(mode) && VxGetSIMDEffectiveBackend() == mode) modes.push_back(mode);
+        }
+        return modes;
+    }
+
+    int m_PreviousSIMDMode = VX_SIMD_MODE_AUTO;
+};
+
+TEST_F(BlitEngineYUVTest, DecodeMatchesReference) {
+    const int sizes[][2] = {{1, 1}, {3, 2}, {15, 3}, {16, 4}, {17, 5}, {33, 7}, {64, 2}, {71, 3}};
+    for (int mode : AvailableModes()) {
+        ASSERT_TRUE(VxSetSIMDOverride(mode));
+        for (int format = VX_YUV_I420; format <= VX_YUV_YUY2; ++format) {
+            for (int matrix = VX_YUVMATRIX_BT601; matrix <= VX_YUVMATRIX_BT709; ++matrix) {
+                for (const auto &size : sizes) {
+                    const int width = size[0];
+                    const int height = size[1];
+                    YUVImage yuv(format, matrix, width, height);
+                    const int pitch = width * 4 + 8;
+                    ImageBuffer dst(pitch * height, 0xCD);
+                    VxImageDescEx dstDesc = ImageDescFactory::Create32BitARGB(width, height, dst.Data());
+                    dstDesc.BytesPerLine = pitch;
+
+                    ASSERT_TRUE(VxConvertFromYUV(yuv.desc, dstDesc));
+                    for (int y = 0; y < height; ++y) {
+                        const XDWORD *row = reinterpret_cast<const XDWORD *>(dst.Data() + y * pitch);
+                        for (int x = 0; x < width; ++x) {
+                            int luma, u, v;
+                            yuv.Sample(x, y, luma, u, v);
+                            ASSERT_EQ(DecodeReference(matrix, luma, u, v), row[x])
+                                << "mode=" << mode << " format=" << format << " matrix=" << matrix
+                                << " size=" << width << "x" << height << " at " << x << "," << y;
+                        }
+                        // Padding after the row is untouched.
+                        ASSERT_EQ(0xCD, dst[y * pitch + width * 4]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineYUVTest, DecodesReferenceColors) {
+    YUVImage yuv(VX_YUV_I420, VX_YUVMATRIX_BT601, 2, 2);
+    XDWORD out[4];
+    VxImageDescEx dstDesc = ImageDescFactory::Create32BitARGB(2, 2, reinterpret_cast<XBYTE *>(out));
+
+    const struct {
+        int y, u, v;
+        XDWORD argb;
+    } colors[] = {
+        {16, 128, 128, 0xFF000000},
+        {235, 128, 128, 0xFFFFFFFF},
+        {81, 90, 240, 0xFFFE0000},
+        {145, 54, 34, 0xFF00FF01},
+        {41, 240, 110, 0xFF0000FF},
+    };
+    for (const auto &c : colors) {
+        std::fill(yuv.planes[0].begin(), yuv.planes[0].end(), static_cast<XBYTE>(c.y));
+        std::fill(yuv.planes[1].begin(), yuv.planes[1].end(), static_cast<XBYTE>(c.u));
+        std::fill(yuv.planes[2].begin(), yuv.planes[2].end(), static_cast<XBYTE>(c.v));
+        ASSERT_TRUE(VxConvertFromYUV(yuv.desc, dstDesc));
+        for (XDWORD pixel : out) {
+            EXPECT_EQ(c.argb, pixel) << std::hex << "yuv " << c.y << " " << c.u << " " << c.v;
+        }
+    }
+}
+
+TEST_F(BlitEngineYUVTest, EncodeMatchesReference) {
+    const int sizes[][2] = {{1, 1}, {2, 2}, {15, 3}, {16, 2}, {31, 5}, {32, 4}, {65, 3}, {96, 2}};
+    for (int mode : AvailableModes()) {
+        ASSERT_TRUE(VxSetSIMDOverride(mode));
+        for (int format = VX_YUV_I420; format <= VX_YUV_NV12; ++format) {
+            for (int matrix = VX_YUVMATRIX_BT601; matrix <= VX_YUVMATRIX_BT709; ++matrix) {
+                for (const auto &size : sizes) {
+                    const int width = size[0];
+                    const int height = size[1];
+                    ImageBuffer src(width * height * 4);
+                    for (size_t i = 0; i < src.Size(); ++i) src[i] = static_cast<XBYTE>(i * 71 + (i >> 5) * 29 + 7);
+                    const XDWORD *pixels = reinterpret_cast<const XDWORD *>(src.Data());
+
+                    YUVImage yuv(format, matrix, width, height);
+                    ASSERT_TRUE(VxConvertToYUV(ImageDescFactory::Create32BitARGB(width, height, src.Data()), yuv.desc));
+
+                    for (int y = 0; y < height; ++y) {
+                        for (int x = 0; x < width; ++x) {
+                            const XDWORD p = pixels[y * width + x];
+                            const int expected =
+                                Weigh(Weights(matrix, 0), Channel(p, 16), Channel(p, 8), Channel(p, 0), 16);
+                            ASSERT_EQ(expected, yuv.desc.Planes[0][y * yuv.desc.Pitches[0] + x])
+                                << "mode=" << mode << " format=" << format << " luma at " << x << "," << y;
+                        }
+                    }
+
+                    for (int cy = 0; cy < (height + 1) / 2; ++cy) {
+                        for (int cx = 0; cx < (width + 1) / 2; ++cx) {
+                            // Edge blocks repeat the last column and row.
+                            const int xs[2] = {cx * 2, XMin(cx * 2 + 1, width - 1)};
+                            const int ys[2] = {cy * 2, XMin(cy * 2 + 1, height - 1)};
+                            int sum[3] = {0, 0, 0};
+                            for (int j = 0; j < 2; ++j) {
+                                for (int i = 0; i < 2; ++i) {
+                                    const XDWORD p = pixels[ys[j] * width + xs[i]];
+                                    for (int c = 0; c < 3; ++c) sum[c] += Channel(p, 16 - c * 8);
+                                }
+                            }
+                            const int r = (sum[0] + 2) >> 2;
+                            const int g = (sum[1] + 2) >> 2;
+                            const int b = (sum[2] + 2) >> 2;
+                            int u, v;
+                            if (format == VX_YUV_I420) {
+                                u = yuv.desc.Planes[1][cy * yuv.desc.Pitches[1] + cx];
+                                v = yuv.desc.Planes[2][cy * yuv.desc.Pitches[2] + cx];
+                            } else {
+                                u = yuv.desc.Planes[1][cy * yuv.desc.Pitches[1] + cx * 2];
+                                v = yuv.desc.Planes[1][cy * yuv.desc.Pitches[1] + cx * 2 + 1];
+                            }
+                            ASSERT_EQ(Weigh(Weights(matrix, 1), r, g, b, 128), u)
+                                << "mode=" << mode << " format=" << format << " chroma at " << cx << "," << cy;
+                            ASSERT_EQ(Weigh(Weights(matrix, 2), r, g, b, 128), v)
+                                << "mode=" << mode << " format=" << format << " chroma at " << cx << "," << cy;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineYUVTest, FlatBlocksRoundTrip) {
+    const int width = 38;
+    const int height = 6;
+    std::vector<XDWORD> src(width * height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const XDWORD block = (y / 2) * 19 + x / 2;
+            src[y * width + x] = 0xFF000000u | ((block * 53 % 256) << 16) | ((block * 101 % 256) << 8) |
+                                 (block * 29 % 256);
+        }
+    }
+    const VxImageDescEx srcDesc = ImageDescFactory::Create32BitARGB(width, height, reinterpret_cast<XBYTE *>(src.data()));
+
+    for (int format = VX_YUV_I420; format <= VX_YUV_NV12; ++format) {
+        for (int matrix = VX_YUVMATRIX_BT601; matrix <= VX_YUVMATRIX_BT709; ++matrix) {
+            YUVImage yuv(format, matrix, width, height);
+            ASSERT_TRUE(VxConvertToYUV(srcDesc, yuv.desc));
+
+            std::vector<XDWORD> out(width * height);
+            ASSERT_TRUE(VxConvertFromYUV(
+                yuv.desc, ImageDescFactory::Create32BitARGB(width, height, reinterpret_cast<XBYTE *>(out.data()))));
+            for (size_t i = 0; i < src.size(); ++i) {
+                for (int shift = 0; shift < 24; shift += 8) {
+                    ASSERT_NEAR(Channel(src[i], shift), Channel(out[i], shift), 3)
+                        << "format=" << format << " matrix=" << matrix << " pixel " << i;
+                }
+                ASSERT_EQ(0xFFu, out[i] >> 24);
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineYUVTest, ResizeMatchesDecodeThenResize) {
+    const int srcW = 45;
+    const int srcH = 29;
+    const int dstSizes[][2] = {{20, 13}, {97, 61}, {45, 11}};
+    const VX_RESIZEFILTER filters[] = {VX_RESIZEFILTER_BILINEAR, VX_RESIZEFILTER_BOX, VX_RESIZEFILTER_LANCZOS3};
+
+    for (int format = VX_YUV_I420; format <= VX_YUV_YUY2; ++format) {
+        YUVImage yuv(format, VX_YUVMATRIX_BT709, srcW, srcH);
+        std::vector<XDWORD> decoded(srcW * srcH);
+        const VxImageDescEx decodedDesc =
+            ImageDescFactory::Create32BitARGB(srcW, srcH, reinterpret_cast<XBYTE *>(decoded.data()));
+        ASSERT_TRUE(VxConvertFromYUV(yuv.desc, decodedDesc));
+
+        for (const auto &size : dstSizes) {
+            const int dstW = size[0];
+            const int dstH = size[1];
+            for (VX_RESIZEFILTER filter : filters) {
+                std::vector<XDWORD> expected(dstW * dstH);
+                VxResizeImage32(decodedDesc,
+                                ImageDescFactory::Create32BitARGB(dstW, dstH, reinterpret_cast<XBYTE *>(expected.data())),
+                                filter);
+
+                std::vector<XDWORD> direct(dstW * dstH);
+                ASSERT_TRUE(VxConvertFromYUV(
+                    yuv.desc,
+                    ImageDescFactory::Create32BitARGB(dstW, dstH, reinterpret_cast<XBYTE *>(direct.data())), filter));
+                ASSERT_EQ(expected, direct) << "format=" << format << " filter=" << filter << " size=" << dstW << "x"
+                                            << dstH;
+
+                // Non-ARGB destinations pack the same pixels.
+                std::vector<XWORD> packed(dstW * dstH);
+                std::vector<XWORD> packedExpected(dstW * dstH);
+                const VxImageDescEx packedDesc =
+                    ImageDescFactory::Create16Bit565(dstW, dstH, reinterpret_cast<XBYTE *>(packed.data()));
+                ASSERT_TRUE(VxConvertFromYUV(yuv.desc, packedDesc, filter));
+                VxDoBlit(ImageDescFactory::Create32BitARGB(dstW, dstH, reinterpret_cast<XBYTE *>(expected.data())),
+                         ImageDescFactory::Create16Bit565(dstW, dstH, reinterpret_cast<XBYTE *>(packedExpected.data())));
+                ASSERT_EQ(packedExpected, packed) << "format=" << format << " filter=" << filter;
+            }
+        }
+    }
+}
+
+TEST_F(BlitEngineYUVTest, RejectsInvalidDescriptors) {
+    YUVImage yuv(VX_YUV_I420, VX_YUVMATRIX_BT601, 8, 4);
+    std::vector<XDWORD> argb(8 * 4);
+    const VxImageDescEx argbDesc = ImageDescFactory::Create32BitARGB(8, 4, reinterpret_cast<XBYTE *>(argb.data()));
+
+    VxYUVImageDesc bad = yuv.desc;
+    bad.Planes[2] = nullptr;
+    EXPECT_FALSE(VxConvertFromYUV(bad, argbDesc));
+    EXPECT_FALSE(VxConvertToYUV(argbDesc, bad));
+
+    bad = yuv.desc;
+    bad.Pitches[1] = 3;
+    EXPECT_FALSE(VxConvertFromYUV(bad, argbDesc));
+
+    bad = yuv.desc;
+    bad.Matrix = 2;
+    EXPECT_FALSE(VxConvertFromYUV(bad, argbDesc));
+
+    bad = yuv.desc;
+    bad.Format = 3;
+    EXPECT_FALSE(VxConvertFromYUV(bad, argbDesc));
+
+    // Encoding needs matching sizes and a planar destination.
+    const VxImageDescEx smaller = ImageDescFactory::Create32BitARGB(6, 4, reinterpret_cast<XBYTE *>(argb.data()));
+    EXPECT_FALSE(VxConvertToYUV(smaller, yuv.desc));
+
+    YUVImage packed(VX_YUV_YUY2, VX_YUVMATRIX_BT601, 8, 4);
+    EXPECT_TRUE(VxConvertFromYUV(packed.desc, argbDesc));
+    EXPECT_FALSE(VxConvertToYUV(argbDesc, packed.desc));
+}
@@ -61,6 +61,18 @@ bool ParseBackendMode(const char *value, int &mode) {
         mode = VX_SIMD_MODE_AVX2;
         return true;
     }
+    if (EqualsIgnoreCase(value, "avx512")) {
+        mode = VX_SIMD_MODE_AVX512;
+        return true;
+    }
+    if (EqualsIgnoreCase(value, "neon")) {
+        mode = VX_SIMD_MODE_NEON;
+        return true;
+    }
+    if (EqualsIgnoreCase(value, "wasm_simd128") || EqualsIgnoreCase(value, "simd128")) {
+        mode = VX_SIMD_MODE_WASM_SIMD128;
+        return true;
+    }
     return false;
 }
 
@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "VxMath.h"
+
+namespace {
+
+class PerfCountersTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        VxEnablePerfCounters(FALSE);
+        VxResetPerfCounters();
+    }
+
+    void TearDown() override {
+        VxEnablePerfCounters(FALSE);
+        VxResetPerfCounters();
+    }
+};
+
+unsigned long long Counter(VX_PERFCOUNTER counter) {
+    VxPerfCounterSnapshot snapshot;
+    VxGetPerfCounters(snapshot);
+    return snapshot.Counters[counter];
+}
+
+void RunQueries(int count) {
+    const VxBbox box(VxVector(-1.0f, -1.0f, -1.0f), VxVector(1.0f, 1.0f, 1.0f));
+    const VxRay ray(VxVector(-5.0f, 0.0f, 0.0f), VxVector(5.0f, 0.0f, 0.0f));
+    for (int i = 0; i < count; ++i) {
+        VxIntersect::RayBox(ray, box);
+        VxIntersect::AABBAABB(box, box);
+        VxDistance::PointSegmentSquareDistance(VxVector(0.0f, 1.0f, 0.0f), ray);
+    }
+}
+
+VxImageDescEx MakeImage(VX_PIXELFORMAT format, int width, int height, std::vector<XBYTE> &pixels) {
+    VxImageDescEx desc;
+    VxPixelFormat2ImageDesc(format, desc);
+    desc.Width = width;
+    desc.Height = height;
+    desc.BytesPerLine = width * desc.BitsPerPixel / 8;
+    pixels.assign(desc.BytesPerLine * height, 0x7F);
+    desc.Image = pixels.data();
+    return desc;
+}
+
+std::string ReadFile(const std::string &path) {
+    std::string text;
+    FILE *file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        return text;
+    }
+    char buffer[512];
+    size_t read;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        text.append(buffer, read);
+    }
+    std::fclose(file);
+    return text;
+}
+
+} // namespace
+
+TEST_F(PerfCountersTest, DisabledCountersRecordNothing) {
+    EXPECT_FALSE(VxArePerfCountersEnabled());
+    RunQueries(10);
+    VxAddPerfCounter(VX_PERFCOUNTER_ALLOC_CALLS, 5);
+
+    VxPerfCounterSnapshot snapshot;
+    VxGetPerfCounters(snapshot);
+    for (int i = 0; i < VX_PERFCOUNTER_COUNT; ++i) {
+        EXPECT_EQ(snapshot.Counters[i], 0u) << VxGetPerfCounterName((VX_PERFCOUNTER) i);
+    }
+    EXPECT_EQ(snapshot.Blits.Size(), 0);
+}
+
+TEST_F(PerfCountersTest, CountsIntersectionAndDistanceQueries) {
+    VxEnablePerfCounters(TRUE);
+    RunQueries(25);
+
+    EXPECT_EQ(Counter(VX_PERFCOUNTER_RAY_QUERIES), 25u);
+    EXPECT_EQ(Counter(VX_PERFCOUNTER_VOLUME_QUERIES), 25u);
+    EXPECT_EQ(Counter(VX_PERFCOUNTER_DISTANCE_QUERIES), 25u);
+}
+
+TEST_F(PerfCountersTest, RecordsBlitsPerFormatPair) {
+    std::vector<XBYTE> srcPixels, dstPixels;
+    const VxImageDescEx src = MakeImage(_32_ARGB8888, 16, 8, srcPixels);
+    const VxImageDescEx dst = MakeImage(_16_RGB565, 16, 8, dstPixels);
+
+    VxEnablePerfCounters(TRUE);
+    VxDoBlit(src, dst);
+    VxDoBlit(src, dst);
+    const CKRECT rect = {0, 0, 4, 4};
+    VxDoBlit(src, dst, &rect, &rect);
+
+    VxPerfCounterSnapshot snapshot;
+    VxGetPerfCounters(snapshot);
+    ASSERT_EQ(snapshot.Blits.Size(), 1);
+    const VxPerfBlitCounters &pair = snapshot.Blits[0];
+    EXPECT_EQ(pair.SrcFormat, _32_ARGB8888);
+    EXPECT_EQ(pair.DstFormat, _16_RGB565);
+    EXPECT_EQ(pair.Calls, 3u);
+    EXPECT_EQ(pair.Pixels, 2u * 16 * 8 + 4 * 4);
+    EXPECT_EQ(pair.Bytes, 2u * 16 * 8 * (4 + 2) + 4 * 4 * (4 + 2));
+}
+
+TEST_F(PerfCountersTest, CountsHashTableRehashesAndAllocations) {
+    VxEnablePerfCounters(TRUE);
+    {
+        XHashTable<int, int> table;
+        for (int i = 0; i < 1000; ++i) {
+            table.Insert(i, i);
+        }
+    }
+    EXPECT_GT(Counter(VX_PERFCOUNTER_HASHTABLE_REHASHES), 0u);
+
+    VxResetPerfCounters();
+    void *block = VxNewAligned(100, 32);
+    VxDeleteAligned(block);
+    VxDeleteAligned(NULL);
+    EXPECT_EQ(Counter(VX_PERFCOUNTER_ALLOC_CALLS), 1u);
+    EXPECT_EQ(Counter(VX_PERFCOUNTER_ALLOC_BYTES), 100u);
+    EXPECT_EQ(Counter(VX_PERFCOUNTER_FREE_CALLS), 1u);
+}
+
+TEST_F(PerfCountersTest, SumsThreadsAndResets) {
+    VxEnablePerfCounters(TRUE);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() { RunQueries(100); });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(Counter(VX_PERFCOUNTER_RAY_QUERIES), 400u);
+
+    VxResetPerfCounters();
+    EXPECT_EQ(Counter(VX_PERFCOUNTER_RAY_QUERIES), 0u);
+    RunQueries(3);
+    EXPECT_EQ(Counter(VX_PERFCOUNTER_RAY_QUERIES), 3u);
+}
+
+TEST_F(PerfCountersTest, WritesTextAndJSON) {
+    std::vector<XBYTE> srcPixels, dstPixels;
+    const VxImageDescEx src = MakeImage(_32_ARGB8888, 8, 8, srcPixels);
+    const VxImageDescEx dst = MakeImage(_16_RGB565, 8, 8, dstPixels);
+
+    VxEnablePerfCounters(TRUE);
+    RunQueries(2);
+    VxDoBlit(src, dst);
+
+    VxPerfCounterSnapshot snapshot;
+    VxGetPerfCounters(snapshot);
+
+    const std::string jsonPath = ::testing::TempDir() + "vxmath_perf_counters.json";
+    ASSERT_TRUE(VxWritePerfCounters(snapshot, jsonPath.c_str(), TRUE));
+    const std::string json = ReadFile(jsonPath);
+    std::remove(jsonPath.c_str());
+    EXPECT_NE(json.find("\"ray_queries\": 2"), std::string::npos);
+    EXPECT_NE(json.find("\"blits\": ["), std::string::npos);
+    EXPECT_NE(json.find("\"calls\": 1"), std::string::npos);
+
+    const std::string textPath = ::testing::TempDir() + "vxmath_perf_counters.txt";
+    ASSERT_TRUE(VxWritePerfCounters(snapshot, textPath.c_str(), FALSE));
+    const std::string text = ReadFile(textPath);
+    std::remove(textPath.c_str());
+    EXPECT_NE(text.find("distance_queries"), std::string::npos);
+
+    EXPECT_FALSE(VxWritePerfCounters(snapshot, NULL, TRUE));
+    EXPECT_EQ(VxGetPerfCounterName(VX_PERFCOUNTER_COUNT), nullptr);
+}
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "VxMath.h"
+
+namespace {
+
+class SIMDDispatchRegistryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        VxSetSIMDOverride(VX_SIMD_MODE_AUTO);
+        VxResetSIMDDispatchEntryOverrides();
+    }
+
+    void TearDown() override {
+        VxResetSIMDDispatchEntryOverrides();
+        VxSetSIMDOverride(VX_SIMD_MODE_AUTO);
+    }
+};
+
+bool FindEntry(const char *name, VxSIMDDispatchEntryInfo &info) {
+    const int count = VxGetSIMDDispatchEntryCount();
+    for (int i = 0; i < count; ++i) {
+        if (VxGetSIMDDispatchEntry(i, info) && strcmp(info.Name, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string ReadFile(const std::string &path) {
+    std::string text;
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file) {
+        return text;
+    }
+    char buffer[512];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        text.append(buffer, read);
+    }
+    fclose(file);
+    return text;
+}
+
+void WriteFile(const std::string &path, const std::string &text) {
+    FILE *file = fopen(path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(text.data(), 1, text.size(), file);
+    fclose(file);
+}
+
+// The first four lines of a cache identify the CPU and backend.
+std::string CacheHeader(const std::string &text) {
+    size_t end = 0;
+    for (int line = 0; line < 4 && end != std::string::npos; ++line) {
+        end = text.find('\n', end);
+        if (end != std::string::npos) {
+            ++end;
+        }
+    }
+    return end == std::string::npos ? text : text.substr(0, end);
+}
+
+VxImageDescEx MakeDesc(int size, std::vector<XBYTE> &pixels) {
+    VxImageDescEx desc;
+    VxPixelFormat2ImageDesc(_32_ARGB8888, desc);
+    desc.Width = size;
+    desc.Height = size;
+    desc.BytesPerLine = size * 4;
+    desc.Image = pixels.data();
+    return desc;
+}
+
+} // namespace
+
+TEST_F(SIMDDispatchRegistryTest, ListsUniqueEntriesWithBoundCandidate) {
+    const int count = VxGetSIMDDispatchEntryCount();
+    ASSERT_GT(count, 0);
+
+    std::set<std::string> names;
+    for (int i = 0; i < count; ++i) {
+        VxSIMDDispatchEntryInfo info;
+        ASSERT_TRUE(VxGetSIMDDispatchEntry(i, info));
+        ASSERT_NE(info.Name, nullptr);
+        EXPECT_TRUE(names.insert(info.Name).second) << info.Name;
+        EXPECT_EQ(info.OverrideMode, VX_SIMD_MODE_AUTO) << info.Name;
+        EXPECT_NE(info.CandidateModes & (1u << info.BoundMode), 0u) << info.Name;
+        EXPECT_NE(info.CandidateModes & (1u << VX_SIMD_MODE_NONE), 0u) << info.Name;
+    }
+
+    EXPECT_TRUE(names.count("math.interpolateFloatArray"));
+    EXPECT_TRUE(names.count("intersect.rayBox"));
+    EXPECT_TRUE(names.count("blit.convert"));
+    EXPECT_TRUE(names.count("blit.resample"));
+
+    VxSIMDDispatchEntryInfo info;
+    EXPECT_FALSE(VxGetSIMDDispatchEntry(-1, info));
+    EXPECT_FALSE(VxGetSIMDDispatchEntry(count, info));
+}
+
+TEST_F(SIMDDispatchRegistryTest, GlobalScalarModeBindsEveryEntryToScalar) {
+    ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_NONE));
+    const int count = VxGetSIMDDispatchEntryCount();
+    for (int i = 0; i < count; ++i) {
+        VxSIMDDispatchEntryInfo info;
+        ASSERT_TRUE(VxGetSIMDDispatchEntry(i, info));
+        EXPECT_EQ(info.BoundMode, VX_SIMD_MODE_NONE) << info.Name;
+    }
+}
+
+TEST_F(SIMDDispatchRegistryTest, RejectsUnknownEntriesAndModes) {
+    EXPECT_FALSE(VxSetSIMDDispatchEntryOverride("math.noSuchFunction", VX_SIMD_MODE_NONE));
+    EXPECT_FALSE(VxSetSIMDDispatchEntryOverride(NULL, VX_SIMD_MODE_NONE));
+    EXPECT_FALSE(VxSetSIMDDispatchEntryOverride("blit.convert", 42));
+    EXPECT_TRUE(VxSetSIMDDispatchEntryOverride("blit.convert", VX_SIMD_MODE_AUTO));
+}
+
+TEST_F(SIMDDispatchRegistryTest, ScalarOverrideAffectsOnlyThatEntry) {
+    VxSIMDDispatchEntryInfo convertBefore;
+    ASSERT_TRUE(FindEntry("blit.convert", convertBefore));
+
+    ASSERT_TRUE(VxSetSIMDDispatchEntryOverride("blit.resample", VX_SIMD_MODE_NONE));
+    VxSIMDDispatchEntryInfo resample;
+    ASSERT_TRUE(FindEntry("blit.resample", resample));
+    EXPECT_EQ(resample.OverrideMode, VX_SIMD_MODE_NONE);
+    EXPECT_EQ(resample.BoundMode, VX_SIMD_MODE_NONE);
+
+    VxSIMDDispatchEntryInfo convertAfter;
+    ASSERT_TRUE(FindEntry("blit.convert", convertAfter));
+    EXPECT_EQ(convertAfter.BoundMode, convertBefore.BoundMode);
+
+    // The overridden entry must produce exactly the scalar result.
+    const int size = 48;
+    std::vector<XBYTE> src(size * size * 4);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<XBYTE>((i * 29 + 11) & 0xFF);
+    }
+    std::vector<XBYTE> overridden(size / 2 * size / 2 * 4);
+    std::vector<XBYTE> scalar(overridden.size());
+    VxResizeImage32(MakeDesc(size, src), MakeDesc(size / 2, overridden), VX_RESIZEFILTER_BILINEAR);
+
+    ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_NONE));
+    VxResizeImage32(MakeDesc(size, src), MakeDesc(size / 2, scalar), VX_RESIZEFILTER_BILINEAR);
+    EXPECT_EQ(overridden, scalar);
+
+    VxResetSIMDDispatchEntryOverrides();
+    ASSERT_TRUE(FindEntry("blit.resample", resample));
+    EXPECT_EQ(resample.OverrideMode, VX_SIMD_MODE_AUTO);
+}
+
+TEST_F(SIMDDispatchRegistryTest, OverrideNeverExceedsGlobalBackend) {
+    const int autoMode = VxGetSIMDEffectiveBackend();
+    ASSERT_TRUE(VxSetSIMDOverride(VX_SIMD_MODE_NONE));
+    if (autoMode == VX_SIMD_MODE_NONE) {
+        GTEST_SKIP() << "No SIMD backend available";
+    }
+    ASSERT_TRUE(VxSetSIMDDispatchEntryOverride("math.interpolateFloatArray", autoMode));
+    VxSIMDDispatchEntryInfo info;
+    ASSERT_TRUE(FindEntry("math.interpolateFloatArray", info));
+    EXPECT_EQ(info.OverrideMode, autoMode);
+    EXPECT_EQ(info.BoundMode, VX_SIMD_MODE_NONE);
+}
+
+TEST_F(SIMDDispatchRegistryTest, CalibrationCacheIsReusedOnlyForMatchingHeader) {
+    const std::string path = ::testing::TempDir() + "vxmath_simd_calibration.txt";
+    std::remove(path.c_str());
+
+    ASSERT_TRUE(VxCalibrateSIMDDispatch(path.c_str()));
+    const std::string text = ReadFile(path);
+    ASSERT_EQ(text.compare(0, 34, "VxMath SIMD dispatch calibration 1"), 0) << text;
+    const std::string header = CacheHeader(text);
+
+    // A cache that matches this CPU is applied as is, without timing.
+    WriteFile(path, header + "math.interpolateFloatArray none\n");
+    ASSERT_TRUE(VxCalibrateSIMDDispatch(path.c_str()));
+    VxSIMDDispatchEntryInfo info;
+    ASSERT_TRUE(FindEntry("math.interpolateFloatArray", info));
+    EXPECT_EQ(info.OverrideMode, VX_SIMD_MODE_NONE);
+    EXPECT_EQ(info.BoundMode, VX_SIMD_MODE_NONE);
+    EXPECT_EQ(ReadFile(path), header + "math.interpolateFloatArray none\n");
+
+    // Any other header forces a fresh calibration that rewrites the cache.
+    WriteFile(path, "VxMath SIMD dispatch calibration 1\ncpu other\nfeatures 00000000\nbackend none\n"
+                    "math.interpolateFloatArray none\n");
+    ASSERT_TRUE(VxCalibrateSIMDDispatch(path.c_str()));
+    EXPECT_EQ(CacheHeader(ReadFile(path)), header);
+
+    std::remove(path.c_str());
+}
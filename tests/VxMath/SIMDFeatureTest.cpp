@@ -51,6 +51,18 @@ TEST(SIMDFeatureDetection, VxDetectSIMDFeatures_ReturnsValidStruct) {
         EXPECT_TRUE(features.AVX2) << "AVX512F implies AVX2";
         EXPECT_TRUE(features.AVX) << "AVX512F implies AVX";
     }
+    if (features.AVX512BW || features.AVX512VL || features.AVX512VBMI) {
+        EXPECT_TRUE(features.AVX512F) << "AVX-512 extensions imply AVX512F";
+    }
+
+    // NEON and SIMD128 builds reach the SSE paths through SIMDe, never natively
+#if defined(VX_SIMD_NEON)
+    EXPECT_TRUE(features.NEON) << "NEON is part of the AArch64 baseline";
+#endif
+    if (features.NEON || features.WASM_SIMD128) {
+        EXPECT_FALSE(features.SSE2) << "SSE2 is only reported on x86";
+        EXPECT_FALSE(features.NEON && features.WASM_SIMD128);
+    }
 }
 
 TEST(SIMDFeatureDetection, VxGetSIMDFeatures_ReturnsCachedValue) {
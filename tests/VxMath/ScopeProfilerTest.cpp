@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define VX_ENABLE_PROFILER
+#include "VxMath.h"
+
+namespace {
+
+class ScopeProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        VxProfilerStop();
+        VxProfilerReset();
+    }
+
+    void TearDown() override {
+        VxProfilerStop();
+        VxProfilerReset();
+    }
+};
+
+std::vector<VxProfileNode> CallTree() {
+    std::vector<VxProfileNode> nodes(VxProfilerGetCallTree(NULL, 0));
+    if (!nodes.empty()) {
+        EXPECT_EQ(VxProfilerGetCallTree(nodes.data(), static_cast<int>(nodes.size())), static_cast<int>(nodes.size()));
+    }
+    return nodes;
+}
+
+const VxProfileNode *FindNode(const std::vector<VxProfileNode> &nodes, const char *name, int depth) {
+    for (const VxProfileNode &node : nodes) {
+        if (std::strcmp(node.Name, name) == 0 && node.Depth == depth) {
+            return &node;
+        }
+    }
+    return nullptr;
+}
+
+void Spin(int iterations) {
+    volatile float sink = 0.0f;
+    for (int i = 0; i < iterations; ++i) {
+        sink = sink + 1.0f;
+    }
+}
+
+void Leaf() {
+    VX_PROFILE_SCOPE("Leaf");
+    Spin(1000);
+}
+
+void Frame() {
+    VX_PROFILE_SCOPE("Frame");
+    for (int i = 0; i < 3; ++i) {
+        Leaf();
+    }
+    {
+        VX_PROFILE_SCOPE("Physics");
+        Leaf();
+    }
+}
+
+} // namespace
+
+TEST_F(ScopeProfilerTest, RecordsNothingUnlessCapturing) {
+    Frame();
+    EXPECT_FALSE(VxProfilerIsCapturing());
+    EXPECT_EQ(VxProfilerGetCallTree(NULL, 0), 0);
+}
+
+TEST_F(ScopeProfilerTest, AggregatesNestedScopesIntoCallTree) {
+    VxProfilerStart();
+    EXPECT_TRUE(VxProfilerIsCapturing());
+    Frame();
+    Frame();
+    VxProfilerStop();
+
+    const std::vector<VxProfileNode> nodes = CallTree();
+    ASSERT_EQ(nodes.size(), 4u);
+
+    // Depth-first: Frame, Frame/Leaf, Frame/Physics, Frame/Physics/Leaf.
+    EXPECT_STREQ(nodes[0].Name, "Frame");
+    EXPECT_EQ(nodes[0].Parent, -1);
+    EXPECT_EQ(nodes[0].Calls, 2);
+
+    const VxProfileNode *leaf = FindNode(nodes, "Leaf", 1);
+    const VxProfileNode *physics = FindNode(nodes, "Physics", 1);
+    const VxProfileNode *physicsLeaf = FindNode(nodes, "Leaf", 2);
+    ASSERT_NE(leaf, nullptr);
+    ASSERT_NE(physics, nullptr);
+    ASSERT_NE(physicsLeaf, nullptr);
+    EXPECT_EQ(leaf->Parent, 0);
+    EXPECT_EQ(leaf->Calls, 6);
+    EXPECT_EQ(physics->Calls, 2);
+    EXPECT_EQ(physicsLeaf->Calls, 2);
+    EXPECT_EQ(&nodes[physicsLeaf->Parent], physics);
+
+    for (const VxProfileNode &node : nodes) {
+        EXPECT_GE(node.TotalMs, node.SelfMs) << node.Name;
+        EXPECT_GE(node.SelfMs, 0.0) << node.Name;
+        EXPECT_LE(node.MinMs, node.MaxMs) << node.Name;
+        EXPECT_LE(node.MaxMs, node.TotalMs) << node.Name;
+    }
+    EXPECT_NEAR(nodes[0].SelfMs, nodes[0].TotalMs - leaf->TotalMs - physics->TotalMs, 1e-6);
+}
+
+TEST_F(ScopeProfilerTest, ScopeOpenWhenStoppedStillCloses) {
+    VxProfilerStart();
+    {
+        VX_PROFILE_SCOPE("Outer");
+        VxProfilerStop();
+        Leaf();
+    }
+    const std::vector<VxProfileNode> nodes = CallTree();
+    ASSERT_EQ(nodes.size(), 1u);
+    EXPECT_STREQ(nodes[0].Name, "Outer");
+    EXPECT_EQ(nodes[0].Calls, 1);
+}
+
+TEST_F(ScopeProfilerTest, MergesThreadsAndResets) {
+    VxProfilerStart();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < 10; ++i) {
+                Frame();
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    VxProfilerStop();
+
+    std::vector<VxProfileNode> nodes = CallTree();
+    const VxProfileNode *frame = FindNode(nodes, "Frame", 0);
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->Calls, 40);
+
+    VxProfilerReset();
+    EXPECT_EQ(VxProfilerGetCallTree(NULL, 0), 0);
+}
+
+TEST_F(ScopeProfilerTest, RingBufferKeepsNewestEvents) {
+    VxProfilerStart();
+    for (int i = 0; i < 100000; ++i) {
+        VX_PROFILE_SCOPE("Tick");
+    }
+    VxProfilerStop();
+
+    const std::vector<VxProfileNode> nodes = CallTree();
+    ASSERT_EQ(nodes.size(), 1u);
+    EXPECT_GT(nodes[0].Calls, 0);
+    EXPECT_LT(nodes[0].Calls, 100000);
+}
+
+TEST_F(ScopeProfilerTest, WritesChromeTrace) {
+    VxProfilerStart();
+    Frame();
+    VxProfilerStop();
+
+    const std::string path = ::testing::TempDir() + "vxmath_profile_trace.json";
+    ASSERT_TRUE(VxProfilerWriteChromeTrace(path.c_str()));
+
+    std::string text;
+    FILE *file = std::fopen(path.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+    char buffer[512];
+    size_t read;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        text.append(buffer, read);
+    }
+    std::fclose(file);
+    std::remove(path.c_str());
+
+    EXPECT_NE(text.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(text.find("\"name\": \"Frame\""), std::string::npos);
+    EXPECT_NE(text.find("\"name\": \"Physics\""), std::string::npos);
+    EXPECT_NE(text.find("\"ph\": \"X\""), std::string::npos);
+    EXPECT_EQ(text.back(), '\n');
+
+    EXPECT_FALSE(VxProfilerWriteChromeTrace(NULL));
+}